@@ -63,6 +63,7 @@
 #include "mbed_boot.h"
 #include "mbed_error.h"
 #include "mbed_mpu_mgmt.h"
+#include "mbed_stats.h"
 
 int main(void);
 static void mbed_cpy_nvic(void);
@@ -73,6 +74,9 @@ uint32_t mbed_stack_isr_size = 0;
 
 void mbed_init(void)
 {
+    // By the time execution reaches here SystemInit has run and the C
+    // runtime has initialized RAM
+    mbed_stats_boot_stage("ram init");
 #ifdef MBED_DEBUG
     // Configs to make debugging easier
 #ifdef SCnSCB_ACTLR_DISDEFWBUF_Msk
@@ -86,19 +90,25 @@ void mbed_init(void)
     mbed_mpu_manager_init();
     mbed_cpy_nvic();
     mbed_sdk_init();
+    mbed_stats_boot_stage("sdk init");
 #if DEVICE_USTICKER && MBED_CONF_TARGET_INIT_US_TICKER_AT_BOOT
     us_ticker_init();
 #endif
     mbed_rtos_init();
+    mbed_stats_boot_stage("rtos init");
 }
 
 void mbed_start(void)
 {
+    // Running in the main thread - the kernel has started
+    mbed_stats_boot_stage("rtos start");
     mbed_rtos_init_singleton_mutex();
     mbed_tfm_init();
     mbed_toolchain_init();
+    mbed_stats_boot_stage("ctor chain");
     mbed_main();
     mbed_error_initialize();
+    mbed_stats_boot_stage("pre-main");
     main();
 }
 
@@ -34,8 +34,15 @@
 
 static void (*terminate_hook)(osThreadId_t id);
 
+#if defined(MBED_THREAD_CPU_STATS_ENABLED)
+static void thread_cpu_release(osThreadId_t id);
+#endif
+
 static void thread_terminate_hook(osThreadId_t id)
 {
+#if defined(MBED_THREAD_CPU_STATS_ENABLED)
+    thread_cpu_release(id);
+#endif
     if (terminate_hook) {
         terminate_hook(id);
     }
@@ -162,6 +169,211 @@ void EvrRtxMessageQueueError(osMessageQueueId_t mq_id, int32_t status)
 
 #endif
 
+#if defined(MBED_THREAD_CPU_STATS_ENABLED) || defined(MBED_SCHEDULER_STATS_ENABLED)
+
+#include <string.h>
+#include "mbed_stats.h"
+#include "mbed_critical.h"
+
+#if defined(DWT) && defined(DWT_CTRL_CYCCNTENA_Msk)
+
+static uint8_t dwt_cyccnt_started;
+
+static uint32_t dwt_cyccnt(void)
+{
+    if (!dwt_cyccnt_started) {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+        dwt_cyccnt_started = 1;
+    }
+    return DWT->CYCCNT;
+}
+
+#if defined(MBED_SCHEDULER_STATS_ENABLED)
+
+static uint32_t sched_pend_cycles;
+static uint8_t sched_pend_active;
+static uint32_t sched_sample_cnt;
+static uint64_t sched_total_cycles;
+static uint32_t sched_max_cycles;
+
+/* Overrides the __WEAK hook in rtx_evr.c. RTX calls this whenever a blocked
+ * thread is made ready, including from interrupt handlers; the timestamp of
+ * the earliest un-dispatched wakeup is held until the next context switch. */
+void EvrRtxThreadUnblocked(osThreadId_t thread_id, uint32_t ret_val)
+{
+    (void)thread_id;
+    (void)ret_val;
+    if (!sched_pend_active) {
+        sched_pend_cycles = dwt_cyccnt();
+        sched_pend_active = 1;
+    }
+}
+
+static void sched_switch_sample(uint32_t now)
+{
+    if (sched_pend_active) {
+        uint32_t latency = now - sched_pend_cycles;
+        sched_pend_active = 0;
+        sched_sample_cnt++;
+        sched_total_cycles += latency;
+        if (latency > sched_max_cycles) {
+            sched_max_cycles = latency;
+        }
+    }
+}
+
+// Called by mbed_stats_scheduler_get()
+void mbed_rtx_scheduler_stats_fetch(mbed_stats_scheduler_t *stats)
+{
+    core_util_critical_section_enter();
+    stats->sample_cnt = sched_sample_cnt;
+    stats->total_cycles = sched_total_cycles;
+    stats->max_cycles = sched_max_cycles;
+    core_util_critical_section_exit();
+}
+
+#endif // MBED_SCHEDULER_STATS_ENABLED
+
+#if defined(MBED_THREAD_CPU_STATS_ENABLED)
+
+/* Number of threads the CPU accounting table can track at once; slots are
+ * recycled when a thread terminates. */
+#ifndef MBED_CONF_RTOS_THREAD_CPU_STATS_MAX_THREADS
+#define MBED_CONF_RTOS_THREAD_CPU_STATS_MAX_THREADS 16
+#endif
+
+typedef struct {
+    osThreadId_t id;
+    uint64_t cycles;
+    uint32_t switch_cnt;
+    uint32_t max_slice_cycles;
+} thread_cpu_record_t;
+
+static thread_cpu_record_t thread_cpu_records[MBED_CONF_RTOS_THREAD_CPU_STATS_MAX_THREADS];
+static osThreadId_t thread_cpu_current;
+static uint32_t thread_cpu_slice_start;
+
+static thread_cpu_record_t *thread_cpu_record_for(osThreadId_t id)
+{
+    thread_cpu_record_t *unused = NULL;
+    for (unsigned i = 0; i < MBED_CONF_RTOS_THREAD_CPU_STATS_MAX_THREADS; i++) {
+        if (thread_cpu_records[i].id == id) {
+            return &thread_cpu_records[i];
+        }
+        if ((unused == NULL) && (thread_cpu_records[i].id == NULL)) {
+            unused = &thread_cpu_records[i];
+        }
+    }
+    if (unused != NULL) {
+        unused->id = id;
+    }
+    return unused;
+}
+
+static void thread_cpu_release(osThreadId_t id)
+{
+    core_util_critical_section_enter();
+    for (unsigned i = 0; i < MBED_CONF_RTOS_THREAD_CPU_STATS_MAX_THREADS; i++) {
+        if (thread_cpu_records[i].id == id) {
+            memset(&thread_cpu_records[i], 0, sizeof(thread_cpu_records[i]));
+            break;
+        }
+    }
+    core_util_critical_section_exit();
+}
+
+static void thread_cpu_switch_sample(osThreadId_t thread_id, uint32_t now)
+{
+    if (thread_cpu_current != NULL) {
+        thread_cpu_record_t *rec = thread_cpu_record_for(thread_cpu_current);
+        if (rec != NULL) {
+            uint32_t slice = now - thread_cpu_slice_start;
+            rec->cycles += slice;
+            if (slice > rec->max_slice_cycles) {
+                rec->max_slice_cycles = slice;
+            }
+        }
+    }
+
+    thread_cpu_current = thread_id;
+    thread_cpu_slice_start = now;
+    thread_cpu_record_t *rec = thread_cpu_record_for(thread_id);
+    if (rec != NULL) {
+        rec->switch_cnt++;
+    }
+}
+
+// Called by mbed_stats_thread_cpu_get_each()
+size_t mbed_rtx_thread_cpu_stats_fetch(mbed_stats_thread_cpu_t *stats, size_t count)
+{
+    size_t n = 0;
+
+    core_util_critical_section_enter();
+    for (unsigned i = 0; (i < MBED_CONF_RTOS_THREAD_CPU_STATS_MAX_THREADS) && (n < count); i++) {
+        if (thread_cpu_records[i].id != NULL) {
+            stats[n].id = (uint32_t)thread_cpu_records[i].id;
+            stats[n].cycles = thread_cpu_records[i].cycles;
+            stats[n].switch_cnt = thread_cpu_records[i].switch_cnt;
+            stats[n].max_slice_cycles = thread_cpu_records[i].max_slice_cycles;
+            n++;
+        }
+    }
+    core_util_critical_section_exit();
+
+    return n;
+}
+
+#endif // MBED_THREAD_CPU_STATS_ENABLED
+
+// Overrides the __WEAK hook in rtx_evr.c. RTX calls this on every context
+// switch from handler mode, so updates here are naturally serialized; the
+// cost is one cycle-counter read plus a table update.
+void EvrRtxThreadSwitched(osThreadId_t thread_id)
+{
+    uint32_t now = dwt_cyccnt();
+#if defined(MBED_SCHEDULER_STATS_ENABLED)
+    sched_switch_sample(now);
+#endif
+#if defined(MBED_THREAD_CPU_STATS_ENABLED)
+    thread_cpu_switch_sample(thread_id, now);
+#else
+    (void)thread_id;
+#endif
+}
+
+#else // No DWT cycle counter on this core
+
+#if defined(MBED_THREAD_CPU_STATS_ENABLED)
+
+static void thread_cpu_release(osThreadId_t id)
+{
+    (void)id;
+}
+
+size_t mbed_rtx_thread_cpu_stats_fetch(mbed_stats_thread_cpu_t *stats, size_t count)
+{
+    (void)stats;
+    (void)count;
+    return 0;
+}
+
+#endif // MBED_THREAD_CPU_STATS_ENABLED
+
+#if defined(MBED_SCHEDULER_STATS_ENABLED)
+
+void mbed_rtx_scheduler_stats_fetch(mbed_stats_scheduler_t *stats)
+{
+    (void)stats;
+}
+
+#endif // MBED_SCHEDULER_STATS_ENABLED
+
+#endif // defined(DWT) && defined(DWT_CTRL_CYCCNTENA_Msk)
+
+#endif // MBED_THREAD_CPU_STATS_ENABLED || MBED_SCHEDULER_STATS_ENABLED
+
 // RTX hook which gets called when a thread terminates, using the event function to call hook
 void EvrRtxThreadExit(void)
 {
@@ -723,6 +723,12 @@ public:
      * @return BLE_ERROR_NONE on success.
      *
      * @see ble::AdvertisingDataBuilder to build a payload.
+     *
+     * @note Applications rotating the payload content at a high rate should
+     * keep a single static buffer bound to an AdvertisingDataBuilder, patch it
+     * with AdvertisingDataBuilder::updateData() and pass the same span here;
+     * this avoids rebuilding the payload and copying it between buffers on
+     * every rotation.
      */
     ble_error_t setAdvertisingPayload(
         advertising_handle_t handle,
@@ -1076,6 +1082,37 @@ public:
         conn_event_length_t maxConnectionEventLength = conn_event_length_t(0)
     );
 
+    /**
+     * Request a radio usage profile for an existing connection.
+     *
+     * This is a convenience wrapper that tunes every knob affecting link
+     * throughput and latency in one call: connection interval, slave latency,
+     * connection event length, PHY selection and data length extension.
+     * connection_throughput_profile_t::MAX_THROUGHPUT requests a moderate
+     * connection interval with connection events allowed to fill it, the 2M
+     * PHY and maximum data length; LOW_LATENCY requests the shortest
+     * practical interval; LOW_POWER requests a long interval with slave
+     * latency.
+     *
+     * Each underlying procedure completes asynchronously and is reported
+     * through the usual events; PHY and data length requests are best effort
+     * and silently skipped on controllers that do not support them.
+     *
+     * @param connectionHandle The handle of the connection to tune.
+     * @param profile The requested profile.
+     *
+     * @return BLE_ERROR_NONE if the connection parameter update has been
+     * requested and an appropriate error code otherwise.
+     *
+     * @see EventHandler::onConnectionParametersUpdateComplete
+     * @see EventHandler::onPhyUpdateComplete
+     * @see EventHandler::onDataLengthChange
+     */
+    ble_error_t requestThroughputProfile(
+        connection_handle_t connectionHandle,
+        connection_throughput_profile_t profile
+    );
+
     /**
      * Allows the application to accept or reject a connection parameters update
      * request.
@@ -202,6 +202,23 @@ public:
             (void)params;
         }
 
+        /**
+         * Function invoked when queueUpdate() cannot accept another
+         * characteristic value update because the update queue is full.
+         *
+         * The rejected update is identified by the parameters; the producer
+         * should flush the queue or slow down instead of retrying
+         * immediately.
+         *
+         * @param params The connection and attribute handle of the rejected
+         * update.
+         *
+         * @see queueUpdate(), flushUpdates()
+         */
+        virtual void onUpdateQueueFull(const GattUpdateQueueFullCallbackParams &params) {
+            (void)params;
+        }
+
     protected:
         /**
          * Prevent polymorphic deletion and avoid unnecessary virtual destructor
@@ -448,6 +465,69 @@ public:
         bool localOnly = false
     );
 
+    /**
+     * Queue a characteristic value update for all subscribed clients.
+     *
+     * The value is copied into an internal buffer; unlike write(), nothing is
+     * transmitted until flushUpdates() is called. Queueing several updates and
+     * flushing them once lets the stack pack the resulting notifications
+     * back to back into the same connection event, which is considerably
+     * cheaper than one write() call per sample for high-rate characteristics.
+     *
+     * @param[in] attributeHandle Handle for the value attribute of the
+     * characteristic.
+     * @param[in] value A pointer to a buffer holding the new value.
+     * @param[in] size Size of the new value (in bytes).
+     *
+     * @return BLE_ERROR_NONE if the update has been queued and BLE_ERROR_NO_MEM
+     * if the queue or its value buffer is full; in the latter case
+     * EventHandler::onUpdateQueueFull is invoked so the producer can apply
+     * backpressure.
+     *
+     * @note Queued updates are sent as notifications; a characteristic that
+     * only supports indications must be updated with write() instead.
+     */
+    ble_error_t queueUpdate(
+        GattAttribute::Handle_t attributeHandle,
+        const uint8_t *value,
+        uint16_t size
+    );
+
+    /**
+     * Queue a characteristic value update for a single client.
+     *
+     * @param[in] connectionHandle Connection handle.
+     * @param[in] attributeHandle Handle for the value attribute of the
+     * characteristic.
+     * @param[in] value A pointer to a buffer holding the new value.
+     * @param[in] size Size of the new value (in bytes).
+     *
+     * @return BLE_ERROR_NONE if the update has been queued and BLE_ERROR_NO_MEM
+     * if the queue or its value buffer is full.
+     *
+     * @see queueUpdate()
+     */
+    ble_error_t queueUpdate(
+        ble::connection_handle_t connectionHandle,
+        GattAttribute::Handle_t attributeHandle,
+        const uint8_t *value,
+        uint16_t size
+    );
+
+    /**
+     * Send all queued characteristic value updates.
+     *
+     * Updates are written to the attribute table in queueing order and sent
+     * as back-to-back notifications to the clients that have subscribed to
+     * them, respecting the ATT_MTU negotiated on each connection. The queue
+     * is empty when this function returns.
+     *
+     * @return BLE_ERROR_NONE if the queued updates have been processed.
+     *
+     * @see EventHandler::onDataSent()
+     */
+    ble_error_t flushUpdates();
+
     /**
      * Determine if one of the connected clients has subscribed to notifications
      * or indications of the characteristic in input.
@@ -0,0 +1,125 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2020 ARM Limited
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IMPL_CORDIO_BUFFER_POOL_MONITOR_H_
+#define IMPL_CORDIO_BUFFER_POOL_MONITOR_H_
+
+#include <cstdint>
+
+#include "platform/Callback.h"
+#include "ble/common/blecommon.h"
+
+// FIXME: make this invisible!
+#include "wsf_buf.h"
+
+namespace ble {
+
+/**
+ * Telemetry surface for the WSF buffer pools used by the Cordio stack.
+ *
+ * The pools are sized once by CordioHCIDriver::get_buffer_pool_description()
+ * and exhaustion afterwards is silent: allocations inside the stack simply
+ * fail and PDUs are dropped. This class exposes the per pool counters
+ * maintained by WSF - outstanding allocations, high-water mark, allocation
+ * failures - and lets the application register a low-watermark callback
+ * invoked from the stack event loop when the number of free buffers of any
+ * pool drops to a configurable threshold, so load can be shed before
+ * allocations start failing.
+ *
+ * Accounting inside WSF is only compiled when WSF_BUF_STATS is TRUE; without
+ * it the accessors return BLE_ERROR_NOT_IMPLEMENTED and no callback is ever
+ * invoked.
+ */
+class CordioBufferPoolMonitor {
+public:
+    /** Counters of a single buffer pool. */
+    struct PoolStats_t {
+        uint16_t buffer_size;           /**< Size of the buffers in the pool. */
+        uint8_t buffer_count;           /**< Total number of buffers. */
+        uint8_t allocated;              /**< Buffers currently allocated. */
+        uint8_t max_allocated;          /**< Allocation high-water mark. */
+        uint16_t max_requested_length;  /**< Largest length requested from the pool. */
+        uint32_t allocation_failures;   /**< Allocations the pool could not serve. */
+    };
+
+    /**
+     * Callback invoked when a pool crosses the low watermark. It receives the
+     * index of the pool and its counters at the time of the crossing.
+     */
+    using LowWatermarkCallback_t = mbed::Callback<void(uint8_t, const PoolStats_t &)>;
+
+    /**
+     * Return the number of pools handed to the stack, or 0 if the stack is
+     * not initialized or WSF_BUF_STATS is disabled.
+     */
+    static uint8_t get_pool_count();
+
+    /**
+     * Read the counters of one pool.
+     *
+     * Pools are indexed in the order of the descriptors returned by
+     * CordioHCIDriver::get_buffer_pool_description(), smallest buffers first.
+     *
+     * @param pool_index Index of the pool, below get_pool_count().
+     * @param stats Filled with the counters of the pool.
+     *
+     * @retval BLE_ERROR_NONE if the counters have been read.
+     * @retval BLE_ERROR_INVALID_PARAM if the index designates no pool.
+     * @retval BLE_ERROR_NOT_IMPLEMENTED if WSF_BUF_STATS is disabled.
+     */
+    static ble_error_t get_pool_stats(uint8_t pool_index, PoolStats_t &stats);
+
+    /**
+     * Return the total number of allocation failures across all pools since
+     * stack initialization.
+     */
+    static uint32_t get_allocation_failure_count();
+
+    /**
+     * Register the low-watermark callback.
+     *
+     * The callback fires once per pool when its free buffer count drops to
+     * min_free_buffers or below, and re-arms once the pool recovers above the
+     * threshold. It runs in the context processing BLE events; keep it short
+     * and do not call back into BLE from it.
+     *
+     * Pass an empty callback to stop monitoring.
+     *
+     * @param min_free_buffers Free buffer count at which the callback fires.
+     * @param callback Callback invoked on crossings.
+     */
+    static void set_low_watermark_callback(
+        uint8_t min_free_buffers,
+        const LowWatermarkCallback_t &callback
+    );
+
+    /** Count allocation failures reported by WSF; registered by the stack at
+     *  initialization, not meant to be called by the application. */
+    static void on_diagnostic(WsfBufDiag_t *info);
+
+    /** Evaluate the low watermark; called by the stack event dispatcher, not
+     *  meant to be called by the application. */
+    static void poll();
+
+private:
+    CordioBufferPoolMonitor() = delete;
+};
+
+} // namespace ble
+
+#endif /* IMPL_CORDIO_BUFFER_POOL_MONITOR_H_ */
@@ -330,6 +330,70 @@ public:
         adv_data_type_t advDataType
     );
 
+    /**
+     * Return a writable span over the value of the type of data requested.
+     *
+     * The span points straight into the builder's buffer, so the field value
+     * can be patched in place without rebuilding the payload. The new bytes
+     * become visible to the controller on the next call to
+     * Gap::setAdvertisingPayload() with the same buffer.
+     *
+     * @param[out] data Span used to return the requested data.
+     * @param[in] advDataType Data type to return.
+     *
+     * @return BLE_ERROR_NONE if data was found and BLE_ERROR_NOT_FOUND if not.
+     *
+     * @note Only the value may be modified; use updateData() or replaceData()
+     * to change the size of a field.
+     */
+    ble_error_t getData(
+        mbed::Span<uint8_t> &data,
+        adv_data_type_t advDataType
+    )
+    {
+        uint8_t *field = findField(advDataType);
+        if (field) {
+            data = mbed::Span<uint8_t>(field + 2, field[0] - 1);
+            return BLE_ERROR_NONE;
+        } else {
+            return BLE_ERROR_NOT_FOUND;
+        }
+    }
+
+    /**
+     * Update the value of an existing field in place.
+     *
+     * Unlike replaceData(), the new value must have the same size as the
+     * current one; in exchange no other field is moved, making this suitable
+     * for rotating the content of a field (service data, manufacturer data)
+     * at a high rate without rebuilding the payload.
+     *
+     * @param[in] advDataType The type of the field to update.
+     * @param[in] fieldData Span of data to copy over the current value.
+     *
+     * @retval BLE_ERROR_NONE on success.
+     * @retval BLE_ERROR_NOT_FOUND if data type not present.
+     * @retval BLE_ERROR_INVALID_PARAM if size of data differs from the size of
+     *                                 the present field value.
+     */
+    ble_error_t updateData(
+        adv_data_type_t advDataType,
+        mbed::Span<const uint8_t> fieldData
+    )
+    {
+        uint8_t *field = findField(advDataType);
+        if (!field) {
+            return BLE_ERROR_NOT_FOUND;
+        }
+        if (fieldData.size() != (field[0] - 1)) {
+            return BLE_ERROR_INVALID_PARAM;
+        }
+        if (fieldData.size()) {
+            memcpy(field + 2, fieldData.data(), fieldData.size());
+        }
+        return BLE_ERROR_NONE;
+    }
+
 private:
     /**
     * Search advertisement data for a specific field.
@@ -989,6 +989,44 @@ struct central_privacy_configuration_t {
     resolution_strategy_t resolution_strategy;
 };
 
+/**
+ * Radio usage profile requested for a connection.
+ *
+ * @see Gap::requestThroughputProfile().
+ */
+struct connection_throughput_profile_t : SafeEnum<connection_throughput_profile_t, uint8_t> {
+    /// enumeration of connection_throughput_profile_t values
+    enum type {
+        /**
+         * Trade latency and throughput for power: long connection interval
+         * with slave latency and minimal connection event length.
+         */
+        LOW_POWER,
+
+        /**
+         * Minimize the time between the application producing data and the
+         * data being on air: shortest practical connection interval with no
+         * slave latency.
+         */
+        LOW_LATENCY,
+
+        /**
+         * Use as much of the radio capacity as possible: moderate connection
+         * interval with connection events allowed to fill it, 2M PHY and
+         * maximum data length.
+         */
+        MAX_THROUGHPUT
+    };
+
+    /**
+     * Construct a new connection_throughput_profile_t value.
+     * @param value The value of the connection_throughput_profile_t created.
+     */
+    connection_throughput_profile_t(type value) : SafeEnum(value)
+    {
+    }
+};
+
 
 /**
  * @}
@@ -470,6 +470,7 @@ struct GattUpdatesChangedCallbackParams {
 using GattUpdatesEnabledCallbackParams       = GattUpdatesChangedCallbackParams;
 using GattUpdatesDisabledCallbackParams      = GattUpdatesChangedCallbackParams;
 using GattConfirmationReceivedCallbackParams = GattDataSentCallbackParams;
+using GattUpdateQueueFullCallbackParams      = GattDataSentCallbackParams;
 
 namespace ble {
 
@@ -311,6 +311,15 @@ ble_error_t Gap::updateConnectionParameters(
 }
 
 
+ble_error_t Gap::requestThroughputProfile(
+    connection_handle_t connectionHandle,
+    connection_throughput_profile_t profile
+)
+{
+    return impl->requestThroughputProfile(connectionHandle, profile);
+}
+
+
 ble_error_t Gap::manageConnectionParametersUpdateRequest(
     bool userManageConnectionUpdateRequest
 )
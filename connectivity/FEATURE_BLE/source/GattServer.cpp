@@ -75,6 +75,30 @@ ble_error_t GattServer::write(
     return impl->write(connectionHandle, attributeHandle, value, size, localOnly);
 }
 
+ble_error_t GattServer::queueUpdate(
+    GattAttribute::Handle_t attributeHandle,
+    const uint8_t *value,
+    uint16_t size
+)
+{
+    return impl->queueUpdate(attributeHandle, value, size);
+}
+
+ble_error_t GattServer::queueUpdate(
+    ble::connection_handle_t connectionHandle,
+    GattAttribute::Handle_t attributeHandle,
+    const uint8_t *value,
+    uint16_t size
+)
+{
+    return impl->queueUpdate(connectionHandle, attributeHandle, value, size);
+}
+
+ble_error_t GattServer::flushUpdates()
+{
+    return impl->flushUpdates();
+}
+
 ble_error_t GattServer::areUpdatesEnabled(
     const GattCharacteristic &characteristic,
     bool *enabledP
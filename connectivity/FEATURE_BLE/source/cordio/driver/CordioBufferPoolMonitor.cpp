@@ -0,0 +1,194 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2020 ARM Limited
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ble/driver/CordioBufferPoolMonitor.h"
+
+#include "wsf_types.h"
+#include "wsf_buf.h"
+
+#include "mbed-trace/mbed_trace.h"
+
+#define TRACE_GROUP "BLBP"
+
+namespace ble {
+
+#if WSF_BUF_STATS == TRUE
+
+namespace {
+
+/* Allocation failures per pool, attributed by requested length. */
+uint32_t pool_failures[WSF_BUF_STATS_MAX_POOL];
+uint32_t total_failures = 0;
+
+uint8_t watermark_threshold = 0;
+/* One bit per pool, set while the pool sits at or below the watermark so the
+ * callback only fires on the downward crossing. */
+uint32_t below_watermark = 0;
+CordioBufferPoolMonitor::LowWatermarkCallback_t watermark_callback;
+
+void copy_stats(
+    const WsfBufPoolStat_t &wsf_stats,
+    uint32_t failures,
+    CordioBufferPoolMonitor::PoolStats_t &stats
+)
+{
+    stats.buffer_size = wsf_stats.bufSize;
+    stats.buffer_count = wsf_stats.numBuf;
+    stats.allocated = wsf_stats.numAlloc;
+    stats.max_allocated = wsf_stats.maxAlloc;
+    stats.max_requested_length = wsf_stats.maxReqLen;
+    stats.allocation_failures = failures;
+}
+
+} // namespace
+
+uint8_t CordioBufferPoolMonitor::get_pool_count()
+{
+    return WsfBufGetNumPool();
+}
+
+ble_error_t CordioBufferPoolMonitor::get_pool_stats(uint8_t pool_index, PoolStats_t &stats)
+{
+    uint8_t pool_count = WsfBufGetNumPool();
+    if (pool_index >= pool_count) {
+        return BLE_ERROR_INVALID_PARAM;
+    }
+
+    WsfBufPoolStat_t wsf_stats[WSF_BUF_STATS_MAX_POOL];
+    WsfBufGetPoolStats(wsf_stats, pool_count);
+
+    copy_stats(wsf_stats[pool_index], pool_failures[pool_index], stats);
+
+    return BLE_ERROR_NONE;
+}
+
+uint32_t CordioBufferPoolMonitor::get_allocation_failure_count()
+{
+    return total_failures;
+}
+
+void CordioBufferPoolMonitor::set_low_watermark_callback(
+    uint8_t min_free_buffers,
+    const LowWatermarkCallback_t &callback
+)
+{
+    watermark_threshold = min_free_buffers;
+    watermark_callback = callback;
+    below_watermark = 0;
+}
+
+void CordioBufferPoolMonitor::on_diagnostic(WsfBufDiag_t *info)
+{
+    if (info == nullptr || info->type != WSF_BUF_ALLOC_FAILED) {
+        return;
+    }
+
+    total_failures++;
+
+    uint16_t len = info->param.alloc.len;
+    tr_warning("Buffer allocation of %d bytes failed", len);
+
+    /* Attribute the failure to the pool the allocation was aimed at: the
+     * smallest pool able to serve the requested length, or the largest pool
+     * if the request exceeds every buffer size. */
+    uint8_t pool_count = WsfBufGetNumPool();
+    if (pool_count == 0) {
+        return;
+    }
+
+    WsfBufPoolStat_t wsf_stats[WSF_BUF_STATS_MAX_POOL];
+    WsfBufGetPoolStats(wsf_stats, pool_count);
+
+    uint8_t pool_index = pool_count - 1;
+    for (uint8_t i = 0; i < pool_count; ++i) {
+        if (len <= wsf_stats[i].bufSize) {
+            pool_index = i;
+            break;
+        }
+    }
+
+    pool_failures[pool_index]++;
+}
+
+void CordioBufferPoolMonitor::poll()
+{
+    if (!watermark_callback) {
+        return;
+    }
+
+    uint8_t pool_count = WsfBufGetNumPool();
+    if (pool_count == 0) {
+        return;
+    }
+
+    WsfBufPoolStat_t wsf_stats[WSF_BUF_STATS_MAX_POOL];
+    WsfBufGetPoolStats(wsf_stats, pool_count);
+
+    for (uint8_t i = 0; i < pool_count; ++i) {
+        uint8_t free_buffers = wsf_stats[i].numBuf - wsf_stats[i].numAlloc;
+        uint32_t pool_bit = (uint32_t) 1 << i;
+
+        if (free_buffers <= watermark_threshold) {
+            if ((below_watermark & pool_bit) == 0) {
+                below_watermark |= pool_bit;
+                tr_warning(
+                    "Pool %d (%d byte buffers) down to %d free buffers",
+                    i, wsf_stats[i].bufSize, free_buffers
+                );
+                PoolStats_t stats;
+                copy_stats(wsf_stats[i], pool_failures[i], stats);
+                watermark_callback(i, stats);
+            }
+        } else {
+            below_watermark &= ~pool_bit;
+        }
+    }
+}
+
+#else // WSF_BUF_STATS == TRUE
+
+uint8_t CordioBufferPoolMonitor::get_pool_count()
+{
+    return 0;
+}
+
+ble_error_t CordioBufferPoolMonitor::get_pool_stats(uint8_t, PoolStats_t &)
+{
+    return BLE_ERROR_NOT_IMPLEMENTED;
+}
+
+uint32_t CordioBufferPoolMonitor::get_allocation_failure_count()
+{
+    return 0;
+}
+
+void CordioBufferPoolMonitor::set_low_watermark_callback(uint8_t, const LowWatermarkCallback_t &)
+{
+}
+
+void CordioBufferPoolMonitor::on_diagnostic(WsfBufDiag_t *)
+{
+}
+
+void CordioBufferPoolMonitor::poll()
+{
+}
+
+#endif // WSF_BUF_STATS == TRUE
+
+} // namespace ble
@@ -22,6 +22,7 @@
 
 #include "ble/BLE.h"
 #include "ble/driver/CordioHCIDriver.h"
+#include "ble/driver/CordioBufferPoolMonitor.h"
 
 #include "source/pal/PalAttClient.h"
 #include "source/pal/PalSecurityManager.h"
@@ -518,6 +519,10 @@ void BLEInstanceBase::stack_setup()
     // Raise assert if not enough memory was allocated
     MBED_ASSERT(bytes_used != 0);
 
+#if WSF_BUF_STATS == TRUE
+    WsfBufDiagRegister(CordioBufferPoolMonitor::on_diagnostic);
+#endif
+
     SystemHeapStart += bytes_used;
     SystemHeapSize -= bytes_used;
 
@@ -745,6 +750,8 @@ void BLEInstanceBase::callDispatcher()
 
     wsfOsDispatcher();
 
+    CordioBufferPoolMonitor::poll();
+
     static Timeout nextTimeout;
     mbed::CriticalSectionLock critical_section;
 
@@ -911,6 +911,109 @@ ble_error_t GattServer::write(
     return BLE_ERROR_NONE;
 }
 
+ble_error_t GattServer::queueUpdate(
+    GattAttribute::Handle_t att_handle,
+    const uint8_t *buffer,
+    uint16_t len
+)
+{
+    return queue_update(DM_CONN_ID_NONE, att_handle, buffer, len);
+}
+
+ble_error_t GattServer::queueUpdate(
+    connection_handle_t connection,
+    GattAttribute::Handle_t att_handle,
+    const uint8_t *buffer,
+    uint16_t len
+)
+{
+    if (connection == DM_CONN_ID_NONE) {
+        tr_error("Unknown connection ID");
+        return BLE_ERROR_INVALID_PARAM;
+    }
+
+    return queue_update(connection, att_handle, buffer, len);
+}
+
+ble_error_t GattServer::queue_update(
+    connection_handle_t connection,
+    GattAttribute::Handle_t att_handle,
+    const uint8_t *buffer,
+    uint16_t len
+)
+{
+    tr_debug("Queue update of attribute %d - value=%s",
+            att_handle,
+            mbed_trace_array(buffer, len));
+
+    if (update_queue_count >= MBED_CONF_BLE_API_IMPLEMENTATION_UPDATE_QUEUE_SIZE
+        || len > MBED_CONF_BLE_API_IMPLEMENTATION_UPDATE_QUEUE_BUFFER_SIZE - update_queue_buffer_used) {
+        tr_warning("Update queue full - rejected update of attribute %d", att_handle);
+        if (eventHandler) {
+            GattUpdateQueueFullCallbackParams params = { connection, att_handle };
+            eventHandler->onUpdateQueueFull(params);
+        }
+        return BLE_ERROR_NO_MEM;
+    }
+
+    update_queue_entry_t &entry = update_queue[update_queue_count++];
+    entry.connection = connection;
+    entry.handle = att_handle;
+    entry.offset = update_queue_buffer_used;
+    entry.length = len;
+    memcpy(update_queue_buffer + entry.offset, buffer, len);
+    update_queue_buffer_used += len;
+
+    return BLE_ERROR_NONE;
+}
+
+ble_error_t GattServer::flushUpdates()
+{
+    tr_info("Flush %d queued attribute updates", update_queue_count);
+
+    for (uint8_t i = 0; i < update_queue_count; ++i) {
+        const update_queue_entry_t &entry = update_queue[i];
+        uint8_t *value = update_queue_buffer + entry.offset;
+
+        // bring the attribute table up to date before notifying
+        if (AttsSetAttr(entry.handle, entry.length, value) != ATT_SUCCESS) {
+            tr_error("Invalid attribute length");
+            continue;
+        }
+
+        uint8_t cccd_index;
+        if (!get_cccd_index_by_value_handle(entry.handle, cccd_index)) {
+            continue;
+        }
+
+#if BLE_FEATURE_SECURITY
+        for (dmConnId_t conn_id = DM_CONN_MAX; conn_id > DM_CONN_ID_NONE; --conn_id) {
+            if ((entry.connection != DM_CONN_ID_NONE) && (entry.connection != conn_id)) {
+                continue;
+            }
+            if (DmConnInUse(conn_id) != true) {
+                continue;
+            }
+            if (!is_update_authorized(conn_id, entry.handle)) {
+                continue;
+            }
+            if (AttsCccEnabled(conn_id, cccd_index) & ATT_CLIENT_CFG_NOTIFY) {
+                // the notification payload is capped by the MTU negotiated
+                // on this connection
+                uint16_t mtu_payload = AttGetMtu(conn_id) - ATT_VALUE_NTF_LEN;
+                uint16_t ntf_len = std::min(entry.length, mtu_payload);
+                AttsHandleValueNtf(conn_id, entry.handle, ntf_len, value);
+            }
+        }
+#endif // BLE_FEATURE_SECURITY
+    }
+
+    update_queue_count = 0;
+    update_queue_buffer_used = 0;
+
+    return BLE_ERROR_NONE;
+}
+
 ble_error_t GattServer::areUpdatesEnabled(
     const GattCharacteristic &characteristic,
     bool *enabled
@@ -1085,6 +1188,9 @@ ble_error_t GattServer::reset(ble::GattServer* server)
     currentHandle = 0;
     cccd_cnt = 0;
 
+    update_queue_count = 0;
+    update_queue_buffer_used = 0;
+
     _auth_callbacks_count = 0;
     _auth_callbacks = nullptr;
 
@@ -1634,6 +1740,10 @@ GattServer::GattServer() :
     cccd_values(),
     cccd_handles(),
     cccd_cnt(0),
+    update_queue(),
+    update_queue_buffer(),
+    update_queue_count(0),
+    update_queue_buffer_used(0),
     _auth_callbacks(nullptr),
     _auth_callbacks_count(0),
     generic_access_service(),
@@ -102,6 +102,21 @@ public:
         bool localOnly = false
     );
 
+    ble_error_t queueUpdate(
+        GattAttribute::Handle_t attributeHandle,
+        const uint8_t *value,
+        uint16_t size
+    );
+
+    ble_error_t queueUpdate(
+        ble::connection_handle_t connectionHandle,
+        GattAttribute::Handle_t attributeHandle,
+        const uint8_t *value,
+        uint16_t size
+    );
+
+    ble_error_t flushUpdates();
+
     ble_error_t areUpdatesEnabled(
         const GattCharacteristic &characteristic,
         bool *enabledP
@@ -297,6 +312,24 @@ private:
 
     bool is_update_authorized(connection_handle_t connection, GattAttribute::Handle_t value_handle);
 
+    ble_error_t queue_update(
+        connection_handle_t connection,
+        GattAttribute::Handle_t value_handle,
+        const uint8_t *value,
+        uint16_t size
+    );
+
+    struct update_queue_entry_t {
+        /** Target connection, or DM_CONN_ID_NONE for all subscribed clients. */
+        connection_handle_t connection;
+        /** Value handle of the characteristic being updated. */
+        GattAttribute::Handle_t handle;
+        /** Offset of the value in update_queue_buffer. */
+        uint16_t offset;
+        /** Length of the value in bytes. */
+        uint16_t length;
+    };
+
     struct alloc_block_t {
         alloc_block_t *next;
         uint8_t data[1];
@@ -369,6 +402,11 @@ private:
     uint16_t cccd_handles[MBED_CONF_BLE_API_IMPLEMENTATION_MAX_CCCD_COUNT];
     uint8_t cccd_cnt;
 
+    update_queue_entry_t update_queue[MBED_CONF_BLE_API_IMPLEMENTATION_UPDATE_QUEUE_SIZE];
+    uint8_t update_queue_buffer[MBED_CONF_BLE_API_IMPLEMENTATION_UPDATE_QUEUE_BUFFER_SIZE];
+    uint8_t update_queue_count;
+    uint16_t update_queue_buffer_used;
+
     char_auth_callback *_auth_callbacks;
     uint8_t _auth_callbacks_count;
 
@@ -0,0 +1,237 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2020 ARM Limited
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+
+#include "source/L2capCocBulkTransfer.h"
+
+#include "mbed-trace/mbed_trace.h"
+#include "common/ble_trace_helpers.h"
+
+#define TRACE_GROUP "BLCO"
+
+namespace ble {
+namespace impl {
+
+L2capCocBulkTransfer::L2capCocBulkTransfer() :
+    _cid(L2C_COC_CID_NONE),
+    _peer_mtu(0),
+    _segments(nullptr),
+    _segment_count(0),
+    _single_segment(),
+    _segment_index(0),
+    _segment_offset(0),
+    _confirmed(0),
+    _total_size(0),
+    _in_flight_length(),
+    _in_flight_head(0),
+    _in_flight_count(0),
+    _window_confirmed(0),
+    _window_complete()
+{
+}
+
+void L2capCocBulkTransfer::configure_registration(l2cCocReg_t &reg)
+{
+    reg.credits = MBED_CONF_CORDIO_L2CAP_COC_TX_WINDOW;
+}
+
+void L2capCocBulkTransfer::bind(uint16_t cid, uint16_t peer_mtu)
+{
+    _cid = cid;
+    _peer_mtu = peer_mtu;
+}
+
+ble_error_t L2capCocBulkTransfer::start(
+    const mbed::Span<const uint8_t> *segments,
+    size_t segment_count,
+    const WindowCallback_t &window_complete
+)
+{
+    if (_cid == L2C_COC_CID_NONE || _peer_mtu == 0 || busy()) {
+        tr_error("Bulk transfer start rejected: channel not ready");
+        return BLE_ERROR_INVALID_STATE;
+    }
+
+    size_t total_size = 0;
+    for (size_t i = 0; i < segment_count; ++i) {
+        total_size += segments[i].size();
+    }
+
+    if (segments == nullptr || total_size == 0) {
+        tr_error("Bulk transfer start rejected: no data");
+        return BLE_ERROR_INVALID_PARAM;
+    }
+
+    tr_info("Channel %d: start bulk transfer of %d bytes in %d segments",
+            _cid, (int) total_size, (int) segment_count);
+
+    _segments = segments;
+    _segment_count = segment_count;
+    _segment_index = 0;
+    _segment_offset = 0;
+    _confirmed = 0;
+    _total_size = total_size;
+    _in_flight_head = 0;
+    _in_flight_count = 0;
+    _window_confirmed = 0;
+    _window_complete = window_complete;
+
+    pump();
+
+    return BLE_ERROR_NONE;
+}
+
+ble_error_t L2capCocBulkTransfer::start(
+    mbed::Span<const uint8_t> data,
+    const WindowCallback_t &window_complete
+)
+{
+    _single_segment = data;
+    return start(&_single_segment, 1, window_complete);
+}
+
+void L2capCocBulkTransfer::process(const l2cCocEvt_t *evt)
+{
+    switch (evt->hdr.event) {
+        case L2C_COC_DATA_CNF:
+            if (evt->dataCnf.cid != _cid || !busy()) {
+                return;
+            }
+
+            if (evt->hdr.status != L2C_COC_DATA_SUCCESS) {
+                tr_error("Channel %d: data confirm failed with status %d",
+                        _cid, evt->hdr.status);
+                fail(evt->hdr.status == L2C_COC_DATA_ERR_MEMORY ?
+                        BLE_ERROR_NO_MEM : BLE_ERROR_INTERNAL_STACK_FAILURE);
+                return;
+            }
+
+            // credit one SDU back, oldest first
+            _confirmed += _in_flight_length[_in_flight_head];
+            _in_flight_head = (_in_flight_head + 1) % MBED_CONF_CORDIO_L2CAP_COC_TX_WINDOW;
+            _in_flight_count--;
+            _window_confirmed++;
+
+            if (_confirmed == _total_size) {
+                tr_info("Channel %d: bulk transfer of %d bytes complete",
+                        _cid, (int) _confirmed);
+                complete_window();
+                return;
+            }
+
+            if (_window_confirmed == MBED_CONF_CORDIO_L2CAP_COC_TX_WINDOW) {
+                _window_confirmed = 0;
+                if (_window_complete) {
+                    _window_complete(BLE_ERROR_NONE, _confirmed);
+                }
+            }
+
+            pump();
+            break;
+
+        case L2C_COC_DISCONNECT_IND:
+            if (evt->disconnectInd.cid != _cid) {
+                return;
+            }
+
+            tr_warning("Channel %d: disconnected during bulk transfer", _cid);
+            if (busy()) {
+                fail(BLE_ERROR_INTERNAL_STACK_FAILURE);
+            }
+            _cid = L2C_COC_CID_NONE;
+            _peer_mtu = 0;
+            break;
+
+        default:
+            break;
+    }
+}
+
+void L2capCocBulkTransfer::reset()
+{
+    _segments = nullptr;
+    _segment_count = 0;
+    _segment_index = 0;
+    _segment_offset = 0;
+    _confirmed = 0;
+    _total_size = 0;
+    _in_flight_head = 0;
+    _in_flight_count = 0;
+    _window_confirmed = 0;
+    _window_complete = nullptr;
+    _cid = L2C_COC_CID_NONE;
+    _peer_mtu = 0;
+}
+
+void L2capCocBulkTransfer::pump()
+{
+    while (_in_flight_count < MBED_CONF_CORDIO_L2CAP_COC_TX_WINDOW
+            && _segment_index < _segment_count) {
+        const mbed::Span<const uint8_t> &segment = _segments[_segment_index];
+
+        size_t remaining = segment.size() - _segment_offset;
+        if (remaining == 0) {
+            _segment_index++;
+            _segment_offset = 0;
+            continue;
+        }
+
+        // an SDU never crosses a segment boundary so it can be handed to the
+        // stack without staging; a short tail just closes the SDU early
+        uint16_t len = (uint16_t) std::min<size_t>(remaining, _peer_mtu);
+
+        L2cCocDataReq(_cid, len, const_cast<uint8_t *>(segment.data() + _segment_offset));
+
+        uint8_t slot = (_in_flight_head + _in_flight_count) % MBED_CONF_CORDIO_L2CAP_COC_TX_WINDOW;
+        _in_flight_length[slot] = len;
+        _in_flight_count++;
+        _segment_offset += len;
+    }
+}
+
+void L2capCocBulkTransfer::fail(ble_error_t reason)
+{
+    WindowCallback_t callback = _window_complete;
+    size_t confirmed = _confirmed;
+
+    _segments = nullptr;
+    _segment_count = 0;
+    _window_complete = nullptr;
+
+    if (callback) {
+        callback(reason, confirmed);
+    }
+}
+
+void L2capCocBulkTransfer::complete_window()
+{
+    WindowCallback_t callback = _window_complete;
+    size_t confirmed = _confirmed;
+
+    _segments = nullptr;
+    _segment_count = 0;
+    _window_complete = nullptr;
+
+    if (callback) {
+        callback(BLE_ERROR_NONE, confirmed);
+    }
+}
+
+} // namespace impl
+} // namespace ble
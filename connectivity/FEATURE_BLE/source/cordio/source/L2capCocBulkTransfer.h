@@ -0,0 +1,180 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2020 ARM Limited
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IMPL_L2CAP_COC_BULK_TRANSFER_H_
+#define IMPL_L2CAP_COC_BULK_TRANSFER_H_
+
+#include "wsf_types.h"
+#include "l2c_api.h"
+
+#include "platform/Callback.h"
+#include "platform/Span.h"
+
+#include "ble/common/blecommon.h"
+
+/** Number of SDUs kept in flight on a connection oriented channel by the bulk
+ *  transfer engine. This is also the receive credit window pre-granted to the
+ *  peer by configure_registration(). Larger windows keep the radio busy across
+ *  connection events at the cost of more stack buffers in use.
+ */
+#ifndef MBED_CONF_CORDIO_L2CAP_COC_TX_WINDOW
+#define MBED_CONF_CORDIO_L2CAP_COC_TX_WINDOW 4
+#endif
+
+namespace ble {
+namespace impl {
+
+/**
+ * Bulk transfer engine for an L2CAP connection oriented channel.
+ *
+ * The engine drives a credit based channel at the pace the stack confirms
+ * SDUs instead of the application granting one credit per SDU: up to
+ * MBED_CONF_CORDIO_L2CAP_COC_TX_WINDOW SDUs are kept in flight and every
+ * L2C_COC_DATA_CNF immediately refills the pipeline. SDUs are submitted
+ * straight from the application's segments, so the only copy left is the one
+ * the stack makes into its transmit buffer.
+ *
+ * The class does not own the channel: the application registers the PSM with
+ * L2cCocRegister(), opens the channel and forwards the events received by its
+ * registration callback to process(). The segments passed to start() must
+ * remain valid until the transfer completes.
+ */
+class L2capCocBulkTransfer {
+public:
+    /**
+     * Completion callback invoked at the end of each credit window and when
+     * the transfer finishes or fails. It receives BLE_ERROR_NONE or the
+     * failure reason, and the total number of bytes confirmed by the stack so
+     * far.
+     */
+    using WindowCallback_t = mbed::Callback<void(ble_error_t, size_t)>;
+
+    L2capCocBulkTransfer();
+
+    /**
+     * Fill the receive side of a channel registration with the pre-granted
+     * credit window used by the engine, so the peer can also pipeline SDUs
+     * towards us.
+     *
+     * @param reg Registration structure passed to L2cCocRegister().
+     */
+    static void configure_registration(l2cCocReg_t &reg);
+
+    /**
+     * Bind the engine to an open channel.
+     *
+     * Call on L2C_COC_CONNECT_IND; the peer MTU bounds the SDU size.
+     *
+     * @param cid Local channel ID.
+     * @param peer_mtu Largest SDU the peer can receive.
+     */
+    void bind(uint16_t cid, uint16_t peer_mtu);
+
+    /**
+     * Start a bulk transfer gathering data from a list of segments.
+     *
+     * Each SDU is drawn from a single segment so no byte is ever staged in an
+     * intermediate buffer; a segment shorter than the peer MTU simply closes
+     * the SDU early.
+     *
+     * @param segments Segments to transmit, in order.
+     * @param segment_count Number of segments.
+     * @param window_complete Callback invoked per completed credit window and
+     * on completion or failure.
+     *
+     * @retval BLE_ERROR_NONE if the transfer has been started.
+     * @retval BLE_ERROR_INVALID_STATE if no channel is bound or a transfer is
+     *         already running.
+     * @retval BLE_ERROR_INVALID_PARAM if there is no data to send.
+     */
+    ble_error_t start(
+        const mbed::Span<const uint8_t> *segments,
+        size_t segment_count,
+        const WindowCallback_t &window_complete
+    );
+
+    /**
+     * Start a bulk transfer of a single contiguous buffer.
+     *
+     * The span is copied into internal storage so it does not need to outlive
+     * the call, but the bytes it designates do.
+     *
+     * @see start()
+     */
+    ble_error_t start(
+        mbed::Span<const uint8_t> data,
+        const WindowCallback_t &window_complete
+    );
+
+    /**
+     * Feed a channel event to the engine.
+     *
+     * The application's registration callback must forward every event here;
+     * events for other channels are ignored.
+     *
+     * @param evt Event received from the L2CAP layer.
+     */
+    void process(const l2cCocEvt_t *evt);
+
+    /** Tell whether a transfer is in progress. */
+    bool busy() const
+    {
+        return _segments != nullptr;
+    }
+
+    /** Abort any transfer in progress and unbind from the channel. */
+    void reset();
+
+private:
+    void pump();
+
+    void fail(ble_error_t reason);
+
+    void complete_window();
+
+    uint16_t _cid;
+    uint16_t _peer_mtu;
+
+    /** Gather list; single buffer transfers alias _single_segment. */
+    const mbed::Span<const uint8_t> *_segments;
+    size_t _segment_count;
+    mbed::Span<const uint8_t> _single_segment;
+
+    /** Submission cursor. */
+    size_t _segment_index;
+    size_t _segment_offset;
+
+    /** Bytes confirmed by the stack since start(). */
+    size_t _confirmed;
+    size_t _total_size;
+
+    /** Length of each SDU in flight, consumed in FIFO order by DATA_CNF. */
+    uint16_t _in_flight_length[MBED_CONF_CORDIO_L2CAP_COC_TX_WINDOW];
+    uint8_t _in_flight_head;
+    uint8_t _in_flight_count;
+
+    /** SDUs confirmed since the last window callback. */
+    uint8_t _window_confirmed;
+
+    WindowCallback_t _window_complete;
+};
+
+} // namespace impl
+} // namespace ble
+
+#endif /* IMPL_L2CAP_COC_BULK_TRANSFER_H_ */
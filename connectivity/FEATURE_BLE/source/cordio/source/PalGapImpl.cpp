@@ -550,6 +550,31 @@ ble_error_t PalGap::connection_parameters_update(
 }
 
 
+ble_error_t PalGap::set_data_length(
+    connection_handle_t connection,
+    uint16_t tx_octets,
+    uint16_t tx_time
+)
+{
+#if MBED_CONF_CORDIO_TRACE_PAL_ECHOES
+    tr_info("Connection %d: set data length - "
+            "tx_octets=%d, "
+            "tx_time=%d",
+            connection,
+            tx_octets,
+            tx_time);
+#endif
+
+    DmConnSetDataLen(
+        connection,
+        tx_octets,
+        tx_time
+    );
+
+    return BLE_ERROR_NONE;
+}
+
+
 ble_error_t PalGap::accept_connection_parameter_request(
     connection_handle_t connection_handle,
     uint16_t interval_min,
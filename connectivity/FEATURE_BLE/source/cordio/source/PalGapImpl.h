@@ -136,6 +136,12 @@ public:
         uint16_t maximum_connection_event_length
     ) final;
 
+    ble_error_t set_data_length(
+        connection_handle_t connection,
+        uint16_t tx_octets,
+        uint16_t tx_time
+    ) final;
+
     ble_error_t accept_connection_parameter_request(
         connection_handle_t connection_handle,
         uint16_t interval_min,
@@ -785,6 +785,83 @@ ble_error_t Gap::updateConnectionParameters(
     );
 }
 
+ble_error_t Gap::requestThroughputProfile(
+    connection_handle_t connectionHandle,
+    connection_throughput_profile_t profile
+)
+{
+    tr_info("Connection %d: request throughput profile %d",
+            connectionHandle,
+            profile.value());
+
+    conn_interval_t interval_min(6);
+    conn_interval_t interval_max(12);
+    slave_latency_t latency(0);
+    supervision_timeout_t timeout(400);
+    conn_event_length_t event_length_min(0);
+    conn_event_length_t event_length_max(0);
+
+    switch (profile.value()) {
+        case connection_throughput_profile_t::LOW_POWER:
+            // long interval and slave latency so the radio sleeps most of
+            // the time
+            interval_min = conn_interval_t(160); /* 200ms */
+            interval_max = conn_interval_t(320); /* 400ms */
+            latency = slave_latency_t(4);
+            timeout = supervision_timeout_t(600); /* 6s */
+            break;
+
+        case connection_throughput_profile_t::LOW_LATENCY:
+            // shortest practical interval, never skip a connection event
+            interval_min = conn_interval_t(6); /* 7.5ms */
+            interval_max = conn_interval_t(12); /* 15ms */
+            break;
+
+        case connection_throughput_profile_t::MAX_THROUGHPUT:
+            // a moderate interval amortizes event overhead; letting the
+            // event length grow to the interval keeps the radio transmitting
+            // back to back
+            interval_min = conn_interval_t(24); /* 30ms */
+            interval_max = conn_interval_t(40); /* 50ms */
+            timeout = supervision_timeout_t(500); /* 5s */
+            event_length_max = conn_event_length_t(80); /* 50ms */
+            break;
+
+        default:
+            return BLE_ERROR_INVALID_PARAM;
+    }
+
+#if BLE_FEATURE_PHY_MANAGEMENT
+    if (profile.value() != connection_throughput_profile_t::LOW_POWER) {
+        // best effort: the 2M PHY halves on-air time per octet; keep going
+        // if the controller does not support PHY update
+        phy_set_t phy_2m(/* 1M */ false, /* 2M */ true, /* coded */ false);
+        setPhy(
+            connectionHandle,
+            &phy_2m,
+            &phy_2m,
+            coded_symbol_per_bit_t::UNDEFINED
+        );
+    }
+#endif // BLE_FEATURE_PHY_MANAGEMENT
+
+    if (profile.value() == connection_throughput_profile_t::MAX_THROUGHPUT) {
+        // best effort data length extension to full sized link layer
+        // packets (251 octets / 2120us, see Vol 6 Part B 4.5.10)
+        _pal_gap.set_data_length(connectionHandle, 251, 2120);
+    }
+
+    return updateConnectionParameters(
+        connectionHandle,
+        interval_min,
+        interval_max,
+        latency,
+        timeout,
+        event_length_min,
+        event_length_max
+    );
+}
+
 ble_error_t Gap::acceptConnectionParametersUpdate(
     connection_handle_t connectionHandle,
     conn_interval_t minConnectionInterval,
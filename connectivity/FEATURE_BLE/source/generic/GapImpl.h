@@ -265,6 +265,11 @@ public:
         conn_event_length_t maxConnectionEventLength = conn_event_length_t(0)
     );
 
+    ble_error_t requestThroughputProfile(
+        connection_handle_t connectionHandle,
+        connection_throughput_profile_t profile
+    );
+
     ble_error_t manageConnectionParametersUpdateRequest(
         bool userManageConnectionUpdateRequest
     );
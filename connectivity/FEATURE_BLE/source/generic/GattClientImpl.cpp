@@ -30,6 +30,7 @@
 #include "ble/common/blecommon.h"
 
 #include "source/generic/GattClientImpl.h"
+#include "source/generic/KVStoreDiscoveryCache.h"
 #include "source/pal/AttServerMessage.h"
 #include "source/BLEInstanceBase.h"
 
@@ -57,6 +58,9 @@ using ble::AttFindInformationResponse;
 #define CMAC_LENGTH 8
 #define MAC_COUNTER_LENGTH 4
 
+/* GATT Database Hash characteristic (Bluetooth 5.1, Vol 3, Part G, 7.3) */
+#define DATABASE_HASH_UUID 0x2B2A
+
 namespace ble {
 namespace impl {
 
@@ -134,6 +138,10 @@ struct GattClient::DiscoveryControlBlock final : public ProcedureControlBlock {
         matching_characteristic_uuid(matching_characteristic_uuid),
         services_discovered(nullptr),
         done(false)
+#if MBED_CONF_BLE_API_IMPLEMENTATION_GATT_CLIENT_DISCOVERY_CACHE
+        , reading_database_hash(false)
+        , cache_record(nullptr)
+#endif
     {
     }
 
@@ -144,6 +152,9 @@ struct GattClient::DiscoveryControlBlock final : public ProcedureControlBlock {
             delete services_discovered;
             services_discovered = tmp;
         }
+#if MBED_CONF_BLE_API_IMPLEMENTATION_GATT_CLIENT_DISCOVERY_CACHE
+        delete cache_record;
+#endif
     }
 
     void handle_timeout_error(GattClient *client)  final
@@ -166,6 +177,13 @@ struct GattClient::DiscoveryControlBlock final : public ProcedureControlBlock {
             return;
         }
 
+#if MBED_CONF_BLE_API_IMPLEMENTATION_GATT_CLIENT_DISCOVERY_CACHE
+        if (reading_database_hash) {
+            handle_database_hash(client, message);
+            return;
+        }
+#endif
+
         switch (message.opcode) {
             case AttributeOpcode::READ_BY_GROUP_TYPE_RESPONSE:
                 handle_service_discovered(
@@ -218,7 +236,19 @@ struct GattClient::DiscoveryControlBlock final : public ProcedureControlBlock {
             return;
         }
 
-        uint16_t end_handle = 0x0000;
+        // Pipeline the walk: the continuation only depends on the end handle
+        // of the last service in the response, so the next request is sent
+        // before this response is processed and its radio round trip overlaps
+        // with the application callbacks.
+        uint16_t end_handle = get_end_handle(response[response.size() - 1]);
+        bool services_remaining = (end_handle != 0xFFFF);
+        ble_error_t err = BLE_ERROR_NONE;
+        if (services_remaining) {
+            err = client->_pal_client.discover_primary_service(
+                connection_handle, end_handle + 1
+            );
+        }
+
         for (size_t i = 0; i < response.size(); ++i) {
             uint16_t start_handle = get_start_handle(response[i]);
             end_handle = get_end_handle(response[i]);
@@ -244,16 +274,10 @@ struct GattClient::DiscoveryControlBlock final : public ProcedureControlBlock {
             }
         }
 
-        if (end_handle == 0xFFFF) {
+        if (err) {
+            terminate(client);
+        } else if (!services_remaining) {
             start_characteristic_discovery(client);
-        } else {
-            ble_error_t err = client->_pal_client.discover_primary_service(
-                connection_handle, end_handle + 1
-            );
-
-            if (err) {
-                terminate(client);
-            }
         }
     }
 
@@ -271,6 +295,10 @@ struct GattClient::DiscoveryControlBlock final : public ProcedureControlBlock {
             return;
         }
 
+#if MBED_CONF_BLE_API_IMPLEMENTATION_GATT_CLIENT_DISCOVERY_CACHE
+        record_service(*services_discovered);
+#endif
+
         if (service_callback) {
             DiscoveredService discovered_service;
             discovered_service.setup(
@@ -293,11 +321,39 @@ struct GattClient::DiscoveryControlBlock final : public ProcedureControlBlock {
 
     void handle_characteristic_discovered(GattClient *client, const AttReadByTypeResponse &response)
     {
+        if (!response.size()) {
+            tr_error("%s terminating due to malformed message", TRACE_CLASS);
+            terminate(client);
+            return;
+        }
+
+        // Pipeline the walk: the continuation range only depends on the value
+        // handle of the last characteristic in the response, so the next
+        // request is sent before this response is processed and its radio
+        // round trip overlaps with the application callbacks.
+        uint16_t last_value_handle = characteristic_t::get_value_handle(
+            response[response.size() - 1].value
+        );
+        bool characteristics_remaining = (last_value_handle != services_discovered->end);
+        ble_error_t err = BLE_ERROR_NONE;
+        if (characteristics_remaining) {
+            err = client->_pal_client.discover_characteristics_of_a_service(
+                connection_handle,
+                attribute_handle_range(
+                    last_value_handle + 1,
+                    services_discovered->end
+                )
+            );
+        }
+
         for (size_t i = 0; i < response.size(); ++i) {
             if (last_characteristic.is_valid() == false) {
                 last_characteristic.set_last_handle(response[i].handle - 1);
                 if (matching_characteristic_uuid == UUID()
                     || last_characteristic.getUUID() == matching_characteristic_uuid) {
+#if MBED_CONF_BLE_API_IMPLEMENTATION_GATT_CLIENT_DISCOVERY_CACHE
+                    record_characteristic(last_characteristic);
+#endif
                     characteristic_callback(&last_characteristic);
                 }
             }
@@ -309,21 +365,11 @@ struct GattClient::DiscoveryControlBlock final : public ProcedureControlBlock {
         }
 
         // check if all the characteristics of the service has been discovered
-        if (last_characteristic.getValueHandle() == services_discovered->end) {
+        if (err) {
+            tr_error("%s terminating early due to %s", TRACE_CLASS, ble_error_to_string(err));
+            terminate(client);
+        } else if (!characteristics_remaining) {
             handle_all_characteristics_discovered(client);
-        } else {
-            ble_error_t err = client->_pal_client.discover_characteristics_of_a_service(
-                connection_handle,
-                attribute_handle_range(
-                    last_characteristic.getValueHandle() + 1,
-                    services_discovered->end
-                )
-            );
-
-            if (err) {
-                tr_error("%s terminating early due to %s", TRACE_CLASS, ble_error_to_string(err));
-                terminate(client);
-            }
         }
     }
 
@@ -333,6 +379,9 @@ struct GattClient::DiscoveryControlBlock final : public ProcedureControlBlock {
             if (matching_characteristic_uuid == UUID()
                 || matching_characteristic_uuid == last_characteristic.getUUID()) {
                 last_characteristic.set_last_handle(services_discovered->end);
+#if MBED_CONF_BLE_API_IMPLEMENTATION_GATT_CLIENT_DISCOVERY_CACHE
+                record_characteristic(last_characteristic);
+#endif
                 characteristic_callback(&last_characteristic);
             }
         }
@@ -343,6 +392,13 @@ struct GattClient::DiscoveryControlBlock final : public ProcedureControlBlock {
 
         if (!services_discovered) {
             tr_debug("Service discovery complete");
+#if MBED_CONF_BLE_API_IMPLEMENTATION_GATT_CLIENT_DISCOVERY_CACHE
+            if (cache_record) {
+                KVStoreDiscoveryCache::store_entry(*cache_record);
+                delete cache_record;
+                cache_record = nullptr;
+            }
+#endif
             terminate(client);
         } else {
             start_characteristic_discovery(client);
@@ -426,6 +482,34 @@ struct GattClient::DiscoveryControlBlock final : public ProcedureControlBlock {
             connHandle = connection_handle;
         }
 
+#if MBED_CONF_BLE_API_IMPLEMENTATION_GATT_CLIENT_DISCOVERY_CACHE
+        characteristic_t(
+            connection_handle_t connection_handle,
+            const KVStoreDiscoveryCache::cached_characteristic_t &cached
+        ) : DiscoveredCharacteristic()
+        {
+            gattc = &ble::BLE::Instance().gattClient();
+            uuid = KVStoreDiscoveryCache::get_uuid(cached.uuid, cached.uuid_length);
+            props = get_properties(cached.properties);
+            declHandle = cached.declaration_handle;
+            valueHandle = cached.value_handle;
+            lastHandle = cached.last_handle;
+            connHandle = connection_handle;
+        }
+
+        uint8_t get_raw_properties() const
+        {
+            const DiscoveredCharacteristic::Properties_t &properties = getProperties();
+            return (properties._broadcast ? (1 << 0) : 0)
+                | (properties._read ? (1 << 1) : 0)
+                | (properties._writeWoResp ? (1 << 2) : 0)
+                | (properties._write ? (1 << 3) : 0)
+                | (properties._notify ? (1 << 4) : 0)
+                | (properties._indicate ? (1 << 5) : 0)
+                | (properties._authSignedWrite ? (1 << 6) : 0);
+        }
+#endif // MBED_CONF_BLE_API_IMPLEMENTATION_GATT_CLIENT_DISCOVERY_CACHE
+
         static UUID get_uuid(const Span<const uint8_t> &value)
         {
             if (value.size() == 5) {
@@ -435,9 +519,8 @@ struct GattClient::DiscoveryControlBlock final : public ProcedureControlBlock {
             }
         }
 
-        static DiscoveredCharacteristic::Properties_t get_properties(const Span<const uint8_t> &value)
+        static DiscoveredCharacteristic::Properties_t get_properties(uint8_t raw_properties)
         {
-            uint8_t raw_properties = value[0];
             DiscoveredCharacteristic::Properties_t result;
             result._broadcast = (raw_properties & (1 << 0)) ? true : false;
             result._read = (raw_properties & (1 << 1)) ? true : false;
@@ -449,6 +532,11 @@ struct GattClient::DiscoveryControlBlock final : public ProcedureControlBlock {
             return result;
         }
 
+        static DiscoveredCharacteristic::Properties_t get_properties(const Span<const uint8_t> &value)
+        {
+            return get_properties(value[0]);
+        }
+
         static uint16_t get_value_handle(const Span<const uint8_t> &value)
         {
             return value[1] | (value[2] << 8);
@@ -483,9 +571,145 @@ struct GattClient::DiscoveryControlBlock final : public ProcedureControlBlock {
     ServiceDiscovery::CharacteristicCallback_t characteristic_callback;
     UUID matching_service_uuid;
     UUID matching_characteristic_uuid;
+#if MBED_CONF_BLE_API_IMPLEMENTATION_GATT_CLIENT_DISCOVERY_CACHE
+    void handle_database_hash(GattClient *client, const AttServerMessage &message)
+    {
+        reading_database_hash = false;
+
+        if (message.opcode == AttributeOpcode::READ_BY_TYPE_RESPONSE) {
+            const auto &response = static_cast<const AttReadByTypeResponse &>(message);
+            if (response.size() == 1
+                && response[0].value.size() == KVStoreDiscoveryCache::DATABASE_HASH_SIZE) {
+                auto *entry = new(std::nothrow) KVStoreDiscoveryCache::entry_t;
+                if (entry != nullptr) {
+                    if (KVStoreDiscoveryCache::find_entry(response[0].value.data(), *entry)) {
+                        replay_cached_attributes(client, *entry);
+                        delete entry;
+                        terminate(client);
+                        return;
+                    }
+
+                    // record the walk so the next connection hits the cache
+                    memcpy(
+                        entry->database_hash,
+                        response[0].value.data(),
+                        KVStoreDiscoveryCache::DATABASE_HASH_SIZE
+                    );
+                    entry->service_count = 0;
+                    entry->characteristic_count = 0;
+                    cache_record = entry;
+                }
+            }
+        } else if (message.opcode != AttributeOpcode::ERROR_RESPONSE) {
+            terminate(client);
+            return;
+        }
+
+        // the server has no Database Hash characteristic or its database is
+        // not cached: fall back to the regular walk
+        ble_error_t err = client->_pal_client.discover_primary_service(
+            connection_handle, 0x0001
+        );
+
+        if (err) {
+            terminate(client);
+        }
+    }
+
+    void replay_cached_attributes(GattClient *client, const KVStoreDiscoveryCache::entry_t &entry)
+    {
+        tr_info("Replaying %d services from the discovery cache", entry.service_count);
+        for (uint8_t s = 0; s < entry.service_count; ++s) {
+            const KVStoreDiscoveryCache::cached_service_t &service = entry.services[s];
+
+            if (done) {
+                return;
+            }
+
+            if (service_callback) {
+                DiscoveredService discovered_service;
+                discovered_service.setup(
+                    KVStoreDiscoveryCache::get_uuid(service.uuid, service.uuid_length),
+                    service.begin,
+                    service.end
+                );
+                service_callback(&discovered_service);
+            }
+
+            for (uint8_t c = 0; c < entry.characteristic_count; ++c) {
+                const KVStoreDiscoveryCache::cached_characteristic_t &cached =
+                    entry.characteristics[c];
+                if (cached.declaration_handle < service.begin
+                    || cached.declaration_handle > service.end) {
+                    continue;
+                }
+
+                if (done) {
+                    return;
+                }
+
+                characteristic_t characteristic(connection_handle, cached);
+                characteristic_callback(&characteristic);
+            }
+        }
+    }
+
+    void record_service(const service_t &service)
+    {
+        if (cache_record == nullptr) {
+            return;
+        }
+
+        if (cache_record->service_count >= KVStoreDiscoveryCache::MAX_SERVICES) {
+            drop_cache_record();
+            return;
+        }
+
+        KVStoreDiscoveryCache::cached_service_t &cached =
+            cache_record->services[cache_record->service_count++];
+        cached.begin = service.begin;
+        cached.end = service.end;
+        KVStoreDiscoveryCache::set_uuid(cached.uuid, cached.uuid_length, service.uuid);
+    }
+
+    void record_characteristic(const characteristic_t &characteristic)
+    {
+        if (cache_record == nullptr) {
+            return;
+        }
+
+        if (cache_record->characteristic_count >= KVStoreDiscoveryCache::MAX_CHARACTERISTICS) {
+            drop_cache_record();
+            return;
+        }
+
+        KVStoreDiscoveryCache::cached_characteristic_t &cached =
+            cache_record->characteristics[cache_record->characteristic_count++];
+        cached.declaration_handle = characteristic.getDeclHandle();
+        cached.value_handle = characteristic.getValueHandle();
+        cached.last_handle = characteristic.getLastHandle();
+        cached.properties = characteristic.get_raw_properties();
+        KVStoreDiscoveryCache::set_uuid(cached.uuid, cached.uuid_length, characteristic.getUUID());
+    }
+
+    void drop_cache_record()
+    {
+        tr_debug("Server database too large for the discovery cache");
+        delete cache_record;
+        cache_record = nullptr;
+    }
+#endif // MBED_CONF_BLE_API_IMPLEMENTATION_GATT_CLIENT_DISCOVERY_CACHE
+
     service_t *services_discovered;
     characteristic_t last_characteristic;
     bool done;
+#if MBED_CONF_BLE_API_IMPLEMENTATION_GATT_CLIENT_DISCOVERY_CACHE
+    /* Set while the initial Database Hash read is in flight. */
+    bool reading_database_hash;
+    /* Attribute table being recorded during a full walk; null when the
+     * database cannot be cached. */
+    KVStoreDiscoveryCache::entry_t *cache_record;
+#endif
 };
 
 #define TRACE_CLASS "ReadControlBlock"
@@ -1116,6 +1340,28 @@ ble_error_t GattClient::launchServiceDiscovery(
 
     // launch the request
     ble_error_t err = BLE_ERROR_UNSPECIFIED;
+#if MBED_CONF_BLE_API_IMPLEMENTATION_GATT_CLIENT_DISCOVERY_CACHE
+    if (matching_service_uuid == UUID()
+        && matching_characteristic_uuid == UUID()
+        && characteristic_callback
+    ) {
+        // the walk starts by reading the Database Hash of the server; a match
+        // against a cached attribute table skips discovery entirely
+        discovery_pcb->reading_database_hash = true;
+        err = _pal_client.read_using_characteristic_uuid(
+            connection_handle,
+            attribute_handle_range(0x0001, 0xFFFF),
+            UUID(DATABASE_HASH_UUID)
+        );
+
+        if (err == BLE_ERROR_NONE) {
+            return BLE_ERROR_NONE;
+        }
+
+        // the server may still be reachable with a plain walk
+        discovery_pcb->reading_database_hash = false;
+    }
+#endif
     if (matching_service_uuid == UUID()) {
         err = _pal_client.discover_primary_service(
             connection_handle,
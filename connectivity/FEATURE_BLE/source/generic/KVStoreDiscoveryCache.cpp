@@ -0,0 +1,168 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2020 ARM Limited
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if MBED_CONF_BLE_API_IMPLEMENTATION_GATT_CLIENT_DISCOVERY_CACHE
+
+#include <new>
+
+#include "KVStoreDiscoveryCache.h"
+#include "common/ble_trace_helpers.h"
+
+#define TRACE_GROUP "BLDC"
+
+namespace ble {
+
+#if MBED_CONF_BLE_API_IMPLEMENTATION_DISCOVERY_CACHE_SLOTS > 9
+#error "ble-api-implementation.discovery-cache-slots must be only one digit long"
+#endif
+
+#define DISCOVERY_CACHE_SLOTS MBED_CONF_BLE_API_IMPLEMENTATION_DISCOVERY_CACHE_SLOTS
+
+constexpr size_t KVStoreDiscoveryCache::DATABASE_HASH_SIZE;
+constexpr uint8_t KVStoreDiscoveryCache::MAX_SERVICES;
+constexpr uint8_t KVStoreDiscoveryCache::MAX_CHARACTERISTICS;
+constexpr size_t KVStoreDiscoveryCache::DB_PREFIX_SIZE;
+constexpr size_t KVStoreDiscoveryCache::DB_KEY_SIZE;
+constexpr size_t KVStoreDiscoveryCache::DB_FULL_KEY_SIZE;
+constexpr char KVStoreDiscoveryCache::DB_PREFIX[DB_PREFIX_SIZE + 1];
+constexpr char KVStoreDiscoveryCache::DB_CACHE_ENTRY[DB_KEY_SIZE];
+constexpr char KVStoreDiscoveryCache::DB_CACHE_EVICTION[DB_KEY_SIZE];
+
+void KVStoreDiscoveryCache::create_key(char *full_key, const char *key)
+{
+    memcpy(full_key, DB_PREFIX, DB_PREFIX_SIZE);
+    memcpy(full_key + DB_PREFIX_SIZE, key, DB_KEY_SIZE);
+    full_key[DB_PREFIX_SIZE + DB_KEY_SIZE] = '\0';
+}
+
+void KVStoreDiscoveryCache::create_entry_key(char *full_key, uint8_t index)
+{
+    memcpy(full_key, DB_PREFIX, DB_PREFIX_SIZE);
+    memcpy(full_key + DB_PREFIX_SIZE, DB_CACHE_ENTRY, DB_KEY_SIZE);
+    full_key[DB_PREFIX_SIZE + DB_KEY_SIZE] = (char)('0' + index);
+    full_key[DB_PREFIX_SIZE + DB_KEY_SIZE + 1] = '\0';
+}
+
+bool KVStoreDiscoveryCache::read_entry(uint8_t index, entry_t &entry)
+{
+    char db_key[DB_FULL_KEY_SIZE];
+    create_entry_key(db_key, index);
+    size_t size;
+    const int ret = kv_get(db_key, &entry, sizeof(entry_t), &size);
+    return (ret == MBED_SUCCESS) && (size == sizeof(entry_t));
+}
+
+void KVStoreDiscoveryCache::write_entry(uint8_t index, const entry_t &entry)
+{
+    char db_key[DB_FULL_KEY_SIZE];
+    create_entry_key(db_key, index);
+    const int ret = kv_set(db_key, &entry, sizeof(entry_t), 0);
+    if (ret != MBED_SUCCESS) {
+        tr_warning("Failed to write discovery cache slot %d", index);
+    }
+}
+
+bool KVStoreDiscoveryCache::find_entry(const uint8_t *database_hash, entry_t &entry)
+{
+    for (uint8_t index = 0; index < DISCOVERY_CACHE_SLOTS; ++index) {
+        if (!read_entry(index, entry)) {
+            continue;
+        }
+
+        if (memcmp(entry.database_hash, database_hash, DATABASE_HASH_SIZE) == 0) {
+            tr_info("Discovery cache hit in slot %d", index);
+            return true;
+        }
+    }
+
+    tr_debug("Discovery cache miss");
+    return false;
+}
+
+void KVStoreDiscoveryCache::store_entry(const entry_t &entry)
+{
+    /* reuse the slot already carrying this hash, otherwise take a free slot,
+     * otherwise evict slots in round robin order */
+    uint8_t free_slot = DISCOVERY_CACHE_SLOTS;
+    entry_t *scratch = new (std::nothrow) entry_t;
+
+    if (scratch) {
+        for (uint8_t index = 0; index < DISCOVERY_CACHE_SLOTS; ++index) {
+            if (!read_entry(index, *scratch)) {
+                if (free_slot == DISCOVERY_CACHE_SLOTS) {
+                    free_slot = index;
+                }
+                continue;
+            }
+
+            if (memcmp(scratch->database_hash, entry.database_hash, DATABASE_HASH_SIZE) == 0) {
+                delete scratch;
+                write_entry(index, entry);
+                return;
+            }
+        }
+
+        delete scratch;
+    }
+
+    uint8_t slot = free_slot;
+    if (slot == DISCOVERY_CACHE_SLOTS) {
+        char db_key[DB_FULL_KEY_SIZE];
+        create_key(db_key, DB_CACHE_EVICTION);
+
+        uint8_t next_eviction = 0;
+        size_t size;
+        if (kv_get(db_key, &next_eviction, sizeof(next_eviction), &size) != MBED_SUCCESS) {
+            next_eviction = 0;
+        }
+
+        slot = next_eviction % DISCOVERY_CACHE_SLOTS;
+        next_eviction = (slot + 1) % DISCOVERY_CACHE_SLOTS;
+        kv_set(db_key, &next_eviction, sizeof(next_eviction), 0);
+    }
+
+    tr_info("Storing discovered attribute table in cache slot %d", slot);
+    write_entry(slot, entry);
+}
+
+void KVStoreDiscoveryCache::set_uuid(uint8_t *destination, uint8_t &length, const UUID &uuid)
+{
+    if (uuid.shortOrLong() == UUID::UUID_TYPE_SHORT) {
+        length = sizeof(UUID::ShortUUIDBytes_t);
+        UUID::ShortUUIDBytes_t short_uuid = uuid.getShortUUID();
+        memcpy(destination, &short_uuid, length);
+    } else {
+        length = UUID::LENGTH_OF_LONG_UUID;
+        memcpy(destination, uuid.getBaseUUID(), length);
+    }
+}
+
+UUID KVStoreDiscoveryCache::get_uuid(const uint8_t *source, uint8_t length)
+{
+    if (length == sizeof(UUID::ShortUUIDBytes_t)) {
+        UUID::ShortUUIDBytes_t short_uuid;
+        memcpy(&short_uuid, source, sizeof(short_uuid));
+        return UUID(short_uuid);
+    } else {
+        return UUID(source, UUID::LSB);
+    }
+}
+
+} /* namespace ble */
+
+#endif /* MBED_CONF_BLE_API_IMPLEMENTATION_GATT_CLIENT_DISCOVERY_CACHE */
@@ -0,0 +1,127 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2020 ARM Limited
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if MBED_CONF_BLE_API_IMPLEMENTATION_GATT_CLIENT_DISCOVERY_CACHE
+
+#ifndef GENERIC_KVSTORE_DISCOVERY_CACHE_H_
+#define GENERIC_KVSTORE_DISCOVERY_CACHE_H_
+
+#include <cstdint>
+#include <cstring>
+
+#include "kvstore_global_api.h"
+
+#include "ble/common/UUID.h"
+
+#ifndef STR
+#define STR_EXPAND(tok) #tok
+#define STR(tok) STR_EXPAND(tok)
+#endif
+
+namespace ble {
+
+/**
+ * KVStore backed cache of the attribute table discovered on a GATT server.
+ *
+ * Entries are keyed by the GATT Database Hash of the server (Bluetooth 5.1,
+ * Vol 3, Part G, 7.3): the hash is a digest of the whole attribute table so a
+ * matching hash guarantees the cached table is identical to the live one and
+ * discovery can be skipped. Entries survive reset; a server whose database
+ * changes produces a different hash and naturally misses the cache.
+ */
+class KVStoreDiscoveryCache {
+public:
+    static constexpr size_t DATABASE_HASH_SIZE = 16;
+
+    static constexpr uint8_t MAX_SERVICES =
+        MBED_CONF_BLE_API_IMPLEMENTATION_DISCOVERY_CACHE_MAX_SERVICES;
+    static constexpr uint8_t MAX_CHARACTERISTICS =
+        MBED_CONF_BLE_API_IMPLEMENTATION_DISCOVERY_CACHE_MAX_CHARACTERISTICS;
+
+    struct cached_service_t {
+        uint16_t begin;
+        uint16_t end;
+        uint8_t uuid_length;
+        uint8_t uuid[UUID::LENGTH_OF_LONG_UUID];
+    };
+
+    struct cached_characteristic_t {
+        uint16_t declaration_handle;
+        uint16_t value_handle;
+        uint16_t last_handle;
+        uint8_t properties;
+        uint8_t uuid_length;
+        uint8_t uuid[UUID::LENGTH_OF_LONG_UUID];
+    };
+
+    struct entry_t {
+        uint8_t database_hash[DATABASE_HASH_SIZE];
+        uint8_t service_count;
+        uint8_t characteristic_count;
+        cached_service_t services[MAX_SERVICES];
+        cached_characteristic_t characteristics[MAX_CHARACTERISTICS];
+    };
+
+    /**
+     * Look up the entry matching a database hash.
+     *
+     * @param database_hash Hash read from the server, DATABASE_HASH_SIZE bytes.
+     * @param entry Filled with the cached table on a hit.
+     *
+     * @return true if a cached table with this hash exists.
+     */
+    static bool find_entry(const uint8_t *database_hash, entry_t &entry);
+
+    /**
+     * Store an entry, replacing any entry carrying the same hash or evicting
+     * the oldest slot when the cache is full.
+     */
+    static void store_entry(const entry_t &entry);
+
+    /** Serialize a UUID into an entry field. */
+    static void set_uuid(uint8_t *destination, uint8_t &length, const UUID &uuid);
+
+    /** Rebuild a UUID from an entry field. */
+    static UUID get_uuid(const uint8_t *source, uint8_t length);
+
+private:
+    static constexpr size_t DB_PREFIX_SIZE = 7 + sizeof (STR(MBED_CONF_STORAGE_DEFAULT_KV)) - 1;
+    static constexpr size_t DB_KEY_SIZE = 3;
+    static constexpr size_t DB_FULL_KEY_SIZE = DB_PREFIX_SIZE + DB_KEY_SIZE + 2;
+
+    static constexpr char DB_PREFIX[DB_PREFIX_SIZE + 1] = { "/" STR(MBED_CONF_STORAGE_DEFAULT_KV) "/_ble_" };
+
+    static constexpr char DB_CACHE_ENTRY[DB_KEY_SIZE] = { 'g','c','e' };
+    static constexpr char DB_CACHE_EVICTION[DB_KEY_SIZE] = { 'g','c','n' };
+
+    static void create_key(char *full_key, const char *key);
+
+    static void create_entry_key(char *full_key, uint8_t index);
+
+    static bool read_entry(uint8_t index, entry_t &entry);
+
+    static void write_entry(uint8_t index, const entry_t &entry);
+
+    KVStoreDiscoveryCache() = delete;
+};
+
+} /* namespace ble */
+
+#endif /* GENERIC_KVSTORE_DISCOVERY_CACHE_H_ */
+
+#endif /* MBED_CONF_BLE_API_IMPLEMENTATION_GATT_CLIENT_DISCOVERY_CACHE */
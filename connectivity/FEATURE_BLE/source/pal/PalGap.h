@@ -1472,6 +1472,35 @@ public:
         uint16_t maximum_connection_event_length
     ) = 0;
 
+    /**
+     * Set the suggested data length parameters of a connection.
+     *
+     * @param connection Handle of the connection.
+     *
+     * @param tx_octets Preferred maximum number of payload octets in a single
+     * Link Layer packet. This value shall be in the range [0x001B : 0x00FB].
+     *
+     * @param tx_time Preferred maximum time the controller takes to transmit
+     * a single Link Layer packet, in microseconds. This value shall be in the
+     * range [0x0148 : 0x4290].
+     *
+     * @return BLE_ERROR_NONE if the request has been successfully sent or the
+     * appropriate error otherwise.
+     *
+     * @note The data length change is reported by
+     * GapEventHandler::onDataLengthChange once negotiated with the peer.
+     *
+     * @note: See Bluetooth 5 Vol 2 PartE: 7.8.33 LE Set Data Length command.
+     */
+    virtual ble_error_t set_data_length(
+        connection_handle_t connection,
+        uint16_t tx_octets,
+        uint16_t tx_time
+    )
+    {
+        return BLE_ERROR_NOT_IMPLEMENTED;
+    }
+
     /**
      * Accept connection parameter request.
      *
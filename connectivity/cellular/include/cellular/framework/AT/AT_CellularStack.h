@@ -105,8 +105,20 @@ protected:
             tls_socket(false),
             pending_bytes(0),
             txfull_event(false)
+#if MBED_CONF_CELLULAR_RX_PREFETCH_BUFFER_SIZE
+            , rx_buffer(NULL),
+            rx_head(0),
+            rx_count(0),
+            rx_prefetch_queued(false)
+#endif
         {
         }
+#if MBED_CONF_CELLULAR_RX_PREFETCH_BUFFER_SIZE
+        ~CellularSocket()
+        {
+            delete [] rx_buffer;
+        }
+#endif
         // Socket identifier, generally it will be the socket ID assigned by the
         // modem. In a few special cases, modems may take that as an input argument.
         int id;
@@ -123,6 +135,12 @@ protected:
         bool tls_socket; // socket uses modem's internal TLS socket functionality
         nsapi_size_t pending_bytes; // The number of received bytes pending
         bool txfull_event; // socket event after wouldblock
+#if MBED_CONF_CELLULAR_RX_PREFETCH_BUFFER_SIZE
+        uint8_t *rx_buffer; // ring of data drained from the modem ahead of recv, allocated on first drain
+        nsapi_size_t rx_head; // read position in rx_buffer
+        nsapi_size_t rx_count; // number of bytes buffered in rx_buffer
+        bool rx_prefetch_queued; // a drain event is already waiting on the queue
+#endif
     };
 
     /**
@@ -189,9 +207,35 @@ protected:
      */
     bool is_addr_stack_compatible(const SocketAddress &addr);
 
+#if MBED_CONF_CELLULAR_RX_PREFETCH_BUFFER_SIZE || defined(DOXYGEN_ONLY)
+    /**
+     *  Schedule draining of the modem's receive buffer for a TCP socket into
+     *  the socket's prefetch ring. Modem specific stacks call this from their
+     *  data-available URC handler; the drain itself runs as an event on the
+     *  device queue as AT commands cannot be issued from URC context. Once
+     *  data has been prefetched, socket_recv() is served from the ring without
+     *  touching the modem.
+     *
+     *  Enabled by defining MBED_CONF_CELLULAR_RX_PREFETCH_BUFFER_SIZE to the
+     *  per-socket ring size in bytes. UDP sockets are not prefetched as the
+     *  ring does not preserve datagram boundaries.
+     *
+     *  @param sock_id  Socket id given by the modem in the URC
+     */
+    void schedule_rx_prefetch(int sock_id);
+#endif
+
 private:
     int get_socket_index_by_port(uint16_t port);
 
+#if MBED_CONF_CELLULAR_RX_PREFETCH_BUFFER_SIZE
+    /** Drain pending data from the modem into the socket's prefetch ring. */
+    void rx_prefetch(int sock_id);
+
+    /** Copy buffered data out of the prefetch ring, @return number of bytes copied. */
+    nsapi_size_t rx_buffer_read(CellularSocket *socket, void *buffer, nsapi_size_t size);
+#endif
+
 protected:
     // socket container
     CellularSocket **_socket;
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2021, Arm Limited and affiliates.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef AT_COMMAND_PIPELINE_H_
+#define AT_COMMAND_PIPELINE_H_
+
+#include "events/EventQueue.h"
+#include "ATHandler.h"
+#include "PlatformMutex.h"
+#include "rtos/Semaphore.h"
+
+namespace mbed {
+
+/** ATCommandPipeline class
+ *
+ *  Asynchronous AT command queue on top of ATHandler. Commands are posted
+ *  without blocking the calling thread; they are written to the modem and
+ *  their responses parsed on the event queue thread, and each command reports
+ *  back through its own completion callback. This lets a caller queue a whole
+ *  command sequence (modem bring-up, periodic status polling) in one go
+ *  instead of issuing one blocking lock/write/read cycle per command.
+ *
+ *  When pipelining is enabled the next queued command is written to the modem
+ *  before the response of the current one is parsed, overlapping the modem's
+ *  processing of one command with response parsing and application callbacks
+ *  of the previous one. Enable this only for modems that buffer a command
+ *  received while the previous one is still executing; it is off by default.
+ *
+ *  The pipeline shares the ATHandler with blocking users: each command is
+ *  executed within a normal lock()/unlock_return_error() section, so
+ *  synchronous AT traffic and URC processing interleave safely with queued
+ *  commands.
+ */
+class ATCommandPipeline {
+public:
+    /** Constructor
+     *
+     *  @param at       ATHandler used to write commands and parse responses
+     *  @param queue    event queue the commands are executed on. Must be the
+     *                  same queue the ATHandler dispatches on.
+     */
+    ATCommandPipeline(ATHandler &at, events::EventQueue &queue);
+    ~ATCommandPipeline();
+
+    /** Queue an AT command for asynchronous execution.
+     *
+     *  The command line is formatted immediately; the variadic arguments do
+     *  not need to outlive the call. Once the command has been written and
+     *  its response consumed, on_complete is called from the event queue
+     *  thread with the command id and the error reported by ATHandler.
+     *
+     *  If on_response is given, it is called between resp_start() and
+     *  resp_stop() with the information response prefix "+<CMD>:" already
+     *  matched, so it can read the response parameters with the usual
+     *  ATHandler read routines. Without on_response the response is read and
+     *  discarded, as with at_cmd_discard().
+     *
+     *  @param cmd         AT command in form +<CMD> (used also for response
+     *                     prefix matching, no extra chars allowed)
+     *  @param cmd_chr     Char to be added to specific AT command: '?', '='
+     *                     or ''. Will be used as such so '=1' is valid as well.
+     *  @param on_complete callback called with the command id and the result
+     *                     of the command, or 0 for no callback
+     *  @param on_response callback used to read the information response, or
+     *                     0 to discard the response
+     *  @param format      Format string for variadic arguments to be added to
+     *                     AT command; No separator needed. Use %d for integer
+     *                     and %s for string. %b byte strings are not supported
+     *                     as commands are buffered until sent.
+     *  @return id (> 0) identifying the queued command, or a negative error
+     *          from nsapi_error_t if the command could not be queued
+     */
+    int post(const char *cmd, const char *cmd_chr,
+             Callback<void(int, nsapi_error_t)> on_complete = nullptr,
+             Callback<void(ATHandler &)> on_response = nullptr,
+             const char *format = "", ...);
+
+    /** Enable or disable writing the next queued command before the current
+     *  response has been parsed. Disabled by default.
+     *
+     *  @param pipelining true to overlap command transmission with response
+     *                    parsing
+     */
+    void set_pipelining(bool pipelining);
+
+    /** Block until every queued command has completed.
+     *
+     *  Must not be called from the event queue thread as the commands are
+     *  executed there. Only one thread at a time may wait.
+     *
+     *  @param timeout maximum time to wait
+     *  @return true if the queue drained within the timeout
+     */
+    bool wait_all(std::chrono::duration<int, std::milli> timeout);
+
+    /** Drop queued commands that have not yet been written to the modem.
+     *  Completion callbacks of the dropped commands are not called. A command
+     *  already on the wire still runs to completion.
+     */
+    void cancel_pending();
+
+    /** Number of commands queued or in progress.
+     *
+     *  @return count of commands that have not yet completed
+     */
+    int pending_count();
+
+private:
+    // command lines carry formatted subparameters so they need more room than
+    // ATHandler's own command buffer, which writes subparameters through
+    static const size_t LINE_BUFFER_SIZE = 2 * MBED_CONF_CELLULAR_AT_HANDLER_BUFFER_SIZE;
+
+    struct pending_command_t {
+        int id;
+        // complete command line including "AT", cmd_chr and subparameters
+        char line[LINE_BUFFER_SIZE];
+        // information response prefix "+<CMD>:", empty if response is discarded
+        char prefix[MBED_CONF_CELLULAR_AT_HANDLER_BUFFER_SIZE];
+        // set once the command has been written to the modem
+        bool written;
+        Callback<void(ATHandler &)> on_response;
+        Callback<void(int, nsapi_error_t)> on_complete;
+        pending_command_t *next;
+    };
+
+    // Executes the head of the queue on the event queue thread.
+    void process();
+    // Appends formatted subparameters to the command line. Returns false on overflow.
+    bool format_args(pending_command_t *command, size_t len, const char *format, std::va_list list);
+
+    ATHandler &_at;
+    events::EventQueue &_queue;
+    PlatformMutex _mutex;
+    rtos::Semaphore _idle_sem;
+    pending_command_t *_head;
+    pending_command_t *_tail;
+    int _next_id;
+    int _event_id;
+    bool _processing;
+    bool _pipelining;
+    bool _waiting;
+};
+
+} // namespace mbed
+
+#endif // AT_COMMAND_PIPELINE_H_
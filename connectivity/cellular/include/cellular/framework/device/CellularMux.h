@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2021, Arm Limited and affiliates.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef CELLULAR_MUX_H_
+#define CELLULAR_MUX_H_
+
+#include <stdint.h>
+#include "events/EventQueue.h"
+#include "platform/FileHandle.h"
+#include "platform/Callback.h"
+#include "PlatformMutex.h"
+#include "nsapi_types.h"
+
+/** Receive buffer bytes per logical channel. */
+#ifndef MBED_CONF_CELLULAR_CMUX_RX_BUFFER_SIZE
+#define MBED_CONF_CELLULAR_CMUX_RX_BUFFER_SIZE 256
+#endif
+
+/** Maximum information field length of a single CMUX frame (N1). */
+#ifndef MBED_CONF_CELLULAR_CMUX_FRAME_SIZE
+#define MBED_CONF_CELLULAR_CMUX_FRAME_SIZE 64
+#endif
+
+namespace mbed {
+
+/** CellularMux class
+ *
+ *  3GPP TS 27.010 serial multiplexer (basic option). Splits one physical
+ *  serial device into several logical channels, each presented as a
+ *  FileHandle, so AT commands and PPP data can run concurrently over a
+ *  single UART without switching the modem between command and data mode.
+ *
+ *  The modem must first be commanded into multiplexed mode (AT+CMUX) over
+ *  the plain serial device; after that start() opens the 27.010 control
+ *  channel and open_channel() establishes logical channels that can be
+ *  handed to ATHandler or the PPP service in place of the raw device.
+ *
+ *  Flow control is per channel: when a channel's receive buffer runs close
+ *  to full a modem status command (MSC) with the flow control bit is sent
+ *  for that channel only, and an MSC received from the modem blocks writes
+ *  on the addressed channel only, so a stalled data channel never stops AT
+ *  traffic. Frames are at most MBED_CONF_CELLULAR_CMUX_FRAME_SIZE bytes, so
+ *  a control channel frame is delayed by at most one data frame already on
+ *  the wire, which keeps status polls fast during bulk transfers.
+ */
+class CellularMux {
+public:
+    /** Constructor
+     *
+     *  @param fh       physical serial device, switched to CMUX mode by the caller
+     *  @param queue    event queue used to process received frames
+     */
+    CellularMux(FileHandle &fh, events::EventQueue &queue);
+    ~CellularMux();
+
+    /** Establish the multiplexer control channel (DLCI 0).
+     *
+     *  Must be called before opening logical channels.
+     *
+     *  @return NSAPI_ERROR_OK on success, NSAPI_ERROR_DEVICE_ERROR if the
+     *          modem rejects or does not answer the control channel setup
+     */
+    nsapi_error_t start();
+
+    /** Open a logical channel.
+     *
+     *  @param dlci channel number, 1..3. DLCI 1 is conventionally used for
+     *              AT commands and further channels for data.
+     *  @return FileHandle of the channel, or NULL on failure. The handle
+     *          stays owned by CellularMux and is valid until close() is
+     *          called on it or the multiplexer is destroyed.
+     */
+    FileHandle *open_channel(int dlci);
+
+    /** Close down the multiplexer.
+     *
+     *  Disconnects all open logical channels and sends the close-down (CLD)
+     *  command, returning the modem to plain serial mode.
+     *
+     *  @return NSAPI_ERROR_OK on success
+     */
+    nsapi_error_t stop();
+
+private:
+    static const int MAX_DLCI = 4; // control channel + three logical channels
+
+    // frame parser states
+    enum rx_state_t {
+        RX_FLAG = 0,
+        RX_ADDRESS,
+        RX_CONTROL,
+        RX_LENGTH,
+        RX_LENGTH2,
+        RX_PAYLOAD,
+        RX_FCS
+    };
+
+    // result of a pending SABM/DISC handshake
+    enum response_t {
+        RESP_NONE = 0,
+        RESP_UA,
+        RESP_DM
+    };
+
+    class Channel : public FileHandle {
+        friend class CellularMux;
+    public:
+        Channel();
+        virtual ssize_t read(void *buffer, size_t size);
+        virtual ssize_t write(const void *buffer, size_t size);
+        virtual off_t seek(off_t offset, int whence = SEEK_SET);
+        virtual int close();
+        virtual int isatty();
+        virtual short poll(short events) const;
+        virtual void sigio(Callback<void()> func);
+        virtual int set_blocking(bool blocking);
+
+    private:
+        CellularMux *_mux;
+        int _dlci;
+        bool _open;
+        bool _tx_blocked;        // peer sent MSC with the FC bit set
+        bool _rx_flow_stopped;   // we told the peer to stop sending
+        uint8_t _rx_buffer[MBED_CONF_CELLULAR_CMUX_RX_BUFFER_SIZE];
+        size_t _rx_head;
+        size_t _rx_count;
+        Callback<void()> _sigio_cb;
+    };
+
+    void fh_sigio();
+    void process_input();
+    void dispatch_sigio();
+    bool read_and_parse();
+    void parse_byte(uint8_t c);
+    void start_payload();
+    void handle_frame();
+    void handle_control_message(const uint8_t *data, size_t len);
+    void deliver_data(int dlci, const uint8_t *data, size_t len);
+    nsapi_error_t request_response(int dlci, uint8_t control);
+    nsapi_error_t write_frame(int dlci, uint8_t control, const uint8_t *data, size_t len);
+    nsapi_error_t fh_write_all(const uint8_t *data, size_t len);
+    void send_msc(int dlci, bool flow_stop, bool command);
+    static uint8_t fcs_add(uint8_t fcs, uint8_t c);
+
+    FileHandle &_fh;
+    events::EventQueue &_queue;
+    Channel _channels[MAX_DLCI]; // index is the DLCI, 0 is the control channel
+    PlatformMutex _tx_mutex;     // serializes frames on the physical device
+    PlatformMutex _rx_mutex;     // serializes parser access
+    bool _started;
+    int _event_id;
+    bool _pending_sigio[MAX_DLCI]; // channels to signal once the parser lock is released
+
+    // receive parser state
+    rx_state_t _rx_state;
+    uint8_t _frame_address;
+    uint8_t _frame_control;
+    size_t _frame_length;
+    size_t _frame_received;
+    uint8_t _frame_fcs;
+    uint8_t _frame_payload[MBED_CONF_CELLULAR_CMUX_FRAME_SIZE];
+
+    // pending handshake result, written by the parser
+    volatile response_t _response;
+    int _response_dlci;
+};
+
+} // namespace mbed
+
+#endif // CELLULAR_MUX_H_
@@ -351,7 +351,19 @@ nsapi_size_or_error_t AT_CellularStack::socket_recvfrom(nsapi_socket_t handle, S
 
     _at.lock();
 
-    ret_val = socket_recvfrom_impl(socket, addr, buffer, size);
+#if MBED_CONF_CELLULAR_RX_PREFETCH_BUFFER_SIZE
+    // consume prefetched data first so the stream stays ordered: new data is
+    // read from the modem only once the ring is empty
+    ret_val = rx_buffer_read(socket, buffer, size);
+    if (ret_val > 0) {
+        if (addr) {
+            *addr = socket->remoteAddress;
+        }
+    } else
+#endif
+    {
+        ret_val = socket_recvfrom_impl(socket, addr, buffer, size);
+    }
 
     _at.unlock();
 
@@ -410,6 +422,125 @@ AT_CellularStack::CellularSocket *AT_CellularStack::find_socket(int sock_id)
     return sock;
 }
 
+#if MBED_CONF_CELLULAR_RX_PREFETCH_BUFFER_SIZE
+
+void AT_CellularStack::schedule_rx_prefetch(int sock_id)
+{
+    CellularSocket *socket = find_socket(sock_id);
+    if (!socket || socket->proto != NSAPI_TCP || socket->closed) {
+        return;
+    }
+
+    _socket_mutex.lock();
+    bool queued = socket->rx_prefetch_queued;
+    socket->rx_prefetch_queued = true;
+    _socket_mutex.unlock();
+
+    if (queued) {
+        return;
+    }
+
+    events::EventQueue *queue = _device.get_queue();
+    if (!queue || queue->call(this, &AT_CellularStack::rx_prefetch, sock_id) == 0) {
+        _socket_mutex.lock();
+        socket->rx_prefetch_queued = false;
+        _socket_mutex.unlock();
+    }
+}
+
+void AT_CellularStack::rx_prefetch(int sock_id)
+{
+    // the AT handler lock also keeps the socket alive: socket_close() deletes
+    // the socket while holding it
+    _at.lock();
+
+    CellularSocket *socket = find_socket(sock_id);
+    if (!socket) {
+        _at.unlock();
+        return;
+    }
+
+    _socket_mutex.lock();
+    socket->rx_prefetch_queued = false;
+    _socket_mutex.unlock();
+
+    if (socket->proto != NSAPI_TCP || socket->id == -1) {
+        _at.unlock();
+        return;
+    }
+
+    if (!socket->rx_buffer) {
+        socket->rx_buffer = new uint8_t[MBED_CONF_CELLULAR_RX_PREFETCH_BUFFER_SIZE];
+    }
+
+    nsapi_size_t drained = 0;
+    while (true) {
+        _socket_mutex.lock();
+        nsapi_size_t tail = (socket->rx_head + socket->rx_count) % MBED_CONF_CELLULAR_RX_PREFETCH_BUFFER_SIZE;
+        nsapi_size_t space = MBED_CONF_CELLULAR_RX_PREFETCH_BUFFER_SIZE - socket->rx_count;
+        _socket_mutex.unlock();
+
+        if (space == 0) {
+            break;
+        }
+        // fill at most up to the wrap point so the modem read is contiguous
+        nsapi_size_t contiguous = MBED_CONF_CELLULAR_RX_PREFETCH_BUFFER_SIZE - tail;
+        if (contiguous > space) {
+            contiguous = space;
+        }
+
+        nsapi_size_or_error_t len = socket_recvfrom_impl(socket, NULL, socket->rx_buffer + tail, contiguous);
+        if (len <= 0) {
+            break;
+        }
+
+        _socket_mutex.lock();
+        socket->rx_count += len;
+        _socket_mutex.unlock();
+        drained += len;
+    }
+
+    void (*callback)(void *) = socket->_cb;
+    void *data = socket->_data;
+
+    _at.unlock();
+
+    if (drained > 0) {
+        tr_debug("Socket %d prefetched %d bytes", find_socket_index(socket), drained);
+        if (callback) {
+            callback(data);
+        }
+    }
+}
+
+nsapi_size_t AT_CellularStack::rx_buffer_read(CellularSocket *socket, void *buffer, nsapi_size_t size)
+{
+    _socket_mutex.lock();
+
+    nsapi_size_t count = socket->rx_count;
+    if (count > size) {
+        count = size;
+    }
+
+    if (count > 0) {
+        nsapi_size_t contiguous = MBED_CONF_CELLULAR_RX_PREFETCH_BUFFER_SIZE - socket->rx_head;
+        if (contiguous > count) {
+            contiguous = count;
+        }
+        memcpy(buffer, socket->rx_buffer + socket->rx_head, contiguous);
+        if (count > contiguous) {
+            memcpy((uint8_t *)buffer + contiguous, socket->rx_buffer, count - contiguous);
+        }
+        socket->rx_head = (socket->rx_head + count) % MBED_CONF_CELLULAR_RX_PREFETCH_BUFFER_SIZE;
+        socket->rx_count -= count;
+    }
+
+    _socket_mutex.unlock();
+    return count;
+}
+
+#endif // MBED_CONF_CELLULAR_RX_PREFETCH_BUFFER_SIZE
+
 bool AT_CellularStack::is_addr_stack_compatible(const SocketAddress &addr)
 {
     if ((addr.get_ip_version() == NSAPI_UNSPEC) ||
@@ -0,0 +1,343 @@
+/*
+ * Copyright (c) 2021, Arm Limited and affiliates.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+#include "ATCommandPipeline.h"
+
+using namespace mbed;
+using namespace events;
+
+#include "CellularLog.h"
+
+ATCommandPipeline::ATCommandPipeline(ATHandler &at, EventQueue &queue) :
+    _at(at),
+    _queue(queue),
+    _idle_sem(0, 1),
+    _head(NULL),
+    _tail(NULL),
+    _next_id(1),
+    _event_id(0),
+    _processing(false),
+    _pipelining(false),
+    _waiting(false)
+{
+}
+
+ATCommandPipeline::~ATCommandPipeline()
+{
+    if (_event_id != 0 && _queue.cancel(_event_id)) {
+        _event_id = 0;
+    }
+
+    pending_command_t *command = _head;
+    while (command) {
+        _head = _head->next;
+        delete command;
+        command = _head;
+    }
+}
+
+int ATCommandPipeline::post(const char *cmd, const char *cmd_chr,
+                            Callback<void(int, nsapi_error_t)> on_complete,
+                            Callback<void(ATHandler &)> on_response,
+                            const char *format, ...)
+{
+    size_t cmd_len = strlen(cmd);
+    size_t cmd_chr_len = cmd_chr ? strlen(cmd_chr) : 0;
+    if (2 + cmd_len + cmd_chr_len >= LINE_BUFFER_SIZE ||
+            cmd_len + 2 > MBED_CONF_CELLULAR_AT_HANDLER_BUFFER_SIZE) {
+        return NSAPI_ERROR_PARAMETER;
+    }
+
+    pending_command_t *command = new pending_command_t;
+    command->written = false;
+    command->on_response = on_response;
+    command->on_complete = on_complete;
+    command->next = NULL;
+
+    size_t len = 0;
+    memcpy(command->line, "AT", 2);
+    len += 2;
+    memcpy(command->line + len, cmd, cmd_len);
+    len += cmd_len;
+    if (cmd_chr_len) {
+        memcpy(command->line + len, cmd_chr, cmd_chr_len);
+        len += cmd_chr_len;
+    }
+    command->line[len] = '\0';
+
+    std::va_list list;
+    va_start(list, format);
+    bool formatted = format_args(command, len, format, list);
+    va_end(list);
+
+    if (!formatted) {
+        delete command;
+        return NSAPI_ERROR_PARAMETER;
+    }
+
+    if (on_response && cmd_len > 0) {
+        memcpy(command->prefix, cmd, cmd_len);
+        command->prefix[cmd_len] = ':';
+        command->prefix[cmd_len + 1] = '\0';
+    } else {
+        command->prefix[0] = '\0';
+    }
+
+    _mutex.lock();
+
+    command->id = _next_id++;
+    if (_next_id <= 0) {
+        _next_id = 1;
+    }
+
+    if (_head == NULL) {
+        _head = command;
+    } else {
+        _tail->next = command;
+    }
+    _tail = command;
+
+    int id = command->id;
+    if (!_processing) {
+        _event_id = _queue.call(this, &ATCommandPipeline::process);
+        if (_event_id == 0) {
+            if (_head == command) {
+                _head = NULL;
+                _tail = NULL;
+            } else {
+                pending_command_t *previous = _head;
+                while (previous->next != command) {
+                    previous = previous->next;
+                }
+                previous->next = NULL;
+                _tail = previous;
+            }
+            _mutex.unlock();
+            delete command;
+            return NSAPI_ERROR_NO_MEMORY;
+        }
+        _processing = true;
+    }
+
+    _mutex.unlock();
+
+    return id;
+}
+
+bool ATCommandPipeline::format_args(pending_command_t *command, size_t len, const char *format, std::va_list list)
+{
+    bool first = true;
+    while (*format != '\0') {
+        if (*format == 'd' || *format == 's') {
+            if (!first) {
+                if (len + 1 >= LINE_BUFFER_SIZE) {
+                    return false;
+                }
+                command->line[len++] = ',';
+            }
+            first = false;
+        }
+
+        if (*format == 'd') {
+            int32_t i = va_arg(list, int32_t);
+            char number_string[12];
+            int result = sprintf(number_string, "%" PRIi32, i);
+            if (result <= 0 || len + result >= LINE_BUFFER_SIZE) {
+                return false;
+            }
+            memcpy(command->line + len, number_string, result);
+            len += result;
+        } else if (*format == 's') {
+            char *str = (char *)va_arg(list, char *);
+            size_t str_len = strlen(str);
+            if (len + str_len + 2 >= LINE_BUFFER_SIZE) {
+                return false;
+            }
+            command->line[len++] = '"';
+            memcpy(command->line + len, str, str_len);
+            len += str_len;
+            command->line[len++] = '"';
+        } else if (*format == 'b') {
+            // byte strings may contain NULs and cannot be carried in the
+            // buffered command line
+            return false;
+        }
+        ++format;
+    }
+
+    command->line[len] = '\0';
+    return true;
+}
+
+void ATCommandPipeline::set_pipelining(bool pipelining)
+{
+    _mutex.lock();
+    _pipelining = pipelining;
+    _mutex.unlock();
+}
+
+bool ATCommandPipeline::wait_all(std::chrono::duration<int, std::milli> timeout)
+{
+    _mutex.lock();
+    if (!_processing) {
+        _mutex.unlock();
+        return true;
+    }
+    _waiting = true;
+    _mutex.unlock();
+
+    return _idle_sem.try_acquire_for(timeout);
+}
+
+void ATCommandPipeline::cancel_pending()
+{
+    _mutex.lock();
+
+    pending_command_t *previous = NULL;
+    pending_command_t *command = _head;
+    while (command) {
+        if (command->written) {
+            previous = command;
+            command = command->next;
+        } else {
+            pending_command_t *dropped = command;
+            command = command->next;
+            if (previous) {
+                previous->next = command;
+            } else {
+                _head = command;
+            }
+            delete dropped;
+        }
+    }
+    _tail = previous;
+
+    _mutex.unlock();
+}
+
+int ATCommandPipeline::pending_count()
+{
+    _mutex.lock();
+
+    int count = 0;
+    for (pending_command_t *command = _head; command; command = command->next) {
+        count++;
+    }
+    // the command being executed has already been taken off the queue
+    if (_processing && count == 0) {
+        count = 1;
+    }
+
+    _mutex.unlock();
+    return count;
+}
+
+void ATCommandPipeline::process()
+{
+    _mutex.lock();
+
+    pending_command_t *command = _head;
+    if (!command) {
+        _processing = false;
+        if (_waiting) {
+            _waiting = false;
+            _idle_sem.release();
+        }
+        _mutex.unlock();
+        return;
+    }
+    _head = command->next;
+    if (!_head) {
+        _tail = NULL;
+    }
+
+    // claim the next command for transmission before the current response is
+    // parsed so the modem processes it while we are busy with callbacks
+    pending_command_t *following = NULL;
+    if (_pipelining && _head && !_head->written) {
+        following = _head;
+        following->written = true;
+    }
+
+    _mutex.unlock();
+
+    _at.lock();
+
+    if (!command->written) {
+        _at.cmd_start(command->line);
+        _at.cmd_stop();
+        command->written = true;
+    }
+
+    if (following) {
+        _at.cmd_start(following->line);
+        _at.cmd_stop();
+    }
+
+    if (command->on_response) {
+        _at.resp_start(command->prefix[0] != '\0' ? command->prefix : NULL);
+        command->on_response(_at);
+        _at.resp_stop();
+    } else {
+        _at.resp_start();
+        _at.resp_stop();
+    }
+
+    nsapi_error_t err = _at.unlock_return_error();
+
+    if (err != NSAPI_ERROR_OK) {
+        tr_debug("AT pipeline command %d failed with %d", command->id, err);
+    }
+
+    if (command->on_complete) {
+        command->on_complete(command->id, err);
+    }
+    delete command;
+
+    pending_command_t *orphans = NULL;
+
+    _mutex.lock();
+    if (_head) {
+        _event_id = _queue.call(this, &ATCommandPipeline::process);
+        if (_event_id == 0) {
+            // queue is out of memory, commands left behind would never run
+            orphans = _head;
+            _head = NULL;
+            _tail = NULL;
+            _processing = false;
+        }
+    } else {
+        _processing = false;
+    }
+    if (!_processing && _waiting) {
+        _waiting = false;
+        _idle_sem.release();
+    }
+    _mutex.unlock();
+
+    while (orphans) {
+        pending_command_t *next = orphans->next;
+        if (orphans->on_complete) {
+            orphans->on_complete(orphans->id, NSAPI_ERROR_NO_MEMORY);
+        }
+        delete orphans;
+        orphans = next;
+    }
+}
@@ -0,0 +1,618 @@
+/*
+ * Copyright (c) 2021, Arm Limited and affiliates.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string.h>
+#include "CellularMux.h"
+#include "mbed_poll.h"
+#include "platform/mbed_retarget.h"
+#include "rtos/Kernel.h"
+
+using namespace mbed;
+using namespace events;
+using std::chrono::duration_cast;
+using std::chrono::milliseconds;
+
+#include "CellularLog.h"
+
+// TS 27.010 basic option framing
+static const uint8_t CMUX_FLAG = 0xF9;
+static const uint8_t CONTROL_SABM = 0x2F;
+static const uint8_t CONTROL_UA = 0x63;
+static const uint8_t CONTROL_DM = 0x0F;
+static const uint8_t CONTROL_DISC = 0x43;
+static const uint8_t CONTROL_UIH = 0xEF;
+static const uint8_t CONTROL_PF = 0x10;
+
+// control channel message types (EA bit included, bit 1 is C/R)
+static const uint8_t TYPE_MSC_COMMAND = 0xE3;
+static const uint8_t TYPE_MSC_RESPONSE = 0xE1;
+static const uint8_t TYPE_CR_BIT = 0x02;
+static const uint8_t TYPE_CLD_COMMAND = 0xC3;
+
+// V.24 signal bits carried in the MSC value octet
+static const uint8_t SIGNAL_FC = 0x02;
+static const uint8_t SIGNALS_READY = 0x8D; // EA | RTC | RTR | DV
+
+static const uint8_t FCS_INIT = 0xFF;
+static const uint8_t FCS_GOOD = 0xCF;
+
+static const milliseconds HANDSHAKE_TIMEOUT = milliseconds(1000);
+
+// per-channel receive flow control thresholds
+static const size_t RX_HIGH_WATERMARK = (MBED_CONF_CELLULAR_CMUX_RX_BUFFER_SIZE * 3) / 4;
+static const size_t RX_LOW_WATERMARK = MBED_CONF_CELLULAR_CMUX_RX_BUFFER_SIZE / 4;
+
+CellularMux::CellularMux(FileHandle &fh, EventQueue &queue) :
+    _fh(fh),
+    _queue(queue),
+    _started(false),
+    _event_id(0),
+    _rx_state(RX_FLAG),
+    _frame_address(0),
+    _frame_control(0),
+    _frame_length(0),
+    _frame_received(0),
+    _frame_fcs(0),
+    _response(RESP_NONE),
+    _response_dlci(-1)
+{
+    for (int i = 0; i < MAX_DLCI; i++) {
+        _channels[i]._mux = this;
+        _channels[i]._dlci = i;
+        _pending_sigio[i] = false;
+    }
+}
+
+CellularMux::~CellularMux()
+{
+    _fh.sigio(nullptr);
+    if (_event_id) {
+        _queue.cancel(_event_id);
+    }
+}
+
+nsapi_error_t CellularMux::start()
+{
+    if (_started) {
+        return NSAPI_ERROR_OK;
+    }
+
+    _fh.set_blocking(false);
+    _fh.sigio(Callback<void()>(this, &CellularMux::fh_sigio));
+
+    nsapi_error_t err = request_response(0, CONTROL_SABM);
+    if (err != NSAPI_ERROR_OK) {
+        tr_error("CMUX control channel setup failed");
+        return err;
+    }
+
+    _started = true;
+    _channels[0]._open = true;
+    return NSAPI_ERROR_OK;
+}
+
+FileHandle *CellularMux::open_channel(int dlci)
+{
+    if (!_started || dlci <= 0 || dlci >= MAX_DLCI) {
+        return NULL;
+    }
+
+    Channel *ch = &_channels[dlci];
+    if (ch->_open) {
+        return ch;
+    }
+
+    _rx_mutex.lock();
+    ch->_rx_head = 0;
+    ch->_rx_count = 0;
+    ch->_tx_blocked = false;
+    ch->_rx_flow_stopped = false;
+    _rx_mutex.unlock();
+
+    if (request_response(dlci, CONTROL_SABM) != NSAPI_ERROR_OK) {
+        tr_error("CMUX channel %d setup failed", dlci);
+        return NULL;
+    }
+
+    ch->_open = true;
+    send_msc(dlci, false, true); // announce we are ready to receive
+    return ch;
+}
+
+nsapi_error_t CellularMux::stop()
+{
+    if (!_started) {
+        return NSAPI_ERROR_OK;
+    }
+
+    for (int dlci = 1; dlci < MAX_DLCI; dlci++) {
+        if (_channels[dlci]._open) {
+            request_response(dlci, CONTROL_DISC);
+            _channels[dlci]._open = false;
+        }
+    }
+
+    // close-down command returns the modem to plain serial mode
+    const uint8_t cld[2] = { TYPE_CLD_COMMAND, (0 << 1) | 0x01 };
+    write_frame(0, CONTROL_UIH, cld, sizeof(cld));
+
+    _channels[0]._open = false;
+    _started = false;
+    return NSAPI_ERROR_OK;
+}
+
+void CellularMux::fh_sigio()
+{
+    if (_event_id == 0) {
+        int id = _queue.call(this, &CellularMux::process_input);
+        if (id) {
+            _event_id = id;
+        }
+    }
+}
+
+void CellularMux::process_input()
+{
+    _event_id = 0;
+
+    _rx_mutex.lock();
+    while (read_and_parse()) {
+    }
+    _rx_mutex.unlock();
+
+    dispatch_sigio();
+}
+
+bool CellularMux::read_and_parse()
+{
+    uint8_t buf[32];
+    ssize_t len = _fh.read(buf, sizeof(buf));
+    if (len <= 0) {
+        return false;
+    }
+    for (ssize_t i = 0; i < len; i++) {
+        parse_byte(buf[i]);
+    }
+    return true;
+}
+
+void CellularMux::parse_byte(uint8_t c)
+{
+    switch (_rx_state) {
+        case RX_FLAG:
+            if (c == CMUX_FLAG) {
+                _rx_state = RX_ADDRESS;
+            }
+            break;
+        case RX_ADDRESS:
+            if (c == CMUX_FLAG) {
+                break; // shared or repeated flag between frames
+            }
+            _frame_address = c;
+            _frame_fcs = fcs_add(FCS_INIT, c);
+            _rx_state = RX_CONTROL;
+            break;
+        case RX_CONTROL:
+            _frame_control = c;
+            _frame_fcs = fcs_add(_frame_fcs, c);
+            _rx_state = RX_LENGTH;
+            break;
+        case RX_LENGTH:
+            _frame_fcs = fcs_add(_frame_fcs, c);
+            _frame_length = c >> 1;
+            if (c & 0x01) {
+                start_payload();
+            } else {
+                _rx_state = RX_LENGTH2;
+            }
+            break;
+        case RX_LENGTH2:
+            _frame_fcs = fcs_add(_frame_fcs, c);
+            _frame_length |= (size_t)c << 7;
+            start_payload();
+            break;
+        case RX_PAYLOAD:
+            _frame_payload[_frame_received++] = c;
+            if (_frame_received == _frame_length) {
+                _rx_state = RX_FCS;
+            }
+            break;
+        case RX_FCS:
+            // the FCS covers address, control and length fields only
+            if (fcs_add(_frame_fcs, c) == FCS_GOOD) {
+                handle_frame();
+            } else {
+                tr_warn("CMUX frame with bad FCS dropped");
+            }
+            _rx_state = RX_FLAG;
+            break;
+        default:
+            _rx_state = RX_FLAG;
+            break;
+    }
+}
+
+void CellularMux::start_payload()
+{
+    if (_frame_length > sizeof(_frame_payload)) {
+        tr_warn("CMUX frame too long (%d), dropped", (int)_frame_length);
+        _rx_state = RX_FLAG;
+    } else if (_frame_length == 0) {
+        _rx_state = RX_FCS;
+    } else {
+        _frame_received = 0;
+        _rx_state = RX_PAYLOAD;
+    }
+}
+
+void CellularMux::handle_frame()
+{
+    int dlci = _frame_address >> 2;
+    uint8_t control = _frame_control & ~CONTROL_PF;
+
+    switch (control) {
+        case CONTROL_UA:
+        case CONTROL_DM:
+            if (dlci == _response_dlci && _response == RESP_NONE) {
+                _response = (control == CONTROL_UA) ? RESP_UA : RESP_DM;
+            }
+            break;
+        case CONTROL_SABM:
+            // only the initiator role is supported
+            write_frame(dlci, CONTROL_DM | CONTROL_PF, NULL, 0);
+            break;
+        case CONTROL_DISC:
+            write_frame(dlci, CONTROL_UA | CONTROL_PF, NULL, 0);
+            if (dlci > 0 && dlci < MAX_DLCI) {
+                _channels[dlci]._open = false;
+            }
+            break;
+        case CONTROL_UIH:
+            if (dlci == 0) {
+                handle_control_message(_frame_payload, _frame_length);
+            } else {
+                deliver_data(dlci, _frame_payload, _frame_length);
+            }
+            break;
+        default:
+            tr_debug("CMUX unsupported frame type 0x%02X", control);
+            break;
+    }
+}
+
+void CellularMux::handle_control_message(const uint8_t *data, size_t len)
+{
+    if (len < 2) {
+        return;
+    }
+    uint8_t type = data[0];
+    size_t value_len = data[1] >> 1;
+    if (2 + value_len > len) {
+        return;
+    }
+
+    if ((type | TYPE_CR_BIT) == TYPE_MSC_COMMAND) {
+        if (!(type & TYPE_CR_BIT)) {
+            return; // response to an MSC we sent, nothing to do
+        }
+        if (value_len < 2) {
+            return;
+        }
+        int dlci = data[2] >> 2;
+        uint8_t signals = data[3];
+        if (dlci > 0 && dlci < MAX_DLCI) {
+            Channel *ch = &_channels[dlci];
+            bool was_blocked = ch->_tx_blocked;
+            ch->_tx_blocked = (signals & SIGNAL_FC);
+            if (was_blocked && !ch->_tx_blocked) {
+                _pending_sigio[dlci] = true; // writers may continue
+            }
+        }
+        // acknowledge with an MSC response echoing the values
+        uint8_t resp[5];
+        resp[0] = TYPE_MSC_RESPONSE;
+        resp[1] = data[1];
+        memcpy(&resp[2], &data[2], value_len);
+        write_frame(0, CONTROL_UIH, resp, 2 + value_len);
+    } else if (type & TYPE_CR_BIT) {
+        tr_debug("CMUX unsupported control message 0x%02X", type);
+    }
+}
+
+void CellularMux::deliver_data(int dlci, const uint8_t *data, size_t len)
+{
+    if (dlci >= MAX_DLCI || !_channels[dlci]._open) {
+        tr_warn("CMUX data on closed channel %d dropped", dlci);
+        return;
+    }
+
+    Channel *ch = &_channels[dlci];
+    size_t space = sizeof(ch->_rx_buffer) - ch->_rx_count;
+    if (len > space) {
+        tr_warn("CMUX channel %d receive overflow, %d bytes dropped", dlci, (int)(len - space));
+        len = space;
+    }
+
+    size_t tail = (ch->_rx_head + ch->_rx_count) % sizeof(ch->_rx_buffer);
+    size_t contiguous = sizeof(ch->_rx_buffer) - tail;
+    if (contiguous > len) {
+        contiguous = len;
+    }
+    memcpy(&ch->_rx_buffer[tail], data, contiguous);
+    if (len > contiguous) {
+        memcpy(&ch->_rx_buffer[0], data + contiguous, len - contiguous);
+    }
+    ch->_rx_count += len;
+
+    if (ch->_rx_count >= RX_HIGH_WATERMARK && !ch->_rx_flow_stopped) {
+        ch->_rx_flow_stopped = true;
+        send_msc(dlci, true, true);
+    }
+
+    if (len > 0) {
+        _pending_sigio[dlci] = true;
+    }
+}
+
+void CellularMux::dispatch_sigio()
+{
+    for (int i = 0; i < MAX_DLCI; i++) {
+        if (_pending_sigio[i]) {
+            _pending_sigio[i] = false;
+            if (_channels[i]._sigio_cb) {
+                _channels[i]._sigio_cb();
+            }
+        }
+    }
+}
+
+nsapi_error_t CellularMux::request_response(int dlci, uint8_t control)
+{
+    _rx_mutex.lock();
+    _response = RESP_NONE;
+    _response_dlci = dlci;
+    _rx_mutex.unlock();
+
+    if (write_frame(dlci, control | CONTROL_PF, NULL, 0) != NSAPI_ERROR_OK) {
+        return NSAPI_ERROR_DEVICE_ERROR;
+    }
+
+    auto start = rtos::Kernel::Clock::now();
+    while (_response == RESP_NONE) {
+        auto elapsed = duration_cast<milliseconds>(rtos::Kernel::Clock::now() - start);
+        if (elapsed >= HANDSHAKE_TIMEOUT) {
+            break;
+        }
+
+        pollfh fhs;
+        fhs.fh = &_fh;
+        fhs.events = POLLIN;
+        int count = poll(&fhs, 1, (HANDSHAKE_TIMEOUT - elapsed).count());
+        if (count <= 0) {
+            break;
+        }
+        if (fhs.revents & POLLIN) {
+            _rx_mutex.lock();
+            bool progress = read_and_parse();
+            _rx_mutex.unlock();
+            dispatch_sigio();
+            if (!progress) {
+                break;
+            }
+        }
+    }
+
+    _response_dlci = -1;
+    return (_response == RESP_UA) ? NSAPI_ERROR_OK : NSAPI_ERROR_DEVICE_ERROR;
+}
+
+nsapi_error_t CellularMux::write_frame(int dlci, uint8_t control, const uint8_t *data, size_t len)
+{
+    if (len > MBED_CONF_CELLULAR_CMUX_FRAME_SIZE) {
+        return NSAPI_ERROR_PARAMETER;
+    }
+
+    uint8_t base_control = control & ~CONTROL_PF;
+    // we are the initiator: commands carry C/R set, responses carry it clear
+    bool response = (base_control == CONTROL_UA) || (base_control == CONTROL_DM);
+
+    uint8_t header[4];
+    header[0] = CMUX_FLAG;
+    header[1] = (dlci << 2) | 0x01 | (response ? 0x00 : 0x02);
+    header[2] = control;
+    header[3] = (len << 1) | 0x01;
+
+    uint8_t fcs = fcs_add(FCS_INIT, header[1]);
+    fcs = fcs_add(fcs, header[2]);
+    fcs = fcs_add(fcs, header[3]);
+
+    uint8_t trailer[2];
+    trailer[0] = 0xFF - fcs; // FCS is transmitted as its ones' complement
+    trailer[1] = CMUX_FLAG;
+
+    _tx_mutex.lock();
+    nsapi_error_t err = fh_write_all(header, sizeof(header));
+    if (err == NSAPI_ERROR_OK && len > 0) {
+        err = fh_write_all(data, len);
+    }
+    if (err == NSAPI_ERROR_OK) {
+        err = fh_write_all(trailer, sizeof(trailer));
+    }
+    _tx_mutex.unlock();
+
+    return err;
+}
+
+nsapi_error_t CellularMux::fh_write_all(const uint8_t *data, size_t len)
+{
+    while (len > 0) {
+        pollfh fhs;
+        fhs.fh = &_fh;
+        fhs.events = POLLOUT;
+        int count = poll(&fhs, 1, HANDSHAKE_TIMEOUT.count());
+        if (count <= 0 || !(fhs.revents & POLLOUT)) {
+            tr_error("CMUX write timeout");
+            return NSAPI_ERROR_DEVICE_ERROR;
+        }
+        ssize_t ret = _fh.write(data, len);
+        if (ret < 0) {
+            tr_error("CMUX write failed (%d)", (int)ret);
+            return NSAPI_ERROR_DEVICE_ERROR;
+        }
+        data += ret;
+        len -= ret;
+    }
+    return NSAPI_ERROR_OK;
+}
+
+void CellularMux::send_msc(int dlci, bool flow_stop, bool command)
+{
+    uint8_t msg[4];
+    msg[0] = command ? TYPE_MSC_COMMAND : TYPE_MSC_RESPONSE;
+    msg[1] = (2 << 1) | 0x01;
+    msg[2] = (dlci << 2) | 0x03;
+    msg[3] = SIGNALS_READY | (flow_stop ? SIGNAL_FC : 0);
+    write_frame(0, CONTROL_UIH, msg, sizeof(msg));
+}
+
+uint8_t CellularMux::fcs_add(uint8_t fcs, uint8_t c)
+{
+    // reflected x^8 + x^2 + x + 1, as specified in TS 27.010 annex B
+    fcs ^= c;
+    for (int i = 0; i < 8; i++) {
+        fcs = (fcs & 0x01) ? ((fcs >> 1) ^ 0xE0) : (fcs >> 1);
+    }
+    return fcs;
+}
+
+// Channel
+
+CellularMux::Channel::Channel() :
+    _mux(NULL),
+    _dlci(-1),
+    _open(false),
+    _tx_blocked(false),
+    _rx_flow_stopped(false),
+    _rx_head(0),
+    _rx_count(0)
+{
+}
+
+ssize_t CellularMux::Channel::read(void *buffer, size_t size)
+{
+    if (!_open) {
+        return -EIO;
+    }
+
+    _mux->_rx_mutex.lock();
+    if (_rx_count == 0) {
+        _mux->_rx_mutex.unlock();
+        return -EAGAIN;
+    }
+
+    size_t n = (size < _rx_count) ? size : _rx_count;
+    size_t contiguous = sizeof(_rx_buffer) - _rx_head;
+    if (contiguous > n) {
+        contiguous = n;
+    }
+    memcpy(buffer, &_rx_buffer[_rx_head], contiguous);
+    if (n > contiguous) {
+        memcpy((uint8_t *)buffer + contiguous, &_rx_buffer[0], n - contiguous);
+    }
+    _rx_head = (_rx_head + n) % sizeof(_rx_buffer);
+    _rx_count -= n;
+
+    bool resume = _rx_flow_stopped && _rx_count <= RX_LOW_WATERMARK;
+    if (resume) {
+        _rx_flow_stopped = false;
+    }
+    _mux->_rx_mutex.unlock();
+
+    if (resume) {
+        _mux->send_msc(_dlci, false, true);
+    }
+    return n;
+}
+
+ssize_t CellularMux::Channel::write(const void *buffer, size_t size)
+{
+    if (!_open) {
+        return -EIO;
+    }
+
+    const uint8_t *data = (const uint8_t *)buffer;
+    size_t sent = 0;
+    while (sent < size) {
+        if (_tx_blocked) {
+            // peer flow controlled this channel only, report what went through
+            return sent ? (ssize_t)sent : -EAGAIN;
+        }
+        size_t chunk = size - sent;
+        if (chunk > MBED_CONF_CELLULAR_CMUX_FRAME_SIZE) {
+            chunk = MBED_CONF_CELLULAR_CMUX_FRAME_SIZE;
+        }
+        if (_mux->write_frame(_dlci, CONTROL_UIH, data + sent, chunk) != NSAPI_ERROR_OK) {
+            return sent ? (ssize_t)sent : -EIO;
+        }
+        sent += chunk;
+    }
+    return sent;
+}
+
+off_t CellularMux::Channel::seek(off_t offset, int whence)
+{
+    return -ESPIPE;
+}
+
+int CellularMux::Channel::close()
+{
+    if (_open && _mux) {
+        _mux->request_response(_dlci, CONTROL_DISC);
+        _open = false;
+    }
+    return 0;
+}
+
+int CellularMux::Channel::isatty()
+{
+    return 1;
+}
+
+short CellularMux::Channel::poll(short events) const
+{
+    short revents = 0;
+    if ((events & POLLIN) && _rx_count > 0) {
+        revents |= POLLIN;
+    }
+    if ((events & POLLOUT) && _open && !_tx_blocked) {
+        revents |= POLLOUT;
+    }
+    return revents;
+}
+
+void CellularMux::Channel::sigio(Callback<void()> func)
+{
+    _sigio_cb = func;
+    if (_sigio_cb && _rx_count > 0) {
+        _sigio_cb();
+    }
+}
+
+int CellularMux::Channel::set_blocking(bool blocking)
+{
+    return blocking ? -EINVAL : 0;
+}
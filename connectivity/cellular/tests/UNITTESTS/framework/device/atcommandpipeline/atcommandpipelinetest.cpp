@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2021, Arm Limited and affiliates.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "gtest/gtest.h"
+#include <string.h>
+#include "events/EventQueue.h"
+#include "ATHandler.h"
+#include "ATCommandPipeline.h"
+#include "FileHandle_stub.h"
+#include "CellularLog.h"
+#include "mbed_poll_stub.h"
+
+using namespace mbed;
+using namespace events;
+using namespace std::chrono;
+
+class TestATCommandPipeline : public testing::Test {
+protected:
+
+    void SetUp()
+    {
+        filehandle_stub_table = NULL;
+        filehandle_stub_table_pos = 0;
+        filehandle_stub_short_value_counter = 0;
+        mbed_poll_stub::int_value = 0;
+        mbed_poll_stub::revents_value = 0;
+    }
+
+    void TearDown()
+    {
+    }
+};
+
+TEST_F(TestATCommandPipeline, Create)
+{
+    EventQueue que;
+    FileHandle_stub fh1;
+    ATHandler at(&fh1, que, 0, ",");
+
+    ATCommandPipeline *pipeline = new ATCommandPipeline(at, que);
+
+    EXPECT_TRUE(pipeline != NULL);
+    EXPECT_EQ(0, pipeline->pending_count());
+    EXPECT_TRUE(pipeline->wait_all(milliseconds(0)));
+    delete pipeline;
+}
+
+TEST_F(TestATCommandPipeline, test_ATCommandPipeline_post_invalid)
+{
+    EventQueue que;
+    FileHandle_stub fh1;
+    ATHandler at(&fh1, que, 0, ",");
+    ATCommandPipeline pipeline(at, que);
+
+    // byte strings cannot be buffered in the command line
+    uint8_t byte[] = {1, 2, 3, 4};
+    EXPECT_EQ(NSAPI_ERROR_PARAMETER, pipeline.post("+CMGS", "=", nullptr, nullptr, "%b", byte, 4));
+
+    // command does not fit ATHandler's response prefix buffer
+    char long_cmd[2 * MBED_CONF_CELLULAR_AT_HANDLER_BUFFER_SIZE];
+    memset(long_cmd, 'A', sizeof(long_cmd) - 1);
+    long_cmd[sizeof(long_cmd) - 1] = '\0';
+    EXPECT_EQ(NSAPI_ERROR_PARAMETER, pipeline.post(long_cmd, ""));
+
+    EXPECT_EQ(0, pipeline.pending_count());
+}
+
+TEST_F(TestATCommandPipeline, test_ATCommandPipeline_complete_ok)
+{
+    EventQueue que;
+    FileHandle_stub fh1;
+    ATHandler at(&fh1, que, 0, ",");
+    ATCommandPipeline pipeline(at, que);
+    que.dispatch(0); // drain the oob event queued on filehandle attach
+
+    char table[] = "OK\r\n\0";
+    filehandle_stub_table = table;
+    filehandle_stub_table_pos = 0;
+    mbed_poll_stub::int_value = 1;
+    mbed_poll_stub::revents_value = POLLIN | POLLOUT;
+    fh1.size_value = 8;
+
+    int completed_id = 0;
+    nsapi_error_t completed_err = NSAPI_ERROR_DEVICE_ERROR;
+    int id = pipeline.post("+CFUN", "=", [&](int cmd_id, nsapi_error_t err) {
+        completed_id = cmd_id;
+        completed_err = err;
+    }, nullptr, "%d", 1);
+    EXPECT_TRUE(id > 0);
+    EXPECT_EQ(1, pipeline.pending_count());
+
+    que.dispatch(0);
+
+    EXPECT_EQ(id, completed_id);
+    EXPECT_EQ(NSAPI_ERROR_OK, completed_err);
+    EXPECT_EQ(0, pipeline.pending_count());
+    EXPECT_TRUE(pipeline.wait_all(milliseconds(0)));
+}
+
+TEST_F(TestATCommandPipeline, test_ATCommandPipeline_response_callback)
+{
+    EventQueue que;
+    FileHandle_stub fh1;
+    ATHandler at(&fh1, que, 0, ",");
+    ATCommandPipeline pipeline(at, que);
+    que.dispatch(0);
+
+    char table[] = "+CSQ: 3,5\r\nOK\r\n\0";
+    filehandle_stub_table = table;
+    filehandle_stub_table_pos = 0;
+    mbed_poll_stub::int_value = 1;
+    mbed_poll_stub::revents_value = POLLIN | POLLOUT;
+    fh1.size_value = 8;
+
+    int32_t rssi = -1;
+    nsapi_error_t completed_err = NSAPI_ERROR_DEVICE_ERROR;
+    pipeline.post("+CSQ", "", [&](int, nsapi_error_t err) {
+        completed_err = err;
+    }, [&](ATHandler &handler) {
+        rssi = handler.read_int();
+    });
+
+    que.dispatch(0);
+
+    EXPECT_EQ(3, rssi);
+    EXPECT_EQ(NSAPI_ERROR_OK, completed_err);
+}
+
+TEST_F(TestATCommandPipeline, test_ATCommandPipeline_complete_device_error)
+{
+    EventQueue que;
+    FileHandle_stub fh1;
+    ATHandler at(&fh1, que, 0, ",");
+    ATCommandPipeline pipeline(at, que);
+    que.dispatch(0);
+
+    // write fails as the filehandle accepts no data
+    nsapi_error_t completed_err = NSAPI_ERROR_OK;
+    pipeline.post("+CFUN", "=", [&](int, nsapi_error_t err) {
+        completed_err = err;
+    }, nullptr, "%d", 1);
+
+    que.dispatch(0);
+
+    EXPECT_EQ(NSAPI_ERROR_DEVICE_ERROR, completed_err);
+}
+
+TEST_F(TestATCommandPipeline, test_ATCommandPipeline_cancel_pending)
+{
+    EventQueue que;
+    FileHandle_stub fh1;
+    ATHandler at(&fh1, que, 0, ",");
+    ATCommandPipeline pipeline(at, que);
+    que.dispatch(0);
+
+    bool completed = false;
+    pipeline.post("+CMD1", "", [&](int, nsapi_error_t) {
+        completed = true;
+    });
+    pipeline.post("+CMD2", "", [&](int, nsapi_error_t) {
+        completed = true;
+    });
+    EXPECT_EQ(2, pipeline.pending_count());
+
+    pipeline.cancel_pending();
+    que.dispatch(0);
+
+    EXPECT_FALSE(completed);
+    EXPECT_EQ(0, pipeline.pending_count());
+}
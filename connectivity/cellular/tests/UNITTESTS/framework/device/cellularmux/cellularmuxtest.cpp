@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2021, Arm Limited and affiliates.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "gtest/gtest.h"
+#include <string.h>
+#include "events/EventQueue.h"
+#include "CellularMux.h"
+#include "FileHandle_stub.h"
+#include "CellularLog.h"
+#include "mbed_poll_stub.h"
+
+using namespace mbed;
+using namespace events;
+
+// canned 27.010 frames from the modem (FCS precomputed)
+static char frame_ua_dlci0[] = "\xF9\x03\x73\x01\xD7\xF9";
+static char frame_dm_dlci0[] = "\xF9\x03\x1F\x01\x36\xF9";
+static char frame_ua_dlci1[] = "\xF9\x07\x73\x01\x15\xF9";
+static char frame_uih_dlci1_hi[] = "\xF9\x05\xEF\x05hi\x51\xF9";
+
+static int sigio_count = 0;
+static void channel_sigio()
+{
+    sigio_count++;
+}
+
+class TestCellularMux : public testing::Test {
+protected:
+
+    void SetUp()
+    {
+        filehandle_stub_table = NULL;
+        filehandle_stub_table_pos = 0;
+        filehandle_stub_short_value_counter = 0;
+        mbed_poll_stub::int_value = 0;
+        mbed_poll_stub::revents_value = 0;
+        sigio_count = 0;
+    }
+
+    void TearDown()
+    {
+    }
+
+    void set_modem_response(char *frame)
+    {
+        filehandle_stub_table = frame;
+        filehandle_stub_table_pos = 0;
+    }
+};
+
+TEST_F(TestCellularMux, Create)
+{
+    EventQueue que;
+    FileHandle_stub fh1;
+
+    CellularMux *mux = new CellularMux(fh1, que);
+
+    EXPECT_TRUE(mux != NULL);
+    // channels cannot be opened before start
+    EXPECT_TRUE(mux->open_channel(1) == NULL);
+    delete mux;
+}
+
+TEST_F(TestCellularMux, test_CellularMux_start_no_response)
+{
+    EventQueue que;
+    FileHandle_stub fh1;
+    CellularMux mux(fh1, que);
+
+    fh1.size_value = 100;
+    mbed_poll_stub::int_value = 1;
+    mbed_poll_stub::revents_value = POLLIN | POLLOUT;
+
+    EXPECT_EQ(NSAPI_ERROR_DEVICE_ERROR, mux.start());
+}
+
+TEST_F(TestCellularMux, test_CellularMux_start_rejected)
+{
+    EventQueue que;
+    FileHandle_stub fh1;
+    CellularMux mux(fh1, que);
+
+    fh1.size_value = 100;
+    mbed_poll_stub::int_value = 1;
+    mbed_poll_stub::revents_value = POLLIN | POLLOUT;
+    set_modem_response(frame_dm_dlci0);
+
+    EXPECT_EQ(NSAPI_ERROR_DEVICE_ERROR, mux.start());
+}
+
+TEST_F(TestCellularMux, test_CellularMux_channel)
+{
+    EventQueue que;
+    FileHandle_stub fh1;
+    CellularMux mux(fh1, que);
+
+    fh1.size_value = 100;
+    mbed_poll_stub::int_value = 1;
+    mbed_poll_stub::revents_value = POLLIN | POLLOUT;
+
+    set_modem_response(frame_ua_dlci0);
+    EXPECT_EQ(NSAPI_ERROR_OK, mux.start());
+    EXPECT_EQ(NSAPI_ERROR_OK, mux.start()); // idempotent
+
+    // control channel and out of range DLCIs are not available
+    EXPECT_TRUE(mux.open_channel(0) == NULL);
+    EXPECT_TRUE(mux.open_channel(4) == NULL);
+
+    set_modem_response(frame_ua_dlci1);
+    FileHandle *ch = mux.open_channel(1);
+    ASSERT_TRUE(ch != NULL);
+    EXPECT_TRUE(mux.open_channel(1) == ch);
+
+    char buf[8];
+    EXPECT_EQ(-EAGAIN, ch->read(buf, sizeof(buf)));
+    EXPECT_EQ(6, ch->write("ATI\r\n\0", 6));
+
+    // data frame from the modem is parsed on the event queue and
+    // delivered through the channel
+    ch->sigio(callback(channel_sigio));
+    set_modem_response(frame_uih_dlci1_hi);
+    que.dispatch(0);
+    EXPECT_EQ(1, sigio_count);
+    EXPECT_EQ(2, ch->read(buf, sizeof(buf)));
+    EXPECT_EQ(0, memcmp(buf, "hi", 2));
+    EXPECT_EQ(-EAGAIN, ch->read(buf, sizeof(buf)));
+}
@@ -254,6 +254,11 @@ void QUECTEL_BG96_CellularStack::urc_qiurc(urc_type_t urc_type)
             tr_info("Socket closed %d", sock_id);
             sock->closed = true;
         }
+#if MBED_CONF_CELLULAR_RX_PREFETCH_BUFFER_SIZE
+        if (urc_type == URC_RECV) {
+            schedule_rx_prefetch(sock_id);
+        }
+#endif
         if (sock->_cb) {
             sock->_cb(sock->_data);
         }
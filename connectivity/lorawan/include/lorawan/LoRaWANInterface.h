@@ -518,6 +518,22 @@ public:
      */
     lorawan_status_t get_backoff_metadata(int &backoff);
 
+    /** Get hold of the maximum possible uplink payload size
+     *
+     * The size depends on the current (or ADR selected) data rate of the
+     * region in use and shrinks when MAC commands are scheduled for piggybacking
+     * on the next uplink. Applications packing multiple readings into a single
+     * message can use this API to learn how much payload fits into one frame.
+     *
+     * @param    size       the inbound variable that will carry the maximum
+     *                      payload size in bytes if it is available.
+     *
+     * @return              LORAWAN_STATUS_OK if the size is available,
+     *                      otherwise a negative error code if request failed:
+     *                      LORAWAN_STATUS_NOT_INITIALIZED if system is not initialized with initialize()
+     */
+    lorawan_status_t get_max_payload_size(uint8_t &size);
+
     /** Cancel outgoing transmission
      *
      * This API is used to cancel any outstanding transmission in the TX pipe.
@@ -374,6 +374,22 @@ public:
      */
     lorawan_status_t acquire_backoff_metadata(int &backoff);
 
+    /** Acquire the maximum possible uplink payload size
+     *
+     * Queries the MAC for the biggest FRMPayload that can go out with the
+     * next uplink. Scheduled MAC commands and the current (or ADR selected)
+     * data rate are taken into account, and the result is capped to the
+     * "lora.tx-max-size" configuration.
+     *
+     * @param    size        A reference to the inbound variable which will be
+     *                       filled with the maximum payload size.
+     *
+     * @return               LORAWAN_STATUS_OK if successful,
+     *                       LORAWAN_STATUS_NOT_INITIALIZED if the stack is
+     *                       not initialized yet
+     */
+    lorawan_status_t get_max_possible_tx_size(uint8_t &size);
+
     /** Stops sending
      *
      * Stop sending any outstanding messages if they are not yet queued for
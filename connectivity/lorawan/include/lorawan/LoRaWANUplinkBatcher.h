@@ -0,0 +1,203 @@
+/**
+ * Copyright (c) 2017, Arm Limited and affiliates.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @addtogroup LoRaWAN
+ * Mbed OS LoRaWAN Stack
+ *  @{
+ */
+
+#ifndef LORAWANUPLINKBATCHER_H_
+#define LORAWANUPLINKBATCHER_H_
+
+#include "platform/Callback.h"
+#include "platform/ScopedLock.h"
+#include "events/EventQueue.h"
+#include "LoRaWANInterface.h"
+#include "lorawan_types.h"
+
+/**
+ * Maximum number of readings the batcher keeps track of at a time. This
+ * covers both the readings waiting in the packing buffer and the readings
+ * handed to the MAC which are awaiting their TX event.
+ */
+#ifndef MBED_CONF_LORA_UPLINK_BATCH_MAX_READINGS
+#define MBED_CONF_LORA_UPLINK_BATCH_MAX_READINGS    16
+#endif
+
+/**
+ * Size of the packing buffer in bytes. One batch never exceeds the maximum
+ * payload of the current data rate, so there is no point in making this
+ * larger than "lora.tx-max-size".
+ */
+#ifndef MBED_CONF_LORA_UPLINK_BATCH_BUFFER_SIZE
+#define MBED_CONF_LORA_UPLINK_BATCH_BUFFER_SIZE     MBED_CONF_LORA_TX_MAX_SIZE
+#endif
+
+/**
+ * Default deadline in milliseconds. A partially filled batch is transmitted
+ * when the oldest queued reading has waited this long.
+ */
+#ifndef MBED_CONF_LORA_UPLINK_BATCH_DEADLINE
+#define MBED_CONF_LORA_UPLINK_BATCH_DEADLINE        60000
+#endif
+
+/** LoRaWANUplinkBatcher Class
+ *
+ * An uplink batching service on top of LoRaWANInterface.
+ *
+ * Applications producing small periodic readings can queue them here instead
+ * of calling send() directly. The readings are packed back to back into a
+ * single uplink which goes out when the maximum payload of the current
+ * (or ADR selected) data rate is filled, or when the oldest reading has
+ * waited for the configured deadline. Sharing the LoRaWAN header between
+ * readings multiplies the application payload carried per duty-cycle window,
+ * which matters most at the slow spreading factors where the airtime of a
+ * frame is dominated by the overhead.
+ *
+ * The batcher does not own the TX event plumbing. The application must
+ * forward TX_DONE, TX_TIMEOUT, TX_ERROR, CRYPTO_ERROR and
+ * TX_SCHEDULING_ERROR events from its 'lorawan_events' handler to
+ * handle_event(), which is how per-reading delivery status callbacks get
+ * reported. While readings are queued here, the application should not
+ * transmit on its own, otherwise the TX events of the two paths cannot
+ * be told apart.
+ */
+class LoRaWANUplinkBatcher {
+
+public:
+
+    /** Constructs an uplink batcher on top of the given interface.
+     *
+     * @param lorawan A reference to a connected LoRaWANInterface object
+     */
+    LoRaWANUplinkBatcher(LoRaWANInterface &lorawan);
+
+    ~LoRaWANUplinkBatcher();
+
+    /** Initialize the batching service.
+     *
+     * You must call this before queuing readings.
+     *
+     * @param queue     A pointer to EventQueue provided by the application.
+     *                  The deadline timer runs on this queue, so it should be
+     *                  the queue the application dispatches anyway.
+     * @param port      The application port number used for the batched uplinks.
+     * @param flags     Message flags for the batched uplinks, for example
+     *                  MSG_UNCONFIRMED_FLAG or MSG_CONFIRMED_FLAG.
+     * @param deadline  Deadline in milliseconds after which a partially filled
+     *                  batch is transmitted.
+     *
+     * @return          LORAWAN_STATUS_OK on success, or
+     *                  LORAWAN_STATUS_PARAMETER_INVALID if a NULL queue is given.
+     */
+    lorawan_status_t initialize(events::EventQueue *queue, uint8_t port,
+                                int flags = MSG_UNCONFIRMED_FLAG,
+                                uint32_t deadline = MBED_CONF_LORA_UPLINK_BATCH_DEADLINE);
+
+    /** Queue a reading for batched transmission.
+     *
+     * The data is copied into the packing buffer, so the caller may reuse
+     * its buffer immediately. If the buffer reaches the maximum payload of
+     * the current data rate, the batch is transmitted right away. Otherwise
+     * the deadline timer is started with the first queued reading.
+     *
+     * @param data      A pointer to the reading being queued.
+     * @param length    The size of the reading in bytes.
+     * @param status_cb Optional per-reading delivery status callback. Called
+     *                  with the identifier returned here and the TX event the
+     *                  carrying uplink ended with, for example TX_DONE.
+     *
+     * @return          A non-negative reading identifier, or a negative error code:
+     *                  LORAWAN_STATUS_NOT_INITIALIZED   if initialize() was not called,
+     *                  LORAWAN_STATUS_PARAMETER_INVALID if a NULL data pointer or zero length is given,
+     *                  LORAWAN_STATUS_LENGTH_ERROR      if the reading cannot ever fit the packing buffer,
+     *                  LORAWAN_STATUS_WOULD_BLOCK       if the buffer is full and cannot be drained yet.
+     */
+    int32_t queue_reading(const uint8_t *data, uint16_t length,
+                          mbed::Callback<void(int32_t, lorawan_event_t)> status_cb = nullptr);
+
+    /** Transmit the queued readings without waiting for the deadline.
+     *
+     * @return          LORAWAN_STATUS_OK if a batch was handed to the MAC,
+     *                  LORAWAN_STATUS_NO_OP if there was nothing to send,
+     *                  LORAWAN_STATUS_WOULD_BLOCK if a batch is already in
+     *                  the air or the MAC is busy, or a negative error code
+     *                  on failure.
+     */
+    lorawan_status_t flush();
+
+    /** Forward a TX event from the application event handler.
+     *
+     * On TX_DONE the delivery status callbacks of the readings carried by
+     * the uplink are called, and the next batch is scheduled if the packing
+     * buffer warrants it. TX error events are reported to the same callbacks.
+     *
+     * @param event     The event received in the 'lorawan_events' callback.
+     */
+    void handle_event(lorawan_event_t event);
+
+    /** Number of readings queued or awaiting their TX event.
+     *
+     * @return          Count of readings accepted by queue_reading() whose
+     *                  delivery status has not been reported yet.
+     */
+    uint8_t pending_readings();
+
+private:
+    /** ScopedLock object
+     *
+     * RAII style exclusive access, shared with the underlying stack
+     */
+    typedef mbed::ScopedLock<LoRaWANInterface> Lock;
+
+    /** Book-keeping for one queued reading
+     */
+    typedef struct {
+        int32_t id;
+        uint16_t length;
+        mbed::Callback<void(int32_t, lorawan_event_t)> status_cb;
+    } reading_t;
+
+    lorawan_status_t send_batch();
+    void maybe_send();
+    void complete_in_flight(lorawan_event_t event);
+    void arm_deadline();
+    void cancel_deadline();
+    void deadline_expired();
+
+    LoRaWANInterface &_lorawan;
+    events::EventQueue *_queue;
+
+    /** Packing buffer holding the queued readings back to back.
+     * In-flight readings are removed at hand-over, the MAC keeps its own copy.
+     */
+    uint8_t _buffer[MBED_CONF_LORA_UPLINK_BATCH_BUFFER_SIZE];
+    reading_t _readings[MBED_CONF_LORA_UPLINK_BATCH_MAX_READINGS];
+
+    uint16_t _buffered;
+    uint8_t _count;
+    uint8_t _in_flight;
+    int32_t _next_id;
+    int _deadline_id;
+    uint32_t _deadline_ms;
+    uint8_t _port;
+    int _flags;
+    bool _initialized;
+};
+
+#endif /* LORAWANUPLINKBATCHER_H_ */
+/** @}*/
@@ -1425,7 +1425,7 @@ void LoRaMac::set_device_class(const device_class_t &device_class,
             _lora_time.clear(_rx2_closure_timer_for_class_c);
         }
         _rx2_would_be_closure_for_class_c();
-    });
+    }, true);
 
     if (CLASS_A == _device_class) {
         tr_debug("Changing device class to -> CLASS_A");
@@ -1824,14 +1824,14 @@ lorawan_status_t LoRaMac::initialize(EventQueue *queue,
             _lora_time.clear(_params.timers.rx_window1_timer);
         }
         open_rx1_window();
-    });
+    }, true);
     _lora_time.init(_params.timers.rx_window2_timer, [this] {
         {
             Lock lock(*this);
             _lora_time.clear(_params.timers.rx_window2_timer);
         }
         open_rx2_window();
-    });
+    }, true);
     _lora_time.init(_params.timers.ack_timeout_timer, [this] {
         {
             Lock lock(*this);
@@ -1871,6 +1871,12 @@ void LoRaMac::disconnect()
     reset_mcps_indication();
 }
 
+uint8_t LoRaMac::get_max_possible_tx_size(void)
+{
+    return get_max_possible_tx_size(_mac_commands.get_mac_cmd_length()
+                                    + _mac_commands.get_repeat_commands_length());
+}
+
 uint8_t LoRaMac::get_max_possible_tx_size(uint8_t fopts_len)
 {
     uint8_t max_possible_payload_size = 0;
@@ -289,6 +289,15 @@ public:
      */
     lorawan_status_t send_ongoing_tx(void);
 
+    /**
+     * @brief   Queries the maximum possible FRMPayload size for the next
+     *          uplink, taking the currently scheduled MAC commands and the
+     *          current (or ADR selected) data rate into account.
+     *
+     * @return  Size of the biggest payload that can be sent next.
+     */
+    uint8_t get_max_possible_tx_size(void);
+
     /**
      * @brief device_class Returns active device class
      * @return Device class in use.
@@ -155,6 +155,12 @@ lorawan_status_t LoRaWANInterface::get_rx_metadata(lorawan_rx_metadata &metadata
     return _lw_stack.acquire_rx_metadata(metadata);
 }
 
+lorawan_status_t LoRaWANInterface::get_max_payload_size(uint8_t &size)
+{
+    Lock lock(*this);
+    return _lw_stack.get_max_possible_tx_size(size);
+}
+
 lorawan_status_t LoRaWANInterface::get_backoff_metadata(int &backoff)
 {
     Lock lock(*this);
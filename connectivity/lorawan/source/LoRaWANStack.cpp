@@ -505,6 +505,22 @@ lorawan_status_t LoRaWANStack::acquire_backoff_metadata(int &backoff)
     return LORAWAN_STATUS_METADATA_NOT_AVAILABLE;
 }
 
+lorawan_status_t LoRaWANStack::get_max_possible_tx_size(uint8_t &size)
+{
+    if (DEVICE_STATE_NOT_INITIALIZED == _device_current_state) {
+        return LORAWAN_STATUS_NOT_INITIALIZED;
+    }
+
+    uint8_t max_possible_size = _loramac.get_max_possible_tx_size();
+
+    if (max_possible_size > MBED_CONF_LORA_TX_MAX_SIZE) {
+        max_possible_size = MBED_CONF_LORA_TX_MAX_SIZE;
+    }
+
+    size = max_possible_size;
+    return LORAWAN_STATUS_OK;
+}
+
 /*****************************************************************************
  * Interrupt handlers                                                        *
  ****************************************************************************/
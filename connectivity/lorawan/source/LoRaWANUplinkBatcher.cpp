@@ -0,0 +1,320 @@
+/**
+ * @file
+ *
+ * @brief      An uplink batching service for LoRaWAN
+ *
+ * Copyright (c) 2017, Arm Limited and affiliates.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string.h>
+
+#include "LoRaWANUplinkBatcher.h"
+#include "mbed-trace/mbed_trace.h"
+#define TRACE_GROUP "LSTK"
+
+using namespace mbed;
+using namespace events;
+using namespace std::chrono;
+
+LoRaWANUplinkBatcher::LoRaWANUplinkBatcher(LoRaWANInterface &lorawan)
+    : _lorawan(lorawan),
+      _queue(NULL),
+      _buffered(0),
+      _count(0),
+      _in_flight(0),
+      _next_id(0),
+      _deadline_id(0),
+      _deadline_ms(MBED_CONF_LORA_UPLINK_BATCH_DEADLINE),
+      _port(0),
+      _flags(MSG_UNCONFIRMED_FLAG),
+      _initialized(false)
+{
+}
+
+LoRaWANUplinkBatcher::~LoRaWANUplinkBatcher()
+{
+    if (_initialized) {
+        cancel_deadline();
+    }
+}
+
+lorawan_status_t LoRaWANUplinkBatcher::initialize(EventQueue *queue, uint8_t port,
+                                                  int flags, uint32_t deadline)
+{
+    if (!queue) {
+        return LORAWAN_STATUS_PARAMETER_INVALID;
+    }
+
+    _queue = queue;
+    _port = port;
+    _flags = flags;
+    _deadline_ms = deadline;
+    _buffered = 0;
+    _count = 0;
+    _in_flight = 0;
+    _next_id = 0;
+    _deadline_id = 0;
+    _initialized = true;
+
+    return LORAWAN_STATUS_OK;
+}
+
+int32_t LoRaWANUplinkBatcher::queue_reading(const uint8_t *data, uint16_t length,
+                                            mbed::Callback<void(int32_t, lorawan_event_t)> status_cb)
+{
+    Lock lock(_lorawan);
+
+    if (!_initialized) {
+        return LORAWAN_STATUS_NOT_INITIALIZED;
+    }
+
+    if (!data || length == 0) {
+        return LORAWAN_STATUS_PARAMETER_INVALID;
+    }
+
+    if (length > MBED_CONF_LORA_UPLINK_BATCH_BUFFER_SIZE) {
+        return LORAWAN_STATUS_LENGTH_ERROR;
+    }
+
+    if (_count == MBED_CONF_LORA_UPLINK_BATCH_MAX_READINGS
+            || _buffered + length > MBED_CONF_LORA_UPLINK_BATCH_BUFFER_SIZE) {
+        // try to make room by pushing out what has accumulated so far
+        send_batch();
+        if (_count == MBED_CONF_LORA_UPLINK_BATCH_MAX_READINGS
+                || _buffered + length > MBED_CONF_LORA_UPLINK_BATCH_BUFFER_SIZE) {
+            return LORAWAN_STATUS_WOULD_BLOCK;
+        }
+    }
+
+    memcpy(_buffer + _buffered, data, length);
+
+    reading_t &entry = _readings[_count];
+    entry.id = _next_id++;
+    entry.length = length;
+    entry.status_cb = status_cb;
+
+    if (_next_id < 0) {
+        _next_id = 0;
+    }
+
+    _buffered += length;
+    _count++;
+
+    const int32_t id = entry.id;
+
+    uint8_t max_payload;
+    if (_lorawan.get_max_payload_size(max_payload) == LORAWAN_STATUS_OK
+            && _buffered >= max_payload) {
+        send_batch();
+    } else {
+        arm_deadline();
+    }
+
+    return id;
+}
+
+lorawan_status_t LoRaWANUplinkBatcher::flush()
+{
+    Lock lock(_lorawan);
+
+    if (!_initialized) {
+        return LORAWAN_STATUS_NOT_INITIALIZED;
+    }
+
+    return send_batch();
+}
+
+void LoRaWANUplinkBatcher::handle_event(lorawan_event_t event)
+{
+    Lock lock(_lorawan);
+
+    if (!_initialized) {
+        return;
+    }
+
+    switch (event) {
+        case TX_DONE:
+        case TX_TIMEOUT:
+        case TX_ERROR:
+        case CRYPTO_ERROR:
+        case TX_SCHEDULING_ERROR:
+            complete_in_flight(event);
+            maybe_send();
+            break;
+
+        default:
+            break;
+    }
+}
+
+uint8_t LoRaWANUplinkBatcher::pending_readings()
+{
+    Lock lock(_lorawan);
+    return _count;
+}
+
+lorawan_status_t LoRaWANUplinkBatcher::send_batch()
+{
+    if (_in_flight > 0) {
+        // the previous batch is still awaiting its TX event
+        return LORAWAN_STATUS_WOULD_BLOCK;
+    }
+
+    if (_count == 0) {
+        cancel_deadline();
+        return LORAWAN_STATUS_NO_OP;
+    }
+
+    uint16_t to_send = _buffered;
+    uint8_t max_payload;
+
+    if (_lorawan.get_max_payload_size(max_payload) == LORAWAN_STATUS_OK
+            && to_send > max_payload) {
+        // pack only whole readings up to the data rate limit so that no
+        // reading gets split across two uplinks
+        to_send = 0;
+        uint8_t readings = 0;
+        while (readings < _count
+                && to_send + _readings[readings].length <= max_payload) {
+            to_send += _readings[readings].length;
+            readings++;
+        }
+        if (to_send == 0) {
+            // the first reading alone exceeds the current limit; offer it
+            // anyway, the MAC truncates it and the delivery is reported
+            // as failed below
+            to_send = _readings[0].length;
+        }
+    }
+
+    const int16_t ret = _lorawan.send(_port, _buffer, to_send, _flags);
+
+    if (ret == LORAWAN_STATUS_WOULD_BLOCK) {
+        // MAC is busy, retried on the next TX event or deadline
+        arm_deadline();
+        return LORAWAN_STATUS_WOULD_BLOCK;
+    }
+
+    if (ret < 0) {
+        // nothing was taken over, report the error to every queued reading
+        // and drop the batch
+        tr_error("Batch TX failed with %d", ret);
+        for (uint8_t i = 0; i < _count; i++) {
+            if (_readings[i].status_cb) {
+                _readings[i].status_cb(_readings[i].id, TX_ERROR);
+            }
+        }
+        _count = 0;
+        _buffered = 0;
+        cancel_deadline();
+        return (lorawan_status_t) ret;
+    }
+
+    const uint16_t accepted = ret;
+    uint16_t covered = 0;
+
+    // count the readings that were handed over wholly, they are reported
+    // with the TX event of this uplink
+    while (_in_flight < _count
+            && covered + _readings[_in_flight].length <= accepted) {
+        covered += _readings[_in_flight].length;
+        _in_flight++;
+    }
+
+    uint16_t consumed = covered;
+
+    if (covered < accepted && _in_flight < _count) {
+        // a reading got split at the payload boundary after all (MAC
+        // commands grabbed a piece of the payload): its head is in the air
+        // without its tail, so the delivery cannot succeed
+        reading_t &split = _readings[_in_flight];
+        consumed += split.length;
+        tr_error("Reading %d split at payload boundary, dropped", (int) split.id);
+        if (split.status_cb) {
+            split.status_cb(split.id, TX_ERROR);
+        }
+        for (uint8_t i = _in_flight; i + 1 < _count; i++) {
+            _readings[i] = _readings[i + 1];
+        }
+        _count--;
+    }
+
+    memmove(_buffer, _buffer + consumed, _buffered - consumed);
+    _buffered -= consumed;
+
+    cancel_deadline();
+    if (_count > _in_flight) {
+        arm_deadline();
+    }
+
+    return LORAWAN_STATUS_OK;
+}
+
+void LoRaWANUplinkBatcher::maybe_send()
+{
+    if (_count == _in_flight) {
+        return;
+    }
+
+    uint8_t max_payload;
+    if (_lorawan.get_max_payload_size(max_payload) == LORAWAN_STATUS_OK
+            && _buffered >= max_payload) {
+        send_batch();
+    } else {
+        arm_deadline();
+    }
+}
+
+void LoRaWANUplinkBatcher::complete_in_flight(lorawan_event_t event)
+{
+    for (uint8_t i = 0; i < _in_flight; i++) {
+        if (_readings[i].status_cb) {
+            _readings[i].status_cb(_readings[i].id, event);
+        }
+    }
+
+    for (uint8_t i = _in_flight; i < _count; i++) {
+        _readings[i - _in_flight] = _readings[i];
+    }
+
+    _count -= _in_flight;
+    _in_flight = 0;
+}
+
+void LoRaWANUplinkBatcher::arm_deadline()
+{
+    if (_deadline_id != 0) {
+        return;
+    }
+
+    _deadline_id = _queue->call_in(milliseconds(_deadline_ms),
+                                   mbed::callback(this, &LoRaWANUplinkBatcher::deadline_expired));
+}
+
+void LoRaWANUplinkBatcher::cancel_deadline()
+{
+    if (_deadline_id != 0) {
+        _queue->cancel(_deadline_id);
+        _deadline_id = 0;
+    }
+}
+
+void LoRaWANUplinkBatcher::deadline_expired()
+{
+    Lock lock(_lorawan);
+    _deadline_id = 0;
+    send_batch();
+}
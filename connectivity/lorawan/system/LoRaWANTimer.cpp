@@ -22,6 +22,16 @@ SPDX-License-Identifier: BSD-3-Clause
 
 using namespace std::chrono;
 
+#if MBED_CONF_LORA_DEDICATED_RX_TIMERS
+static void critical_timer_expiry(timer_event_t *obj)
+{
+    // Runs in the timeout interrupt: hand the callback to the event queue
+    // using the storage preallocated in init(); posting is irq safe and
+    // cannot fail for lack of queue memory
+    obj->event->try_call();
+}
+#endif
+
 LoRaWANTimeHandler::LoRaWANTimeHandler()
     : _queue(NULL)
 {
@@ -47,20 +57,50 @@ lorawan_time_t LoRaWANTimeHandler::get_elapsed_time(lorawan_time_t saved_time)
     return get_current_time() - saved_time;
 }
 
-void LoRaWANTimeHandler::init(timer_event_t &obj, mbed::Callback<void()> callback)
+void LoRaWANTimeHandler::init(timer_event_t &obj, mbed::Callback<void()> callback, bool critical)
 {
     obj.callback = callback;
     obj.timer_id = 0;
+#if MBED_CONF_LORA_DEDICATED_RX_TIMERS
+    obj.critical = critical;
+    if (critical && !obj.event) {
+        // Preallocated once here so posting from the timeout interrupt
+        // can never fail for lack of queue memory
+        obj.event = new events::UserAllocatedEvent<mbed::Callback<void()>, void()>(_queue, callback);
+        // RX window events must not wait behind bulk application work
+        obj.event->priority(EQUEUE_NUM_PRIORITIES - 1);
+    }
+#else
+    (void)critical;
+#endif
 }
 
 void LoRaWANTimeHandler::start(timer_event_t &obj, const uint32_t timeout)
 {
+#if MBED_CONF_LORA_DEDICATED_RX_TIMERS
+    if (obj.critical) {
+        // The hardware timeout expires on time regardless of how busy the
+        // event queue is
+        obj.timer_id = 1;
+        obj.timeout.attach(mbed::callback(critical_timer_expiry, &obj),
+                           milliseconds(timeout));
+        return;
+    }
+#endif
     obj.timer_id = _queue->call_in(milliseconds(timeout), obj.callback);
     MBED_ASSERT(obj.timer_id != 0);
 }
 
 void LoRaWANTimeHandler::stop(timer_event_t &obj)
 {
+#if MBED_CONF_LORA_DEDICATED_RX_TIMERS
+    if (obj.critical) {
+        obj.timeout.detach();
+        obj.event->cancel();
+        obj.timer_id = 0;
+        return;
+    }
+#endif
     _queue->cancel(obj.timer_id);
     obj.timer_id = 0;
 }
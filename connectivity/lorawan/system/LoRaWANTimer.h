@@ -60,8 +60,13 @@ public:
      *
      * @param [in] obj          The structure containing the timer object parameters.
      * @param [in] callback     The function callback called at the end of the timeout.
+     * @param [in] critical     Marks a radio-critical timer (RX window open/close).
+     *                          With MBED_CONF_LORA_DEDICATED_RX_TIMERS set, critical
+     *                          timers fire from a dedicated hardware timeout and are
+     *                          dispatched with preallocated storage ahead of
+     *                          application events; otherwise the flag is ignored.
      */
-    void init(timer_event_t &obj, mbed::Callback<void()> callback);
+    void init(timer_event_t &obj, mbed::Callback<void()> callback, bool critical = false);
 
     /** Starts and adds the timer object to the list of timer events.
      *
@@ -37,6 +37,23 @@
 #include <inttypes.h>
 #include "lorawan_types.h"
 
+/*!
+ * Set to 1 to drive radio-critical timers (RX window open/close) from a
+ * dedicated hardware timeout instead of the shared event queue timer.
+ * The timeout fires on time regardless of how busy the queue is, and its
+ * interrupt hands the callback over with preallocated, high-priority
+ * event storage, so RX window events are neither delayed by pending
+ * application timers nor lost to queue memory exhaustion.
+ */
+#ifndef MBED_CONF_LORA_DEDICATED_RX_TIMERS
+#define MBED_CONF_LORA_DEDICATED_RX_TIMERS 0
+#endif
+
+#if MBED_CONF_LORA_DEDICATED_RX_TIMERS
+#include "drivers/Timeout.h"
+#include "events/UserAllocatedEvent.h"
+#endif
+
 /*!
  * \brief Timer time variable definition
  */
@@ -1054,6 +1071,15 @@ typedef struct {
 typedef struct {
     mbed::Callback<void()> callback;
     int timer_id;
+#if MBED_CONF_LORA_DEDICATED_RX_TIMERS
+    /*!
+     * Set for radio-critical timers: expiry is driven by the hardware
+     * timeout below and posted with the preallocated event storage.
+     */
+    bool critical = false;
+    mbed::Timeout timeout;
+    events::UserAllocatedEvent<mbed::Callback<void()>, void()> *event = nullptr;
+#endif
 } timer_event_t;
 
 /*!
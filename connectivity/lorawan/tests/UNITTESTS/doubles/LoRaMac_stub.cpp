@@ -400,6 +400,11 @@ void LoRaMac::disconnect()
 {
 }
 
+uint8_t LoRaMac::get_max_possible_tx_size(void)
+{
+    return LoRaMac_stub::uint8_value;
+}
+
 uint8_t LoRaMac::get_max_possible_tx_size(uint8_t fopts_len)
 {
     return 0;
@@ -20,9 +20,15 @@
 
 #include "LoRaWANStack.h"
 
+#include "LoRaWANStack_stub.h"
+
 using namespace mbed;
 using namespace events;
 
+int16_t LoRaWANStack_stub::int16_value = 0;
+uint8_t LoRaWANStack_stub::uint8_value = 0;
+lorawan_status_t LoRaWANStack_stub::status_value = LORAWAN_STATUS_OK;
+
 /*****************************************************************************
  * Constructor                                                               *
  ****************************************************************************/
@@ -111,7 +117,7 @@ int16_t LoRaWANStack::handle_tx(const uint8_t port, const uint8_t *data,
                                 uint16_t length, uint8_t flags,
                                 bool null_allowed, bool allow_port_0)
 {
-    return 0;
+    return LoRaWANStack_stub::int16_value;
 }
 
 int16_t LoRaWANStack::handle_rx(uint8_t *data, uint16_t length, uint8_t &port, int &flags, bool validate_params)
@@ -153,6 +159,12 @@ lorawan_status_t LoRaWANStack::acquire_backoff_metadata(int &backoff)
     return LORAWAN_STATUS_OK;
 }
 
+lorawan_status_t LoRaWANStack::get_max_possible_tx_size(uint8_t &size)
+{
+    size = LoRaWANStack_stub::uint8_value;
+    return LoRaWANStack_stub::status_value;
+}
+
 /*****************************************************************************
  * Interrupt handlers                                                        *
  ****************************************************************************/
@@ -270,6 +270,12 @@ TEST_F(Test_LoRaWANInterface, get_backoff_metadata)
     EXPECT_TRUE(LORAWAN_STATUS_OK == object->get_backoff_metadata(i));
 }
 
+TEST_F(Test_LoRaWANInterface, get_max_payload_size)
+{
+    uint8_t size;
+    EXPECT_TRUE(LORAWAN_STATUS_OK == object->get_max_payload_size(size));
+}
+
 TEST_F(Test_LoRaWANInterface, cancel_sending)
 {
     EXPECT_TRUE(LORAWAN_STATUS_OK == object->cancel_sending());
@@ -0,0 +1,300 @@
+/*
+ * Copyright (c) 2018, Arm Limited and affiliates
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+#include "LoRaWANUplinkBatcher.h"
+
+#include "LoRaWANStack_stub.h"
+#include "equeue_stub.h"
+
+using namespace events;
+
+class my_radio : public LoRaRadio {
+public:
+
+    virtual void init_radio(radio_events_t *events)
+    {
+    };
+
+    virtual void radio_reset()
+    {
+    };
+
+    virtual void sleep(void)
+    {
+    };
+
+    virtual void standby(void)
+    {
+    };
+
+    virtual void set_rx_config(radio_modems_t modem, uint32_t bandwidth,
+                               uint32_t datarate, uint8_t coderate,
+                               uint32_t bandwidth_afc, uint16_t preamble_len,
+                               uint16_t symb_timeout, bool fix_len,
+                               uint8_t payload_len,
+                               bool crc_on, bool freq_hop_on, uint8_t hop_period,
+                               bool iq_inverted, bool rx_continuous)
+    {
+
+    };
+
+    virtual void set_tx_config(radio_modems_t modem, int8_t power, uint32_t fdev,
+                               uint32_t bandwidth, uint32_t datarate,
+                               uint8_t coderate, uint16_t preamble_len,
+                               bool fix_len, bool crc_on, bool freq_hop_on,
+                               uint8_t hop_period, bool iq_inverted, uint32_t timeout)
+    {
+    };
+
+    virtual void send(uint8_t *buffer, uint8_t size)
+    {
+    };
+
+    virtual void receive(void)
+    {
+    };
+
+    virtual void set_channel(uint32_t freq)
+    {
+    };
+
+    virtual uint32_t random(void)
+    {
+        return 4;
+    };
+
+    virtual uint8_t get_status(void)
+    {
+        return 0;
+    };
+
+    virtual void set_max_payload_length(radio_modems_t modem, uint8_t max)
+    {
+    };
+
+    virtual void set_public_network(bool enable)
+    {
+    };
+
+    virtual uint32_t time_on_air(radio_modems_t modem, uint8_t pkt_len)
+    {
+        return 0;
+    };
+
+    virtual bool perform_carrier_sense(radio_modems_t modem,
+                                       uint32_t freq,
+                                       int16_t rssi_threshold,
+                                       uint32_t max_carrier_sense_time)
+    {
+        return true;
+    };
+
+    virtual void start_cad(void)
+    {
+    };
+
+    virtual bool check_rf_frequency(uint32_t frequency)
+    {
+        return true;
+    };
+
+    virtual void set_tx_continuous_wave(uint32_t freq, int8_t power, uint16_t time)
+    {
+    };
+
+    virtual void lock(void)
+    {
+    };
+
+    virtual void unlock(void)
+    {
+    };
+};
+
+static int32_t cb_last_id = -1;
+static lorawan_event_t cb_last_event = CONNECTED;
+static int cb_count = 0;
+
+static void status_cb(int32_t id, lorawan_event_t event)
+{
+    cb_last_id = id;
+    cb_last_event = event;
+    cb_count++;
+}
+
+class Test_LoRaWANUplinkBatcher : public testing::Test {
+protected:
+    my_radio radio;
+    LoRaWANInterface *lorawan;
+    EventQueue *queue;
+    LoRaWANUplinkBatcher *object;
+
+    virtual void SetUp()
+    {
+        equeue_stub.void_ptr = NULL;
+        equeue_stub.call_cb_immediately = false;
+        LoRaWANStack_stub::int16_value = 0;
+        LoRaWANStack_stub::uint8_value = 51;
+        LoRaWANStack_stub::status_value = LORAWAN_STATUS_OK;
+        cb_last_id = -1;
+        cb_last_event = CONNECTED;
+        cb_count = 0;
+
+        lorawan = new LoRaWANInterface(radio);
+        queue = new EventQueue(3, NULL);
+        object = new LoRaWANUplinkBatcher(*lorawan);
+        object->initialize(queue, 15);
+    }
+
+    virtual void TearDown()
+    {
+        delete object;
+        delete queue;
+        delete lorawan;
+    }
+};
+
+TEST_F(Test_LoRaWANUplinkBatcher, constructor)
+{
+    EXPECT_TRUE(object);
+}
+
+TEST_F(Test_LoRaWANUplinkBatcher, initialize)
+{
+    EXPECT_TRUE(LORAWAN_STATUS_PARAMETER_INVALID == object->initialize(NULL, 15));
+    EXPECT_TRUE(LORAWAN_STATUS_OK == object->initialize(queue, 15));
+}
+
+TEST_F(Test_LoRaWANUplinkBatcher, queue_reading_not_initialized)
+{
+    LoRaWANUplinkBatcher batcher(*lorawan);
+    uint8_t data[20] = {0};
+    EXPECT_TRUE(LORAWAN_STATUS_NOT_INITIALIZED == batcher.queue_reading(data, sizeof(data)));
+}
+
+TEST_F(Test_LoRaWANUplinkBatcher, queue_reading_invalid_params)
+{
+    uint8_t data[20] = {0};
+    EXPECT_TRUE(LORAWAN_STATUS_PARAMETER_INVALID == object->queue_reading(NULL, 20));
+    EXPECT_TRUE(LORAWAN_STATUS_PARAMETER_INVALID == object->queue_reading(data, 0));
+    EXPECT_TRUE(LORAWAN_STATUS_LENGTH_ERROR == object->queue_reading(data, 300));
+}
+
+TEST_F(Test_LoRaWANUplinkBatcher, queue_reading_accumulates_below_max_payload)
+{
+    uint8_t data[20] = {0};
+
+    EXPECT_TRUE(0 == object->queue_reading(data, sizeof(data)));
+    EXPECT_TRUE(1 == object->queue_reading(data, sizeof(data)));
+    EXPECT_TRUE(2 == object->pending_readings());
+}
+
+TEST_F(Test_LoRaWANUplinkBatcher, batch_sent_when_max_payload_filled)
+{
+    uint8_t data[20] = {0};
+
+    // two whole readings fit into the 51 byte payload, the third fills the
+    // buffer past the limit and triggers the transmission
+    LoRaWANStack_stub::int16_value = 40;
+    object->queue_reading(data, sizeof(data), status_cb);
+    object->queue_reading(data, sizeof(data), status_cb);
+    object->queue_reading(data, sizeof(data), status_cb);
+    EXPECT_TRUE(3 == object->pending_readings());
+
+    // TX_DONE reports the two readings carried by the uplink
+    object->handle_event(TX_DONE);
+    EXPECT_TRUE(2 == cb_count);
+    EXPECT_TRUE(1 == cb_last_id);
+    EXPECT_TRUE(TX_DONE == cb_last_event);
+    EXPECT_TRUE(1 == object->pending_readings());
+}
+
+TEST_F(Test_LoRaWANUplinkBatcher, flush)
+{
+    uint8_t data[20] = {0};
+
+    EXPECT_TRUE(LORAWAN_STATUS_NO_OP == object->flush());
+
+    object->queue_reading(data, sizeof(data), status_cb);
+    LoRaWANStack_stub::int16_value = 20;
+    EXPECT_TRUE(LORAWAN_STATUS_OK == object->flush());
+
+    // a batch is already in the air
+    object->queue_reading(data, sizeof(data), status_cb);
+    EXPECT_TRUE(LORAWAN_STATUS_WOULD_BLOCK == object->flush());
+
+    object->handle_event(TX_DONE);
+    EXPECT_TRUE(1 == cb_count);
+    EXPECT_TRUE(0 == cb_last_id);
+    EXPECT_TRUE(TX_DONE == cb_last_event);
+}
+
+TEST_F(Test_LoRaWANUplinkBatcher, flush_mac_busy)
+{
+    uint8_t data[20] = {0};
+
+    object->queue_reading(data, sizeof(data), status_cb);
+    LoRaWANStack_stub::int16_value = LORAWAN_STATUS_WOULD_BLOCK;
+    EXPECT_TRUE(LORAWAN_STATUS_WOULD_BLOCK == object->flush());
+
+    // the reading stays queued for a later retry
+    EXPECT_TRUE(1 == object->pending_readings());
+    EXPECT_TRUE(0 == cb_count);
+}
+
+TEST_F(Test_LoRaWANUplinkBatcher, flush_terminal_error_drops_batch)
+{
+    uint8_t data[20] = {0};
+
+    object->queue_reading(data, sizeof(data), status_cb);
+    LoRaWANStack_stub::int16_value = LORAWAN_STATUS_NO_ACTIVE_SESSIONS;
+    EXPECT_TRUE(LORAWAN_STATUS_NO_ACTIVE_SESSIONS == object->flush());
+
+    EXPECT_TRUE(0 == object->pending_readings());
+    EXPECT_TRUE(1 == cb_count);
+    EXPECT_TRUE(TX_ERROR == cb_last_event);
+}
+
+TEST_F(Test_LoRaWANUplinkBatcher, split_reading_reported_failed)
+{
+    uint8_t data[30] = {0};
+
+    object->queue_reading(data, sizeof(data), status_cb);
+    // the MAC accepts less than the whole reading (MAC commands grabbed a
+    // piece of the payload), which splits the reading
+    LoRaWANStack_stub::int16_value = 25;
+    EXPECT_TRUE(LORAWAN_STATUS_OK == object->flush());
+
+    EXPECT_TRUE(0 == object->pending_readings());
+    EXPECT_TRUE(1 == cb_count);
+    EXPECT_TRUE(TX_ERROR == cb_last_event);
+}
+
+TEST_F(Test_LoRaWANUplinkBatcher, tx_error_reported)
+{
+    uint8_t data[20] = {0};
+
+    object->queue_reading(data, sizeof(data), status_cb);
+    LoRaWANStack_stub::int16_value = 20;
+    EXPECT_TRUE(LORAWAN_STATUS_OK == object->flush());
+
+    object->handle_event(TX_TIMEOUT);
+    EXPECT_TRUE(1 == cb_count);
+    EXPECT_TRUE(TX_TIMEOUT == cb_last_event);
+    EXPECT_TRUE(0 == object->pending_readings());
+}
@@ -38,6 +38,32 @@
 #define IP_ADDR_VALID 0
 #endif
 
+// Number of received frames handed from the EMAC to the tcpip thread as one
+// batch. Frames arriving while the tcpip thread is busy join the pending
+// batch instead of each posting their own mailbox message, which reduces the
+// per-packet wakeup overhead at high packet rates. Set to 0 (default) to
+// post every frame individually.
+#ifndef MBED_CONF_LWIP_EMAC_RX_BURST_SIZE
+#define MBED_CONF_LWIP_EMAC_RX_BURST_SIZE 0
+#endif
+
+#if LWIP_PBUF_RX_TIMESTAMP
+/** Read the clock receive timestamps are taken from.
+ *
+ * The default (weak) implementation reads the microsecond ticker, giving
+ * timestamps since boot at us resolution. Targets whose MAC carries a
+ * PTP hardware clock should override this to read that clock instead, so
+ * socket timestamps share the PTP timescale.
+ *
+ * Called from the EMAC link input path, which may run in interrupt
+ * context on some drivers.
+ *
+ * @param sec  Destination for the seconds component
+ * @param nsec Destination for the nanoseconds component
+ */
+extern "C" void mbed_lwip_rx_timestamp_now(uint32_t *sec, uint32_t *nsec);
+#endif
+
 class LWIP : public OnboardNetworkStack, private mbed::NonCopyable<LWIP> {
 public:
     using NetworkStack::get_ip_address;
@@ -168,6 +194,9 @@ public:
         static err_t emac_low_level_output(struct netif *netif, struct pbuf *p);
         void emac_input(net_stack_mem_buf_t *buf);
         void emac_state_change(bool up);
+#if MBED_CONF_LWIP_EMAC_RX_BURST_SIZE > 0
+        static void emac_process_rx_burst(void *ctx);
+#endif
 #if LWIP_IGMP
         static err_t emac_igmp_mac_filter(struct netif *netif, const ip4_addr_t *group, enum netif_mac_filter_action action);
 #endif
@@ -249,6 +278,13 @@ public:
         bool blocking;
         bool ppp_enabled;
         mbed::Callback<void(nsapi_event_t, intptr_t)> client_callback;
+#if LWIP_ETHERNET && (MBED_CONF_LWIP_EMAC_RX_BURST_SIZE > 0)
+        /* Ring of received frames waiting for one batched tcpip thread wakeup */
+        struct pbuf *rx_burst_queue[MBED_CONF_LWIP_EMAC_RX_BURST_SIZE];
+        uint32_t rx_burst_head = 0;
+        uint32_t rx_burst_count = 0;
+        bool rx_burst_scheduled = false;
+#endif
         struct netif netif;
         static Interface *list;
         Interface *next;
@@ -503,6 +539,154 @@ protected:
     nsapi_size_or_error_t socket_recvfrom(nsapi_socket_t handle, SocketAddress *address,
                                           void *buffer, nsapi_size_t size) override;
 
+    /** Send a vector of data buffers over a TCP socket
+     *
+     *  The socket must be connected to a remote host. Gathers the
+     *  scatter-gather vector into the outgoing stream, so the caller does
+     *  not need to assemble the data into one contiguous buffer. Fewer
+     *  bytes than the vector total may be sent; the return value reports
+     *  how many were.
+     *
+     *  This call is non-blocking. If sendv would block,
+     *  NSAPI_ERROR_WOULD_BLOCK is returned immediately.
+     *
+     *  @param handle    Socket handle
+     *  @param iov       Scatter-gather vector of data buffers to send
+     *  @param iov_count Number of elements in the vector
+     *  @return          Number of sent bytes on success, negative error
+     *                   code on failure
+     */
+    nsapi_size_or_error_t socket_sendv(nsapi_socket_t handle,
+                                       const nsapi_iovec_t *iov, int iov_count) override;
+
+    /** Send a vector of data buffers over a UDP socket
+     *
+     *  Gathers the scatter-gather vector into one datagram sent to the
+     *  specified address by chaining the buffers as reference pbufs, so
+     *  the caller does not need to assemble the data into one contiguous
+     *  buffer.
+     *
+     *  This call is non-blocking. If sendtov would block,
+     *  NSAPI_ERROR_WOULD_BLOCK is returned immediately.
+     *
+     *  @param handle    Socket handle
+     *  @param address   The SocketAddress of the remote host
+     *  @param iov       Scatter-gather vector of data buffers to send
+     *  @param iov_count Number of elements in the vector
+     *  @return          Number of sent bytes on success, negative error
+     *                   code on failure
+     */
+    nsapi_size_or_error_t socket_sendtov(nsapi_socket_t handle, const SocketAddress &address,
+                                         const nsapi_iovec_t *iov, int iov_count) override;
+
+    /** Send data over a TCP socket without copying it
+     *
+     *  Queues the caller's buffer on the connection as reference pbufs
+     *  (NETCONN_NOCOPY) instead of copying it into the lwIP send buffer.
+     *  The buffer must stay valid and unmodified until the accepted bytes
+     *  have been acknowledged by the remote end; use socket_notify_sent
+     *  to learn when that has happened.
+     *
+     *  This call is non-blocking. If send_nocopy would block,
+     *  NSAPI_ERROR_WOULD_BLOCK is returned immediately.
+     *
+     *  @param handle    Socket handle
+     *  @param data      Buffer of data to send, valid until acknowledged
+     *  @param size      Size of the buffer in bytes
+     *  @return          Number of sent bytes on success, negative error
+     *                   code on failure
+     */
+    nsapi_size_or_error_t socket_send_nocopy(nsapi_socket_t handle,
+                                             const void *data, nsapi_size_t size) override;
+
+    /** Request a callback once all data sent so far has been acknowledged
+     *
+     *  The callback fires once the remote end has acknowledged every byte
+     *  accepted by the socket up to this call, at which point lwIP holds
+     *  no reference to buffers previously passed to socket_send_nocopy.
+     *  It is invoked from the tcpip thread, from this call if nothing is
+     *  outstanding, or from socket_close if the connection is torn down
+     *  with data still unacknowledged.
+     *
+     *  @param handle    Socket handle
+     *  @param callback  Function to call once outstanding data is acknowledged
+     *  @param data      Argument to pass to callback
+     *  @return          NSAPI_ERROR_OK on success, negative error code on
+     *                   failure
+     */
+    nsapi_error_t socket_notify_sent(nsapi_socket_t handle,
+                                     void (*callback)(void *), void *data) override;
+
+    /** Get the number of sent bytes not yet acknowledged by the peer
+     *
+     *  Reports the gap between the bytes queued on the TCP connection
+     *  and the bytes the remote end has acknowledged.
+     *
+     *  @param handle    Socket handle
+     *  @return          Number of unacknowledged bytes on success,
+     *                   negative error code on failure
+     */
+    nsapi_size_or_error_t socket_send_pending(nsapi_socket_t handle) override;
+
+    /** Fill the passed array of structures with traffic statistics for each interface
+     *
+     *  Samples the MIB2 counters lwIP keeps per netif, so it requires
+     *  lwIP statistics to be enabled (see MBED_CONF_LWIP_STATS_ENABLED);
+     *  without them nothing is filled and 0 is returned.
+     *
+     *  @param stats    A pointer to an array of mbed_stats_interface_t structures to fill
+     *  @param count    The number of mbed_stats_interface_t structures in the provided array
+     *  @return         The number of mbed_stats_interface_t structures that have been filled
+     */
+    size_t get_interface_stats(mbed_stats_interface_t *stats, size_t count) override;
+
+    /** Receive a packet over a UDP socket without copying
+     *
+     *  Receives a datagram and transfers ownership of the pbuf chain
+     *  holding the payload to the caller, so the data is consumed in
+     *  place instead of being copied into a user buffer. The caller must
+     *  free the buffer chain through the stack's memory manager when
+     *  done with it. Stores the source address in address if address is
+     *  not NULL.
+     *
+     *  This call is non-blocking. If recvfrom_buffer would block,
+     *  NSAPI_ERROR_WOULD_BLOCK is returned immediately.
+     *
+     *  @param handle   Socket handle
+     *  @param address  Destination for the source address or NULL
+     *  @param buffer   Destination for the received memory buffer chain
+     *  @return         Number of received bytes on success, negative error
+     *                  code on failure
+     */
+    nsapi_size_or_error_t socket_recvfrom_buffer(nsapi_socket_t handle, SocketAddress *address,
+                                                 net_stack_mem_buf_t **buffer) override;
+
+    /** Receive a packet over a UDP socket with its receive timestamp
+     *
+     *  Behaves as socket_recvfrom, and additionally reports when the
+     *  frame entered the stack, as stamped at EMAC link input (see
+     *  MBED_CONF_LWIP_RX_TIMESTAMP_ENABLED). With timestamping disabled,
+     *  or for packets that arrived through an interface that does not
+     *  stamp, timestamp->valid is cleared.
+     *
+     *  @param handle    Socket handle
+     *  @param address   Destination for the source address or NULL
+     *  @param buffer    Destination buffer for data received from the host
+     *  @param size      Size of the buffer in bytes
+     *  @param timestamp Destination for the receive timestamp
+     *  @return          Number of received bytes on success, negative error
+     *                   code on failure
+     */
+    nsapi_size_or_error_t socket_recvfrom_timestamp(nsapi_socket_t handle, SocketAddress *address,
+                                                    void *buffer, nsapi_size_t size,
+                                                    nsapi_timestamp_t *timestamp) override;
+
+    /** Get the memory manager used for zero-copy memory buffers
+     *
+     *  @return         Memory manager
+     */
+    NetStackMemoryManager *get_memory_manager() override;
+
     /** Register a callback on state change of the socket
      *
      *  The specified callback will be called on state changes such as when
@@ -582,6 +766,15 @@ private:
      */
     nsapi_error_t call_in(int delay, mbed::Callback<void()> func) override;
 
+    /* Pending zero-copy send notification; fired once sent_acked passes
+     * end. Kept as a FIFO list, which acknowledgement order guarantees. */
+    struct sent_notify {
+        struct sent_notify *next;
+        u32_t end;
+        void (*cb)(void *);
+        void *data;
+    };
+
     struct mbed_lwip_socket {
         bool in_use;
 
@@ -592,6 +785,14 @@ private:
         void (*cb)(void *);
         void *data;
 
+        // Zero-copy send accounting: cumulative bytes queued on and
+        // acknowledged by the connection, and the notifications waiting
+        // for the acknowledgements. Guarded by the adaptation mutex.
+        struct sent_notify *sent_notify_head;
+        struct sent_notify *sent_notify_tail;
+        u32_t sent_enqueued;
+        u32_t sent_acked;
+
         // Track multicast addresses subscribed to by this socket
         nsapi_ip_mreq_t *multicast_memberships;
         uint32_t         multicast_memberships_count;
@@ -0,0 +1,149 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LWIP_CHECKPOINT_H_
+#define LWIP_CHECKPOINT_H_
+
+#include <stdint.h>
+
+struct netif;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Compile in netif state checkpointing. Also enables lwIP's static ARP
+ *  entries (ETHARP_SUPPORT_STATIC_ENTRIES), which restore uses to re-inject
+ *  the saved ARP cache. */
+#ifndef MBED_CONF_LWIP_CHECKPOINT_ENABLED
+#define MBED_CONF_LWIP_CHECKPOINT_ENABLED 0
+#endif
+
+/** Number of ARP entries preserved across a sleep cycle. Restored entries
+ *  occupy slots in the regular ARP table (ARP_TABLE_SIZE). */
+#ifndef MBED_CONF_LWIP_CHECKPOINT_ARP_ENTRIES
+#define MBED_CONF_LWIP_CHECKPOINT_ARP_ENTRIES 8
+#endif
+
+/** One preserved ARP binding. */
+typedef struct lwip_checkpoint_arp_entry {
+    uint32_t ip;        /**< IPv4 address, network byte order */
+    uint8_t eth[6];     /**< Ethernet address */
+} lwip_checkpoint_arp_entry_t;
+
+/** Checkpointed netif state: IPv4 configuration, DHCP lease and ARP cache.
+ *
+ * Plain data with no pointers, so the application can place it in memory
+ * that survives deep sleep (a retained RAM section, via MBED_SECTION) and
+ * hand the same object back to lwip_checkpoint_restore() after wake. A
+ * checksum guards against the region not actually having been retained.
+ */
+typedef struct lwip_checkpoint {
+    uint32_t magic;             /**< Identifies an initialized checkpoint */
+    uint32_t sum;               /**< Checksum over the fields below */
+    uint8_t hwaddr[6];          /**< MAC the state was captured for */
+    uint8_t hwaddr_len;
+    uint8_t arp_cnt;            /**< Valid entries in arp[] */
+    uint32_t ip;                /**< IPv4 address, network byte order */
+    uint32_t netmask;
+    uint32_t gateway;
+    uint8_t dhcp_valid;         /**< Lease fields below are meaningful */
+    uint8_t dhcp_state;         /**< DHCP client state at capture */
+    uint16_t dhcp_lease_used;   /**< Coarse-timer ticks of the lease already used */
+    uint32_t dhcp_xid;          /**< Last DHCP transaction id */
+    uint32_t dhcp_server;       /**< Leasing server, network byte order */
+    uint32_t dhcp_t0_lease;     /**< Lease period, seconds */
+    uint32_t dhcp_t1_renew;     /**< Renew time, seconds */
+    uint32_t dhcp_t2_rebind;    /**< Rebind time, seconds */
+    lwip_checkpoint_arp_entry_t arp[MBED_CONF_LWIP_CHECKPOINT_ARP_ENTRIES];
+} lwip_checkpoint_t;
+
+/** Capture a netif's network state before sleep
+ *
+ *  Records the IPv4 configuration, the active DHCP lease (when the netif
+ *  is DHCP-managed) and the stable ARP entries learned on this netif. Call
+ *  with the interface up, right before powering down.
+ *
+ *  @param netif    The interface to capture
+ *  @param cp       Checkpoint to fill, normally in retained RAM
+ *  @return         0 on success, -1 if checkpointing is compiled out or the
+ *                  netif has no IPv4 address to capture
+ */
+int lwip_checkpoint_save(struct netif *netif, lwip_checkpoint_t *cp);
+
+/** Restore a netif's network state after wake
+ *
+ *  Call once the interface has been re-added and the link is up, instead
+ *  of blocking on DHCP. The IPv4 configuration is applied immediately and
+ *  the saved ARP entries are re-injected as static entries, so traffic to
+ *  known peers flows again in milliseconds; a gratuitous ARP announces the
+ *  address so peers refresh their own caches.
+ *
+ *  The lease is restored optimistically: its age is advanced by the time
+ *  spent asleep and a checkpoint whose lease would have lapsed is rejected
+ *  outright, since the address can no longer be trusted. The lease data is
+ *  recorded in the netif's DHCP state so the client continues from it - if
+ *  the client is already running its lease is revalidated with a unicast
+ *  renew in the background, otherwise the next dhcp_start() revalidates
+ *  it, and either way dhcp_bind() replaces the seeded address should the
+ *  server disagree.
+ *
+ *  A failed restore invalidates the checkpoint; the caller falls back to a
+ *  normal cold bring-up.
+ *
+ *  @param netif        The interface to restore onto
+ *  @param cp           Checkpoint written by lwip_checkpoint_save()
+ *  @param slept_sec    Seconds spent asleep since the checkpoint was taken
+ *  @return             0 on success, -1 if the checkpoint is invalid, was
+ *                      taken for a different MAC or its lease has lapsed
+ */
+int lwip_checkpoint_restore(struct netif *netif, lwip_checkpoint_t *cp, uint32_t slept_sec);
+
+/** Tell whether a checkpoint holds restorable state
+ *
+ *  @param cp   Checkpoint to inspect
+ *  @return     1 if the checkpoint is initialized and intact, else 0
+ */
+int lwip_checkpoint_valid(const lwip_checkpoint_t *cp);
+
+/** Mark a checkpoint as empty
+ *
+ *  Call when the network environment is known to have changed (new
+ *  association, link error) so a stale checkpoint is not restored later.
+ *
+ *  @param cp   Checkpoint to clear
+ */
+void lwip_checkpoint_invalidate(lwip_checkpoint_t *cp);
+
+/** Remove the ARP entries a restore injected
+ *
+ *  Restored entries are static, so they neither age nor follow a peer that
+ *  changes its MAC. Call once the live cache has had time to re-learn the
+ *  active peers - typically a minute after wake, or on the first send
+ *  failure - to hand the bindings back to normal ARP.
+ *
+ *  @param netif    The interface the checkpoint was restored onto
+ *  @param cp       The restored checkpoint
+ *  @return         0 on success, -1 if checkpointing is compiled out
+ */
+int lwip_checkpoint_release_arp(struct netif *netif, const lwip_checkpoint_t *cp);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LWIP_CHECKPOINT_H_ */
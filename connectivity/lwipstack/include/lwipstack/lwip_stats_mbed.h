@@ -0,0 +1,82 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LWIP_STATS_MBED_H_
+#define LWIP_STATS_MBED_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Telemetry snapshot of one lwIP memory pool.
+ *
+ * Covers every memp pool, including the pbuf pool (MEMP_PBUF_POOL), so
+ * an exhausted pool - which lwIP handles by silently dropping packets -
+ * shows up as a non-zero failed count instead of a throughput mystery.
+ */
+typedef struct lwip_stats_mbed_pool {
+    const char *name;   /**< Pool description, e.g. "PBUF_POOL" */
+    uint32_t avail;     /**< Configured number of elements */
+    uint32_t used;      /**< Elements currently allocated */
+    uint32_t max;       /**< High watermark of used */
+    uint32_t failed;    /**< Allocations that failed because the pool was empty */
+} lwip_stats_mbed_pool_t;
+
+/** Get the number of memory pools that can be queried
+ *
+ *  @return Number of pools, 0 if pool statistics are compiled out
+ *          (MEMP_STATS disabled)
+ */
+int lwip_stats_mbed_pool_count(void);
+
+/** Sample the counters of one memory pool
+ *
+ *  The counters are sampled without locking: each field is consistent,
+ *  but used may already have moved by the time the call returns. max and
+ *  failed are monotonic until lwip_stats_mbed_reset_pools().
+ *
+ *  @param index    Pool index, 0 to lwip_stats_mbed_pool_count() - 1
+ *  @param stats    Snapshot to fill in
+ *  @return         0 on success, -1 if the index is out of range, stats is
+ *                  NULL or pool statistics are compiled out
+ */
+int lwip_stats_mbed_get_pool(unsigned int index, lwip_stats_mbed_pool_t *stats);
+
+/** Count the pools that have failed an allocation
+ *
+ *  Cheap health check for periodic supervision: a non-zero return means
+ *  some pool ran empty since boot (or the last reset) and packets or
+ *  connections have been dropped.
+ *
+ *  @return Number of pools with a non-zero failed count
+ */
+int lwip_stats_mbed_pools_exhausted(void);
+
+/** Reset the high watermarks and failure counters of all pools
+ *
+ *  used and avail are left untouched. Resetting between measurement
+ *  windows turns max into a per-window watermark.
+ */
+void lwip_stats_mbed_reset_pools(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LWIP_STATS_MBED_H_ */
@@ -136,7 +136,24 @@
 
 // Number of pool pbufs.
 // Each requires 684 bytes of RAM (if MSS=536 and PBUF_POOL_BUFSIZE defaulting to be based on MSS)
+#ifdef MBED_CONF_LWIP_POOL_RAM_BUDGET
+// Auto-tuning mode: derive the pbuf pool count from a RAM budget (in
+// bytes) instead of a hand-picked count. The cost of one pool pbuf is
+// its aligned payload plus the pbuf header and pool bookkeeping,
+// estimated at 64 bytes. The count never drops below the EMAC receive
+// ring length plus two, since a pool smaller than the ring cannot even
+// keep the driver's descriptors filled. Validate the result against the
+// measured watermarks from lwip_stats_mbed.h before shrinking further.
+#ifndef MBED_CONF_LWIP_EMAC_RX_RING_LEN
+#define MBED_CONF_LWIP_EMAC_RX_RING_LEN 4
+#endif
+#define LWIP_MBED_PBUF_POOL_COST    (PBUF_POOL_BUFSIZE + 64)
+#define LWIP_MBED_PBUF_POOL_FLOOR   (MBED_CONF_LWIP_EMAC_RX_RING_LEN + 2)
+#define PBUF_POOL_SIZE              ((MBED_CONF_LWIP_POOL_RAM_BUDGET / LWIP_MBED_PBUF_POOL_COST) > LWIP_MBED_PBUF_POOL_FLOOR ? \
+                                     (MBED_CONF_LWIP_POOL_RAM_BUDGET / LWIP_MBED_PBUF_POOL_COST) : LWIP_MBED_PBUF_POOL_FLOOR)
+#else
 #define PBUF_POOL_SIZE              MBED_CONF_LWIP_PBUF_POOL_SIZE
+#endif
 
 #ifdef MBED_CONF_LWIP_PBUF_POOL_BUFSIZE
 #undef PBUF_POOL_BUFSIZE
@@ -172,6 +189,13 @@
 // Each netbuf requires 64 bytes of RAM.
 #define MEMP_NUM_NETBUF             MBED_CONF_LWIP_NUM_NETBUF
 
+// Receive timestamping: stamp every inbound frame at link input and
+// carry the timestamp in the pbuf up to the socket layer.
+// Costs 8 bytes per pbuf.
+#ifdef MBED_CONF_LWIP_RX_TIMESTAMP_ENABLED
+#define LWIP_PBUF_RX_TIMESTAMP      MBED_CONF_LWIP_RX_TIMESTAMP_ENABLED
+#endif
+
 // One netconn is needed for each UDPSocket or TCPSocket.
 // Each requires 236 bytes of RAM (total rounded to multiple of 512).
 #define MEMP_NUM_NETCONN            MBED_CONF_LWIP_SOCKET_MAX
@@ -253,8 +277,17 @@
 #define LWIP_DBG_MIN_LEVEL          LWIP_DBG_LEVEL_ALL
 #else
 #define LWIP_NOASSERT               1
+#ifndef MBED_CONF_LWIP_STATS_ENABLED
 #define LWIP_STATS                  0
 #endif
+#endif
+
+// Runtime traffic statistics. Enables lwIP's internal counters and the
+// per-netif MIB2 counters sampled by LWIP::get_interface_stats()
+#ifdef MBED_CONF_LWIP_STATS_ENABLED
+#define LWIP_STATS                  MBED_CONF_LWIP_STATS_ENABLED
+#define MIB2_STATS                  MBED_CONF_LWIP_STATS_ENABLED
+#endif
 
 #define TRACE_TO_ASCII_HEX_DUMP     0
 
@@ -268,6 +301,11 @@
 #define LWIP_ARP                    1
 #define LWIP_ETHERNET               1
 #define LWIP_DHCP                   LWIP_IPV4
+// Checkpoint restore (lwip_checkpoint.h) re-injects the preserved ARP
+// cache as static entries
+#if defined(MBED_CONF_LWIP_CHECKPOINT_ENABLED) && MBED_CONF_LWIP_CHECKPOINT_ENABLED
+#define ETHARP_SUPPORT_STATIC_ENTRIES 1
+#endif
 #else
 #define LWIP_ARP                    0
 #define LWIP_ETHERNET               0
@@ -320,6 +358,13 @@
 // Checksum-on-copy disabled due to https://savannah.nongnu.org/bugs/?50914
 #define LWIP_CHECKSUM_ON_COPY       0
 
+// Per-netif checksum control. When enabled, interfaces whose EMAC reports
+// hardware checksum offload (see EMAC::get_capabilities) skip the software
+// IP/UDP/TCP checksum loops for that netif.
+#ifdef MBED_CONF_LWIP_CHECKSUM_CTRL_PER_NETIF
+#define LWIP_CHECKSUM_CTRL_PER_NETIF MBED_CONF_LWIP_CHECKSUM_CTRL_PER_NETIF
+#endif
+
 #define LWIP_NETIF_HOSTNAME         1
 #define LWIP_NETIF_STATUS_CALLBACK  1
 #define LWIP_NETIF_LINK_CALLBACK    1
@@ -71,8 +71,16 @@ extern "C" {
     #define ALIGNED(n)  __attribute__((aligned (n)))
 #endif
 
+/* Use the vectorised platform kernels on cores with Helium */
+#if defined(__ARM_FEATURE_MVE) && (__ARM_FEATURE_MVE & 1)
+    #include "platform/mbed_simd.h"
+    #define LWIP_CHKSUM             mbed_simd_sum16
+    /* Set algorithm to 0 so that unused lwip_standard_chksum function
+       doesn't generate compiler warning */
+    #define LWIP_CHKSUM_ALGORITHM   0
+
 /* Provide Thumb-2 routines for GCC to improve performance */
-#if defined(TOOLCHAIN_GCC) && defined(__thumb2__)
+#elif defined(TOOLCHAIN_GCC) && defined(__thumb2__)
     #define MEMCPY(dst,src,len)     thumb2_memcpy(dst,src,len)
     #define LWIP_CHKSUM             thumb2_checksum
     /* Set algorithm to 0 so that unused lwip_standard_chksum function
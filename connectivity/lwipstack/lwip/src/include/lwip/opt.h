@@ -1555,6 +1555,15 @@
 #if !defined LWIP_PBUF_REF_T || defined __DOXYGEN__
 #define LWIP_PBUF_REF_T                 u8_t
 #endif
+
+/**
+ * LWIP_PBUF_RX_TIMESTAMP==1: add a receive timestamp (seconds/nanoseconds)
+ * to every pbuf, filled in by the port at link input and flagged with
+ * PBUF_FLAG_RX_TIMESTAMP. Costs 8 bytes per pbuf.
+ */
+#if !defined LWIP_PBUF_RX_TIMESTAMP || defined __DOXYGEN__
+#define LWIP_PBUF_RX_TIMESTAMP          0
+#endif
 /**
  * @}
  */
@@ -181,6 +181,10 @@ typedef enum {
 #define PBUF_FLAG_LLMCAST   0x10U
 /** indicates this pbuf includes a TCP FIN flag */
 #define PBUF_FLAG_TCP_FIN   0x20U
+#if LWIP_PBUF_RX_TIMESTAMP
+/** indicates the port filled in this pbuf's receive timestamp */
+#define PBUF_FLAG_RX_TIMESTAMP 0x40U
+#endif
 
 /** Main packet buffer struct */
 struct pbuf {
@@ -219,6 +223,13 @@ struct pbuf {
 
   /** For incoming packets, this contains the input netif's index */
   u8_t if_idx;
+
+#if LWIP_PBUF_RX_TIMESTAMP
+  /** receive timestamp captured at link input, valid when
+      PBUF_FLAG_RX_TIMESTAMP is set in flags */
+  u32_t ts_sec;
+  u32_t ts_nsec;
+#endif
 };
 
 
@@ -736,6 +736,15 @@ nsapi_error_t LWIP::Interface::bringup(bool dhcp, const char *ip, const char *ne
             return ret_add_ip;
         }
     }
+#if defined(MBED_CONF_NSAPI_EMAC_WARM_START) && MBED_CONF_NSAPI_EMAC_WARM_START
+    else if (dhcp && !ppp_enabled && ip) {
+        // Warm start: seed the netif with the cached lease so traffic can
+        // flow before the DHCP exchange completes; dhcp_bind() replaces the
+        // address if the server hands out a different one. Best effort -
+        // if the seed fails DHCP still configures the interface.
+        set_ip_address(ip, netmask, gw);
+    }
+#endif
 
     if (client_callback) {
         client_callback(NSAPI_EVENT_CONNECTION_STATUS_CHANGE, NSAPI_STATUS_CONNECTING);
@@ -18,7 +18,9 @@
 #include "lwip/tcpip.h"
 #include "lwip/tcp.h"
 #include "lwip/ip.h"
+#include "lwip/sys.h"
 #include "netif/etharp.h"
+#include "netif/ethernet.h"
 #include "lwip/ethip6.h"
 #include "netsocket/nsapi_types.h"
 #include "netsocket/EMAC.h"
@@ -27,6 +29,28 @@
 
 #if LWIP_ETHERNET
 
+#if LWIP_PBUF_RX_TIMESTAMP
+
+#include "platform/mbed_toolchain.h"
+#include "platform/mbed_power_mgmt.h"
+#if DEVICE_USTICKER
+#include "hal/ticker_api.h"
+#include "hal/us_ticker_api.h"
+#endif
+
+MBED_WEAK void mbed_lwip_rx_timestamp_now(uint32_t *sec, uint32_t *nsec)
+{
+#if DEVICE_USTICKER
+    us_timestamp_t now = ticker_read_us(get_us_ticker_data());
+#else
+    us_timestamp_t now = mbed_uptime();
+#endif
+    *sec = now / 1000000;
+    *nsec = (now % 1000000) * 1000;
+}
+
+#endif /* LWIP_PBUF_RX_TIMESTAMP */
+
 err_t LWIP::Interface::emac_low_level_output(struct netif *netif, struct pbuf *p)
 {
     /* Increase reference counter since lwip stores handle to pbuf and frees
@@ -38,10 +62,68 @@ err_t LWIP::Interface::emac_low_level_output(struct netif *netif, struct pbuf *p
     return ret ? ERR_OK : ERR_IF;
 }
 
+#if MBED_CONF_LWIP_EMAC_RX_BURST_SIZE > 0
+void LWIP::Interface::emac_process_rx_burst(void *ctx)
+{
+    LWIP::Interface *mbed_if = static_cast<LWIP::Interface *>(ctx);
+    SYS_ARCH_DECL_PROTECT(lev);
+
+    SYS_ARCH_PROTECT(lev);
+    /* Clear before draining so frames queued during the drain trigger
+       the next wakeup */
+    mbed_if->rx_burst_scheduled = false;
+    while (mbed_if->rx_burst_count > 0) {
+        struct pbuf *p = mbed_if->rx_burst_queue[mbed_if->rx_burst_head];
+        mbed_if->rx_burst_head = (mbed_if->rx_burst_head + 1) % MBED_CONF_LWIP_EMAC_RX_BURST_SIZE;
+        mbed_if->rx_burst_count--;
+        SYS_ARCH_UNPROTECT(lev);
+
+        /* Already running in the tcpip thread, so feed the frame straight to
+           ethernet_input instead of posting it back through the mailbox */
+        if (ethernet_input(p, &mbed_if->netif) != ERR_OK) {
+            LWIP_DEBUGF(NETIF_DEBUG, ("Emac LWIP: IP input error\n"));
+
+            pbuf_free(p);
+        }
+
+        SYS_ARCH_PROTECT(lev);
+    }
+    SYS_ARCH_UNPROTECT(lev);
+}
+#endif
+
 void LWIP::Interface::emac_input(emac_mem_buf_t *buf)
 {
     struct pbuf *p = static_cast<struct pbuf *>(buf);
 
+#if LWIP_PBUF_RX_TIMESTAMP
+    /* Stamp at the EMAC boundary, before any queueing towards the tcpip
+       thread, so the timestamp reflects arrival rather than scheduling */
+    mbed_lwip_rx_timestamp_now(&p->ts_sec, &p->ts_nsec);
+    p->flags |= PBUF_FLAG_RX_TIMESTAMP;
+#endif
+
+#if MBED_CONF_LWIP_EMAC_RX_BURST_SIZE > 0
+    /* Queue the frame and wake the tcpip thread once per burst instead of
+       posting one mailbox message per packet. Frames arriving before the
+       tcpip thread runs join the pending batch. */
+    SYS_ARCH_DECL_PROTECT(lev);
+    SYS_ARCH_PROTECT(lev);
+    if (rx_burst_count < MBED_CONF_LWIP_EMAC_RX_BURST_SIZE) {
+        rx_burst_queue[(rx_burst_head + rx_burst_count) % MBED_CONF_LWIP_EMAC_RX_BURST_SIZE] = p;
+        rx_burst_count++;
+        bool post = !rx_burst_scheduled;
+        rx_burst_scheduled = true;
+        SYS_ARCH_UNPROTECT(lev);
+        if (post) {
+            tcpip_callback_with_block(&LWIP::Interface::emac_process_rx_burst, this, 1);
+        }
+        return;
+    }
+    SYS_ARCH_UNPROTECT(lev);
+    /* Burst queue is full, hand this frame over individually */
+#endif
+
     /* pass all packets to ethernet_input, which decides what packets it supports */
     if (netif.input(p, &netif) != ERR_OK) {
         LWIP_DEBUGF(NETIF_DEBUG, ("Emac LWIP: IP input error\n"));
@@ -145,6 +227,20 @@ err_t LWIP::Interface::emac_if_init(struct netif *netif)
     /* Interface capabilities */
     netif->flags = NETIF_FLAG_BROADCAST | NETIF_FLAG_ETHARP | NETIF_FLAG_ETHERNET;
 
+#if LWIP_CHECKSUM_CTRL_PER_NETIF
+    /* Leave checksumming to the hardware where the EMAC offloads it. ICMP
+       checksums stay in software since hardware coverage varies. */
+    uint32_t caps = mbed_if->emac->get_capabilities();
+    u16_t chksum_flags = NETIF_CHECKSUM_ENABLE_ALL;
+    if (caps & EMAC::CAPABILITY_CHECKSUM_OFFLOAD_TX) {
+        chksum_flags &= ~(NETIF_CHECKSUM_GEN_IP | NETIF_CHECKSUM_GEN_UDP | NETIF_CHECKSUM_GEN_TCP);
+    }
+    if (caps & EMAC::CAPABILITY_CHECKSUM_OFFLOAD_RX) {
+        chksum_flags &= ~(NETIF_CHECKSUM_CHECK_IP | NETIF_CHECKSUM_CHECK_UDP | NETIF_CHECKSUM_CHECK_TCP);
+    }
+    NETIF_SET_CHECKSUM_CTRL(netif, chksum_flags);
+#endif
+
     if (!mbed_if->emac->power_up()) {
         err = ERR_IF;
     }
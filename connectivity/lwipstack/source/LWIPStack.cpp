@@ -36,6 +36,7 @@
 #include "lwip/udp.h"
 #include "lwip/raw.h"
 #include "lwip/netif.h"
+#include "lwip/stats.h"
 #include "lwip/lwip_errno.h"
 #include "lwip-sys/arch/sys_arch.h"
 
@@ -60,6 +61,29 @@ void LWIP::socket_callback(struct netconn *nc, enum netconn_evt eh, u16_t len)
         lwip._event_flag.set(TCP_CLOSED_FLAG);
     }
 
+    // Send plus events with a length carry TCP acknowledgement progress
+    if (eh == NETCONN_EVT_SENDPLUS && len > 0) {
+        for (int i = 0; i < MEMP_NUM_NETCONN; i++) {
+            struct mbed_lwip_socket *s = &lwip.arena[i];
+            if (s->in_use && s->conn == nc) {
+                s->sent_acked += len;
+                // Acknowledgements arrive in order, so matured
+                // notifications are at the head of the list
+                while (s->sent_notify_head
+                        && (s32_t)(s->sent_acked - s->sent_notify_head->end) >= 0) {
+                    struct sent_notify *notify = s->sent_notify_head;
+                    s->sent_notify_head = notify->next;
+                    if (!s->sent_notify_head) {
+                        s->sent_notify_tail = NULL;
+                    }
+                    notify->cb(notify->data);
+                    free(notify);
+                }
+                break;
+            }
+        }
+    }
+
     for (int i = 0; i < MEMP_NUM_NETCONN; i++) {
         if (lwip.arena[i].in_use
                 && lwip.arena[i].conn == nc
@@ -295,6 +319,21 @@ nsapi_error_t LWIP::socket_close(nsapi_socket_t handle)
         pbuf_free(s->buf);
     }
     err_t err = netconn_delete(s->conn);
+
+    /* netconn_delete dropped any remaining references to zero-copy send
+     * buffers, so pending acknowledgement notifications can be delivered */
+    adaptation.lock();
+    struct sent_notify *notify = s->sent_notify_head;
+    s->sent_notify_head = NULL;
+    s->sent_notify_tail = NULL;
+    adaptation.unlock();
+    while (notify) {
+        struct sent_notify *next = notify->next;
+        notify->cb(notify->data);
+        free(notify);
+        notify = next;
+    }
+
     arena_dealloc(s);
     return err_remap(err);
 }
@@ -403,11 +442,173 @@ nsapi_size_or_error_t LWIP::socket_send(nsapi_socket_t handle, const void *data,
     size_t bytes_written = 0;
 
     err_t err = netconn_write_partly(s->conn, data, size, NETCONN_COPY, &bytes_written);
+    if (bytes_written > 0) {
+        adaptation.lock();
+        s->sent_enqueued += bytes_written;
+        adaptation.unlock();
+    }
+    if (err != ERR_OK) {
+        return err_remap(err);
+    }
+
+    return (nsapi_size_or_error_t)bytes_written;
+}
+
+nsapi_size_or_error_t LWIP::socket_send_nocopy(nsapi_socket_t handle, const void *data, nsapi_size_t size)
+{
+#if LWIP_TCP
+    struct mbed_lwip_socket *s = (struct mbed_lwip_socket *)handle;
+
+    if (NETCONNTYPE_GROUP(s->conn->type) != NETCONN_TCP) {
+        return NSAPI_ERROR_UNSUPPORTED;
+    }
+
+    size_t bytes_written = 0;
+
+    // Reference the caller's buffer instead of copying it into the send
+    // buffer; it stays in use until the bytes are acknowledged
+    err_t err = netconn_write_partly(s->conn, data, size, NETCONN_NOCOPY, &bytes_written);
+    if (bytes_written > 0) {
+        adaptation.lock();
+        s->sent_enqueued += bytes_written;
+        adaptation.unlock();
+    }
     if (err != ERR_OK) {
         return err_remap(err);
     }
 
     return (nsapi_size_or_error_t)bytes_written;
+#else
+    return NSAPI_ERROR_UNSUPPORTED;
+#endif
+}
+
+nsapi_size_or_error_t LWIP::socket_send_pending(nsapi_socket_t handle)
+{
+#if LWIP_TCP
+    struct mbed_lwip_socket *s = (struct mbed_lwip_socket *)handle;
+
+    if (NETCONNTYPE_GROUP(s->conn->type) != NETCONN_TCP) {
+        return NSAPI_ERROR_UNSUPPORTED;
+    }
+
+    adaptation.lock();
+    u32_t pending = s->sent_enqueued - s->sent_acked;
+    adaptation.unlock();
+
+    return (nsapi_size_or_error_t)pending;
+#else
+    return NSAPI_ERROR_UNSUPPORTED;
+#endif
+}
+
+size_t LWIP::get_interface_stats(mbed_stats_interface_t *stats, size_t count)
+{
+#if MIB2_STATS
+    MBED_ASSERT(stats != NULL);
+    size_t i = 0;
+
+    adaptation.lock();
+    for (Interface *interface = Interface::list; interface && i < count; interface = interface->next, i++) {
+        memset(&stats[i], 0, sizeof(stats[i]));
+        interface->get_interface_name(stats[i].name);
+        const struct stats_mib2_netif_ctrs *ctrs = &interface->netif.mib2_counters;
+        stats[i].rx_bytes = ctrs->ifinoctets;
+        stats[i].rx_packets = ctrs->ifinucastpkts + ctrs->ifinnucastpkts;
+        stats[i].rx_drops = ctrs->ifindiscards + ctrs->ifinerrors;
+        stats[i].tx_bytes = ctrs->ifoutoctets;
+        stats[i].tx_packets = ctrs->ifoutucastpkts + ctrs->ifoutnucastpkts;
+        stats[i].tx_drops = ctrs->ifoutdiscards + ctrs->ifouterrors;
+        stats[i].tcp_retransmits = lwip_stats.mib2.tcpretranssegs;
+    }
+    adaptation.unlock();
+
+    return i;
+#else
+    return 0;
+#endif
+}
+
+nsapi_error_t LWIP::socket_notify_sent(nsapi_socket_t handle, void (*callback)(void *), void *data)
+{
+#if LWIP_TCP
+    struct mbed_lwip_socket *s = (struct mbed_lwip_socket *)handle;
+
+    if (!callback) {
+        return NSAPI_ERROR_PARAMETER;
+    }
+
+    if (NETCONNTYPE_GROUP(s->conn->type) != NETCONN_TCP) {
+        return NSAPI_ERROR_UNSUPPORTED;
+    }
+
+    adaptation.lock();
+
+    if (!s->sent_notify_head && s->sent_acked == s->sent_enqueued) {
+        // Everything sent so far is already acknowledged
+        adaptation.unlock();
+        callback(data);
+        return NSAPI_ERROR_OK;
+    }
+
+    struct sent_notify *notify = (struct sent_notify *)malloc(sizeof(struct sent_notify));
+    if (!notify) {
+        adaptation.unlock();
+        return NSAPI_ERROR_NO_MEMORY;
+    }
+
+    notify->next = NULL;
+    notify->end = s->sent_enqueued;
+    notify->cb = callback;
+    notify->data = data;
+    if (s->sent_notify_tail) {
+        s->sent_notify_tail->next = notify;
+    } else {
+        s->sent_notify_head = notify;
+    }
+    s->sent_notify_tail = notify;
+
+    adaptation.unlock();
+    return NSAPI_ERROR_OK;
+#else
+    return NSAPI_ERROR_UNSUPPORTED;
+#endif
+}
+
+nsapi_size_or_error_t LWIP::socket_sendv(nsapi_socket_t handle, const nsapi_iovec_t *iov, int iov_count)
+{
+#if LWIP_TCP
+    struct mbed_lwip_socket *s = (struct mbed_lwip_socket *)handle;
+
+    if (NETCONNTYPE_GROUP(s->conn->type) != NETCONN_TCP) {
+        return NSAPI_ERROR_UNSUPPORTED;
+    }
+
+    nsapi_size_t total_written = 0;
+    for (int i = 0; i < iov_count; i++) {
+        size_t bytes_written = 0;
+        // Flag all but the last vector element as NETCONN_MORE, so lwIP
+        // coalesces the elements into segments instead of flushing each one
+        u8_t apiflags = NETCONN_COPY | ((i < iov_count - 1) ? NETCONN_MORE : 0);
+        err_t err = netconn_write_partly(s->conn, iov[i].iov_base, iov[i].iov_len, apiflags, &bytes_written);
+        total_written += bytes_written;
+        if (bytes_written > 0) {
+            adaptation.lock();
+            s->sent_enqueued += bytes_written;
+            adaptation.unlock();
+        }
+        if (err != ERR_OK) {
+            return (total_written > 0) ? (nsapi_size_or_error_t)total_written : err_remap(err);
+        }
+        if (bytes_written < iov[i].iov_len) {
+            break;
+        }
+    }
+
+    return (nsapi_size_or_error_t)total_written;
+#else
+    return NSAPI_ERROR_UNSUPPORTED;
+#endif
 }
 
 nsapi_size_or_error_t LWIP::socket_recv(nsapi_socket_t handle, void *data, nsapi_size_t size)
@@ -474,6 +675,73 @@ nsapi_size_or_error_t LWIP::socket_sendto(nsapi_socket_t handle, const SocketAdd
     return size;
 }
 
+nsapi_size_or_error_t LWIP::socket_sendtov(nsapi_socket_t handle, const SocketAddress &address,
+                                           const nsapi_iovec_t *iov, int iov_count)
+{
+    struct mbed_lwip_socket *s = (struct mbed_lwip_socket *)handle;
+    ip_addr_t ip_addr;
+
+    if (NETCONNTYPE_GROUP(s->conn->type) == NETCONN_TCP) {
+        // Connected-mode socket - the address is ignored
+        return socket_sendv(handle, iov, iov_count);
+    }
+
+    nsapi_addr_t addr = address.get_addr();
+    if (!convert_mbed_addr_to_lwip(&ip_addr, &addr)) {
+        return NSAPI_ERROR_PARAMETER;
+    }
+    struct netif *netif_ = netif_get_by_index(s->conn->pcb.ip->netif_idx);
+    if (!netif_) {
+        netif_ = &default_interface->netif;
+    }
+    if (netif_) {
+        if ((addr.version == NSAPI_IPv4 && !get_ipv4_addr(netif_)) ||
+                (addr.version == NSAPI_IPv6 && !get_ipv6_addr(netif_) && !get_ipv6_link_local_addr(netif_))) {
+            return NSAPI_ERROR_PARAMETER;
+        }
+    }
+
+    struct netbuf *buf = netbuf_new();
+    if (!buf) {
+        return NSAPI_ERROR_NO_MEMORY;
+    }
+
+    // Chain the vector elements as reference pbufs, so the datagram is
+    // gathered without copying. As with the netbuf_ref() path of
+    // socket_sendto, the caller's buffers are only referenced for the
+    // duration of the blocking netconn_sendto call.
+    struct pbuf *chain = NULL;
+    nsapi_size_t total = 0;
+    for (int i = 0; i < iov_count; i++) {
+        struct pbuf *p = pbuf_alloc(PBUF_TRANSPORT, 0, PBUF_REF);
+        if (!p) {
+            if (chain) {
+                pbuf_free(chain);
+            }
+            netbuf_delete(buf);
+            return NSAPI_ERROR_NO_MEMORY;
+        }
+        p->payload = const_cast<void *>(iov[i].iov_base);
+        p->len = p->tot_len = (u16_t)iov[i].iov_len;
+        total += iov[i].iov_len;
+        if (!chain) {
+            chain = p;
+        } else {
+            pbuf_cat(chain, p);
+        }
+    }
+    buf->p = chain;
+    buf->ptr = chain;
+
+    err_t err = netconn_sendto(s->conn, buf, &ip_addr, address.get_port());
+    netbuf_delete(buf);
+    if (err != ERR_OK) {
+        return err_remap(err);
+    }
+
+    return total;
+}
+
 nsapi_size_or_error_t LWIP::socket_recvfrom(nsapi_socket_t handle, SocketAddress *address, void *data, nsapi_size_t size)
 {
     struct mbed_lwip_socket *s = (struct mbed_lwip_socket *)handle;
@@ -497,6 +765,78 @@ nsapi_size_or_error_t LWIP::socket_recvfrom(nsapi_socket_t handle, SocketAddress
     return recv;
 }
 
+nsapi_size_or_error_t LWIP::socket_recvfrom_timestamp(nsapi_socket_t handle, SocketAddress *address,
+                                                      void *data, nsapi_size_t size,
+                                                      nsapi_timestamp_t *timestamp)
+{
+    struct mbed_lwip_socket *s = (struct mbed_lwip_socket *)handle;
+    struct netbuf *buf;
+
+    memset(timestamp, 0, sizeof(*timestamp));
+
+    err_t err = netconn_recv(s->conn, &buf);
+    if (err != ERR_OK) {
+        return err_remap(err);
+    }
+
+    if (address) {
+        nsapi_addr_t addr;
+        convert_lwip_addr_to_mbed(&addr, netbuf_fromaddr(buf));
+        address->set_addr(addr);
+        address->set_port(netbuf_fromport(buf));
+    }
+
+#if LWIP_PBUF_RX_TIMESTAMP
+    if (buf->p && (buf->p->flags & PBUF_FLAG_RX_TIMESTAMP)) {
+        timestamp->sec = buf->p->ts_sec;
+        timestamp->nsec = buf->p->ts_nsec;
+        timestamp->valid = 1;
+    }
+#endif
+
+    u16_t recv = netbuf_copy(buf, data, (u16_t)size);
+    netbuf_delete(buf);
+
+    return recv;
+}
+
+nsapi_size_or_error_t LWIP::socket_recvfrom_buffer(nsapi_socket_t handle, SocketAddress *address, net_stack_mem_buf_t **buffer)
+{
+    struct mbed_lwip_socket *s = (struct mbed_lwip_socket *)handle;
+    struct netbuf *buf;
+
+    if (NETCONNTYPE_GROUP(s->conn->type) != NETCONN_UDP) {
+        return NSAPI_ERROR_UNSUPPORTED;
+    }
+
+    err_t err = netconn_recv(s->conn, &buf);
+    if (err != ERR_OK) {
+        return err_remap(err);
+    }
+
+    if (address) {
+        nsapi_addr_t addr;
+        convert_lwip_addr_to_mbed(&addr, netbuf_fromaddr(buf));
+        address->set_addr(addr);
+        address->set_port(netbuf_fromport(buf));
+    }
+
+    // Detach the pbuf chain from the netbuf and hand its ownership to the
+    // caller, so the payload is consumed in place instead of being copied
+    struct pbuf *p = buf->p;
+    buf->p = NULL;
+    buf->ptr = NULL;
+    netbuf_delete(buf);
+
+    *buffer = p;
+    return p->tot_len;
+}
+
+NetStackMemoryManager *LWIP::get_memory_manager()
+{
+    return &memory_manager;
+}
+
 int32_t LWIP::find_multicast_member(const struct mbed_lwip_socket *s, const nsapi_ip_mreq_t *imr)
 {
     uint32_t count = 0;
@@ -0,0 +1,261 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string.h>
+
+#include "lwip/opt.h"
+#include "lwip/netif.h"
+#include "lwip/ip4_addr.h"
+#if LWIP_DHCP
+#include "lwip/dhcp.h"
+#endif
+#if LWIP_ARP
+#include "lwip/etharp.h"
+#endif
+
+#include "lwipstack/lwip_checkpoint.h"
+
+#if MBED_CONF_LWIP_CHECKPOINT_ENABLED && LWIP_IPV4
+
+#define CHECKPOINT_MAGIC 0x6e634b50 /* "ncKP" */
+
+/* Additive checksum over everything after the magic/sum header - enough to
+ * tell an unretained or half-written region from a real checkpoint. */
+static uint32_t checkpoint_sum(const lwip_checkpoint_t *cp)
+{
+    const uint8_t *p = (const uint8_t *)&cp->hwaddr[0];
+    const uint8_t *end = (const uint8_t *)cp + sizeof(*cp);
+    uint32_t sum = 0x6c774350;
+    while (p < end) {
+        sum = (sum << 5) + sum + *p++;
+    }
+    return sum;
+}
+
+#if LWIP_DHCP
+/* DHCP client state handed to lwIP when a lease is restored onto a netif
+ * that has not run dhcp_start() yet this boot. */
+static struct dhcp checkpoint_dhcp;
+#endif
+
+int lwip_checkpoint_save(struct netif *netif, lwip_checkpoint_t *cp)
+{
+    if (netif == NULL || cp == NULL) {
+        return -1;
+    }
+
+    memset(cp, 0, sizeof(*cp));
+
+    uint32_t addr = ip4_addr_get_u32(netif_ip4_addr(netif));
+    if (addr == IPADDR_ANY) {
+        return -1;
+    }
+    cp->ip = addr;
+    cp->netmask = ip4_addr_get_u32(netif_ip4_netmask(netif));
+    cp->gateway = ip4_addr_get_u32(netif_ip4_gw(netif));
+
+    cp->hwaddr_len = netif->hwaddr_len <= sizeof(cp->hwaddr) ? netif->hwaddr_len : sizeof(cp->hwaddr);
+    memcpy(cp->hwaddr, netif->hwaddr, cp->hwaddr_len);
+
+#if LWIP_DHCP
+    const struct dhcp *dhcp = netif_dhcp_data(netif);
+    if (dhcp != NULL && dhcp_supplied_address(netif)) {
+        cp->dhcp_valid = 1;
+        cp->dhcp_state = dhcp->state;
+        cp->dhcp_xid = dhcp->xid;
+        cp->dhcp_lease_used = dhcp->lease_used;
+        cp->dhcp_server = ip4_addr_get_u32(ip_2_ip4(&dhcp->server_ip_addr));
+        cp->dhcp_t0_lease = dhcp->offered_t0_lease;
+        cp->dhcp_t1_renew = dhcp->offered_t1_renew;
+        cp->dhcp_t2_rebind = dhcp->offered_t2_rebind;
+    }
+#endif
+
+#if LWIP_ARP
+    for (size_t i = 0; i < ARP_TABLE_SIZE && cp->arp_cnt < MBED_CONF_LWIP_CHECKPOINT_ARP_ENTRIES; i++) {
+        ip4_addr_t *entry_ip;
+        struct netif *entry_netif;
+        struct eth_addr *entry_eth;
+        if (!etharp_get_entry(i, &entry_ip, &entry_netif, &entry_eth)) {
+            continue;
+        }
+        if (entry_netif != NULL && entry_netif != netif) {
+            continue;
+        }
+        cp->arp[cp->arp_cnt].ip = ip4_addr_get_u32(entry_ip);
+        memcpy(cp->arp[cp->arp_cnt].eth, entry_eth->addr, sizeof(entry_eth->addr));
+        cp->arp_cnt++;
+    }
+#endif
+
+    cp->magic = CHECKPOINT_MAGIC;
+    cp->sum = checkpoint_sum(cp);
+
+    return 0;
+}
+
+int lwip_checkpoint_restore(struct netif *netif, lwip_checkpoint_t *cp, uint32_t slept_sec)
+{
+    if (netif == NULL || !lwip_checkpoint_valid(cp)) {
+        return -1;
+    }
+
+    /* State captured for a different adapter is useless - the lease and the
+     * peers' ARP caches are bound to the old MAC. */
+    if (cp->hwaddr_len != netif->hwaddr_len
+            || memcmp(cp->hwaddr, netif->hwaddr, cp->hwaddr_len) != 0) {
+        lwip_checkpoint_invalidate(cp);
+        return -1;
+    }
+
+#if LWIP_DHCP
+    uint32_t lease_used = 0;
+    if (cp->dhcp_valid) {
+        /* Age the lease by the time spent asleep; one that would have
+         * lapsed is rejected, as the server may have reassigned the
+         * address. Rounded up so a borderline lease errs on the safe side. */
+        lease_used = cp->dhcp_lease_used
+                     + (slept_sec + DHCP_COARSE_TIMER_SECS - 1) / DHCP_COARSE_TIMER_SECS;
+        if (lease_used * DHCP_COARSE_TIMER_SECS >= cp->dhcp_t0_lease) {
+            lwip_checkpoint_invalidate(cp);
+            return -1;
+        }
+    }
+#else
+    (void)slept_sec;
+#endif
+
+    ip4_addr_t addr, netmask, gateway;
+    ip4_addr_set_u32(&addr, cp->ip);
+    ip4_addr_set_u32(&netmask, cp->netmask);
+    ip4_addr_set_u32(&gateway, cp->gateway);
+    netif_set_addr(netif, &addr, &netmask, &gateway);
+
+#if LWIP_DHCP
+    if (cp->dhcp_valid) {
+        struct dhcp *dhcp = netif_dhcp_data(netif);
+        if (dhcp == NULL) {
+            memset(&checkpoint_dhcp, 0, sizeof(checkpoint_dhcp));
+            dhcp_set_struct(netif, &checkpoint_dhcp);
+            dhcp = &checkpoint_dhcp;
+        }
+        dhcp->state = cp->dhcp_state;
+        dhcp->xid = cp->dhcp_xid;
+        dhcp->lease_used = (u16_t)lease_used;
+        dhcp->subnet_mask_given = cp->netmask != IPADDR_ANY;
+        ip_addr_set_ip4_u32(&dhcp->server_ip_addr, cp->dhcp_server);
+        ip4_addr_set_u32(&dhcp->offered_ip_addr, cp->ip);
+        ip4_addr_set_u32(&dhcp->offered_sn_mask, cp->netmask);
+        ip4_addr_set_u32(&dhcp->offered_gw_addr, cp->gateway);
+        dhcp->offered_t0_lease = cp->dhcp_t0_lease;
+        dhcp->offered_t1_renew = cp->dhcp_t1_renew;
+        dhcp->offered_t2_rebind = cp->dhcp_t2_rebind;
+
+        /* Revalidate in the background when the client is live; when it is
+         * not, the lease data waits for the next dhcp_start() while the
+         * seeded address keeps traffic flowing. */
+        if (dhcp->pcb_allocated && netif_is_up(netif) && netif_is_link_up(netif)) {
+            dhcp_renew(netif);
+        }
+    }
+#endif
+
+#if LWIP_ARP
+#if ETHARP_SUPPORT_STATIC_ENTRIES
+    for (uint8_t i = 0; i < cp->arp_cnt; i++) {
+        ip4_addr_t entry_ip;
+        struct eth_addr entry_eth;
+        ip4_addr_set_u32(&entry_ip, cp->arp[i].ip);
+        memcpy(entry_eth.addr, cp->arp[i].eth, sizeof(entry_eth.addr));
+        etharp_add_static_entry(&entry_ip, &entry_eth);
+    }
+#endif
+    if (netif_is_link_up(netif)) {
+        etharp_gratuitous(netif);
+    }
+#endif
+
+    return 0;
+}
+
+int lwip_checkpoint_valid(const lwip_checkpoint_t *cp)
+{
+    return cp != NULL && cp->magic == CHECKPOINT_MAGIC && cp->sum == checkpoint_sum(cp);
+}
+
+void lwip_checkpoint_invalidate(lwip_checkpoint_t *cp)
+{
+    if (cp != NULL) {
+        cp->magic = 0;
+        cp->sum = 0;
+    }
+}
+
+int lwip_checkpoint_release_arp(struct netif *netif, const lwip_checkpoint_t *cp)
+{
+    if (netif == NULL || !lwip_checkpoint_valid(cp)) {
+        return -1;
+    }
+#if LWIP_ARP && ETHARP_SUPPORT_STATIC_ENTRIES
+    for (uint8_t i = 0; i < cp->arp_cnt; i++) {
+        ip4_addr_t entry_ip;
+        ip4_addr_set_u32(&entry_ip, cp->arp[i].ip);
+        etharp_remove_static_entry(&entry_ip);
+    }
+#endif
+    return 0;
+}
+
+#else /* MBED_CONF_LWIP_CHECKPOINT_ENABLED && LWIP_IPV4 */
+
+int lwip_checkpoint_save(struct netif *netif, lwip_checkpoint_t *cp)
+{
+    (void)netif;
+    (void)cp;
+    return -1;
+}
+
+int lwip_checkpoint_restore(struct netif *netif, lwip_checkpoint_t *cp, uint32_t slept_sec)
+{
+    (void)netif;
+    (void)cp;
+    (void)slept_sec;
+    return -1;
+}
+
+int lwip_checkpoint_valid(const lwip_checkpoint_t *cp)
+{
+    (void)cp;
+    return 0;
+}
+
+void lwip_checkpoint_invalidate(lwip_checkpoint_t *cp)
+{
+    if (cp != NULL) {
+        cp->magic = 0;
+        cp->sum = 0;
+    }
+}
+
+int lwip_checkpoint_release_arp(struct netif *netif, const lwip_checkpoint_t *cp)
+{
+    (void)netif;
+    (void)cp;
+    return -1;
+}
+
+#endif /* MBED_CONF_LWIP_CHECKPOINT_ENABLED && LWIP_IPV4 */
@@ -0,0 +1,81 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stddef.h>
+
+#include "lwip/opt.h"
+#include "lwip/memp.h"
+#include "lwip/stats.h"
+
+#include "lwipstack/lwip_stats_mbed.h"
+
+/* The per-pool counters live in each pool's memp_desc and are maintained
+ * by memp.c whenever MEMP_STATS is on (the default for statically
+ * allocated pools), independently of the full LWIP_STATS module. */
+
+int lwip_stats_mbed_pool_count(void)
+{
+#if MEMP_STATS
+    return MEMP_MAX;
+#else
+    return 0;
+#endif
+}
+
+int lwip_stats_mbed_get_pool(unsigned int index, lwip_stats_mbed_pool_t *stats)
+{
+#if MEMP_STATS
+    if (index >= MEMP_MAX || stats == NULL) {
+        return -1;
+    }
+    const struct memp_desc *desc = memp_pools[index];
+    stats->name = desc->desc;
+    stats->avail = desc->stats->avail;
+    stats->used = desc->stats->used;
+    stats->max = desc->stats->max;
+    stats->failed = desc->stats->err;
+    return 0;
+#else
+    (void) index;
+    (void) stats;
+    return -1;
+#endif
+}
+
+int lwip_stats_mbed_pools_exhausted(void)
+{
+    int exhausted = 0;
+#if MEMP_STATS
+    for (unsigned int i = 0; i < MEMP_MAX; i++) {
+        if (memp_pools[i]->stats->err != 0) {
+            exhausted++;
+        }
+    }
+#endif
+    return exhausted;
+}
+
+void lwip_stats_mbed_reset_pools(void)
+{
+#if MEMP_STATS
+    for (unsigned int i = 0; i < MEMP_MAX; i++) {
+        struct stats_mem *mem = memp_pools[i]->stats;
+        mem->max = mem->used;
+        mem->err = 0;
+    }
+#endif
+}
@@ -0,0 +1,62 @@
+/*
+ *  aes_alt.h
+ *
+ *  AES context for the generic crypto acceleration HAL
+ *
+ *  Copyright (C) 2026, ARM Limited, All Rights Reserved
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+#ifndef MBEDTLS_AES_ALT_H
+#define MBEDTLS_AES_ALT_H
+
+#if defined(MBEDTLS_AES_ALT)
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief AES context routed to the crypto acceleration HAL
+ *
+ * The raw key is kept in the context and handed to the HAL on every
+ * operation, so the context is plain memory: mbed TLS may copy or
+ * clone it freely and the HAL caches the expanded schedule if key
+ * expansion is costly on its engine.
+ */
+typedef struct mbedtls_aes_context {
+    unsigned char key[32];      /*!< raw key, encryption or decryption */
+    unsigned int keybits;       /*!< key size in bits, 0 when not keyed */
+} mbedtls_aes_context;
+
+#if defined(MBEDTLS_CIPHER_MODE_XTS)
+/**
+ * \brief AES-XTS context, one data key and one tweak key
+ */
+typedef struct mbedtls_aes_xts_context {
+    mbedtls_aes_context crypt;  /*!< context for the data unit */
+    mbedtls_aes_context tweak;  /*!< context for the tweak */
+} mbedtls_aes_xts_context;
+#endif /* MBEDTLS_CIPHER_MODE_XTS */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MBEDTLS_AES_ALT */
+
+#endif /* MBEDTLS_AES_ALT_H */
@@ -0,0 +1,71 @@
+/*
+ *  ecp_comb_tables.h
+ *
+ *  Copyright (c) 2026 Arm Limited
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef MBEDTLS_ECP_COMB_TABLES_H
+#define MBEDTLS_ECP_COMB_TABLES_H
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+#include "config.h"
+#else
+#include MBEDTLS_CONFIG_FILE
+#endif
+
+/* Define MBEDTLS_ECP_FIXED_POINT_TABLES (for example in the application's
+ * mbedtls user config) to seed base-point comb tables from constant data
+ * in flash instead of computing them on the first multiplication. The
+ * first ECDHE or ECDSA operation on a supported curve then skips the
+ * table precomputation, which dominates its cost on Cortex-M parts.
+ * Tables are provided for secp256r1 and secp384r1 and are only valid for
+ * the default MBEDTLS_ECP_WINDOW_SIZE of 6; unsupported curves or a
+ * non-default window fall back to runtime precomputation. */
+
+#if defined(MBEDTLS_ECP_FIXED_POINT_TABLES)
+
+#include "mbedtls/ecp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Fill a comb table from constant data, if available for this group.
+ *
+ * \param grp     ECP group the table is for (determines the curve).
+ * \param w       Comb window size the caller is about to use.
+ * \param T       Array of \p T_size initialized points to fill. Only the
+ *                X and Y coordinates are set, matching the normalized
+ *                form ecp_precompute_comb() leaves behind.
+ * \param T_size  Number of points, must be \c 1 << (w - 1).
+ *
+ * \return        0 on success, or MBEDTLS_ERR_ECP_FEATURE_UNAVAILABLE if
+ *                no stored table matches \p grp and \p w (the caller
+ *                should compute the table as usual), or an
+ *                \c MBEDTLS_ERR_MPI_XXX code on failure.
+ */
+int mbedtls_ecp_comb_table_load(const mbedtls_ecp_group *grp,
+                                unsigned char w,
+                                mbedtls_ecp_point T[],
+                                unsigned char T_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MBEDTLS_ECP_FIXED_POINT_TABLES */
+
+#endif /* MBEDTLS_ECP_COMB_TABLES_H */
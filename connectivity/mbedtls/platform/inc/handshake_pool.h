@@ -0,0 +1,93 @@
+/*
+ *  handshake_pool.h
+ *
+ *  Copyright (c) 2026 Arm Limited
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef MBEDTLS_HANDSHAKE_POOL_H
+#define MBEDTLS_HANDSHAKE_POOL_H
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+#include "config.h"
+#else
+#include MBEDTLS_CONFIG_FILE
+#endif
+
+#include <stddef.h>
+
+/* Size in bytes of a static pool that serves Mbed TLS heap allocations
+ * while at least one TLS socket exists. TLS handshakes make hundreds of
+ * short-lived MPI allocations; serving them from a dedicated pool keeps
+ * that churn out of the global heap, so reconnect cycles cannot fragment
+ * it. Requires MBEDTLS_PLATFORM_MEMORY; 0 (the default) disables the
+ * pool entirely. Size it from the peak usage reported by
+ * mbedtls_handshake_pool_stats() on a debug build; allocations that do
+ * not fit fall back to the global heap, so a pool that is too small
+ * degrades gracefully. */
+#ifndef MBED_CONF_MBEDTLS_HANDSHAKE_POOL_SIZE
+#define MBED_CONF_MBEDTLS_HANDSHAKE_POOL_SIZE 0
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(MBEDTLS_PLATFORM_MEMORY) && MBED_CONF_MBEDTLS_HANDSHAKE_POOL_SIZE > 0
+
+/** Usage counters for the handshake pool, see mbedtls_handshake_pool_stats(). */
+typedef struct mbedtls_handshake_pool_stats_t {
+    size_t current_bytes;   /**< bytes currently allocated from the pool */
+    size_t peak_bytes;      /**< high-water mark since the pool was last reset */
+    size_t failed_allocs;   /**< allocations that fell back to the heap */
+} mbedtls_handshake_pool_stats_t;
+
+/** Route Mbed TLS allocations through the static pool.
+ *
+ *  Called by TLSSocketWrapper when a TLS socket is created. The first
+ *  call installs the pool allocator via mbedtls_platform_set_calloc_free();
+ *  further calls only increment a reference count.
+ */
+void mbedtls_handshake_pool_attach(void);
+
+/** Balance a previous mbedtls_handshake_pool_attach().
+ *
+ *  When the last reference is dropped and no pool memory is still
+ *  allocated, the pool is reset wholesale so the next connection starts
+ *  from a clean, unfragmented arena.
+ */
+void mbedtls_handshake_pool_detach(void);
+
+/** Fill \p stats with the pool's usage counters. */
+void mbedtls_handshake_pool_stats(mbedtls_handshake_pool_stats_t *stats);
+
+#else /* MBEDTLS_PLATFORM_MEMORY && pool size > 0 */
+
+/* Pool disabled: keep the call sites in TLSSocketWrapper unconditional. */
+static inline void mbedtls_handshake_pool_attach(void)
+{
+}
+
+static inline void mbedtls_handshake_pool_detach(void)
+{
+}
+
+#endif /* MBEDTLS_PLATFORM_MEMORY && pool size > 0 */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MBEDTLS_HANDSHAKE_POOL_H */
@@ -62,6 +62,22 @@
 #include "mbedtls_device.h"
 #endif
 
+/* Targets implementing the generic crypto acceleration HAL get the AES
+ * and SHA-256 modules routed to hardware by the glue in platform/src,
+ * with no per-target ALT port. A target with a bespoke ALT keeps it:
+ * its mbedtls_device.h definitions above take precedence. */
+#if DEVICE_CRYPTO_ACCEL_AES
+#if !defined(MBEDTLS_AES_ALT)
+#define MBEDTLS_AES_ALT
+#endif
+#endif
+
+#if DEVICE_CRYPTO_ACCEL_SHA256
+#if !defined(MBEDTLS_SHA256_ALT)
+#define MBEDTLS_SHA256_ALT
+#endif
+#endif
+
 /*
  * MBEDTLS_ERR_PLATFORM_HW_FAILED is deprecated and should not be used.
  */
@@ -0,0 +1,53 @@
+/*
+ *  sha256_alt.h
+ *
+ *  SHA-256 context for the generic crypto acceleration HAL
+ *
+ *  Copyright (C) 2026, ARM Limited, All Rights Reserved
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+#ifndef MBEDTLS_SHA256_ALT_H
+#define MBEDTLS_SHA256_ALT_H
+
+#if defined(MBEDTLS_SHA256_ALT)
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief SHA-256 context routed to the crypto acceleration HAL
+ *
+ * Same layout as the software implementation; only the compression
+ * function is offloaded, so cloning and copying keep working and
+ * SHA-224 is served by the same engine entry point.
+ */
+typedef struct mbedtls_sha256_context {
+    uint32_t total[2];          /*!< number of bytes processed */
+    uint32_t state[8];          /*!< intermediate digest state */
+    unsigned char buffer[64];   /*!< data block being processed */
+    int is224;                  /*!< 0 = SHA-256, 1 = SHA-224 */
+} mbedtls_sha256_context;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MBEDTLS_SHA256_ALT */
+
+#endif /* MBEDTLS_SHA256_ALT_H */
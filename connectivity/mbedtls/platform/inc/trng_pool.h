@@ -0,0 +1,102 @@
+/*
+ *  trng_pool.h
+ *
+ *  Copyright (c) 2026 Arm Limited
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef MBEDTLS_TRNG_POOL_H
+#define MBEDTLS_TRNG_POOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Size in bytes of a ring buffer of pre-harvested TRNG output. Hardware
+ * TRNGs deliver bytes slowly (often well under 10 KB/s) with the CPU
+ * spinning, so the synchronous trng_get_bytes() calls made by Mbed TLS
+ * entropy collection can stall a TLS handshake for 100 ms or more. With
+ * the pool enabled the ring is refilled in the background while the
+ * system is otherwise idle and mbedtls_hardware_poll() is served from it
+ * instantly; only a request that finds the ring empty (the very first
+ * handshake after boot, typically) still waits on the hardware. 0 (the
+ * default) disables the pool and keeps the synchronous path. A TLS
+ * handshake draws a few hundred bytes of entropy, so 512-1024 covers
+ * back-to-back handshakes. */
+#ifndef MBED_CONF_MBEDTLS_TRNG_POOL_SIZE
+#define MBED_CONF_MBEDTLS_TRNG_POOL_SIZE 0
+#endif
+
+/* Refill watermark: a background refill is kicked off whenever the ring
+ * level drops below this many bytes. The default of half the ring trades
+ * harvesting duty cycle against headroom for bursts of requests; raise it
+ * towards the ring size if handshakes arrive in quick succession. */
+#ifndef MBED_CONF_MBEDTLS_TRNG_POOL_LOW_WATERMARK
+#define MBED_CONF_MBEDTLS_TRNG_POOL_LOW_WATERMARK (MBED_CONF_MBEDTLS_TRNG_POOL_SIZE / 2)
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if (defined(DEVICE_TRNG) || defined(FEATURE_PSA)) && MBED_CONF_MBEDTLS_TRNG_POOL_SIZE > 0
+
+/** Serve an entropy request from the pool.
+ *
+ *  Takes up to \p len pooled bytes; any shortfall is harvested
+ *  synchronously from the TRNG, so the call never returns fewer bytes
+ *  than the hardware could have produced directly. Dropping below the
+ *  refill watermark schedules a background refill.
+ *
+ *  Called by mbedtls_hardware_poll(); applications normally never call
+ *  it directly.
+ *
+ *  @param output  Buffer to fill.
+ *  @param len     Bytes requested.
+ *  @param olen    Receives the number of bytes written.
+ *  @return 0 on success, -1 if the TRNG failed and nothing was written.
+ */
+int mbedtls_trng_pool_get_bytes(unsigned char *output, size_t len, size_t *olen);
+
+/** Run one bounded harvest step (at most 32 bytes) if the ring is not full.
+ *
+ *  With the RTOS this is driven by an osPriorityLow background thread
+ *  that only runs when every other thread is blocked, so harvesting
+ *  steals no time from application code. On bare metal there is no such
+ *  thread; call this from the main loop or an idle hook to keep the
+ *  pool topped up.
+ *
+ *  Harvested bytes pass the SP 800-90B continuous health tests
+ *  (repetition count and adaptive proportion) before entering the ring;
+ *  failing bytes are discarded and counted.
+ */
+void mbedtls_trng_pool_poll(void);
+
+/** @return bytes currently available in the ring. */
+size_t mbedtls_trng_pool_level(void);
+
+/** @return number of harvested bytes discarded by the health tests.
+ *
+ *  A healthy TRNG keeps this at 0; a climbing count means the entropy
+ *  source is degrading and the hardware should be investigated.
+ */
+uint32_t mbedtls_trng_pool_health_failures(void);
+
+#endif /* (DEVICE_TRNG || FEATURE_PSA) && pool size > 0 */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MBEDTLS_TRNG_POOL_H */
@@ -0,0 +1,405 @@
+/* Copyright (c) 2026 Arm Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Generic MBEDTLS_AES_ALT implementation on top of the crypto
+ * acceleration HAL: any target that implements hal/crypto_accel_api.h
+ * and declares CRYPTO_ACCEL_AES gets the whole AES module routed to
+ * its engine without writing a bespoke ALT port. Chaining modes that
+ * the engine does not do natively are driven here from the block
+ * operation, so throughput still comes from hardware. */
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+#include "mbedtls/config.h"
+#else
+#include MBEDTLS_CONFIG_FILE
+#endif
+
+#if defined(MBEDTLS_AES_ALT) && DEVICE_CRYPTO_ACCEL_AES
+
+#include "mbedtls/aes.h"
+#include "mbedtls/platform_util.h"
+#include "hal/crypto_accel_api.h"
+#include <string.h>
+
+static int aes_keybits_supported(unsigned int keybits)
+{
+    uint32_t caps = crypto_accel_get_capabilities();
+    switch (keybits) {
+        case 128:
+            return caps & CRYPTO_ACCEL_CAP_AES_128;
+        case 192:
+            return caps & CRYPTO_ACCEL_CAP_AES_192;
+        case 256:
+            return caps & CRYPTO_ACCEL_CAP_AES_256;
+        default:
+            return 0;
+    }
+}
+
+static int aes_setkey(mbedtls_aes_context *ctx, const unsigned char *key,
+                      unsigned int keybits)
+{
+    if (keybits != 128 && keybits != 192 && keybits != 256) {
+        return MBEDTLS_ERR_AES_INVALID_KEY_LENGTH;
+    }
+    if (!aes_keybits_supported(keybits)) {
+        return MBEDTLS_ERR_AES_HW_ACCEL_FAILED;
+    }
+    memcpy(ctx->key, key, keybits / 8);
+    ctx->keybits = keybits;
+    return 0;
+}
+
+void mbedtls_aes_init(mbedtls_aes_context *ctx)
+{
+    memset(ctx, 0, sizeof(mbedtls_aes_context));
+}
+
+void mbedtls_aes_free(mbedtls_aes_context *ctx)
+{
+    if (ctx == NULL) {
+        return;
+    }
+    mbedtls_platform_zeroize(ctx, sizeof(mbedtls_aes_context));
+}
+
+int mbedtls_aes_setkey_enc(mbedtls_aes_context *ctx, const unsigned char *key,
+                           unsigned int keybits)
+{
+    return aes_setkey(ctx, key, keybits);
+}
+
+int mbedtls_aes_setkey_dec(mbedtls_aes_context *ctx, const unsigned char *key,
+                           unsigned int keybits)
+{
+    /* The HAL takes the direction with each call, so encryption and
+     * decryption keys are stored identically. */
+    return aes_setkey(ctx, key, keybits);
+}
+
+int mbedtls_internal_aes_encrypt(mbedtls_aes_context *ctx,
+                                 const unsigned char input[16],
+                                 unsigned char output[16])
+{
+    if (crypto_accel_aes_crypt_ecb(ctx->key, ctx->keybits, 1,
+                                   input, output, 1) != 0) {
+        return MBEDTLS_ERR_AES_HW_ACCEL_FAILED;
+    }
+    return 0;
+}
+
+int mbedtls_internal_aes_decrypt(mbedtls_aes_context *ctx,
+                                 const unsigned char input[16],
+                                 unsigned char output[16])
+{
+    if (crypto_accel_aes_crypt_ecb(ctx->key, ctx->keybits, 0,
+                                   input, output, 1) != 0) {
+        return MBEDTLS_ERR_AES_HW_ACCEL_FAILED;
+    }
+    return 0;
+}
+
+#if !defined(MBEDTLS_DEPRECATED_REMOVED)
+void mbedtls_aes_encrypt(mbedtls_aes_context *ctx,
+                         const unsigned char input[16],
+                         unsigned char output[16])
+{
+    mbedtls_internal_aes_encrypt(ctx, input, output);
+}
+
+void mbedtls_aes_decrypt(mbedtls_aes_context *ctx,
+                         const unsigned char input[16],
+                         unsigned char output[16])
+{
+    mbedtls_internal_aes_decrypt(ctx, input, output);
+}
+#endif /* !MBEDTLS_DEPRECATED_REMOVED */
+
+int mbedtls_aes_crypt_ecb(mbedtls_aes_context *ctx, int mode,
+                          const unsigned char input[16],
+                          unsigned char output[16])
+{
+    if (crypto_accel_aes_crypt_ecb(ctx->key, ctx->keybits,
+                                   mode == MBEDTLS_AES_ENCRYPT,
+                                   input, output, 1) != 0) {
+        return MBEDTLS_ERR_AES_HW_ACCEL_FAILED;
+    }
+    return 0;
+}
+
+#if defined(MBEDTLS_CIPHER_MODE_CBC)
+int mbedtls_aes_crypt_cbc(mbedtls_aes_context *ctx, int mode, size_t length,
+                          unsigned char iv[16], const unsigned char *input,
+                          unsigned char *output)
+{
+    if (length % 16 != 0) {
+        return MBEDTLS_ERR_AES_INVALID_INPUT_LENGTH;
+    }
+    /* Whole runs of blocks go to the HAL in one call; a weak default
+     * chains them from the block operation on engines without native
+     * CBC, and targets with chaining hardware override it. */
+    if (crypto_accel_aes_crypt_cbc(ctx->key, ctx->keybits,
+                                   mode == MBEDTLS_AES_ENCRYPT, iv,
+                                   input, output, length / 16) != 0) {
+        return MBEDTLS_ERR_AES_HW_ACCEL_FAILED;
+    }
+    return 0;
+}
+#endif /* MBEDTLS_CIPHER_MODE_CBC */
+
+#if defined(MBEDTLS_CIPHER_MODE_CFB)
+int mbedtls_aes_crypt_cfb128(mbedtls_aes_context *ctx, int mode, size_t length,
+                             size_t *iv_off, unsigned char iv[16],
+                             const unsigned char *input, unsigned char *output)
+{
+    size_t n = *iv_off;
+    int ret;
+
+    if (n > 15) {
+        return MBEDTLS_ERR_AES_BAD_INPUT_DATA;
+    }
+    while (length--) {
+        if (n == 0) {
+            if ((ret = mbedtls_internal_aes_encrypt(ctx, iv, iv)) != 0) {
+                return ret;
+            }
+        }
+        if (mode == MBEDTLS_AES_DECRYPT) {
+            unsigned char c = *input++;
+            *output++ = c ^ iv[n];
+            iv[n] = c;
+        } else {
+            iv[n] = *output++ = (unsigned char)(iv[n] ^ *input++);
+        }
+        n = (n + 1) & 0x0F;
+    }
+    *iv_off = n;
+    return 0;
+}
+
+int mbedtls_aes_crypt_cfb8(mbedtls_aes_context *ctx, int mode, size_t length,
+                           unsigned char iv[16], const unsigned char *input,
+                           unsigned char *output)
+{
+    unsigned char c;
+    unsigned char ov[17];
+    int ret;
+
+    while (length--) {
+        memcpy(ov, iv, 16);
+        if ((ret = mbedtls_internal_aes_encrypt(ctx, iv, iv)) != 0) {
+            return ret;
+        }
+        if (mode == MBEDTLS_AES_DECRYPT) {
+            ov[16] = *input;
+        }
+        c = *output++ = (unsigned char)(iv[0] ^ *input++);
+        if (mode == MBEDTLS_AES_ENCRYPT) {
+            ov[16] = c;
+        }
+        memcpy(iv, ov + 1, 16);
+    }
+    return 0;
+}
+#endif /* MBEDTLS_CIPHER_MODE_CFB */
+
+#if defined(MBEDTLS_CIPHER_MODE_OFB)
+int mbedtls_aes_crypt_ofb(mbedtls_aes_context *ctx, size_t length,
+                          size_t *iv_off, unsigned char iv[16],
+                          const unsigned char *input, unsigned char *output)
+{
+    size_t n = *iv_off;
+    int ret;
+
+    if (n > 15) {
+        return MBEDTLS_ERR_AES_BAD_INPUT_DATA;
+    }
+    while (length--) {
+        if (n == 0) {
+            if ((ret = mbedtls_internal_aes_encrypt(ctx, iv, iv)) != 0) {
+                return ret;
+            }
+        }
+        *output++ = *input++ ^ iv[n];
+        n = (n + 1) & 0x0F;
+    }
+    *iv_off = n;
+    return 0;
+}
+#endif /* MBEDTLS_CIPHER_MODE_OFB */
+
+#if defined(MBEDTLS_CIPHER_MODE_CTR)
+int mbedtls_aes_crypt_ctr(mbedtls_aes_context *ctx, size_t length,
+                          size_t *nc_off, unsigned char nonce_counter[16],
+                          unsigned char stream_block[16],
+                          const unsigned char *input, unsigned char *output)
+{
+    size_t n = *nc_off;
+    int ret;
+
+    if (n > 15) {
+        return MBEDTLS_ERR_AES_BAD_INPUT_DATA;
+    }
+    while (length--) {
+        if (n == 0) {
+            if ((ret = mbedtls_internal_aes_encrypt(ctx, nonce_counter,
+                                                    stream_block)) != 0) {
+                return ret;
+            }
+            for (int i = 16; i > 0; i--) {
+                if (++nonce_counter[i - 1] != 0) {
+                    break;
+                }
+            }
+        }
+        *output++ = *input++ ^ stream_block[n];
+        n = (n + 1) & 0x0F;
+    }
+    *nc_off = n;
+    return 0;
+}
+#endif /* MBEDTLS_CIPHER_MODE_CTR */
+
+#if defined(MBEDTLS_CIPHER_MODE_XTS)
+void mbedtls_aes_xts_init(mbedtls_aes_xts_context *ctx)
+{
+    mbedtls_aes_init(&ctx->crypt);
+    mbedtls_aes_init(&ctx->tweak);
+}
+
+void mbedtls_aes_xts_free(mbedtls_aes_xts_context *ctx)
+{
+    if (ctx == NULL) {
+        return;
+    }
+    mbedtls_aes_free(&ctx->crypt);
+    mbedtls_aes_free(&ctx->tweak);
+}
+
+static int aes_xts_setkey(mbedtls_aes_xts_context *ctx,
+                          const unsigned char *key, unsigned int keybits)
+{
+    /* The XTS key is the data key and the tweak key concatenated. */
+    if (keybits != 256 && keybits != 512) {
+        return MBEDTLS_ERR_AES_INVALID_KEY_LENGTH;
+    }
+    unsigned int half = keybits / 2;
+    int ret = aes_setkey(&ctx->crypt, key, half);
+    if (ret != 0) {
+        return ret;
+    }
+    return aes_setkey(&ctx->tweak, key + half / 8, half);
+}
+
+int mbedtls_aes_xts_setkey_enc(mbedtls_aes_xts_context *ctx,
+                               const unsigned char *key, unsigned int keybits)
+{
+    return aes_xts_setkey(ctx, key, keybits);
+}
+
+int mbedtls_aes_xts_setkey_dec(mbedtls_aes_xts_context *ctx,
+                               const unsigned char *key, unsigned int keybits)
+{
+    return aes_xts_setkey(ctx, key, keybits);
+}
+
+/* Multiply by x in GF(2^128) with the little-endian byte order XTS uses. */
+static void aes_xts_mult_x(unsigned char r[16], const unsigned char x[16])
+{
+    unsigned char carry = 0;
+
+    for (int i = 0; i < 16; i++) {
+        unsigned char next_carry = x[i] >> 7;
+        r[i] = (unsigned char)((x[i] << 1) | carry);
+        carry = next_carry;
+    }
+    if (carry) {
+        r[0] ^= 0x87;
+    }
+}
+
+int mbedtls_aes_crypt_xts(mbedtls_aes_xts_context *ctx, int mode,
+                          size_t length, const unsigned char data_unit[16],
+                          const unsigned char *input, unsigned char *output)
+{
+    size_t blocks = length / 16;
+    size_t leftover = length % 16;
+    unsigned char tweak[16];
+    unsigned char prev_tweak[16];
+    unsigned char tmp[16];
+    int ret;
+
+    /* A data unit is at least one block and at most 2^20 blocks. */
+    if (length < 16 || length > (1 << 20) * 16) {
+        return MBEDTLS_ERR_AES_INVALID_INPUT_LENGTH;
+    }
+
+    ret = mbedtls_aes_crypt_ecb(&ctx->tweak, MBEDTLS_AES_ENCRYPT,
+                                data_unit, tweak);
+    if (ret != 0) {
+        return ret;
+    }
+
+    while (blocks--) {
+        if (leftover && mode == MBEDTLS_AES_DECRYPT && blocks == 0) {
+            /* Ciphertext stealing on decryption uses the tweaks in the
+             * opposite order: the next tweak decrypts this, the last
+             * full block, and the current one is kept for the tail. */
+            memcpy(prev_tweak, tweak, sizeof(tweak));
+            aes_xts_mult_x(tweak, tweak);
+        }
+        for (int i = 0; i < 16; i++) {
+            tmp[i] = input[i] ^ tweak[i];
+        }
+        ret = mbedtls_aes_crypt_ecb(&ctx->crypt, mode, tmp, tmp);
+        if (ret != 0) {
+            return ret;
+        }
+        for (int i = 0; i < 16; i++) {
+            output[i] = tmp[i] ^ tweak[i];
+        }
+        aes_xts_mult_x(tweak, tweak);
+        input += 16;
+        output += 16;
+    }
+
+    if (leftover) {
+        /* Ciphertext stealing: the tail swaps bytes with the last full
+         * block, which is processed once more. */
+        unsigned char *t = (mode == MBEDTLS_AES_DECRYPT) ? prev_tweak : tweak;
+        unsigned char *prev_output = output - 16;
+        size_t i;
+
+        for (i = 0; i < leftover; i++) {
+            output[i] = prev_output[i];
+            tmp[i] = input[i] ^ t[i];
+        }
+        for (; i < 16; i++) {
+            tmp[i] = prev_output[i] ^ t[i];
+        }
+        ret = mbedtls_aes_crypt_ecb(&ctx->crypt, mode, tmp, tmp);
+        if (ret != 0) {
+            return ret;
+        }
+        for (i = 0; i < 16; i++) {
+            prev_output[i] = tmp[i] ^ t[i];
+        }
+    }
+    return 0;
+}
+#endif /* MBEDTLS_CIPHER_MODE_XTS */
+
+#endif /* MBEDTLS_AES_ALT && DEVICE_CRYPTO_ACCEL_AES */
@@ -0,0 +1,508 @@
+/*
+ *  ecp_comb_tables.c
+ *
+ *  Copyright (c) 2026 Arm Limited
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/* Constant base-point comb tables for MBEDTLS_ECP_FIXED_POINT_TABLES.
+ *
+ * Each table holds the 1 << (w - 1) points that ecp_precompute_comb()
+ * would compute for P = G with the window size ecp_pick_window_size()
+ * picks for that curve under the default MBEDTLS_ECP_WINDOW_SIZE of 6.
+ * Points are stored as big-endian X then Y (Z is implicitly 1, as the
+ * runtime table stores it after normalization). The data was produced
+ * by running ecp_precompute_comb() itself on a host build of this
+ * module and dumping the cached group table, so it stays valid as long
+ * as the comb recoding in ecp.c is unchanged. */
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+#include "config.h"
+#else
+#include MBEDTLS_CONFIG_FILE
+#endif
+
+#if defined(MBEDTLS_ECP_C) && defined(MBEDTLS_ECP_FIXED_POINT_TABLES)
+
+#include "ecp_comb_tables.h"
+
+#if defined(MBEDTLS_ECP_DP_SECP256R1_ENABLED)
+/* secp256r1: w = 5, 16 points, 32-byte coordinates */
+static const unsigned char ecp_comb_table_secp256r1[16 * 2 * 32] = {
+    0x6b, 0x17, 0xd1, 0xf2, 0xe1, 0x2c, 0x42, 0x47, 0xf8, 0xbc, 0xe6, 0xe5,
+    0x63, 0xa4, 0x40, 0xf2, 0x77, 0x03, 0x7d, 0x81, 0x2d, 0xeb, 0x33, 0xa0,
+    0xf4, 0xa1, 0x39, 0x45, 0xd8, 0x98, 0xc2, 0x96,
+    0x4f, 0xe3, 0x42, 0xe2, 0xfe, 0x1a, 0x7f, 0x9b, 0x8e, 0xe7, 0xeb, 0x4a,
+    0x7c, 0x0f, 0x9e, 0x16, 0x2b, 0xce, 0x33, 0x57, 0x6b, 0x31, 0x5e, 0xce,
+    0xcb, 0xb6, 0x40, 0x68, 0x37, 0xbf, 0x51, 0xf5,
+
+    0x3c, 0xfa, 0x0f, 0x87, 0x29, 0x7b, 0xed, 0x02, 0xdf, 0xcc, 0x23, 0x58,
+    0xf9, 0x4c, 0x9d, 0x1d, 0x59, 0x3a, 0x09, 0xa0, 0x3a, 0x23, 0xc6, 0xab,
+    0xf7, 0xd2, 0x4b, 0xb7, 0x04, 0xba, 0xc8, 0x70,
+    0xe4, 0xe3, 0x76, 0x94, 0x70, 0xbe, 0x12, 0xc6, 0xa7, 0x58, 0xaa, 0x80,
+    0x83, 0x09, 0xaf, 0x9b, 0x62, 0x12, 0x1c, 0x0d, 0x02, 0x48, 0xa8, 0xaf,
+    0xce, 0x98, 0xa3, 0x0b, 0x40, 0xf2, 0x69, 0x40,
+
+    0xd6, 0x69, 0x03, 0x37, 0x6d, 0xf0, 0xfd, 0x5e, 0x28, 0xfe, 0x9a, 0x4f,
+    0x25, 0x4c, 0x54, 0x91, 0xf6, 0xd7, 0x7c, 0x27, 0x08, 0x8b, 0x86, 0xdb,
+    0xdd, 0x37, 0xe3, 0xff, 0x86, 0xef, 0x7d, 0x7d,
+    0x20, 0xe2, 0xa5, 0x3c, 0xe6, 0xd1, 0x3d, 0x22, 0xa1, 0x3e, 0x95, 0x78,
+    0xdf, 0x07, 0x41, 0x67, 0xf3, 0xd1, 0xa7, 0xaf, 0x9e, 0x43, 0x73, 0xf9,
+    0x9f, 0xf0, 0x49, 0x92, 0xad, 0xda, 0xd5, 0x96,
+
+    0x62, 0x1c, 0x75, 0xd1, 0x02, 0xea, 0xdb, 0x2e, 0xdb, 0x82, 0xb3, 0xea,
+    0x54, 0x49, 0x20, 0xa4, 0xc3, 0x02, 0xf8, 0xf4, 0x96, 0xbe, 0xa2, 0x5a,
+    0xae, 0xbf, 0xd7, 0x35, 0x52, 0x5d, 0x6a, 0xbf,
+    0xd7, 0xc4, 0xa4, 0xfe, 0xb4, 0xfa, 0x64, 0x9d, 0x4f, 0xda, 0xc9, 0x6f,
+    0x52, 0x2d, 0x7f, 0x70, 0x22, 0x5d, 0x03, 0xd8, 0x57, 0xc4, 0x6d, 0x63,
+    0x89, 0x39, 0xdc, 0x4c, 0x9e, 0xf4, 0x85, 0xf0,
+
+    0x00, 0xdc, 0x46, 0xe7, 0xc9, 0x9a, 0x73, 0x9d, 0x9f, 0x05, 0xf9, 0x4a,
+    0x8c, 0x26, 0x7d, 0x88, 0xf7, 0x65, 0x99, 0x58, 0xed, 0xd9, 0x58, 0x3f,
+    0x8b, 0xc6, 0x59, 0xaa, 0xc0, 0xb9, 0x37, 0x2a,
+    0x03, 0x12, 0xa5, 0x57, 0x45, 0x79, 0x34, 0x24, 0x40, 0xd1, 0xe3, 0xab,
+    0x52, 0x28, 0xc1, 0x11, 0xb5, 0xeb, 0x20, 0x2d, 0x81, 0x56, 0xbf, 0x6a,
+    0x4a, 0xf5, 0x0a, 0x00, 0xdf, 0x55, 0xd0, 0xf2,
+
+    0x3c, 0x53, 0xe2, 0x90, 0x15, 0xb0, 0xa1, 0xe5, 0x76, 0x34, 0x7a, 0x52,
+    0x84, 0xe3, 0x2e, 0x59, 0x05, 0xe3, 0xf2, 0x23, 0x0d, 0x8c, 0x01, 0x3d,
+    0x8d, 0x96, 0x92, 0xf7, 0x7e, 0xb8, 0xcf, 0xee,
+    0xd3, 0x0e, 0x7c, 0xda, 0x14, 0x0e, 0xfe, 0xb3, 0x11, 0xa9, 0xf0, 0x72,
+    0x9a, 0x08, 0x69, 0x3f, 0x1b, 0x9f, 0x1b, 0xd1, 0x00, 0xd2, 0x35, 0x91,
+    0x53, 0x8b, 0x7d, 0xa5, 0xfa, 0xe7, 0x98, 0xd4,
+
+    0xed, 0x84, 0xbb, 0x42, 0x5f, 0xe3, 0x9a, 0xad, 0xfd, 0x42, 0x6d, 0x94,
+    0x2d, 0xf2, 0x32, 0xcf, 0x13, 0xd7, 0x2b, 0x7a, 0x3f, 0x7f, 0xbe, 0x90,
+    0x6d, 0xfc, 0xf7, 0x87, 0xf8, 0xe8, 0xf6, 0x83,
+    0xa3, 0x23, 0x34, 0x55, 0x58, 0x3c, 0x33, 0xf2, 0x0c, 0xf8, 0x3b, 0x61,
+    0x97, 0xa1, 0xd7, 0x03, 0x67, 0xdd, 0x0a, 0x8e, 0x35, 0x54, 0x30, 0xe3,
+    0x02, 0x3e, 0x67, 0xa1, 0x73, 0x29, 0x95, 0xfc,
+
+    0x95, 0xe1, 0x84, 0x52, 0x66, 0x38, 0x2a, 0xda, 0xb3, 0x1d, 0x23, 0x53,
+    0x1b, 0x4d, 0x0d, 0x1f, 0x50, 0xcc, 0x51, 0xc1, 0x8a, 0x4e, 0xee, 0x61,
+    0xce, 0xbb, 0xbc, 0x7b, 0x5f, 0x16, 0x5d, 0x99,
+    0x68, 0xd6, 0x8c, 0x8f, 0x6b, 0x0f, 0xb8, 0xf3, 0x3e, 0xaa, 0x82, 0x89,
+    0x1f, 0x4f, 0xa1, 0x2f, 0xa0, 0xa2, 0xa9, 0x6e, 0x41, 0x42, 0xff, 0x0f,
+    0xac, 0xad, 0x4f, 0x81, 0x0a, 0x83, 0x9b, 0x5b,
+
+    0x54, 0xe2, 0x44, 0xd5, 0x10, 0x1e, 0x5d, 0xe4, 0x9d, 0x3d, 0xc3, 0x34,
+    0x6b, 0xec, 0xcb, 0xb9, 0xe8, 0x0f, 0x26, 0xbd, 0x8d, 0x0f, 0x4f, 0x65,
+    0x93, 0x11, 0xa2, 0x69, 0x51, 0xbb, 0xb3, 0xf1,
+    0xd6, 0xbb, 0xec, 0x0e, 0xec, 0x10, 0x6e, 0xb6, 0x19, 0xbd, 0x41, 0x07,
+    0x35, 0xdf, 0x9c, 0x25, 0x43, 0x34, 0xfb, 0xc0, 0x58, 0xc2, 0xe3, 0xb7,
+    0xb3, 0xad, 0x4c, 0x6e, 0xf1, 0xb1, 0x9e, 0x28,
+
+    0xee, 0x08, 0x16, 0xa3, 0xd4, 0xd0, 0x21, 0xb6, 0x10, 0xb3, 0x7e, 0xcd,
+    0x77, 0x1e, 0x46, 0x88, 0xae, 0xa3, 0xc9, 0xe0, 0xb9, 0xb5, 0x29, 0x0b,
+    0xe8, 0x88, 0x1a, 0x83, 0x3f, 0xef, 0xcf, 0xc8,
+    0xc4, 0xa4, 0x38, 0xe3, 0xad, 0x90, 0x06, 0xe1, 0x3a, 0x5f, 0xdf, 0x82,
+    0xdb, 0x49, 0x01, 0x9f, 0x48, 0x91, 0x5d, 0xcf, 0xc1, 0x05, 0xf2, 0xd1,
+    0x8e, 0x99, 0x29, 0xbf, 0xb3, 0xa8, 0xca, 0xa1,
+
+    0x86, 0x99, 0xdd, 0x31, 0xe0, 0x9c, 0xb9, 0xf0, 0x55, 0x27, 0x88, 0xac,
+    0xcb, 0xd2, 0x1e, 0x33, 0xca, 0x9f, 0x7a, 0x1d, 0xae, 0xd0, 0x35, 0xbe,
+    0x5d, 0x6d, 0xc5, 0x03, 0xe8, 0x3a, 0xd2, 0xc9,
+    0x16, 0xe6, 0x54, 0x84, 0xe9, 0x28, 0x59, 0xb7, 0x24, 0x19, 0x99, 0x08,
+    0xc7, 0x2c, 0x78, 0xc1, 0x4c, 0xb2, 0x0e, 0x96, 0xb8, 0x2a, 0x5a, 0xf9,
+    0x38, 0x58, 0x41, 0x96, 0x32, 0x9b, 0xf9, 0x61,
+
+    0x18, 0x6c, 0x7f, 0x79, 0x3d, 0xf3, 0x24, 0x5e, 0xc9, 0xb9, 0x7d, 0x37,
+    0x4b, 0x60, 0x0b, 0x83, 0x5f, 0x0b, 0x46, 0xd5, 0xe9, 0x9d, 0x5c, 0x7c,
+    0xa2, 0x0a, 0x2c, 0x70, 0xdb, 0x30, 0x38, 0xdd,
+    0x9c, 0x42, 0x8d, 0xb8, 0x9a, 0xb5, 0x89, 0x13, 0x81, 0x39, 0xb3, 0x6a,
+    0x8d, 0x2e, 0xa7, 0x97, 0x92, 0x49, 0x89, 0x7f, 0x91, 0xe2, 0xd8, 0xed,
+    0x2a, 0xf7, 0x24, 0x60, 0x4f, 0x1c, 0xe5, 0x7f,
+
+    0xc6, 0x2e, 0x15, 0x5c, 0x58, 0xa5, 0xf2, 0x63, 0x5b, 0xc5, 0x34, 0x1e,
+    0x27, 0x1a, 0x93, 0xf1, 0x5f, 0x72, 0xcc, 0x22, 0x59, 0x5e, 0x65, 0x47,
+    0x1f, 0x1e, 0x4f, 0x3f, 0x4b, 0xe6, 0x45, 0x8d,
+    0xff, 0x9f, 0x23, 0x22, 0x18, 0x26, 0x7e, 0x4e, 0xd3, 0x3a, 0x76, 0x57,
+    0xee, 0xaa, 0x4d, 0x04, 0x67, 0xe1, 0xf7, 0xdc, 0x7e, 0x36, 0xa6, 0xad,
+    0x5f, 0x6f, 0x84, 0x5a, 0x58, 0xba, 0x7f, 0xf4,
+
+    0x5e, 0x67, 0x7d, 0x0c, 0x95, 0x9c, 0x44, 0xfa, 0xa4, 0x48, 0x69, 0x16,
+    0xf4, 0x64, 0x6f, 0x9f, 0x40, 0x30, 0xec, 0xc3, 0xbb, 0x90, 0x02, 0xd8,
+    0xe3, 0x3f, 0x02, 0x55, 0xc7, 0x64, 0x4c, 0x1d,
+    0x44, 0x9f, 0x0c, 0xe6, 0x31, 0x00, 0xd3, 0x1e, 0xe3, 0x3d, 0x0b, 0xd5,
+    0x02, 0x99, 0x3a, 0xea, 0x5d, 0x93, 0xa8, 0x6f, 0x62, 0x48, 0xf9, 0x1f,
+    0xe2, 0xe7, 0xd7, 0xd0, 0xd8, 0x8b, 0x91, 0x44,
+
+    0xe4, 0xda, 0x88, 0xe9, 0x93, 0xd0, 0xcb, 0x92, 0x2a, 0x84, 0x94, 0x71,
+    0xa5, 0x91, 0xf8, 0x53, 0x68, 0xc0, 0xcd, 0x44, 0x31, 0x27, 0x35, 0x4c,
+    0x52, 0xdf, 0x15, 0x88, 0xfd, 0xaa, 0xb2, 0x56,
+    0xf7, 0xfa, 0x4d, 0x15, 0x10, 0x06, 0x2e, 0x80, 0x97, 0xfc, 0x50, 0xde,
+    0xd0, 0xf3, 0xbc, 0x51, 0x60, 0xfe, 0x2a, 0x36, 0x26, 0x37, 0x07, 0xba,
+    0x6d, 0x1e, 0xa3, 0x5d, 0x16, 0x39, 0xc6, 0x24,
+
+    0x82, 0x5f, 0x01, 0x94, 0x8e, 0x83, 0x1d, 0x5b, 0x76, 0xc4, 0xc1, 0x80,
+    0x42, 0x86, 0xfb, 0x42, 0x1a, 0x25, 0x30, 0xb0, 0x5a, 0x00, 0x16, 0x9c,
+    0x2e, 0x75, 0xa2, 0x66, 0x5b, 0x69, 0x65, 0x27,
+    0x43, 0x58, 0x72, 0xfe, 0xbc, 0x72, 0x3a, 0x17, 0x61, 0x79, 0x4c, 0x4f,
+    0x24, 0x11, 0x11, 0x50, 0x10, 0x6f, 0x9b, 0xc4, 0xce, 0x5b, 0x10, 0x6a,
+    0xdb, 0xf0, 0xa1, 0x1f, 0xef, 0x70, 0x37, 0x39,
+};
+#endif /* MBEDTLS_ECP_DP_SECP256R1_ENABLED */
+
+#if defined(MBEDTLS_ECP_DP_SECP384R1_ENABLED)
+/* secp384r1: w = 6, 32 points, 48-byte coordinates */
+static const unsigned char ecp_comb_table_secp384r1[32 * 2 * 48] = {
+    0xaa, 0x87, 0xca, 0x22, 0xbe, 0x8b, 0x05, 0x37, 0x8e, 0xb1, 0xc7, 0x1e,
+    0xf3, 0x20, 0xad, 0x74, 0x6e, 0x1d, 0x3b, 0x62, 0x8b, 0xa7, 0x9b, 0x98,
+    0x59, 0xf7, 0x41, 0xe0, 0x82, 0x54, 0x2a, 0x38, 0x55, 0x02, 0xf2, 0x5d,
+    0xbf, 0x55, 0x29, 0x6c, 0x3a, 0x54, 0x5e, 0x38, 0x72, 0x76, 0x0a, 0xb7,
+    0x36, 0x17, 0xde, 0x4a, 0x96, 0x26, 0x2c, 0x6f, 0x5d, 0x9e, 0x98, 0xbf,
+    0x92, 0x92, 0xdc, 0x29, 0xf8, 0xf4, 0x1d, 0xbd, 0x28, 0x9a, 0x14, 0x7c,
+    0xe9, 0xda, 0x31, 0x13, 0xb5, 0xf0, 0xb8, 0xc0, 0x0a, 0x60, 0xb1, 0xce,
+    0x1d, 0x7e, 0x81, 0x9d, 0x7a, 0x43, 0x1d, 0x7c, 0x90, 0xea, 0x0e, 0x5f,
+
+    0xbd, 0xa8, 0xcb, 0xb3, 0x52, 0xe8, 0x56, 0x54, 0xac, 0x84, 0x76, 0xf6,
+    0x41, 0x78, 0x9d, 0xe5, 0x85, 0x2c, 0xc3, 0xab, 0xa3, 0x7b, 0x75, 0x52,
+    0xe7, 0x53, 0xed, 0xd8, 0xcf, 0x2c, 0xbc, 0x3d, 0xbc, 0xb6, 0xf7, 0x06,
+    0xb7, 0xeb, 0xf3, 0x17, 0x37, 0x1f, 0xdb, 0x78, 0x2c, 0x00, 0x92, 0x46,
+    0x23, 0xbc, 0x95, 0xbe, 0x59, 0xee, 0xa2, 0xc2, 0xd9, 0x07, 0xb0, 0x6a,
+    0x9b, 0x9b, 0x80, 0x5f, 0x94, 0x60, 0x99, 0x01, 0x8a, 0x2d, 0x49, 0xd1,
+    0x7a, 0xd4, 0xc7, 0x4d, 0xe6, 0x90, 0xeb, 0x4c, 0x4c, 0x50, 0xf6, 0x7c,
+    0x1c, 0xce, 0x0f, 0x01, 0xda, 0x1b, 0x89, 0xb6, 0xa4, 0xae, 0xf2, 0x6d,
+
+    0xde, 0x3e, 0x77, 0xfb, 0xc2, 0x01, 0x04, 0x34, 0xc7, 0x9c, 0xf8, 0x24,
+    0x50, 0xb9, 0x21, 0x55, 0x7e, 0x6e, 0xe5, 0xf4, 0x84, 0x9e, 0x29, 0x9f,
+    0x67, 0xfc, 0x32, 0x94, 0x08, 0xa7, 0x08, 0x30, 0x58, 0x6e, 0xa8, 0x87,
+    0x80, 0x91, 0xac, 0xcf, 0x98, 0x1f, 0xfb, 0x59, 0xae, 0x56, 0x9d, 0xe6,
+    0xe3, 0x0d, 0xf4, 0xb8, 0x4d, 0xb8, 0x10, 0xd9, 0x00, 0xd1, 0x9c, 0xe0,
+    0x32, 0x57, 0x69, 0x92, 0xe1, 0xc2, 0x86, 0x45, 0x17, 0xeb, 0xe7, 0x1c,
+    0x75, 0x7e, 0x49, 0x3b, 0xf8, 0x43, 0xca, 0xe9, 0x8e, 0x5e, 0x92, 0xfa,
+    0x43, 0xcf, 0x88, 0xb6, 0xa6, 0xec, 0x9d, 0xc7, 0xe3, 0xee, 0x38, 0x00,
+
+    0xad, 0xd3, 0xb7, 0xe9, 0xc4, 0x24, 0x59, 0x00, 0x58, 0x1b, 0x7c, 0xfa,
+    0x41, 0x7c, 0x18, 0xa3, 0xef, 0x8d, 0x50, 0xa1, 0x43, 0x1e, 0xf8, 0x4d,
+    0x5a, 0x2a, 0x19, 0xfa, 0x40, 0x19, 0xbd, 0x55, 0xa3, 0x0c, 0x60, 0x4d,
+    0x3b, 0xe4, 0x71, 0x4f, 0x16, 0x27, 0x39, 0x79, 0xb2, 0x9a, 0xdc, 0x60,
+    0x6f, 0xb0, 0x07, 0x0f, 0x52, 0x3c, 0x7d, 0xda, 0x30, 0x40, 0xaf, 0x18,
+    0xba, 0x61, 0x74, 0xf4, 0xfe, 0x37, 0x1b, 0x18, 0x5d, 0xb1, 0x18, 0x6c,
+    0x71, 0x1a, 0x52, 0x92, 0x18, 0x87, 0x02, 0x84, 0x34, 0x42, 0x1d, 0x86,
+    0xa3, 0x19, 0xb2, 0x7b, 0xb7, 0x6f, 0x45, 0x54, 0x63, 0x3d, 0x01, 0xbb,
+
+    0xaa, 0xb8, 0xbb, 0x9f, 0x0f, 0xdc, 0x30, 0x88, 0x56, 0x7a, 0x62, 0x33,
+    0xcd, 0x6c, 0xe3, 0xa3, 0x9b, 0xb1, 0x83, 0xb2, 0x70, 0xb3, 0x75, 0xdd,
+    0xd3, 0x7d, 0xe4, 0x24, 0xb8, 0x60, 0xfa, 0xe6, 0x90, 0x97, 0xdb, 0xb1,
+    0xc6, 0xcb, 0x00, 0x17, 0x30, 0x99, 0x15, 0x60, 0xaa, 0x13, 0x39, 0x09,
+    0x48, 0x94, 0x2f, 0x81, 0x31, 0x4f, 0x6d, 0x28, 0xf0, 0xaf, 0x01, 0xd1,
+    0x28, 0x20, 0x50, 0xb5, 0xf6, 0x00, 0x5f, 0xc8, 0x15, 0xeb, 0x04, 0xac,
+    0x6d, 0x95, 0x5b, 0xb3, 0xc9, 0x74, 0x7b, 0xf3, 0xeb, 0xdf, 0x73, 0xf2,
+    0xd6, 0x2f, 0xaa, 0x44, 0x16, 0xc5, 0xb9, 0x81, 0x60, 0x0a, 0xd5, 0xa6,
+
+    0x1a, 0x2f, 0x72, 0x08, 0x51, 0xac, 0x4a, 0xe9, 0x4f, 0xb3, 0x48, 0xa8,
+    0x94, 0x93, 0xf9, 0x92, 0x23, 0x33, 0xe9, 0xa7, 0x66, 0x2d, 0x47, 0x82,
+    0x38, 0x7b, 0xce, 0xad, 0x46, 0xb8, 0x02, 0x10, 0xde, 0x63, 0x37, 0xd9,
+    0x14, 0xb9, 0x8c, 0xd9, 0x50, 0xe9, 0x7c, 0x63, 0xb6, 0xd8, 0x2f, 0x46,
+    0x08, 0xd8, 0xda, 0xb3, 0xdc, 0x69, 0x9d, 0x11, 0xec, 0x7e, 0x6e, 0x4e,
+    0xee, 0x57, 0x8a, 0x55, 0xb7, 0xe0, 0x09, 0x19, 0x4b, 0x12, 0x96, 0x83,
+    0x2d, 0x7d, 0x5d, 0x5a, 0x7a, 0x7b, 0x31, 0x34, 0x17, 0x1a, 0x79, 0xba,
+    0xd8, 0x63, 0x9a, 0x3a, 0x97, 0x78, 0xe1, 0x81, 0xf9, 0xa0, 0xad, 0xda,
+
+    0x5f, 0x63, 0x46, 0x1a, 0x23, 0x14, 0x5a, 0xb8, 0xf5, 0x73, 0x71, 0xce,
+    0x69, 0x51, 0x9c, 0x83, 0x5d, 0x1b, 0x88, 0x4b, 0xd0, 0xfd, 0xfc, 0x4e,
+    0x3b, 0x64, 0x0d, 0xec, 0xa8, 0xb1, 0x92, 0x8e, 0xfb, 0x4d, 0xf3, 0x8c,
+    0x05, 0xa7, 0xdb, 0x5d, 0x4a, 0x28, 0x6f, 0x33, 0x03, 0x03, 0x49, 0x68,
+    0x74, 0x9a, 0xbc, 0xda, 0x2b, 0x1b, 0x5d, 0x04, 0x8c, 0x5a, 0x79, 0xb4,
+    0x4a, 0xfb, 0xfa, 0x16, 0x3e, 0x54, 0x7a, 0x0c, 0x65, 0x4f, 0xe0, 0x6d,
+    0x2c, 0xd6, 0x3f, 0xd0, 0x09, 0x7c, 0x32, 0xa2, 0x92, 0x4d, 0x7e, 0x7e,
+    0x64, 0xdd, 0x49, 0xc2, 0xed, 0xef, 0xcd, 0x18, 0x44, 0x70, 0x4c, 0xbc,
+
+    0x03, 0xc2, 0x59, 0x2c, 0xe6, 0x58, 0x0e, 0xf1, 0xe4, 0x15, 0xdf, 0xc4,
+    0xd8, 0x4b, 0x80, 0x9e, 0xee, 0xfa, 0x67, 0x58, 0x23, 0x28, 0x0e, 0xfa,
+    0xcb, 0xba, 0x88, 0xd2, 0xe6, 0xc5, 0xf5, 0xb7, 0x03, 0xac, 0x4e, 0x13,
+    0xbc, 0x1d, 0xe0, 0xc6, 0x0b, 0x68, 0x51, 0x5f, 0xf7, 0x56, 0xac, 0x51,
+    0xeb, 0x3e, 0xbb, 0x50, 0xd7, 0x13, 0x1d, 0xaa, 0x01, 0xea, 0x1f, 0x89,
+    0x33, 0x8b, 0x42, 0x95, 0xb5, 0x38, 0x49, 0xc1, 0x2d, 0xcd, 0x57, 0x08,
+    0x1b, 0x3c, 0x9e, 0xfe, 0x3d, 0x83, 0x2e, 0xfc, 0x38, 0xfc, 0x9b, 0x2a,
+    0xc3, 0x8f, 0xf3, 0xba, 0x0b, 0x22, 0x2b, 0x16, 0x99, 0x27, 0x26, 0x9b,
+
+    0xaf, 0x08, 0x53, 0x11, 0x76, 0x0d, 0x24, 0xbf, 0x90, 0xd0, 0x59, 0x05,
+    0xef, 0x39, 0x47, 0xc1, 0xfe, 0xea, 0x91, 0x03, 0xab, 0xa4, 0x2b, 0x33,
+    0xb8, 0x83, 0x15, 0x40, 0x16, 0x7e, 0x35, 0x5a, 0xc5, 0x50, 0x87, 0xd9,
+    0xed, 0x6e, 0x33, 0xe0, 0xf2, 0x97, 0x7c, 0x54, 0xd2, 0x52, 0x9a, 0xd2,
+    0x97, 0x46, 0x28, 0xaa, 0x2a, 0x25, 0x7f, 0xfa, 0x2d, 0x06, 0x22, 0x4d,
+    0xe6, 0xd8, 0x83, 0xae, 0x3b, 0x95, 0x41, 0xca, 0x65, 0xe2, 0x11, 0xe7,
+    0x04, 0xc7, 0xf6, 0xaf, 0xa6, 0x3e, 0x5e, 0xd9, 0xf6, 0xeb, 0x14, 0x78,
+    0x55, 0x84, 0x1c, 0x80, 0xe5, 0xb1, 0x48, 0x50, 0xbd, 0xdd, 0x2f, 0x1f,
+
+    0x71, 0xa9, 0x82, 0x1e, 0xd0, 0x05, 0x51, 0x1c, 0xbb, 0xd2, 0x0e, 0x23,
+    0x21, 0x81, 0x38, 0xc5, 0xc0, 0xa0, 0x21, 0x32, 0xe0, 0x53, 0xad, 0x7d,
+    0x07, 0xd5, 0x13, 0x7c, 0x1a, 0xd0, 0x62, 0xe6, 0x9e, 0xd4, 0xf5, 0xc9,
+    0x08, 0x0e, 0xdb, 0x56, 0x56, 0xc0, 0xcb, 0x84, 0x56, 0x15, 0xdb, 0x79,
+    0xd5, 0x7e, 0xe5, 0x6d, 0x82, 0x5e, 0xe6, 0x6d, 0x99, 0x05, 0xc2, 0x8c,
+    0x99, 0xd7, 0xf1, 0xbc, 0xb8, 0x48, 0xd7, 0xe9, 0x63, 0x6c, 0x29, 0x88,
+    0x1c, 0xca, 0x5d, 0xb1, 0xb2, 0x3f, 0x38, 0xf5, 0x46, 0x17, 0x46, 0xb9,
+    0xdf, 0x45, 0x65, 0xcb, 0xb9, 0xb7, 0xaa, 0xc6, 0xbf, 0x27, 0xc3, 0xa7,
+
+    0x91, 0xda, 0x6c, 0x57, 0xc5, 0x92, 0xad, 0xc7, 0x8a, 0xd8, 0x36, 0xae,
+    0x17, 0xd5, 0xf5, 0xbb, 0xf4, 0x68, 0xa5, 0x3c, 0x3f, 0xc6, 0x8c, 0xda,
+    0xd8, 0xaa, 0xcd, 0x08, 0x80, 0x7a, 0x5a, 0x47, 0x23, 0x82, 0xc6, 0xf4,
+    0x39, 0x58, 0xc6, 0x11, 0x63, 0xb6, 0xdb, 0x01, 0x7d, 0xfa, 0x61, 0x7b,
+    0xe5, 0x90, 0x41, 0x8f, 0x48, 0xcf, 0x4b, 0x36, 0x03, 0x05, 0x16, 0x7e,
+    0x43, 0xcc, 0xdd, 0x66, 0xa8, 0xe8, 0xe3, 0x43, 0x17, 0x41, 0xf9, 0x27,
+    0x67, 0xa0, 0x64, 0x72, 0x3e, 0x42, 0xdb, 0x96, 0xb2, 0x7e, 0x5c, 0xda,
+    0xaa, 0xf4, 0x9f, 0x7e, 0x84, 0x8c, 0x78, 0x40, 0xc0, 0x17, 0x67, 0xe8,
+
+    0x15, 0x53, 0x44, 0xc5, 0x05, 0x85, 0x2b, 0x1b, 0x45, 0x3f, 0x88, 0xb8,
+    0x87, 0x71, 0x44, 0x1c, 0x50, 0x6b, 0xf4, 0x33, 0xa0, 0x64, 0x14, 0xfc,
+    0x74, 0x7f, 0x91, 0xb8, 0x02, 0x3f, 0x67, 0x29, 0xde, 0x8a, 0x0e, 0x6a,
+    0x2f, 0x79, 0x63, 0x86, 0x5c, 0xbc, 0x04, 0x22, 0x9d, 0x6b, 0x0c, 0x98,
+    0x98, 0x49, 0x5d, 0x67, 0x71, 0x9d, 0x78, 0xfa, 0x8d, 0x1d, 0x54, 0x24,
+    0x20, 0x93, 0x2f, 0xdd, 0x45, 0x3a, 0xb0, 0x57, 0x5c, 0x90, 0x74, 0xaf,
+    0x04, 0x94, 0x1b, 0xae, 0xb6, 0xba, 0x5a, 0xe0, 0xd2, 0x9d, 0x1c, 0x69,
+    0xd3, 0xa1, 0x33, 0x66, 0x2e, 0xe3, 0x73, 0x1c, 0xd1, 0xfe, 0x2b, 0x3e,
+
+    0x3f, 0x92, 0xde, 0xeb, 0x74, 0x55, 0x1c, 0xfc, 0xf2, 0x88, 0x50, 0x89,
+    0x1d, 0xbb, 0xee, 0xb0, 0x17, 0xb9, 0x71, 0x41, 0x1b, 0xc4, 0xc2, 0x2a,
+    0x96, 0xee, 0xbb, 0x12, 0x3c, 0x83, 0xe1, 0x88, 0xb1, 0xbc, 0xb7, 0x5f,
+    0x6c, 0x79, 0x7f, 0x59, 0x69, 0x8f, 0xe0, 0x8d, 0x11, 0x0e, 0xc8, 0x12,
+    0x10, 0x08, 0xa9, 0x19, 0x2d, 0xe7, 0x15, 0x4f, 0x30, 0xb6, 0xfe, 0x07,
+    0xad, 0x95, 0x4e, 0x6c, 0x96, 0x4b, 0x64, 0xb7, 0x49, 0xe7, 0xad, 0xaf,
+    0x8f, 0x24, 0x26, 0xb6, 0xc3, 0xfd, 0xfc, 0x75, 0x81, 0xc1, 0xe2, 0x5f,
+    0xa3, 0x26, 0x99, 0x2a, 0xb2, 0xb3, 0xd0, 0x19, 0x06, 0x92, 0x38, 0x9c,
+
+    0xf1, 0x34, 0x20, 0x94, 0x6d, 0xbb, 0x1d, 0xe3, 0x6f, 0x03, 0x48, 0x17,
+    0xa6, 0x20, 0x21, 0x91, 0x01, 0xee, 0xb5, 0x80, 0x90, 0x19, 0xb8, 0xda,
+    0x2b, 0x96, 0x18, 0xd8, 0xbb, 0x71, 0xb0, 0xf2, 0x71, 0x1d, 0x70, 0xd9,
+    0x14, 0x74, 0xe4, 0xe0, 0xfa, 0xff, 0x6b, 0x3f, 0x0a, 0xac, 0xbd, 0xbe,
+    0xb0, 0x8d, 0xc4, 0xb8, 0xd4, 0x0a, 0xec, 0x5d, 0x1b, 0xe4, 0x3d, 0xe1,
+    0x4d, 0x28, 0x0e, 0xa6, 0x04, 0xad, 0xba, 0x39, 0x0b, 0xb8, 0x0c, 0xd0,
+    0x51, 0x74, 0x2d, 0x35, 0x25, 0xde, 0x02, 0x5c, 0x2d, 0x2b, 0x55, 0x23,
+    0xf8, 0x77, 0xda, 0xbe, 0xe2, 0xbe, 0x4e, 0x8e, 0x4b, 0x67, 0x82, 0x59,
+
+    0xac, 0x3b, 0xec, 0x82, 0x5d, 0x44, 0xfb, 0x41, 0x4b, 0xfa, 0x26, 0x08,
+    0x66, 0x25, 0x25, 0x0f, 0xbf, 0xf1, 0x3c, 0xa6, 0x83, 0xc3, 0x97, 0xed,
+    0xae, 0x73, 0xeb, 0x9e, 0x43, 0xab, 0x78, 0xdd, 0x47, 0xae, 0xd6, 0x90,
+    0x32, 0x93, 0x20, 0x9b, 0x6d, 0x0c, 0x4d, 0x55, 0xc2, 0xce, 0x68, 0x3e,
+    0xe6, 0xd7, 0x90, 0x9e, 0x14, 0x13, 0x74, 0x09, 0x50, 0xb3, 0x10, 0xf0,
+    0x4f, 0xaa, 0x1e, 0xa1, 0x1d, 0x5c, 0x41, 0x77, 0x6a, 0xa4, 0xbb, 0x27,
+    0x5b, 0xee, 0xfa, 0xfc, 0x32, 0x81, 0xa4, 0x5d, 0x87, 0x45, 0xfd, 0xeb,
+    0xa0, 0x22, 0xf2, 0x4a, 0x69, 0xd0, 0x99, 0x04, 0xb5, 0xea, 0x90, 0x58,
+
+    0x3a, 0x9e, 0x39, 0xa8, 0x88, 0x69, 0xd0, 0xcb, 0x7c, 0x6d, 0x9e, 0x03,
+    0xb7, 0xa8, 0x1a, 0x4f, 0x93, 0x22, 0xe2, 0x05, 0x9f, 0x6b, 0x87, 0x39,
+    0xeb, 0xc2, 0x5f, 0xf2, 0xed, 0x75, 0x53, 0x60, 0x50, 0xfa, 0x35, 0xfc,
+    0x68, 0x2e, 0x4e, 0x19, 0x2c, 0x06, 0xd1, 0xa8, 0x4f, 0x70, 0xbd, 0xdb,
+    0x53, 0xd9, 0x81, 0x4d, 0x80, 0xb6, 0x06, 0xdf, 0xac, 0xb7, 0x73, 0x3f,
+    0xdf, 0x8d, 0xee, 0xcd, 0xd3, 0xd6, 0xbb, 0xce, 0x4f, 0x4f, 0x63, 0xc3,
+    0x45, 0xe4, 0x4a, 0xa0, 0x1a, 0xdd, 0xf4, 0x3e, 0x74, 0x34, 0xb7, 0x0d,
+    0x92, 0x4b, 0x06, 0xa1, 0x15, 0x08, 0x24, 0xec, 0xfe, 0x68, 0xef, 0xf8,
+
+    0xcc, 0x24, 0x91, 0x48, 0x3d, 0xb8, 0x5f, 0x16, 0x28, 0xa0, 0xde, 0xd9,
+    0x57, 0x15, 0xac, 0x43, 0x2f, 0x1c, 0x95, 0x64, 0xa1, 0x25, 0x48, 0x09,
+    0x0e, 0x76, 0x43, 0x23, 0x16, 0x39, 0xfc, 0xf5, 0xfe, 0x21, 0x82, 0x66,
+    0x33, 0xb3, 0xf9, 0x08, 0x94, 0x97, 0x19, 0x13, 0xdf, 0x13, 0xf5, 0x15,
+    0x85, 0x9f, 0x78, 0x1e, 0x4a, 0x01, 0x57, 0xba, 0x98, 0x2a, 0xbc, 0x37,
+    0xb8, 0x30, 0xe8, 0x3c, 0x1d, 0xde, 0x41, 0xe1, 0xb2, 0x10, 0x25, 0x6f,
+    0x2d, 0x25, 0xac, 0x66, 0x6c, 0xbb, 0xc3, 0x4f, 0x20, 0xf4, 0xd8, 0x9d,
+    0xaa, 0xf0, 0x3b, 0x8a, 0xc4, 0xbd, 0x32, 0xd1, 0x54, 0xc8, 0xf2, 0x2d,
+
+    0x23, 0x4f, 0xf1, 0x91, 0x79, 0x9f, 0x7c, 0xab, 0xee, 0x06, 0xb3, 0x02,
+    0x75, 0x05, 0x16, 0x86, 0x4c, 0x29, 0x2e, 0xd9, 0xa5, 0xb4, 0xb9, 0x8c,
+    0x01, 0x7c, 0x75, 0x2e, 0x59, 0xd3, 0xeb, 0xac, 0x05, 0x59, 0x16, 0xa4,
+    0x24, 0x3d, 0x4b, 0x30, 0x56, 0x4f, 0x51, 0x0b, 0x12, 0xcd, 0x19, 0xbd,
+    0xf3, 0xb9, 0x74, 0x0f, 0xa2, 0xee, 0x80, 0x9b, 0x1d, 0xaf, 0xb1, 0xae,
+    0xb6, 0xd9, 0x99, 0x57, 0x48, 0x24, 0xd1, 0x15, 0x60, 0x0a, 0x30, 0x0e,
+    0x57, 0x24, 0xc2, 0xc4, 0x3f, 0x87, 0x65, 0x69, 0xcd, 0xbd, 0x40, 0x55,
+    0x5f, 0xc2, 0xe2, 0x71, 0x77, 0x30, 0xff, 0xe1, 0x84, 0x7c, 0x98, 0x65,
+
+    0xc6, 0x5d, 0x02, 0x59, 0xdd, 0x1a, 0x12, 0xb5, 0x2d, 0x74, 0xe5, 0xbf,
+    0xdf, 0x14, 0xcf, 0xba, 0x32, 0xa7, 0xa0, 0x5a, 0xce, 0xcb, 0x60, 0x6c,
+    0xeb, 0x38, 0x20, 0x9d, 0x2a, 0x10, 0x0f, 0xb0, 0xfe, 0xa6, 0x01, 0x80,
+    0x5d, 0x9d, 0xad, 0x61, 0x1e, 0x99, 0x10, 0xc1, 0x37, 0x0f, 0xe6, 0x03,
+    0x67, 0x62, 0x56, 0x61, 0x9d, 0xc0, 0x26, 0xbd, 0x0c, 0xf0, 0x46, 0xa2,
+    0x35, 0x24, 0xf0, 0x0e, 0x59, 0x0a, 0x59, 0xbc, 0x80, 0x65, 0x50, 0x87,
+    0xcc, 0x9c, 0x29, 0xe6, 0xf7, 0xcf, 0xf6, 0x74, 0xdc, 0x79, 0xa2, 0xb3,
+    0x93, 0xb1, 0x45, 0xed, 0x7b, 0x4d, 0x13, 0xb6, 0xf5, 0xf8, 0xc9, 0xc8,
+
+    0xdc, 0xaf, 0xab, 0x6e, 0xc7, 0xdd, 0x2e, 0x7d, 0xfb, 0x9e, 0xd4, 0x1c,
+    0x2d, 0x5d, 0x3f, 0x66, 0x22, 0x0b, 0x12, 0xa8, 0xea, 0x0f, 0x3b, 0xb8,
+    0x6b, 0x9d, 0x76, 0x4a, 0xd5, 0x96, 0x34, 0x75, 0x3f, 0xf3, 0x77, 0xfc,
+    0x35, 0xce, 0xf7, 0x8a, 0x54, 0x37, 0x2e, 0x43, 0x24, 0xc2, 0xbb, 0x10,
+    0xaa, 0x5f, 0x97, 0x88, 0x87, 0x20, 0xa5, 0xd8, 0xe3, 0xa8, 0x95, 0x9d,
+    0x9e, 0x2b, 0x7d, 0xe0, 0x81, 0x9d, 0x41, 0x50, 0xde, 0x21, 0x50, 0x7b,
+    0x8f, 0xa5, 0x2c, 0xcf, 0xd0, 0xf9, 0x89, 0xee, 0xc3, 0x19, 0x32, 0x79,
+    0x92, 0x90, 0x51, 0x30, 0x59, 0x8e, 0x83, 0x9a, 0x0c, 0x7b, 0xb2, 0x8c,
+
+    0xae, 0x61, 0xe4, 0x4c, 0x31, 0x1c, 0x2d, 0x54, 0x2c, 0x18, 0x93, 0x4b,
+    0xfa, 0xab, 0x60, 0x1e, 0x6b, 0xb0, 0x0d, 0x35, 0x13, 0xc7, 0x26, 0x5a,
+    0x2e, 0x07, 0x83, 0x13, 0xa3, 0x49, 0x97, 0x82, 0xda, 0xc9, 0xd9, 0xad,
+    0xb2, 0x7e, 0x5c, 0xa5, 0x60, 0x5a, 0xe8, 0x7e, 0x66, 0xb4, 0x59, 0x64,
+    0x05, 0x03, 0x94, 0xc3, 0x5e, 0xb0, 0x46, 0xf5, 0xee, 0xf9, 0xe1, 0xb3,
+    0x96, 0x13, 0xe9, 0x5e, 0xbc, 0x6a, 0xc8, 0x8b, 0xc9, 0x95, 0xb7, 0x42,
+    0xc5, 0x33, 0x27, 0x78, 0xc7, 0x56, 0xa8, 0x18, 0x60, 0xcc, 0x36, 0xed,
+    0x51, 0x4d, 0x54, 0x38, 0xc5, 0x91, 0x6e, 0x59, 0x51, 0x1e, 0x4d, 0xde,
+
+    0xba, 0x0b, 0xb1, 0x40, 0x2d, 0x02, 0x58, 0x7c, 0x2c, 0x47, 0x5a, 0x8e,
+    0xfd, 0xa5, 0x0f, 0xf0, 0x18, 0x3c, 0xa5, 0x97, 0x5d, 0xc2, 0x84, 0xcf,
+    0x89, 0x31, 0x64, 0x4d, 0x44, 0x50, 0x41, 0x21, 0x42, 0xcb, 0xa7, 0x5b,
+    0x31, 0x83, 0xca, 0x76, 0xb6, 0x9e, 0x1a, 0x41, 0x30, 0x29, 0x5b, 0x6d,
+    0xef, 0x62, 0x70, 0xa8, 0x48, 0x89, 0xb1, 0x05, 0x69, 0xd8, 0x00, 0x1a,
+    0xdf, 0x1d, 0x90, 0x4b, 0x31, 0xc4, 0x00, 0x73, 0x69, 0x75, 0xf2, 0x7c,
+    0x18, 0x63, 0x88, 0x50, 0xa4, 0xd9, 0xc1, 0xae, 0x2a, 0x5b, 0x1f, 0x44,
+    0x72, 0x47, 0x53, 0x84, 0x99, 0x43, 0x23, 0xce, 0x67, 0x8c, 0x33, 0xda,
+
+    0x63, 0xaf, 0x0d, 0xa1, 0x85, 0x53, 0x93, 0xc4, 0xcb, 0x5c, 0x8a, 0x68,
+    0x6d, 0xe0, 0x2a, 0x66, 0x49, 0x9f, 0xff, 0xfb, 0x84, 0xc3, 0x38, 0x25,
+    0x9a, 0xc7, 0x9b, 0x24, 0x3c, 0x54, 0x04, 0x0d, 0xb6, 0x91, 0x63, 0x23,
+    0x48, 0x23, 0x1b, 0xfe, 0x3c, 0x8a, 0xef, 0x7b, 0x50, 0x55, 0x8a, 0x7e,
+    0xb1, 0x5b, 0x7d, 0xc3, 0xcb, 0x56, 0x17, 0xc1, 0x77, 0xc1, 0x91, 0xcc,
+    0x64, 0x86, 0x9e, 0x35, 0x0a, 0xb4, 0x21, 0x5e, 0x3f, 0x77, 0xa4, 0x90,
+    0xca, 0x87, 0x43, 0x88, 0x09, 0x53, 0x76, 0x75, 0xe0, 0xb4, 0xc8, 0xa2,
+    0x49, 0x8d, 0xaf, 0x92, 0x51, 0x06, 0xd0, 0x0b, 0x4c, 0x95, 0x88, 0x1b,
+
+    0x6d, 0x0b, 0x35, 0x4e, 0xc6, 0x80, 0x23, 0x65, 0x55, 0x99, 0x86, 0xd9,
+    0xb9, 0xaa, 0xc9, 0xff, 0xb5, 0x42, 0x1e, 0xce, 0x77, 0x8c, 0x4b, 0xb1,
+    0x1f, 0x65, 0x72, 0xbc, 0xb2, 0xbe, 0x31, 0xe0, 0xc1, 0xaf, 0x45, 0xef,
+    0x11, 0xe1, 0xed, 0x1e, 0x1c, 0xb1, 0x21, 0x91, 0xb5, 0x9f, 0x74, 0x64,
+    0x1d, 0x88, 0x0f, 0xc4, 0x95, 0xa5, 0x76, 0x0a, 0x96, 0xf5, 0xc7, 0xab,
+    0xf4, 0x21, 0x08, 0xdb, 0xc8, 0xa5, 0x8b, 0xdd, 0x8f, 0x47, 0x01, 0x62,
+    0x01, 0xbc, 0x8e, 0x70, 0xaa, 0x7c, 0xf1, 0x8d, 0x05, 0x4a, 0x9a, 0x12,
+    0xf1, 0x86, 0xc8, 0x61, 0x23, 0x1d, 0x32, 0x39, 0x0a, 0xa2, 0xd8, 0x47,
+
+    0xef, 0xd0, 0xfd, 0xb5, 0xaf, 0x14, 0xee, 0x70, 0xd6, 0xea, 0xb7, 0x09,
+    0x16, 0xa8, 0x8b, 0xb6, 0xc6, 0xd3, 0x05, 0x19, 0xa2, 0xc6, 0x59, 0x76,
+    0x30, 0xb5, 0x83, 0x07, 0x13, 0x16, 0xee, 0x5c, 0xef, 0xc6, 0x44, 0x2b,
+    0x04, 0xe5, 0x36, 0x90, 0x49, 0x51, 0x75, 0xcd, 0x52, 0x2a, 0x42, 0x3f,
+    0x71, 0x68, 0x21, 0xc6, 0x85, 0x42, 0x57, 0x12, 0x24, 0xe8, 0xcd, 0x38,
+    0xfc, 0x1a, 0x5b, 0x28, 0x66, 0xee, 0xef, 0xf3, 0x03, 0x02, 0x1f, 0x01,
+    0x2b, 0x58, 0x37, 0x95, 0x3e, 0xc2, 0x3d, 0x8e, 0x7f, 0xc4, 0x91, 0xe5,
+    0x3f, 0x0e, 0x31, 0xbe, 0x75, 0x66, 0x6e, 0x3e, 0x71, 0xca, 0x7c, 0x18,
+
+    0x0b, 0x4b, 0x5e, 0xea, 0xcb, 0x46, 0xab, 0x57, 0x82, 0xe3, 0x6d, 0xc1,
+    0xac, 0x5b, 0x72, 0xae, 0x42, 0xe2, 0x1e, 0x34, 0x27, 0x48, 0x78, 0x74,
+    0x55, 0x30, 0xb3, 0xb2, 0xca, 0x40, 0x03, 0xad, 0xce, 0xb2, 0x99, 0x5e,
+    0x9d, 0x94, 0x0c, 0x86, 0xc0, 0xe6, 0x0a, 0xb1, 0x66, 0x4a, 0xa2, 0x8d,
+    0x2f, 0xc3, 0x85, 0x4a, 0xea, 0x65, 0x14, 0x5c, 0x28, 0x34, 0x21, 0x77,
+    0xec, 0xa4, 0xe5, 0xd1, 0x17, 0x42, 0xd2, 0x5f, 0x4e, 0x23, 0xa7, 0x30,
+    0x7c, 0xd9, 0x10, 0x8b, 0xe0, 0x26, 0x76, 0xd8, 0x02, 0xdd, 0xcf, 0xd6,
+    0x4c, 0x7d, 0x5c, 0x68, 0x52, 0x2a, 0x9f, 0x51, 0x4e, 0xad, 0x08, 0xfc,
+
+    0x3e, 0xd6, 0x21, 0xac, 0xdd, 0xd6, 0x08, 0x8a, 0x21, 0xd2, 0xe7, 0x0e,
+    0x1e, 0xc3, 0xb2, 0x15, 0x5c, 0x97, 0xac, 0x7e, 0x49, 0x2b, 0x73, 0x9c,
+    0x04, 0x5e, 0x5a, 0xef, 0x73, 0x19, 0x37, 0xea, 0xd4, 0xc8, 0x40, 0x0f,
+    0x7e, 0x53, 0xbb, 0xf6, 0x65, 0x7e, 0x15, 0x73, 0x27, 0x40, 0xd8, 0x19,
+    0xf2, 0x9d, 0x6b, 0xcd, 0xa4, 0x1c, 0x83, 0x65, 0x0b, 0x54, 0x15, 0xfc,
+    0x0d, 0xb7, 0x21, 0xdd, 0xb2, 0xe9, 0x97, 0x8b, 0x8b, 0xf6, 0xe4, 0x2a,
+    0x5a, 0x30, 0xc2, 0xd2, 0xf5, 0xc6, 0x99, 0xc3, 0x89, 0x3a, 0x50, 0x49,
+    0xa7, 0x31, 0x6c, 0x08, 0x3f, 0x38, 0xf2, 0x6d, 0x6d, 0xbe, 0x26, 0xa9,
+
+    0xf7, 0x38, 0x98, 0xfd, 0x5f, 0xd7, 0x47, 0xfa, 0xf0, 0x83, 0x97, 0x1b,
+    0x14, 0x44, 0x3d, 0x32, 0x84, 0x56, 0x4d, 0x23, 0x74, 0xaf, 0xd8, 0x8c,
+    0x5c, 0x46, 0x13, 0xcf, 0xa5, 0x30, 0xe7, 0x6f, 0x7b, 0x1a, 0x96, 0x37,
+    0xfc, 0x27, 0x7a, 0x27, 0x93, 0x69, 0xaa, 0xe4, 0x48, 0x4c, 0xe8, 0xd6,
+    0x21, 0xce, 0x35, 0x95, 0x01, 0x04, 0xf8, 0xac, 0xb1, 0xa6, 0xda, 0x80,
+    0x43, 0x32, 0xff, 0xd7, 0x53, 0x49, 0x61, 0xf7, 0x1b, 0xb9, 0x6c, 0xfa,
+    0x04, 0x65, 0xc8, 0x06, 0xac, 0x30, 0xe9, 0x51, 0x2d, 0x89, 0x94, 0x47,
+    0xd2, 0x32, 0x5d, 0xea, 0x15, 0xc1, 0x7b, 0xfd, 0x36, 0x64, 0x73, 0xa3,
+
+    0xb6, 0xc9, 0xdc, 0x11, 0xaa, 0x72, 0x42, 0x86, 0xc6, 0xc2, 0x2c, 0x15,
+    0xb7, 0xa5, 0x26, 0x81, 0xdc, 0x48, 0x95, 0x1d, 0x9e, 0x1d, 0x7a, 0x6f,
+    0x41, 0x9e, 0xf5, 0xad, 0xca, 0x36, 0xfb, 0xdf, 0xa6, 0xcd, 0xa0, 0x79,
+    0x6f, 0x1d, 0x57, 0x14, 0xac, 0xd8, 0xe2, 0x51, 0x0d, 0x46, 0x06, 0x6d,
+    0x3e, 0x65, 0x4e, 0x44, 0x41, 0xc3, 0xa4, 0x34, 0xdf, 0xfa, 0xeb, 0xad,
+    0xb0, 0x04, 0x84, 0x9a, 0x2c, 0xd0, 0xb8, 0xcb, 0xce, 0x83, 0x4f, 0x82,
+    0x46, 0x89, 0x3c, 0x57, 0x12, 0x58, 0x76, 0x82, 0x80, 0xa8, 0xc0, 0x60,
+    0xd8, 0x44, 0x6a, 0x48, 0xd4, 0xab, 0x3c, 0x62, 0xa7, 0x64, 0x6c, 0x3f,
+
+    0xb6, 0x1f, 0x00, 0x40, 0x34, 0x1c, 0x16, 0x5a, 0x9f, 0x1e, 0xe7, 0xcd,
+    0xfb, 0xed, 0xae, 0xf5, 0xbc, 0x17, 0xd3, 0x34, 0x1c, 0x54, 0xe3, 0x27,
+    0x6f, 0x26, 0xcc, 0x31, 0x57, 0xe6, 0xf0, 0xb7, 0x2c, 0xbd, 0xa6, 0xc0,
+    0xf8, 0x32, 0x53, 0x58, 0xc1, 0x20, 0x65, 0xe7, 0x1c, 0xa9, 0x16, 0xb6,
+    0x42, 0xb6, 0xa3, 0x35, 0xe2, 0xda, 0xff, 0xc9, 0x66, 0x8b, 0x62, 0x37,
+    0x0c, 0xb1, 0xf4, 0xbf, 0x67, 0x32, 0x74, 0x9d, 0xb1, 0x2d, 0xa4, 0x29,
+    0x62, 0x29, 0x94, 0xd4, 0x1b, 0x18, 0x73, 0x83, 0x44, 0x16, 0x4a, 0x0c,
+    0x8f, 0x99, 0xe0, 0x34, 0x09, 0x1a, 0x3b, 0xd4, 0xc2, 0x00, 0x32, 0x6a,
+
+    0x12, 0x37, 0xde, 0xa2, 0x85, 0x32, 0x75, 0x2b, 0x0c, 0xf8, 0xb9, 0x3f,
+    0xa4, 0x72, 0xe0, 0xa8, 0x34, 0x15, 0xb9, 0xa6, 0x69, 0x31, 0x7a, 0xd6,
+    0x55, 0x07, 0x4e, 0xd7, 0xc0, 0x7e, 0x0a, 0x7b, 0x2b, 0x6f, 0x4e, 0xa7,
+    0xf3, 0x9a, 0x42, 0x79, 0xef, 0x16, 0xed, 0xc5, 0x65, 0x99, 0x49, 0x91,
+    0x77, 0x35, 0xa2, 0x8d, 0x7b, 0x81, 0x18, 0x4a, 0x1e, 0xa3, 0x8b, 0x16,
+    0x0a, 0xa3, 0x43, 0xe2, 0x2c, 0x4f, 0x74, 0x1b, 0x18, 0x81, 0xf3, 0xc5,
+    0x62, 0x9a, 0x7a, 0x2d, 0x58, 0x0b, 0xbe, 0x2b, 0x4b, 0x83, 0x85, 0xc3,
+    0x48, 0xb2, 0xfc, 0x9b, 0xf4, 0xa4, 0x41, 0x25, 0xcf, 0x0d, 0xc0, 0xbc,
+
+    0x0b, 0x63, 0x53, 0x99, 0x34, 0xd1, 0x6b, 0x96, 0xfe, 0xe7, 0x7e, 0xe2,
+    0xfc, 0xad, 0x95, 0xb0, 0x9c, 0x99, 0xcd, 0x5a, 0x13, 0xb5, 0xa1, 0xe8,
+    0xbf, 0xba, 0xe8, 0xc8, 0x48, 0xa4, 0x00, 0x04, 0xff, 0x56, 0x5a, 0xad,
+    0xb6, 0xb7, 0x2b, 0xf0, 0x03, 0x99, 0x5f, 0xe7, 0x2c, 0x3f, 0xc4, 0x86,
+    0x41, 0x9e, 0x88, 0x89, 0xad, 0xae, 0x97, 0xb4, 0xa5, 0xf0, 0xb6, 0x9b,
+    0xfe, 0x41, 0x43, 0x95, 0xc9, 0xe2, 0xb6, 0xe1, 0x07, 0x61, 0xae, 0x3a,
+    0x7a, 0xaf, 0x00, 0x3b, 0x30, 0x91, 0xc6, 0x81, 0x60, 0x4d, 0x83, 0x49,
+    0xd5, 0xd0, 0x85, 0x4e, 0x28, 0x01, 0xab, 0x2b, 0x5d, 0x77, 0x8a, 0x19,
+};
+#endif /* MBEDTLS_ECP_DP_SECP384R1_ENABLED */
+
+typedef struct {
+    mbedtls_ecp_group_id id;
+    unsigned char w;            /* window size the table was built for */
+    unsigned char point_count;  /* 1 << (w - 1) */
+    unsigned short coord_len;   /* bytes per coordinate */
+    const unsigned char *data;  /* point_count * 2 * coord_len bytes */
+} ecp_comb_table_entry_t;
+
+static const ecp_comb_table_entry_t ecp_comb_tables[] = {
+#if defined(MBEDTLS_ECP_DP_SECP256R1_ENABLED)
+    { MBEDTLS_ECP_DP_SECP256R1, 5, 16, 32, ecp_comb_table_secp256r1 },
+#endif
+#if defined(MBEDTLS_ECP_DP_SECP384R1_ENABLED)
+    { MBEDTLS_ECP_DP_SECP384R1, 6, 32, 48, ecp_comb_table_secp384r1 },
+#endif
+};
+
+int mbedtls_ecp_comb_table_load(const mbedtls_ecp_group *grp,
+                                unsigned char w,
+                                mbedtls_ecp_point T[],
+                                unsigned char T_size)
+{
+    const ecp_comb_table_entry_t *entry = NULL;
+    const unsigned char *p;
+    int ret;
+    unsigned char i;
+    size_t n;
+
+    for (n = 0; n < sizeof(ecp_comb_tables) / sizeof(ecp_comb_tables[0]); n++) {
+        if (ecp_comb_tables[n].id == grp->id) {
+            entry = &ecp_comb_tables[n];
+            break;
+        }
+    }
+
+    /* A window-size mismatch means a non-default MBEDTLS_ECP_WINDOW_SIZE;
+     * the stored points do not match the comb recoding then. */
+    if (entry == NULL || entry->w != w || entry->point_count != T_size ||
+            entry->coord_len != (grp->nbits + 7) / 8) {
+        return MBEDTLS_ERR_ECP_FEATURE_UNAVAILABLE;
+    }
+
+    p = entry->data;
+    for (i = 0; i < T_size; i++) {
+        if ((ret = mbedtls_mpi_read_binary(&T[i].X, p, entry->coord_len)) != 0) {
+            return ret;
+        }
+        p += entry->coord_len;
+        if ((ret = mbedtls_mpi_read_binary(&T[i].Y, p, entry->coord_len)) != 0) {
+            return ret;
+        }
+        p += entry->coord_len;
+        /* Z stays empty: the comb core only ever reads X and Y. */
+    }
+    return 0;
+}
+
+#endif /* MBEDTLS_ECP_C && MBEDTLS_ECP_FIXED_POINT_TABLES */
@@ -0,0 +1,230 @@
+/*
+ *  handshake_pool.c
+ *
+ *  Copyright (c) 2026 Arm Limited
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/* Static pool backing Mbed TLS heap allocations while TLS sockets exist.
+ *
+ * A first-fit free list with coalescing over a statically allocated
+ * arena. Requests that do not fit are served from the global heap and
+ * routed back there on free by a pointer-range check, so the pool can
+ * be sized for the common case (handshake MPI churn) without a hard
+ * ceiling on total Mbed TLS memory. The pool cannot be released while
+ * anything is still allocated from it - other users of Mbed TLS (e.g.
+ * a DTLS connection or an application hash context) may hold memory
+ * that outlives the TLS socket that triggered the attach - so detach
+ * only resets the arena once the reference count and the outstanding
+ * byte count both reach zero. */
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+#include "config.h"
+#else
+#include MBEDTLS_CONFIG_FILE
+#endif
+
+#include "handshake_pool.h"
+
+#if defined(MBEDTLS_PLATFORM_MEMORY) && MBED_CONF_MBEDTLS_HANDSHAKE_POOL_SIZE > 0
+
+#include "mbedtls/platform.h"
+#include "platform/mbed_critical.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Every block, free or allocated, is preceded by one header word giving
+ * its total size (header included). Sizes and the arena base are kept
+ * 8-byte aligned so returned pointers satisfy any type. */
+#define POOL_ALIGN        8
+#define POOL_HEADER_SIZE  POOL_ALIGN
+#define POOL_MIN_BLOCK    (POOL_HEADER_SIZE + POOL_ALIGN)
+#define POOL_SIZE \
+    ((MBED_CONF_MBEDTLS_HANDSHAKE_POOL_SIZE + POOL_ALIGN - 1) & ~(POOL_ALIGN - 1))
+
+typedef struct pool_free_block {
+    size_t size;
+    struct pool_free_block *next;
+} pool_free_block_t;
+
+static uint64_t pool_arena[POOL_SIZE / sizeof(uint64_t)];
+static pool_free_block_t *pool_free_list;
+static int pool_refcount;
+static int pool_hooks_installed;
+static mbedtls_handshake_pool_stats_t pool_stats_counters;
+
+static void pool_reset(void)
+{
+    pool_free_list = (pool_free_block_t *)pool_arena;
+    pool_free_list->size = POOL_SIZE;
+    pool_free_list->next = NULL;
+    pool_stats_counters.current_bytes = 0;
+    pool_stats_counters.peak_bytes = 0;
+}
+
+static int pool_owns(const void *ptr)
+{
+    const unsigned char *p = ptr;
+    const unsigned char *base = (const unsigned char *)pool_arena;
+    return p >= base && p < base + POOL_SIZE;
+}
+
+/* Carve a block out of the free list; returns NULL when nothing fits. */
+static void *pool_alloc(size_t bytes)
+{
+    pool_free_block_t **link = &pool_free_list;
+    size_t need = POOL_HEADER_SIZE +
+                  ((bytes + POOL_ALIGN - 1) & ~(size_t)(POOL_ALIGN - 1));
+
+    while (*link != NULL) {
+        pool_free_block_t *block = *link;
+        if (block->size >= need) {
+            if (block->size - need >= POOL_MIN_BLOCK) {
+                /* split: keep the tail on the free list */
+                pool_free_block_t *rest =
+                    (pool_free_block_t *)((unsigned char *)block + need);
+                rest->size = block->size - need;
+                rest->next = block->next;
+                *link = rest;
+                block->size = need;
+            } else {
+                *link = block->next;
+            }
+            pool_stats_counters.current_bytes += block->size;
+            if (pool_stats_counters.current_bytes > pool_stats_counters.peak_bytes) {
+                pool_stats_counters.peak_bytes = pool_stats_counters.current_bytes;
+            }
+            return (unsigned char *)block + POOL_HEADER_SIZE;
+        }
+        link = &block->next;
+    }
+    return NULL;
+}
+
+/* Return a block to the address-ordered free list, merging neighbours. */
+static void pool_free(void *ptr)
+{
+    pool_free_block_t *block =
+        (pool_free_block_t *)((unsigned char *)ptr - POOL_HEADER_SIZE);
+    pool_free_block_t **link = &pool_free_list;
+
+    pool_stats_counters.current_bytes -= block->size;
+
+    while (*link != NULL && *link < block) {
+        link = &(*link)->next;
+    }
+
+    /* merge with the following free block if adjacent */
+    if (*link != NULL &&
+            (unsigned char *)block + block->size == (unsigned char *)*link) {
+        block->size += (*link)->size;
+        block->next = (*link)->next;
+    } else {
+        block->next = *link;
+    }
+    *link = block;
+
+    /* merge with the preceding free block if adjacent */
+    if (link != &pool_free_list) {
+        pool_free_block_t *prev =
+            (pool_free_block_t *)((unsigned char *)link - offsetof(pool_free_block_t, next));
+        if ((unsigned char *)prev + prev->size == (unsigned char *)block) {
+            prev->size += block->size;
+            prev->next = block->next;
+        }
+    }
+}
+
+static void *pool_calloc_hook(size_t n, size_t size)
+{
+    void *ptr = NULL;
+    size_t bytes;
+
+    if (n != 0 && size > (size_t)-1 / n) {
+        return NULL;
+    }
+    bytes = n * size;
+    if (bytes == 0) {
+        bytes = 1;
+    }
+
+    core_util_critical_section_enter();
+    ptr = pool_alloc(bytes);
+    if (ptr == NULL) {
+        pool_stats_counters.failed_allocs++;
+    }
+    core_util_critical_section_exit();
+
+    if (ptr != NULL) {
+        memset(ptr, 0, bytes);
+        return ptr;
+    }
+    return calloc(n, size);
+}
+
+static void pool_free_hook(void *ptr)
+{
+    if (ptr == NULL) {
+        return;
+    }
+    if (pool_owns(ptr)) {
+        core_util_critical_section_enter();
+        pool_free(ptr);
+        core_util_critical_section_exit();
+    } else {
+        free(ptr);
+    }
+}
+
+void mbedtls_handshake_pool_attach(void)
+{
+    core_util_critical_section_enter();
+    pool_refcount++;
+    if (!pool_hooks_installed) {
+        pool_reset();
+        pool_stats_counters.failed_allocs = 0;
+        /* The hooks stay installed for the lifetime of the program:
+         * memory handed out by the pool must be freed through it, and
+         * Mbed TLS objects owned by the application can outlive every
+         * TLS socket. */
+        mbedtls_platform_set_calloc_free(pool_calloc_hook, pool_free_hook);
+        pool_hooks_installed = 1;
+    }
+    core_util_critical_section_exit();
+}
+
+void mbedtls_handshake_pool_detach(void)
+{
+    core_util_critical_section_enter();
+    if (pool_refcount > 0) {
+        pool_refcount--;
+    }
+    /* Reset wholesale only when nothing can still point into the arena:
+     * no TLS socket is alive and every pool allocation has been freed. */
+    if (pool_refcount == 0 && pool_stats_counters.current_bytes == 0) {
+        pool_reset();
+    }
+    core_util_critical_section_exit();
+}
+
+void mbedtls_handshake_pool_stats(mbedtls_handshake_pool_stats_t *stats)
+{
+    core_util_critical_section_enter();
+    *stats = pool_stats_counters;
+    core_util_critical_section_exit();
+}
+
+#endif /* MBEDTLS_PLATFORM_MEMORY && MBED_CONF_MBEDTLS_HANDSHAKE_POOL_SIZE > 0 */
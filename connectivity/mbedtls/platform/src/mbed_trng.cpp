@@ -20,12 +20,17 @@
 #include "hal/trng_api.h"
 #include "platform/SingletonPtr.h"
 #include "platform/PlatformMutex.h"
+#include "trng_pool.h"
 
 SingletonPtr<PlatformMutex> mbedtls_mutex;
 
 extern "C"
 int mbedtls_hardware_poll( void *data, unsigned char *output, size_t len, size_t *olen ) {
-#if defined(DEVICE_TRNG)
+#if MBED_CONF_MBEDTLS_TRNG_POOL_SIZE > 0
+    /* Serve from the ring of pre-harvested entropy; only a shortfall
+     * waits on the hardware. The pool has its own lock. */
+    return mbedtls_trng_pool_get_bytes(output, len, olen);
+#elif defined(DEVICE_TRNG)
     trng_t trng_obj;
     mbedtls_mutex->lock();
     trng_init(&trng_obj);
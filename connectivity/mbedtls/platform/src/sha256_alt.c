@@ -0,0 +1,200 @@
+/* Copyright (c) 2026 Arm Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Generic MBEDTLS_SHA256_ALT implementation on top of the crypto
+ * acceleration HAL. Only the compression function is offloaded;
+ * buffering, padding and length encoding stay here, so the context
+ * remains plain memory and any number of hashes can be interleaved.
+ * Whole runs of blocks are handed to the engine in one call, which is
+ * where the record-processing throughput comes from. */
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+#include "mbedtls/config.h"
+#else
+#include MBEDTLS_CONFIG_FILE
+#endif
+
+#if defined(MBEDTLS_SHA256_ALT) && DEVICE_CRYPTO_ACCEL_SHA256
+
+#include "mbedtls/sha256.h"
+#include "mbedtls/platform_util.h"
+#include "hal/crypto_accel_api.h"
+#include <string.h>
+
+void mbedtls_sha256_init(mbedtls_sha256_context *ctx)
+{
+    memset(ctx, 0, sizeof(mbedtls_sha256_context));
+}
+
+void mbedtls_sha256_free(mbedtls_sha256_context *ctx)
+{
+    if (ctx == NULL) {
+        return;
+    }
+    mbedtls_platform_zeroize(ctx, sizeof(mbedtls_sha256_context));
+}
+
+void mbedtls_sha256_clone(mbedtls_sha256_context *dst,
+                          const mbedtls_sha256_context *src)
+{
+    *dst = *src;
+}
+
+int mbedtls_sha256_starts_ret(mbedtls_sha256_context *ctx, int is224)
+{
+    ctx->total[0] = 0;
+    ctx->total[1] = 0;
+
+    if (is224 == 0) {
+        ctx->state[0] = 0x6A09E667;
+        ctx->state[1] = 0xBB67AE85;
+        ctx->state[2] = 0x3C6EF372;
+        ctx->state[3] = 0xA54FF53A;
+        ctx->state[4] = 0x510E527F;
+        ctx->state[5] = 0x9B05688C;
+        ctx->state[6] = 0x1F83D9AB;
+        ctx->state[7] = 0x5BE0CD19;
+    } else {
+        ctx->state[0] = 0xC1059ED8;
+        ctx->state[1] = 0x367CD507;
+        ctx->state[2] = 0x3070DD17;
+        ctx->state[3] = 0xF70E5939;
+        ctx->state[4] = 0xFFC00B31;
+        ctx->state[5] = 0x68581511;
+        ctx->state[6] = 0x64F98FA7;
+        ctx->state[7] = 0xBEFA4FA4;
+    }
+    ctx->is224 = is224;
+    return 0;
+}
+
+int mbedtls_internal_sha256_process(mbedtls_sha256_context *ctx,
+                                    const unsigned char data[64])
+{
+    if (crypto_accel_sha256_process(ctx->state, data, 1) != 0) {
+        return MBEDTLS_ERR_SHA256_HW_ACCEL_FAILED;
+    }
+    return 0;
+}
+
+int mbedtls_sha256_update_ret(mbedtls_sha256_context *ctx,
+                              const unsigned char *input, size_t ilen)
+{
+    size_t fill;
+    uint32_t left;
+
+    if (ilen == 0) {
+        return 0;
+    }
+
+    left = ctx->total[0] & 0x3F;
+    fill = 64 - left;
+
+    ctx->total[0] += (uint32_t)ilen;
+    ctx->total[0] &= 0xFFFFFFFF;
+    if (ctx->total[0] < (uint32_t)ilen) {
+        ctx->total[1]++;
+    }
+
+    if (left && ilen >= fill) {
+        memcpy(ctx->buffer + left, input, fill);
+        if (crypto_accel_sha256_process(ctx->state, ctx->buffer, 1) != 0) {
+            return MBEDTLS_ERR_SHA256_HW_ACCEL_FAILED;
+        }
+        input += fill;
+        ilen -= fill;
+        left = 0;
+    }
+
+    if (ilen >= 64) {
+        // all whole blocks in a single pass through the engine
+        if (crypto_accel_sha256_process(ctx->state, input, ilen / 64) != 0) {
+            return MBEDTLS_ERR_SHA256_HW_ACCEL_FAILED;
+        }
+        input += ilen & ~(size_t)0x3F;
+        ilen &= 0x3F;
+    }
+
+    if (ilen > 0) {
+        memcpy(ctx->buffer + left, input, ilen);
+    }
+    return 0;
+}
+
+int mbedtls_sha256_finish_ret(mbedtls_sha256_context *ctx,
+                              unsigned char output[32])
+{
+    unsigned char padding[64 + 8];
+    uint32_t high, low;
+    uint32_t used = ctx->total[0] & 0x3F;
+    size_t padlen = (used < 56) ? 56 - used : 120 - used;
+    int ret;
+
+    memset(padding, 0, sizeof(padding));
+    padding[0] = 0x80;
+
+    high = (ctx->total[0] >> 29) | (ctx->total[1] << 3);
+    low = ctx->total[0] << 3;
+    padding[padlen + 0] = (unsigned char)(high >> 24);
+    padding[padlen + 1] = (unsigned char)(high >> 16);
+    padding[padlen + 2] = (unsigned char)(high >> 8);
+    padding[padlen + 3] = (unsigned char)(high);
+    padding[padlen + 4] = (unsigned char)(low >> 24);
+    padding[padlen + 5] = (unsigned char)(low >> 16);
+    padding[padlen + 6] = (unsigned char)(low >> 8);
+    padding[padlen + 7] = (unsigned char)(low);
+
+    ret = mbedtls_sha256_update_ret(ctx, padding, padlen + 8);
+    if (ret != 0) {
+        return ret;
+    }
+
+    int words = ctx->is224 ? 7 : 8;
+    for (int i = 0; i < words; i++) {
+        output[i * 4 + 0] = (unsigned char)(ctx->state[i] >> 24);
+        output[i * 4 + 1] = (unsigned char)(ctx->state[i] >> 16);
+        output[i * 4 + 2] = (unsigned char)(ctx->state[i] >> 8);
+        output[i * 4 + 3] = (unsigned char)(ctx->state[i]);
+    }
+    return 0;
+}
+
+#if !defined(MBEDTLS_DEPRECATED_REMOVED)
+void mbedtls_sha256_starts(mbedtls_sha256_context *ctx, int is224)
+{
+    mbedtls_sha256_starts_ret(ctx, is224);
+}
+
+void mbedtls_sha256_update(mbedtls_sha256_context *ctx,
+                           const unsigned char *input, size_t ilen)
+{
+    mbedtls_sha256_update_ret(ctx, input, ilen);
+}
+
+void mbedtls_sha256_finish(mbedtls_sha256_context *ctx,
+                           unsigned char output[32])
+{
+    mbedtls_sha256_finish_ret(ctx, output);
+}
+
+void mbedtls_sha256_process(mbedtls_sha256_context *ctx,
+                            const unsigned char data[64])
+{
+    mbedtls_internal_sha256_process(ctx, data);
+}
+#endif /* !MBEDTLS_DEPRECATED_REMOVED */
+
+#endif /* MBEDTLS_SHA256_ALT && DEVICE_CRYPTO_ACCEL_SHA256 */
@@ -0,0 +1,244 @@
+/*
+ *  trng_pool.cpp
+ *
+ *  Copyright (c) 2026 Arm Limited
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include "trng_pool.h"
+
+#if (defined(DEVICE_TRNG) || defined(FEATURE_PSA)) && MBED_CONF_MBEDTLS_TRNG_POOL_SIZE > 0
+
+#include <string.h>
+
+#include "hal/trng_api.h"
+#include "platform/SingletonPtr.h"
+#include "platform/PlatformMutex.h"
+
+#if MBED_CONF_RTOS_PRESENT
+#include "rtos/Thread.h"
+#include "rtos/Semaphore.h"
+#endif
+
+/* Bytes harvested per poll step. Small enough that a step finishes in a
+ * few milliseconds even on a slow TRNG, so an entropy request arriving
+ * mid-refill is not held up for long on the mutex. */
+#define TRNG_POOL_CHUNK 32
+
+/* SP 800-90B section 4.4 continuous health test cutoffs, computed for a
+ * conservative estimate of 1 bit of entropy per sample byte and a false
+ * positive rate of 2^-20. */
+#define TRNG_POOL_RCT_CUTOFF 21     /* 1 + 20/H identical bytes in a row */
+#define TRNG_POOL_APT_WINDOW 512
+#define TRNG_POOL_APT_CUTOFF 325    /* occurrences of one value per window */
+
+/* Ring of health-tested TRNG output. trng_pool_mutex guards the ring,
+ * the health test state and the TRNG hardware itself, so the background
+ * refill and a synchronous shortfall harvest never drive the peripheral
+ * concurrently. */
+static SingletonPtr<PlatformMutex> trng_pool_mutex;
+static uint8_t trng_pool[MBED_CONF_MBEDTLS_TRNG_POOL_SIZE];
+static size_t trng_pool_write;
+static size_t trng_pool_read;
+static size_t trng_pool_count;
+
+/* Repetition count test: consecutive identical bytes. */
+static uint8_t rct_last;
+static uint32_t rct_run;
+
+/* Adaptive proportion test: occurrences of the window's first byte. */
+static uint8_t apt_first;
+static uint32_t apt_count;
+static uint32_t apt_index;
+
+static uint32_t health_failures;
+
+#if MBED_CONF_RTOS_PRESENT
+static SingletonPtr<rtos::Semaphore> refill_sem;
+static rtos::Thread *refill_thread;
+
+static void trng_pool_refill_loop()
+{
+    for (;;) {
+        refill_sem->acquire();
+        size_t level = mbedtls_trng_pool_level();
+        while (level < MBED_CONF_MBEDTLS_TRNG_POOL_SIZE) {
+            mbedtls_trng_pool_poll();
+            size_t now = mbedtls_trng_pool_level();
+            if (now <= level) {
+                /* Hardware failure or health tests rejecting the stream;
+                 * stop rather than spin, the next request retries. */
+                break;
+            }
+            level = now;
+        }
+    }
+}
+#endif
+
+/* Kick the background refill if the ring has room. */
+static void trng_pool_schedule_refill()
+{
+#if MBED_CONF_RTOS_PRESENT
+    if (!refill_thread) {
+        refill_thread = new rtos::Thread(osPriorityLow, 1024, nullptr, "trng_pool");
+        refill_thread->start(trng_pool_refill_loop);
+    }
+    refill_sem->release();
+#endif
+}
+
+/* Run the continuous health tests on one harvested byte. Returns false
+ * if the byte must be discarded. Each test counts one failure per
+ * episode and then keeps rejecting - a stuck-at stream stays blocked
+ * until it changes, rather than sneaking another run under the cutoff. */
+static bool trng_pool_health_admit(uint8_t byte)
+{
+    if (byte == rct_last) {
+        if (rct_run >= TRNG_POOL_RCT_CUTOFF) {
+            return false;
+        }
+        if (++rct_run >= TRNG_POOL_RCT_CUTOFF) {
+            health_failures++;
+            return false;
+        }
+    } else {
+        rct_last = byte;
+        rct_run = 1;
+    }
+
+    if (apt_index == 0) {
+        apt_first = byte;
+        apt_count = 1;
+        apt_index = 1;
+    } else {
+        bool reject = false;
+        if (byte == apt_first && apt_count < TRNG_POOL_APT_CUTOFF) {
+            if (++apt_count >= TRNG_POOL_APT_CUTOFF) {
+                health_failures++;
+            }
+        }
+        if (byte == apt_first && apt_count >= TRNG_POOL_APT_CUTOFF) {
+            reject = true;
+        }
+        if (++apt_index >= TRNG_POOL_APT_WINDOW) {
+            apt_index = 0;
+        }
+        if (reject) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/* Harvest up to max bytes straight from the hardware into buf.
+ * Caller holds trng_pool_mutex. Returns bytes produced. */
+static size_t trng_pool_harvest(uint8_t *buf, size_t max)
+{
+    size_t produced = 0;
+#if defined(DEVICE_TRNG)
+    trng_t trng_obj;
+    trng_init(&trng_obj);
+    if (trng_get_bytes(&trng_obj, buf, max, &produced) != 0) {
+        produced = 0;
+    }
+    trng_free(&trng_obj);
+#else /* defined(FEATURE_PSA) */
+    if (trng_get_bytes(NULL, buf, max, &produced) != 0) {
+        produced = 0;
+    }
+#endif
+    return produced;
+}
+
+int mbedtls_trng_pool_get_bytes(unsigned char *output, size_t len, size_t *olen)
+{
+    *olen = 0;
+
+    trng_pool_mutex->lock();
+
+    /* Drain what the ring already holds. */
+    size_t take = len < trng_pool_count ? len : trng_pool_count;
+    for (size_t i = 0; i < take; i++) {
+        output[i] = trng_pool[trng_pool_read];
+        trng_pool_read = (trng_pool_read + 1) % MBED_CONF_MBEDTLS_TRNG_POOL_SIZE;
+    }
+    trng_pool_count -= take;
+    *olen = take;
+
+    /* Harvest any shortfall synchronously - no slower than the pool-less
+     * path, and only hit when demand outruns the background refill. */
+    while (*olen < len) {
+        size_t produced = trng_pool_harvest(output + *olen, len - *olen);
+        if (produced == 0) {
+            break;
+        }
+        *olen += produced;
+    }
+
+    bool refill = trng_pool_count < MBED_CONF_MBEDTLS_TRNG_POOL_LOW_WATERMARK;
+
+    trng_pool_mutex->unlock();
+
+    if (refill) {
+        trng_pool_schedule_refill();
+    }
+
+    return *olen > 0 ? 0 : -1;
+}
+
+void mbedtls_trng_pool_poll(void)
+{
+    uint8_t chunk[TRNG_POOL_CHUNK];
+
+    trng_pool_mutex->lock();
+
+    size_t room = MBED_CONF_MBEDTLS_TRNG_POOL_SIZE - trng_pool_count;
+    if (room > TRNG_POOL_CHUNK) {
+        room = TRNG_POOL_CHUNK;
+    }
+    if (room > 0) {
+        size_t produced = trng_pool_harvest(chunk, room);
+        for (size_t i = 0; i < produced; i++) {
+            if (trng_pool_health_admit(chunk[i])) {
+                trng_pool[trng_pool_write] = chunk[i];
+                trng_pool_write = (trng_pool_write + 1) % MBED_CONF_MBEDTLS_TRNG_POOL_SIZE;
+                trng_pool_count++;
+            }
+        }
+        memset(chunk, 0, sizeof(chunk));
+    }
+
+    trng_pool_mutex->unlock();
+}
+
+size_t mbedtls_trng_pool_level(void)
+{
+    trng_pool_mutex->lock();
+    size_t level = trng_pool_count;
+    trng_pool_mutex->unlock();
+    return level;
+}
+
+uint32_t mbedtls_trng_pool_health_failures(void)
+{
+    trng_pool_mutex->lock();
+    uint32_t failures = health_failures;
+    trng_pool_mutex->unlock();
+    return failures;
+}
+
+#endif /* (DEVICE_TRNG || FEATURE_PSA) && pool size > 0 */
@@ -99,6 +99,10 @@
 
 #include "mbedtls/ecp_internal.h"
 
+#if defined(MBEDTLS_ECP_FIXED_POINT_TABLES)
+#include "ecp_comb_tables.h"
+#endif
+
 #if !defined(MBEDTLS_ECP_NO_INTERNAL_RNG)
 #if defined(MBEDTLS_HMAC_DRBG_C)
 #include "mbedtls/hmac_drbg.h"
@@ -2338,6 +2342,11 @@ static int ecp_mul_comb( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
     /* Compute table (or finish computing it) if not done already */
     if( !T_ok )
     {
+#if defined(MBEDTLS_ECP_FIXED_POINT_TABLES)
+        /* For the base point, try the constant table in flash first */
+        if( ! p_eq_g ||
+            mbedtls_ecp_comb_table_load( grp, w, T, T_size ) != 0 )
+#endif
         MBEDTLS_MPI_CHK( ecp_precompute_comb( grp, T, P, w, d, rs_ctx ) );
 
         if( p_eq_g )
@@ -22,6 +22,23 @@
 #include "EMAC.h"
 #include "enet_tasklet.h"
 #include "mbed_interface.h"
+#include "ns_stack_mem.h"
+
+/**
+ * Pass outgoing frames to the EMAC by pointer instead of copying them into a
+ * freshly allocated memory manager buffer. On a border router forwarding at
+ * full rate this copy is pure overhead when the Ethernet driver anyway copies
+ * the frame into its own DMA buffers inside link_out().
+ *
+ * Off by default because it is only safe with such a synchronously consuming
+ * driver: nanostack reclaims the frame memory as soon as the PHY tx() call
+ * returns, so a driver that keeps the buffer queued after link_out() returns
+ * would transmit from freed memory. Enable per target after checking the
+ * driver.
+ */
+#ifndef MBED_CONF_NANOSTACK_EMAC_ZERO_COPY_TX
+#define MBED_CONF_NANOSTACK_EMAC_ZERO_COPY_TX 0
+#endif
 
 class EMACPhy : public NanostackEthernetPhy {
 public:
@@ -122,6 +139,17 @@ int8_t EMACPhy::address_write(phy_address_type_e address_type, uint8_t *address_
 
 int8_t EMACPhy::tx(uint8_t *data_ptr, uint16_t data_len, uint8_t tx_handle, data_protocol_e data_flow)
 {
+#if MBED_CONF_NANOSTACK_EMAC_ZERO_COPY_TX
+    // Hand the frame over by pointer - the driver consumes it inside
+    // link_out(), before nanostack reclaims the memory on return
+    emac_mem_buf_t *wrap = nanostack_mem_buf_wrap(data_ptr, data_len);
+    if (wrap) {
+        // They take ownership of the wrapper - their responsibility to free
+        emac.link_out(wrap);
+        return 0;
+    }
+    // Wrapper allocation failed - fall back to the copying path
+#endif
     emac_mem_buf_t *mem = memory_manager.alloc_pool(data_len, 0);
     if (!mem) {
         return -1;
@@ -19,13 +19,21 @@
 #include <string.h>
 #include "mbed_assert.h"
 #include "NanostackMemoryManager.h"
+#include "ns_stack_mem.h"
 
-struct ns_stack_mem_t {
-    ns_stack_mem_t *next;
-    void *payload;
-    uint32_t len;
-    uint8_t mem[];
-};
+emac_mem_buf_t *nanostack_mem_buf_wrap(void *payload, uint32_t len)
+{
+    ns_stack_mem_t *buf = static_cast<ns_stack_mem_t *>(ns_dyn_mem_temporary_alloc(sizeof(ns_stack_mem_t)));
+    if (buf == NULL) {
+        return NULL;
+    }
+
+    buf->next = NULL;
+    buf->payload = payload;
+    buf->len = len;
+
+    return static_cast<emac_mem_buf_t *>(buf);
+}
 
 emac_mem_buf_t *NanostackMemoryManager::alloc_heap(uint32_t size, uint32_t align)
 {
@@ -0,0 +1,51 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2016 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NS_STACK_MEM_H
+#define NS_STACK_MEM_H
+
+#include <stdint.h>
+#include "EMACMemoryManager.h"
+
+/* Buffer layout behind NanostackMemoryManager's emac_mem_buf_t handles.
+ * Normally payload points into the trailing mem[] of the same allocation,
+ * but nothing in the manager requires that - free() releases only the
+ * ns_stack_mem_t allocation and never the payload separately. That is what
+ * makes the non-owning wrapper below possible. */
+struct ns_stack_mem_t {
+    ns_stack_mem_t *next;
+    void *payload;
+    uint32_t len;
+    uint8_t mem[];
+};
+
+/** Wrap external memory as a memory manager buffer without copying.
+ *
+ * Allocates a bare ns_stack_mem_t whose payload points at the given memory.
+ * The wrapper is compatible with all NanostackMemoryManager operations and
+ * is released with the ordinary free(), which does not touch the payload.
+ *
+ * The caller must guarantee that the payload stays valid until the consumer
+ * of the wrapper has freed it.
+ *
+ * @param payload  Pointer to the external memory, not owned by the wrapper.
+ * @param len      Payload length in bytes.
+ * @return         Wrapper buffer, or NULL in case of error.
+ */
+emac_mem_buf_t *nanostack_mem_buf_wrap(void *payload, uint32_t len);
+
+#endif /* NS_STACK_MEM_H */
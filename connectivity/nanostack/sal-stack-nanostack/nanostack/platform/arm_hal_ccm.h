@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2021, Pelion and affiliates.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * \file arm_hal_ccm.h
+ * \brief AES-CCM offload Platform API
+ */
+
+#ifndef ARM_HAL_CCM_H_
+#define ARM_HAL_CCM_H_
+
+/* Many crypto accelerators can run a complete AES-CCM pass in hardware, which
+ * is considerably faster than driving single AES-ECB blocks through the
+ * arm_hal_aes.h API from software. A target with such an engine can register
+ * its implementation here and the stack routes link-layer frame security
+ * through it instead of the software CCM library.
+ *
+ * Registration is optional. When nothing is registered, the software CCM
+ * implementation is used and behaviour is unchanged.
+ *
+ * Like arm_hal_aes.h, this API is used single-threaded, so the implementation
+ * does not need to protect the accelerator state itself.
+ */
+
+#include "ns_types.h"
+#include "ccmLIB.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * \struct arm_ccm_offload_ops_t
+ * \brief CCM offload operations supplied by the target.
+ */
+typedef struct arm_ccm_offload_ops {
+    /**
+     * \brief Run a complete CCM transform on a prepared context.
+     *
+     * The context has been set up by ccm_sec_init() and the caller: nonce,
+     * key, data, authentication data and MIC fields are all filled in as for
+     * ccm_process_run(), and the return value contract is the same.
+     *
+     * \param ccm_params CCM parameters, see ccmLIB.h.
+     *
+     * \return 0 Process OK, and in AES_CCM_DECRYPT mode the MIC was correct.
+     * \return <0 MIC fail or parameter fail.
+     */
+    int8_t (*transform)(ccm_globals_t *ccm_params);
+
+    /**
+     * \brief Preload the invariant leading part of the nonce. Optional, may be NULL.
+     *
+     * Consecutive frames from the same origin share the leading 8 bytes of
+     * the nonce (for 802.15.4 the source address) and differ only in the
+     * frame counter that follows it. An engine that can latch the nonce base
+     * and derive counter blocks itself implements this to avoid
+     * re-programming the full nonce per frame. The stack calls it only when
+     * the base changes from the previously offloaded frame.
+     *
+     * \param nonce_base Pointer to the 8 leading bytes of the nonce.
+     */
+    void (*nonce_base_set)(const uint8_t nonce_base[__static 8]);
+} arm_ccm_offload_ops_t;
+
+/**
+ * \brief Register a CCM offload implementation.
+ *
+ * The operations structure must stay valid while registered; the stack keeps
+ * only the pointer. Pass NULL to deregister and return to the software CCM
+ * implementation.
+ *
+ * \param ops Offload operations, or NULL.
+ */
+void arm_ccm_offload_register(const arm_ccm_offload_ops_t *ops);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* ARM_HAL_CCM_H_ */
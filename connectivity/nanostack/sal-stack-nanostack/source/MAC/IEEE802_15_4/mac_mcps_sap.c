@@ -29,6 +29,7 @@
 #include "ns_trace.h"
 #include "nsdynmemLIB.h"
 #include "ccmLIB.h"
+#include "Security/Common/ccm_offload.h"
 #include "mlme.h"
 #include "mac_api.h"
 #include "fhss_api.h"
@@ -683,7 +684,7 @@ static uint8_t mac_data_interface_decrypt_packet(mac_pre_parsed_frame_t *b, mlme
 
     ccm_ptr.data_ptr = (mcps_mac_payload_pointer_get(b) + openPayloadLength);
     ccm_ptr.data_len = b->mac_payload_length - openPayloadLength;
-    if (ccm_process_run(&ccm_ptr) != 0) {
+    if (ccm_offload_run(&ccm_ptr) != 0) {
         return MLME_SECURITY_FAIL;
     }
 
@@ -1832,7 +1833,7 @@ static int8_t mcps_generic_packet_build(protocol_interface_rf_mac_setup_s *rf_pt
         }
         mac_security_data_params_set(&ccm_ptr, (mhr_start + (buffer->mac_header_length_with_security + open_payload)), (mac_payload_length - open_payload));
         mac_security_authentication_data_params_set(&ccm_ptr, mhr_start, (buffer->mac_header_length_with_security + open_payload));
-        ccm_process_run(&ccm_ptr);
+        ccm_offload_run(&ccm_ptr);
     }
 
     return 0;
@@ -2077,7 +2078,7 @@ int8_t mcps_generic_ack_build(protocol_interface_rf_mac_setup_s *rf_ptr, bool in
     if (buffer->fcf_dsn.securityEnabled) {
         mac_security_data_params_set(&ccm_ptr, (mhr_start + (buffer->mac_header_length_with_security)), (mac_payload_length));
         mac_security_authentication_data_params_set(&ccm_ptr, mhr_start, (buffer->mac_header_length_with_security));
-        ccm_process_run(&ccm_ptr);
+        ccm_offload_run(&ccm_ptr);
     }
     //Disable TX Time
     phy_csma_params_t csma_params;
@@ -2159,7 +2160,7 @@ static int8_t mcps_generic_packet_rebuild(protocol_interface_rf_mac_setup_s *rf_
         }
         mac_security_data_params_set(&ccm_ptr, (mhr_start + (buffer->mac_header_length_with_security + open_payload)), (mac_payload_length - open_payload));
         mac_security_authentication_data_params_set(&ccm_ptr, mhr_start, (buffer->mac_header_length_with_security + open_payload));
-        ccm_process_run(&ccm_ptr);
+        ccm_offload_run(&ccm_ptr);
     }
 
     return 0;
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2021, Pelion and affiliates.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "nsconfig.h"
+#include "ns_types.h"
+#include "string.h"
+#include "ccmLIB.h"
+#include "platform/arm_hal_ccm.h"
+#include "Security/Common/ccm_offload.h"
+
+static const arm_ccm_offload_ops_t *ccm_offload_ops;
+static uint8_t ccm_offload_nonce_base[8];
+static bool ccm_offload_nonce_base_valid;
+
+void arm_ccm_offload_register(const arm_ccm_offload_ops_t *ops)
+{
+    ccm_offload_ops = ops;
+    ccm_offload_nonce_base_valid = false;
+}
+
+int8_t ccm_offload_run(ccm_globals_t *ccm_params)
+{
+    if (!ccm_offload_ops || !ccm_offload_ops->transform) {
+        return ccm_process_run(ccm_params);
+    }
+
+    if (ccm_offload_ops->nonce_base_set) {
+        // Consecutive frames from the same origin share the nonce base - only
+        // re-program the engine when it changes
+        if (!ccm_offload_nonce_base_valid ||
+                memcmp(ccm_offload_nonce_base, ccm_params->exp_nonce, 8) != 0) {
+            memcpy(ccm_offload_nonce_base, ccm_params->exp_nonce, 8);
+            ccm_offload_nonce_base_valid = true;
+            ccm_offload_ops->nonce_base_set(ccm_offload_nonce_base);
+        }
+    }
+
+    int8_t ret = ccm_offload_ops->transform(ccm_params);
+    // ccm_process_run() releases the AES context ccm_sec_init() allocated, so
+    // the offload path must do the same
+    ccm_free(ccm_params);
+    return ret;
+}
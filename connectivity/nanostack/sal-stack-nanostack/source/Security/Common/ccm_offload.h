@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2021, Pelion and affiliates.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CCM_OFFLOAD_H_
+#define CCM_OFFLOAD_H_
+
+#include "ccmLIB.h"
+
+/**
+ * \brief Run a CCM process through the registered offload, if any.
+ *
+ * Drop-in replacement for ccm_process_run(): when a target has registered
+ * operations through arm_ccm_offload_register(), the transform runs on the
+ * accelerator and the context is released; otherwise the call falls through
+ * to the software ccm_process_run(). Return value contract is the same.
+ *
+ * \param ccm_params CCM parameters prepared as for ccm_process_run().
+ *
+ * \return 0 CCM process OK and when AES_CCM_DECRYPT mode was selected also MIC was correct.
+ * \return <0 MIC fail or parameter fail.
+ */
+int8_t ccm_offload_run(ccm_globals_t *ccm_params);
+
+#endif /* CCM_OFFLOAD_H_ */
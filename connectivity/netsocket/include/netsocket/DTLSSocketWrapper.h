@@ -28,6 +28,23 @@
 // This class requires Mbed TLS SSL/TLS client code
 #if defined(MBEDTLS_SSL_CLI_C) || defined(DOXYGEN_ONLY)
 
+/**
+ * Set to 1 to enable storing and restoring an established DTLS connection
+ * to KVStore via store_context()/restore_context(), so the secure session
+ * survives reboots without a new handshake. Requires
+ * MBEDTLS_SSL_CONTEXT_SERIALIZATION and a configured KVStore.
+ */
+#ifndef MBED_CONF_DTLS_SOCKET_CONTEXT_PERSISTENCE
+#define MBED_CONF_DTLS_SOCKET_CONTEXT_PERSISTENCE 0
+#endif
+
+#if MBED_CONF_DTLS_SOCKET_CONTEXT_PERSISTENCE == 1
+// Serialized connections are stored under <prefix><key>
+#ifndef MBED_CONF_DTLS_SOCKET_CONTEXT_KV_PREFIX
+#define MBED_CONF_DTLS_SOCKET_CONTEXT_KV_PREFIX "/kv/dtlsctx_"
+#endif
+#endif
+
 /**
  * \brief DTLSSocketWrapper implement DTLS stream over the existing Socket transport.
  */
@@ -40,6 +57,75 @@ public:
      * @param control      Transport control mode. See @ref control_transport.
      */
     DTLSSocketWrapper(Socket *transport, const char *hostname = NULL, control_transport control = TRANSPORT_CONNECT_AND_CLOSE);
+
+#if defined(MBEDTLS_SSL_DTLS_CONNECTION_ID) || defined(DOXYGEN_ONLY)
+    /** Offer the DTLS 1.2 Connection ID extension (RFC 9146) on the next
+     *  handshake.
+     *
+     *  With a Connection ID negotiated, the server identifies this
+     *  connection by the ID carried in each record instead of by the
+     *  source address, so the session survives NAT rebinding without a
+     *  new handshake.
+     *
+     *  Must be called before connect(). A client typically passes a zero
+     *  length own CID: it then sends records with the server's CID but
+     *  does not require one itself.
+     *
+     *  @param own_cid     Connection ID the peer should use when sending
+     *                     to us, or NULL if own_cid_len is 0.
+     *  @param own_cid_len Length of own_cid in bytes, at most
+     *                     MBEDTLS_SSL_CID_IN_LEN_MAX.
+     *  @retval            NSAPI_ERROR_OK on success.
+     *  @retval            NSAPI_ERROR_PARAMETER in case the CID length is not supported.
+     *  @retval            NSAPI_ERROR_IN_PROGRESS in case the handshake was already started.
+     */
+    nsapi_error_t set_connection_id(const uint8_t *own_cid, size_t own_cid_len);
+#endif
+
+#if (MBED_CONF_DTLS_SOCKET_CONTEXT_PERSISTENCE == 1) || defined(DOXYGEN_ONLY)
+    /** Serialize the established DTLS connection to KVStore.
+     *
+     *  Stores session keys, sequence numbers and any negotiated
+     *  Connection ID so the connection can be picked up after a reboot
+     *  with restore_context() instead of a new handshake. Only possible
+     *  once the handshake has completed, with DTLS 1.2 and an AEAD
+     *  ciphersuite, and with no I/O in progress.
+     *
+     *  On success the TLS context is reset by Mbed TLS and this socket
+     *  can no longer be used for traffic; close it afterwards.
+     *
+     *  @param key KVStore key suffix to store the connection under.
+     *  @retval    NSAPI_ERROR_OK on success.
+     *  @retval    NSAPI_ERROR_NO_CONNECTION in case no connection is established.
+     *  @retval    NSAPI_ERROR_NO_MEMORY in case the serialization buffer could not be allocated.
+     *  @retval    NSAPI_ERROR_DEVICE_ERROR in case serialization or the KVStore write failed.
+     */
+    nsapi_error_t store_context(const char *key);
+
+    /** Restore a DTLS connection serialized by store_context().
+     *
+     *  Call instead of connect() on a socket whose transport is open and
+     *  bound to the peer, with the same TLS configuration as the
+     *  original connection. On success the socket is ready for send()
+     *  and recv() immediately, and the stored copy is deleted from
+     *  KVStore: serialized connection data must only ever be loaded
+     *  once, or record sequence numbers (AEAD nonces) would repeat.
+     *
+     *  @param key KVStore key suffix the connection was stored under.
+     *  @retval    NSAPI_ERROR_OK on success.
+     *  @retval    NSAPI_ERROR_NO_SOCKET in case the transport socket was not created correctly.
+     *  @retval    NSAPI_ERROR_NO_DATA in case no stored connection was found.
+     *  @retval    NSAPI_ERROR_NO_MEMORY in case the serialization buffer could not be allocated.
+     *  @retval    NSAPI_ERROR_DEVICE_ERROR in case the stored data was rejected by Mbed TLS.
+     */
+    nsapi_error_t restore_context(const char *key);
+#endif
+
+protected:
+#if defined(MBEDTLS_SSL_DTLS_CONNECTION_ID)
+    nsapi_error_t init_tls_context() override;
+#endif
+
 private:
     static void timing_set_delay(void *ctx, uint32_t int_ms, uint32_t fin_ms);
     static int timing_get_delay(void *ctx);
@@ -47,6 +133,13 @@ private:
     rtos::Kernel::Clock::time_point _int_time;
     int _timer_event_id = 0;
     bool _timer_expired = false;
+#if defined(MBEDTLS_SSL_DTLS_CONNECTION_ID)
+    // CID requested via set_connection_id(), applied once the TLS
+    // context has been set up.
+    uint8_t _own_cid[MBEDTLS_SSL_CID_IN_LEN_MAX];
+    size_t _own_cid_len = 0;
+    bool _cid_requested = false;
+#endif
 };
 
 #endif
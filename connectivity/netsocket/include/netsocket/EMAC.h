@@ -40,6 +40,11 @@ public:
      */
     static EMAC &get_default_instance();
 
+    /** Hardware validates IP/UDP/TCP checksums on received packets, see @a get_capabilities */
+    static const uint32_t CAPABILITY_CHECKSUM_OFFLOAD_RX = 0x1;
+    /** Hardware inserts IP/UDP/TCP checksums into sent packets, see @a get_capabilities */
+    static const uint32_t CAPABILITY_CHECKSUM_OFFLOAD_TX = 0x2;
+
     /**
      * Callback to be register with EMAC interface and to be called for received packets
      *
@@ -63,6 +68,22 @@ public:
      */
     virtual uint32_t get_mtu_size() const = 0;
 
+    /**
+     * Return the capabilities of the EMAC device
+     *
+     * Reports hardware offload capabilities as a mask of CAPABILITY flags
+     * so the IP stack can skip the corresponding software work. The base
+     * implementation reports no capabilities, so existing drivers are
+     * unaffected; drivers whose hardware offloads checksums should
+     * override this.
+     *
+     * @return     Capability mask of CAPABILITY_* flags
+     */
+    virtual uint32_t get_capabilities() const
+    {
+        return 0;
+    }
+
     /**
      * Gets memory buffer alignment preference
      *
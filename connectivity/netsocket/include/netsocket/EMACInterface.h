@@ -22,6 +22,15 @@
 #include "EMAC.h"
 #include "OnboardNetworkStack.h"
 
+/** Warm start: cache the last DHCP lease in KVStore and seed the interface
+ *  with it on the next connect, so traffic can flow while the DHCP exchange
+ *  revalidates the lease in the background. Set to 1 to compile in; requires
+ *  a configured KVStore. Disabled by default.
+ */
+#ifndef MBED_CONF_NSAPI_EMAC_WARM_START
+#define MBED_CONF_NSAPI_EMAC_WARM_START 0
+#endif
+
 
 /** EMACInterface class
  *  Implementation of the NetworkInterface for an EMAC-based driver
@@ -116,6 +125,29 @@ public:
     /** @copydoc NetworkInterface::set_blocking */
     nsapi_error_t set_blocking(bool blocking) override;
 
+#if MBED_CONF_NSAPI_EMAC_WARM_START
+    /** Enable or disable warm start
+     *
+     *  When enabled (the default when compiled in) and DHCP is in use,
+     *  connect() seeds the interface with the last lease cached in
+     *  KVStore so the stack is usable immediately, while the DHCP
+     *  exchange continues in the background and replaces the address if
+     *  the server disagrees. The lease is re-cached whenever the
+     *  interface reaches NSAPI_STATUS_GLOBAL_UP.
+     *
+     *  @param warm_start  True to use the cached lease on connect.
+     *  @return            NSAPI_ERROR_OK on success.
+     */
+    nsapi_error_t set_warm_start(bool warm_start);
+
+    /** Tell whether the current connection was seeded from a cached lease
+     *
+     *  @return  True if connect() brought the interface up with a cached
+     *           DHCP lease that has not been handed over to a fresh one.
+     */
+    bool is_warm_start_active() const;
+#endif
+
     /** Provide access to the EMAC
      *
      * This should be used with care - normally the network stack would
@@ -153,6 +185,27 @@ protected:
     char _gateway[NSAPI_IPv4_SIZE] {};
     uint8_t _hw_mac_addr[NSAPI_MAC_BYTES] {};
     mbed::Callback<void(nsapi_event_t, intptr_t)> _connection_status_cb;
+
+#if MBED_CONF_NSAPI_EMAC_WARM_START
+private:
+    /** Interposed status callback: caches the lease on GLOBAL_UP, then
+     *  forwards the event to the application callback. */
+    void warm_start_status(nsapi_event_t event, intptr_t status);
+
+    /** Build the KVStore key for this interface's lease; false if the
+     *  interface name is not available yet. */
+    bool warm_start_lease_key(char *key, size_t size);
+
+    /** Read the cached lease; false if none is stored. */
+    bool load_cached_lease(char *ip, char *netmask, char *gateway);
+
+    /** Cache the currently assigned lease, skipping the write when the
+     *  stored copy already matches. */
+    void store_lease();
+
+    bool _warm_start = true;
+    bool _warm_started = false;
+#endif
 };
 
 #endif
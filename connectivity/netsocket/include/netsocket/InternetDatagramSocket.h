@@ -74,6 +74,94 @@ public:
     nsapi_size_or_error_t recvfrom(SocketAddress *address,
                                    void *data, nsapi_size_t size) override;
 
+    /** Receive a datagram without copying, storing the source address in address if it's not NULL.
+     *
+     *  Passes ownership of the stack's memory buffer chain holding the
+     *  datagram payload to the caller, so the data can be consumed in place
+     *  without being copied out of the stack. The caller must release the
+     *  buffer with release_recv_buffer() when done with it.
+     *
+     *  By default, recvfrom_buffer blocks until a datagram is received. If socket is set to
+     *  nonblocking or times out with no datagram, NSAPI_ERROR_WOULD_BLOCK
+     *  is returned.
+     *
+     *  @note If socket is connected, only packets coming from connected peer address
+     *  are accepted.
+     *
+     *  @param address  Destination for the source address or NULL.
+     *  @param buffer   Destination for the received memory buffer chain.
+     *  @retval         int Number of received bytes on success.
+     *  @retval         NSAPI_ERROR_NO_SOCKET in case socket was not created correctly.
+     *  @retval         NSAPI_ERROR_WOULD_BLOCK in case non-blocking mode is enabled
+     *                  and no datagram is available immediately.
+     *  @retval         NSAPI_ERROR_UNSUPPORTED in case the stack does not support
+     *                  zero-copy receive.
+     *  @retval         int Other negative error codes for stack-related failures.
+     *                  See \ref NetworkStack::socket_recvfrom_buffer.
+     */
+    nsapi_size_or_error_t recvfrom_buffer(SocketAddress *address,
+                                          net_stack_mem_buf_t **buffer) override;
+
+    /** Receive a datagram together with its receive timestamp.
+     *
+     *  Behaves as recvfrom(), and additionally reports when the datagram
+     *  arrived at the link, as stamped by the stack's input path - rather
+     *  than when the application thread got around to reading it. On
+     *  stacks or interfaces that do not timestamp receive, timestamp->valid
+     *  is cleared and the call otherwise succeeds as recvfrom() would.
+     *
+     *  The timestamp epoch is that of the stamping clock (boot time by
+     *  default, the PTP hardware clock where the target provides one);
+     *  see \ref nsapi_timestamp_t.
+     *
+     *  @param address   Destination for the source address or NULL.
+     *  @param data      Destination buffer for RAW data to be received from the host.
+     *  @param size      Size of the buffer in bytes.
+     *  @param timestamp Destination for the receive timestamp.
+     *  @retval          int Number of received bytes on success.
+     *  @retval          NSAPI_ERROR_NO_SOCKET in case socket was not created correctly.
+     *  @retval          NSAPI_ERROR_WOULD_BLOCK in case non-blocking mode is enabled
+     *                   and no datagram is available immediately.
+     *  @retval          int Other negative error codes for stack-related failures.
+     *                   See \ref NetworkStack::socket_recvfrom_timestamp.
+     */
+    nsapi_size_or_error_t recvfrom_timestamp(SocketAddress *address,
+                                             void *data, nsapi_size_t size,
+                                             nsapi_timestamp_t *timestamp);
+
+    /** Enable busy-poll receive for latency-critical loops.
+     *
+     *  With a non-zero spin budget, recvfrom(), recv() and
+     *  recvfrom_timestamp() poll the stack directly for up to spin_us
+     *  microseconds before falling back to
+     *  the ordinary blocking wait. Polling skips the sigio-to-thread
+     *  wakeup chain and its scheduling jitter, at the price of burning
+     *  a core for the spin - intended for a dedicated receive thread in
+     *  control loops, not for general use.
+     *
+     *  The spin holds the socket lock, so other threads using the same
+     *  socket are blocked for its duration; busy-poll assumes a single
+     *  reader.
+     *
+     *  @param spin_us  Microseconds to poll before blocking, 0 to
+     *                  disable (default)
+     */
+    void set_busy_poll(uint32_t spin_us);
+
+    /** Send a vector of data buffers to the connected remote address.
+     *
+     *  This is equivalent to calling sendtov(remote, iov, iov_count),
+     *  where remote is the address set by a call to connect().
+     *
+     *  @param iov       Scatter-gather vector of data buffers to send.
+     *  @param iov_count Number of elements in the vector.
+     *  @retval          int Number of sent bytes on success.
+     *  @retval          NSAPI_ERROR_NO_ADDRESS if the remote address was not set with connect().
+     *  @retval          int Negative error codes for stack-related failures.
+     *                   See \ref Socket::sendtov.
+     */
+    nsapi_size_or_error_t sendv(const nsapi_iovec_t *iov, int iov_count) override;
+
     /** Set the remote address for next send() call and filtering
      *  of incoming packets. To reset the address, zero initialized
      *  SocketAddress must be in the address parameter.
@@ -147,6 +235,15 @@ protected:
      */
     InternetDatagramSocket() = default;
 
+    /** Poll the stack for up to the busy-poll budget after a would-block
+     *  receive; returns the last receive result.
+     */
+    nsapi_size_or_error_t busy_poll_recvfrom(SocketAddress *address,
+                                             void *data, nsapi_size_t size,
+                                             nsapi_timestamp_t *timestamp);
+
+    uint32_t _busy_poll_us = 0;
+
 #endif //!defined(DOXYGEN_ONLY)
 };
 
@@ -154,6 +154,32 @@ public:
      */
     nsapi_error_t getpeername(SocketAddress *address) override;
 
+    /** @copydoc Socket::release_recv_buffer
+     */
+    void release_recv_buffer(net_stack_mem_buf_t *buffer) override;
+
+    /** @copydoc Socket::sendv
+     */
+    nsapi_size_or_error_t sendv(const nsapi_iovec_t *iov, int iov_count) override;
+
+    /** @copydoc Socket::sendtov
+     */
+    nsapi_size_or_error_t sendtov(const SocketAddress &address,
+                                  const nsapi_iovec_t *iov, int iov_count) override;
+
+    /** Set a fixed header template for vectored sends.
+     *
+     *  The header is copied and prepended to the data of every following
+     *  sendv() and sendtov() call, so protocols with a constant packet
+     *  header do not need to pass it on every send. Setting a new header
+     *  replaces the previous one; a NULL header or zero size clears it.
+     *
+     *  @param header   Header data to prepend, or NULL to clear.
+     *  @param size     Size of the header in bytes, or 0 to clear.
+     *  @return         NSAPI_ERROR_OK on success, negative error code on failure.
+     */
+    nsapi_error_t set_send_header(const void *header, nsapi_size_t size);
+
 
 #if !defined(DOXYGEN_ONLY)
 
@@ -175,6 +201,14 @@ protected:
     uint8_t _writers = 0;
     core_util_atomic_flag _pending = CORE_UTIL_ATOMIC_FLAG_INIT;
     bool _factory_allocated = false;
+    uint8_t *_send_header = nullptr;
+    nsapi_size_t _send_header_size = 0;
+
+    /** Common blocking loop of sendv() and sendtov(); sends to address
+     *  if it is not NULL, otherwise over the connected socket, prepending
+     *  the header template when one is set. */
+    nsapi_size_or_error_t sendv_internal(const SocketAddress *address,
+                                         const nsapi_iovec_t *iov, int iov_count);
 
     // Event flags
     static const int READ_FLAG     = 0x1u;
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @file MdnsResponder.h MdnsResponder class */
+/** \addtogroup netsocket
+ * @{*/
+
+#ifndef MDNS_RESPONDER_H
+#define MDNS_RESPONDER_H
+
+#include "netsocket/UDPSocket.h"
+#include "netsocket/NetworkInterface.h"
+#include "platform/NonCopyable.h"
+#include "rtos/Mutex.h"
+
+/** Number of services that can be registered with an MdnsResponder.
+ */
+#ifndef MBED_CONF_NSAPI_MDNS_MAX_SERVICES
+#define MBED_CONF_NSAPI_MDNS_MAX_SERVICES 4
+#endif
+
+/** Packet buffer size for mDNS receive and transmit. 512 bytes is the
+ *  classic DNS message limit and large enough for a full service
+ *  announcement; responses that would not fit are truncated at record
+ *  boundaries.
+ */
+#ifndef MBED_CONF_NSAPI_MDNS_PACKET_SIZE
+#define MBED_CONF_NSAPI_MDNS_PACKET_SIZE 512
+#endif
+
+/** TTL advertised in mDNS resource records, in seconds.
+ */
+#ifndef MBED_CONF_NSAPI_MDNS_TTL
+#define MBED_CONF_NSAPI_MDNS_TTL 120
+#endif
+
+/** mDNS/DNS-SD responder
+ *
+ *  Answers multicast DNS queries for a host name and a static table of
+ *  DNS-SD services ("<instance>.<type>.local"), so the device can be
+ *  discovered on the local link without a separate discovery daemon.
+ *
+ *  The responder is built for coexistence with high-rate data traffic:
+ *  packets are parsed and composed in place in two fixed buffers owned
+ *  by the object, no memory is allocated per packet, and all work runs
+ *  on the shared event queue rather than in the IP stack's own thread.
+ *  Known-answer suppression (RFC 6762 section 7.1) keeps it from
+ *  repeating answers the querier already holds.
+ *
+ *  Registered strings are referenced, not copied; they must stay valid
+ *  until stop() is called. String literals are the expected use.
+ *
+ *  Only IPv4 (A record) responses are generated.
+ *
+ *  @note Synchronization level: Thread safe
+ */
+class MdnsResponder : private mbed::NonCopyable<MdnsResponder> {
+public:
+    MdnsResponder();
+
+    /** Destroy the responder, stopping it if it is running.
+     */
+    ~MdnsResponder();
+
+    /** Register a service to advertise.
+     *
+     *  May be called before or after start(); services registered while
+     *  running are announced on the next query.
+     *
+     *  @param instance Instance name, a single DNS label ("Living Room Sensor")
+     *  @param type     Service type in DNS-SD form ("_http._tcp")
+     *  @param port     TCP or UDP port the service listens on
+     *  @param txt      Contents of the TXT record ("path=/api") or NULL for none
+     *  @retval         NSAPI_ERROR_OK on success
+     *  @retval         NSAPI_ERROR_PARAMETER if instance or type is NULL
+     *  @retval         NSAPI_ERROR_NO_MEMORY if the service table is full
+     */
+    nsapi_error_t add_service(const char *instance, const char *type,
+                              uint16_t port, const char *txt = NULL);
+
+    /** Start answering queries.
+     *
+     *  Opens a UDP socket on the interface's stack, binds it to port
+     *  5353, joins the mDNS multicast group and announces the
+     *  registered records twice, one second apart, as RFC 6762
+     *  recommends.
+     *
+     *  @param interface Connected network interface to respond on
+     *  @param hostname  Host name to claim, a single DNS label without
+     *                   the ".local" suffix
+     *  @retval          NSAPI_ERROR_OK on success
+     *  @retval          NSAPI_ERROR_PARAMETER if interface or hostname is NULL
+     *  @retval          NSAPI_ERROR_IS_CONNECTED if already started
+     *  @retval          int Negative error codes from socket open, bind
+     *                   or multicast join
+     */
+    nsapi_error_t start(NetworkInterface *interface, const char *hostname);
+
+    /** Stop answering queries.
+     *
+     *  Sends a goodbye announcement (all records with TTL 0) so caches
+     *  drop the device promptly, then closes the socket. Registered
+     *  services are kept and advertised again on the next start().
+     */
+    void stop();
+
+private:
+    struct mdns_service_t {
+        const char *instance;
+        const char *type;
+        const char *txt;
+        uint16_t port;
+    };
+
+    /* Offsets of names already written into the response, for DNS
+     * compression pointers; 0 means not written yet. */
+    struct name_offsets_t {
+        uint16_t host;
+        uint16_t enumeration;
+        uint16_t type[MBED_CONF_NSAPI_MDNS_MAX_SERVICES];
+        uint16_t full[MBED_CONF_NSAPI_MDNS_MAX_SERVICES];
+    };
+
+    void socket_event();
+    void process();
+    void handle_query(nsapi_size_t size, const SocketAddress &source);
+    void announce(uint32_t ttl);
+    void announce_again();
+    void send_response(uint32_t full_mask, uint32_t enum_mask, bool host,
+                       uint16_t id, uint32_t ttl,
+                       const SocketAddress *unicast_dest);
+    uint16_t append_service_records(uint16_t len, unsigned int index,
+                                    uint32_t ttl, uint16_t unique_class,
+                                    name_offsets_t *offsets, uint16_t *count);
+    uint16_t append_enum_record(uint16_t len, unsigned int index,
+                                uint32_t ttl, name_offsets_t *offsets,
+                                uint16_t *count);
+    uint16_t append_host_record(uint16_t len, uint32_t ttl,
+                                uint16_t unique_class,
+                                name_offsets_t *offsets, uint16_t *count);
+
+    UDPSocket _socket;
+    NetworkInterface *_interface;
+    const char *_hostname;
+    mdns_service_t _services[MBED_CONF_NSAPI_MDNS_MAX_SERVICES];
+    unsigned int _service_count;
+    int _announce_event_id;
+    bool _running;
+    rtos::Mutex _lock;
+    uint8_t _rx_buf[MBED_CONF_NSAPI_MDNS_PACKET_SIZE];
+    uint8_t _tx_buf[MBED_CONF_NSAPI_MDNS_PACKET_SIZE];
+};
+
+#endif
+
+/** @}*/
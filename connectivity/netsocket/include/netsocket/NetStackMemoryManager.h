@@ -38,10 +38,10 @@
  *
  */
 
-#include "nsapi.h"
-
 typedef void net_stack_mem_buf_t;          // Memory buffer
 
+#include "nsapi.h"
+
 class NetStackMemoryManager {
 public:
 
@@ -0,0 +1,219 @@
+/** @file NetworkFailover.h NetworkFailover */
+/*
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @addtogroup netsocket
+* @{
+*/
+
+#ifndef MBED_NETWORK_FAILOVER_H
+#define MBED_NETWORK_FAILOVER_H
+
+#include "netsocket/NetworkInterface.h"
+#include "events/EventQueue.h"
+#include "events/PeriodicTask.h"
+#include "platform/Callback.h"
+#include "platform/NonCopyable.h"
+#include "rtos/Mutex.h"
+
+/* Health probe period in milliseconds */
+#ifndef MBED_CONF_NSAPI_FAILOVER_PROBE_PERIOD
+#define MBED_CONF_NSAPI_FAILOVER_PROBE_PERIOD 5000
+#endif
+/* Consecutive probe failures before a link is considered unhealthy */
+#ifndef MBED_CONF_NSAPI_FAILOVER_PROBE_FAILURES
+#define MBED_CONF_NSAPI_FAILOVER_PROBE_FAILURES 3
+#endif
+/* Hosts that can be registered for standby pre-warming */
+#ifndef MBED_CONF_NSAPI_FAILOVER_PREWARM_TARGETS
+#define MBED_CONF_NSAPI_FAILOVER_PREWARM_TARGETS 4
+#endif
+
+/** Keep two network interfaces up and fail over between them.
+ *
+ * A gateway with Ethernet and cellular normally uses one interface and
+ * brings the other up only after the first one dies, which costs tens
+ * of seconds of outage. NetworkFailover keeps both interfaces connected
+ * at once: the primary carries the traffic while the standby is held
+ * ready and verified by periodic health probes (a DNS resolution
+ * through each link). When the active link drops or its probes fail
+ * repeatedly, the engine switches to the healthy link and notifies the
+ * application, which re-opens its sockets through the new active
+ * interface - no interface bring-up happens on the failover path. The
+ * primary is preferred, so service fails back automatically once it
+ * recovers.
+ *
+ * Standby pre-warming keeps the cold-start cost off the failover path
+ * too: registered hosts are resolved through the standby link ahead of
+ * time and, when TLS is compiled in, a TLS handshake is completed and
+ * closed so the session lands in the TLS session resumption cache.
+ * Sockets re-opened after a failover then resume with an abbreviated
+ * handshake instead of a full one.
+ *
+ * The engine runs entirely on the event queue given at construction;
+ * bring-up, probing and pre-warming block that queue's thread, so give
+ * the engine its own queue or share one that tolerates blocking calls.
+ * The engine owns the status callbacks of both interfaces - register
+ * application callbacks on the engine, not on the interfaces.
+ *
+ * Sockets choose their path with a binding policy:
+ *
+ * @code
+ * TCPSocket sock;
+ * sock.open(failover.get(NetworkFailover::BIND_ACTIVE));
+ * @endcode
+ *
+ * A socket stays on the interface it was opened on; after a failover
+ * the application closes it and opens a replacement through the engine.
+ */
+class NetworkFailover : private mbed::NonCopyable<NetworkFailover> {
+public:
+    /** Which interface a socket should be opened on */
+    enum binding_policy_t {
+        BIND_ACTIVE,    /**< The interface currently carrying traffic */
+        BIND_PRIMARY,   /**< Always the primary, regardless of health */
+        BIND_STANDBY,   /**< The interface currently held in reserve */
+    };
+
+    /** Create a failover engine over two interfaces
+     *
+     *  @param primary   Preferred interface, carries traffic when healthy
+     *  @param secondary Standby interface
+     *  @param queue     Queue whose dispatch context runs the engine
+     */
+    NetworkFailover(NetworkInterface *primary, NetworkInterface *secondary,
+                    events::EventQueue *queue);
+
+    /** Stops the engine; the interfaces are left as they are */
+    ~NetworkFailover();
+
+    /** Set the hostname resolved by the health probes
+     *
+     * Without a probe host, health follows the interfaces' connection
+     * status alone, which misses dead paths that still hold a link.
+     * The string is not copied and must stay valid while the engine
+     * runs.
+     *
+     *  @param hostname  Host resolved through each link every probe
+     *                   period
+     */
+    void set_probe(const char *hostname);
+
+    /** Register a host to pre-warm on the standby link
+     *
+     * The host is resolved through the standby interface ahead of time
+     * and, when TLS client support is compiled in, a TLS session is
+     * established and closed so a later connection resumes from the
+     * session cache. The strings are not copied and must stay valid
+     * while the engine runs.
+     *
+     *  @param hostname     Host to pre-warm
+     *  @param port         TLS port to handshake with
+     *  @param root_ca_pem  Root CA for the handshake as a nul-terminated
+     *                      PEM string, or NULL to use the default trust
+     *                      store
+     *  @return             NSAPI_ERROR_OK on success,
+     *                      NSAPI_ERROR_NO_MEMORY when all
+     *                      MBED_CONF_NSAPI_FAILOVER_PREWARM_TARGETS
+     *                      slots are taken
+     */
+    nsapi_error_t add_prewarm(const char *hostname, uint16_t port,
+                              const char *root_ca_pem = NULL);
+
+    /** Register a callback for failover notifications
+     *
+     * Called from the engine's queue context with the newly active
+     * interface whenever traffic switches links, including failback to
+     * the primary. Re-open active-bound sockets from it.
+     *
+     *  @param on_switch    Callback invoked on every switch, or empty to
+     *                      clear
+     */
+    void attach(mbed::Callback<void(NetworkInterface *)> on_switch);
+
+    /** Start the engine
+     *
+     * Both interfaces are brought up from the queue's context and the
+     * health probe timer starts. Returns without waiting for the links.
+     *
+     *  @return         NSAPI_ERROR_OK on success,
+     *                  NSAPI_ERROR_IS_CONNECTED if already started
+     */
+    nsapi_error_t start();
+
+    /** Stop the engine
+     *
+     * Probing and failover stop; both interfaces are left connected so
+     * traffic on them is not disturbed.
+     */
+    void stop();
+
+    /** Get the interface currently carrying traffic
+     *
+     *  @return         The active interface
+     */
+    NetworkInterface *active();
+
+    /** Get an interface by binding policy
+     *
+     *  @param policy   Which interface to return
+     *  @return         The interface the policy selects right now
+     */
+    NetworkInterface *get(binding_policy_t policy);
+
+    /** Get the health of one of the managed interfaces
+     *
+     *  @param iface    Interface to query
+     *  @return         True when the link is up and its probes pass
+     */
+    bool is_healthy(NetworkInterface *iface);
+
+private:
+    struct link_t {
+        NetworkInterface *iface;
+        uint32_t fails;         // Consecutive probe failures
+        bool up;                // Connection status reports up
+        bool healthy;           // Up and probes passing
+        bool prewarmed;
+    };
+
+    struct prewarm_t {
+        const char *host;
+        const char *root_ca;
+        uint16_t port;
+    };
+
+    void bring_up(int index);
+    void handle_link(int index, nsapi_connection_status_t status);
+    void probe_all();
+    void evaluate();
+    void prewarm(int index);
+
+    link_t _links[2];
+    prewarm_t _targets[MBED_CONF_NSAPI_FAILOVER_PREWARM_TARGETS];
+    int _num_targets;
+    int _active;
+    const char *_probe_host;
+    events::EventQueue *_queue;
+    events::PeriodicTask _prober;
+    mbed::Callback<void(NetworkInterface *)> _on_switch;
+    bool _started;
+    rtos::Mutex _lock;
+};
+
+#endif
+
+/** @}*/
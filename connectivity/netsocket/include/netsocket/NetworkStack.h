@@ -25,6 +25,12 @@
 #include "netsocket/NetworkInterface.h"
 #include "DNS.h"
 
+// Only the opaque buffer type and the manager class name are needed
+// here; including NetStackMemoryManager.h would pull the whole socket
+// API back in through nsapi.h
+typedef void net_stack_mem_buf_t;
+class NetStackMemoryManager;
+
 /** @file NetworkStack.h NetworkStack class */
 /** @addtogroup netsocket
  * @{ */
@@ -32,6 +38,22 @@
 // Predeclared classes
 class OnboardNetworkStack;
 
+/** Structure to parse per-interface traffic statistics
+ *
+ *  Counters are sampled from the underlying IP stack and are plain
+ *  cumulative counts - no rates or formatting.
+ */
+typedef struct {
+    char name[NSAPI_INTERFACE_NAME_MAX_SIZE]; /**< Interface name as returned by get_interface_name */
+    uint32_t rx_bytes;        /**< Octets received on the interface */
+    uint32_t rx_packets;      /**< Packets delivered to upper layers */
+    uint32_t rx_drops;        /**< Inbound packets discarded or in error */
+    uint32_t tx_bytes;        /**< Octets transmitted out of the interface */
+    uint32_t tx_packets;      /**< Packets requested to be transmitted */
+    uint32_t tx_drops;        /**< Outbound packets discarded or in error */
+    uint32_t tcp_retransmits; /**< TCP segments retransmitted, counted stack-wide */
+} mbed_stats_interface_t;
+
 /** NetworkStack class
  *
  *  Common interface that is shared between hardware that
@@ -377,6 +399,125 @@ protected:
     virtual nsapi_size_or_error_t socket_sendto(nsapi_socket_t handle, const SocketAddress &address,
                                                 const void *data, nsapi_size_t size) = 0;
 
+    /** Send a vector of data buffers over a TCP socket
+     *
+     *  The socket must be connected to a remote host. Gathers the
+     *  scatter-gather vector into the outgoing stream, so the caller does
+     *  not need to assemble the data into one contiguous buffer. Fewer
+     *  bytes than the vector total may be sent; the return value reports
+     *  how many were.
+     *
+     *  This call is non-blocking. If sendv would block,
+     *  NSAPI_ERROR_WOULD_BLOCK is returned immediately.
+     *
+     *  Stacks that do not support vectored sends return
+     *  NSAPI_ERROR_UNSUPPORTED; the caller should then fall back to
+     *  socket_send.
+     *
+     *  @param handle    Socket handle
+     *  @param iov       Scatter-gather vector of data buffers to send
+     *  @param iov_count Number of elements in the vector
+     *  @return          Number of sent bytes on success, negative error
+     *                   code on failure
+     */
+    virtual nsapi_size_or_error_t socket_sendv(nsapi_socket_t handle,
+                                               const nsapi_iovec_t *iov, int iov_count);
+
+    /** Send a vector of data buffers over a UDP socket
+     *
+     *  Gathers the scatter-gather vector into one datagram sent to the
+     *  specified address, so the caller does not need to assemble the
+     *  data into one contiguous buffer.
+     *
+     *  This call is non-blocking. If sendtov would block,
+     *  NSAPI_ERROR_WOULD_BLOCK is returned immediately.
+     *
+     *  Stacks that do not support vectored sends return
+     *  NSAPI_ERROR_UNSUPPORTED; the caller should then fall back to
+     *  socket_sendto.
+     *
+     *  @param handle    Socket handle
+     *  @param address   The SocketAddress of the remote host
+     *  @param iov       Scatter-gather vector of data buffers to send
+     *  @param iov_count Number of elements in the vector
+     *  @return          Number of sent bytes on success, negative error
+     *                   code on failure
+     */
+    virtual nsapi_size_or_error_t socket_sendtov(nsapi_socket_t handle, const SocketAddress &address,
+                                                 const nsapi_iovec_t *iov, int iov_count);
+
+    /** Send data over a TCP socket without copying it
+     *
+     *  The socket must be connected to a remote host. The stack references
+     *  the caller's buffer directly instead of copying it into its send
+     *  buffer, so the buffer must stay valid and unmodified until the
+     *  accepted bytes have been acknowledged by the remote end. Use
+     *  socket_notify_sent to learn when that has happened. Fewer bytes
+     *  than requested may be accepted; the return value reports how many.
+     *
+     *  This call is non-blocking. If send_nocopy would block,
+     *  NSAPI_ERROR_WOULD_BLOCK is returned immediately.
+     *
+     *  Stacks that cannot send from caller-owned memory return
+     *  NSAPI_ERROR_UNSUPPORTED; the caller should then fall back to
+     *  socket_send.
+     *
+     *  @param handle    Socket handle
+     *  @param data      Buffer of data to send, valid until acknowledged
+     *  @param size      Size of the buffer in bytes
+     *  @return          Number of sent bytes on success, negative error
+     *                   code on failure
+     */
+    virtual nsapi_size_or_error_t socket_send_nocopy(nsapi_socket_t handle,
+                                                     const void *data, nsapi_size_t size);
+
+    /** Request a callback once all data sent so far has been acknowledged
+     *
+     *  Registers a callback that is invoked once every byte accepted by
+     *  the socket up to this point has been acknowledged by the remote
+     *  end, meaning the stack no longer references any caller-owned
+     *  buffer passed to socket_send_nocopy before this call. If nothing
+     *  is outstanding the callback is invoked before this call returns.
+     *  The callback may otherwise be invoked from the stack's own context
+     *  and should not perform long operations. If the socket is closed
+     *  first, the callback is invoked from the close, after the stack has
+     *  dropped its buffer references.
+     *
+     *  @param handle    Socket handle
+     *  @param callback  Function to call once outstanding data is acknowledged
+     *  @param data      Argument to pass to callback
+     *  @return          NSAPI_ERROR_OK on success, negative error code on
+     *                   failure
+     */
+    virtual nsapi_error_t socket_notify_sent(nsapi_socket_t handle,
+                                             void (*callback)(void *), void *data);
+
+    /** Get the number of sent bytes not yet acknowledged by the peer
+     *
+     *  Reports how much data is queued on the connection waiting for
+     *  acknowledgement, which makes send-queue growth observable as a
+     *  cheap counter. Only meaningful for stream sockets.
+     *
+     *  Stacks that do not track acknowledgement progress return
+     *  NSAPI_ERROR_UNSUPPORTED.
+     *
+     *  @param handle    Socket handle
+     *  @return          Number of unacknowledged bytes on success,
+     *                   negative error code on failure
+     */
+    virtual nsapi_size_or_error_t socket_send_pending(nsapi_socket_t handle);
+
+    /** Fill the passed array of structures with traffic statistics for each interface
+     *
+     *  Counters are sampled from the stack's own accounting; stacks
+     *  without such accounting fill nothing and return 0.
+     *
+     *  @param stats    A pointer to an array of mbed_stats_interface_t structures to fill
+     *  @param count    The number of mbed_stats_interface_t structures in the provided array
+     *  @return         The number of mbed_stats_interface_t structures that have been filled
+     */
+    virtual size_t get_interface_stats(mbed_stats_interface_t *stats, size_t count);
+
     /** Receive a packet over a UDP socket
      *
      *  Receives data and stores the source address in address if address
@@ -395,6 +536,57 @@ protected:
     virtual nsapi_size_or_error_t socket_recvfrom(nsapi_socket_t handle, SocketAddress *address,
                                                   void *buffer, nsapi_size_t size) = 0;
 
+    /** Receive a packet over a UDP socket without copying
+     *
+     *  Receives a datagram and returns ownership of the stack's memory
+     *  buffer chain holding the payload, so the data can be consumed in
+     *  place. The caller must free the buffer chain through the stack's
+     *  memory manager when done with it. Stores the source address in
+     *  address if address is not NULL.
+     *
+     *  This call is non-blocking. If recvfrom_buffer would block,
+     *  NSAPI_ERROR_WOULD_BLOCK is returned immediately.
+     *
+     *  Stacks that do not support zero-copy receive return
+     *  NSAPI_ERROR_UNSUPPORTED; the caller should then fall back to
+     *  socket_recvfrom.
+     *
+     *  @param handle   Socket handle
+     *  @param address  Destination for the source address or NULL
+     *  @param buffer   Destination for the received memory buffer chain
+     *  @return         Number of received bytes on success, negative error
+     *                  code on failure
+     */
+    virtual nsapi_size_or_error_t socket_recvfrom_buffer(nsapi_socket_t handle, SocketAddress *address,
+                                                         net_stack_mem_buf_t **buffer);
+
+    /** Receive a packet over a UDP socket with its receive timestamp
+     *
+     *  Behaves as socket_recvfrom, and additionally reports when the
+     *  packet arrived at the link, as stamped by the stack's input path.
+     *  Stacks that do not timestamp receive clear timestamp->valid and
+     *  otherwise behave as socket_recvfrom, so callers can probe support
+     *  per packet.
+     *
+     *  @param handle    Socket handle
+     *  @param address   Destination for the source address or NULL
+     *  @param buffer    Destination buffer for data received from the host
+     *  @param size      Size of the buffer in bytes
+     *  @param timestamp Destination for the receive timestamp
+     *  @return          Number of received bytes on success, negative error
+     *                   code on failure
+     */
+    virtual nsapi_size_or_error_t socket_recvfrom_timestamp(nsapi_socket_t handle, SocketAddress *address,
+                                                            void *buffer, nsapi_size_t size,
+                                                            nsapi_timestamp_t *timestamp);
+
+    /** Get the memory manager used for zero-copy memory buffers
+     *
+     *  @return         Memory manager, or NULL if the stack does not
+     *                  support zero-copy receive
+     */
+    virtual NetStackMemoryManager *get_memory_manager();
+
     /** Register a callback on state change of the socket
      *
      *  The specified callback will be called on state changes such as when
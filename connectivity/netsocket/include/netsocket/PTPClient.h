@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @file PTPClient.h PTPClient class */
+/** \addtogroup netsocket
+ * @{*/
+
+#ifndef PTP_CLIENT_H
+#define PTP_CLIENT_H
+
+#include "netsocket/UDPSocket.h"
+#include "netsocket/NetworkInterface.h"
+#include "platform/NonCopyable.h"
+#include "rtos/Mutex.h"
+
+/** Offset magnitude above which the clock is stepped instead of slewed,
+ *  in nanoseconds. Below it the servo trims frequency only, keeping the
+ *  clock monotonic.
+ */
+#ifndef MBED_CONF_NSAPI_PTP_STEP_THRESHOLD_NS
+#define MBED_CONF_NSAPI_PTP_STEP_THRESHOLD_NS 100000000
+#endif
+
+/** Interval between Delay_Req transmissions, in milliseconds.
+ */
+#ifndef MBED_CONF_NSAPI_PTP_DELAY_REQ_INTERVAL_MS
+#define MBED_CONF_NSAPI_PTP_DELAY_REQ_INTERVAL_MS 1000
+#endif
+
+/** Largest frequency correction the servo will apply, in parts per
+ *  billion. Also the bound assumed for the software clock when no
+ *  PTP hardware clock is present.
+ */
+#ifndef MBED_CONF_NSAPI_PTP_MAX_FREQUENCY_PPB
+#define MBED_CONF_NSAPI_PTP_MAX_FREQUENCY_PPB 100000
+#endif
+
+/** IEEE 1588-2008 ordinary-clock slave over UDP/IPv4
+ *
+ *  Listens for Sync/Follow_Up from the domain's master, exchanges
+ *  Delay_Req/Delay_Resp, and steers the local clock with a
+ *  proportional-integral servo: large offsets step the clock once,
+ *  after which only frequency is trimmed so time stays monotonic.
+ *
+ *  On targets with a PTP hardware clock (DEVICE_PTP) the servo steers
+ *  that clock through the PTP hal, and hardware receive timestamps
+ *  (see InternetDatagramSocket::recvfrom_timestamp) are already in its
+ *  timescale. Elsewhere a software clock is disciplined instead: the
+ *  microsecond ticker plus a maintained offset and rate, which is also
+ *  how receive timestamps taken at the EMAC boundary are interpreted.
+ *  Accuracy follows the timestamps available - microseconds with
+ *  EMAC-boundary stamping, better with a hardware clock, still bounded
+ *  by software transmit timestamps taken beside the send call.
+ *
+ *  Packet processing runs on the shared event queue; no memory is
+ *  allocated per packet.
+ *
+ *  @note Synchronization level: Thread safe
+ */
+class PTPClient : private mbed::NonCopyable<PTPClient> {
+public:
+    PTPClient();
+
+    /** Destroy the client, stopping it if it is running.
+     */
+    ~PTPClient();
+
+    /** Start synchronizing to the domain's master.
+     *
+     *  Opens the PTP event and general sockets (ports 319 and 320),
+     *  joins the PTP primary multicast group and begins tracking the
+     *  first master heard in the given domain.
+     *
+     *  @param interface Connected network interface to synchronize over
+     *  @param domain    PTP domain number to participate in
+     *  @retval          NSAPI_ERROR_OK on success
+     *  @retval          NSAPI_ERROR_PARAMETER if interface is NULL
+     *  @retval          NSAPI_ERROR_IS_CONNECTED if already started
+     *  @retval          int Negative error codes from socket open, bind
+     *                   or multicast join
+     */
+    nsapi_error_t start(NetworkInterface *interface, uint8_t domain = 0);
+
+    /** Stop synchronizing and close the sockets.
+     *
+     *  The clock keeps the time and rate it had; it is no longer
+     *  steered.
+     */
+    void stop();
+
+    /** Read the synchronized time.
+     *
+     *  @param seconds     Destination for the seconds since the PTP epoch
+     *  @param nanoseconds Destination for the nanoseconds, 0-999999999
+     */
+    void get_time(uint64_t *seconds, uint32_t *nanoseconds);
+
+    /** Check whether the servo is in lock.
+     *
+     *  @return True once a full Sync/Delay_Req exchange has completed
+     *          and the remaining offset is below the step threshold
+     */
+    bool synchronized() const;
+
+    /** Get the last measured offset from the master, in nanoseconds.
+     */
+    int64_t offset_ns() const;
+
+    /** Get the last measured mean path delay, in nanoseconds.
+     */
+    int64_t mean_path_delay_ns() const;
+
+private:
+    void event_ready();
+    void general_ready();
+    void process();
+    void handle_message(const uint8_t *msg, nsapi_size_t size,
+                        const nsapi_timestamp_t &stamp);
+    void handle_sync(const uint8_t *msg, const nsapi_timestamp_t &stamp);
+    void handle_follow_up(const uint8_t *msg);
+    void handle_delay_resp(const uint8_t *msg);
+    void send_delay_req();
+    void complete_sync(int64_t t1_ns);
+    void servo_update(int64_t offset);
+
+    int64_t local_time_ns();
+    int64_t stamp_to_ns(const nsapi_timestamp_t &stamp);
+    void clock_step(int64_t offset_ns);
+    void clock_rate(int32_t ppb);
+
+    UDPSocket _event_socket;
+    UDPSocket _general_socket;
+    NetworkInterface *_interface;
+    uint8_t _domain;
+    bool _running;
+    int _delay_req_event_id;
+
+    /* Master and exchange state */
+    uint8_t _our_identity[10];      /* our sourcePortIdentity, from the MAC */
+    uint8_t _master_identity[10];   /* sourcePortIdentity of tracked master */
+    bool _have_master;
+    uint16_t _sync_sequence;
+    int64_t _sync_t2;               /* local RX time of pending two-step Sync */
+    bool _sync_pending;
+    uint16_t _delay_sequence;
+    int64_t _delay_t3;              /* local TX time of outstanding Delay_Req */
+    bool _delay_pending;
+    int64_t _master_to_local;       /* last (t2 - t1), for offset computation */
+    bool _have_sync;
+
+    /* Servo state */
+    int64_t _offset;
+    int64_t _path_delay;
+    int64_t _freq_integral;         /* integrated correction, ppb */
+    bool _stepped;
+    bool _locked;
+
+#if !DEVICE_PTP
+    /* Software clock: adjusted = _base + (raw - _anchor) scaled by _ppb */
+    int64_t _base;
+    int64_t _anchor;
+    int32_t _ppb;
+#endif
+
+    mutable rtos::Mutex _lock;
+    uint8_t _rx_buf[128];
+    uint8_t _tx_buf[64];
+};
+
+#endif
+
+/** @}*/
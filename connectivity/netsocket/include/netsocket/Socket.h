@@ -26,6 +26,11 @@
 #include "netsocket/SocketAddress.h"
 #include "Callback.h"
 
+// Only the opaque buffer type is needed here; including
+// NetStackMemoryManager.h would pull the whole socket API back in
+// through nsapi.h
+typedef void net_stack_mem_buf_t;
+
 /** Socket interface.
  *
  * This class defines the Mbed OS Socket API.
@@ -134,6 +139,80 @@ public:
     virtual nsapi_size_or_error_t sendto(const SocketAddress &address,
                                          const void *data, nsapi_size_t size) = 0;
 
+    /** Send a vector of data buffers on a socket.
+     *
+     *  Gathers the given scatter-gather vector into one outgoing packet or
+     *  stream write, so packets assembled from separate buffers (such as a
+     *  protocol header and a payload) do not need to be copied into one
+     *  contiguous buffer before sending.
+     *
+     *  By default, sendv blocks until the data is sent. If socket is set to
+     *  non-blocking or times out, NSAPI_ERROR_WOULD_BLOCK is returned
+     *  immediately. On a stream socket fewer bytes than the vector total
+     *  may be sent; the return value reports how many were.
+     *
+     *  The default implementation returns NSAPI_ERROR_UNSUPPORTED; the
+     *  caller should then fall back to assembling the data and calling
+     *  send().
+     *
+     *  @param iov       Scatter-gather vector of data buffers to send
+     *  @param iov_count Number of elements in the vector
+     *  @return          Number of sent bytes on success, negative subclass-dependent
+     *                   error code on failure
+     */
+    virtual nsapi_size_or_error_t sendv(const nsapi_iovec_t *iov, int iov_count)
+    {
+        return NSAPI_ERROR_UNSUPPORTED;
+    }
+
+    /** Send a vector of data buffers to the specified address.
+     *
+     *  This is the vectored equivalent of sendto(); see sendv() for the
+     *  gathering semantics.
+     *
+     *  @param address   Remote address
+     *  @param iov       Scatter-gather vector of data buffers to send
+     *  @param iov_count Number of elements in the vector
+     *  @return          Number of sent bytes on success, negative subclass-dependent
+     *                   error code on failure
+     */
+    virtual nsapi_size_or_error_t sendtov(const SocketAddress &address,
+                                          const nsapi_iovec_t *iov, int iov_count)
+    {
+        return NSAPI_ERROR_UNSUPPORTED;
+    }
+
+    /** Send data on a stream socket without copying it into the stack.
+     *
+     *  The stack keeps a reference to the caller's buffer instead of
+     *  copying it into its own send buffer, so large sends from flash or
+     *  stable RAM skip the copy entirely. The buffer must stay valid and
+     *  unmodified until sent_callback is invoked, which happens once the
+     *  remote end has acknowledged the accepted bytes and the stack no
+     *  longer references the buffer. The callback may be invoked from the
+     *  stack's own context, so it should not perform long operations.
+     *
+     *  Blocking and partial-send behavior match send(); the callback
+     *  reports on exactly the bytes the call accepted. On a negative
+     *  return no callback was registered and, except for
+     *  NSAPI_ERROR_NO_MEMORY, the stack holds no reference to the buffer.
+     *
+     *  The default implementation returns NSAPI_ERROR_UNSUPPORTED; the
+     *  caller should then fall back to send().
+     *
+     *  @param data          Buffer of data to send, valid until the callback fires
+     *  @param size          Size of the buffer in bytes
+     *  @param sent_callback Callback invoked once the accepted bytes are
+     *                       acknowledged and the buffer is reusable
+     *  @return              Number of sent bytes on success, negative
+     *                       subclass-dependent error code on failure
+     */
+    virtual nsapi_size_or_error_t send_nocopy(const void *data, nsapi_size_t size,
+                                              mbed::Callback<void()> sent_callback)
+    {
+        return NSAPI_ERROR_UNSUPPORTED;
+    }
+
     /** Receive a data from a socket
      *
      *  Receives a data and stores the source address in address if address
@@ -157,6 +236,58 @@ public:
     virtual nsapi_size_or_error_t recvfrom(SocketAddress *address,
                                            void *data, nsapi_size_t size) = 0;
 
+    /** Receive data from a socket without copying
+     *
+     *  Receives a datagram and passes ownership of the stack's memory
+     *  buffer chain holding the payload to the caller, so the data can be
+     *  consumed in place without being copied out of the stack. The caller
+     *  must release the buffer with release_recv_buffer() when done with
+     *  it. Stores the source address in address if address is not NULL.
+     *
+     *  If socket is connected, only packets coming from connected peer address
+     *  are accepted.
+     *
+     *  By default, recvfrom_buffer blocks until a datagram is received. If
+     *  socket is set to non-blocking or times out with no data,
+     *  NSAPI_ERROR_WOULD_BLOCK is returned.
+     *
+     *  The default implementation returns NSAPI_ERROR_UNSUPPORTED; the
+     *  caller should then fall back to the copying recvfrom().
+     *
+     *  @param address  Destination for the source address or NULL
+     *  @param buffer   Destination for the received memory buffer chain
+     *  @return         Number of received bytes on success, negative subclass-dependent
+     *                  error code on failure
+     */
+    virtual nsapi_size_or_error_t recvfrom_buffer(SocketAddress *address,
+                                                  net_stack_mem_buf_t **buffer)
+    {
+        return NSAPI_ERROR_UNSUPPORTED;
+    }
+
+    /** Receive data from a socket without copying
+     *
+     *  This is equivalent to calling recvfrom_buffer(NULL, buffer).
+     *
+     *  @param buffer   Destination for the received memory buffer chain
+     *  @return         Number of received bytes on success, negative subclass-dependent
+     *                  error code on failure
+     */
+    virtual nsapi_size_or_error_t recv_buffer(net_stack_mem_buf_t **buffer)
+    {
+        return recvfrom_buffer(NULL, buffer);
+    }
+
+    /** Release a memory buffer received with recvfrom_buffer
+     *
+     *  Frees the buffer chain back to the stack's memory manager.
+     *
+     *  @param buffer   Memory buffer chain to release
+     */
+    virtual void release_recv_buffer(net_stack_mem_buf_t *buffer)
+    {
+    }
+
     /** Bind a specific address to a socket.
      *
      *  Binding a socket specifies the address and port on which to receive
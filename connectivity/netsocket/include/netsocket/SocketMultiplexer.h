@@ -0,0 +1,140 @@
+/** \addtogroup netsocket */
+/** @{*/
+/* SocketMultiplexer
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SOCKETMULTIPLEXER_H
+#define SOCKETMULTIPLEXER_H
+
+#include "netsocket/Socket.h"
+#include "rtos/Mutex.h"
+#include "rtos/EventFlags.h"
+#include "Callback.h"
+#include "mbed_atomic.h"
+
+/** Maximum number of sockets a SocketMultiplexer can track. */
+#ifndef MBED_CONF_NSAPI_SOCKET_MUX_MAX_SOCKETS
+#define MBED_CONF_NSAPI_SOCKET_MUX_MAX_SOCKETS 16
+#endif
+
+/** Event multiplexer serving many sockets from a single thread.
+ *
+ *  SocketMultiplexer chains the sigio callbacks of registered sockets
+ *  into one shared wait so a single thread can serve many connections
+ *  without polling each socket in turn or dedicating a thread per
+ *  socket. Sockets are registered with an interest mask and every call
+ *  to wait() delivers the batch of sockets that signalled since the
+ *  previous call to one dispatch callback.
+ *
+ *  Readiness is edge triggered: a socket is reported when its sigio
+ *  fires, and the sigio callback does not distinguish event types, so
+ *  the dispatch callback receives the registered interest mask and
+ *  should confirm actual readiness with non-blocking socket calls.
+ *  Sockets must be set non-blocking by the application and must stay
+ *  valid until they are removed or the multiplexer is destroyed.
+ */
+class SocketMultiplexer {
+public:
+    /** Socket event interest flags, can be ORed together. */
+    static const uint8_t EVENT_READ  = 0x1;  /**< Socket may be readable or have accepted a connection. */
+    static const uint8_t EVENT_WRITE = 0x2;  /**< Socket may be writable or have connected. */
+    static const uint8_t EVENT_ALL   = EVENT_READ | EVENT_WRITE;
+
+    SocketMultiplexer() = default;
+
+    /** Destroy the multiplexer.
+     *
+     *  Unregisters any sockets still being tracked.
+     */
+    ~SocketMultiplexer();
+
+    /** Start tracking a socket.
+     *
+     *  Replaces any sigio callback previously registered on the socket.
+     *  The socket is reported as ready on the next wait() so a socket
+     *  that is already readable or writable at registration time is not
+     *  missed.
+     *
+     *  @param socket   Socket to track.
+     *  @param events   Interest mask reported for this socket, see @ref EVENT_READ.
+     *  @retval         NSAPI_ERROR_OK on success.
+     *  @retval         NSAPI_ERROR_PARAMETER if socket is NULL, already
+     *                  registered or events is empty.
+     *  @retval         NSAPI_ERROR_NO_MEMORY if all
+     *                  MBED_CONF_NSAPI_SOCKET_MUX_MAX_SOCKETS slots are in use.
+     */
+    nsapi_error_t add(Socket *socket, uint8_t events = EVENT_ALL);
+
+    /** Change the interest mask of a tracked socket.
+     *
+     *  @param socket   Socket already registered with add().
+     *  @param events   New interest mask.
+     *  @retval         NSAPI_ERROR_OK on success.
+     *  @retval         NSAPI_ERROR_PARAMETER if events is empty.
+     *  @retval         NSAPI_ERROR_NO_SOCKET if the socket is not registered.
+     */
+    nsapi_error_t modify(Socket *socket, uint8_t events);
+
+    /** Stop tracking a socket and detach from its sigio.
+     *
+     *  May be called from the dispatch callback.
+     *
+     *  @param socket   Socket to stop tracking.
+     *  @retval         NSAPI_ERROR_OK on success.
+     *  @retval         NSAPI_ERROR_NO_SOCKET if the socket is not registered.
+     */
+    nsapi_error_t remove(Socket *socket);
+
+    /** Wait for socket events and dispatch the ready set.
+     *
+     *  Calls the handler once for every socket that signalled since the
+     *  previous wait(), then returns. If no socket is pending, blocks
+     *  until one signals or the timeout expires.
+     *
+     *  @param handler  Callback invoked as handler(socket, events) for
+     *                  each ready socket, where events is the interest
+     *                  mask the socket was registered with.
+     *  @param timeout  Maximum time to block in milliseconds.
+     *  @retval         int Number of sockets dispatched on success.
+     *  @retval         NSAPI_ERROR_WOULD_BLOCK if the timeout expired.
+     *  @retval         NSAPI_ERROR_PARAMETER if handler is empty.
+     */
+    nsapi_size_or_error_t wait(mbed::Callback<void(Socket *, uint8_t)> handler,
+                               uint32_t timeout = osWaitForever);
+
+private:
+    struct mux_entry {
+        Socket *socket = nullptr;
+        uint8_t interest = 0;
+        volatile uint8_t pending = 0;
+        SocketMultiplexer *mux = nullptr;
+
+        void event();
+    };
+
+    int find_entry(const Socket *socket) const;
+
+    static const int SIGIO_FLAG = 0x1;
+
+    mux_entry _entries[MBED_CONF_NSAPI_SOCKET_MUX_MAX_SOCKETS];
+    rtos::EventFlags _event_flag;
+    rtos::Mutex _lock;
+};
+
+#endif // SOCKETMULTIPLEXER_H
+
+/** @}*/
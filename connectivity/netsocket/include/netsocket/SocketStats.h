@@ -50,6 +50,9 @@ typedef struct {
     nsapi_protocol_t proto;         /**< Specifies a protocol used with socket */
     size_t sent_bytes;              /**< Data sent through this socket */
     size_t recv_bytes;              /**< Data received through this socket */
+    size_t sent_packets;            /**< Count of successful send operations on this socket */
+    size_t recv_packets;            /**< Count of successful receive operations on this socket */
+    size_t send_queue_peak;         /**< Highest observed count of sent bytes not yet acknowledged by the peer */
     us_timestamp_t last_change_tick;/**< osKernelGetTick() when state last changed */
 } mbed_stats_socket_t;
 
@@ -124,6 +127,7 @@ public:
     void stats_update_proto(const Socket *reference_id, nsapi_protocol_t proto);
 
     /** Update bytes sent on socket, which is cumulative count per socket.
+     *  Also counts one sent packet when bytes were transferred.
      *  API used by socket (TCP or UDP) layers only, not to be used by application.
      *
      *  @param reference_id   ID to identify socket in data array.
@@ -133,6 +137,7 @@ public:
     void stats_update_sent_bytes(const Socket *reference_id, size_t sent_bytes);
 
     /** Update bytes received on socket, which is cumulative count per socket
+     *  Also counts one received packet when bytes were transferred.
      *  API used by socket (TCP or UDP) layers only, not to be used by application.
      *
      *  @param reference_id   ID to identify socket in data array.
@@ -141,6 +146,15 @@ public:
      */
     void stats_update_recv_bytes(const Socket *reference_id, size_t recv_bytes);
 
+    /** Update the send-queue depth of the socket, keeping the high-water mark.
+     *  API used by socket (TCP or UDP) layers only, not to be used by application.
+     *
+     *  @param reference_id   ID to identify socket in data array.
+     *  @param queued Count of sent bytes not yet acknowledged by the peer.
+     *
+     */
+    void stats_update_send_queue(const Socket *reference_id, size_t queued);
+
 #if MBED_CONF_NSAPI_SOCKET_STATS_ENABLED
 private:
     static mbed_stats_socket_t _stats[MBED_CONF_NSAPI_SOCKET_STATS_MAX_COUNT];
@@ -186,6 +200,10 @@ inline void SocketStats::stats_update_sent_bytes(const Socket *, size_t)
 inline void SocketStats::stats_update_recv_bytes(const Socket *, size_t)
 {
 }
+
+inline void SocketStats::stats_update_send_queue(const Socket *, size_t)
+{
+}
 #endif // !MBED_CONF_NSAPI_SOCKET_STATS_ENABLED
 
 #endif
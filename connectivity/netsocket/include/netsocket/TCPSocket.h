@@ -38,6 +38,10 @@ public:
      */
     TCPSocket();
 
+    /** Destroy the socket, cancelling any scheduled pacing wake-up.
+     */
+    ~TCPSocket() override;
+
     /** Override multicast functions to return error for TCP
      *
      */
@@ -82,6 +86,42 @@ public:
      */
     nsapi_size_or_error_t send(const void *data, nsapi_size_t size) override;
 
+    /** Send data over a TCP socket without copying it into the stack
+     *
+     *  The socket must be connected to a remote host. The stack references
+     *  the caller's buffer directly instead of copying it into its send
+     *  buffer, which avoids one copy of every byte for large sends from
+     *  flash or stable RAM. The buffer must stay valid and unmodified
+     *  until sent_callback is invoked; that happens once the remote end
+     *  has acknowledged the accepted bytes, or on close() if the
+     *  connection ends first. The callback may be invoked from the
+     *  stack's own context, so it should not perform long operations.
+     *
+     *  Blocking behavior matches send(): by default the call blocks until
+     *  all data is accepted by the stack, and if the socket is set to
+     *  non-blocking or times out a partial amount can be accepted. The
+     *  callback then reports on exactly the accepted bytes. On a negative
+     *  return no callback was registered and, except for
+     *  NSAPI_ERROR_NO_MEMORY, the stack holds no reference to the buffer;
+     *  after NSAPI_ERROR_NO_MEMORY the buffer must be treated as in use
+     *  until the socket is closed.
+     *
+     *  @param data          Buffer of data to send, valid until the callback fires
+     *  @param size          Size of the buffer in bytes
+     *  @param sent_callback Callback invoked once the accepted bytes are
+     *                       acknowledged and the buffer is reusable
+     *  @retval         int Number of sent bytes on success
+     *  @retval         NSAPI_ERROR_NO_SOCKET in case socket was not created correctly
+     *  @retval         NSAPI_ERROR_WOULD_BLOCK in case non-blocking mode is enabled
+     *                  and send cannot be performed immediately
+     *  @retval         NSAPI_ERROR_UNSUPPORTED if the stack cannot send from
+     *                  caller-owned memory; fall back to send()
+     *  @retval         int Other negative error codes for stack-related failures.
+     *                  See @ref NetworkStack::socket_send_nocopy.
+     */
+    nsapi_size_or_error_t send_nocopy(const void *data, nsapi_size_t size,
+                                      mbed::Callback<void()> sent_callback) override;
+
     /** Receive data over a TCP socket
      *
      *  The socket must be connected to a remote host. Returns the number of
@@ -177,6 +217,30 @@ public:
      */
     nsapi_error_t listen(int backlog = 1) override;
 
+    /** Pace outgoing data to a rate cap
+     *
+     *  Limits how fast send() and send_nocopy() hand data to the network
+     *  stack using a token bucket: at most burst_bytes are admitted at
+     *  once, and the budget refills at rate_bps. Spacing the segments out
+     *  like this keeps the stack from bursting a full congestion window
+     *  into a small link buffer (a cellular modem, typically) at line
+     *  rate, overflowing it and triggering retransmit storms. Set the
+     *  burst to the link buffer size and the rate at or just below the
+     *  uplink rate.
+     *
+     *  In blocking mode, send() waits for the budget to refill between
+     *  bursts. In non-blocking mode it returns NSAPI_ERROR_WOULD_BLOCK
+     *  once the budget is spent, and a wake-up visible through sigio()
+     *  is scheduled on the shared event queue for when the next burst
+     *  can be admitted.
+     *
+     *  @param rate_bps     Rate cap in bits per second, 0 to disable pacing
+     *  @param burst_bytes  Bytes admitted per burst, 0 to select twice a
+     *                      typical TCP segment (2 * 1460)
+     *  @retval             NSAPI_ERROR_OK on success
+     */
+    nsapi_error_t set_pacing(uint32_t rate_bps, uint32_t burst_bytes = 0);
+
 protected:
     nsapi_protocol_t get_proto() override;
 
@@ -186,6 +250,31 @@ private:
      *  To be used within accept() function. Close() will clean this up.
      */
     TCPSocket(TCPSocket *parent, nsapi_socket_t socket, SocketAddress address);
+
+    /** Trampoline from the stack's C-style sent notification to the
+     *  heap-allocated Callback registered by send_nocopy().
+     */
+    static void send_nocopy_notify(void *arg);
+
+    /** Refill the pacing bucket and return how much of wanted may be
+     *  sent now. Must be called with the lock held.
+     */
+    nsapi_size_t pacing_admit(nsapi_size_t wanted);
+
+    /** Milliseconds until the pacing bucket holds a full burst again. */
+    uint32_t pacing_delay_ms() const;
+
+    /** Arm a one-shot event on the shared queue that reports the socket
+     *  writable once the pacing bucket has refilled.
+     */
+    void pacing_schedule_wakeup();
+    void pacing_wakeup();
+
+    uint32_t _pacing_rate_bps = 0;
+    uint32_t _pacing_burst = 0;
+    uint32_t _pacing_tokens = 0;
+    uint64_t _pacing_last_ms = 0;
+    int _pacing_event_id = 0;
 };
 
 
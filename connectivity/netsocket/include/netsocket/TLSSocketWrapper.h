@@ -49,6 +49,78 @@
 #error "CTR or HMAC must be defined for TLSSocketWrapper!"
 #endif
 
+/**
+ * Number of TLS sessions cached in RAM for abbreviated handshakes on
+ * reconnection. Sessions are cached by hostname when a handshake completes
+ * and offered to the server on the next connect, which skips the full
+ * key exchange and certificate verification. Set to 0 (default) to disable
+ * session resumption.
+ */
+#ifndef MBED_CONF_TLS_SOCKET_SESSION_CACHE_SIZE
+#define MBED_CONF_TLS_SOCKET_SESSION_CACHE_SIZE 0
+#endif
+
+/**
+ * Number of verified certificate-chain digests cached in RAM. When set,
+ * certificate verification moves from the handshake to a post-handshake
+ * step that first digests the presented chain (together with the hostname
+ * and the configured CA set) and skips the X.509 signature checks if the
+ * same digest passed full verification recently. Any change to the chain,
+ * hostname or CA set changes the digest and forces full verification.
+ * Only used when TLSSocketWrapper allocated its own TLS configuration;
+ * a configuration supplied via set_ssl_config() keeps its own verification
+ * behaviour. Set to 0 (default) to disable.
+ */
+#ifndef MBED_CONF_TLS_SOCKET_VERIFY_CHAIN_CACHE_SIZE
+#define MBED_CONF_TLS_SOCKET_VERIFY_CHAIN_CACHE_SIZE 0
+#endif
+
+/**
+ * Seconds a cached verified-chain digest stays valid before a full
+ * verification is forced again.
+ */
+#ifndef MBED_CONF_TLS_SOCKET_VERIFY_CHAIN_CACHE_TTL
+#define MBED_CONF_TLS_SOCKET_VERIFY_CHAIN_CACHE_TTL 3600
+#endif
+
+/**
+ * Size in bytes of the optional send coalescing buffer. When set, small
+ * writes over a stream transport are gathered here and sent as one TLS
+ * record instead of one record per write, which saves the per-record
+ * header, IV/MAC bytes and crypto work for small-message workloads.
+ * The buffer is flushed when the next write no longer fits, when the
+ * flush watermark is reached, before reading, on close() and on an
+ * explicit flush(). Set to 0 (default) to send each write as its own
+ * record.
+ */
+#ifndef MBED_CONF_TLS_SOCKET_SEND_BUFFER_SIZE
+#define MBED_CONF_TLS_SOCKET_SEND_BUFFER_SIZE 0
+#endif
+
+#if MBED_CONF_TLS_SOCKET_SEND_BUFFER_SIZE > 0
+/**
+ * Fill level in bytes at which the send coalescing buffer is flushed
+ * automatically. Defaults to the buffer size, i.e. flush only when the
+ * buffer is full; set it lower to bound the latency added by coalescing.
+ */
+#ifndef MBED_CONF_TLS_SOCKET_SEND_FLUSH_WATERMARK
+#define MBED_CONF_TLS_SOCKET_SEND_FLUSH_WATERMARK MBED_CONF_TLS_SOCKET_SEND_BUFFER_SIZE
+#endif
+#endif
+
+/**
+ * Maximum Fragment Length code offered to the server (RFC 6066):
+ * 1 = 512, 2 = 1024, 3 = 2048 and 4 = 4096 bytes. Capping the record
+ * size to the link MTU avoids IP fragmentation on narrow links and
+ * lets both sides size their I/O buffers accordingly. Requires
+ * MBEDTLS_SSL_MAX_FRAGMENT_LENGTH and only applies when
+ * TLSSocketWrapper allocated its own TLS configuration. Set to 0
+ * (default) to keep the protocol default of 16 KiB records.
+ */
+#ifndef MBED_CONF_TLS_SOCKET_MAX_FRAG_LEN
+#define MBED_CONF_TLS_SOCKET_MAX_FRAG_LEN 0
+#endif
+
 /**
  * TLSSocket is a wrapper around Socket for interacting with TLS servers.
  *
@@ -153,6 +225,22 @@ public:
      */
     nsapi_error_t send(const void *data, nsapi_size_t size) override;
 
+#if (MBED_CONF_TLS_SOCKET_SEND_BUFFER_SIZE > 0) || defined(DOXYGEN_ONLY)
+    /** Send any data held in the send coalescing buffer as one TLS record.
+     *
+     *  Called automatically when the buffer reaches the flush watermark,
+     *  when a write no longer fits, before receiving and on close().
+     *  Call it directly after latency-sensitive writes.
+     *
+     *  @retval         NSAPI_ERROR_OK when the buffer was emptied or already empty.
+     *  @retval         NSAPI_ERROR_NO_SOCKET in case socket was not created correctly.
+     *  @retval         NSAPI_ERROR_WOULD_BLOCK in case the record could not be
+     *                  sent immediately; the data stays buffered.
+     *  @retval         NSAPI_ERROR_DEVICE_ERROR in case of tls-related errors.
+     */
+    nsapi_error_t flush();
+#endif
+
     /** Receive data over a TLS socket.
      *
      *  The socket must be connected to a remote host. Returns the number of
@@ -263,8 +351,24 @@ protected:
      */
     nsapi_error_t start_handshake(bool first_call);
 
+    /** Set up the TLS context, DRBG and transport callbacks without
+     *  starting the handshake.
+     *
+     *  Called by start_handshake(); also used by derived classes that
+     *  restore a serialized connection instead of handshaking.
+     *
+     *  @retval       NSAPI_ERROR_OK on success or when already initialized.
+     *  @retval       NSAPI_ERROR_NO_SOCKET in case the transport socket was not created correctly.
+     *  @retval       NSAPI_ERROR_AUTH_FAILURE in case of tls-related setup errors.
+     */
+    virtual nsapi_error_t init_tls_context();
+
     bool is_handshake_started() const;
 
+    /** Mark the handshake as completed or not, e.g. after restoring or
+     *  serializing a connection without an actual handshake. */
+    void set_handshake_completed(bool completed);
+
     void event();
 #endif
 
@@ -304,6 +408,35 @@ private:
      */
     static int ssl_send(void *ctx, const unsigned char *buf, size_t len);
 
+    /**
+     * Write one TLS record, driving the handshake first and waiting on
+     * the socket event when blocking.
+     *
+     * @return Number of bytes written or a translated NSAPI error.
+     */
+    nsapi_size_or_error_t write_record(const unsigned char *data, size_t size);
+
+#if (MBED_CONF_TLS_SOCKET_SESSION_CACHE_SIZE > 0) && defined(MBEDTLS_X509_CRT_PARSE_C) && !defined(MBEDTLS_X509_REMOVE_HOSTNAME_VERIFICATION)
+    /**
+     * Offer a previously cached session for the configured hostname
+     * so the server can abbreviate the handshake.
+     */
+    void restore_session();
+
+    /**
+     * Cache the negotiated session for later resumption.
+     */
+    void store_session();
+#endif
+
+#if (MBED_CONF_TLS_SOCKET_VERIFY_CHAIN_CACHE_SIZE > 0) && defined(MBEDTLS_X509_CRT_PARSE_C) && defined(MBEDTLS_SHA256_C) && !defined(MBEDTLS_X509_REMOVE_HOSTNAME_VERIFICATION)
+    /**
+     * Verify the peer certificate chain, skipping the signature checks
+     * if the same chain passed full verification recently.
+     */
+    nsapi_error_t verify_peer_chain();
+#endif
+
     mbedtls_ssl_context _ssl;
 #ifdef MBEDTLS_X509_CRT_PARSE_C
     mbedtls_pk_context _pkctx;
@@ -324,6 +457,11 @@ private:
 #endif
     mbedtls_ssl_config *_ssl_conf = nullptr;
 
+#if MBED_CONF_TLS_SOCKET_SEND_BUFFER_SIZE > 0
+    uint8_t *_send_buf = nullptr;
+    size_t _send_buf_len = 0;
+#endif
+
     bool _connect_transport: 1;
     bool _close_transport: 1;
     bool _tls_initialized: 1;
@@ -389,6 +389,30 @@ typedef struct nsapi_ip_mreq {
     nsapi_addr_t imr_interface; /* local IP address of interface */
 } nsapi_ip_mreq_t;
 
+/** nsapi_iovec structure
+ *
+ *  Describes one element of a scatter-gather vector for vectored
+ *  socket sends.
+ */
+typedef struct nsapi_iovec {
+    const void *iov_base;   /* Pointer to the data */
+    nsapi_size_t iov_len;   /* Length of the data in bytes */
+} nsapi_iovec_t;
+
+/** nsapi_timestamp structure
+ *
+ *  Receive timestamp of a packet, captured as close to the link input
+ *  as the stack and driver allow. The epoch is that of the stamping
+ *  clock - boot time by default, the PTP clock where a driver provides
+ *  one - so timestamps are meaningful relative to each other and to
+ *  that clock, not as wall time.
+ */
+typedef struct nsapi_timestamp {
+    uint32_t sec;       /* Seconds component of the timestamp */
+    uint32_t nsec;      /* Nanoseconds component, 0-999999999 */
+    uint8_t valid;      /* Non-zero if a timestamp was captured */
+} nsapi_timestamp_t;
+
 /** nsapi_latency_req structure
  */
 typedef struct nsapi_latency_req {
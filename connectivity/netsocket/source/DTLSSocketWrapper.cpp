@@ -20,9 +20,20 @@
 #include "drivers/Timer.h"
 #include "events/mbed_events.h"
 #include "rtos/Kernel.h"
+#include <string.h>
+
+#define TRACE_GROUP "DTLS"
+#include "mbed-trace/mbed_trace.h"
 
 #if defined(MBEDTLS_SSL_CLI_C)
 
+#if MBED_CONF_DTLS_SOCKET_CONTEXT_PERSISTENCE == 1
+#include "kvstore_global_api.h"
+#include "kv_config.h"
+#include "mbedtls/platform_util.h"
+#include <stdio.h>
+#endif
+
 DTLSSocketWrapper::DTLSSocketWrapper(Socket *transport, const char *hostname, control_transport control) :
     TLSSocketWrapper(transport, hostname, control)
 {
@@ -80,4 +91,138 @@ void DTLSSocketWrapper::timer_event(void)
     event();
 }
 
+#if defined(MBEDTLS_SSL_DTLS_CONNECTION_ID)
+
+nsapi_error_t DTLSSocketWrapper::set_connection_id(const uint8_t *own_cid, size_t own_cid_len)
+{
+    if (own_cid_len > MBEDTLS_SSL_CID_IN_LEN_MAX || (own_cid_len != 0 && own_cid == NULL)) {
+        return NSAPI_ERROR_PARAMETER;
+    }
+    if (is_handshake_started()) {
+        return NSAPI_ERROR_IN_PROGRESS;
+    }
+
+    if (mbedtls_ssl_conf_cid(get_ssl_config(), own_cid_len,
+                             MBEDTLS_SSL_UNEXPECTED_CID_IGNORE) != 0) {
+        return NSAPI_ERROR_PARAMETER;
+    }
+
+    if (own_cid_len != 0) {
+        memcpy(_own_cid, own_cid, own_cid_len);
+    }
+    _own_cid_len = own_cid_len;
+    _cid_requested = true;
+    return NSAPI_ERROR_OK;
+}
+
+nsapi_error_t DTLSSocketWrapper::init_tls_context()
+{
+    nsapi_error_t ret = TLSSocketWrapper::init_tls_context();
+    if (ret != NSAPI_ERROR_OK) {
+        return ret;
+    }
+
+    // mbedtls_ssl_set_cid() needs a set-up context, so the CID requested
+    // via set_connection_id() is applied here, just before the handshake.
+    if (_cid_requested &&
+            mbedtls_ssl_set_cid(get_ssl_context(), MBEDTLS_SSL_CID_ENABLED,
+                                _own_cid_len ? _own_cid : NULL, _own_cid_len) != 0) {
+        return NSAPI_ERROR_PARAMETER;
+    }
+    return NSAPI_ERROR_OK;
+}
+
+#endif /* MBEDTLS_SSL_DTLS_CONNECTION_ID */
+
+#if MBED_CONF_DTLS_SOCKET_CONTEXT_PERSISTENCE == 1
+
+nsapi_error_t DTLSSocketWrapper::store_context(const char *key)
+{
+    char kv_key[KV_MAX_KEY_LENGTH];
+    int len = snprintf(kv_key, sizeof(kv_key), MBED_CONF_DTLS_SOCKET_CONTEXT_KV_PREFIX "%s", key);
+    if (len <= 0 || len >= (int) sizeof(kv_key)) {
+        return NSAPI_ERROR_PARAMETER;
+    }
+
+    size_t context_len = 0;
+    int ret = mbedtls_ssl_context_save(get_ssl_context(), nullptr, 0, &context_len);
+    if (ret != MBEDTLS_ERR_SSL_BUFFER_TOO_SMALL) {
+        // No established connection in a serializable state
+        return NSAPI_ERROR_NO_CONNECTION;
+    }
+
+    unsigned char *context = new (std::nothrow) unsigned char[context_len];
+    if (!context) {
+        return NSAPI_ERROR_NO_MEMORY;
+    }
+
+    ret = mbedtls_ssl_context_save(get_ssl_context(), context, context_len, &context_len);
+    if (ret != 0) {
+        delete[] context;
+        return NSAPI_ERROR_DEVICE_ERROR;
+    }
+    // A successful save resets the TLS context, the connection now lives
+    // only in the serialized blob.
+    set_handshake_completed(false);
+
+    ret = kv_set(kv_key, context, context_len, 0);
+    mbedtls_platform_zeroize(context, context_len);
+    delete[] context;
+
+    if (ret != MBED_SUCCESS) {
+        tr_error("Storing DTLS context failed (%d)", ret);
+        return NSAPI_ERROR_DEVICE_ERROR;
+    }
+    tr_info("DTLS context stored (%d bytes)", (int) context_len);
+    return NSAPI_ERROR_OK;
+}
+
+nsapi_error_t DTLSSocketWrapper::restore_context(const char *key)
+{
+    char kv_key[KV_MAX_KEY_LENGTH];
+    int len = snprintf(kv_key, sizeof(kv_key), MBED_CONF_DTLS_SOCKET_CONTEXT_KV_PREFIX "%s", key);
+    if (len <= 0 || len >= (int) sizeof(kv_key)) {
+        return NSAPI_ERROR_PARAMETER;
+    }
+
+    kv_info_t info;
+    if (kv_get_info(kv_key, &info) != MBED_SUCCESS) {
+        return NSAPI_ERROR_NO_DATA;
+    }
+
+    nsapi_error_t err = init_tls_context();
+    if (err != NSAPI_ERROR_OK) {
+        return err;
+    }
+
+    unsigned char *context = new (std::nothrow) unsigned char[info.size];
+    if (!context) {
+        return NSAPI_ERROR_NO_MEMORY;
+    }
+
+    size_t actual_size = 0;
+    int ret = -1;
+    if (kv_get(kv_key, context, info.size, &actual_size) == MBED_SUCCESS) {
+        ret = mbedtls_ssl_context_load(get_ssl_context(), context, actual_size);
+    }
+    mbedtls_platform_zeroize(context, actual_size);
+    delete[] context;
+
+    // Serialized connection data must only ever be loaded once: record
+    // sequence numbers are part of it and reusing them would repeat AEAD
+    // nonces. Remove the stored copy whether or not the load succeeded.
+    kv_remove(kv_key);
+
+    if (ret != 0) {
+        tr_error("Restoring DTLS context failed (-0x%04x)", -ret);
+        return NSAPI_ERROR_DEVICE_ERROR;
+    }
+
+    set_handshake_completed(true);
+    tr_info("DTLS context restored");
+    return NSAPI_ERROR_OK;
+}
+
+#endif /* MBED_CONF_DTLS_SOCKET_CONTEXT_PERSISTENCE */
+
 #endif /* MBEDTLS_SSL_CLI_C */
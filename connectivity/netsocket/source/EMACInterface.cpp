@@ -18,10 +18,35 @@
 #include "netsocket/EMACInterface.h"
 #include "mbed-trace/mbed_trace.h"
 
+#if MBED_CONF_NSAPI_EMAC_WARM_START
+#include "kvstore_global_api.h"
+#include "kv_config.h"
+#include <stdio.h>
+#include <string.h>
+#endif
+
 using namespace mbed;
 
 #define TRACE_GROUP "EMACi"
 
+#if MBED_CONF_NSAPI_EMAC_WARM_START
+
+/** KVStore key prefix the cached lease is stored under; the interface name
+ *  is appended so multiple interfaces keep separate leases. */
+#ifndef MBED_CONF_NSAPI_EMAC_WARM_START_KV_PREFIX
+#define MBED_CONF_NSAPI_EMAC_WARM_START_KV_PREFIX "/kv/netlease_"
+#endif
+
+namespace {
+struct emac_warm_lease {
+    char ip[NSAPI_IPv6_SIZE];
+    char netmask[NSAPI_IPv4_SIZE];
+    char gateway[NSAPI_IPv4_SIZE];
+};
+}
+
+#endif // MBED_CONF_NSAPI_EMAC_WARM_START
+
 /* Interface implementation */
 EMACInterface::EMACInterface(EMAC &emac, OnboardNetworkStack &stack) :
     _emac(emac),
@@ -69,9 +94,39 @@ nsapi_error_t EMACInterface::connect()
             _interface = NULL;
             return err;
         }
+#if MBED_CONF_NSAPI_EMAC_WARM_START
+        _interface->attach(mbed::callback(this, &EMACInterface::warm_start_status));
+#else
         _interface->attach(_connection_status_cb);
+#endif
     }
 
+#if MBED_CONF_NSAPI_EMAC_WARM_START
+    if (_dhcp && _warm_start) {
+        char cached_ip[NSAPI_IPv6_SIZE];
+        char cached_netmask[NSAPI_IPv4_SIZE];
+        char cached_gateway[NSAPI_IPv4_SIZE];
+        if (load_cached_lease(cached_ip, cached_netmask, cached_gateway)) {
+            // Seed the stack with the cached lease so traffic can start
+            // immediately; the DHCP exchange revalidates it in the
+            // background and replaces the address if the server disagrees
+            tr_info("Warm start with cached lease %s", cached_ip);
+            _warm_started = true;
+            nsapi_error_t ret = _interface->bringup(true,
+                                                    cached_ip,
+                                                    cached_netmask[0] ? cached_netmask : 0,
+                                                    cached_gateway[0] ? cached_gateway : 0,
+                                                    DEFAULT_STACK,
+                                                    _blocking);
+            if (ret == NSAPI_ERROR_OK) {
+                return ret;
+            }
+            // Fall back to a cold bringup if the seeded one failed
+            _warm_started = false;
+        }
+    }
+#endif
+
     return _interface->bringup(_dhcp,
                                _ip_address[0] ? _ip_address : 0,
                                _netmask[0] ? _netmask : 0,
@@ -83,6 +138,9 @@ nsapi_error_t EMACInterface::connect()
 nsapi_error_t EMACInterface::disconnect()
 {
     if (_interface) {
+#if MBED_CONF_NSAPI_EMAC_WARM_START
+        _warm_started = false;
+#endif
         return _interface->bringdown();
     }
     return NSAPI_ERROR_NO_CONNECTION;
@@ -178,7 +236,11 @@ void EMACInterface::attach(
 {
     _connection_status_cb = status_cb;
     if (_interface) {
+#if MBED_CONF_NSAPI_EMAC_WARM_START
+        _interface->attach(mbed::callback(this, &EMACInterface::warm_start_status));
+#else
         _interface->attach(status_cb);
+#endif
     }
 }
 
@@ -196,3 +258,101 @@ nsapi_error_t EMACInterface::set_blocking(bool blocking)
     _blocking = blocking;
     return NSAPI_ERROR_OK;
 }
+
+#if MBED_CONF_NSAPI_EMAC_WARM_START
+
+nsapi_error_t EMACInterface::set_warm_start(bool warm_start)
+{
+    _warm_start = warm_start;
+    return NSAPI_ERROR_OK;
+}
+
+bool EMACInterface::is_warm_start_active() const
+{
+    return _warm_started;
+}
+
+void EMACInterface::warm_start_status(nsapi_event_t event, intptr_t status)
+{
+    if (_warm_start && _dhcp
+            && event == NSAPI_EVENT_CONNECTION_STATUS_CHANGE
+            && status == NSAPI_STATUS_GLOBAL_UP) {
+        store_lease();
+    }
+    if (_connection_status_cb) {
+        _connection_status_cb(event, status);
+    }
+}
+
+bool EMACInterface::warm_start_lease_key(char *key, size_t size)
+{
+    char name[NSAPI_INTERFACE_NAME_MAX_SIZE];
+    if (!_interface || !_interface->get_interface_name(name)) {
+        return false;
+    }
+    int len = snprintf(key, size, "%s%s", MBED_CONF_NSAPI_EMAC_WARM_START_KV_PREFIX, name);
+    return len > 0 && len < (int)size;
+}
+
+bool EMACInterface::load_cached_lease(char *ip, char *netmask, char *gateway)
+{
+    char key[KV_MAX_KEY_LENGTH];
+    if (!warm_start_lease_key(key, sizeof(key))) {
+        return false;
+    }
+
+    struct emac_warm_lease lease;
+    size_t actual = 0;
+    if (kv_get(key, &lease, sizeof(lease), &actual) != MBED_SUCCESS || actual != sizeof(lease)) {
+        return false;
+    }
+
+    lease.ip[sizeof(lease.ip) - 1] = '\0';
+    lease.netmask[sizeof(lease.netmask) - 1] = '\0';
+    lease.gateway[sizeof(lease.gateway) - 1] = '\0';
+    if (!lease.ip[0]) {
+        return false;
+    }
+
+    strcpy(ip, lease.ip);
+    strcpy(netmask, lease.netmask);
+    strcpy(gateway, lease.gateway);
+    return true;
+}
+
+void EMACInterface::store_lease()
+{
+    char key[KV_MAX_KEY_LENGTH];
+    if (!warm_start_lease_key(key, sizeof(key))) {
+        return;
+    }
+
+    SocketAddress address;
+    struct emac_warm_lease lease = {};
+    if (_interface->get_ip_address(&address) != NSAPI_ERROR_OK || !address.get_ip_address()) {
+        return;
+    }
+    strncpy(lease.ip, address.get_ip_address(), sizeof(lease.ip) - 1);
+    if (_interface->get_netmask(&address) == NSAPI_ERROR_OK && address.get_ip_address()) {
+        strncpy(lease.netmask, address.get_ip_address(), sizeof(lease.netmask) - 1);
+    }
+    if (_interface->get_gateway(&address) == NSAPI_ERROR_OK && address.get_ip_address()) {
+        strncpy(lease.gateway, address.get_ip_address(), sizeof(lease.gateway) - 1);
+    }
+
+    // Skip the write when the stored lease already matches, to save flash
+    // wear on the common reboot-into-same-lease path
+    struct emac_warm_lease stored;
+    size_t actual = 0;
+    if (kv_get(key, &stored, sizeof(stored), &actual) == MBED_SUCCESS
+            && actual == sizeof(stored)
+            && memcmp(&stored, &lease, sizeof(lease)) == 0) {
+        return;
+    }
+
+    if (kv_set(key, &lease, sizeof(lease), 0) == MBED_SUCCESS) {
+        tr_info("Cached DHCP lease %s", lease.ip);
+    }
+}
+
+#endif // MBED_CONF_NSAPI_EMAC_WARM_START
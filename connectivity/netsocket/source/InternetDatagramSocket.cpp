@@ -18,6 +18,38 @@
 #include "netsocket/InternetDatagramSocket.h"
 #include "Timer.h"
 #include "mbed_assert.h"
+#if DEVICE_USTICKER
+#include "hal/ticker_api.h"
+#include "hal/us_ticker_api.h"
+#endif
+
+void InternetDatagramSocket::set_busy_poll(uint32_t spin_us)
+{
+    _busy_poll_us = spin_us;
+}
+
+nsapi_size_or_error_t InternetDatagramSocket::busy_poll_recvfrom(SocketAddress *address,
+                                                                 void *data, nsapi_size_t size,
+                                                                 nsapi_timestamp_t *timestamp)
+{
+    nsapi_size_or_error_t recv = NSAPI_ERROR_WOULD_BLOCK;
+#if DEVICE_USTICKER
+    /* Poll the stack directly instead of parking on the event flags:
+       no wakeup chain, no scheduling jitter, one busy core. Called with
+       the socket lock held. */
+    const ticker_data_t *ticker = get_us_ticker_data();
+    us_timestamp_t deadline = ticker_read_us(ticker) + _busy_poll_us;
+    do {
+        if (timestamp) {
+            recv = _stack->socket_recvfrom_timestamp(_socket, address, data, size, timestamp);
+        } else {
+            recv = _stack->socket_recvfrom(_socket, address, data, size);
+        }
+    } while (NSAPI_ERROR_WOULD_BLOCK == recv && _socket &&
+             ticker_read_us(ticker) < deadline);
+#endif
+    return recv;
+}
 
 nsapi_error_t InternetDatagramSocket::connect(const SocketAddress &address)
 {
@@ -82,6 +114,14 @@ nsapi_size_or_error_t InternetDatagramSocket::send(const void *data, nsapi_size_
     return sendto(_remote_peer, data, size);
 }
 
+nsapi_size_or_error_t InternetDatagramSocket::sendv(const nsapi_iovec_t *iov, int iov_count)
+{
+    if (!_remote_peer) {
+        return NSAPI_ERROR_NO_ADDRESS;
+    }
+    return sendtov(_remote_peer, iov, iov_count);
+}
+
 nsapi_size_or_error_t InternetDatagramSocket::recvfrom(SocketAddress *address, void *buffer, nsapi_size_t size)
 {
     _lock.lock();
@@ -105,6 +145,9 @@ nsapi_size_or_error_t InternetDatagramSocket::recvfrom(SocketAddress *address, v
 
         core_util_atomic_flag_clear(&_pending);
         nsapi_size_or_error_t recv = _stack->socket_recvfrom(_socket, address, buffer, size);
+        if (NSAPI_ERROR_WOULD_BLOCK == recv && _busy_poll_us) {
+            recv = busy_poll_recvfrom(address, buffer, size, NULL);
+        }
 
         // Filter incomming packets using connected peer address
         if (recv >= 0 && _remote_peer && _remote_peer != *address) {
@@ -148,6 +191,132 @@ nsapi_size_or_error_t InternetDatagramSocket::recv(void *buffer, nsapi_size_t si
     return recvfrom(NULL, buffer, size);
 }
 
+nsapi_size_or_error_t InternetDatagramSocket::recvfrom_timestamp(SocketAddress *address, void *buffer, nsapi_size_t size, nsapi_timestamp_t *timestamp)
+{
+    _lock.lock();
+    nsapi_size_or_error_t ret;
+    SocketAddress ignored;
+
+    if (!address) {
+        address = &ignored;
+    }
+
+    _readers++;
+
+    if (_socket) {
+        _socket_stats.stats_update_socket_state(this, SOCK_OPEN);
+    }
+    while (true) {
+        if (!_socket) {
+            ret = NSAPI_ERROR_NO_SOCKET;
+            break;
+        }
+
+        core_util_atomic_flag_clear(&_pending);
+        nsapi_size_or_error_t recv = _stack->socket_recvfrom_timestamp(_socket, address, buffer, size, timestamp);
+        if (NSAPI_ERROR_WOULD_BLOCK == recv && _busy_poll_us) {
+            recv = busy_poll_recvfrom(address, buffer, size, timestamp);
+        }
+
+        // Filter incomming packets using connected peer address
+        if (recv >= 0 && _remote_peer && _remote_peer != *address) {
+            continue;
+        }
+
+        _socket_stats.stats_update_peer(this, _remote_peer);
+        // Non-blocking sockets always return. Blocking only returns when success or errors other than WOULD_BLOCK
+        if ((0 == _timeout) || (NSAPI_ERROR_WOULD_BLOCK != recv)) {
+            ret = recv;
+            _socket_stats.stats_update_recv_bytes(this, recv);
+            break;
+        } else {
+            uint32_t flag;
+
+            // Release lock before blocking so other threads
+            // accessing this object aren't blocked
+            _lock.unlock();
+            flag = _event_flag.wait_any(READ_FLAG, _timeout);
+            _lock.lock();
+
+            if (flag & osFlagsError) {
+                // Timeout break
+                ret = NSAPI_ERROR_WOULD_BLOCK;
+                break;
+            }
+        }
+    }
+
+    _readers--;
+    if (!_socket || !_readers) {
+        _event_flag.set(FINISHED_FLAG);
+    }
+
+    _lock.unlock();
+    return ret;
+}
+
+nsapi_size_or_error_t InternetDatagramSocket::recvfrom_buffer(SocketAddress *address, net_stack_mem_buf_t **buffer)
+{
+    _lock.lock();
+    nsapi_size_or_error_t ret;
+    SocketAddress ignored;
+
+    if (!address) {
+        address = &ignored;
+    }
+
+    _readers++;
+
+    if (_socket) {
+        _socket_stats.stats_update_socket_state(this, SOCK_OPEN);
+    }
+    while (true) {
+        if (!_socket) {
+            ret = NSAPI_ERROR_NO_SOCKET;
+            break;
+        }
+
+        core_util_atomic_flag_clear(&_pending);
+        nsapi_size_or_error_t recv = _stack->socket_recvfrom_buffer(_socket, address, buffer);
+
+        // Filter incomming packets using connected peer address
+        if (recv >= 0 && _remote_peer && _remote_peer != *address) {
+            release_recv_buffer(*buffer);
+            continue;
+        }
+
+        _socket_stats.stats_update_peer(this, _remote_peer);
+        // Non-blocking sockets always return. Blocking only returns when success or errors other than WOULD_BLOCK
+        if ((0 == _timeout) || (NSAPI_ERROR_WOULD_BLOCK != recv)) {
+            ret = recv;
+            _socket_stats.stats_update_recv_bytes(this, recv);
+            break;
+        } else {
+            uint32_t flag;
+
+            // Release lock before blocking so other threads
+            // accessing this object aren't blocked
+            _lock.unlock();
+            flag = _event_flag.wait_any(READ_FLAG, _timeout);
+            _lock.lock();
+
+            if (flag & osFlagsError) {
+                // Timeout break
+                ret = NSAPI_ERROR_WOULD_BLOCK;
+                break;
+            }
+        }
+    }
+
+    _readers--;
+    if (!_socket || !_readers) {
+        _event_flag.set(FINISHED_FLAG);
+    }
+
+    _lock.unlock();
+    return ret;
+}
+
 Socket *InternetDatagramSocket::accept(nsapi_error_t *error)
 {
     if (error) {
@@ -16,9 +16,13 @@
  */
 
 #include "netsocket/InternetSocket.h"
+#include "netsocket/NetStackMemoryManager.h"
 #include "platform/mbed_critical.h"
 #include "platform/Callback.h"
 
+#include <new>
+#include <string.h>
+
 using namespace mbed;
 
 InternetSocket::InternetSocket()
@@ -29,6 +33,7 @@ InternetSocket::InternetSocket()
 InternetSocket::~InternetSocket()
 {
     close();
+    delete[] _send_header;
 }
 
 nsapi_error_t InternetSocket::open(NetworkStack *stack)
@@ -265,3 +270,122 @@ nsapi_error_t InternetSocket::getpeername(SocketAddress *address)
     *address = _remote_peer;
     return NSAPI_ERROR_OK;
 }
+
+nsapi_size_or_error_t InternetSocket::sendv(const nsapi_iovec_t *iov, int iov_count)
+{
+    return sendv_internal(NULL, iov, iov_count);
+}
+
+nsapi_size_or_error_t InternetSocket::sendtov(const SocketAddress &address,
+                                              const nsapi_iovec_t *iov, int iov_count)
+{
+    return sendv_internal(&address, iov, iov_count);
+}
+
+nsapi_size_or_error_t InternetSocket::sendv_internal(const SocketAddress *address,
+                                                     const nsapi_iovec_t *iov, int iov_count)
+{
+    if (!iov || iov_count <= 0) {
+        return NSAPI_ERROR_PARAMETER;
+    }
+
+    _lock.lock();
+    nsapi_size_or_error_t ret;
+
+    // Prepend the header template to the caller's vector when one is set
+    nsapi_iovec_t *vec = NULL;
+    if (_send_header_size) {
+        vec = new (std::nothrow) nsapi_iovec_t[iov_count + 1];
+        if (!vec) {
+            _lock.unlock();
+            return NSAPI_ERROR_NO_MEMORY;
+        }
+        vec[0].iov_base = _send_header;
+        vec[0].iov_len = _send_header_size;
+        memcpy(&vec[1], iov, iov_count * sizeof(nsapi_iovec_t));
+        iov = vec;
+        iov_count++;
+    }
+
+    _writers++;
+    if (_socket && address) {
+        _socket_stats.stats_update_socket_state(this, SOCK_OPEN);
+        _socket_stats.stats_update_peer(this, *address);
+    }
+    while (true) {
+        if (!_socket) {
+            ret = NSAPI_ERROR_NO_SOCKET;
+            break;
+        }
+
+        core_util_atomic_flag_clear(&_pending);
+        nsapi_size_or_error_t sent;
+        if (address) {
+            sent = _stack->socket_sendtov(_socket, *address, iov, iov_count);
+        } else {
+            sent = _stack->socket_sendv(_socket, iov, iov_count);
+        }
+        if ((0 == _timeout) || (NSAPI_ERROR_WOULD_BLOCK != sent)) {
+            _socket_stats.stats_update_sent_bytes(this, sent);
+            ret = sent;
+            break;
+        } else {
+            uint32_t flag;
+
+            // Release lock before blocking so other threads
+            // accessing this object aren't blocked
+            _lock.unlock();
+            flag = _event_flag.wait_any(WRITE_FLAG, _timeout);
+            _lock.lock();
+
+            if (flag & osFlagsError) {
+                // Timeout break
+                ret = NSAPI_ERROR_WOULD_BLOCK;
+                break;
+            }
+        }
+    }
+
+    _writers--;
+    if (!_socket || !_writers) {
+        _event_flag.set(FINISHED_FLAG);
+    }
+    delete[] vec;
+    _lock.unlock();
+    return ret;
+}
+
+nsapi_error_t InternetSocket::set_send_header(const void *header, nsapi_size_t size)
+{
+    _lock.lock();
+
+    uint8_t *header_copy = NULL;
+    if (header && size) {
+        header_copy = new (std::nothrow) uint8_t[size];
+        if (!header_copy) {
+            _lock.unlock();
+            return NSAPI_ERROR_NO_MEMORY;
+        }
+        memcpy(header_copy, header, size);
+    } else {
+        size = 0;
+    }
+
+    delete[] _send_header;
+    _send_header = header_copy;
+    _send_header_size = size;
+
+    _lock.unlock();
+    return NSAPI_ERROR_OK;
+}
+
+void InternetSocket::release_recv_buffer(net_stack_mem_buf_t *buffer)
+{
+    if (!buffer || !_stack) {
+        return;
+    }
+    NetStackMemoryManager *mem_mngr = _stack->get_memory_manager();
+    if (mem_mngr) {
+        mem_mngr->free(buffer);
+    }
+}
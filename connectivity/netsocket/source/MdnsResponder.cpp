@@ -0,0 +1,662 @@
+/*
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "netsocket/MdnsResponder.h"
+#include "events/EventQueue.h"
+#include "events/mbed_shared_queues.h"
+#include "platform/Callback.h"
+#include "platform/mbed_toolchain.h"
+#include <string.h>
+#include <ctype.h>
+
+using namespace std::chrono;
+
+#define MDNS_PORT 5353
+
+#define RR_TYPE_A 1
+#define RR_TYPE_PTR 12
+#define RR_TYPE_TXT 16
+#define RR_TYPE_SRV 33
+#define RR_TYPE_ANY 255
+
+#define CLASS_IN 0x0001
+/* Unique records carry the cache-flush bit, except in legacy unicast
+ * responses where a plain DNS client would reject the class. */
+#define CLASS_IN_FLUSH 0x8001
+
+#define DNS_HEADER_SIZE 12
+#define FLAGS_RESPONSE_AA 0x8400
+#define COMPRESSION_PTR 0xC000
+
+/* Label of each response mask bit must fit the service table. */
+MBED_STATIC_ASSERT(MBED_CONF_NSAPI_MDNS_MAX_SERVICES <= 32,
+                   "nsapi.mdns-max-services must be at most 32");
+
+/* Meta-query name for enumerating advertised service types (RFC 6763
+ * section 9), without the ".local" suffix which write_name() adds. */
+static const char *const mdns_enum_name = "_services._dns-sd._udp";
+
+/* Bounded in-place packet writer. Records are composed directly in the
+ * transmit buffer; a write past the end sets overflow instead of
+ * touching memory, and the caller rolls the length back to the last
+ * record boundary. */
+struct mdns_writer_t {
+    uint8_t *buf;
+    uint16_t len;
+    uint16_t cap;
+    bool overflow;
+};
+
+static void write_u8(mdns_writer_t *w, uint8_t value)
+{
+    if (w->len >= w->cap) {
+        w->overflow = true;
+        return;
+    }
+    w->buf[w->len++] = value;
+}
+
+static void write_u16(mdns_writer_t *w, uint16_t value)
+{
+    write_u8(w, value >> 8);
+    write_u8(w, value & 0xff);
+}
+
+static void write_u32(mdns_writer_t *w, uint32_t value)
+{
+    write_u16(w, value >> 16);
+    write_u16(w, value & 0xffff);
+}
+
+static void write_bytes(mdns_writer_t *w, const void *data, size_t size)
+{
+    if (size > (size_t)(w->cap - w->len)) {
+        w->overflow = true;
+        return;
+    }
+    memcpy(w->buf + w->len, data, size);
+    w->len += size;
+}
+
+static void patch_u16(mdns_writer_t *w, uint16_t pos, uint16_t value)
+{
+    if (pos + 1 < w->len) {
+        w->buf[pos] = value >> 8;
+        w->buf[pos + 1] = value & 0xff;
+    }
+}
+
+static void write_label(mdns_writer_t *w, const char *label, size_t len)
+{
+    if (len == 0 || len > 63) {
+        w->overflow = true;
+        return;
+    }
+    write_u8(w, len);
+    write_bytes(w, label, len);
+}
+
+/* Write "<instance>.<dotted>.local" (instance optional), compressing
+ * against earlier occurrences in the same packet. name_off caches the
+ * offset of the whole name, suffix_off the offset of the
+ * "<dotted>.local" tail; either may be NULL. */
+static void write_name(mdns_writer_t *w, const char *instance,
+                       const char *dotted, uint16_t *name_off,
+                       uint16_t *suffix_off)
+{
+    if (name_off != NULL && *name_off != 0) {
+        write_u16(w, COMPRESSION_PTR | *name_off);
+        return;
+    }
+    if (name_off != NULL && w->len < COMPRESSION_PTR) {
+        *name_off = w->len;
+    }
+    if (instance != NULL) {
+        write_label(w, instance, strlen(instance));
+    }
+    if (suffix_off != NULL && *suffix_off != 0) {
+        write_u16(w, COMPRESSION_PTR | *suffix_off);
+        return;
+    }
+    if (suffix_off != NULL && w->len < COMPRESSION_PTR) {
+        *suffix_off = w->len;
+    }
+    for (const char *part = dotted; part != NULL && *part != '\0';) {
+        const char *dot = strchr(part, '.');
+        size_t len = (dot != NULL) ? (size_t)(dot - part) : strlen(part);
+        write_label(w, part, len);
+        part += len + (dot != NULL ? 1 : 0);
+    }
+    write_label(w, "local", 5);
+    write_u8(w, 0);
+}
+
+static uint16_t read_u16(const uint8_t *pkt, int off)
+{
+    return ((uint16_t)pkt[off] << 8) | pkt[off + 1];
+}
+
+static uint32_t read_u32(const uint8_t *pkt, int off)
+{
+    return ((uint32_t)read_u16(pkt, off) << 16) | read_u16(pkt, off + 2);
+}
+
+/* Return the offset just past the name starting at off, or -1 if the
+ * packet is malformed. Compression pointers end the name. */
+static int skip_name(const uint8_t *pkt, nsapi_size_t size, int off)
+{
+    while ((nsapi_size_t)off < size) {
+        uint8_t len = pkt[off];
+        if ((len & 0xC0) == 0xC0) {
+            return ((nsapi_size_t)(off + 2) <= size) ? off + 2 : -1;
+        }
+        if (len > 63) {
+            return -1;
+        }
+        off += 1 + len;
+        if (len == 0) {
+            return ((nsapi_size_t)off <= size) ? off : -1;
+        }
+    }
+    return -1;
+}
+
+/* Iterator over the labels of an expected "<instance>.<dotted>.local"
+ * name, so packet names can be compared without composing ours. */
+struct expected_name_t {
+    const char *instance;
+    const char *dotted;
+    int phase;
+};
+
+static bool next_expected_label(expected_name_t *e, const char **label,
+                                size_t *len)
+{
+    if (e->phase == 0) {
+        e->phase = 1;
+        if (e->instance != NULL) {
+            *label = e->instance;
+            *len = strlen(e->instance);
+            return true;
+        }
+    }
+    if (e->phase == 1) {
+        if (e->dotted != NULL && *e->dotted != '\0') {
+            const char *dot = strchr(e->dotted, '.');
+            *label = e->dotted;
+            *len = (dot != NULL) ? (size_t)(dot - e->dotted) : strlen(e->dotted);
+            e->dotted += *len + (dot != NULL ? 1 : 0);
+            return true;
+        }
+        e->phase = 2;
+    }
+    if (e->phase == 2) {
+        e->phase = 3;
+        *label = "local";
+        *len = 5;
+        return true;
+    }
+    return false;
+}
+
+static bool labels_equal(const uint8_t *a, const char *b, size_t len)
+{
+    for (size_t i = 0; i < len; i++) {
+        if (tolower(a[i]) != tolower((unsigned char)b[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Case-insensitively compare the (possibly compressed) name at off
+ * against "<instance>.<dotted>.local"; instance may be NULL. */
+static bool name_matches(const uint8_t *pkt, nsapi_size_t size, int off,
+                         const char *instance, const char *dotted)
+{
+    expected_name_t expected = { instance, dotted, 0 };
+    int jumps = 0;
+
+    while ((nsapi_size_t)off < size) {
+        uint8_t len = pkt[off];
+        if ((len & 0xC0) == 0xC0) {
+            if ((nsapi_size_t)(off + 2) > size || ++jumps > 8) {
+                return false;
+            }
+            off = read_u16(pkt, off) & ~COMPRESSION_PTR;
+            continue;
+        }
+        if (len == 0) {
+            const char *label;
+            size_t label_len;
+            return !next_expected_label(&expected, &label, &label_len);
+        }
+        if (len > 63 || (nsapi_size_t)(off + 1 + len) > size) {
+            return false;
+        }
+        const char *label;
+        size_t label_len;
+        if (!next_expected_label(&expected, &label, &label_len) ||
+                label_len != len ||
+                !labels_equal(&pkt[off + 1], label, len)) {
+            return false;
+        }
+        off += 1 + len;
+    }
+    return false;
+}
+
+MdnsResponder::MdnsResponder()
+    : _interface(NULL), _hostname(NULL), _service_count(0),
+      _announce_event_id(0), _running(false)
+{
+}
+
+MdnsResponder::~MdnsResponder()
+{
+    stop();
+}
+
+nsapi_error_t MdnsResponder::add_service(const char *instance,
+                                         const char *type, uint16_t port,
+                                         const char *txt)
+{
+    if (instance == NULL || type == NULL) {
+        return NSAPI_ERROR_PARAMETER;
+    }
+    _lock.lock();
+    if (_service_count >= MBED_CONF_NSAPI_MDNS_MAX_SERVICES) {
+        _lock.unlock();
+        return NSAPI_ERROR_NO_MEMORY;
+    }
+    mdns_service_t *service = &_services[_service_count];
+    service->instance = instance;
+    service->type = type;
+    service->txt = txt;
+    service->port = port;
+    _service_count++;
+    _lock.unlock();
+    return NSAPI_ERROR_OK;
+}
+
+nsapi_error_t MdnsResponder::start(NetworkInterface *interface,
+                                   const char *hostname)
+{
+    if (interface == NULL || hostname == NULL) {
+        return NSAPI_ERROR_PARAMETER;
+    }
+    _lock.lock();
+    if (_running) {
+        _lock.unlock();
+        return NSAPI_ERROR_IS_CONNECTED;
+    }
+
+    nsapi_error_t ret = _socket.open(interface);
+    if (ret != NSAPI_ERROR_OK) {
+        _lock.unlock();
+        return ret;
+    }
+    ret = _socket.bind(MDNS_PORT);
+    if (ret == NSAPI_ERROR_OK) {
+        const nsapi_addr_t mdns_group = {NSAPI_IPv4, {224, 0, 0, 251}};
+        ret = _socket.join_multicast_group(SocketAddress(mdns_group, MDNS_PORT));
+    }
+    if (ret != NSAPI_ERROR_OK) {
+        _socket.close();
+        _lock.unlock();
+        return ret;
+    }
+
+    _interface = interface;
+    _hostname = hostname;
+    _socket.set_blocking(false);
+    _socket.sigio(mbed::callback(this, &MdnsResponder::socket_event));
+    _running = true;
+
+    announce(MBED_CONF_NSAPI_MDNS_TTL);
+    _announce_event_id = mbed::mbed_event_queue()->call_in(
+                             1s, this, &MdnsResponder::announce_again);
+    _lock.unlock();
+    return NSAPI_ERROR_OK;
+}
+
+void MdnsResponder::stop()
+{
+    _lock.lock();
+    if (!_running) {
+        _lock.unlock();
+        return;
+    }
+    if (_announce_event_id != 0) {
+        mbed::mbed_event_queue()->cancel(_announce_event_id);
+        _announce_event_id = 0;
+    }
+    announce(0);
+    _socket.sigio(NULL);
+    _socket.close();
+    _running = false;
+    _lock.unlock();
+}
+
+void MdnsResponder::socket_event()
+{
+    // May run in interrupt context; defer the packet work to the shared
+    // event queue so the stack's own thread is never stalled by it
+    mbed::mbed_event_queue()->call(mbed::callback(this, &MdnsResponder::process));
+}
+
+void MdnsResponder::process()
+{
+    _lock.lock();
+    while (_running) {
+        SocketAddress source;
+        nsapi_size_or_error_t size = _socket.recvfrom(&source, _rx_buf,
+                                                      sizeof(_rx_buf));
+        if (size <= 0) {
+            break;
+        }
+        handle_query(size, source);
+    }
+    _lock.unlock();
+}
+
+void MdnsResponder::handle_query(nsapi_size_t size, const SocketAddress &source)
+{
+    if (size < DNS_HEADER_SIZE) {
+        return;
+    }
+    uint16_t id = read_u16(_rx_buf, 0);
+    uint16_t flags = read_u16(_rx_buf, 2);
+    if (flags & 0x8000) {
+        return;     // a response, not a query
+    }
+    uint16_t question_count = read_u16(_rx_buf, 4);
+    uint16_t answer_count = read_u16(_rx_buf, 6);
+
+    uint32_t full_mask = 0;
+    uint32_t enum_mask = 0;
+    bool host = false;
+    bool unicast = (source.get_port() != MDNS_PORT);
+    int off = DNS_HEADER_SIZE;
+
+    for (uint16_t q = 0; q < question_count; q++) {
+        int name_off = off;
+        off = skip_name(_rx_buf, size, off);
+        if (off < 0 || (nsapi_size_t)(off + 4) > size) {
+            return;
+        }
+        uint16_t qtype = read_u16(_rx_buf, off);
+        uint16_t qclass = read_u16(_rx_buf, off + 2);
+        off += 4;
+        if ((qclass & ~0x8000) != CLASS_IN) {
+            continue;
+        }
+        if (qclass & 0x8000) {
+            unicast = true;     // QU question requests a unicast reply
+        }
+        if ((qtype == RR_TYPE_PTR || qtype == RR_TYPE_ANY) &&
+                name_matches(_rx_buf, size, name_off, NULL, mdns_enum_name)) {
+            enum_mask = (_service_count == 0) ? 0 : (0xffffffffu >> (32 - _service_count));
+            continue;
+        }
+        if ((qtype == RR_TYPE_A || qtype == RR_TYPE_ANY) &&
+                name_matches(_rx_buf, size, name_off, NULL, _hostname)) {
+            host = true;
+        }
+        for (unsigned int i = 0; i < _service_count; i++) {
+            if ((qtype == RR_TYPE_PTR || qtype == RR_TYPE_ANY) &&
+                    name_matches(_rx_buf, size, name_off, NULL, _services[i].type)) {
+                full_mask |= 1u << i;
+            } else if ((qtype == RR_TYPE_SRV || qtype == RR_TYPE_TXT ||
+                        qtype == RR_TYPE_ANY) &&
+                       name_matches(_rx_buf, size, name_off,
+                                    _services[i].instance, _services[i].type)) {
+                full_mask |= 1u << i;
+            }
+        }
+    }
+
+    /* Known-answer suppression: drop services whose PTR record the
+     * querier already holds with at least half our TTL left. */
+    for (uint16_t a = 0; a < answer_count; a++) {
+        int name_off = off;
+        off = skip_name(_rx_buf, size, off);
+        if (off < 0 || (nsapi_size_t)(off + 10) > size) {
+            return;
+        }
+        uint16_t rtype = read_u16(_rx_buf, off);
+        uint32_t ttl = read_u32(_rx_buf, off + 4);
+        uint16_t rdlength = read_u16(_rx_buf, off + 8);
+        int rdata_off = off + 10;
+        off = rdata_off + rdlength;
+        if ((nsapi_size_t)off > size) {
+            return;
+        }
+        if (rtype != RR_TYPE_PTR || ttl < MBED_CONF_NSAPI_MDNS_TTL / 2) {
+            continue;
+        }
+        for (unsigned int i = 0; i < _service_count; i++) {
+            if ((full_mask & (1u << i)) &&
+                    name_matches(_rx_buf, size, name_off, NULL, _services[i].type) &&
+                    name_matches(_rx_buf, size, rdata_off,
+                                 _services[i].instance, _services[i].type)) {
+                full_mask &= ~(1u << i);
+            }
+            if ((enum_mask & (1u << i)) &&
+                    name_matches(_rx_buf, size, name_off, NULL, mdns_enum_name) &&
+                    name_matches(_rx_buf, size, rdata_off, NULL, _services[i].type)) {
+                enum_mask &= ~(1u << i);
+            }
+        }
+    }
+
+    if (full_mask == 0 && enum_mask == 0 && !host) {
+        return;
+    }
+    send_response(full_mask, enum_mask, host,
+                  unicast ? id : 0, MBED_CONF_NSAPI_MDNS_TTL,
+                  unicast ? &source : NULL);
+}
+
+void MdnsResponder::announce(uint32_t ttl)
+{
+    uint32_t all = (_service_count == 0) ? 0 : (0xffffffffu >> (32 - _service_count));
+    send_response(all, all, true, 0, ttl, NULL);
+}
+
+void MdnsResponder::announce_again()
+{
+    _lock.lock();
+    _announce_event_id = 0;
+    if (_running) {
+        announce(MBED_CONF_NSAPI_MDNS_TTL);
+    }
+    _lock.unlock();
+}
+
+void MdnsResponder::send_response(uint32_t full_mask, uint32_t enum_mask,
+                                  bool host, uint16_t id, uint32_t ttl,
+                                  const SocketAddress *unicast_dest)
+{
+    name_offsets_t offsets;
+    memset(&offsets, 0, sizeof(offsets));
+    uint16_t unique_class = (unicast_dest != NULL) ? CLASS_IN : CLASS_IN_FLUSH;
+    uint16_t count = 0;
+
+    mdns_writer_t w = { _tx_buf, 0, sizeof(_tx_buf), false };
+    write_u16(&w, id);
+    write_u16(&w, FLAGS_RESPONSE_AA);
+    write_u16(&w, 0);   // questions
+    write_u16(&w, 0);   // answers, patched below
+    write_u16(&w, 0);   // authority
+    write_u16(&w, 0);   // additional
+    uint16_t len = w.len;
+
+    for (unsigned int i = 0; i < _service_count; i++) {
+        if (full_mask & (1u << i)) {
+            len = append_service_records(len, i, ttl, unique_class,
+                                         &offsets, &count);
+        }
+        if (enum_mask & (1u << i)) {
+            len = append_enum_record(len, i, ttl, &offsets, &count);
+        }
+    }
+    if (host || full_mask != 0) {
+        len = append_host_record(len, ttl, unique_class, &offsets, &count);
+    }
+    if (count == 0) {
+        return;
+    }
+    w.len = len;
+    patch_u16(&w, 6, count);
+
+    if (unicast_dest != NULL) {
+        _socket.sendto(*unicast_dest, _tx_buf, len);
+    } else {
+        const nsapi_addr_t mdns_group = {NSAPI_IPv4, {224, 0, 0, 251}};
+        _socket.sendto(SocketAddress(mdns_group, MDNS_PORT), _tx_buf, len);
+    }
+}
+
+uint16_t MdnsResponder::append_service_records(uint16_t len, unsigned int index,
+                                               uint32_t ttl,
+                                               uint16_t unique_class,
+                                               name_offsets_t *offsets,
+                                               uint16_t *count)
+{
+    const mdns_service_t *service = &_services[index];
+    mdns_writer_t w = { _tx_buf, len, sizeof(_tx_buf), false };
+    name_offsets_t saved = *offsets;
+    uint16_t rdlength_pos;
+
+    // PTR "<type>.local" -> "<instance>.<type>.local"; a shared record,
+    // so no cache-flush bit regardless of destination
+    write_name(&w, NULL, service->type, &offsets->type[index], NULL);
+    write_u16(&w, RR_TYPE_PTR);
+    write_u16(&w, CLASS_IN);
+    write_u32(&w, ttl);
+    rdlength_pos = w.len;
+    write_u16(&w, 0);
+    write_name(&w, service->instance, service->type,
+               &offsets->full[index], &offsets->type[index]);
+    if (w.overflow) {
+        *offsets = saved;
+        return len;
+    }
+    patch_u16(&w, rdlength_pos, w.len - rdlength_pos - 2);
+    saved = *offsets;
+    len = w.len;
+    (*count)++;
+
+    // SRV "<instance>.<type>.local" -> port and target host
+    write_name(&w, service->instance, service->type,
+               &offsets->full[index], &offsets->type[index]);
+    write_u16(&w, RR_TYPE_SRV);
+    write_u16(&w, unique_class);
+    write_u32(&w, ttl);
+    rdlength_pos = w.len;
+    write_u16(&w, 0);
+    write_u16(&w, 0);   // priority
+    write_u16(&w, 0);   // weight
+    write_u16(&w, service->port);
+    write_name(&w, NULL, _hostname, &offsets->host, NULL);
+    if (w.overflow) {
+        *offsets = saved;
+        return len;
+    }
+    patch_u16(&w, rdlength_pos, w.len - rdlength_pos - 2);
+    saved = *offsets;
+    len = w.len;
+    (*count)++;
+
+    // TXT record, a single character-string or empty
+    write_name(&w, service->instance, service->type,
+               &offsets->full[index], &offsets->type[index]);
+    write_u16(&w, RR_TYPE_TXT);
+    write_u16(&w, unique_class);
+    write_u32(&w, ttl);
+    rdlength_pos = w.len;
+    write_u16(&w, 0);
+    if (service->txt != NULL && service->txt[0] != '\0') {
+        size_t txt_len = strlen(service->txt);
+        if (txt_len > 255) {
+            txt_len = 255;
+        }
+        write_u8(&w, txt_len);
+        write_bytes(&w, service->txt, txt_len);
+    } else {
+        write_u8(&w, 0);
+    }
+    if (w.overflow) {
+        *offsets = saved;
+        return len;
+    }
+    patch_u16(&w, rdlength_pos, w.len - rdlength_pos - 2);
+    (*count)++;
+    return w.len;
+}
+
+uint16_t MdnsResponder::append_enum_record(uint16_t len, unsigned int index,
+                                           uint32_t ttl,
+                                           name_offsets_t *offsets,
+                                           uint16_t *count)
+{
+    mdns_writer_t w = { _tx_buf, len, sizeof(_tx_buf), false };
+    name_offsets_t saved = *offsets;
+
+    write_name(&w, NULL, mdns_enum_name, &offsets->enumeration, NULL);
+    write_u16(&w, RR_TYPE_PTR);
+    write_u16(&w, CLASS_IN);
+    write_u32(&w, ttl);
+    uint16_t rdlength_pos = w.len;
+    write_u16(&w, 0);
+    write_name(&w, NULL, _services[index].type, &offsets->type[index], NULL);
+    if (w.overflow) {
+        *offsets = saved;
+        return len;
+    }
+    patch_u16(&w, rdlength_pos, w.len - rdlength_pos - 2);
+    (*count)++;
+    return w.len;
+}
+
+uint16_t MdnsResponder::append_host_record(uint16_t len, uint32_t ttl,
+                                           uint16_t unique_class,
+                                           name_offsets_t *offsets,
+                                           uint16_t *count)
+{
+    SocketAddress address;
+    if (_interface->get_ip_address(&address) != NSAPI_ERROR_OK ||
+            address.get_ip_version() != NSAPI_IPv4) {
+        return len;
+    }
+    mdns_writer_t w = { _tx_buf, len, sizeof(_tx_buf), false };
+    name_offsets_t saved = *offsets;
+
+    write_name(&w, NULL, _hostname, &offsets->host, NULL);
+    write_u16(&w, RR_TYPE_A);
+    write_u16(&w, unique_class);
+    write_u32(&w, ttl);
+    write_u16(&w, 4);
+    write_bytes(&w, address.get_addr().bytes, 4);
+    if (w.overflow) {
+        *offsets = saved;
+        return len;
+    }
+    (*count)++;
+    return w.len;
+}
@@ -0,0 +1,319 @@
+/* Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "netsocket/NetworkFailover.h"
+#include "netsocket/SocketAddress.h"
+
+#if !defined(MBED_CONF_NSAPI_OFFLOAD_TLSSOCKET) || !(MBED_CONF_NSAPI_OFFLOAD_TLSSOCKET)
+#if defined(MBEDTLS_SSL_CLI_C)
+#define NSAPI_FAILOVER_TLS_PREWARM 1
+#include "netsocket/TLSSocket.h"
+#endif
+#endif
+
+NetworkFailover::NetworkFailover(NetworkInterface *primary, NetworkInterface *secondary,
+                                 events::EventQueue *queue)
+    : _num_targets(0), _active(0), _probe_host(NULL), _queue(queue),
+      _prober(queue, mbed::callback(this, &NetworkFailover::probe_all),
+              events::EventQueue::duration(MBED_CONF_NSAPI_FAILOVER_PROBE_PERIOD)),
+      _started(false)
+{
+    _links[0] = {primary, 0, false, false, false};
+    _links[1] = {secondary, 0, false, false, false};
+}
+
+NetworkFailover::~NetworkFailover()
+{
+    stop();
+}
+
+void NetworkFailover::set_probe(const char *hostname)
+{
+    _lock.lock();
+    _probe_host = hostname;
+    _lock.unlock();
+}
+
+nsapi_error_t NetworkFailover::add_prewarm(const char *hostname, uint16_t port,
+                                           const char *root_ca_pem)
+{
+    _lock.lock();
+    if (_num_targets >= MBED_CONF_NSAPI_FAILOVER_PREWARM_TARGETS) {
+        _lock.unlock();
+        return NSAPI_ERROR_NO_MEMORY;
+    }
+    _targets[_num_targets].host = hostname;
+    _targets[_num_targets].root_ca = root_ca_pem;
+    _targets[_num_targets].port = port;
+    _num_targets++;
+    // A new target invalidates what has been warmed so far
+    _links[0].prewarmed = false;
+    _links[1].prewarmed = false;
+    _lock.unlock();
+    return NSAPI_ERROR_OK;
+}
+
+void NetworkFailover::attach(mbed::Callback<void(NetworkInterface *)> on_switch)
+{
+    _lock.lock();
+    _on_switch = on_switch;
+    _lock.unlock();
+}
+
+nsapi_error_t NetworkFailover::start()
+{
+    _lock.lock();
+    if (_started) {
+        _lock.unlock();
+        return NSAPI_ERROR_IS_CONNECTED;
+    }
+    _started = true;
+    _lock.unlock();
+
+    // The engine owns the status callbacks; applications attach to the
+    // engine instead. Events may arrive from driver context, so the
+    // handlers only post to the queue
+    for (int i = 0; i < 2; i++) {
+        _links[i].iface->attach([this, i](nsapi_event_t event, intptr_t status) {
+            if (event == NSAPI_EVENT_CONNECTION_STATUS_CHANGE) {
+                _queue->call(this, &NetworkFailover::handle_link, i,
+                             (nsapi_connection_status_t)status);
+            }
+        });
+    }
+
+    _queue->call(this, &NetworkFailover::bring_up, 0);
+    _queue->call(this, &NetworkFailover::bring_up, 1);
+    _prober.start();
+    return NSAPI_ERROR_OK;
+}
+
+void NetworkFailover::stop()
+{
+    _lock.lock();
+    if (!_started) {
+        _lock.unlock();
+        return;
+    }
+    _started = false;
+    _lock.unlock();
+
+    _prober.stop();
+    _links[0].iface->attach(NULL);
+    _links[1].iface->attach(NULL);
+}
+
+NetworkInterface *NetworkFailover::active()
+{
+    return get(BIND_ACTIVE);
+}
+
+NetworkInterface *NetworkFailover::get(binding_policy_t policy)
+{
+    _lock.lock();
+    NetworkInterface *iface;
+    switch (policy) {
+        case BIND_PRIMARY:
+            iface = _links[0].iface;
+            break;
+        case BIND_STANDBY:
+            iface = _links[1 - _active].iface;
+            break;
+        case BIND_ACTIVE:
+        default:
+            iface = _links[_active].iface;
+            break;
+    }
+    _lock.unlock();
+    return iface;
+}
+
+bool NetworkFailover::is_healthy(NetworkInterface *iface)
+{
+    _lock.lock();
+    bool healthy = false;
+    for (int i = 0; i < 2; i++) {
+        if (_links[i].iface == iface) {
+            healthy = _links[i].healthy;
+        }
+    }
+    _lock.unlock();
+    return healthy;
+}
+
+void NetworkFailover::bring_up(int index)
+{
+    nsapi_error_t err = _links[index].iface->connect();
+    if ((err != NSAPI_ERROR_OK) && (err != NSAPI_ERROR_IS_CONNECTED)) {
+        // Try again after a probe period rather than spinning
+        _lock.lock();
+        bool retry = _started;
+        _lock.unlock();
+        if (retry) {
+            _queue->call_in(events::EventQueue::duration(MBED_CONF_NSAPI_FAILOVER_PROBE_PERIOD),
+                            this, &NetworkFailover::bring_up, index);
+        }
+        return;
+    }
+
+    _lock.lock();
+    _links[index].up = true;
+    _links[index].healthy = true;
+    _links[index].fails = 0;
+    bool warm = (index != _active) && !_links[index].prewarmed;
+    _lock.unlock();
+
+    evaluate();
+    if (warm) {
+        _queue->call(this, &NetworkFailover::prewarm, index);
+    }
+}
+
+void NetworkFailover::handle_link(int index, nsapi_connection_status_t status)
+{
+    bool up = (status == NSAPI_STATUS_GLOBAL_UP) || (status == NSAPI_STATUS_LOCAL_UP);
+
+    _lock.lock();
+    _links[index].up = up;
+    if (up) {
+        _links[index].healthy = true;
+        _links[index].fails = 0;
+    } else {
+        // The link told us it is gone - fail over now rather than
+        // waiting for probes to notice
+        _links[index].healthy = false;
+        _links[index].prewarmed = false;
+    }
+    bool reconnect = !up && (status == NSAPI_STATUS_DISCONNECTED) && _started;
+    _lock.unlock();
+
+    evaluate();
+    if (reconnect) {
+        _queue->call_in(events::EventQueue::duration(MBED_CONF_NSAPI_FAILOVER_PROBE_PERIOD),
+                        this, &NetworkFailover::bring_up, index);
+    }
+}
+
+void NetworkFailover::probe_all()
+{
+    _lock.lock();
+    const char *host = _probe_host;
+    _lock.unlock();
+
+    for (int i = 0; i < 2; i++) {
+        _lock.lock();
+        bool up = _links[i].up;
+        _lock.unlock();
+        if (!up) {
+            continue;
+        }
+
+        bool passed = true;
+        if (host) {
+            // Resolving through the link exercises the whole path, not
+            // just the local link state
+            SocketAddress addr;
+            passed = (_links[i].iface->gethostbyname(host, &addr) == NSAPI_ERROR_OK);
+        }
+
+        _lock.lock();
+        if (passed) {
+            _links[i].fails = 0;
+            _links[i].healthy = true;
+        } else if (++_links[i].fails >= MBED_CONF_NSAPI_FAILOVER_PROBE_FAILURES) {
+            _links[i].healthy = false;
+        }
+        bool warm = _links[i].healthy && (i != _active) && !_links[i].prewarmed;
+        _lock.unlock();
+
+        if (warm) {
+            prewarm(i);
+        }
+    }
+
+    evaluate();
+}
+
+void NetworkFailover::evaluate()
+{
+    _lock.lock();
+    // Prefer the primary whenever it is healthy, so traffic fails back
+    // automatically; otherwise take any healthy link, and when neither
+    // is healthy stay where we are
+    int want = _active;
+    if (_links[0].healthy) {
+        want = 0;
+    } else if (_links[1].healthy) {
+        want = 1;
+    }
+    bool switched = (want != _active);
+    _active = want;
+    NetworkInterface *iface = _links[_active].iface;
+    mbed::Callback<void(NetworkInterface *)> on_switch = _on_switch;
+    _lock.unlock();
+
+    if (switched && on_switch) {
+        on_switch(iface);
+    }
+}
+
+void NetworkFailover::prewarm(int index)
+{
+    NetworkInterface *iface = _links[index].iface;
+    bool all_warm = true;
+
+    _lock.lock();
+    int num_targets = _num_targets;
+    _lock.unlock();
+
+    for (int t = 0; t < num_targets; t++) {
+        // Warming the resolver result is worthwhile even without TLS
+        SocketAddress addr;
+        if (iface->gethostbyname(_targets[t].host, &addr) != NSAPI_ERROR_OK) {
+            all_warm = false;
+            continue;
+        }
+
+#if NSAPI_FAILOVER_TLS_PREWARM
+        // Complete and close a handshake through the standby so the
+        // session lands in the TLS session resumption cache; a socket
+        // opened here after a failover resumes with the abbreviated
+        // handshake instead of a full one
+        TLSSocket *sock = new (std::nothrow) TLSSocket;
+        if (!sock) {
+            all_warm = false;
+            continue;
+        }
+        bool ok = (sock->open(iface) == NSAPI_ERROR_OK);
+        if (ok && _targets[t].root_ca) {
+            ok = (sock->set_root_ca_cert(_targets[t].root_ca) == NSAPI_ERROR_OK);
+        }
+        if (ok) {
+            sock->set_hostname(_targets[t].host);
+            addr.set_port(_targets[t].port);
+            ok = (sock->connect(addr) == NSAPI_ERROR_OK);
+        }
+        delete sock;
+        if (!ok) {
+            all_warm = false;
+        }
+#endif
+    }
+
+    _lock.lock();
+    _links[index].prewarmed = all_warm;
+    _lock.unlock();
+}
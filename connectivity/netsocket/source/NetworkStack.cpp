@@ -19,6 +19,7 @@
 #include "netsocket/nsapi_dns.h"
 #include "stddef.h"
 #include <new>
+#include <string.h>
 #include "events/EventQueue.h"
 #include "events/mbed_shared_queues.h"
 #include "platform/mbed_error.h"
@@ -171,6 +172,59 @@ nsapi_error_t NetworkStack::get_dns_server(int index, SocketAddress *address, co
     return NSAPI_ERROR_UNSUPPORTED;
 }
 
+nsapi_size_or_error_t NetworkStack::socket_recvfrom_buffer(nsapi_socket_t handle, SocketAddress *address,
+                                                           net_stack_mem_buf_t **buffer)
+{
+    return NSAPI_ERROR_UNSUPPORTED;
+}
+
+nsapi_size_or_error_t NetworkStack::socket_recvfrom_timestamp(nsapi_socket_t handle, SocketAddress *address,
+                                                              void *buffer, nsapi_size_t size,
+                                                              nsapi_timestamp_t *timestamp)
+{
+    memset(timestamp, 0, sizeof(*timestamp));
+    return socket_recvfrom(handle, address, buffer, size);
+}
+
+nsapi_size_or_error_t NetworkStack::socket_sendv(nsapi_socket_t handle,
+                                                 const nsapi_iovec_t *iov, int iov_count)
+{
+    return NSAPI_ERROR_UNSUPPORTED;
+}
+
+nsapi_size_or_error_t NetworkStack::socket_sendtov(nsapi_socket_t handle, const SocketAddress &address,
+                                                   const nsapi_iovec_t *iov, int iov_count)
+{
+    return NSAPI_ERROR_UNSUPPORTED;
+}
+
+nsapi_size_or_error_t NetworkStack::socket_send_nocopy(nsapi_socket_t handle,
+                                                       const void *data, nsapi_size_t size)
+{
+    return NSAPI_ERROR_UNSUPPORTED;
+}
+
+nsapi_error_t NetworkStack::socket_notify_sent(nsapi_socket_t handle,
+                                               void (*callback)(void *), void *data)
+{
+    return NSAPI_ERROR_UNSUPPORTED;
+}
+
+nsapi_size_or_error_t NetworkStack::socket_send_pending(nsapi_socket_t handle)
+{
+    return NSAPI_ERROR_UNSUPPORTED;
+}
+
+size_t NetworkStack::get_interface_stats(mbed_stats_interface_t *stats, size_t count)
+{
+    return 0;
+}
+
+NetStackMemoryManager *NetworkStack::get_memory_manager()
+{
+    return NULL;
+}
+
 nsapi_error_t NetworkStack::setstackopt(int level, int optname, const void *optval, unsigned optlen)
 {
     return NSAPI_ERROR_UNSUPPORTED;
@@ -0,0 +1,506 @@
+/*
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "netsocket/PTPClient.h"
+#include "events/mbed_shared_queues.h"
+
+#include <string.h>
+#include <stdlib.h>
+
+#if DEVICE_PTP
+#include "hal/ptp_api.h"
+#else
+#include "hal/ticker_api.h"
+#include "hal/us_ticker_api.h"
+#endif
+
+/* IEEE 1588-2008 over UDP/IPv4, annex D */
+#define PTP_PRIMARY_GROUP   "224.0.1.129"
+#define PTP_EVENT_PORT      319
+#define PTP_GENERAL_PORT    320
+
+#define PTP_MSG_SYNC        0x0
+#define PTP_MSG_DELAY_REQ   0x1
+#define PTP_MSG_FOLLOW_UP   0x8
+#define PTP_MSG_DELAY_RESP  0x9
+
+#define PTP_HEADER_LEN      34
+#define PTP_SYNC_LEN        44  /* header + originTimestamp */
+#define PTP_DELAY_RESP_LEN  54  /* + requestingPortIdentity */
+
+#define PTP_FLAG_TWO_STEP   0x02    /* in flagField[0] */
+
+#define NS_PER_SEC          1000000000LL
+
+static uint16_t read_u16(const uint8_t *p)
+{
+    return ((uint16_t)p[0] << 8) | p[1];
+}
+
+static int64_t read_timestamp(const uint8_t *p)
+{
+    /* 48-bit seconds + 32-bit nanoseconds, network order */
+    uint64_t sec = ((uint64_t)p[0] << 40) | ((uint64_t)p[1] << 32) |
+                   ((uint64_t)p[2] << 24) | ((uint64_t)p[3] << 16) |
+                   ((uint64_t)p[4] << 8) | p[5];
+    uint32_t nsec = ((uint32_t)p[6] << 24) | ((uint32_t)p[7] << 16) |
+                    ((uint32_t)p[8] << 8) | p[9];
+    return (int64_t)(sec * NS_PER_SEC + nsec);
+}
+
+static int64_t read_correction(const uint8_t *p)
+{
+    uint64_t v = 0;
+    for (int i = 0; i < 8; i++) {
+        v = (v << 8) | p[i];
+    }
+    /* correctionField is nanoseconds scaled by 2^16 */
+    return (int64_t)v >> 16;
+}
+
+PTPClient::PTPClient()
+    : _interface(NULL), _domain(0), _running(false), _delay_req_event_id(0),
+      _have_master(false), _sync_sequence(0), _sync_t2(0), _sync_pending(false),
+      _delay_sequence(0), _delay_t3(0), _delay_pending(false),
+      _master_to_local(0), _have_sync(false),
+      _offset(0), _path_delay(0), _freq_integral(0),
+      _stepped(false), _locked(false)
+#if !DEVICE_PTP
+    , _base(0), _anchor(0), _ppb(0)
+#endif
+{
+    memset(_our_identity, 0, sizeof(_our_identity));
+    memset(_master_identity, 0, sizeof(_master_identity));
+}
+
+PTPClient::~PTPClient()
+{
+    stop();
+}
+
+nsapi_error_t PTPClient::start(NetworkInterface *interface, uint8_t domain)
+{
+    if (!interface) {
+        return NSAPI_ERROR_PARAMETER;
+    }
+
+    _lock.lock();
+    if (_running) {
+        _lock.unlock();
+        return NSAPI_ERROR_IS_CONNECTED;
+    }
+
+    _interface = interface;
+    _domain = domain;
+
+    /* clockIdentity from the interface MAC, EUI-48 to EUI-64 expansion;
+       portNumber 1 */
+    const char *mac = interface->get_mac_address();
+    uint8_t eui[6] = {0};
+    if (mac) {
+        for (int i = 0; i < 6; i++) {
+            eui[i] = (uint8_t)strtoul(mac + 3 * i, NULL, 16);
+        }
+    }
+    memcpy(_our_identity, eui, 3);
+    _our_identity[3] = 0xFF;
+    _our_identity[4] = 0xFE;
+    memcpy(_our_identity + 5, eui + 3, 3);
+    _our_identity[8] = 0;
+    _our_identity[9] = 1;
+
+    nsapi_error_t ret = _event_socket.open(interface);
+    if (ret != NSAPI_ERROR_OK) {
+        _lock.unlock();
+        return ret;
+    }
+    ret = _general_socket.open(interface);
+    if (ret == NSAPI_ERROR_OK) {
+        ret = _event_socket.bind(PTP_EVENT_PORT);
+    }
+    if (ret == NSAPI_ERROR_OK) {
+        ret = _general_socket.bind(PTP_GENERAL_PORT);
+    }
+    if (ret == NSAPI_ERROR_OK) {
+        ret = _event_socket.join_multicast_group(
+                  SocketAddress(PTP_PRIMARY_GROUP, PTP_EVENT_PORT));
+    }
+    if (ret == NSAPI_ERROR_OK) {
+        ret = _general_socket.join_multicast_group(
+                  SocketAddress(PTP_PRIMARY_GROUP, PTP_GENERAL_PORT));
+    }
+    if (ret != NSAPI_ERROR_OK) {
+        _event_socket.close();
+        _general_socket.close();
+        _lock.unlock();
+        return ret;
+    }
+
+#if DEVICE_PTP
+    ptp_init();
+#endif
+
+    _have_master = false;
+    _sync_pending = false;
+    _delay_pending = false;
+    _have_sync = false;
+    _freq_integral = 0;
+    _stepped = false;
+    _locked = false;
+
+    _event_socket.set_blocking(false);
+    _general_socket.set_blocking(false);
+    _event_socket.sigio(mbed::callback(this, &PTPClient::event_ready));
+    _general_socket.sigio(mbed::callback(this, &PTPClient::general_ready));
+    _running = true;
+
+    _delay_req_event_id = mbed::mbed_event_queue()->call_in(
+                              std::chrono::milliseconds(MBED_CONF_NSAPI_PTP_DELAY_REQ_INTERVAL_MS),
+                              mbed::callback(this, &PTPClient::send_delay_req));
+
+    _lock.unlock();
+    return NSAPI_ERROR_OK;
+}
+
+void PTPClient::stop()
+{
+    _lock.lock();
+    if (!_running) {
+        _lock.unlock();
+        return;
+    }
+    _running = false;
+    if (_delay_req_event_id) {
+        mbed::mbed_event_queue()->cancel(_delay_req_event_id);
+        _delay_req_event_id = 0;
+    }
+    _event_socket.sigio(NULL);
+    _general_socket.sigio(NULL);
+    _event_socket.close();
+    _general_socket.close();
+#if DEVICE_PTP
+    ptp_free();
+#endif
+    _lock.unlock();
+}
+
+void PTPClient::event_ready()
+{
+    /* Called possibly from interrupt; defer to the shared queue */
+    mbed::mbed_event_queue()->call(mbed::callback(this, &PTPClient::process));
+}
+
+void PTPClient::general_ready()
+{
+    mbed::mbed_event_queue()->call(mbed::callback(this, &PTPClient::process));
+}
+
+void PTPClient::process()
+{
+    _lock.lock();
+    if (!_running) {
+        _lock.unlock();
+        return;
+    }
+
+    while (true) {
+        nsapi_timestamp_t stamp;
+        nsapi_size_or_error_t size = _event_socket.recvfrom_timestamp(
+                                         NULL, _rx_buf, sizeof(_rx_buf), &stamp);
+        if (size < (nsapi_size_or_error_t)PTP_HEADER_LEN) {
+            break;
+        }
+        handle_message(_rx_buf, size, stamp);
+    }
+
+    while (true) {
+        nsapi_timestamp_t stamp = {0, 0, 0};
+        nsapi_size_or_error_t size = _general_socket.recvfrom(
+                                         NULL, _rx_buf, sizeof(_rx_buf));
+        if (size < (nsapi_size_or_error_t)PTP_HEADER_LEN) {
+            break;
+        }
+        handle_message(_rx_buf, size, stamp);
+    }
+
+    _lock.unlock();
+}
+
+void PTPClient::handle_message(const uint8_t *msg, nsapi_size_t size,
+                               const nsapi_timestamp_t &stamp)
+{
+    uint8_t type = msg[0] & 0x0F;
+    uint8_t version = msg[1] & 0x0F;
+
+    if (version != 2 || msg[4] != _domain || read_u16(msg + 2) > size) {
+        return;
+    }
+
+    /* Track the first master heard; a BMCA implementation would go here */
+    if (type == PTP_MSG_SYNC && !_have_master) {
+        memcpy(_master_identity, msg + 20, 10);
+        _have_master = true;
+    }
+
+    switch (type) {
+        case PTP_MSG_SYNC:
+            if (memcmp(msg + 20, _master_identity, 10) == 0 &&
+                    size >= PTP_SYNC_LEN) {
+                handle_sync(msg, stamp);
+            }
+            break;
+        case PTP_MSG_FOLLOW_UP:
+            if (memcmp(msg + 20, _master_identity, 10) == 0 &&
+                    size >= PTP_SYNC_LEN) {
+                handle_follow_up(msg);
+            }
+            break;
+        case PTP_MSG_DELAY_RESP:
+            if (size >= PTP_DELAY_RESP_LEN) {
+                handle_delay_resp(msg);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+void PTPClient::handle_sync(const uint8_t *msg, const nsapi_timestamp_t &stamp)
+{
+    int64_t t2 = stamp.valid ? stamp_to_ns(stamp) : local_time_ns();
+
+    if (msg[6] & PTP_FLAG_TWO_STEP) {
+        /* Precise origin time arrives in the Follow_Up */
+        _sync_sequence = read_u16(msg + 30);
+        _sync_t2 = t2;
+        _sync_pending = true;
+        return;
+    }
+
+    _sync_pending = false;
+    _sync_t2 = t2;
+    complete_sync(read_timestamp(msg + 34) + read_correction(msg + 8));
+}
+
+void PTPClient::handle_follow_up(const uint8_t *msg)
+{
+    if (!_sync_pending || read_u16(msg + 30) != _sync_sequence) {
+        return;
+    }
+    _sync_pending = false;
+    complete_sync(read_timestamp(msg + 34) + read_correction(msg + 8));
+}
+
+void PTPClient::complete_sync(int64_t t1)
+{
+    _master_to_local = _sync_t2 - t1;
+    _have_sync = true;
+
+    /* Master-to-slave difference alone bounds the offset well enough to
+       take the initial step; the delay exchange then refines it */
+    if (!_stepped) {
+        servo_update(_master_to_local);
+    } else {
+        servo_update(_master_to_local - _path_delay);
+    }
+}
+
+void PTPClient::send_delay_req()
+{
+    _lock.lock();
+    if (!_running) {
+        _lock.unlock();
+        return;
+    }
+    _delay_req_event_id = mbed::mbed_event_queue()->call_in(
+                              std::chrono::milliseconds(MBED_CONF_NSAPI_PTP_DELAY_REQ_INTERVAL_MS),
+                              mbed::callback(this, &PTPClient::send_delay_req));
+
+    if (!_have_sync) {
+        _lock.unlock();
+        return;
+    }
+
+    memset(_tx_buf, 0, PTP_SYNC_LEN);
+    _tx_buf[0] = PTP_MSG_DELAY_REQ;
+    _tx_buf[1] = 2;                         /* versionPTP */
+    _tx_buf[2] = 0;
+    _tx_buf[3] = PTP_SYNC_LEN;              /* messageLength */
+    _tx_buf[4] = _domain;
+    memcpy(_tx_buf + 20, _our_identity, 10);
+    _delay_sequence++;
+    _tx_buf[30] = _delay_sequence >> 8;
+    _tx_buf[31] = (uint8_t)_delay_sequence;
+    _tx_buf[32] = 1;                        /* controlField: Delay_Req */
+    _tx_buf[33] = 0x7F;                     /* logMessageInterval: unused */
+    /* originTimestamp may be zero; the times that matter are t3 and t4 */
+
+    /* Software transmit timestamp: read as close to the send as we can */
+    _delay_t3 = local_time_ns();
+    nsapi_size_or_error_t sent = _event_socket.sendto(
+                                     SocketAddress(PTP_PRIMARY_GROUP, PTP_EVENT_PORT),
+                                     _tx_buf, PTP_SYNC_LEN);
+    _delay_pending = (sent == PTP_SYNC_LEN);
+    _lock.unlock();
+}
+
+void PTPClient::handle_delay_resp(const uint8_t *msg)
+{
+    if (!_delay_pending || !_have_sync ||
+            memcmp(msg + 44, _our_identity, 10) != 0 ||
+            read_u16(msg + 30) != _delay_sequence) {
+        return;
+    }
+    _delay_pending = false;
+
+    int64_t t4 = read_timestamp(msg + 34) - read_correction(msg + 8);
+    int64_t local_to_master = t4 - _delay_t3;
+
+    _path_delay = (_master_to_local + local_to_master) / 2;
+    if (_path_delay < 0) {
+        _path_delay = 0;
+    }
+    servo_update((_master_to_local - local_to_master) / 2);
+}
+
+void PTPClient::servo_update(int64_t offset)
+{
+    _offset = offset;
+
+    if (!_stepped || offset > MBED_CONF_NSAPI_PTP_STEP_THRESHOLD_NS ||
+            offset < -MBED_CONF_NSAPI_PTP_STEP_THRESHOLD_NS) {
+        clock_step(-offset);
+        _master_to_local -= offset;
+        _stepped = true;
+        _freq_integral = 0;
+        _locked = false;
+        return;
+    }
+
+    /* PI servo in parts per billion. With the usual one-second sync
+       interval an offset of N ns corresponds to a drift of about N ppb,
+       so the offset feeds the controller directly. */
+    _freq_integral += offset / 16;
+    if (_freq_integral > MBED_CONF_NSAPI_PTP_MAX_FREQUENCY_PPB) {
+        _freq_integral = MBED_CONF_NSAPI_PTP_MAX_FREQUENCY_PPB;
+    } else if (_freq_integral < -MBED_CONF_NSAPI_PTP_MAX_FREQUENCY_PPB) {
+        _freq_integral = -MBED_CONF_NSAPI_PTP_MAX_FREQUENCY_PPB;
+    }
+
+    int64_t adjust = offset / 4 + _freq_integral;
+    if (adjust > MBED_CONF_NSAPI_PTP_MAX_FREQUENCY_PPB) {
+        adjust = MBED_CONF_NSAPI_PTP_MAX_FREQUENCY_PPB;
+    } else if (adjust < -MBED_CONF_NSAPI_PTP_MAX_FREQUENCY_PPB) {
+        adjust = -MBED_CONF_NSAPI_PTP_MAX_FREQUENCY_PPB;
+    }
+    clock_rate(-(int32_t)adjust);
+
+    _locked = true;
+}
+
+void PTPClient::get_time(uint64_t *seconds, uint32_t *nanoseconds)
+{
+    _lock.lock();
+    int64_t now = local_time_ns();
+    _lock.unlock();
+    *seconds = (uint64_t)now / NS_PER_SEC;
+    *nanoseconds = (uint32_t)((uint64_t)now % NS_PER_SEC);
+}
+
+bool PTPClient::synchronized() const
+{
+    return _locked;
+}
+
+int64_t PTPClient::offset_ns() const
+{
+    return _offset;
+}
+
+int64_t PTPClient::mean_path_delay_ns() const
+{
+    return _path_delay;
+}
+
+#if DEVICE_PTP
+
+int64_t PTPClient::local_time_ns()
+{
+    ptp_timestamp_t ts;
+    ptp_read(&ts);
+    return (int64_t)(ts.seconds * NS_PER_SEC + ts.nanoseconds);
+}
+
+int64_t PTPClient::stamp_to_ns(const nsapi_timestamp_t &stamp)
+{
+    /* Receive timestamps are taken from the PTP hardware clock on
+       targets that have one (see mbed_lwip_rx_timestamp_now) */
+    return (int64_t)stamp.sec * NS_PER_SEC + stamp.nsec;
+}
+
+void PTPClient::clock_step(int64_t offset_ns)
+{
+    ptp_adjust_offset(offset_ns);
+}
+
+void PTPClient::clock_rate(int32_t ppb)
+{
+    ptp_info_t info;
+    ptp_get_info(&info);
+    if (ppb > info.max_frequency_adjustment) {
+        ppb = info.max_frequency_adjustment;
+    } else if (ppb < -info.max_frequency_adjustment) {
+        ppb = -info.max_frequency_adjustment;
+    }
+    ptp_adjust_frequency(ppb);
+}
+
+#else /* software clock over the microsecond ticker */
+
+int64_t PTPClient::local_time_ns()
+{
+    int64_t raw = (int64_t)ticker_read_us(get_us_ticker_data()) * 1000;
+    int64_t delta = raw - _anchor;
+    return _base + delta + delta / 1000 * _ppb / 1000000;
+}
+
+int64_t PTPClient::stamp_to_ns(const nsapi_timestamp_t &stamp)
+{
+    /* The default EMAC stamping clock is the same microsecond ticker the
+       software clock runs on, so apply the same discipline to it */
+    int64_t raw = (int64_t)stamp.sec * NS_PER_SEC + stamp.nsec;
+    int64_t delta = raw - _anchor;
+    return _base + delta + delta / 1000 * _ppb / 1000000;
+}
+
+void PTPClient::clock_step(int64_t offset_ns)
+{
+    _base += offset_ns;
+}
+
+void PTPClient::clock_rate(int32_t ppb)
+{
+    /* Re-anchor so the past keeps its timestamps and only the future
+       runs at the new rate */
+    int64_t raw = (int64_t)ticker_read_us(get_us_ticker_data()) * 1000;
+    int64_t delta = raw - _anchor;
+    _base = _base + delta + delta / 1000 * _ppb / 1000000;
+    _anchor = raw;
+    _ppb = ppb;
+}
+
+#endif
@@ -0,0 +1,150 @@
+/* SocketMultiplexer
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "netsocket/SocketMultiplexer.h"
+
+void SocketMultiplexer::mux_entry::event()
+{
+    // May be called from interrupt context, so only touch ISR-safe state
+    core_util_atomic_store_u8(&pending, 1);
+    if (mux) {
+        mux->_event_flag.set(SIGIO_FLAG);
+    }
+}
+
+SocketMultiplexer::~SocketMultiplexer()
+{
+    _lock.lock();
+    for (int i = 0; i < MBED_CONF_NSAPI_SOCKET_MUX_MAX_SOCKETS; i++) {
+        if (_entries[i].socket) {
+            _entries[i].socket->sigio(nullptr);
+            _entries[i].socket = nullptr;
+        }
+    }
+    _lock.unlock();
+}
+
+int SocketMultiplexer::find_entry(const Socket *socket) const
+{
+    for (int i = 0; i < MBED_CONF_NSAPI_SOCKET_MUX_MAX_SOCKETS; i++) {
+        if (_entries[i].socket == socket) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+nsapi_error_t SocketMultiplexer::add(Socket *socket, uint8_t events)
+{
+    if (!socket || !(events & EVENT_ALL)) {
+        return NSAPI_ERROR_PARAMETER;
+    }
+
+    _lock.lock();
+    if (find_entry(socket) >= 0) {
+        _lock.unlock();
+        return NSAPI_ERROR_PARAMETER;
+    }
+    int index = find_entry(nullptr);
+    if (index < 0) {
+        _lock.unlock();
+        return NSAPI_ERROR_NO_MEMORY;
+    }
+
+    _entries[index].interest = events;
+    _entries[index].mux = this;
+    // Report the socket once right away in case it became ready before
+    // its sigio was chained to us
+    _entries[index].pending = 1;
+    _entries[index].socket = socket;
+    socket->sigio(mbed::callback(&_entries[index], &mux_entry::event));
+    _event_flag.set(SIGIO_FLAG);
+    _lock.unlock();
+
+    return NSAPI_ERROR_OK;
+}
+
+nsapi_error_t SocketMultiplexer::modify(Socket *socket, uint8_t events)
+{
+    if (!(events & EVENT_ALL)) {
+        return NSAPI_ERROR_PARAMETER;
+    }
+
+    _lock.lock();
+    int index = find_entry(socket);
+    if (index < 0) {
+        _lock.unlock();
+        return NSAPI_ERROR_NO_SOCKET;
+    }
+    _entries[index].interest = events;
+    _lock.unlock();
+
+    return NSAPI_ERROR_OK;
+}
+
+nsapi_error_t SocketMultiplexer::remove(Socket *socket)
+{
+    _lock.lock();
+    int index = find_entry(socket);
+    if (index < 0) {
+        _lock.unlock();
+        return NSAPI_ERROR_NO_SOCKET;
+    }
+    _entries[index].socket->sigio(nullptr);
+    _entries[index].socket = nullptr;
+    _entries[index].interest = 0;
+    _entries[index].pending = 0;
+    _lock.unlock();
+
+    return NSAPI_ERROR_OK;
+}
+
+nsapi_size_or_error_t SocketMultiplexer::wait(mbed::Callback<void(Socket *, uint8_t)> handler,
+                                              uint32_t timeout)
+{
+    if (!handler) {
+        return NSAPI_ERROR_PARAMETER;
+    }
+
+    while (true) {
+        // Clear before scanning so events arriving during dispatch
+        // keep the flag set for the next round
+        _event_flag.clear(SIGIO_FLAG);
+
+        int count = 0;
+        _lock.lock();
+        for (int i = 0; i < MBED_CONF_NSAPI_SOCKET_MUX_MAX_SOCKETS; i++) {
+            if (_entries[i].socket && core_util_atomic_exchange_u8(&_entries[i].pending, 0)) {
+                // The mutex is recursive, so the handler may call
+                // remove() or modify() on this multiplexer
+                handler(_entries[i].socket, _entries[i].interest);
+                count++;
+            }
+        }
+        _lock.unlock();
+
+        if (count > 0) {
+            return count;
+        }
+
+        uint32_t flag = _event_flag.wait_any(SIGIO_FLAG, timeout);
+        if (flag & osFlagsError) {
+            // Timeout break
+            return NSAPI_ERROR_WOULD_BLOCK;
+        }
+    }
+}
@@ -121,6 +121,7 @@ void SocketStats::stats_update_sent_bytes(const Socket *const reference_id, size
     int position = get_entry_position(reference_id);
     if ((position >= 0) && ((int32_t)sent_bytes > 0)) {
         _stats[position].sent_bytes += sent_bytes;
+        _stats[position].sent_packets++;
     }
     _mutex->unlock();
 }
@@ -131,6 +132,17 @@ void SocketStats::stats_update_recv_bytes(const Socket *const reference_id, size
     int position = get_entry_position(reference_id);
     if ((position >= 0) && ((int32_t)recv_bytes > 0)) {
         _stats[position].recv_bytes += recv_bytes;
+        _stats[position].recv_packets++;
+    }
+    _mutex->unlock();
+}
+
+void SocketStats::stats_update_send_queue(const Socket *const reference_id, size_t queued)
+{
+    _mutex->lock();
+    int position = get_entry_position(reference_id);
+    if ((position >= 0) && (queued > _stats[position].send_queue_peak)) {
+        _stats[position].send_queue_peak = queued;
     }
     _mutex->unlock();
 }
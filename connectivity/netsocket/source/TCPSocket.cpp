@@ -16,15 +16,78 @@
  */
 
 #include "netsocket/TCPSocket.h"
+#include <chrono>
 #include <new>
 #include "Timer.h"
 #include "mbed_assert.h"
+#include "events/mbed_shared_queues.h"
+#include "rtos/Kernel.h"
+
+// Pacing burst selected by set_pacing(rate, 0): two typical TCP segments
+#define TCP_PACING_DEFAULT_BURST (2 * 1460)
 
 TCPSocket::TCPSocket()
 {
     _socket_stats.stats_update_proto(this, NSAPI_TCP);
 }
 
+TCPSocket::~TCPSocket()
+{
+    if (_pacing_event_id) {
+        mbed::mbed_event_queue()->cancel(_pacing_event_id);
+    }
+}
+
+nsapi_error_t TCPSocket::set_pacing(uint32_t rate_bps, uint32_t burst_bytes)
+{
+    _lock.lock();
+    _pacing_rate_bps = rate_bps;
+    _pacing_burst = burst_bytes ? burst_bytes : TCP_PACING_DEFAULT_BURST;
+    // The first burst goes out immediately
+    _pacing_tokens = _pacing_burst;
+    _pacing_last_ms = rtos::Kernel::get_ms_count();
+    _lock.unlock();
+    return NSAPI_ERROR_OK;
+}
+
+nsapi_size_t TCPSocket::pacing_admit(nsapi_size_t wanted)
+{
+    uint64_t now = rtos::Kernel::get_ms_count();
+    uint64_t refill = (now - _pacing_last_ms) * _pacing_rate_bps / 8000;
+    if (refill > 0) {
+        _pacing_last_ms = now;
+        uint64_t tokens = _pacing_tokens + refill;
+        _pacing_tokens = tokens < _pacing_burst ? (uint32_t) tokens : _pacing_burst;
+    }
+    return wanted < _pacing_tokens ? wanted : _pacing_tokens;
+}
+
+uint32_t TCPSocket::pacing_delay_ms() const
+{
+    // Waking when a whole burst has accumulated spaces bursts
+    // burst * 8 / rate apart instead of trickling single segments
+    uint32_t deficit = _pacing_burst - _pacing_tokens;
+    return (uint32_t)((uint64_t) deficit * 8000 / _pacing_rate_bps) + 1;
+}
+
+void TCPSocket::pacing_schedule_wakeup()
+{
+    if (_pacing_event_id) {
+        // Already armed
+        return;
+    }
+    auto delay = std::chrono::duration<uint32_t, std::milli>(pacing_delay_ms());
+    _pacing_event_id = mbed::mbed_event_queue()->call_in(delay, this, &TCPSocket::pacing_wakeup);
+}
+
+void TCPSocket::pacing_wakeup()
+{
+    _pacing_event_id = 0;
+    // Same path as a writability notification from the stack:
+    // WRITE_FLAG for blocked senders plus the sigio callback
+    event();
+}
+
 TCPSocket::TCPSocket(TCPSocket *parent, nsapi_socket_t socket, SocketAddress address) : TCPSocket()
 {
     _socket = socket;
@@ -124,8 +187,29 @@ nsapi_size_or_error_t TCPSocket::send(const void *data, nsapi_size_t size)
         }
 
         core_util_atomic_flag_clear(&_pending);
-        ret = _stack->socket_send(_socket, data_ptr + written, size - written);
+        nsapi_size_t chunk = size - written;
+        if (_pacing_rate_bps) {
+            chunk = pacing_admit(chunk);
+            if (chunk == 0) {
+                if (_timeout == 0) {
+                    ret = NSAPI_ERROR_WOULD_BLOCK;
+                    pacing_schedule_wakeup();
+                    break;
+                }
+                // Wait out the pacing gap; socket events wake us early,
+                // in which case the loop just re-evaluates the budget
+                uint32_t delay = pacing_delay_ms();
+                _lock.unlock();
+                _event_flag.wait_any(WRITE_FLAG, delay);
+                _lock.lock();
+                continue;
+            }
+        }
+        ret = _stack->socket_send(_socket, data_ptr + written, chunk);
         if (ret >= 0) {
+            if (_pacing_rate_bps && ret > 0) {
+                _pacing_tokens -= _pacing_tokens < (uint32_t) ret ? _pacing_tokens : (uint32_t) ret;
+            }
             written += ret;
             if (written >= size) {
                 break;
@@ -151,6 +235,135 @@ nsapi_size_or_error_t TCPSocket::send(const void *data, nsapi_size_t size)
         }
     }
 
+#if MBED_CONF_NSAPI_SOCKET_STATS_ENABLED
+    if (written > 0 && _socket) {
+        nsapi_size_or_error_t pending = _stack->socket_send_pending(_socket);
+        if (pending > 0) {
+            _socket_stats.stats_update_send_queue(this, pending);
+        }
+    }
+#endif
+
+    _writers--;
+    if (!_socket) {
+        _event_flag.set(FINISHED_FLAG);
+    }
+
+    _lock.unlock();
+    if (ret <= 0 && ret != NSAPI_ERROR_WOULD_BLOCK) {
+        return ret;
+    } else if (written == 0) {
+        return NSAPI_ERROR_WOULD_BLOCK;
+    } else {
+        _socket_stats.stats_update_sent_bytes(this, written);
+        return written;
+    }
+}
+
+void TCPSocket::send_nocopy_notify(void *arg)
+{
+    mbed::Callback<void()> *cb = static_cast<mbed::Callback<void()> *>(arg);
+    (*cb)();
+    delete cb;
+}
+
+nsapi_size_or_error_t TCPSocket::send_nocopy(const void *data, nsapi_size_t size, mbed::Callback<void()> sent_callback)
+{
+    _lock.lock();
+    const uint8_t *data_ptr = static_cast<const uint8_t *>(data);
+    nsapi_size_or_error_t ret;
+    nsapi_size_t written = 0;
+
+    // If this assert is hit then there are two threads
+    // performing a send at the same time which is undefined
+    // behavior
+    MBED_ASSERT(_writers == 0);
+    _writers++;
+
+    while (true) {
+        if (!_socket) {
+            ret = NSAPI_ERROR_NO_SOCKET;
+            break;
+        }
+
+        core_util_atomic_flag_clear(&_pending);
+        nsapi_size_t chunk = size - written;
+        if (_pacing_rate_bps) {
+            chunk = pacing_admit(chunk);
+            if (chunk == 0) {
+                if (_timeout == 0) {
+                    ret = NSAPI_ERROR_WOULD_BLOCK;
+                    pacing_schedule_wakeup();
+                    break;
+                }
+                // Wait out the pacing gap; socket events wake us early,
+                // in which case the loop just re-evaluates the budget
+                uint32_t delay = pacing_delay_ms();
+                _lock.unlock();
+                _event_flag.wait_any(WRITE_FLAG, delay);
+                _lock.lock();
+                continue;
+            }
+        }
+        ret = _stack->socket_send_nocopy(_socket, data_ptr + written, chunk);
+        if (ret >= 0) {
+            if (_pacing_rate_bps && ret > 0) {
+                _pacing_tokens -= _pacing_tokens < (uint32_t) ret ? _pacing_tokens : (uint32_t) ret;
+            }
+            written += ret;
+            if (written >= size) {
+                break;
+            }
+        }
+        if (_timeout == 0) {
+            break;
+        } else if (ret == NSAPI_ERROR_WOULD_BLOCK) {
+            uint32_t flag;
+
+            // Release lock before blocking so other threads
+            // accessing this object aren't blocked
+            _lock.unlock();
+            flag = _event_flag.wait_any(WRITE_FLAG, _timeout);
+            _lock.lock();
+
+            if (flag & osFlagsError) {
+                // Timeout break
+                break;
+            }
+        } else if (ret < 0) {
+            break;
+        }
+    }
+
+#if MBED_CONF_NSAPI_SOCKET_STATS_ENABLED
+    if (written > 0 && _socket) {
+        nsapi_size_or_error_t pending = _stack->socket_send_pending(_socket);
+        if (pending > 0) {
+            _socket_stats.stats_update_send_queue(this, pending);
+        }
+    }
+#endif
+
+    // Register the notification while the lock is still held so the
+    // acknowledgement watermark covers exactly the bytes this call enqueued
+    if (written > 0 && sent_callback) {
+        if (!_socket) {
+            // Socket was closed while sending; the close already dropped the
+            // stack's references to the buffer, so no callback is needed
+            ret = NSAPI_ERROR_NO_SOCKET;
+            written = 0;
+        } else {
+            mbed::Callback<void()> *cb = new (std::nothrow) mbed::Callback<void()>(sent_callback);
+            nsapi_error_t err = cb ? _stack->socket_notify_sent(_socket, &TCPSocket::send_nocopy_notify, cb)
+                               : NSAPI_ERROR_NO_MEMORY;
+            if (err != NSAPI_ERROR_OK) {
+                delete cb;
+                ret = err;
+                written = 0;
+            }
+        }
+    }
+
     _writers--;
     if (!_socket) {
         _event_flag.set(FINISHED_FLAG);
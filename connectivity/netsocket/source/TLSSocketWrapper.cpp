@@ -25,6 +25,7 @@
 #include "mbed-trace/mbed_trace.h"
 #include "mbedtls/debug.h"
 #include "mbedtls/platform.h"
+#include "handshake_pool.h"
 #include "mbed_error.h"
 #include "rtos/Kernel.h"
 
@@ -35,6 +36,62 @@
 // This class requires Mbed TLS SSL/TLS client code
 #if defined(MBEDTLS_SSL_CLI_C)
 
+#if (MBED_CONF_TLS_SOCKET_SESSION_CACHE_SIZE > 0) && defined(MBEDTLS_X509_CRT_PARSE_C) && !defined(MBEDTLS_X509_REMOVE_HOSTNAME_VERIFICATION)
+
+#include "PlatformMutex.h"
+#include "SingletonPtr.h"
+
+// Set to 1 to additionally persist cached sessions to KVStore so abbreviated
+// handshakes survive reboots and deep sleep cycles that lose RAM.
+#ifndef MBED_CONF_TLS_SOCKET_SESSION_CACHE_USE_KVSTORE
+#define MBED_CONF_TLS_SOCKET_SESSION_CACHE_USE_KVSTORE 0
+#endif
+
+#if MBED_CONF_TLS_SOCKET_SESSION_CACHE_USE_KVSTORE == 1
+#include "kvstore_global_api.h"
+#include "kv_config.h"
+
+// Persisted sessions are stored under <prefix><hostname>
+#ifndef MBED_CONF_TLS_SOCKET_SESSION_CACHE_KV_PREFIX
+#define MBED_CONF_TLS_SOCKET_SESSION_CACHE_KV_PREFIX "/kv/tlssess_"
+#endif
+#endif
+
+// In-memory cache of serialized TLS sessions, keyed by hostname
+struct TLS_SESSION_CACHE {
+    char *hostname;
+    unsigned char *session;
+    size_t session_len;
+};
+
+static TLS_SESSION_CACHE *tls_session_cache[MBED_CONF_TLS_SOCKET_SESSION_CACHE_SIZE];
+static int tls_session_cache_victim = 0;
+static SingletonPtr<PlatformMutex> tls_session_cache_mutex;
+
+#endif /* session cache */
+
+#if (MBED_CONF_TLS_SOCKET_VERIFY_CHAIN_CACHE_SIZE > 0) && defined(MBEDTLS_X509_CRT_PARSE_C) && defined(MBEDTLS_SHA256_C) && !defined(MBEDTLS_X509_REMOVE_HOSTNAME_VERIFICATION)
+
+#include "PlatformMutex.h"
+#include "SingletonPtr.h"
+#include "mbedtls/sha256.h"
+#include "mbedtls/x509_crt.h"
+
+// Digests of certificate chains that already passed full verification.
+// The digest covers the hostname, the presented chain and the CA set, so
+// a hit guarantees the exact same verification would succeed again.
+struct TLS_VERIFIED_CHAIN {
+    unsigned char digest[32];
+    uint64_t expiry_ms;
+    bool valid;
+};
+
+static TLS_VERIFIED_CHAIN tls_verified_chains[MBED_CONF_TLS_SOCKET_VERIFY_CHAIN_CACHE_SIZE];
+static int tls_verified_chain_victim = 0;
+static SingletonPtr<PlatformMutex> tls_verified_chain_mutex;
+
+#endif /* verified-chain cache */
+
 TLSSocketWrapper::TLSSocketWrapper(Socket *transport, const char *hostname, control_transport control) :
     _transport(transport),
     _connect_transport(control == TRANSPORT_CONNECT || control == TRANSPORT_CONNECT_AND_CLOSE),
@@ -45,6 +102,9 @@ TLSSocketWrapper::TLSSocketWrapper(Socket *transport, const char *hostname, cont
     _clicert_allocated(false),
     _ssl_conf_allocated(false)
 {
+    // No-op unless mbedtls-handshake-pool-size is set; must precede any
+    // mbedtls allocation made on behalf of this socket.
+    mbedtls_handshake_pool_attach();
 #if defined(MBEDTLS_USE_PSA_CRYPTO)
     // It is safe to call psa_crypto_init() any number of times as
     // defined by the PSA Crypto API. There is no standard "deinit"
@@ -90,9 +150,13 @@ TLSSocketWrapper::~TLSSocketWrapper()
     set_ca_chain(nullptr);
 #endif
     set_ssl_config(nullptr);
+#if MBED_CONF_TLS_SOCKET_SEND_BUFFER_SIZE > 0
+    delete[] _send_buf;
+#endif
 #if defined(MBEDTLS_PLATFORM_C)
     mbedtls_platform_teardown(nullptr);
 #endif /* MBEDTLS_PLATFORM_C */
+    mbedtls_handshake_pool_detach();
 }
 
 void TLSSocketWrapper::set_hostname(const char *hostname)
@@ -177,7 +241,7 @@ nsapi_error_t TLSSocketWrapper::set_client_cert_key(const void *client_cert, siz
 }
 
 
-nsapi_error_t TLSSocketWrapper::start_handshake(bool first_call)
+nsapi_error_t TLSSocketWrapper::init_tls_context()
 {
     const char DRBG_PERS[] = "mbed TLS client";
     int ret;
@@ -187,13 +251,13 @@ nsapi_error_t TLSSocketWrapper::start_handshake(bool first_call)
     }
 
     if (_tls_initialized) {
-        return continue_handshake();
+        return NSAPI_ERROR_OK;
     }
 
 #if defined(MBEDTLS_X509_CRT_PARSE_C) && !defined(MBEDTLS_X509_REMOVE_HOSTNAME_VERIFICATION)
-    tr_info("Starting TLS handshake with %s", _ssl.hostname);
+    tr_info("Initializing TLS context for %s", _ssl.hostname);
 #else
-    tr_info("Starting TLS handshake");
+    tr_info("Initializing TLS context");
 #endif
     /*
      * Initialize TLS-related stuf.
@@ -234,6 +298,10 @@ nsapi_error_t TLSSocketWrapper::start_handshake(bool first_call)
         return NSAPI_ERROR_AUTH_FAILURE;
     }
 
+#if (MBED_CONF_TLS_SOCKET_SESSION_CACHE_SIZE > 0) && defined(MBEDTLS_X509_CRT_PARSE_C) && !defined(MBEDTLS_X509_REMOVE_HOSTNAME_VERIFICATION)
+    restore_session();
+#endif
+
     _transport->set_blocking(false);
     _transport->sigio(mbed::callback(this, &TLSSocketWrapper::event));
 
@@ -248,6 +316,22 @@ nsapi_error_t TLSSocketWrapper::start_handshake(bool first_call)
 
     _tls_initialized = true;
 
+    return NSAPI_ERROR_OK;
+}
+
+nsapi_error_t TLSSocketWrapper::start_handshake(bool first_call)
+{
+    nsapi_error_t ret;
+
+    if (_tls_initialized) {
+        return continue_handshake();
+    }
+
+    ret = init_tls_context();
+    if (ret != NSAPI_ERROR_OK) {
+        return ret;
+    }
+
     ret = continue_handshake();
     if (first_call) {
         if (ret == NSAPI_ERROR_ALREADY) {
@@ -325,20 +409,96 @@ nsapi_error_t TLSSocketWrapper::continue_handshake()
     delete[] buf;
 #endif
 
+#if (MBED_CONF_TLS_SOCKET_VERIFY_CHAIN_CACHE_SIZE > 0) && defined(MBEDTLS_X509_CRT_PARSE_C) && defined(MBEDTLS_SHA256_C) && !defined(MBEDTLS_X509_REMOVE_HOSTNAME_VERIFICATION)
+    if (_ssl_conf_allocated) {
+        nsapi_error_t verify_error = verify_peer_chain();
+        if (verify_error != NSAPI_ERROR_OK) {
+            return verify_error;
+        }
+    }
+#endif
+
+#if (MBED_CONF_TLS_SOCKET_SESSION_CACHE_SIZE > 0) && defined(MBEDTLS_X509_CRT_PARSE_C) && !defined(MBEDTLS_X509_REMOVE_HOSTNAME_VERIFICATION)
+    store_session();
+#endif
+
     _handshake_completed = true;
     return NSAPI_ERROR_IS_CONNECTED;
 }
 
+#if (MBED_CONF_TLS_SOCKET_VERIFY_CHAIN_CACHE_SIZE > 0) && defined(MBEDTLS_X509_CRT_PARSE_C) && defined(MBEDTLS_SHA256_C) && !defined(MBEDTLS_X509_REMOVE_HOSTNAME_VERIFICATION)
 
-nsapi_error_t TLSSocketWrapper::send(const void *data, nsapi_size_t size)
+nsapi_error_t TLSSocketWrapper::verify_peer_chain()
 {
-    int ret;
+    const mbedtls_x509_crt *peer = mbedtls_ssl_get_peer_cert(&_ssl);
+    if (!peer) {
+        tr_error("Server presented no certificate");
+        return NSAPI_ERROR_AUTH_FAILURE;
+    }
 
-    if (!_transport) {
-        return NSAPI_ERROR_NO_SOCKET;
+    /* Digesting a few kilobytes of DER is orders of magnitude cheaper
+     * than re-running the chain's signature checks. A failed digest
+     * just misses the cache and falls through to full verification. */
+    unsigned char digest[32];
+    mbedtls_sha256_context sha;
+    mbedtls_sha256_init(&sha);
+    mbedtls_sha256_starts_ret(&sha, 0);
+    if (_ssl.hostname) {
+        mbedtls_sha256_update_ret(&sha, (const unsigned char *) _ssl.hostname,
+                                  strlen(_ssl.hostname) + 1);
+    }
+    for (const mbedtls_x509_crt *crt = peer; crt; crt = crt->next) {
+        mbedtls_sha256_update_ret(&sha, crt->raw.p, crt->raw.len);
+    }
+    for (const mbedtls_x509_crt *crt = _cacert; crt; crt = crt->next) {
+        mbedtls_sha256_update_ret(&sha, crt->raw.p, crt->raw.len);
+    }
+    mbedtls_sha256_finish_ret(&sha, digest);
+    mbedtls_sha256_free(&sha);
+
+    uint64_t now_ms = rtos::Kernel::get_ms_count();
+
+    tls_verified_chain_mutex->lock();
+    for (int i = 0; i < MBED_CONF_TLS_SOCKET_VERIFY_CHAIN_CACHE_SIZE; i++) {
+        if (tls_verified_chains[i].valid &&
+                tls_verified_chains[i].expiry_ms > now_ms &&
+                memcmp(tls_verified_chains[i].digest, digest, sizeof(digest)) == 0) {
+            tls_verified_chain_mutex->unlock();
+            tr_info("Certificate chain already verified, skipping");
+            return NSAPI_ERROR_OK;
+        }
+    }
+    tls_verified_chain_mutex->unlock();
+
+    uint32_t flags = 0;
+    int ret = mbedtls_x509_crt_verify(const_cast<mbedtls_x509_crt *>(peer),
+                                      _cacert, nullptr, _ssl.hostname, &flags,
+                                      nullptr, nullptr);
+    if (ret != 0 || flags != 0) {
+        print_mbedtls_error("mbedtls_x509_crt_verify", ret);
+        tr_error("Certificate verification failed (flags 0x%08" PRIx32 ")", flags);
+        return NSAPI_ERROR_AUTH_FAILURE;
     }
+    tr_info("Certificate verification passed");
+
+    tls_verified_chain_mutex->lock();
+    TLS_VERIFIED_CHAIN *slot = &tls_verified_chains[tls_verified_chain_victim];
+    tls_verified_chain_victim = (tls_verified_chain_victim + 1) % MBED_CONF_TLS_SOCKET_VERIFY_CHAIN_CACHE_SIZE;
+    memcpy(slot->digest, digest, sizeof(slot->digest));
+    slot->expiry_ms = now_ms + (uint64_t) MBED_CONF_TLS_SOCKET_VERIFY_CHAIN_CACHE_TTL * 1000;
+    slot->valid = true;
+    tls_verified_chain_mutex->unlock();
+
+    return NSAPI_ERROR_OK;
+}
+
+#endif /* verified-chain cache */
+
+
+nsapi_size_or_error_t TLSSocketWrapper::write_record(const unsigned char *data, size_t size)
+{
+    int ret;
 
-    tr_debug("send %d", size);
     while (true) {
         if (!_handshake_completed) {
             ret = continue_handshake();
@@ -350,7 +510,7 @@ nsapi_error_t TLSSocketWrapper::send(const void *data, nsapi_size_t size)
             }
         }
 
-        ret = mbedtls_ssl_write(&_ssl, (const unsigned char *) data, size);
+        ret = mbedtls_ssl_write(&_ssl, data, size);
 
         if (_timeout == 0) {
             break;
@@ -379,6 +539,79 @@ nsapi_error_t TLSSocketWrapper::send(const void *data, nsapi_size_t size)
     return ret; // Assume "non negative errorcode" to be propagated from Socket layer
 }
 
+#if MBED_CONF_TLS_SOCKET_SEND_BUFFER_SIZE > 0
+
+nsapi_error_t TLSSocketWrapper::flush()
+{
+    if (!_transport) {
+        return NSAPI_ERROR_NO_SOCKET;
+    }
+
+    while (_send_buf_len > 0) {
+        nsapi_size_or_error_t ret = write_record(_send_buf, _send_buf_len);
+        if (ret < 0) {
+            // Error or WOULD_BLOCK - the data stays buffered
+            return ret;
+        }
+        if (ret == 0) {
+            return NSAPI_ERROR_WOULD_BLOCK;
+        }
+        _send_buf_len -= ret;
+        memmove(_send_buf, _send_buf + ret, _send_buf_len);
+    }
+    return NSAPI_ERROR_OK;
+}
+
+#endif /* MBED_CONF_TLS_SOCKET_SEND_BUFFER_SIZE */
+
+nsapi_error_t TLSSocketWrapper::send(const void *data, nsapi_size_t size)
+{
+    if (!_transport) {
+        return NSAPI_ERROR_NO_SOCKET;
+    }
+
+    tr_debug("send %d", size);
+
+#if MBED_CONF_TLS_SOCKET_SEND_BUFFER_SIZE > 0
+    // Coalescing only applies to stream transport - merging datagram
+    // payloads would break message boundaries
+    if (_ssl_conf && _ssl_conf->transport == MBEDTLS_SSL_TRANSPORT_STREAM) {
+        if (size > 0 && size < MBED_CONF_TLS_SOCKET_SEND_BUFFER_SIZE) {
+            if (!_send_buf) {
+                _send_buf = new (std::nothrow) uint8_t[MBED_CONF_TLS_SOCKET_SEND_BUFFER_SIZE];
+            }
+            if (_send_buf) {
+                if (_send_buf_len + size > MBED_CONF_TLS_SOCKET_SEND_BUFFER_SIZE) {
+                    nsapi_error_t err = flush();
+                    if (err != NSAPI_ERROR_OK) {
+                        return err;
+                    }
+                }
+                memcpy(_send_buf + _send_buf_len, data, size);
+                _send_buf_len += size;
+                if (_send_buf_len >= MBED_CONF_TLS_SOCKET_SEND_FLUSH_WATERMARK) {
+                    // Best effort - the bytes are already accepted, so a
+                    // blocked flush is retried on the next send, recv,
+                    // flush or close
+                    flush();
+                }
+                return size;
+            }
+            // Buffer allocation failed - fall through to a direct write
+        }
+        if (_send_buf_len > 0) {
+            // Keep byte order: buffered small writes go out first
+            nsapi_error_t err = flush();
+            if (err != NSAPI_ERROR_OK) {
+                return err;
+            }
+        }
+    }
+#endif
+
+    return write_record(static_cast<const unsigned char *>(data), size);
+}
+
 nsapi_size_or_error_t TLSSocketWrapper::sendto(const SocketAddress &, const void *data, nsapi_size_t size)
 {
     // Ignore the SocketAddress
@@ -393,6 +626,17 @@ nsapi_size_or_error_t TLSSocketWrapper::recv(void *data, nsapi_size_t size)
         return NSAPI_ERROR_NO_SOCKET;
     }
 
+#if MBED_CONF_TLS_SOCKET_SEND_BUFFER_SIZE > 0
+    if (_send_buf_len > 0) {
+        // Request/response pattern: push out buffered writes before
+        // waiting for the reply
+        nsapi_error_t err = flush();
+        if (err != NSAPI_ERROR_OK && err != NSAPI_ERROR_WOULD_BLOCK) {
+            return err;
+        }
+    }
+#endif
+
     while (true) {
         if (!_handshake_completed) {
             ret = continue_handshake();
@@ -609,7 +853,21 @@ mbedtls_ssl_config *TLSSocketWrapper::get_ssl_config()
         /* It is possible to disable authentication by passing
          * MBEDTLS_SSL_VERIFY_NONE in the call to mbedtls_ssl_conf_authmode()
          */
+#if (MBED_CONF_TLS_SOCKET_VERIFY_CHAIN_CACHE_SIZE > 0) && defined(MBEDTLS_X509_CRT_PARSE_C) && defined(MBEDTLS_SHA256_C) && !defined(MBEDTLS_X509_REMOVE_HOSTNAME_VERIFICATION)
+        /* Verification is run (or skipped on a cache hit) by
+         * verify_peer_chain() once the handshake completes; required
+         * authentication is still enforced there. */
+        mbedtls_ssl_conf_authmode(get_ssl_config(), MBEDTLS_SSL_VERIFY_NONE);
+#else
         mbedtls_ssl_conf_authmode(get_ssl_config(), MBEDTLS_SSL_VERIFY_REQUIRED);
+#endif
+#if (MBED_CONF_TLS_SOCKET_MAX_FRAG_LEN > 0) && defined(MBEDTLS_SSL_MAX_FRAGMENT_LENGTH)
+        /* Offer RFC 6066 Maximum Fragment Length so records fit the link
+         * MTU; the configured code maps 1..4 to 512..4096 bytes */
+        if ((ret = mbedtls_ssl_conf_max_frag_len(_ssl_conf, MBED_CONF_TLS_SOCKET_MAX_FRAG_LEN)) != 0) {
+            print_mbedtls_error("mbedtls_ssl_conf_max_frag_len", ret);
+        }
+#endif
     }
     return _ssl_conf;
 }
@@ -640,6 +898,9 @@ nsapi_error_t TLSSocketWrapper::close()
     int ret = 0;
     if (_handshake_completed) {
         _transport->set_blocking(true);
+#if MBED_CONF_TLS_SOCKET_SEND_BUFFER_SIZE > 0
+        flush();
+#endif
         ret = mbedtls_ssl_close_notify(&_ssl);
         if (ret) {
             print_mbedtls_error("mbedtls_ssl_close_notify", ret);
@@ -749,6 +1010,11 @@ bool TLSSocketWrapper::is_handshake_started() const
     return _tls_initialized;
 }
 
+void TLSSocketWrapper::set_handshake_completed(bool completed)
+{
+    _handshake_completed = completed;
+}
+
 
 nsapi_error_t TLSSocketWrapper::getpeername(SocketAddress *address)
 {
@@ -758,4 +1024,144 @@ nsapi_error_t TLSSocketWrapper::getpeername(SocketAddress *address)
     return _transport->getpeername(address);
 }
 
+#if (MBED_CONF_TLS_SOCKET_SESSION_CACHE_SIZE > 0) && defined(MBEDTLS_X509_CRT_PARSE_C) && !defined(MBEDTLS_X509_REMOVE_HOSTNAME_VERIFICATION)
+
+void TLSSocketWrapper::restore_session()
+{
+    if (!_ssl.hostname) {
+        return;
+    }
+
+    int ret = -1;
+    mbedtls_ssl_session session;
+    mbedtls_ssl_session_init(&session);
+
+    tls_session_cache_mutex->lock();
+    for (int i = 0; i < MBED_CONF_TLS_SOCKET_SESSION_CACHE_SIZE; i++) {
+        if (tls_session_cache[i] && strcmp(tls_session_cache[i]->hostname, _ssl.hostname) == 0) {
+            ret = mbedtls_ssl_session_load(&session, tls_session_cache[i]->session,
+                                           tls_session_cache[i]->session_len);
+            if (ret != 0) {
+                // Entry is unusable, drop it so it is not offered again
+                delete[] tls_session_cache[i]->hostname;
+                delete[] tls_session_cache[i]->session;
+                delete tls_session_cache[i];
+                tls_session_cache[i] = NULL;
+            }
+            break;
+        }
+    }
+    tls_session_cache_mutex->unlock();
+
+#if MBED_CONF_TLS_SOCKET_SESSION_CACHE_USE_KVSTORE == 1
+    if (ret != 0) {
+        char key[KV_MAX_KEY_LENGTH];
+        kv_info_t info;
+        int len = snprintf(key, sizeof(key), MBED_CONF_TLS_SOCKET_SESSION_CACHE_KV_PREFIX "%s", _ssl.hostname);
+        if (len > 0 && len < (int) sizeof(key) && kv_get_info(key, &info) == MBED_SUCCESS) {
+            unsigned char *blob = new (std::nothrow) unsigned char[info.size];
+            if (blob) {
+                size_t actual_size = 0;
+                if (kv_get(key, blob, info.size, &actual_size) == MBED_SUCCESS) {
+                    ret = mbedtls_ssl_session_load(&session, blob, actual_size);
+                }
+                if (ret != 0) {
+                    // Stale or corrupt blob, remove it so it is not retried
+                    kv_remove(key);
+                }
+                delete[] blob;
+            }
+        }
+    }
+#endif
+
+    if (ret == 0) {
+        ret = mbedtls_ssl_set_session(&_ssl, &session);
+        if (ret != 0) {
+            print_mbedtls_error("mbedtls_ssl_set_session", ret);
+        } else {
+            tr_info("Resuming TLS session with %s", _ssl.hostname);
+        }
+    }
+    mbedtls_ssl_session_free(&session);
+}
+
+void TLSSocketWrapper::store_session()
+{
+    if (!_ssl.hostname) {
+        return;
+    }
+
+    const mbedtls_ssl_session *current = mbedtls_ssl_get_session_pointer(&_ssl);
+    if (!current) {
+        return;
+    }
+
+    size_t session_len = 0;
+    mbedtls_ssl_session_save(current, nullptr, 0, &session_len); // Queries the needed size
+    unsigned char *session = new (std::nothrow) unsigned char[session_len];
+    if (!session) {
+        return;
+    }
+    int ret = mbedtls_ssl_session_save(current, session, session_len, &session_len);
+    if (ret != 0) {
+        print_mbedtls_error("mbedtls_ssl_session_save", ret);
+        delete[] session;
+        return;
+    }
+
+    char *hostname = new (std::nothrow) char[strlen(_ssl.hostname) + 1];
+    if (!hostname) {
+        delete[] session;
+        return;
+    }
+    strcpy(hostname, _ssl.hostname);
+
+#if MBED_CONF_TLS_SOCKET_SESSION_CACHE_USE_KVSTORE == 1
+    char key[KV_MAX_KEY_LENGTH];
+    int len = snprintf(key, sizeof(key), MBED_CONF_TLS_SOCKET_SESSION_CACHE_KV_PREFIX "%s", _ssl.hostname);
+    if (len > 0 && len < (int) sizeof(key)) {
+        kv_set(key, session, session_len, 0);
+    }
+#endif
+
+    tls_session_cache_mutex->lock();
+    int index = -1;
+    for (int i = 0; i < MBED_CONF_TLS_SOCKET_SESSION_CACHE_SIZE; i++) {
+        if (tls_session_cache[i]) {
+            if (strcmp(tls_session_cache[i]->hostname, hostname) == 0) {
+                index = i;
+                break;
+            }
+        } else if (index < 0) {
+            index = i;
+        }
+    }
+    if (index < 0) {
+        // All slots hold other hosts, replace them in rotation
+        index = tls_session_cache_victim;
+        tls_session_cache_victim = (tls_session_cache_victim + 1) % MBED_CONF_TLS_SOCKET_SESSION_CACHE_SIZE;
+    }
+
+    if (!tls_session_cache[index]) {
+        tls_session_cache[index] = new (std::nothrow) TLS_SESSION_CACHE;
+        if (!tls_session_cache[index]) {
+            tls_session_cache_mutex->unlock();
+            delete[] hostname;
+            delete[] session;
+            return;
+        }
+    } else {
+        delete[] tls_session_cache[index]->hostname;
+        delete[] tls_session_cache[index]->session;
+    }
+
+    tls_session_cache[index]->hostname = hostname;
+    tls_session_cache[index]->session = session;
+    tls_session_cache[index]->session_len = session_len;
+    tls_session_cache_mutex->unlock();
+}
+
+#endif /* session cache */
+
 #endif /* MBEDTLS_SSL_CLI_C */
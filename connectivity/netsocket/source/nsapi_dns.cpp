@@ -52,12 +52,28 @@ using rtos::Kernel::Clock;
 #define MIN(a, b) ((a) < (b) ? (a) : (b))
 #endif
 
+// Negative DNS responses are cached for this many seconds, so failing
+// lookups do not pay the full round-trip and retry timeouts on every
+// attempt; 0 disables negative caching
+#ifndef MBED_CONF_NSAPI_DNS_CACHE_NEGATIVE_TTL
+#define MBED_CONF_NSAPI_DNS_CACHE_NEGATIVE_TTL 60
+#endif
+
+// When a cache hit has less than this many seconds of time to live left, a
+// background query is started to refresh the entry before it expires, so
+// hot lookups never block on the network; 0 disables refreshing
+#ifndef MBED_CONF_NSAPI_DNS_CACHE_REFRESH_MARGIN
+#define MBED_CONF_NSAPI_DNS_CACHE_REFRESH_MARGIN 0
+#endif
+
 struct DNS_CACHE {
     nsapi_addr_t *address;
     char *host;
     Clock::time_point expires;      /*!< time to live in milliseconds */
     Clock::time_point accessed;     /*!< last accessed */
-    uint8_t count;                  /*!< number of IP addresses */
+    uint8_t count;                  /*!< number of IP addresses, 0 for a negative entry */
+    nsapi_error_t status;           /*!< NSAPI_ERROR_OK, or the cached negative result */
+    bool refreshing;                /*!< background refresh query in flight */
 };
 
 struct SOCKET_CB_DATA {
@@ -97,9 +113,15 @@ struct DNS_QUERY {
 };
 
 static void nsapi_dns_cache_add(const char *host, nsapi_addr_t *address, duration<uint32_t> ttl, uint8_t count);
+static void nsapi_dns_cache_add_negative(const char *host, nsapi_version_t version);
+static void nsapi_dns_cache_refresh(NetworkStack *stack, const char *host, const char *interface_name, nsapi_version_t version);
 static nsapi_size_or_error_t nsapi_dns_cache_find(const char *host, nsapi_version_t version, nsapi_addr_t *address);
 static void nsapi_dns_cache_reset();
 
+static nsapi_value_or_error_t nsapi_dns_query_multiple_async_internal(NetworkStack *stack, const char *host,
+                                                                      NetworkStack::hostbyname_cb_t callback, nsapi_size_t addr_count,
+                                                                      call_in_callback_cb_t call_in_cb, const char *interface_name, nsapi_version_t version);
+
 static nsapi_error_t nsapi_dns_get_server_addr(NetworkStack *stack, uint8_t *index, uint8_t *total_attempts, uint8_t *send_success, SocketAddress *dns_addr, const char *interface_name);
 
 static void nsapi_dns_query_async_create(void *ptr);
@@ -327,35 +349,42 @@ static int dns_scan_response(const uint8_t *ptr, uint16_t exp_id, duration<uint3
     return count;
 }
 
-static void nsapi_dns_cache_add(const char *host, nsapi_addr_t *address, duration<uint32_t> ttl, uint8_t count)
-{
 #if (MBED_CONF_NSAPI_DNS_CACHE_SIZE > 0)
+static void nsapi_dns_cache_put(const char *host, nsapi_addr_t *address, duration<uint32_t> ttl, uint8_t count, nsapi_error_t status)
+{
     // RFC 1034: if TTL is zero, entry is not added to cache
     if (ttl == ttl.zero()) {
         return;
     }
 
-    // Checks if already cached
-    if (nsapi_dns_cache_find(host, address->version, NULL) == NSAPI_ERROR_OK) {
-        return;
-    }
-
     dns_cache_mutex->lock();
 
     int index = -1;
+    int lru = -1;
     Clock::time_point accessed = Clock::time_point::max();
 
-    // Finds free or last accessed entry
+    // Finds the existing entry for the host, otherwise a free or the
+    // least recently accessed entry
     for (int i = 0; i < MBED_CONF_NSAPI_DNS_CACHE_SIZE; i++) {
         if (!dns_cache[i]) {
+            if (index < 0) {
+                index = i;
+            }
+        } else if (dns_cache[i]->address[0].version == address->version &&
+                   strcmp(dns_cache[i]->host, host) == 0) {
+            // Existing entry for the host, update in place
             index = i;
             break;
         } else if (dns_cache[i]->accessed <= accessed) {
             accessed = dns_cache[i]->accessed;
-            index = i;
+            lru = i;
         }
     }
 
+    if (index < 0) {
+        index = lru;
+    }
+
     if (index < 0) {
         dns_cache_mutex->unlock();
         return;
@@ -365,16 +394,22 @@ static void nsapi_dns_cache_add(const char *host, nsapi_addr_t *address, duratio
     if (!dns_cache[index]) {
         dns_cache[index] = new (std::nothrow) DNS_CACHE;
     } else {
-        delete dns_cache[index]->host;
-        delete dns_cache[index]->address;
+        delete[] dns_cache[index]->host;
+        delete[] dns_cache[index]->address;
     }
 
     if (dns_cache[index]) {
-        dns_cache[index]->address = new (std::nothrow) nsapi_addr_t[count];
-        for (int i = 0; i < count; i++) {
+        // Allocate at least one address so the version of a negative entry
+        // can be matched on lookup
+        uint8_t alloc_count = (count > 0) ? count : 1;
+        dns_cache[index]->address = new (std::nothrow) nsapi_addr_t[alloc_count];
+        dns_cache[index]->address[0] = address[0];
+        for (int i = 1; i < count; i++) {
             dns_cache[index]->address[i] = address[i];
         }
         dns_cache[index]->count = count;
+        dns_cache[index]->status = status;
+        dns_cache[index]->refreshing = false;
         dns_cache[index]->host = new (std::nothrow) char[strlen(host) + 1];
         strcpy(dns_cache[index]->host, host);
         auto now = Clock::now();
@@ -383,6 +418,25 @@ static void nsapi_dns_cache_add(const char *host, nsapi_addr_t *address, duratio
     }
 
     dns_cache_mutex->unlock();
+}
+#endif
+
+static void nsapi_dns_cache_add(const char *host, nsapi_addr_t *address, duration<uint32_t> ttl, uint8_t count)
+{
+#if (MBED_CONF_NSAPI_DNS_CACHE_SIZE > 0)
+    nsapi_dns_cache_put(host, address, ttl, count, NSAPI_ERROR_OK);
+#endif
+}
+
+static void nsapi_dns_cache_add_negative(const char *host, nsapi_version_t version)
+{
+#if (MBED_CONF_NSAPI_DNS_CACHE_SIZE > 0) && (MBED_CONF_NSAPI_DNS_CACHE_NEGATIVE_TTL > 0)
+    // A negative entry carries no addresses, only the version to match on
+    // lookup and the cached failure status
+    nsapi_addr_t address;
+    memset(&address, 0, sizeof(address));
+    address.version = version;
+    nsapi_dns_cache_put(host, &address, duration<uint32_t>(MBED_CONF_NSAPI_DNS_CACHE_NEGATIVE_TTL), 0, NSAPI_ERROR_DNS_FAILURE);
 #endif
 }
 
@@ -398,13 +452,16 @@ static nsapi_size_or_error_t nsapi_dns_cache_find(const char *host, nsapi_versio
             auto now = Clock::now();
             // Checks all entries for expired entries
             if (now > dns_cache[i]->expires) {
-                delete dns_cache[i]->host;
-                delete dns_cache[i]->address;
+                delete[] dns_cache[i]->host;
+                delete[] dns_cache[i]->address;
                 delete dns_cache[i];
                 dns_cache[i] = NULL;
             } else if ((version == NSAPI_UNSPEC || version == dns_cache[i]->address[0].version) && //only first IP address version check, others have the same version
                        strcmp(dns_cache[i]->host, host) == 0) {
-                if (address) {
+                if (dns_cache[i]->status != NSAPI_ERROR_OK) {
+                    // Cached negative response, the failure is still valid
+                    ret_val = dns_cache[i]->status;
+                } else if (address) {
                     ret_val = 0;
                     for (int count = 0; count < dns_cache[i]->count; count++) {
                         address[count] = dns_cache[i]->address[count];
@@ -440,6 +497,64 @@ static void nsapi_dns_cache_reset()
 #endif
 }
 
+#if (MBED_CONF_NSAPI_DNS_CACHE_SIZE > 0) && (MBED_CONF_NSAPI_DNS_CACHE_REFRESH_MARGIN > 0)
+static void nsapi_dns_cache_refresh_cb(nsapi_error_t result, SocketAddress *address)
+{
+    // The refresh result lands in the cache via nsapi_dns_cache_add,
+    // there is nothing to deliver to a caller
+}
+
+static nsapi_error_t nsapi_dns_cache_refresh_call_in(int delay, mbed::Callback<void()> func)
+{
+    events::EventQueue *event_queue = mbed::mbed_event_queue();
+    if (!event_queue || event_queue->call_in(milliseconds(delay), func) == 0) {
+        return NSAPI_ERROR_NO_MEMORY;
+    }
+    return NSAPI_ERROR_OK;
+}
+#endif
+
+static void nsapi_dns_cache_refresh(NetworkStack *stack, const char *host, const char *interface_name, nsapi_version_t version)
+{
+#if (MBED_CONF_NSAPI_DNS_CACHE_SIZE > 0) && (MBED_CONF_NSAPI_DNS_CACHE_REFRESH_MARGIN > 0)
+    // The refresh query would store the interface name pointer beyond the
+    // caller's lifetime, so only default-interface lookups are refreshed
+    if (interface_name) {
+        return;
+    }
+
+    bool refresh = false;
+
+    dns_cache_mutex->lock();
+    auto now = Clock::now();
+    for (int i = 0; i < MBED_CONF_NSAPI_DNS_CACHE_SIZE; i++) {
+        if (dns_cache[i] && dns_cache[i]->status == NSAPI_ERROR_OK &&
+                (version == NSAPI_UNSPEC || version == dns_cache[i]->address[0].version) &&
+                strcmp(dns_cache[i]->host, host) == 0) {
+            if (!dns_cache[i]->refreshing && now <= dns_cache[i]->expires &&
+                    dns_cache[i]->expires - now < duration<uint32_t>(MBED_CONF_NSAPI_DNS_CACHE_REFRESH_MARGIN)) {
+                // The flag stays set until the refresh result replaces the
+                // entry or the entry expires, so at most one refresh query
+                // is in flight per entry
+                dns_cache[i]->refreshing = true;
+                refresh = true;
+            }
+            break;
+        }
+    }
+    dns_cache_mutex->unlock();
+
+    if (refresh) {
+        dns_mutex->lock();
+        // Goes directly to the internal entry point, so the still-valid
+        // entry being refreshed does not short-circuit the query
+        nsapi_dns_query_multiple_async_internal(stack, host, mbed::callback(nsapi_dns_cache_refresh_cb),
+                                                MBED_CONF_NSAPI_DNS_ADDRESSES_LIMIT,
+                                                mbed::callback(nsapi_dns_cache_refresh_call_in), NULL, version);
+    }
+#endif
+}
+
 static nsapi_error_t nsapi_dns_get_server_addr(NetworkStack *stack, uint8_t *index, uint8_t *total_attempts, uint8_t *send_success, SocketAddress *dns_addr, const char *interface_name)
 {
     bool dns_addr_set = false;
@@ -495,7 +610,12 @@ static nsapi_size_or_error_t nsapi_dns_query_multiple(NetworkStack *stack, const
             addr[i] = tmp[i];
         }
         delete [] tmp;
+        nsapi_dns_cache_refresh(stack, host, interface_name, version);
         return MIN(us_cached, addr_count);
+    } else if (cached == NSAPI_ERROR_DNS_FAILURE) {
+        // Cached negative response, do not re-query until it expires
+        delete [] tmp;
+        return cached;
     }
     delete [] tmp;
     // create a udp socket
@@ -579,6 +699,9 @@ static nsapi_size_or_error_t nsapi_dns_query_multiple(NetworkStack *stack, const
             result = resp;
         } else if (resp < 0) {
             continue;
+        } else {
+            // Authoritative response with no usable records
+            nsapi_dns_cache_add_negative(host, version);
         }
 
         /* The DNS response is final, no need to check other servers */
@@ -708,12 +831,20 @@ nsapi_value_or_error_t nsapi_dns_query_multiple_async(NetworkStack *stack, const
 
     nsapi_addr *address = new (std::nothrow) nsapi_addr_t [MBED_CONF_NSAPI_DNS_ADDRESSES_LIMIT];
     int cached = nsapi_dns_cache_find(host, version, address);
+    if (cached == NSAPI_ERROR_DNS_FAILURE) {
+        // Cached negative response, do not re-query until it expires
+        dns_mutex->unlock();
+        callback(NSAPI_ERROR_DNS_FAILURE, NULL);
+        delete[] address;
+        return NSAPI_ERROR_OK;
+    }
     if (!addr_count) {
         if (cached > 0) {
             SocketAddress addr(*address);
             dns_mutex->unlock();
             callback(1, &addr);
             delete[] address;
+            nsapi_dns_cache_refresh(stack, host, interface_name, version);
             return NSAPI_ERROR_OK;
         }
 
@@ -728,10 +859,23 @@ nsapi_value_or_error_t nsapi_dns_query_multiple_async(NetworkStack *stack, const
             callback(cached, addr);
             delete[] address;
             delete[] addr;
+            nsapi_dns_cache_refresh(stack, host, interface_name, version);
             return cached;
         }
     }
     delete[] address;
+
+    return nsapi_dns_query_multiple_async_internal(stack, host, callback, addr_count, call_in_cb, interface_name, version);
+}
+
+// Creates and initiates an asynchronous query without consulting the cache,
+// so it is also usable for refreshing a still-valid cache entry.
+// Expects dns_mutex to be held; releases it before returning.
+static nsapi_value_or_error_t nsapi_dns_query_multiple_async_internal(NetworkStack *stack, const char *host,
+                                                                      NetworkStack::hostbyname_cb_t callback, nsapi_size_t addr_count,
+                                                                      call_in_callback_cb_t call_in_cb, const char *interface_name, nsapi_version_t version)
+{
+    int host_len = strlen(host);
     int index = -1;
 
     for (int i = 0; i < DNS_QUERY_QUEUE_SIZE; i++) {
@@ -1253,6 +1397,9 @@ static void nsapi_dns_query_async_response(void *ptr)
             // Adds address to cache
             nsapi_dns_cache_add(query->host, &(query->addrs[0]), query->ttl, query->count);
             status = query->count;
+        } else if (status == NSAPI_ERROR_DNS_FAILURE) {
+            // Authoritative response with no usable records
+            nsapi_dns_cache_add_negative(query->host, query->version);
         }
 
         nsapi_dns_query_async_resp(query, status, addresses);
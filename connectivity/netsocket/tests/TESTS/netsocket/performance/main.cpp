@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026, ARM Limited, All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Network performance measurements against the greentea echo/discard server.
+ * Unlike the functional suites these cases mostly cannot fail - they exist
+ * to put Mbps, RTT and loss numbers on every stack and EMAC change, per
+ * target, so throughput regressions are found by CI instead of bisection. */
+
+#if !defined(MBED_CONF_RTOS_PRESENT)
+#error [NOT_SUPPORTED] performance test cases require a RTOS to run
+#else
+
+#define WIFI 2
+#if !defined(MBED_CONF_TARGET_NETWORK_DEFAULT_INTERFACE_TYPE) || \
+    (MBED_CONF_TARGET_NETWORK_DEFAULT_INTERFACE_TYPE == WIFI && !defined(MBED_CONF_NSAPI_DEFAULT_WIFI_SSID))
+#error [NOT_SUPPORTED] No network configuration found for this target.
+#else
+
+#include "mbed.h"
+#include "greentea-client/test_env.h"
+#include "unity/unity.h"
+#include "utest.h"
+#include "perf_tests.h"
+
+#ifndef ECHO_SERVER_ADDR
+#error [NOT_SUPPORTED] Requires parameters for echo server
+#else
+
+using namespace utest::v1;
+
+char perf_global::rx_buffer[perf_global::BUFF_SIZE];
+char perf_global::tx_buffer[perf_global::BUFF_SIZE];
+
+NetworkInterface *get_interface()
+{
+    return NetworkInterface::get_default_instance();
+}
+
+static void _ifup()
+{
+    NetworkInterface *net = NetworkInterface::get_default_instance();
+    nsapi_error_t err = net->connect();
+    TEST_ASSERT_EQUAL(NSAPI_ERROR_OK, err);
+    SocketAddress address;
+    net->get_ip_address(&address);
+    printf("MBED: perf client IP address is '%s'\n", address ? address.get_ip_address() : "null");
+}
+
+static void _ifdown()
+{
+    NetworkInterface::get_default_instance()->disconnect();
+    printf("MBED: ifdown\n");
+}
+
+nsapi_error_t perf_tcpsocket_connect_to_srv(TCPSocket &sock, uint16_t port)
+{
+    SocketAddress tcp_addr;
+
+    NetworkInterface::get_default_instance()->gethostbyname(ECHO_SERVER_ADDR, &tcp_addr);
+    tcp_addr.set_port(port);
+
+    nsapi_error_t err = sock.open(NetworkInterface::get_default_instance());
+    if (err != NSAPI_ERROR_OK) {
+        return err;
+    }
+
+    return sock.connect(tcp_addr);
+}
+
+bool is_tcp_supported()
+{
+    static bool supported;
+    static bool tested = false;
+    if (!tested) {
+        TCPSocket socket;
+        supported = socket.open(NetworkInterface::get_default_instance()) == NSAPI_ERROR_OK;
+    }
+    return supported;
+}
+
+void fill_tx_buffer_ascii(char *buff, size_t len)
+{
+    for (size_t i = 0; i < len; ++i) {
+        buff[i] = (rand() % 43) + '0';
+    }
+}
+
+void perf_report(const char *name, const char *unit, int value)
+{
+    printf("MBED: perf %s = %d %s\n", name, value, unit);
+    greentea_send_kv("perf", name, value);
+}
+
+// Test setup
+utest::v1::status_t greentea_setup(const size_t number_of_cases)
+{
+    GREENTEA_SETUP(perf_global::TESTS_TIMEOUT, "default_auto");
+    _ifup();
+    return greentea_test_setup_handler(number_of_cases);
+}
+
+void greentea_teardown(const size_t passed, const size_t failed, const failure_t failure)
+{
+    _ifdown();
+    return greentea_test_teardown_handler(passed, failed, failure);
+}
+
+Case cases[] = {
+    Case("PERF_TCP_TX_THROUGHPUT", PERF_TCP_TX_THROUGHPUT),
+    Case("PERF_TCP_ECHO_THROUGHPUT", PERF_TCP_ECHO_THROUGHPUT),
+    Case("PERF_UDP_ECHO_LATENCY", PERF_UDP_ECHO_LATENCY),
+};
+
+Specification specification(greentea_setup, cases, greentea_teardown);
+
+int main()
+{
+    return !Harness::run(specification);
+}
+
+#endif // ECHO_SERVER_ADDR
+#endif // MBED_CONF_TARGET_NETWORK_DEFAULT_INTERFACE_TYPE
+#endif // !defined(MBED_CONF_RTOS_PRESENT)
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026, ARM Limited, All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PERF_TESTS_H
+#define PERF_TESTS_H
+
+#include "../test_params.h"
+
+NetworkInterface *get_interface();
+nsapi_error_t perf_tcpsocket_connect_to_srv(TCPSocket &sock, uint16_t port);
+bool is_tcp_supported();
+void fill_tx_buffer_ascii(char *buff, size_t len);
+
+/** Report one measurement: printed for the log and sent as a greentea
+ *  key-value pair ("perf", name, value) for the host side to collect. */
+void perf_report(const char *name, const char *unit, int value);
+
+namespace perf_global {
+#ifdef MBED_GREENTEA_TEST_PERF_TIMEOUT_S
+static const int TESTS_TIMEOUT = MBED_GREENTEA_TEST_PERF_TIMEOUT_S;
+#else
+static const int TESTS_TIMEOUT = (10 * 60);
+#endif
+
+/** Sending window of each throughput case */
+static const int THROUGHPUT_DURATION_MS = 5000;
+
+/** Round trips measured by the latency case */
+static const int LATENCY_PACKETS = 200;
+
+/** As in the echo tests: losing some UDP packets is expected, losing most
+ *  of them is a failing network */
+static const double TOLERATED_LOSS_RATIO = 0.3;
+
+static const int BUFF_SIZE = 1200;
+extern char rx_buffer[BUFF_SIZE];
+extern char tx_buffer[BUFF_SIZE];
+}
+
+/*
+ * Test cases
+ */
+void PERF_TCP_TX_THROUGHPUT();
+void PERF_TCP_ECHO_THROUGHPUT();
+void PERF_UDP_ECHO_LATENCY();
+
+#endif //PERF_TESTS_H
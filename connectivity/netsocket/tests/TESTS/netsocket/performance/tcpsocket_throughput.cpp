@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026, ARM Limited, All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mbed.h"
+#include "TCPSocket.h"
+#include "greentea-client/test_env.h"
+#include "unity/unity.h"
+#include "utest.h"
+#include "perf_tests.h"
+
+using namespace utest::v1;
+using namespace std::chrono;
+
+namespace {
+/* kbit/s from a byte count and a duration, without intermediate overflow */
+int throughput_kbps(uint64_t bytes, milliseconds elapsed)
+{
+    if (elapsed.count() == 0) {
+        return 0;
+    }
+    return (int)((bytes * 8) / elapsed.count());
+}
+}
+
+/** Sustained one-way send rate into the discard service - measures the TX
+ *  path of the stack and EMAC without the peer echoing anything back. */
+void PERF_TCP_TX_THROUGHPUT()
+{
+    if (!is_tcp_supported()) {
+        TEST_SKIP_MESSAGE("TCP not supported");
+        return;
+    }
+
+    TCPSocket sock;
+    TEST_ASSERT_EQUAL(NSAPI_ERROR_OK, perf_tcpsocket_connect_to_srv(sock, ECHO_SERVER_DISCARD_PORT));
+
+    fill_tx_buffer_ascii(perf_global::tx_buffer, perf_global::BUFF_SIZE);
+
+    uint64_t bytes_sent = 0;
+    Timer timer;
+    timer.start();
+    while (timer.elapsed_time() < milliseconds(perf_global::THROUGHPUT_DURATION_MS)) {
+        int sent = sock.send(perf_global::tx_buffer, perf_global::BUFF_SIZE);
+        if (sent < 0) {
+            TEST_FAIL_MESSAGE("send() failed");
+            break;
+        }
+        bytes_sent += sent;
+    }
+    timer.stop();
+    sock.close();
+
+    perf_report("tcp_tx_throughput", "kbit/s",
+                throughput_kbps(bytes_sent, duration_cast<milliseconds>(timer.elapsed_time())));
+}
+
+/** Round-trip rate through the echo service: every counted byte has been
+ *  both sent and received, so this exercises TX and RX together. */
+void PERF_TCP_ECHO_THROUGHPUT()
+{
+    if (!is_tcp_supported()) {
+        TEST_SKIP_MESSAGE("TCP not supported");
+        return;
+    }
+
+    TCPSocket sock;
+    TEST_ASSERT_EQUAL(NSAPI_ERROR_OK, perf_tcpsocket_connect_to_srv(sock, ECHO_SERVER_PORT));
+    sock.set_timeout(10000);
+
+    fill_tx_buffer_ascii(perf_global::tx_buffer, perf_global::BUFF_SIZE);
+
+    uint64_t bytes_echoed = 0;
+    Timer timer;
+    timer.start();
+    while (timer.elapsed_time() < milliseconds(perf_global::THROUGHPUT_DURATION_MS)) {
+        int sent = sock.send(perf_global::tx_buffer, perf_global::BUFF_SIZE);
+        if (sent < 0) {
+            TEST_FAIL_MESSAGE("send() failed");
+            break;
+        }
+        int received = 0;
+        while (received < sent) {
+            int ret = sock.recv(perf_global::rx_buffer, perf_global::BUFF_SIZE);
+            if (ret <= 0) {
+                TEST_FAIL_MESSAGE("recv() failed");
+                timer.stop();
+                sock.close();
+                return;
+            }
+            received += ret;
+        }
+        bytes_echoed += received;
+    }
+    timer.stop();
+    sock.close();
+
+    perf_report("tcp_echo_throughput", "kbit/s",
+                throughput_kbps(bytes_echoed, duration_cast<milliseconds>(timer.elapsed_time())));
+}
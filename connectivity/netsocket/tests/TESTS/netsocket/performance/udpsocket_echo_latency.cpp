@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026, ARM Limited, All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+
+#include "mbed.h"
+#include "UDPSocket.h"
+#include "greentea-client/test_env.h"
+#include "unity/unity.h"
+#include "utest.h"
+#include "perf_tests.h"
+
+using namespace utest::v1;
+using namespace std::chrono;
+
+namespace {
+static const int PACKET_SIZE = 64;
+static const milliseconds RECV_TIMEOUT = 500ms;
+
+uint32_t rtt_us[perf_global::LATENCY_PACKETS];
+}
+
+/** Round-trip time of small UDP packets through the echo service, reported
+ *  as p50/p99 over a run of sequence-numbered packets, plus the loss rate.
+ *
+ *  Timestamps come from the microsecond Timer around each send/recv pair -
+ *  the socket API carries no hardware packet timestamps, so the numbers
+ *  include the stack's own scheduling, which is part of what a latency
+ *  regression looks like to an application anyway. */
+void PERF_UDP_ECHO_LATENCY()
+{
+    SocketAddress udp_addr;
+    NetworkInterface::get_default_instance()->gethostbyname(ECHO_SERVER_ADDR, &udp_addr);
+    udp_addr.set_port(ECHO_SERVER_PORT);
+
+    UDPSocket sock;
+    TEST_ASSERT_EQUAL(NSAPI_ERROR_OK, sock.open(NetworkInterface::get_default_instance()));
+    sock.set_timeout(RECV_TIMEOUT.count());
+
+    fill_tx_buffer_ascii(perf_global::tx_buffer, PACKET_SIZE);
+
+    int received = 0;
+    Timer timer;
+    timer.start();
+    for (uint32_t seq = 0; seq < (uint32_t)perf_global::LATENCY_PACKETS; seq++) {
+        memcpy(perf_global::tx_buffer, &seq, sizeof(seq));
+
+        microseconds sent_at = timer.elapsed_time();
+        if (sock.sendto(udp_addr, perf_global::tx_buffer, PACKET_SIZE) != PACKET_SIZE) {
+            continue;
+        }
+
+        /* Read until this packet's echo arrives - late echoes of earlier,
+         * already written-off packets are drained and ignored. */
+        while (true) {
+            int ret = sock.recvfrom(NULL, perf_global::rx_buffer, perf_global::BUFF_SIZE);
+            if (ret < 0) {
+                break;
+            }
+            uint32_t echoed_seq;
+            memcpy(&echoed_seq, perf_global::rx_buffer, sizeof(echoed_seq));
+            if (ret == PACKET_SIZE && echoed_seq == seq) {
+                rtt_us[received++] = (uint32_t)(timer.elapsed_time() - sent_at).count();
+                break;
+            }
+        }
+    }
+    timer.stop();
+    sock.close();
+
+    int lost = perf_global::LATENCY_PACKETS - received;
+    perf_report("udp_echo_loss", "packets", lost);
+    TEST_ASSERT(lost <= perf_global::TOLERATED_LOSS_RATIO * perf_global::LATENCY_PACKETS);
+    if (received == 0) {
+        return;
+    }
+
+    std::sort(rtt_us, rtt_us + received);
+    perf_report("udp_rtt_min", "us", rtt_us[0]);
+    perf_report("udp_rtt_p50", "us", rtt_us[received / 2]);
+    perf_report("udp_rtt_p99", "us", rtt_us[(received * 99) / 100]);
+    perf_report("udp_rtt_max", "us", rtt_us[received - 1]);
+}
@@ -108,3 +108,43 @@ nsapi_error_t NetworkStack::get_ip_address_if(SocketAddress *address, const char
 {
     return NSAPI_ERROR_UNSUPPORTED;
 }
+
+nsapi_size_or_error_t NetworkStack::socket_sendv(nsapi_socket_t handle,
+                                                 const nsapi_iovec_t *iov, int iov_count)
+{
+    return NSAPI_ERROR_UNSUPPORTED;
+}
+
+nsapi_size_or_error_t NetworkStack::socket_sendtov(nsapi_socket_t handle, const SocketAddress &address,
+                                                   const nsapi_iovec_t *iov, int iov_count)
+{
+    return NSAPI_ERROR_UNSUPPORTED;
+}
+
+nsapi_size_or_error_t NetworkStack::socket_recvfrom_buffer(nsapi_socket_t handle, SocketAddress *address,
+                                                           net_stack_mem_buf_t **buffer)
+{
+    return NSAPI_ERROR_UNSUPPORTED;
+}
+
+nsapi_size_or_error_t NetworkStack::socket_send_nocopy(nsapi_socket_t handle,
+                                                       const void *data, nsapi_size_t size)
+{
+    return NSAPI_ERROR_UNSUPPORTED;
+}
+
+nsapi_error_t NetworkStack::socket_notify_sent(nsapi_socket_t handle,
+                                               void (*callback)(void *), void *data)
+{
+    return NSAPI_ERROR_UNSUPPORTED;
+}
+
+nsapi_size_or_error_t NetworkStack::socket_send_pending(nsapi_socket_t handle)
+{
+    return NSAPI_ERROR_UNSUPPORTED;
+}
+
+size_t NetworkStack::get_interface_stats(mbed_stats_interface_t *stats, size_t count)
+{
+    return 0;
+}
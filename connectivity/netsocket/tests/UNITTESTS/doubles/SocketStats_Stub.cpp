@@ -61,4 +61,9 @@ void SocketStats::stats_update_recv_bytes(const Socket *const reference_id, size
 {
     return;
 }
+
+void SocketStats::stats_update_send_queue(const Socket *const reference_id, size_t queued)
+{
+    return;
+}
 #endif
@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2021, Arm Limited and affiliates
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+#include "netsocket/SocketMultiplexer.h"
+#include <list>
+#include <vector>
+
+// Control the rtos EventFlags stub. See EventFlags_stub.cpp
+extern std::list<uint32_t> eventFlagsStubNextRetval;
+
+// Minimal socket recording its sigio callback so tests can fire events
+class FakeSocket : public Socket {
+public:
+    mbed::Callback<void()> attached_sigio;
+
+    void fire_sigio()
+    {
+        if (attached_sigio) {
+            attached_sigio();
+        }
+    }
+
+    nsapi_error_t close() override
+    {
+        return NSAPI_ERROR_OK;
+    }
+    nsapi_error_t connect(const SocketAddress &address) override
+    {
+        return NSAPI_ERROR_OK;
+    }
+    nsapi_size_or_error_t send(const void *data, nsapi_size_t size) override
+    {
+        return 0;
+    }
+    nsapi_size_or_error_t recv(void *data, nsapi_size_t size) override
+    {
+        return 0;
+    }
+    nsapi_size_or_error_t sendto(const SocketAddress &address, const void *data, nsapi_size_t size) override
+    {
+        return 0;
+    }
+    nsapi_size_or_error_t recvfrom(SocketAddress *address, void *data, nsapi_size_t size) override
+    {
+        return 0;
+    }
+    nsapi_error_t bind(const SocketAddress &address) override
+    {
+        return NSAPI_ERROR_OK;
+    }
+    void set_blocking(bool blocking) override
+    {
+    }
+    void set_timeout(int timeout) override
+    {
+    }
+    void sigio(mbed::Callback<void()> func) override
+    {
+        attached_sigio = func;
+    }
+    nsapi_error_t setsockopt(int level, int optname, const void *optval, unsigned optlen) override
+    {
+        return NSAPI_ERROR_UNSUPPORTED;
+    }
+    nsapi_error_t getsockopt(int level, int optname, void *optval, unsigned *optlen) override
+    {
+        return NSAPI_ERROR_UNSUPPORTED;
+    }
+    Socket *accept(nsapi_error_t *error = NULL) override
+    {
+        return NULL;
+    }
+    nsapi_error_t listen(int backlog = 1) override
+    {
+        return NSAPI_ERROR_UNSUPPORTED;
+    }
+    nsapi_error_t getpeername(SocketAddress *address) override
+    {
+        return NSAPI_ERROR_UNSUPPORTED;
+    }
+};
+
+static std::vector<Socket *> dispatched_sockets;
+static std::vector<uint8_t> dispatched_events;
+static void my_handler(Socket *socket, uint8_t events)
+{
+    dispatched_sockets.push_back(socket);
+    dispatched_events.push_back(events);
+}
+
+static SocketMultiplexer *mux_for_remove;
+static void removing_handler(Socket *socket, uint8_t events)
+{
+    dispatched_sockets.push_back(socket);
+    mux_for_remove->remove(socket);
+}
+
+class TestSocketMultiplexer : public testing::Test {
+protected:
+    SocketMultiplexer *mux;
+    FakeSocket socket;
+
+    virtual void SetUp()
+    {
+        mux = new SocketMultiplexer;
+        dispatched_sockets.clear();
+        dispatched_events.clear();
+    }
+
+    virtual void TearDown()
+    {
+        eventFlagsStubNextRetval.clear();
+        delete mux;
+    }
+};
+
+TEST_F(TestSocketMultiplexer, add_parameter_checks)
+{
+    EXPECT_EQ(mux->add(NULL), NSAPI_ERROR_PARAMETER);
+    EXPECT_EQ(mux->add(&socket, 0), NSAPI_ERROR_PARAMETER);
+    EXPECT_EQ(mux->add(&socket), NSAPI_ERROR_OK);
+    EXPECT_EQ(mux->add(&socket), NSAPI_ERROR_PARAMETER);
+}
+
+TEST_F(TestSocketMultiplexer, add_chains_sigio)
+{
+    EXPECT_FALSE(socket.attached_sigio);
+    EXPECT_EQ(mux->add(&socket), NSAPI_ERROR_OK);
+    EXPECT_TRUE(socket.attached_sigio);
+}
+
+TEST_F(TestSocketMultiplexer, add_full)
+{
+    FakeSocket sockets[MBED_CONF_NSAPI_SOCKET_MUX_MAX_SOCKETS];
+    for (int i = 0; i < MBED_CONF_NSAPI_SOCKET_MUX_MAX_SOCKETS; i++) {
+        EXPECT_EQ(mux->add(&sockets[i]), NSAPI_ERROR_OK);
+    }
+    EXPECT_EQ(mux->add(&socket), NSAPI_ERROR_NO_MEMORY);
+    // Removing one frees a slot again
+    EXPECT_EQ(mux->remove(&sockets[0]), NSAPI_ERROR_OK);
+    EXPECT_EQ(mux->add(&socket), NSAPI_ERROR_OK);
+    for (int i = 1; i < MBED_CONF_NSAPI_SOCKET_MUX_MAX_SOCKETS; i++) {
+        EXPECT_EQ(mux->remove(&sockets[i]), NSAPI_ERROR_OK);
+    }
+}
+
+TEST_F(TestSocketMultiplexer, wait_no_handler)
+{
+    EXPECT_EQ(mux->wait(NULL), NSAPI_ERROR_PARAMETER);
+}
+
+TEST_F(TestSocketMultiplexer, wait_dispatches_initial_event)
+{
+    EXPECT_EQ(mux->add(&socket), NSAPI_ERROR_OK);
+    EXPECT_EQ(mux->wait(my_handler), 1);
+    ASSERT_EQ(dispatched_sockets.size(), 1);
+    EXPECT_EQ(dispatched_sockets[0], &socket);
+    EXPECT_EQ(dispatched_events[0], SocketMultiplexer::EVENT_ALL);
+}
+
+TEST_F(TestSocketMultiplexer, wait_timeout)
+{
+    EXPECT_EQ(mux->add(&socket), NSAPI_ERROR_OK);
+    EXPECT_EQ(mux->wait(my_handler), 1);
+    // No further events pending, the blocking wait times out
+    eventFlagsStubNextRetval.push_back(osFlagsError); // Break the wait loop
+    EXPECT_EQ(mux->wait(my_handler), NSAPI_ERROR_WOULD_BLOCK);
+    EXPECT_EQ(dispatched_sockets.size(), 1);
+}
+
+TEST_F(TestSocketMultiplexer, wait_dispatches_sigio)
+{
+    EXPECT_EQ(mux->add(&socket), NSAPI_ERROR_OK);
+    EXPECT_EQ(mux->wait(my_handler), 1);
+    socket.fire_sigio();
+    EXPECT_EQ(mux->wait(my_handler), 1);
+    ASSERT_EQ(dispatched_sockets.size(), 2);
+    EXPECT_EQ(dispatched_sockets[1], &socket);
+}
+
+TEST_F(TestSocketMultiplexer, wait_dispatches_batch)
+{
+    FakeSocket socket2;
+    EXPECT_EQ(mux->add(&socket, SocketMultiplexer::EVENT_READ), NSAPI_ERROR_OK);
+    EXPECT_EQ(mux->add(&socket2, SocketMultiplexer::EVENT_WRITE), NSAPI_ERROR_OK);
+    EXPECT_EQ(mux->wait(my_handler), 2);
+    ASSERT_EQ(dispatched_sockets.size(), 2);
+    EXPECT_EQ(dispatched_events[0], SocketMultiplexer::EVENT_READ);
+    EXPECT_EQ(dispatched_events[1], SocketMultiplexer::EVENT_WRITE);
+}
+
+TEST_F(TestSocketMultiplexer, modify)
+{
+    EXPECT_EQ(mux->modify(&socket, SocketMultiplexer::EVENT_READ), NSAPI_ERROR_NO_SOCKET);
+    EXPECT_EQ(mux->add(&socket), NSAPI_ERROR_OK);
+    EXPECT_EQ(mux->modify(&socket, 0), NSAPI_ERROR_PARAMETER);
+    EXPECT_EQ(mux->modify(&socket, SocketMultiplexer::EVENT_READ), NSAPI_ERROR_OK);
+    EXPECT_EQ(mux->wait(my_handler), 1);
+    ASSERT_EQ(dispatched_events.size(), 1);
+    EXPECT_EQ(dispatched_events[0], SocketMultiplexer::EVENT_READ);
+}
+
+TEST_F(TestSocketMultiplexer, remove_detaches_sigio)
+{
+    EXPECT_EQ(mux->remove(&socket), NSAPI_ERROR_NO_SOCKET);
+    EXPECT_EQ(mux->add(&socket), NSAPI_ERROR_OK);
+    EXPECT_TRUE(socket.attached_sigio);
+    EXPECT_EQ(mux->remove(&socket), NSAPI_ERROR_OK);
+    EXPECT_FALSE(socket.attached_sigio);
+    // Pending event of the removed socket is not reported
+    eventFlagsStubNextRetval.push_back(osFlagsError); // Break the wait loop
+    EXPECT_EQ(mux->wait(my_handler), NSAPI_ERROR_WOULD_BLOCK);
+}
+
+TEST_F(TestSocketMultiplexer, remove_from_handler)
+{
+    mux_for_remove = mux;
+    EXPECT_EQ(mux->add(&socket), NSAPI_ERROR_OK);
+    EXPECT_EQ(mux->wait(removing_handler), 1);
+    EXPECT_FALSE(socket.attached_sigio);
+    EXPECT_EQ(mux->add(&socket), NSAPI_ERROR_OK);
+}
+
+TEST_F(TestSocketMultiplexer, destructor_detaches_sigio)
+{
+    SocketMultiplexer *mux2 = new SocketMultiplexer;
+    EXPECT_EQ(mux2->add(&socket), NSAPI_ERROR_OK);
+    delete mux2;
+    EXPECT_FALSE(socket.attached_sigio);
+}
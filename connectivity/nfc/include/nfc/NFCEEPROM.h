@@ -152,6 +152,10 @@ private:
     size_t _ndef_buffer_read_sz;
     uint32_t _eeprom_address;
     nfc_err_t _operation_result;
+
+    // Streaming parser supplied by the delegate for the read in progress,
+    // NULL when reads parse in one pass at the end
+    ndef::StreamingMessageParser *_stream_parser;
 };
 /** @}*/
 } // namespace nfc
@@ -31,6 +31,9 @@
 
 namespace mbed {
 namespace nfc {
+namespace ndef {
+class StreamingMessageParser;
+}
 
 /**
  * @addtogroup nfc
@@ -66,6 +69,23 @@ public:
          */
         virtual void parse_ndef_message(const Span<const uint8_t> &buffer) { }
 
+        /**
+         * Supply a streaming parser to pipeline parsing with the tag read.
+         *
+         * When a parser is returned, it is fed each chunk of the message as
+         * it arrives instead of parse_ndef_message() being called with the
+         * whole message at the end, and a parser that finishes early (a
+         * record filter found what it wanted, or the message ended) cuts the
+         * rest of the tag read short.
+         *
+         * @return the parser to feed during the read, or NULL to parse in
+         * one pass once the read completes (the default).
+         */
+        virtual ndef::StreamingMessageParser *streaming_message_parser()
+        {
+            return NULL;
+        }
+
         /**
          * Build a NDEF message.
          *
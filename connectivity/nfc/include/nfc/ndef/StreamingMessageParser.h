@@ -0,0 +1,186 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NFC_NDEF_STREAMINGMESSAGEPARSER_H_
+#define NFC_NDEF_STREAMINGMESSAGEPARSER_H_
+
+#include <stdlib.h>
+#include "platform/Span.h"
+
+#include "nfc/ndef/MessageParser.h"
+
+namespace mbed {
+namespace nfc {
+namespace ndef {
+
+/** @addtogroup nfc
+ * @{
+ */
+
+// Forward declaration
+class Record;
+
+/**
+ * Resumable, zero-allocation NDEF Message parser.
+ *
+ * Unlike MessageParser, which requires the complete message up front, this
+ * parser accepts the message as it is read from the tag: each call to parse()
+ * is handed the portion of the message buffered so far and emits every record
+ * that is complete within it, then picks up where it left off on the next
+ * call. Interleaving parse() with chunked tag reads pipelines the two, so the
+ * message is fully parsed the moment the last chunk arrives instead of in one
+ * long pass afterwards.
+ *
+ * Records are delivered as views (Span) into the supplied buffer - nothing is
+ * copied and nothing is allocated. The caller must keep the buffer intact and
+ * at a stable address for as long as those views are in use; growing it in
+ * place (the usual read-into-a-fixed-buffer pattern) is fine.
+ *
+ * The delegate's on_record_parsed() returns whether parsing should continue,
+ * so a scan for one record of interest can stop as soon as it is found - and
+ * the caller can stop reading the rest of the tag.
+ */
+class StreamingMessageParser {
+public:
+    /**
+     * Outcome of a parse() call.
+     */
+    enum status_t {
+        /**
+         * The next record is incomplete; buffer more data and call parse()
+         * again.
+         */
+        NEEDS_DATA,
+
+        /**
+         * The last record of the message has been parsed.
+         */
+        MESSAGE_COMPLETE,
+
+        /**
+         * The delegate ended parsing early.
+         */
+        PARSING_STOPPED,
+
+        /**
+         * The message is invalid; the error was reported to the delegate.
+         */
+        PARSING_ERROR
+    };
+
+    /**
+     * Report parsing events to the application.
+     */
+    struct Delegate {
+        /**
+         * Invoked when parsing has started.
+         */
+        virtual void on_parsing_started() { }
+
+        /**
+         * Invoked when a record has been parsed.
+         *
+         * The record's Spans point into the buffer passed to parse() and
+         * remain valid as long as that buffer does.
+         *
+         * @param record The record obtained from parsing.
+         * @return true to continue parsing, false to stop - remaining
+         * records are not parsed and parse() returns PARSING_STOPPED.
+         */
+        virtual bool on_record_parsed(const Record &record)
+        {
+            return true;
+        }
+
+        /**
+         * Invoked when parsing is over, whether complete, stopped early or
+         * failed.
+         */
+        virtual void on_parsing_terminated() { }
+
+        /**
+         * Invoked when an error is present in the message.
+         * @param error The error present in the message.
+         */
+        virtual void on_parsing_error(MessageParser::error_t error) { }
+
+    protected:
+        /**
+         * Protected non virtual destructor.
+         * Delegate is not meant to be destroyed in a polymorphic manner.
+         */
+        ~Delegate() { }
+    };
+
+    /**
+     * Construct a streaming message parser.
+     */
+    StreamingMessageParser();
+
+    /**
+     * Set the handler that processes parsing events.
+     * @param delegate The parsing event handler.
+     */
+    void set_delegate(Delegate *delegate);
+
+    /**
+     * Reset the parser so it can parse a new message.
+     *
+     * Also discards a terminal state left by a previous message, so it must
+     * be called between messages.
+     */
+    void restart();
+
+    /**
+     * Parse as much of the message as is currently buffered.
+     *
+     * The buffer must always start at the beginning of the message and only
+     * grow between calls: already-parsed records are not revisited, and the
+     * records reported reference the buffer directly.
+     *
+     * @param data_buffer The message bytes received so far.
+     * @param complete True when the buffer holds the whole message, so a
+     * truncated record is a malformed message rather than data still in
+     * flight.
+     *
+     * @return The parser status; once it is not NEEDS_DATA, further calls do
+     * nothing until restart().
+     */
+    status_t parse(const Span<const uint8_t> &data_buffer, bool complete);
+
+    /**
+     * Return the status of the last parse() call, NEEDS_DATA after restart().
+     */
+    status_t status() const;
+
+private:
+    bool parse_record(const Span<const uint8_t> &data_buffer);
+
+    void report_parsing_error(MessageParser::error_t error);
+
+    Delegate *_delegate;
+    size_t _position;
+    status_t _status;
+    bool _started: 1;
+    bool _first_record_parsed: 1;
+};
+/** @}*/
+} // namespace ndef
+} // namespace nfc
+} // namespace mbed
+
+#endif /* NFC_NDEF_STREAMINGMESSAGEPARSER_H_ */
@@ -17,6 +17,7 @@
 
 #include "NFCEEPROM.h"
 #include "ndef/ndef.h"
+#include "nfc/ndef/StreamingMessageParser.h"
 
 using namespace mbed;
 using namespace mbed::nfc;
@@ -25,7 +26,7 @@ NFCEEPROM::NFCEEPROM(NFCEEPROMDriver *driver, events::EventQueue *queue, const S
     :
     NFCTarget(ndef_buffer), _delegate(NULL), _driver(driver), _event_queue(queue), _initialized(false),
     _current_op(nfc_eeprom_idle), _ndef_buffer_reader { nullptr, 0, nullptr }, _ndef_buffer_read_sz(0),
-    _eeprom_address(0), _operation_result(NFC_ERR_UNKNOWN)
+    _eeprom_address(0), _operation_result(NFC_ERR_UNKNOWN), _stream_parser(NULL)
 {
     _driver->set_delegate(this);
     _driver->set_event_queue(queue);
@@ -190,8 +191,14 @@ void NFCEEPROM::on_session_ended(bool success)
             }
             _current_op = nfc_eeprom_idle;
 
-            // Try to parse the NDEF message
-            ndef_msg_decode(ndef_message());
+            if (_stream_parser != NULL) {
+                // Already parsed while reading - a second pass would only
+                // repeat the work (and fail on a cut-short read)
+                _stream_parser = NULL;
+            } else {
+                // Try to parse the NDEF message
+                ndef_msg_decode(ndef_message());
+            }
 
             if (_delegate != NULL) {
                 _delegate->on_ndef_message_read(_operation_result);
@@ -230,6 +237,25 @@ void NFCEEPROM::on_bytes_read(size_t count)
             ac_buffer_builder_t *buffer_builder = ndef_msg_buffer_builder(ndef_message());
             ac_buffer_builder_write_n_skip(buffer_builder, count);
 
+            // Feed the chunk to the streaming parser; the records it emits
+            // are views into the NDEF buffer being filled
+            if (_stream_parser != NULL) {
+                const uint8_t *start = ac_buffer_builder_write_position(buffer_builder) - _eeprom_address;
+                ndef::StreamingMessageParser::status_t status = _stream_parser->parse(
+                                                                    make_const_Span(start, _eeprom_address),
+                                                                    /* complete */ _eeprom_address >= _ndef_buffer_read_sz
+                                                                );
+                if (status != ndef::StreamingMessageParser::NEEDS_DATA
+                        && _eeprom_address < _ndef_buffer_read_sz) {
+                    // The parser is done (message ended or a filter matched):
+                    // the rest of the tag is not worth reading, close now
+                    _current_op = nfc_eeprom_read_end_session;
+                    _operation_result = NFC_OK;
+                    _driver->end_session();
+                    return;
+                }
+            }
+
             // Continue reading
             _event_queue->call(this, &NFCEEPROM::continue_read);
             break;
@@ -330,6 +356,13 @@ void NFCEEPROM::on_size_read(bool success, size_t size)
             _eeprom_address = 0;
             _ndef_buffer_read_sz = size;
 
+            // Pipeline parsing with the read when the delegate supplies a
+            // streaming parser
+            _stream_parser = (_delegate != NULL) ? _delegate->streaming_message_parser() : NULL;
+            if (_stream_parser != NULL) {
+                _stream_parser->restart();
+            }
+
             // Start reading bytes
             _current_op = nfc_eeprom_read_read_bytes;
             _event_queue->call(this, &NFCEEPROM::continue_read);
@@ -409,6 +442,7 @@ void NFCEEPROM::handle_error(nfc_err_t ret)
     // Save & reset current op
     nfc_eeprom_operation_t last_op = _current_op;
     _current_op = nfc_eeprom_idle;
+    _stream_parser = NULL;
 
     if (_delegate != NULL) {
         if (last_op <= nfc_eeprom_write_end_session) {
@@ -239,7 +239,6 @@ bool MessageParser::parse_record(parsing_state_t &s)
     // payload
     if (payload_length) {
         record.payload = s.it.get_underlying_buffer().first(payload_length);
-        s.it += payload_length;
     }
 
     s.it += payload_length;
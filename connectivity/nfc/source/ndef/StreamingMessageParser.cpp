@@ -0,0 +1,227 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "nfc/ndef/StreamingMessageParser.h"
+#include "nfc/ndef/Record.h"
+
+namespace mbed {
+namespace nfc {
+namespace ndef {
+
+StreamingMessageParser::StreamingMessageParser() :
+    _delegate(NULL),
+    _position(0),
+    _status(NEEDS_DATA),
+    _started(false),
+    _first_record_parsed(false)
+{ }
+
+void StreamingMessageParser::set_delegate(Delegate *delegate)
+{
+    _delegate = delegate;
+}
+
+void StreamingMessageParser::restart()
+{
+    _position = 0;
+    _status = NEEDS_DATA;
+    _started = false;
+    _first_record_parsed = false;
+}
+
+StreamingMessageParser::status_t StreamingMessageParser::parse(
+    const Span<const uint8_t> &data_buffer, bool complete
+)
+{
+    if (_status != NEEDS_DATA) {
+        return _status;
+    }
+
+    if (!_started) {
+        _started = true;
+        if (_delegate) {
+            _delegate->on_parsing_started();
+        }
+    }
+
+    while (_status == NEEDS_DATA && parse_record(data_buffer));
+
+    if (_status == NEEDS_DATA && complete) {
+        // the whole message is buffered; running out of it mid-record or
+        // before the message end record means the message is malformed
+        report_parsing_error(
+            (_position < (size_t)data_buffer.size()) ?
+            MessageParser::INSUFICIENT_DATA :
+            MessageParser::MISSING_MESSAGE_END
+        );
+    }
+
+    if (_status != NEEDS_DATA && _delegate) {
+        _delegate->on_parsing_terminated();
+    }
+
+    return _status;
+}
+
+StreamingMessageParser::status_t StreamingMessageParser::status() const
+{
+    return _status;
+}
+
+bool StreamingMessageParser::parse_record(const Span<const uint8_t> &data_buffer)
+{
+    size_t position = _position;
+    size_t remaining = data_buffer.size() - position;
+
+    // the record is parsed only once it is entirely buffered; every size
+    // check below bails out to wait for more data instead of failing
+    if (remaining < 1) {
+        return false;
+    }
+
+    uint8_t header = data_buffer[position++];
+    --remaining;
+
+    // NOTE: report an error until the chunk parsing design is sorted out
+    if (header & Header::chunk_flag_bit) {
+        report_parsing_error(MessageParser::CHUNK_RECORD_NOT_SUPPORTED);
+        return false;
+    }
+
+    // handle first record cases; _first_record_parsed is only committed once
+    // the record is complete, so a record split across reads is re-examined
+    if (_first_record_parsed == false) {
+        if (!(header & Header::message_begin_bit)) {
+            report_parsing_error(MessageParser::INVALID_MESSAGE_START);
+            return false;
+        }
+    } else if (header & Header::message_begin_bit) {
+        report_parsing_error(MessageParser::INVALID_MESSAGE_START);
+        return false;
+    }
+
+    // ensure there is enough space to contain the type length, payload
+    // length and id length
+    uint8_t lengths_size = 1 /* type_length size */ +
+                           ((header & Header::short_record_bit) ? 1 : 4) /* payload length */ +
+                           ((header & Header::id_length_bit) ? 1 : 0);
+    if (remaining < lengths_size) {
+        return false;
+    }
+
+    // extract the various lengths from the message
+    uint8_t type_length = data_buffer[position++];
+    uint32_t payload_length = 0;
+    if (header & Header::short_record_bit) {
+        payload_length = data_buffer[position++];
+    } else {
+        payload_length = (uint32_t)data_buffer[position] << 24 |
+                         (uint32_t)data_buffer[position + 1] << 16 |
+                         (uint32_t)data_buffer[position + 2] << 8 |
+                         (uint32_t)data_buffer[position + 3];
+        position += 4;
+    }
+    uint8_t id_length = (header & Header::id_length_bit) ? data_buffer[position++] : 0;
+    remaining -= lengths_size;
+
+    // the rest of the record must be buffered before it can be emitted
+    if (remaining < (size_t)type_length + id_length + payload_length) {
+        return false;
+    }
+
+    // validate the Type Name Format of the header
+    switch (header & Header::tnf_bits) {
+        case RecordType::empty:
+            if (type_length || payload_length || id_length) {
+                report_parsing_error(MessageParser::INVALID_EMPTY_RECORD);
+                return false;
+            }
+            break;
+        case RecordType::well_known_type:
+        case RecordType::media_type:
+        case RecordType::absolute_uri:
+        case RecordType::external_type:
+            if (!type_length) {
+                report_parsing_error(MessageParser::MISSING_TYPE_VALUE);
+                return false;
+            }
+            break;
+        case RecordType::unknown:
+            if (type_length) {
+                report_parsing_error(MessageParser::INVALID_UNKNOWN_TYPE_LENGTH);
+                return false;
+            }
+            break;
+        case RecordType::unchanged:
+            // shouldn't be handled outside of chunk handling
+            report_parsing_error(MessageParser::INVALID_UNCHANGED_TYPE);
+            return false;
+        default:
+            report_parsing_error(MessageParser::INVALID_TYPE_NAME_FORMAT);
+            return false;
+    }
+
+    // build the record as views into the caller's buffer
+    Record record;
+    record.last_record = header & Header::message_end_bit;
+    record.type.tnf = static_cast<RecordType::tnf_t>(header & Header::tnf_bits);
+    if (type_length) {
+        record.type.value = data_buffer.subspan(position, type_length);
+        position += type_length;
+    }
+    if (id_length) {
+        record.id = data_buffer.subspan(position, id_length);
+        position += id_length;
+    }
+    if (payload_length) {
+        record.payload = data_buffer.subspan(position, payload_length);
+        position += payload_length;
+    }
+
+    // the record is complete - commit the new parse position before
+    // handing it out
+    _position = position;
+    _first_record_parsed = true;
+
+    bool carry_on = true;
+    if (_delegate) {
+        carry_on = _delegate->on_record_parsed(record);
+    }
+
+    if (record.last_record) {
+        _status = MESSAGE_COMPLETE;
+        return false;
+    }
+    if (!carry_on) {
+        _status = PARSING_STOPPED;
+        return false;
+    }
+
+    return true;
+}
+
+void StreamingMessageParser::report_parsing_error(MessageParser::error_t error)
+{
+    _status = PARSING_ERROR;
+    if (_delegate) {
+        _delegate->on_parsing_error(error);
+    }
+}
+
+} // namespace ndef
+} // namespace nfc
+} // namespace mbed
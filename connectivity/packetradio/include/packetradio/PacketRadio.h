@@ -0,0 +1,231 @@
+/**
+ * Copyright (c) 2021, Arm Limited and affiliates.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PACKETRADIO_H_
+#define PACKETRADIO_H_
+
+/** @addtogroup PacketRadio
+ * Parent class for a raw packet radio driver
+ *  @{
+ */
+
+#include <stdint.h>
+#include "platform/Callback.h"
+
+/** Radio configuration for raw packet operation.
+ *
+ * Deliberately modulation-agnostic: it carries what every sub-GHz
+ * transceiver needs for a proprietary packet protocol, and drivers map it
+ * onto their modem. Modulation-specific tuning (spreading factors, coding
+ * rates, deviation) stays in the concrete driver's own configuration
+ * interface, as it does for LoRaRadio.
+ */
+typedef struct packet_radio_config {
+    /** Carrier frequency in Hz */
+    uint32_t frequency_hz;
+
+    /** Raw bitrate in bits per second; 0 keeps the driver default */
+    uint32_t bitrate;
+
+    /** Channel bandwidth in Hz; 0 keeps the driver default */
+    uint32_t bandwidth_hz;
+
+    /** Transmit power in dBm */
+    int8_t tx_power_dbm;
+
+    /** Preamble length in symbols */
+    uint16_t preamble_len;
+
+    /** Largest payload the receiver accepts, in bytes */
+    uint8_t max_payload;
+
+    /** Append and verify a hardware CRC */
+    bool crc_on;
+
+    /** Sync word distinguishing this network, most significant byte first */
+    const uint8_t *sync_word;
+
+    /** Length of the sync word in bytes */
+    uint8_t sync_word_len;
+} packet_radio_config_t;
+
+/** A received frame, handed to the rx_done callback without copying.
+ *
+ * The data pointer aims into the buffer the radio DMA'd the frame into
+ * and stays valid only for the duration of the callback: consume it or
+ * swap it away there, never store the pointer.
+ */
+typedef struct packet_radio_frame {
+    /** Frame payload, valid for the duration of the rx_done callback */
+    uint8_t *data;
+
+    /** Payload length in bytes */
+    uint16_t length;
+
+    /** Received signal strength in dBm */
+    int16_t rssi;
+
+    /** Signal to noise ratio in dB, where the modem measures one */
+    int8_t snr;
+
+    /** Radio timebase capture of the frame's sync-word detection, in
+     * microseconds - the anchor for slot timing in TDMA-style protocols */
+    uint32_t timestamp;
+} packet_radio_frame_t;
+
+/** Report of a PacketRadio driver's events to the protocol layer.
+ * All callbacks run in the driver's interrupt or event context.
+ */
+typedef struct packet_radio_events {
+    /** The frame given to send() left the antenna; the buffer is the
+     * caller's again */
+    mbed::Callback<void()> tx_done;
+
+    /** A frame was received. Zero-copy: see packet_radio_frame_t */
+    mbed::Callback<void(const packet_radio_frame_t &frame)> rx_done;
+
+    /** The transmission could not be completed in time */
+    mbed::Callback<void()> tx_timeout;
+
+    /** The receive window closed without a frame */
+    mbed::Callback<void()> rx_timeout;
+
+    /** A frame arrived but failed CRC or length checks */
+    mbed::Callback<void(const packet_radio_frame_t &frame)> rx_error;
+} packet_radio_events_t;
+
+/** Interface for a raw packet radio.
+ *
+ * This is the radio abstraction of the LoRaWAN stack (LoRaRadio) factored
+ * free of the MAC, for proprietary low-power protocols that want the same
+ * optimized transceiver path without carrying the LoRaWAN stack: the
+ * concrete transceiver drivers under connectivity/drivers/lora implement
+ * both interfaces over one SPI/DMA backend.
+ *
+ * Three properties distinguish it from a socket-style interface:
+ *
+ * - Zero-copy handoff. send() lends the caller's buffer to the radio
+ *   until tx_done; rx_done lends the radio's DMA buffer to the protocol
+ *   for the duration of the callback. No frame is staged through an
+ *   intermediate copy in either direction.
+ * - Scheduled transmission. send_at() commits a frame to leave at a
+ *   microsecond timestamp on the radio's own timebase (time_us()),
+ *   as TDMA slots and precise ACK timing require; rx_done frames carry
+ *   the matching sync-word capture timestamp.
+ * - Duty-cycled listening. listen() puts the receiver into its hardware
+ *   sniff mode, waking periodically to sample for preamble and sleeping
+ *   between samples without CPU involvement - idle listening at microamp
+ *   average current.
+ */
+class PacketRadio {
+
+public:
+    virtual ~PacketRadio() {}
+
+    /** Registers radio events with the radio driver and initializes the
+     * hardware.
+     *
+     * @param events Struct containing the driver callback functions.
+     * @return 0 on success, a negative error code on failure.
+     */
+    virtual int init_radio(packet_radio_events_t *events) = 0;
+
+    /** Resets the radio module. */
+    virtual void radio_reset() = 0;
+
+    /** Put the radio in sleep mode, retaining configuration. */
+    virtual void sleep() = 0;
+
+    /** Put the radio in standby mode, ready to transmit or receive. */
+    virtual void standby() = 0;
+
+    /** Apply a packet configuration.
+     *
+     * @param config The configuration to apply.
+     * @return 0 on success, a negative error code if the transceiver
+     *         cannot satisfy it.
+     */
+    virtual int configure(const packet_radio_config_t &config) = 0;
+
+    /** Checks whether the given RF frequency is supported.
+     *
+     * @param frequency The frequency in Hz.
+     * @return true if supported.
+     */
+    virtual bool check_rf_frequency(uint32_t frequency) = 0;
+
+    /** Read the radio's microsecond timebase, the clock send_at()
+     * schedules against and rx timestamps are captured on.
+     *
+     * @return Timebase value in microseconds; wraps modulo 2^32.
+     */
+    virtual uint32_t time_us() = 0;
+
+    /** Transmit a frame as soon as possible.
+     *
+     * Zero-copy: the buffer is lent to the radio and must not be touched
+     * until the tx_done or tx_timeout event returns it.
+     *
+     * @param data   Frame payload.
+     * @param length Payload length in bytes.
+     * @return 0 if the transmission was committed, a negative error code
+     *         if the radio was busy.
+     */
+    virtual int send(uint8_t *data, uint16_t length) = 0;
+
+    /** Transmit a frame at an exact time.
+     *
+     * The driver arms the transceiver early and releases the frame so the
+     * preamble starts at the given timestamp, with the sub-slot accuracy
+     * TDMA protocols need. Buffer ownership follows send().
+     *
+     * @param data   Frame payload.
+     * @param length Payload length in bytes.
+     * @param at_us  Start time on the time_us() timebase.
+     * @return 0 if the transmission was committed, a negative error code
+     *         if the radio was busy or the timestamp already passed.
+     */
+    virtual int send_at(uint8_t *data, uint16_t length, uint32_t at_us) = 0;
+
+    /** Enter continuous receive, reporting frames through rx_done. */
+    virtual void receive() = 0;
+
+    /** Enter duty-cycled receive.
+     *
+     * The transceiver alternates between sampling for preamble and
+     * sleeping, entirely in hardware; a detected preamble holds the
+     * receiver on for the frame, which is reported through rx_done.
+     * Transmitted preambles must exceed sleep_period_us for reliable
+     * wake-up.
+     *
+     * @param rx_period_us    Time spent listening per cycle.
+     * @param sleep_period_us Time spent sleeping per cycle.
+     * @return 0 on success, a negative error code if the transceiver has
+     *         no duty-cycled mode.
+     */
+    virtual int listen(uint32_t rx_period_us, uint32_t sleep_period_us) = 0;
+
+    /** Generate a 32-bit random value from radio noise.
+     *
+     * @return 32-bit random value.
+     */
+    virtual uint32_t random() = 0;
+};
+
+/** @}*/
+
+#endif // PACKETRADIO_H_
@@ -24,10 +24,15 @@
 #include "hal/analogin_api.h"
 #include "platform/SingletonPtr.h"
 #include "platform/PlatformMutex.h"
+#include "platform/Callback.h"
 
+#include <chrono>
 #include <cmath>
 
 namespace mbed {
+
+class Ticker;
+
 /** \defgroup mbed-os-public Public API */
 
 /** \defgroup drivers-public-api Drivers
@@ -101,6 +106,45 @@ public:
      */
     unsigned short read_u16();
 
+    /** Read a burst of samples back-to-back into a buffer.
+     *
+     * The bus mutex is taken once for the whole burst, so the per-sample
+     * overhead is just the conversion itself.
+     *
+     * @param buffer Buffer to fill with normalized 16-bit samples
+     * @param count Number of samples to take
+     */
+    void read_burst(unsigned short *buffer, size_t count);
+
+    /** Start continuous sampling with double-buffered delivery.
+     *
+     * Samples are taken at a fixed period from a ticker interrupt and
+     * written into the caller's buffer, which is treated as two halves:
+     * while one half is being filled, the other is handed to the callback,
+     * so the consumer always has a full sample period times half the buffer
+     * to process data before it is overwritten. The callback runs in
+     * interrupt context and is passed the filled half and its length.
+     *
+     * The analogin HAL has no asynchronous or DMA entry points, so pacing
+     * is done in software; the achievable rate is bounded by the conversion
+     * plus interrupt overhead.
+     *
+     * @param buffer Buffer for at least two samples, split internally into halves
+     * @param count Total capacity of the buffer in samples
+     * @param sample_period Time between consecutive samples
+     * @param callback Function called from interrupt context with each filled half
+     * @return 0 on success, -1 if sampling is already running or the
+     *         parameters are invalid
+     */
+    int start_sampling(unsigned short *buffer, size_t count, std::chrono::microseconds sample_period, mbed::Callback<void(const unsigned short *, size_t)> callback);
+
+    /** Stop continuous sampling started with start_sampling().
+     *
+     * Samples already delivered remain valid; a partially filled half is
+     * discarded.
+     */
+    void stop_sampling();
+
     /**
      * Read the input voltage in volts. The output depends on the target board's
      * ADC reference voltage (typically equal to supply voltage). The ADC reference voltage
@@ -151,6 +195,7 @@ public:
 
     virtual ~AnalogIn()
     {
+        stop_sampling();
         lock();
         analogin_free(&_adc);
         unlock();
@@ -168,11 +213,21 @@ protected:
         _mutex->unlock();
     }
 
+    /** Take one conversion from the sampling ticker interrupt */
+    void _sample_isr();
+
     analogin_t _adc;
     static SingletonPtr<PlatformMutex> _mutex;
 
     float _vref;
 
+    /* Continuous sampling state; the ticker only exists while sampling runs */
+    Ticker *_sampler = nullptr;
+    unsigned short *_sample_buffer = nullptr;
+    size_t _sample_count = 0;
+    size_t _sample_index = 0;
+    mbed::Callback<void(const unsigned short *, size_t)> _sample_cb;
+
 #endif //!defined(DOXYGEN_ONLY)
 
 };
@@ -0,0 +1,145 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_AUDIO_STREAM_H
+#define MBED_AUDIO_STREAM_H
+
+#include "platform/platform.h"
+
+#if DEVICE_I2S || defined(DOXYGEN_ONLY)
+
+#include "hal/i2s_api.h"
+#include "platform/Callback.h"
+#include "platform/NonCopyable.h"
+
+namespace mbed {
+/**
+ * \defgroup drivers_AudioStream AudioStream class
+ * \ingroup drivers-public-api
+ * @{
+ */
+
+/** A continuous audio stream over I2S with double-buffered callbacks.
+ *
+ * The peripheral clocks samples between the wire and a caller-provided
+ * ring buffer by circular DMA; the stream never pauses and never needs
+ * per-sample attention. At the ring's half and full points the data
+ * callback receives the half that just became idle - fill it (transmit)
+ * or drain it (receive) before the other half finishes, and playback is
+ * glitch-free with the CPU cost of one memcpy-sized callback per period.
+ *
+ * Missed deadlines are counted, not hidden: a callback that arrives late,
+ * or a hardware FIFO underrun/overrun, increments the xrun counter, so
+ * "occasionally crackles" turns into a number that can gate a release.
+ *
+ * One AudioStream is one direction; full duplex is a transmit stream and
+ * a receive stream constructed on the same clock pins, with the second
+ * attaching as clock slave.
+ *
+ * Example: 48kHz stereo playback, 10ms per callback
+ * @code
+ * static int16_t ring[2 * 2 * 480];   // two halves of 480 stereo frames
+ * AudioStream out(AudioStream::Transmit, D11, D12, D13);
+ * out.configure(48000, 16);
+ * out.start(ring, sizeof(ring), fill_half);
+ * @endcode
+ *
+ * @note Synchronization level: Not protected. The data callback runs in
+ *       interrupt context and must finish well inside one half-buffer
+ *       period.
+ */
+class AudioStream : private NonCopyable<AudioStream> {
+public:
+    /** Direction of the stream */
+    enum Direction {
+        Transmit, /**< Memory to wire */
+        Receive   /**< Wire to memory */
+    };
+
+    /** Create a stream on the given I2S pins.
+     *
+     *  @param direction Whether this stream plays or records.
+     *  @param data      Serial data pin.
+     *  @param ws        Word select / frame sync pin.
+     *  @param sck       Bit clock pin.
+     *  @param mclk      Master clock output pin, or NC if unused.
+     */
+    AudioStream(Direction direction, PinName data, PinName ws, PinName sck, PinName mclk = NC);
+
+    ~AudioStream();
+
+    /** Configure the audio format. Only valid while stopped.
+     *
+     *  @param sample_rate Frame rate in Hz, for example 48000.
+     *  @param word_bits   Bits per sample: 16, 24 or 32.
+     *  @param channels    Channels per frame, defaulting to stereo.
+     *  @param format      Frame format, defaulting to standard I2S.
+     *
+     *  @return 0 on success, -1 if the combination is not supported.
+     */
+    int configure(uint32_t sample_rate, uint8_t word_bits, uint8_t channels = 2,
+                  i2s_format_t format = I2S_PHILIPS);
+
+    /** Start streaming over the given ring buffer.
+     *
+     * The buffer is split in two halves; on each half and full point of
+     * the DMA ring the callback receives the idle half to fill or drain.
+     * The buffer must stay valid and DMA-reachable until stop() - on
+     * D-cache cores place it with DmaBuffer alignment or in the
+     * non-cacheable DMA pool.
+     *
+     *  @param buffer Ring buffer holding a whole number of frames per half.
+     *  @param length Size of the ring buffer in bytes.
+     *  @param data_fn Callback receiving (half pointer, half length in
+     *                 bytes), called in interrupt context.
+     *
+     *  @return 0 on success, -1 if already streaming.
+     */
+    int start(void *buffer, size_t length, Callback<void(void *, size_t)> data_fn);
+
+    /** Stop streaming and silence the interface. */
+    void stop();
+
+    /** Check whether the stream is running. */
+    bool active();
+
+    /** Get the number of missed deadlines since start.
+     *
+     * Counts hardware FIFO underruns (transmit) or overruns (receive) and
+     * half-buffer periods whose callback was not serviced in time. Zero
+     * over a long run is the definition of glitch-free.
+     */
+    uint32_t xruns() const;
+
+private:
+    static void _irq(void *context, i2s_event_t event);
+    void handle(i2s_event_t event);
+
+    i2s_t _i2s;
+    uint8_t *_buffer;
+    size_t _half_length;
+    Callback<void(void *, size_t)> _data_fn;
+    i2s_event_t _last_event;
+    bool _started;
+    volatile uint32_t _xruns;
+};
+
+/** @}*/
+
+} // namespace mbed
+
+#endif // DEVICE_I2S || DOXYGEN_ONLY
+#endif // MBED_AUDIO_STREAM_H
@@ -27,6 +27,7 @@
 #include "drivers/InterruptIn.h"
 #include "platform/PlatformMutex.h"
 #include "platform/CircularBuffer.h"
+#include "platform/Span.h"
 #include "platform/NonCopyable.h"
 
 #ifndef MBED_CONF_DRIVERS_UART_SERIAL_RXBUF_SIZE
@@ -37,6 +38,10 @@
 #define MBED_CONF_DRIVERS_UART_SERIAL_TXBUF_SIZE  256
 #endif
 
+#ifndef MBED_CONF_DRIVERS_UART_SERIAL_RX_DMA_CHUNK_SIZE
+#define MBED_CONF_DRIVERS_UART_SERIAL_RX_DMA_CHUNK_SIZE  16
+#endif
+
 namespace mbed {
 /**
  * \defgroup drivers_BufferedSerial BufferedSerial class
@@ -125,6 +130,84 @@ public:
      */
     ssize_t read(void *buffer, size_t length) override;
 
+    /** Write the contents of a Span to a file
+     *
+     *  Equivalent to write(buffer.data(), buffer.size()). With a
+     *  fixed-extent Span the length is a compile-time constant, letting
+     *  the compiler fold the bounds handling for small transfers.
+     *
+     *  @param buffer   The Span to write from
+     *  @return         The number of bytes written, negative error on failure
+     */
+    template<ptrdiff_t Extent>
+    ssize_t write(mbed::Span<const uint8_t, Extent> buffer)
+    {
+        return write(buffer.data(), buffer.size());
+    }
+
+    /** Read the contents of a file into a Span
+     *
+     *  Equivalent to read(buffer.data(), buffer.size()).
+     *
+     *  @param buffer   The Span to read in to
+     *  @return         The number of bytes read, 0 at end of file, negative
+     *                  error on failure
+     */
+    template<ptrdiff_t Extent>
+    ssize_t read(mbed::Span<uint8_t, Extent> buffer)
+    {
+        return read(buffer.data(), buffer.size());
+    }
+
+    /** Claim direct read access to the data buffered in the receive ring.
+     *
+     *  Zero-copy variant of read(): instead of copying buffered data out,
+     *  this returns a pointer to the longest contiguous run of received
+     *  bytes so protocol parsers can consume them in place. The claimed
+     *  bytes stay in the ring and must be returned with read_release()
+     *  once consumed; only then is the space reused for reception. The ring
+     *  contents may wrap, so a following claim can return more data even
+     *  when nothing new has been received.
+     *
+     *  Follows the same blocking semantics as read():
+     *
+     *  * if no data is available, and non-blocking set, return -EAGAIN
+     *  * if no data is available, and blocking set, wait until data is
+     *    available
+     *
+     *  @param buffer   Updated to point at the first buffered byte
+     *  @return         The number of contiguous bytes readable from @p buffer,
+     *                  negative error on failure
+     */
+    ssize_t read_claim(const char **buffer);
+
+    /** Release bytes previously claimed with read_claim().
+     *
+     *  @param length   The number of bytes consumed, at most the length
+     *                  returned by the preceding read_claim()
+     *  @return         The number of bytes released
+     */
+    ssize_t read_release(size_t length);
+
+#if DEVICE_SERIAL_ASYNCH || defined(DOXYGEN_ONLY)
+    /** Switch reception from per-character interrupts to DMA-driven chunks.
+     *
+     *  When enabled, the receive ring is refilled through the asynchronous
+     *  serial HAL with DMA_USAGE_ALWAYS in fixed-size chunks instead of one
+     *  interrupt per character, which keeps the CPU out of the hot path at
+     *  high baud rates. The serial HAL does not expose idle-line detection,
+     *  so delivery latency is bounded by the chunk fill time - keep
+     *  MBED_CONF_DRIVERS_UART_SERIAL_RX_DMA_CHUNK_SIZE small if reception is
+     *  bursty. Data arriving while the ring is full is dropped, as it is in
+     *  interrupt mode when the peripheral FIFO overruns.
+     *
+     *  @param enabled  true to refill the receive ring by DMA, false to
+     *                  return to per-character interrupts
+     *  @return         0 on success
+     */
+    int enable_rx_dma(bool enabled);
+#endif
+
     /** Close a file
      *
      *  @return         0 on success, negative error code on failure
@@ -337,6 +420,17 @@ private:
     bool _rx_irq_enabled = false;
     InterruptIn *_dcd_irq = nullptr;
 
+#if DEVICE_SERIAL_ASYNCH
+    /** Completion handler for one DMA receive chunk; pushes the chunk into
+     * the receive ring and restarts reception.
+     */
+    void rx_dma_handler(int event);
+
+    /** Staging area one DMA transfer long, drained into _rxbuf per chunk */
+    uint8_t _rx_dma_chunk[MBED_CONF_DRIVERS_UART_SERIAL_RX_DMA_CHUNK_SIZE];
+    bool _rx_dma_enabled = false;
+#endif
+
     /** Device Hanged up
      *  Determines if the device hanged up on us.
      *
@@ -26,6 +26,28 @@
 #include "platform/Callback.h"
 #include "platform/PlatformMutex.h"
 
+#ifndef MBED_CONF_DRIVERS_CAN_RX_RING_SIZE
+/** Frames buffered between the receive interrupt and read(); 0 keeps the
+ * ring compiled out. Configurable through mbed_app.json.
+ */
+#define MBED_CONF_DRIVERS_CAN_RX_RING_SIZE 0
+#endif
+
+#ifndef MBED_CONF_DRIVERS_CAN_DIAG_RING_SIZE
+/** Frames kept in the diagnostic capture ring; 0 keeps bus diagnostics
+ * compiled out. Configurable through mbed_app.json.
+ */
+#define MBED_CONF_DRIVERS_CAN_DIAG_RING_SIZE 0
+#endif
+
+#if MBED_CONF_DRIVERS_CAN_RX_RING_SIZE > 0 || MBED_CONF_DRIVERS_CAN_DIAG_RING_SIZE > 0
+#include "platform/CircularBuffer.h"
+#endif
+
+#if MBED_CONF_DRIVERS_CAN_DIAG_RING_SIZE > 0
+#include "hal/ticker_api.h"
+#endif
+
 namespace mbed {
 
 /**
@@ -34,6 +56,25 @@ namespace mbed {
  * @{
  */
 
+#if MBED_CONF_DRIVERS_CAN_DIAG_RING_SIZE > 0 || defined(DOXYGEN_ONLY)
+/** A frame captured for diagnostics */
+struct can_diag_frame_t {
+    CANMessage msg;         /**< The captured frame */
+    timestamp_t timestamp;  /**< Reception time in us, in the microsecond ticker's time base */
+};
+
+/** Bus-health counters maintained from the CAN error interrupts */
+struct can_diag_stats_t {
+    uint32_t bus_error_cnt;          /**< Bus (bit/stuff/form/CRC) error interrupts */
+    uint32_t arb_lost_cnt;           /**< Arbitration lost interrupts */
+    uint32_t overrun_cnt;            /**< Data overrun interrupts */
+    uint32_t error_warning_cnt;      /**< Error warning interrupts */
+    uint32_t error_passive_cnt;      /**< Error passive interrupts */
+    timestamp_t last_bus_error_time; /**< Time of the most recent bus error */
+    timestamp_t last_arb_lost_time;  /**< Time of the most recent arbitration loss */
+};
+#endif
+
 /** A can bus client, used for communicating with can devices
  */
 class CAN
@@ -148,6 +189,24 @@ public:
      */
     int read(CANMessage &msg, int handle = 0);
 
+    /** Read a burst of CANMessages from the bus.
+     *
+     *  Dequeues up to count frames in one locked call, so high-rate
+     *  listeners pay the mutex and call overhead once per burst rather
+     *  than once per frame. When the receive ring is enabled
+     *  (MBED_CONF_DRIVERS_CAN_RX_RING_SIZE > 0), frames accepted by the
+     *  hardware filters are staged there from the receive interrupt and
+     *  this drains the ring before polling the peripheral, so bursts
+     *  longer than the controller's FIFO are not dropped between reads.
+     *
+     *  @param msgs Array to read the frames into
+     *  @param count Capacity of the array
+     *  @param handle message filter handle (0 for any message)
+     *
+     *  @returns the number of frames read
+     */
+    int read_burst(CANMessage *msgs, int count, int handle = 0);
+
     /** Reset CAN interface.
      *
      * To use after error overflow.
@@ -205,6 +264,51 @@ public:
      */
     void attach(Callback<void()> func, IrqType type = IrqType::RxIrq);
 
+#if MBED_CONF_DRIVERS_CAN_DIAG_RING_SIZE > 0 || defined(DOXYGEN_ONLY)
+    /** Start or stop diagnostic capture.
+     *
+     *  While enabled, the error, arbitration-lost and overrun interrupts
+     *  are counted and timestamped into the statistics readable with
+     *  diag_stats(), and received frames are copied with a microsecond
+     *  timestamp into a fixed-size ring holding the last
+     *  MBED_CONF_DRIVERS_CAN_DIAG_RING_SIZE frames, readable with
+     *  diag_read(). Capture runs alongside normal traffic: frames are
+     *  recorded where they are already dequeued (from the receive
+     *  interrupt when the receive ring is enabled, from read() otherwise)
+     *  so nothing is stolen from the application.
+     *
+     *  Error interrupts the application has no callback attached to are
+     *  enabled for the duration of the capture. Deep sleep is locked
+     *  while capture is enabled.
+     *
+     *  @param enable true to start capturing, false to stop
+     */
+    void diag_capture(bool enable);
+
+    /** Read a snapshot of the diagnostic counters.
+     *
+     *  @param stats filled with the counters accumulated since
+     *  diag_capture(true) or the last diag_reset()
+     */
+    void diag_stats(can_diag_stats_t &stats);
+
+    /** Drain captured frames from the diagnostic ring.
+     *
+     *  The ring holds the most recent frames; older frames are overwritten
+     *  once it is full, so on a fault it contains the traffic leading up
+     *  to the error.
+     *
+     *  @param frames Array to read the captured frames into
+     *  @param count Capacity of the array
+     *
+     *  @returns the number of frames read
+     */
+    int diag_read(can_diag_frame_t *frames, int count);
+
+    /** Clear the diagnostic counters and captured frames. */
+    void diag_reset();
+#endif
+
     static void _irq_handler(uint32_t id, CanIrqType type);
 
 #if !defined(DOXYGEN_ONLY)
@@ -215,6 +319,26 @@ protected:
     can_t               _can;
     Callback<void()>    _irq[IrqType::IrqCnt];
     PlatformMutex       _mutex;
+#if MBED_CONF_DRIVERS_CAN_RX_RING_SIZE > 0
+    /** Frames drained from the peripheral in the receive interrupt, waiting
+     * for read()/read_burst()
+     */
+    CircularBuffer<CANMessage, MBED_CONF_DRIVERS_CAN_RX_RING_SIZE> _rxring;
+#endif
+#if MBED_CONF_DRIVERS_CAN_DIAG_RING_SIZE > 0
+    void diag_count(CanIrqType type, timestamp_t now);
+    void diag_frame(const CANMessage &msg, timestamp_t timestamp);
+    static bool diag_uses_irq(CanIrqType type);
+
+    can_diag_stats_t _diag_stats = {};
+    /** The last MBED_CONF_DRIVERS_CAN_DIAG_RING_SIZE frames seen on the
+     * bus while capture is enabled; oldest overwritten first
+     */
+    CircularBuffer<can_diag_frame_t, MBED_CONF_DRIVERS_CAN_DIAG_RING_SIZE> _diag_ring;
+    /** Error interrupts enabled by diag_capture() rather than attach() */
+    uint32_t _diag_irq_mask = 0;
+    bool _diag_capture = false;
+#endif
 #endif
 };
 
@@ -0,0 +1,209 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_DISPLAY_PIPELINE_H
+#define MBED_DISPLAY_PIPELINE_H
+
+#include "platform/platform.h"
+
+#if DEVICE_SPI || defined(DOXYGEN_ONLY)
+
+#include "drivers/SPI.h"
+#include "platform/Callback.h"
+#include "platform/NonCopyable.h"
+#include "platform/Transaction.h"
+
+/** Maximum number of dirty rectangles tracked per frame. Further damage is
+ * merged into the nearest existing rectangle. */
+#ifndef MBED_CONF_DRIVERS_DISPLAY_PIPELINE_MAX_RECTS
+#define MBED_CONF_DRIVERS_DISPLAY_PIPELINE_MAX_RECTS 8
+#endif
+
+/** Number of scatter-gather segments (framebuffer rows) submitted per
+ * chained DMA transfer during a flush */
+#ifndef MBED_CONF_DRIVERS_DISPLAY_PIPELINE_SEGMENTS
+#define MBED_CONF_DRIVERS_DISPLAY_PIPELINE_SEGMENTS 16
+#endif
+
+namespace mbed {
+/**
+ * \defgroup drivers_DisplayPipeline DisplayPipeline class
+ * \ingroup drivers-public-api
+ * @{
+ */
+
+/** A double-buffered, partial-update frame pipeline for SPI displays.
+ *
+ * Redrawing a full frame over SPI costs the same whether one pixel changed
+ * or all of them. DisplayPipeline tracks damage instead: drawing code
+ * renders into the back buffer and declares what it touched with
+ * mark_dirty(), and flush() sends only the accumulated dirty rectangles -
+ * typically a small fraction of the panel.
+ *
+ * Rectangles within a flush go out as chained scatter-gather DMA
+ * transfers (see SPI::transfer_sequence): full-width rectangles stream as
+ * one contiguous segment, partial-width ones as one segment per row, with
+ * the panel-specific window-set callback invoked between rectangles. The
+ * CPU's only work per flush is assembling segment descriptors; drawing
+ * into the back buffer may continue while the previous flush streams from
+ * the front buffer.
+ *
+ * The pipeline is panel-agnostic: it drives any controller with an
+ * addressable write window (ST7789, ILI9341 and similar) through the
+ * set_window callback, which typically sets CASET/RASET and issues RAMWR.
+ * The controller must keep its address counter across chip-select
+ * deassertions, as chained transfers re-assert chip select per burst.
+ *
+ * Example:
+ * @code
+ * static uint16_t frame_a[240 * 240];
+ * static uint16_t frame_b[240 * 240];
+ * DisplayPipeline display(spi, 240, 240, 2, frame_a, frame_b, set_window);
+ *
+ * uint16_t *frame = (uint16_t *)display.frame();
+ * // ... draw into frame ...
+ * display.mark_dirty(20, 40, 64, 16);
+ * display.flush();
+ * @endcode
+ *
+ * @note Synchronization level: Not protected - draw, mark_dirty and flush
+ *       from a single context. The set_window callback runs in interrupt
+ *       context during chained flushes and must only perform brief
+ *       blocking writes.
+ */
+class DisplayPipeline : private NonCopyable<DisplayPipeline> {
+public:
+    /** A dirty region, in pixels. */
+    struct Rect {
+        uint16_t x;
+        uint16_t y;
+        uint16_t w;
+        uint16_t h;
+    };
+
+    /** Create a pipeline over two caller-provided frame buffers.
+     *
+     * Each buffer must hold width * height * bytes_per_pixel bytes and be
+     * usable by the SPI DMA - on D-cache cores place them with DmaBuffer
+     * alignment or in the non-cacheable DMA pool.
+     *
+     *  @param spi             SPI peripheral connected to the panel.
+     *  @param width           Panel width in pixels.
+     *  @param height          Panel height in pixels.
+     *  @param bytes_per_pixel Size of one pixel in the buffers (2 for RGB565).
+     *  @param buffer_a        First frame buffer.
+     *  @param buffer_b        Second frame buffer.
+     *  @param set_window      Panel-specific callback setting the write
+     *                         window to the given rectangle and starting a
+     *                         pixel write.
+     */
+    DisplayPipeline(SPI &spi, uint16_t width, uint16_t height, uint8_t bytes_per_pixel,
+                    void *buffer_a, void *buffer_b,
+                    Callback<void(const Rect &)> set_window);
+
+    /** Get the back buffer to draw into.
+     *
+     * Stable between flushes; flush() swaps buffers and copies the flushed
+     * regions across, so the returned buffer always holds the complete
+     * current frame.
+     */
+    uint8_t *frame();
+
+    /** Accumulate a damaged region to be sent by the next flush.
+     *
+     * Overlapping and touching regions coalesce; when the rectangle table
+     * is full, the new region merges into the rectangle it grows least.
+     * The region is clipped to the panel.
+     *
+     *  @param x Left edge in pixels.
+     *  @param y Top edge in pixels.
+     *  @param w Width in pixels.
+     *  @param h Height in pixels.
+     */
+    void mark_dirty(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+
+    /** Mark the whole panel damaged, forcing a full redraw on next flush. */
+    void mark_all_dirty();
+
+    /** Send the accumulated dirty rectangles to the panel.
+     *
+     * Swaps buffers, so drawing may continue immediately in the returned
+     * frame() while the flush streams in the background. With SPI async
+     * support the call returns once the first transfer is started;
+     * otherwise it blocks until the frame has been written.
+     *
+     *  @param done Invoked when the flush has completed, possibly in
+     *              interrupt context. Pass nullptr for none.
+     *
+     *  @return true if a flush was started (or nothing was dirty);
+     *          false if a flush is still in progress.
+     */
+    bool flush(Callback<void()> done = nullptr);
+
+    /** Check whether a flush is currently streaming. */
+    bool flushing() const;
+
+    /** Get the total number of pixels sent since construction.
+     *
+     * Compare against frames_flushed() * width * height to measure the
+     * bandwidth saved by partial updates.
+     */
+    uint32_t pixels_flushed() const;
+
+    /** Get the number of completed flushes since construction. */
+    uint32_t frames_flushed() const;
+
+private:
+    void merge(Rect &into, const Rect &from);
+    void copy_rect_to_back(const Rect &r);
+    void flush_blocking();
+#if DEVICE_SPI_ASYNCH
+    void start_rect();
+    void next_batch();
+    void transfer_done(int event);
+#endif
+
+    SPI &_spi;
+    uint16_t _width;
+    uint16_t _height;
+    uint8_t _bpp;
+    uint8_t *_front;
+    uint8_t *_back;
+    Callback<void(const Rect &)> _set_window;
+    Callback<void()> _done;
+
+    Rect _rects[MBED_CONF_DRIVERS_DISPLAY_PIPELINE_MAX_RECTS];
+    uint8_t _rect_count;
+    Rect _flush_rects[MBED_CONF_DRIVERS_DISPLAY_PIPELINE_MAX_RECTS];
+    uint8_t _flush_count;
+
+    volatile bool _flushing;
+    uint8_t _cur_rect;
+    uint16_t _cur_row;
+#if DEVICE_SPI_ASYNCH
+    transaction_t _segments[MBED_CONF_DRIVERS_DISPLAY_PIPELINE_SEGMENTS];
+#endif
+
+    uint32_t _pixels;
+    uint32_t _frames;
+};
+
+/** @}*/
+
+} // namespace mbed
+
+#endif // DEVICE_SPI || DOXYGEN_ONLY
+#endif // MBED_DISPLAY_PIPELINE_H
@@ -0,0 +1,135 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_DMACOPY_H
+#define MBED_DMACOPY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "device.h"
+
+namespace mbed {
+/** Asynchronous memory moves offloaded to the DMA controller
+ *
+ * On targets with the generic DMA HAL (DEVICE_DMA), large copies and
+ * fills are handed to a DMA channel and run while the CPU keeps
+ * computing; the returned handle reports completion without taking a
+ * critical section. Small moves, and all moves on targets without
+ * DEVICE_DMA or when no channel is free, are done synchronously on the
+ * CPU and return an already-completed handle, so callers need no
+ * fallback path of their own.
+ *
+ * Example:
+ * @code
+ * #include "mbed.h"
+ *
+ * void compose(uint32_t *frame, const uint32_t *background, size_t pixels)
+ * {
+ *     auto move = mbed::dma::copy(frame, background, pixels * 4);
+ *     prepare_overlays();        // overlaps with the copy
+ *     move.wait();
+ *     draw_overlays(frame);
+ * }
+ * @endcode
+ */
+namespace dma {
+
+/** Moves of fewer bytes than this are done on the CPU - below it the
+ * channel programming overhead exceeds the copy itself.
+ */
+#ifndef DMA_COPY_THRESHOLD
+#define DMA_COPY_THRESHOLD 256
+#endif
+
+/** Maximum number of moves that can be in flight at once; further
+ * moves fall back to the CPU.
+ */
+#ifndef DMA_COPY_SLOTS
+#define DMA_COPY_SLOTS 4
+#endif
+
+struct copy_slot_t;
+
+/** Completion handle for a move started with copy() or fill()
+ *
+ * Cheap to copy and valid indefinitely; a default-constructed handle
+ * reports completion.
+ */
+class TransferHandle {
+public:
+    TransferHandle() : _slot(nullptr), _generation(0)
+    {
+    }
+
+    /** Check whether the move has finished
+     *
+     *  Performs a single atomic load - no critical section - so it can
+     *  be polled from any context, including interrupts.
+     *
+     *  @return true once all bytes have been moved
+     */
+    bool done() const;
+
+    /** Busy-wait until the move has finished
+     */
+    void wait() const;
+
+#if !defined(DOXYGEN_ONLY)
+private:
+    TransferHandle(copy_slot_t *slot, uint32_t generation) : _slot(slot), _generation(generation)
+    {
+    }
+
+    friend TransferHandle copy(void *dst, const void *src, size_t n);
+    friend TransferHandle fill(void *dst, uint8_t value, size_t n);
+    friend TransferHandle start_move(copy_slot_t *slot, size_t n);
+
+    copy_slot_t *_slot;
+    uint32_t _generation;
+#endif
+};
+
+/** Copy a memory region, offloading large moves to DMA
+ *
+ * Equivalent to memcpy(dst, src, n) except that moves of at least
+ * DMA_COPY_THRESHOLD bytes run on a DMA channel when one is available,
+ * returning immediately. The regions must not overlap and must stay
+ * valid and unmodified until the handle reports completion.
+ *
+ * @param dst Destination of the copy
+ * @param src Source of the copy
+ * @param n   Number of bytes to copy
+ * @return Handle reporting the completion of the copy
+ */
+TransferHandle copy(void *dst, const void *src, size_t n);
+
+/** Fill a memory region, offloading large fills to DMA
+ *
+ * Equivalent to memset(dst, value, n) with the same offload behavior
+ * as copy(). The region must stay untouched until the handle reports
+ * completion.
+ *
+ * @param dst   Region to fill
+ * @param value Byte value to fill with
+ * @param n     Number of bytes to fill
+ * @return Handle reporting the completion of the fill
+ */
+TransferHandle fill(void *dst, uint8_t value, size_t n);
+
+} // namespace dma
+} // namespace mbed
+
+#endif
@@ -30,8 +30,17 @@
 #include "platform/SingletonPtr.h"
 #include "platform/PlatformMutex.h"
 #include "platform/NonCopyable.h"
+#include "platform/Callback.h"
+#include "platform/CircularBuffer.h"
 #include <algorithm>
 
+#ifndef MBED_CONF_DRIVERS_FLASHIAP_ASYNC_QUEUE_SIZE
+/** Pending erase/program operations held by the asynchronous queue.
+ * Configurable through mbed_app.json.
+ */
+#define MBED_CONF_DRIVERS_FLASHIAP_ASYNC_QUEUE_SIZE 4
+#endif
+
 // Export ROM end address
 #if defined(TOOLCHAIN_GCC_ARM)
 extern uint32_t __etext;
@@ -65,7 +74,7 @@ namespace mbed {
  */
 class FlashIAP : private NonCopyable<FlashIAP> {
 public:
-    constexpr FlashIAP() : _flash(), _page_buf(nullptr)
+    FlashIAP() : _flash(), _page_buf(nullptr)
     {
 
     }
@@ -115,6 +124,47 @@ public:
      */
     int erase(uint32_t addr, uint32_t size);
 
+    /** Queue an erase to be executed incrementally by process()
+     *
+     *  The flash HAL is synchronous, so a multi-sector erase() can stall the
+     *  caller (and, on XIP parts, everything else) for tens of milliseconds
+     *  per sector. erase_async() queues the work instead; each process()
+     *  call erases a single sector, so the caller chooses where the
+     *  per-sector stalls land - typically an event queue or idle loop. The
+     *  callback is invoked with 0 on completion or -1 on the first failed
+     *  sector.
+     *
+     *  @param addr     Address of a sector to begin erasing, must be a valid sector start address
+     *  @param size     Size to erase in bytes, must be a multiple of the sector size
+     *  @param callback Completion callback, called from the process() context
+     *  @return         0 on success, -1 if the queue is full or arguments are invalid
+     */
+    int erase_async(uint32_t addr, uint32_t size, mbed::Callback<void(int)> callback);
+
+    /** Queue a program operation to be executed incrementally by process()
+     *
+     *  Asynchronous counterpart of program(): each process() call programs
+     *  at most one sector's worth of pages. The buffer must stay valid
+     *  until the callback fires with 0 on completion or -1 on failure.
+     *
+     *  @param buffer   Buffer of data to be written, must stay valid until completion
+     *  @param addr     Address of a page to begin writing to, must be a valid page address
+     *  @param size     Size to write in bytes, must be a multiple of the program page size
+     *  @param callback Completion callback, called from the process() context
+     *  @return         0 on success, -1 if the queue is full or arguments are invalid
+     */
+    int program_async(const void *buffer, uint32_t addr, uint32_t size, mbed::Callback<void(int)> callback);
+
+    /** Execute one step of the queued asynchronous operations
+     *
+     *  Performs at most one sector erase or one sector's worth of page
+     *  programming, then returns, invoking completion callbacks as
+     *  operations finish. Call repeatedly until it returns false.
+     *
+     *  @return true if queued work remains, false if the queue is empty
+     */
+    bool process();
+
     /** Get the sector size at the defined address
      *
      *  Sector size might differ at address ranges.
@@ -162,8 +212,17 @@ private:
      */
     bool is_aligned_to_sector(uint32_t addr, uint32_t size);
 
+    /* One queued asynchronous erase or program operation */
+    struct async_op_t {
+        const uint8_t *buffer; /* data still to program, or NULL for an erase */
+        uint32_t addr;
+        uint32_t size;
+        mbed::Callback<void(int)> callback;
+    };
+
     flash_t _flash;
     uint8_t *_page_buf;
+    CircularBuffer<async_op_t, MBED_CONF_DRIVERS_FLASHIAP_ASYNC_QUEUE_SIZE> _async_queue;
     static SingletonPtr<PlatformMutex> _mutex;
 #endif
 };
@@ -0,0 +1,179 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_FLASH_UPDATE_PIPELINE_H
+#define MBED_FLASH_UPDATE_PIPELINE_H
+
+#if DEVICE_FLASH || defined(DOXYGEN_ONLY)
+
+#include "drivers/FlashIAP.h"
+#include "drivers/MbedCRC.h"
+#include "platform/Callback.h"
+#include "platform/NonCopyable.h"
+
+#ifndef MBED_CONF_DRIVERS_FLASH_UPDATE_PIPELINE_BUFFER_SIZE
+/** Size of each of the two staging buffers, in bytes. Must be a multiple
+ * of the flash program page size. Configurable through mbed_app.json.
+ */
+#define MBED_CONF_DRIVERS_FLASH_UPDATE_PIPELINE_BUFFER_SIZE 1024
+#endif
+
+namespace mbed {
+
+/** \addtogroup drivers-public-api */
+/** @{*/
+
+/**
+ * \defgroup drivers_FlashUpdatePipeline FlashUpdatePipeline class
+ * @{
+ */
+
+/** Staged firmware update writer on top of FlashIAP
+ *
+ * Streams a firmware image into flash in three overlapped stages:
+ * an optional decompressor, a running CRC-32 (hardware accelerated
+ * through MbedCRC where available), and FlashIAP programming. Two
+ * staging buffers are used so that while one buffer is being
+ * programmed through FlashIAP's asynchronous queue, the next download
+ * chunk is decompressed and checksummed into the other; each write()
+ * also steps the queued program via FlashIAP::process(), so the erase
+ * and program stalls land between stage work instead of after it.
+ *
+ * The caller feeds chunks as they arrive from the transport; the
+ * pipeline handles sector erase, page alignment and tail padding.
+ * The CRC covers the decompressed image bytes only, not the padding.
+ *
+ * Example:
+ * @code
+ * #include "mbed.h"
+ *
+ * FlashIAP flash;
+ * flash.init();
+ * FlashUpdatePipeline pipeline(&flash);
+ * pipeline.start(UPDATE_SLOT_ADDR);
+ * while (radio.receive(chunk, &size) == 0) {
+ *     pipeline.write(chunk, size);
+ * }
+ * uint32_t crc;
+ * pipeline.finish(&crc);
+ * @endcode
+ *
+ * @note Synchronization level: Not protected
+ */
+class FlashUpdatePipeline : private NonCopyable<FlashUpdatePipeline> {
+public:
+
+    /** Decompressor stage plugged in through start()
+     *
+     *  Called with one input chunk and the free space in the staging
+     *  buffer; must consume the whole chunk and return the number of
+     *  bytes produced, or a negative error code. When the output does
+     *  not fit, return a negative value - the pipeline flushes the
+     *  staged data and retries once with an almost empty buffer, so a
+     *  single chunk may decompress to at most the staging buffer size
+     *  minus one program page.
+     */
+    typedef mbed::Callback<int(const uint8_t *in, uint32_t in_size, uint8_t *out, uint32_t out_capacity)> decompressor_t;
+
+    /** Create a pipeline writing through a flash IAP device
+     *
+     *  @param flash Flash device to program, must be initialized by the caller
+     */
+    FlashUpdatePipeline(FlashIAP *flash);
+
+    ~FlashUpdatePipeline();
+
+    /** Start a new update
+     *
+     *  Allocates the staging buffers and resets the running CRC. Sectors
+     *  are erased on demand as programming reaches them, so no up-front
+     *  erase of the whole slot is performed.
+     *
+     *  @param addr         Destination of the image, must be a sector start address
+     *  @param decompressor Decompressor stage, or nullptr to write chunks as-is
+     *  @return             0 on success, negative error code on failure
+     */
+    int start(uint32_t addr, decompressor_t decompressor = nullptr);
+
+    /** Feed one downloaded chunk through the pipeline
+     *
+     *  Decompresses and checksums the chunk into the staging buffer and,
+     *  when a buffer's worth is ready, hands it to FlashIAP's
+     *  asynchronous queue while staging continues into the other buffer.
+     *
+     *  @param chunk Downloaded data, consumed before the call returns
+     *  @param size  Size of the chunk in bytes
+     *  @return      0 on success, negative error code on failure
+     */
+    int write(const void *chunk, uint32_t size);
+
+    /** Complete the update
+     *
+     *  Flushes the staged remainder, padding the final page with the
+     *  flash erase value, and reports the CRC-32 of the decompressed
+     *  image. The pipeline can be reused with a new start() afterwards.
+     *
+     *  @param crc CRC-32 (ANSI polynomial) of the image written, may be NULL
+     *  @return    0 on success, negative error code on failure
+     */
+    int finish(uint32_t *crc = nullptr);
+
+    /** Get the number of image bytes written so far
+     *
+     *  Counts decompressed bytes, including those still staged.
+     *
+     *  @return Number of bytes accepted by the pipeline
+     */
+    uint32_t get_bytes_written() const;
+
+#if !defined(DOXYGEN_ONLY)
+private:
+    /* Program the page-aligned prefix of the staged data asynchronously,
+     * carrying the unaligned tail over to the other buffer */
+    int flush_staged();
+
+    /* Step the asynchronous queue until the in-flight program completes */
+    int drain();
+
+    /* Erase sectors covering [_erased_until, end) */
+    int erase_until(uint32_t end);
+
+    void program_done(int result);
+
+    FlashIAP *_flash;
+    decompressor_t _decompressor;
+    MbedCRC<POLY_32BIT_ANSI, 32> _crc_ctx;
+    uint32_t _crc;
+    uint8_t *_buf[2];
+    int _fill;              /* buffer currently being staged into */
+    uint32_t _staged;       /* bytes staged in _buf[_fill] */
+    uint32_t _addr;         /* next program address */
+    uint32_t _erased_until;
+    uint32_t _bytes_written;
+    bool _program_pending;
+    int _program_result;
+    bool _running;
+#endif
+};
+
+/** @}*/
+/** @}*/
+
+} /* namespace mbed */
+
+#endif /* DEVICE_FLASH */
+
+#endif /* MBED_FLASH_UPDATE_PIPELINE_H */
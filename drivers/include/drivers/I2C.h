@@ -25,6 +25,7 @@
 #include "hal/i2c_api.h"
 #include "platform/SingletonPtr.h"
 #include "platform/PlatformMutex.h"
+#include "platform/Span.h"
 #include "platform/NonCopyable.h"
 
 #if DEVICE_I2C_ASYNCH
@@ -131,6 +132,28 @@ public:
      */
     int read(int address, char *data, int length, bool repeated = false);
 
+    /** Read from an I2C slave into a Span
+     *
+     *  Equivalent to read(address, data, length) over the whole Span. With
+     *  a fixed-extent Span the transfer length is a compile-time constant,
+     *  which lets the compiler fold the length handling for the common
+     *  small register reads.
+     *
+     *  @param address 8-bit I2C slave address [ addr | 1 ]
+     *  @param data Span receiving the data
+     *  @param repeated Repeated start, true - don't send stop at end
+     *         default value is false.
+     *
+     *  @returns
+     *       0 on success (ack),
+     *       nonzero on failure (nack)
+     */
+    template<ptrdiff_t Extent>
+    int read(int address, mbed::Span<uint8_t, Extent> data, bool repeated = false)
+    {
+        return read(address, reinterpret_cast<char *>(data.data()), data.size(), repeated);
+    }
+
     /** Read a single byte from the I2C bus
      *
      *  @param ack indicates if the byte is to be acknowledged (1 = acknowledge)
@@ -157,6 +180,25 @@ public:
      */
     int write(int address, const char *data, int length, bool repeated = false);
 
+    /** Write a Span to an I2C slave
+     *
+     *  Equivalent to write(address, data, length) over the whole Span.
+     *
+     *  @param address 8-bit I2C slave address [ addr | 0 ]
+     *  @param data Span of data to send
+     *  @param repeated Repeated start, true - do not send stop at end
+     *         default value is false.
+     *
+     *  @returns
+     *       0 on success (ack),
+     *       nonzero on failure (nack)
+     */
+    template<ptrdiff_t Extent>
+    int write(int address, mbed::Span<const uint8_t, Extent> data, bool repeated = false)
+    {
+        return write(address, reinterpret_cast<const char *>(data.data()), data.size(), repeated);
+    }
+
     /** Write single byte out on the I2C bus
      *
      *  @param data data to write out on bus
@@ -168,6 +210,38 @@ public:
      */
     int write(int data);
 
+    /** One segment of a batched transaction list executed by transfer_list().
+     *
+     *  A segment addresses one slave and can carry a write, a read, or a
+     *  write followed by a read (the common register-pointer-write plus
+     *  burst-read pattern). Within a segment, and between segments of a
+     *  list, the bus is kept claimed with repeated starts; a stop condition
+     *  is generated only after the last segment of the list.
+     */
+    struct transaction_segment_t {
+        int address;           /**< 8/10 bit I2C slave address */
+        const char *tx_buffer; /**< Data to write, or NULL if nothing to write */
+        int tx_length;         /**< Number of bytes to write */
+        char *rx_buffer;       /**< Buffer for read data, or NULL if nothing to read */
+        int rx_length;         /**< Number of bytes to read */
+    };
+
+    /** Execute a list of transaction segments back-to-back under one bus lock.
+     *
+     *  The bus mutex is taken once for the whole list and segments are
+     *  joined with repeated starts, so per-call locking and start/stop
+     *  overhead is paid once per list rather than once per register access.
+     *  Execution stops at the first NACKed segment and a stop condition is
+     *  generated to release the bus.
+     *
+     *  @param segments List of segments to execute
+     *  @param count    Number of segments in the list
+     *
+     *  @returns The number of segments completed successfully; equal to
+     *           count if the whole list was executed.
+     */
+    int transfer_list(const transaction_segment_t *segments, int count);
+
     /** Creates a start condition on the I2C bus
      */
     void start(void);
@@ -209,6 +283,24 @@ public:
      */
     int transfer(int address, const char *tx_buffer, int tx_length, char *rx_buffer, int rx_length, const event_callback_t &callback, int event = I2C_EVENT_TRANSFER_COMPLETE, bool repeated = false);
 
+    /** Start nonblocking execution of a transaction list.
+     *
+     *  Asynchronous counterpart of the blocking transfer_list(): segments
+     *  are chained from the transfer-complete interrupt with repeated
+     *  starts in between (DMA-driven where the HAL supports it), and the
+     *  callback fires once after the last segment or on the first error.
+     *  The list must stay valid until the callback is invoked.
+     *
+     * @param segments List of segments to execute
+     * @param count    Number of segments in the list
+     * @param callback The event callback function
+     * @param event    The logical OR of events to subscribe to
+     *
+     * @returns Zero if the list has started, or -1 if I2C peripheral is busy
+     *          or the list is empty
+     */
+    int transfer_list(const transaction_segment_t *segments, int count, const event_callback_t &callback, int event = I2C_EVENT_TRANSFER_COMPLETE);
+
     /** Abort the ongoing I2C transfer
      */
     void abort_transfer();
@@ -221,11 +313,19 @@ protected:
     /** Unlock deep sleep only if it has been locked */
     void unlock_deep_sleep();
 
+    /** Kick off the asynchronous transfer of one list segment */
+    void start_list_segment(const transaction_segment_t *segment, bool last);
+
     void irq_handler_asynch(void);
     event_callback_t _callback;
     CThunk<I2C> _irq;
     DMAUsage _usage;
     bool _deep_sleep_locked;
+    /* Transaction list in flight, or NULL if none */
+    const transaction_segment_t *_list;
+    int _list_count;
+    int _list_index;
+    int _list_event;
 #endif
 #endif
 
@@ -117,6 +117,37 @@ public:
      */
     void mode(PinMode pull);
 
+#if DEVICE_INTERRUPTIN_DIRECT || defined(DOXYGEN_ONLY)
+    /** Register a raw handler straight into the vector table for this pin
+     *
+     *  Only available on targets declaring the INTERRUPTIN_DIRECT
+     *  capability. The handler is written into the relocated vector table
+     *  with NVIC_SetVector, so an edge reaches user code without the
+     *  driver's dispatch table walk or Callback indirection - for pins
+     *  where the regular rise()/fall() latency is too long.
+     *
+     *  The cost of the shortcut is that the handler runs as the bare
+     *  interrupt service routine:
+     *  - it must clear the pin's pending flag in the GPIO/EXTI peripheral
+     *    itself, which the driver dispatch otherwise does;
+     *  - on targets where the vector is shared by a port or EXTI line
+     *    group, every pin routed to it loses regular dispatch while the
+     *    handler is attached.
+     *
+     *  @param edge    The edge to enable, IRQ_RISE or IRQ_FALL
+     *  @param handler The function to place in the vector table
+     */
+    void attach_direct(gpio_irq_event edge, void (*handler)(void));
+
+    /** Restore the driver's regular dispatch for this pin's vector
+     *
+     *  Reinstalls the vector saved by attach_direct(); previously attached
+     *  rise()/fall() callbacks function again. A no-op if attach_direct()
+     *  was never called.
+     */
+    void detach_direct();
+#endif
+
     /** Enable IRQ. This method depends on hardware implementation, might enable one
      *  port interrupts. For further information, check gpio_irq_enable().
      */
@@ -136,6 +167,10 @@ protected:
     Callback<void()> _rise;
     Callback<void()> _fall;
 
+#if DEVICE_INTERRUPTIN_DIRECT
+    uint32_t _saved_vector;
+#endif
+
     void irq_init(PinName pin);
 #endif
 };
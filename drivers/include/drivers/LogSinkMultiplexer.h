@@ -0,0 +1,182 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_LOG_SINK_MULTIPLEXER_H
+#define MBED_LOG_SINK_MULTIPLEXER_H
+
+#include "platform/platform.h"
+#include "platform/FileHandle.h"
+#include "platform/CircularBuffer.h"
+#include "platform/NonCopyable.h"
+#include "events/EventQueue.h"
+
+#ifndef MBED_CONF_DRIVERS_LOG_SINK_RING_SIZE
+/** Bytes buffered per sink between producers and the drain event.
+ * Configurable through mbed_app.json.
+ */
+#define MBED_CONF_DRIVERS_LOG_SINK_RING_SIZE 512
+#endif
+
+#ifndef MBED_CONF_DRIVERS_LOG_SINK_COUNT
+/** Maximum number of sinks attachable to one multiplexer. Configurable
+ * through mbed_app.json.
+ */
+#define MBED_CONF_DRIVERS_LOG_SINK_COUNT 4
+#endif
+
+namespace mbed {
+/**
+ * \defgroup drivers_LogSinkMultiplexer LogSinkMultiplexer class
+ * \ingroup drivers-public-api
+ * @{
+ */
+
+/** Fan log output out to several sinks without blocking the producers.
+ *
+ * Writing through a mutex straight to a slow sink (SWO, a 115200 baud
+ * UART, a file system) serializes every logging thread behind the
+ * slowest device. This multiplexer gives each sink its own fixed-size
+ * byte ring: write() copies the data into every ring - a bounded,
+ * interrupt-safe operation - and schedules a single drain event on the
+ * supplied event queue, which forwards the buffered bytes to the real
+ * sinks from thread context in multi-byte chunks.
+ *
+ * A producer is never delayed for longer than the ring copy. When a
+ * sink cannot keep up its ring fills and further bytes for that sink
+ * are dropped and counted rather than stalling the producer or the
+ * other sinks; dropped() exposes the per-sink count so lost output is
+ * visible instead of silent.
+ *
+ * write() may be called from interrupt context. In fault handlers,
+ * where the event queue no longer runs, flush() drains the rings
+ * synchronously.
+ *
+ * Example: mirror logs to SWO and a UART
+ * @code
+ * static events::EventQueue queue;
+ * static SerialWireOutput swo;
+ * static BufferedSerial uart(USBTX, USBRX);
+ * static LogSinkMultiplexer logs(&queue);
+ *
+ * int main()
+ * {
+ *     logs.add_sink(&swo);
+ *     logs.add_sink(&uart);
+ *     logs.write("boot\n", 5);
+ *     queue.dispatch_forever();
+ * }
+ * @endcode
+ *
+ * @note Synchronization level: Interrupt safe
+ */
+class LogSinkMultiplexer : public FileHandle, private NonCopyable<LogSinkMultiplexer> {
+public:
+    /** Create a multiplexer draining on the given event queue.
+     *
+     *  @param queue the queue the drain event runs on; it must be
+     *  dispatched by a thread for output to reach the sinks
+     */
+    LogSinkMultiplexer(events::EventQueue *queue);
+
+    /** Attach a sink.
+     *
+     *  @param sink the file handle the sink's ring is drained into
+     *
+     *  @returns the sink's index, or -1 if all
+     *  MBED_CONF_DRIVERS_LOG_SINK_COUNT slots are taken
+     */
+    int add_sink(FileHandle *sink);
+
+    /** Buffer data for every sink.
+     *
+     *  Copies the data into each sink's ring and schedules the drain
+     *  event. Never blocks on sink I/O; bytes that do not fit in a
+     *  full ring are dropped for that sink and counted.
+     *
+     *  @param buffer the bytes to log
+     *  @param size the number of bytes
+     *
+     *  @returns size
+     */
+    ssize_t write(const void *buffer, size_t size) override;
+
+    /** Get the number of bytes dropped for a sink since construction.
+     *
+     *  @param sink the index returned by add_sink()
+     *
+     *  @returns the drop count, or 0 for an invalid index
+     */
+    uint32_t dropped(int sink) const;
+
+    /** Drain all rings to their sinks synchronously.
+     *
+     *  For fault paths where the event queue no longer dispatches.
+     *  Blocks on sink I/O; do not call from a producer's fast path.
+     */
+    void flush();
+
+    ssize_t read(void *buffer, size_t size) override
+    {
+        /* Reading is not supported by this file handle */
+        return -EBADF;
+    }
+
+    off_t seek(off_t offset, int whence = SEEK_SET) override
+    {
+        /* Seeking is not support by this file handler */
+        return -ESPIPE;
+    }
+
+    off_t size() override
+    {
+        /* Size is not defined for this file handle */
+        return -EINVAL;
+    }
+
+    int isatty() override
+    {
+        /* File handle is used for terminal output */
+        return true;
+    }
+
+    int close() override
+    {
+        return 0;
+    }
+
+private:
+    void drain();
+
+    struct sink_t {
+        FileHandle *handle;
+        CircularBuffer<char, MBED_CONF_DRIVERS_LOG_SINK_RING_SIZE> ring;
+        uint32_t dropped;
+    };
+
+    events::EventQueue *_queue;
+    sink_t _sinks[MBED_CONF_DRIVERS_LOG_SINK_COUNT];
+    int _sink_count;
+    /** True while a drain event is queued, so bursts of writes schedule
+     * one drain rather than one per write
+     */
+    bool _drain_pending;
+};
+
+/** @}*/
+
+} // namespace mbed
+
+#endif // MBED_LOG_SINK_MULTIPLEXER_H
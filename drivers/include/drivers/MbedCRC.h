@@ -786,6 +786,28 @@ private:
     }
 
 #if MBED_CRC_TABLE_SIZE > 0
+    /** Process 1 byte of CRC through the lookup table
+     *
+     * @param  p_crc input register value
+     * @param  data_byte next byte of data
+     * @param  reflect true if the data byte must be reflected first
+     * @return updated register value
+     */
+    uint_fast32_t do_1_byte_table(uint_fast32_t p_crc, uint_fast32_t data_byte, bool reflect) const
+    {
+        if (reflect) {
+            data_byte = reflect_byte(data_byte);
+        }
+#if MBED_CRC_TABLE_SIZE == 16
+        p_crc = _crc_table[(data_byte ^ p_crc) & 0xF] ^ (p_crc >> 4);
+        data_byte >>= 4;
+        p_crc = _crc_table[(data_byte ^ p_crc) & 0xF] ^ (p_crc >> 4);
+#else
+        p_crc = _crc_table[(data_byte ^ p_crc) & 0xFF] ^ (p_crc >> 8);
+#endif
+        return p_crc;
+    }
+
     /** CRC computation using ROM tables.
     *
     * @param  buffer  data buffer
@@ -802,18 +824,30 @@ private:
         // Note the inversion because table and CRC are reflected - data must be
         bool reflect = !_reflect_data;
 
-        for (crc_data_size_t byte = 0; byte < size; byte++) {
-            uint_fast32_t data_byte = data[byte];
-            if (reflect) {
-                data_byte = reflect_byte(data_byte);
-            }
-#if MBED_CRC_TABLE_SIZE == 16
-            p_crc = _crc_table[(data_byte ^ p_crc) & 0xF] ^ (p_crc >> 4);
-            data_byte >>= 4;
-            p_crc = _crc_table[(data_byte ^ p_crc) & 0xF] ^ (p_crc >> 4);
-#else
-            p_crc = _crc_table[(data_byte ^ p_crc) & 0xFF] ^ (p_crc >> 8);
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        /* Fast path for large buffers: align to a word boundary, then take
+         * four bytes per 32-bit load. One word load plus byte extracts is
+         * measurably cheaper on Cortex-M than four separate byte loads, and
+         * the manual unroll removes most of the loop overhead. A bigger gain
+         * would need slicing-by-N tables, which would multiply the ROM cost
+         * this class deliberately keeps configurable. */
+        while (size > 0 && (reinterpret_cast<uintptr_t>(data) & 3) != 0) {
+            p_crc = do_1_byte_table(p_crc, *data++, reflect);
+            size--;
+        }
+        while (size >= 4) {
+            uint32_t chunk = *reinterpret_cast<const uint32_t *>(data);
+            p_crc = do_1_byte_table(p_crc, chunk & 0xFF, reflect);
+            p_crc = do_1_byte_table(p_crc, (chunk >> 8) & 0xFF, reflect);
+            p_crc = do_1_byte_table(p_crc, (chunk >> 16) & 0xFF, reflect);
+            p_crc = do_1_byte_table(p_crc, chunk >> 24, reflect);
+            data += 4;
+            size -= 4;
+        }
 #endif
+        while (size > 0) {
+            p_crc = do_1_byte_table(p_crc, *data++, reflect);
+            size--;
         }
         *crc = p_crc;
         return 0;
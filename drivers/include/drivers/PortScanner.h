@@ -0,0 +1,163 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_PORTSCANNER_H
+#define MBED_PORTSCANNER_H
+
+#include "platform/platform.h"
+
+#if DEVICE_PORTIN || defined(DOXYGEN_ONLY)
+
+#include "hal/port_api.h"
+#include "drivers/Ticker.h"
+#include "platform/Callback.h"
+#include "platform/NonCopyable.h"
+
+namespace mbed {
+/**
+ * \defgroup drivers_PortScanner PortScanner class
+ * \ingroup drivers-public-api-gpio
+ * @{
+ */
+
+/** Maximum number of ports one PortScanner can scan
+ */
+#ifndef PORTSCANNER_MAX_PORTS
+#define PORTSCANNER_MAX_PORTS 4
+#endif
+
+/** A periodic scanner for many digital inputs spread over GPIO ports
+ *
+ * Reads whole ports at a fixed rate, compares each pass against the
+ * previous debounced snapshot and reports only the pins that changed,
+ * so scanning dozens of inputs costs one port read and one XOR per
+ * port per pass instead of a gpio_read() loop over every pin. Pins
+ * only take work when their raw level differs from the debounced
+ * state, which is rare, keeping the scan interrupt short.
+ *
+ * A new level must persist for the configured number of consecutive
+ * scans before it is committed and reported, debouncing mechanical
+ * contacts. The change callback is invoked from the scan interrupt.
+ *
+ * @note Synchronization level: Interrupt safe
+ *
+ * Example:
+ * @code
+ * // Report changes on Port0 pins [0:15] and Port1 pins [0:7]
+ *
+ * #include "mbed.h"
+ *
+ * PortScanner scanner(1ms, 3);
+ *
+ * void changed(int port, int pins, int values) {
+ *     printf("port %d pins %x now %x\n", port, pins, values);
+ * }
+ *
+ * int main() {
+ *     scanner.add_port(Port0, 0x0000FFFF);
+ *     scanner.add_port(Port1, 0x000000FF);
+ *     scanner.attach(changed);
+ *     scanner.start();
+ *     while (1) {
+ *         ThisThread::sleep_for(1s);
+ *     }
+ * }
+ * @endcode
+ */
+class PortScanner : private NonCopyable<PortScanner> {
+
+public:
+
+    /** Create a PortScanner
+     *
+     *  @param scan_interval Time between scan passes
+     *  @param debounce_scans Number of consecutive scans a new level must
+     *  persist before it is reported; 0 or 1 reports on the next scan
+     */
+    PortScanner(std::chrono::microseconds scan_interval, uint8_t debounce_scans = 3);
+
+    ~PortScanner();
+
+    /** Add a port to the scan
+     *
+     *  The current level of the pins becomes the initial debounced
+     *  state, so no events are generated for pins that do not move.
+     *
+     *  @param port Port to scan (as defined in target's PortNames.h)
+     *  @param mask Bitmask defines which port pins to scan (0 - ignore, 1 - include)
+     *  @return Index identifying this port in callbacks and read(),
+     *  or -1 if PORTSCANNER_MAX_PORTS ports are already added
+     */
+    int add_port(PortName port, int mask = 0xFFFFFFFF);
+
+    /** Attach a function to call when scanned pins change
+     *
+     *  Invoked from the scan interrupt with the port index returned by
+     *  add_port(), the mask of pins that changed this pass and the new
+     *  debounced level of all scanned pins of that port.
+     *
+     *  @param func A function to call on pin changes, or 0 to set as none
+     */
+    void attach(Callback<void(int, int, int)> func);
+
+    /** Start periodic scanning
+     */
+    void start();
+
+    /** Stop periodic scanning
+     *
+     *  Debounced state is kept and scanning can be restarted.
+     */
+    void stop();
+
+    /** Read the debounced level of a scanned port
+     *
+     *  @param index Port index returned by add_port()
+     *  @returns
+     *    An integer with each bit corresponding to the associated
+     *    debounced pin level
+     */
+    int read(int index) const;
+
+#if !defined(DOXYGEN_ONLY)
+private:
+    void _scan();
+
+    struct scan_port_t {
+        port_t port;           /**< Port HAL object */
+        uint32_t mask;         /**< Pins included in the scan */
+        uint32_t stable;       /**< Debounced pin levels */
+        uint32_t pending;      /**< Pins currently counting towards a new level */
+        uint8_t counters[32];  /**< Consecutive scans each pending pin has held its new level */
+    };
+
+    Ticker _ticker;
+    Callback<void(int, int, int)> _on_change;
+    std::chrono::microseconds _interval;
+    scan_port_t _ports[PORTSCANNER_MAX_PORTS];
+    int _port_count;
+    uint8_t _debounce_scans;
+    bool _running;
+#endif
+};
+
+/** @}*/
+
+} // namespace mbed
+
+#endif
+
+#endif
@@ -22,6 +22,10 @@
 #if DEVICE_PWMOUT || defined(DOXYGEN_ONLY)
 #include "hal/pwmout_api.h"
 
+#if DEVICE_PWMOUT_SEQUENCE || defined(DOXYGEN_ONLY)
+#include "platform/Callback.h"
+#endif
+
 namespace mbed {
 /**
  * \defgroup drivers_PwmOut PwmOut class
@@ -155,6 +159,43 @@ public:
      */
     void resume();
 
+#if DEVICE_PWMOUT_SEQUENCE || defined(DOXYGEN_ONLY)
+    /** Play a sequence of PWM cycles with no CPU involvement
+     *
+     * Each entry describes one cycle of the output; a timer and DMA
+     * engine plays the entries back to back, so arbitrary waveforms
+     * (LED strip protocols, stepper ramps) are generated without
+     * bit-banging or interrupt work per cycle.
+     *
+     * In circular mode the buffer loops until stop_sequence() is called
+     * and the refill callback is invoked from interrupt context when
+     * the first half and the second half of the buffer have been
+     * played, like a double-buffered audio stream: refill the half that
+     * just finished while the other half is playing. In one-shot mode
+     * the callback is invoked once with PWMOUT_SEQ_COMPLETE and the
+     * output holds the duty of the last entry.
+     *
+     * The entry buffer is read directly by the DMA and must stay valid
+     * until playback stops.
+     *
+     * Only available on targets with DEVICE_PWMOUT_SEQUENCE.
+     *
+     * @param entries Buffer of cycles to play
+     * @param count Number of entries in the buffer
+     * @param refill Callback invoked at half and full buffer completion, or nullptr
+     * @param circular true to loop over the buffer until stopped
+     * @return 0 on success, -1 if no DMA channel or timer support is available
+     */
+    int write_sequence(const pwmout_seq_entry_t *entries, uint32_t count, Callback<void(pwmout_seq_event)> refill = nullptr, bool circular = false);
+
+    /** Stop a sequence started with write_sequence()
+     *
+     * The static duty cycle and period configured through write() and
+     * period_us() are restored. Does nothing if no sequence is playing.
+     */
+    void stop_sequence();
+#endif
+
     /** A operator shorthand for write()
      *  \sa PwmOut::write()
      */
@@ -198,12 +239,21 @@ protected:
     /** Power down this instance */
     void deinit();
 
+#if DEVICE_PWMOUT_SEQUENCE
+    static void _seq_handler(uint32_t id, pwmout_seq_event event);
+#endif
+
     pwmout_t _pwm;
     PinName _pin;
     bool _deep_sleep_locked;
     bool _initialized;
     float _duty_cycle;
     int _period_us;
+#if DEVICE_PWMOUT_SEQUENCE
+    Callback<void(pwmout_seq_event)> _seq_refill;
+    bool _seq_active;
+    bool _seq_circular;
+#endif
 #endif
 };
 
@@ -0,0 +1,114 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_QUADRATURE_ENCODER_H
+#define MBED_QUADRATURE_ENCODER_H
+
+#include "platform/platform.h"
+
+#if DEVICE_PULSE_COUNTER || defined(DOXYGEN_ONLY)
+
+#include "hal/pulse_counter_api.h"
+#include "drivers/HighResClock.h"
+#include "platform/NonCopyable.h"
+
+namespace mbed {
+/**
+ * \defgroup drivers_QuadratureEncoder QuadratureEncoder class
+ * \ingroup drivers-public-api
+ * @{
+ */
+
+/** A rotary or linear encoder tracked entirely in hardware.
+ *
+ * Decoding quadrature with two InterruptIn callbacks saturates the CPU
+ * above a few tens of kilohertz of edge rate. QuadratureEncoder instead
+ * drives the target's hardware counter mode through the pulse counter HAL:
+ * edges advance (and, on reverse motion, retreat) the count register with
+ * no software involvement, at megahertz rates.
+ *
+ * The hardware counter is typically 16 bits; the driver extends it to a
+ * 64-bit position by accounting for wrap interrupts, which fire once per
+ * 2^width counts rather than once per edge. position() is safe to call
+ * from any context.
+ *
+ * speed() latches position and time on each call and returns the mean
+ * count rate since the previous call, so periodic sampling (for example
+ * from a control loop) gets aliasing-free velocity without any extra
+ * bookkeeping.
+ *
+ * Example:
+ * @code
+ * QuadratureEncoder encoder(D2, D3);
+ * while (true) {
+ *     printf("pos %lld speed %ld\n", encoder.position(), encoder.speed());
+ *     ThisThread::sleep_for(100ms);
+ * }
+ * @endcode
+ *
+ * @note Synchronization level: Interrupt safe (position),
+ *       not protected (speed/reset)
+ */
+class QuadratureEncoder : private NonCopyable<QuadratureEncoder> {
+public:
+    /** Create an encoder on the given phase inputs and start counting.
+     *
+     *  @param phase_a Encoder phase A (or sole count input in pulse modes).
+     *  @param phase_b Encoder phase B; NC in non-quadrature modes.
+     *  @param mode    Decoding mode, defaulting to full x4 quadrature.
+     */
+    QuadratureEncoder(PinName phase_a, PinName phase_b,
+                      pulse_counter_mode_t mode = PULSE_COUNTER_QUADRATURE_X4);
+
+    ~QuadratureEncoder();
+
+    /** Get the overflow-extended position in counts. Safe from any context.
+     *
+     * Position is relative to construction or the last reset(); in
+     * quadrature modes reverse motion decreases it.
+     *
+     *  @return Position in counts.
+     */
+    int64_t position();
+
+    /** Zero the position. */
+    void reset();
+
+    /** Get the mean count rate since the previous speed() call.
+     *
+     * Position and time are latched on each call: call periodically and
+     * each return value covers exactly the interval since the last call.
+     *
+     *  @return Signed speed in counts per second.
+     */
+    int32_t speed();
+
+private:
+    static void _overflow(void *context, int direction);
+
+    pulse_counter_t _counter;
+    int64_t _wrap;
+    volatile int64_t _base;
+    int64_t _last_position;
+    HighResClock::time_point _last_time;
+};
+
+/** @}*/
+
+} // namespace mbed
+
+#endif // DEVICE_PULSE_COUNTER || DOXYGEN_ONLY
+#endif // MBED_QUADRATURE_ENCODER_H
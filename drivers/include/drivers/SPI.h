@@ -25,6 +25,7 @@
 #include "hal/spi_api.h"
 #include "drivers/DigitalOut.h"
 #include "platform/SingletonPtr.h"
+#include "platform/Span.h"
 #include "platform/NonCopyable.h"
 
 #if defined MBED_CONF_DRIVERS_SPI_COUNT_MAX && DEVICE_SPI_COUNT > MBED_CONF_DRIVERS_SPI_COUNT_MAX
@@ -208,6 +209,27 @@ public:
      */
     virtual int write(const char *tx_buffer, int tx_length, char *rx_buffer, int rx_length);
 
+    /** Write a Span to the SPI Slave and read the response into another.
+     *
+     *  Equivalent to write(tx, tx_length, rx, rx_length) over the two
+     *  Spans; either may be empty. With fixed-extent Spans the transfer
+     *  lengths are compile-time constants, which lets the compiler fold
+     *  the length handling for small fixed transfers such as register
+     *  reads.
+     *
+     *  @param tx_buffer Span of data to write to the device, may be empty.
+     *  @param rx_buffer Span of data to read from the device, may be empty.
+     *  @return
+     *      The number of bytes written and read from the device. This is
+     *      maximum of the two Span sizes.
+     */
+    template<ptrdiff_t TxExtent, ptrdiff_t RxExtent>
+    int write(mbed::Span<const uint8_t, TxExtent> tx_buffer, mbed::Span<uint8_t, RxExtent> rx_buffer)
+    {
+        return write(reinterpret_cast<const char *>(tx_buffer.data()), tx_buffer.size(),
+                     reinterpret_cast<char *>(rx_buffer.data()), rx_buffer.size());
+    }
+
     /** Acquire exclusive access to this SPI bus.
      */
     virtual void lock(void);
@@ -265,6 +287,29 @@ public:
         return 0;
     }
 
+    /** Start a non-blocking scatter-gather transfer over a list of buffer segments.
+     *
+     *  All segments are transferred back-to-back under a single chip-select
+     *  assertion, so non-contiguous buffers (for example header, payload and
+     *  CRC built separately) go out as one frame with no staging copy. Each
+     *  segment is described by a transaction_t; only the buffer pointers,
+     *  lengths and width fields are used - per-segment events and callbacks
+     *  are ignored, and the supplied callback fires once when the whole
+     *  sequence has completed or on the first error.
+     *
+     * @param sequence Array of segment descriptors. Must stay valid until the
+     *                 callback is invoked.
+     * @param count    Number of segments in the sequence.
+     * @param callback The event callback function.
+     * @param event    The logical OR of events to subscribe to. May be SPI_EVENT_ALL,
+     *                 or some combination of the flags SPI_EVENT_ERROR,
+     *                 SPI_EVENT_COMPLETE or SPI_EVENT_RX_OVERFLOW.
+     *
+     * @retval 0 If the sequence has started.
+     * @retval -1 If SPI peripheral is busy or the sequence is empty.
+     */
+    int transfer_sequence(const transaction_t *sequence, size_t count, const event_callback_t &callback, int event = SPI_EVENT_COMPLETE);
+
     /** Abort the on-going SPI transfer, and continue with transfers in the queue, if any.
      */
     void abort_transfer();
@@ -416,6 +461,14 @@ protected:
     DMAUsage _usage;
     /* Current sate of the sleep manager */
     bool _deep_sleep_locked;
+    /* Scatter-gather sequence in flight, or NULL if none */
+    const transaction_t *_sequence;
+    /* Number of segments in the sequence */
+    size_t _sequence_count;
+    /* Index of the segment currently being transferred */
+    size_t _sequence_index;
+    /* Events the sequence initiator subscribed to */
+    int _sequence_event;
 #endif // DEVICE_SPI_ASYNCH
 
     // Configuration.
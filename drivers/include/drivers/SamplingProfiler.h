@@ -0,0 +1,144 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_SAMPLING_PROFILER_H
+#define MBED_SAMPLING_PROFILER_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "drivers/Timeout.h"
+#include "platform/NonCopyable.h"
+
+namespace mbed {
+/** \addtogroup drivers-public-api */
+/** @{*/
+
+/**
+ * \defgroup drivers_SamplingProfiler SamplingProfiler class
+ * @{
+ */
+
+/** A statistical CPU profiler for units in the field.
+ *
+ * gprof does not run on deployed hardware and debugger-based sampling
+ * needs physical access. SamplingProfiler answers "where does the CPU
+ * go" from software alone: a periodic timer interrupt captures the
+ * program counter (and optionally the link register) of the interrupted
+ * thread code into a caller-supplied ring, which the application drains
+ * over whatever remote channel it has and ships to the host.
+ * tools/perf/flamegraph_fold.py folds the samples against the build's
+ * ELF into flame-graph input.
+ *
+ * @code
+ * static uint32_t samples[2048];
+ * static SamplingProfiler profiler(samples, 2048, true);
+ *
+ * profiler.start(997);          // ~1 kHz, prime to dodge aliasing
+ * ...
+ * uint32_t chunk[64];
+ * size_t n = profiler.read(chunk, 64);
+ * remote_channel_send(chunk, n * sizeof(uint32_t));
+ * @endcode
+ *
+ * The capture runs in the microsecond-ticker interrupt and costs a few
+ * loads and one ring store - well under 1% of CPU at 1 kHz. The period
+ * is jittered by up to a quarter either way so a loop synchronous with
+ * the nominal rate cannot hide between samples; rates that are prime
+ * numbers help further.
+ *
+ * Samples attribute to thread-mode execution: the profiler reads the
+ * exception frame the interrupted thread pushed on the process stack,
+ * so time spent inside other interrupt handlers is charged to the
+ * thread code they preempted, as with most MCU sampling profilers.
+ * Requires threads running on the process stack (any RTOS build); on
+ * cores without an exception frame to read, start() refuses.
+ *
+ * The profiler holds a timer the whole time it runs, so deep sleep is
+ * blocked while profiling - stop() when the answer is in hand.
+ *
+ * @note Synchronization level: Interrupt safe (capture); start, stop
+ *       and read belong to one thread context.
+ */
+class SamplingProfiler : private NonCopyable<SamplingProfiler> {
+public:
+    /** Create a profiler over caller-supplied sample storage.
+     *
+     *  @param buffer     Ring storage for captured words.
+     *  @param words      Storage capacity in 32-bit words.
+     *  @param capture_lr Also capture the link register, two words per
+     *                    sample; gives the host one caller frame per
+     *                    sample at half the ring depth.
+     */
+    SamplingProfiler(uint32_t *buffer, size_t words, bool capture_lr = false);
+
+    ~SamplingProfiler();
+
+    /** Start sampling.
+     *
+     *  @param rate_hz Nominal sample rate; prime rates resist aliasing.
+     *  @return true if sampling started, false if unsupported on this
+     *          core or already running.
+     */
+    bool start(uint32_t rate_hz);
+
+    /** Stop sampling. Buffered samples remain readable. */
+    void stop();
+
+    /** Drain captured words into a buffer.
+     *
+     * With capture_lr, words come out in [pc, lr] pairs; keep max even
+     * so pairs are not split across reads.
+     *
+     *  @param out Buffer to fill.
+     *  @param max Capacity of out in words.
+     *  @return Words written.
+     */
+    size_t read(uint32_t *out, size_t max);
+
+    /** Get the number of words lost because the ring was full.
+     *
+     * Drops bias the profile towards code running while the ring has
+     * room; drain faster or enlarge the ring if this climbs.
+     */
+    uint32_t dropped() const;
+
+    /** Check whether sampling is running. */
+    bool running() const;
+
+private:
+    void sample();
+    void schedule_next();
+
+    Timeout _timeout;
+    uint32_t *_buffer;
+    size_t _words;
+    bool _capture_lr;
+    bool _running;
+    uint32_t _period_us;
+    uint32_t _jitter_state;
+    volatile uint32_t _head;
+    volatile uint32_t _tail;
+    volatile uint32_t _dropped;
+};
+
+/**@}*/
+
+/**@}*/
+
+} // namespace mbed
+
+#endif
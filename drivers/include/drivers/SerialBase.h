@@ -304,8 +304,14 @@ protected:
 
 #if DEVICE_SERIAL_ASYNCH
     CThunk<SerialBase> _thunk_irq;
+#if DEVICE_DMA
+    // targets with the generic DMA HAL back async transfers with DMA by default
+    DMAUsage _tx_usage = DMA_USAGE_OPPORTUNISTIC;
+    DMAUsage _rx_usage = DMA_USAGE_OPPORTUNISTIC;
+#else
     DMAUsage _tx_usage = DMA_USAGE_NEVER;
     DMAUsage _rx_usage = DMA_USAGE_NEVER;
+#endif
     event_callback_t _tx_callback;
     event_callback_t _rx_callback;
     bool _tx_asynch_set = false;
@@ -0,0 +1,185 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_TIMESTAMPEDINTERRUPTIN_H
+#define MBED_TIMESTAMPEDINTERRUPTIN_H
+
+#include "drivers/InterruptIn.h"
+
+#if DEVICE_INTERRUPTIN || defined(DOXYGEN_ONLY)
+
+#include "hal/ticker_api.h"
+#if DEVICE_EDGE_CAPTURE
+#include "hal/edge_capture_api.h"
+#endif
+
+namespace mbed {
+/**
+ * \defgroup drivers_TimestampedInterruptIn TimestampedInterruptIn class
+ * \ingroup drivers-public-api-gpio
+ * @{
+ */
+
+/** Default number of edges buffered by a TimestampedInterruptIn
+ *
+ * Each buffered edge takes 8 bytes. The buffer needs to hold the edges
+ * arriving between two calls to read_edges().
+ */
+#ifndef TIMESTAMPED_INTERRUPTIN_BUFFER_SIZE
+#define TIMESTAMPED_INTERRUPTIN_BUFFER_SIZE 32
+#endif
+
+/** A captured pin transition
+ */
+struct timestamped_edge_t {
+    timestamp_t timestamp;  /**< Time of the edge in us, in the microsecond ticker's time base */
+    gpio_irq_event edge;    /**< IRQ_RISE or IRQ_FALL */
+};
+
+/** A digital interrupt input that records the time of each edge
+ *
+ * Edges are timestamped and stored in an internal buffer for bulk
+ * retrieval, so edge timing can be measured without doing any work in
+ * the interrupt handler. On targets with timer capture channels
+ * (DEVICE_EDGE_CAPTURE) the timestamp is latched by the hardware at the
+ * pin transition and is unaffected by interrupt latency; on other
+ * targets the microsecond ticker is read in the GPIO interrupt, which
+ * adds the interrupt latency as jitter.
+ *
+ * The buffer is written from interrupt context and drained with
+ * read_edges() without disabling interrupts. Only one context may call
+ * read_edges() at a time. When the buffer is full further edges are
+ * dropped and counted; see dropped().
+ *
+ * @note Synchronization level: Interrupt safe
+ *
+ * Example:
+ * @code
+ * // Measure the frequency of a signal
+ *
+ * #include "mbed.h"
+ *
+ * TimestampedInterruptIn input(p16);
+ *
+ * int main() {
+ *     input.capture_rise(true);
+ *     while (1) {
+ *         ThisThread::sleep_for(100ms);
+ *         timestamped_edge_t edges[16];
+ *         size_t count = input.read_edges(edges, 16);
+ *         for (size_t i = 1; i < count; i++) {
+ *             printf("period %u us\n", edges[i].timestamp - edges[i - 1].timestamp);
+ *         }
+ *     }
+ * }
+ * @endcode
+ */
+class TimestampedInterruptIn : public InterruptIn {
+
+public:
+
+    /** Create a TimestampedInterruptIn connected to the specified pin
+     *
+     *  @param pin InterruptIn pin to connect to
+     *  @param buffer_size Number of edges the internal buffer can hold
+     */
+    TimestampedInterruptIn(PinName pin, size_t buffer_size = TIMESTAMPED_INTERRUPTIN_BUFFER_SIZE);
+
+    /** Create a TimestampedInterruptIn connected to the specified pin,
+     *  and the pin configured to the specified mode.
+     *
+     *  @param pin InterruptIn pin to connect to
+     *  @param mode Desired Pin mode configuration.
+     *  (Valid values could be PullNone, PullDown, PullUp and PullDefault.
+     *  See PinNames.h for your target for definitions)
+     *  @param buffer_size Number of edges the internal buffer can hold
+     */
+    TimestampedInterruptIn(PinName pin, PinMode mode, size_t buffer_size = TIMESTAMPED_INTERRUPTIN_BUFFER_SIZE);
+
+    virtual ~TimestampedInterruptIn();
+
+    /** Enable or disable capture of rising edges
+     *
+     *  While enabled, each rising edge is timestamped and buffered.
+     *  On targets without hardware capture this uses the rise()
+     *  callback internally, replacing any attached function.
+     *
+     *  @param enable true to capture rising edges
+     */
+    void capture_rise(bool enable);
+
+    /** Enable or disable capture of falling edges
+     *
+     *  While enabled, each falling edge is timestamped and buffered.
+     *  On targets without hardware capture this uses the fall()
+     *  callback internally, replacing any attached function.
+     *
+     *  @param enable true to capture falling edges
+     */
+    void capture_fall(bool enable);
+
+    /** Retrieve buffered edges, oldest first
+     *
+     *  Does not disable interrupts; edges arriving during the call are
+     *  either retrieved or left for the next call. Only one context may
+     *  call this at a time.
+     *
+     *  @param edges Buffer to fill with captured edges
+     *  @param count Capacity of the buffer in edges
+     *  @return Number of edges written to the buffer
+     */
+    size_t read_edges(timestamped_edge_t *edges, size_t count);
+
+    /** Get the number of edges waiting in the buffer
+     *
+     *  @return Number of buffered edges
+     */
+    size_t edges_available() const;
+
+    /** Get the number of edges dropped because the buffer was full
+     *
+     *  @return Number of dropped edges since construction
+     */
+    uint32_t dropped() const;
+
+#if !defined(DOXYGEN_ONLY)
+private:
+    void _init(PinName pin, size_t buffer_size);
+    void _push(gpio_irq_event edge, timestamp_t timestamp);
+#if DEVICE_EDGE_CAPTURE
+    static void _capture_handler(uint32_t id, gpio_irq_event event, timestamp_t timestamp);
+
+    edge_capture_t _capture;
+#else
+    void _sw_rise();
+    void _sw_fall();
+#endif
+
+    timestamped_edge_t *_edges;
+    uint32_t _size;
+    uint32_t _head;
+    uint32_t _tail;
+    uint32_t _dropped;
+#endif
+};
+
+/** @}*/
+
+} // namespace mbed
+
+#endif
+
+#endif
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2021 Arm Limited and affiliates.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MBED_WATCHDOG_SERVICE_H
+#define MBED_WATCHDOG_SERVICE_H
+
+#if defined(DEVICE_WATCHDOG) && defined(MBED_CONF_RTOS_PRESENT)
+
+#include "drivers/Watchdog.h"
+#include "platform/NonCopyable.h"
+#include "cmsis_os2.h"
+
+/** Maximum number of threads the service can supervise at once */
+#ifndef MBED_CONF_DRIVERS_WATCHDOG_SERVICE_MAX_CLIENTS
+#define MBED_CONF_DRIVERS_WATCHDOG_SERVICE_MAX_CLIENTS 8
+#endif
+
+namespace mbed {
+/**
+ * \defgroup drivers_WatchdogService WatchdogService class
+ * \ingroup drivers-public-api
+ * @{
+ */
+
+/** A supervised kick service on top of the hardware Watchdog.
+ *
+ * Kicking the watchdog directly from one loop proves only that that loop is
+ * alive: a hung low-priority thread goes undetected for as long as the main
+ * loop keeps kicking. WatchdogService inverts this - threads register an
+ * expected check-in period, and a single monitor validates every
+ * registrant's check-in before it kicks the hardware.
+ *
+ * checkin() is one lock-free timestamp store, cheap enough for tight loops
+ * and safe from any context. The monitor runs on the bottom-half dispatch
+ * context (see mbed_bottom_half_queue()), above all ordinary threads, so a
+ * hung thread - even one hogging the high-priority shared queue - cannot
+ * stop the deadline checks. Scanning the client table costs a few
+ * microseconds per watchdog period.
+ *
+ * On a missed deadline the service raises a system error carrying the late
+ * client's name and thread identifier, so the hang is recorded in the
+ * crash-data region (when crash capture is enabled) and survives the
+ * subsequent reset - instead of the anonymous reboot a bare hardware
+ * timeout produces.
+ *
+ * Example:
+ * @code
+ * WatchdogService &service = WatchdogService::get_instance();
+ * service.start(10000);
+ *
+ * // In each supervised thread:
+ * int8_t id = service.register_client("net_thread", 2000);
+ * while (true) {
+ *     service.checkin(id);
+ *     // thread work
+ * }
+ * @endcode
+ *
+ * @note Synchronization level: Thread safe (register/deregister),
+ *       interrupt safe (checkin)
+ */
+class WatchdogService : private NonCopyable<WatchdogService> {
+public:
+
+    /** Get a reference to the single WatchdogService instance in the system.
+     *
+     * @return A reference to the single WatchdogService instance present in the system.
+     */
+    static WatchdogService &get_instance();
+
+    /** Start the hardware watchdog and the deadline monitor.
+     *
+     * The monitor runs four times per watchdog timeout and kicks the
+     * hardware only while every registered client is meeting its check-in
+     * period.
+     *
+     * @param timeout Hardware watchdog timeout in milliseconds.
+     *
+     * @return true if the watchdog and monitor were started successfully;
+     *         false otherwise.
+     */
+    bool start(uint32_t timeout);
+
+    /** Stop the deadline monitor and the hardware watchdog.
+     *
+     * @return true if both were stopped; false if the watchdog cannot be
+     *         disabled on this platform or the service was not started.
+     */
+    bool stop();
+
+    /** Register the calling thread for supervision.
+     *
+     * @param name   Name recorded against missed deadlines. Not copied:
+     *               use a string literal or other storage that outlives
+     *               the registration.
+     * @param period Longest acceptable gap between check-ins, in
+     *               milliseconds. Choose it with margin: an occasional
+     *               slow iteration should not reset the system.
+     *
+     * @return Client id to pass to checkin(), or -1 if the client table
+     *         is full (see MBED_CONF_DRIVERS_WATCHDOG_SERVICE_MAX_CLIENTS).
+     */
+    int8_t register_client(const char *name, uint32_t period);
+
+    /** Remove a client from supervision.
+     *
+     * @param id Client id returned by register_client().
+     */
+    void deregister_client(int8_t id);
+
+    /** Record a check-in. Safe from any context.
+     *
+     * A single atomic timestamp store - no lock is taken and no other
+     * client is touched.
+     *
+     * @param id Client id returned by register_client().
+     */
+    void checkin(int8_t id);
+
+private:
+    WatchdogService();
+
+    void monitor();
+
+    struct client_t {
+        const char *name;
+        osThreadId_t thread;
+        uint32_t period;
+        volatile uint32_t last_checkin;
+    };
+
+    client_t _clients[MBED_CONF_DRIVERS_WATCHDOG_SERVICE_MAX_CLIENTS];
+    int _monitor_id;
+    bool _running;
+};
+
+/** @}*/
+
+} // namespace mbed
+
+#endif // DEVICE_WATCHDOG && MBED_CONF_RTOS_PRESENT
+#endif // MBED_WATCHDOG_SERVICE_H
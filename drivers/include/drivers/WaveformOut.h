@@ -0,0 +1,214 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_WAVEFORM_OUT_H
+#define MBED_WAVEFORM_OUT_H
+
+#include <mstd_utility>
+
+#include "platform/platform.h"
+
+#include "hal/gpio_api.h"
+#include "platform/mbed_critical.h"
+#include "platform/mbed_toolchain.h"
+#include "platform/NonCopyable.h"
+
+/** Estimated cycle cost of one inlined gpio_write, subtracted from each
+ *  segment's padding so segment durations come out close to nominal.
+ *  Tune per target family if measurement says so.
+ */
+#ifndef MBED_CONF_DRIVERS_WAVEFORM_WRITE_CYCLES
+#define MBED_CONF_DRIVERS_WAVEFORM_WRITE_CYCLES 3
+#endif
+
+/** Segments padded by at most this many cycles are fully unrolled as nops;
+ *  longer ones use a countdown loop at ~3 cycles per iteration, trading a
+ *  little precision for code size.
+ */
+#ifndef MBED_CONF_DRIVERS_WAVEFORM_UNROLL_LIMIT
+#define MBED_CONF_DRIVERS_WAVEFORM_UNROLL_LIMIT 32
+#endif
+
+namespace mbed {
+/**
+ * \defgroup drivers_WaveformOut WaveformOut class
+ * \ingroup drivers-public-api-gpio
+ * @{
+ */
+
+namespace impl {
+
+MBED_FORCEINLINE void waveform_nop()
+{
+#if defined(__ICCARM__)
+    __no_operation();
+#else
+    asm volatile("nop");
+#endif
+}
+
+/** Compile-time cycle padding: unrolled nops for short delays, a countdown
+ * loop for long ones. */
+template<uint32_t Cycles, bool Unrolled = (Cycles <= MBED_CONF_DRIVERS_WAVEFORM_UNROLL_LIMIT)>
+struct CyclePad;
+
+template<uint32_t Cycles>
+struct CyclePad<Cycles, true> {
+    MBED_FORCEINLINE static void pad()
+    {
+        waveform_nop();
+        CyclePad < Cycles - 1, true >::pad();
+    }
+};
+
+template<>
+struct CyclePad<0u, true> {
+    MBED_FORCEINLINE static void pad()
+    {
+    }
+};
+
+template<uint32_t Cycles>
+struct CyclePad<Cycles, false> {
+    MBED_FORCEINLINE static void pad()
+    {
+        // subtract, compare-and-branch and the nop: ~3 cycles per pass
+        for (uint32_t n = Cycles / 3; n != 0; --n) {
+            waveform_nop();
+        }
+    }
+};
+
+} // namespace impl
+
+/** A compile-time specialized waveform generator on a GPIO pin
+ *
+ * Bit-banging through DigitalOut pays a call into gpio_write per edge,
+ * which caps software protocols around a few MHz. WaveformOut instead
+ * takes the waveform as template parameters - the CPU clock and a list
+ * of segment durations in nanoseconds, alternating high/low starting
+ * high - and generates the whole emission as straight-line code:
+ * inlined gpio_write calls separated by cycle padding computed at
+ * compile time from the clock. No per-edge call overhead, no
+ * hand-written assembly per board; porting to a different clock is a
+ * change of one template argument.
+ *
+ * Timing accuracy depends on running without preemption: call write()
+ * with interrupts masked (see write_protected()) for glitch-free
+ * output, and expect each segment to be no shorter than nominal but up
+ * to a few cycles longer (flash wait states can stretch it further -
+ * MBED_FAST_CODE on the calling function helps there).
+ *
+ * Example: WS2812-style bits at a 64MHz core clock
+ * @code
+ * // 0-bit: 375ns high, 875ns low; 1-bit: 750ns high, 500ns low
+ * WaveformOut<64000000, 375, 875> bit0(D6);
+ * WaveformOut<64000000, 750, 500> bit1(D6);
+ *
+ * void send_byte(uint8_t b)
+ * {
+ *     core_util_critical_section_enter();
+ *     for (int i = 7; i >= 0; i--) {
+ *         if (b & (1 << i)) {
+ *             bit1.write();
+ *         } else {
+ *             bit0.write();
+ *         }
+ *     }
+ *     core_util_critical_section_exit();
+ * }
+ * @endcode
+ *
+ * @note Synchronization level: Interrupt safe
+ *
+ * @tparam ClockHz   The CPU core clock the padding is computed for.
+ * @tparam SegmentNs Segment durations in nanoseconds, alternating
+ *                   high/low starting with high.
+ */
+template<uint32_t ClockHz, uint32_t... SegmentNs>
+class WaveformOut : private NonCopyable<WaveformOut<ClockHz, SegmentNs...>> {
+public:
+    static_assert(sizeof...(SegmentNs) > 0, "WaveformOut needs at least one segment");
+
+    /** Create a WaveformOut connected to the specified pin
+     *
+     *  The pin starts driven low.
+     *
+     *  @param pin WaveformOut pin to connect to
+     */
+    WaveformOut(PinName pin)
+    {
+        gpio_init_out(&_gpio, pin);
+    }
+
+    /** Emit the waveform once
+     *
+     *  Runs the straight-line segment sequence and leaves the pin at the
+     *  last segment's level - waveforms normally end with a low segment
+     *  so the line idles low. The caller is responsible for masking
+     *  interrupts around timing-critical runs; back-to-back calls under
+     *  one critical section chain bits without gaps beyond the loop
+     *  overhead.
+     */
+    MBED_FORCEINLINE void write()
+    {
+        emit(mstd::make_index_sequence<sizeof...(SegmentNs)>{});
+    }
+
+    /** Emit the waveform once inside its own critical section
+     *
+     *  Convenience for isolated emissions; for runs of many waveforms
+     *  take one critical section around the run and use write() instead.
+     */
+    void write_protected()
+    {
+        core_util_critical_section_enter();
+        write();
+        core_util_critical_section_exit();
+    }
+
+private:
+    /* Nanoseconds to cycles at ClockHz, rounded to nearest, minus the
+     * estimated cost of the segment's own gpio_write. */
+    static constexpr uint32_t pad_cycles(uint32_t ns)
+    {
+        return ((uint64_t)ns * ClockHz + 500000000ULL) / 1000000000ULL > MBED_CONF_DRIVERS_WAVEFORM_WRITE_CYCLES
+               ? (uint32_t)(((uint64_t)ns * ClockHz + 500000000ULL) / 1000000000ULL) - MBED_CONF_DRIVERS_WAVEFORM_WRITE_CYCLES
+               : 0u;
+    }
+
+    template<uint32_t Ns, bool Level>
+    MBED_FORCEINLINE void segment()
+    {
+        gpio_write(&_gpio, Level);
+        impl::CyclePad<pad_cycles(Ns)>::pad();
+    }
+
+    template<size_t... Is>
+    MBED_FORCEINLINE void emit(mstd::index_sequence<Is...>)
+    {
+        using expand = int[];
+        (void)expand{0, (segment<SegmentNs, (Is % 2 == 0)>(), 0)...};
+    }
+
+    gpio_t _gpio;
+};
+
+/** @}*/
+
+} // namespace mbed
+
+#endif
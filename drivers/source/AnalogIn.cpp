@@ -16,6 +16,7 @@
  */
 
 #include "drivers/AnalogIn.h"
+#include "drivers/Ticker.h"
 
 #if DEVICE_ANALOGIN
 
@@ -54,6 +55,61 @@ unsigned short AnalogIn::read_u16()
     return ret;
 }
 
+void AnalogIn::read_burst(unsigned short *buffer, size_t count)
+{
+    lock();
+    for (size_t i = 0; i < count; i++) {
+        buffer[i] = analogin_read_u16(&_adc);
+    }
+    unlock();
+}
+
+int AnalogIn::start_sampling(unsigned short *buffer, size_t count, std::chrono::microseconds sample_period, mbed::Callback<void(const unsigned short *, size_t)> callback)
+{
+    if (buffer == NULL || count < 2 || !callback) {
+        return -1;
+    }
+    lock();
+    if (_sampler != NULL) {
+        unlock();
+        return -1;
+    }
+    _sample_buffer = buffer;
+    _sample_count = count;
+    _sample_index = 0;
+    _sample_cb = callback;
+    _sampler = new Ticker;
+    _sampler->attach(mbed::callback(this, &AnalogIn::_sample_isr), sample_period);
+    unlock();
+    return 0;
+}
+
+void AnalogIn::stop_sampling()
+{
+    lock();
+    if (_sampler != NULL) {
+        _sampler->detach();
+        delete _sampler;
+        _sampler = NULL;
+        _sample_cb = NULL;
+    }
+    unlock();
+}
+
+void AnalogIn::_sample_isr()
+{
+    // Interrupt context - one conversion and pointer bookkeeping only.
+    _sample_buffer[_sample_index++] = analogin_read_u16(&_adc);
+
+    size_t half = _sample_count / 2;
+    if (_sample_index == half) {
+        _sample_cb(_sample_buffer, half);
+    } else if (_sample_index >= _sample_count) {
+        _sample_cb(_sample_buffer + half, _sample_count - half);
+        _sample_index = 0;
+    }
+}
+
 float AnalogIn::read_voltage()
 {
     return read() * _vref;
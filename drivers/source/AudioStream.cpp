@@ -0,0 +1,120 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "drivers/AudioStream.h"
+
+#if DEVICE_I2S
+
+#include "platform/mbed_atomic.h"
+#include "platform/mbed_error.h"
+
+namespace mbed {
+
+AudioStream::AudioStream(Direction direction, PinName data, PinName ws, PinName sck, PinName mclk)
+    : _buffer(NULL), _half_length(0),
+      _last_event(I2S_EVENT_COMPLETE), _started(false), _xruns(0)
+{
+    if (i2s_init(&_i2s, direction == Transmit ? I2S_TRANSMIT : I2S_RECEIVE,
+                 data, ws, sck, mclk) != 0) {
+        MBED_ERROR1(MBED_MAKE_ERROR(MBED_MODULE_DRIVER, MBED_ERROR_CODE_INITIALIZATION_FAILED),
+                    "AudioStream: pins not supported", data);
+    }
+}
+
+AudioStream::~AudioStream()
+{
+    stop();
+    i2s_free(&_i2s);
+}
+
+int AudioStream::configure(uint32_t sample_rate, uint8_t word_bits, uint8_t channels,
+                           i2s_format_t format)
+{
+    if (_started) {
+        return -1;
+    }
+    return i2s_configure(&_i2s, sample_rate, word_bits, channels, format);
+}
+
+int AudioStream::start(void *buffer, size_t length, Callback<void(void *, size_t)> data_fn)
+{
+    if (_started) {
+        return -1;
+    }
+    _buffer = (uint8_t *)buffer;
+    _half_length = length / 2;
+    _data_fn = data_fn;
+    // The first event reported by a running stream is HALF_COMPLETE
+    _last_event = I2S_EVENT_COMPLETE;
+    _xruns = 0;
+
+    if (i2s_transfer_start(&_i2s, buffer, length, &AudioStream::_irq, this) != 0) {
+        return -1;
+    }
+    _started = true;
+    return 0;
+}
+
+void AudioStream::stop()
+{
+    if (!_started) {
+        return;
+    }
+    i2s_transfer_stop(&_i2s);
+    _started = false;
+}
+
+bool AudioStream::active()
+{
+    return _started && i2s_active(&_i2s);
+}
+
+uint32_t AudioStream::xruns() const
+{
+    return core_util_atomic_load_u32(&_xruns);
+}
+
+void AudioStream::_irq(void *context, i2s_event_t event)
+{
+    static_cast<AudioStream *>(context)->handle(event);
+}
+
+void AudioStream::handle(i2s_event_t event)
+{
+    if (event == I2S_EVENT_ERROR) {
+        // Hardware FIFO underran or overran - the DMA keeps running
+        core_util_atomic_incr_u32(&_xruns, 1);
+        return;
+    }
+
+    // Half and full events alternate while the stream keeps up; seeing the
+    // same one twice means a period's interrupt was merged away under load
+    if (event == _last_event) {
+        core_util_atomic_incr_u32(&_xruns, 1);
+    }
+    _last_event = event;
+
+    if (_data_fn) {
+        // The half that just finished transferring is now idle
+        uint8_t *half = (event == I2S_EVENT_HALF_COMPLETE) ? _buffer : _buffer + _half_length;
+        _data_fn(half, _half_length);
+    }
+}
+
+} // namespace mbed
+
+#endif // DEVICE_I2S
@@ -179,9 +179,16 @@ ssize_t BufferedSerial::write(const void *buffer, size_t length)
             } while (_txbuf.full());
         }
 
-        while (data_written < length && !_txbuf.full()) {
-            _txbuf.push(*buf_ptr++);
-            data_written++;
+        // Push as much as fits in one block operation. The IRQ only consumes,
+        // so the free space observed here can only grow underneath us.
+        size_t to_write = length - data_written;
+        size_t free_space = _txbuf.capacity() - _txbuf.size();
+        if (to_write > free_space) {
+            to_write = free_space;
+        }
+        if (to_write != 0) {
+            _txbuf.push(buf_ptr + data_written, to_write);
+            data_written += to_write;
         }
 
         update_tx_irq();
@@ -215,10 +222,7 @@ ssize_t BufferedSerial::read(void *buffer, size_t length)
         api_lock();
     }
 
-    while (data_read < length && !_rxbuf.empty()) {
-        _rxbuf.pop(*ptr++);
-        data_read++;
-    }
+    data_read = _rxbuf.pop(ptr, length);
 
     update_rx_irq();
 
@@ -227,6 +231,41 @@ ssize_t BufferedSerial::read(void *buffer, size_t length)
     return data_read;
 }
 
+ssize_t BufferedSerial::read_claim(const char **buffer)
+{
+    api_lock();
+
+    while (_rxbuf.empty()) {
+        if (!_blocking) {
+            api_unlock();
+            return -EAGAIN;
+        }
+        api_unlock();
+        // Do we need a proper wait?
+        thread_sleep_for(1);
+        api_lock();
+    }
+
+    ssize_t data_available = _rxbuf.peek_contiguous(buffer);
+
+    api_unlock();
+
+    return data_available;
+}
+
+ssize_t BufferedSerial::read_release(size_t length)
+{
+    api_lock();
+
+    ssize_t data_released = _rxbuf.drop(length);
+
+    update_rx_irq();
+
+    api_unlock();
+
+    return data_released;
+}
+
 bool BufferedSerial::hup() const
 {
     return _dcd_irq && _dcd_irq->read() != 0;
@@ -313,11 +352,72 @@ void BufferedSerial::tx_irq(void)
     }
 }
 
+#if DEVICE_SERIAL_ASYNCH
+int BufferedSerial::enable_rx_dma(bool enabled)
+{
+    api_lock();
+    if (enabled != _rx_dma_enabled) {
+        if (enabled) {
+            core_util_critical_section_enter();
+            if (_rx_irq_enabled) {
+                disable_rx_irq();
+            }
+            _rx_dma_enabled = true;
+            core_util_critical_section_exit();
+            SerialBase::set_dma_usage_rx(DMA_USAGE_ALWAYS);
+            SerialBase::read(_rx_dma_chunk, sizeof(_rx_dma_chunk),
+                             callback(this, &BufferedSerial::rx_dma_handler),
+                             SERIAL_EVENT_RX_COMPLETE);
+        } else {
+            _rx_dma_enabled = false;
+            SerialBase::abort_read();
+            SerialBase::set_dma_usage_rx(DMA_USAGE_NEVER);
+            update_rx_irq();
+        }
+    }
+    api_unlock();
+
+    return 0;
+}
+
+void BufferedSerial::rx_dma_handler(int event)
+{
+    bool was_empty = _rxbuf.empty();
+
+    if (event & SERIAL_EVENT_RX_COMPLETE) {
+        // Drop what won't fit - same policy as an RX FIFO overrun in
+        // interrupt mode.
+        size_t space = MBED_CONF_DRIVERS_UART_SERIAL_RXBUF_SIZE - _rxbuf.size();
+        size_t length = sizeof(_rx_dma_chunk) < space ? sizeof(_rx_dma_chunk) : space;
+        if (length > 0) {
+            _rxbuf.push(reinterpret_cast<const char *>(_rx_dma_chunk), length);
+        }
+    }
+
+    if (_rx_dma_enabled) {
+        SerialBase::read(_rx_dma_chunk, sizeof(_rx_dma_chunk),
+                         callback(this, &BufferedSerial::rx_dma_handler),
+                         SERIAL_EVENT_RX_COMPLETE);
+    }
+
+    // Report the File handler that data is ready to be read from the buffer.
+    if (was_empty && !_rxbuf.empty()) {
+        wake();
+    }
+}
+#endif // DEVICE_SERIAL_ASYNCH
+
 /* Attach Rx-IRQ routine to the serial device eventually.
  */
 void BufferedSerial::update_rx_irq()
 {
     core_util_critical_section_enter();
+#if DEVICE_SERIAL_ASYNCH
+    if (_rx_dma_enabled) {
+        core_util_critical_section_exit();
+        return;
+    }
+#endif
     if (_rx_enabled && !_rx_irq_enabled) {
         BufferedSerial::rx_irq();
         if (!_rxbuf.full()) {
@@ -20,6 +20,11 @@
 
 #include "platform/mbed_power_mgmt.h"
 
+#if MBED_CONF_DRIVERS_CAN_DIAG_RING_SIZE > 0
+#include "platform/mbed_critical.h"
+#include "hal/us_ticker_api.h"
+#endif
+
 namespace mbed {
 
 CAN::CAN(PinName rd, PinName td) : _can(), _irq()
@@ -58,6 +63,10 @@ CAN::~CAN()
     for (int irq = 0; irq < IrqType::IrqCnt; irq++) {
         attach(nullptr, (IrqType)irq);
     }
+#if MBED_CONF_DRIVERS_CAN_DIAG_RING_SIZE > 0
+    // releases the interrupts and the sleep lock capture was holding
+    diag_capture(false);
+#endif
     can_irq_free(&_can);
     can_free(&_can);
 }
@@ -81,11 +90,43 @@ int CAN::write(CANMessage msg)
 int CAN::read(CANMessage &msg, int handle)
 {
     lock();
+#if MBED_CONF_DRIVERS_CAN_RX_RING_SIZE > 0
+    if (handle == 0 && _rxring.pop(msg)) {
+        unlock();
+        return 1;
+    }
+#endif
     int ret = can_read(&_can, &msg, handle);
+#if MBED_CONF_DRIVERS_CAN_DIAG_RING_SIZE > 0
+    if (ret) {
+        diag_frame(msg, ticker_read(get_us_ticker_data()));
+    }
+#endif
     unlock();
     return ret;
 }
 
+int CAN::read_burst(CANMessage *msgs, int count, int handle)
+{
+    lock();
+    int read = 0;
+#if MBED_CONF_DRIVERS_CAN_RX_RING_SIZE > 0
+    if (handle == 0) {
+        while (read < count && _rxring.pop(msgs[read])) {
+            read++;
+        }
+    }
+#endif
+    while (read < count && can_read(&_can, &msgs[read], handle)) {
+#if MBED_CONF_DRIVERS_CAN_DIAG_RING_SIZE > 0
+        diag_frame(msgs[read], ticker_read(get_us_ticker_data()));
+#endif
+        read++;
+    }
+    unlock();
+    return read;
+}
+
 void CAN::reset()
 {
     lock();
@@ -141,6 +182,11 @@ void CAN::attach(Callback<void()> func, IrqType type)
             sleep_manager_lock_deep_sleep();
         }
         _irq[(CanIrqType)type] = func;
+#if MBED_CONF_DRIVERS_CAN_DIAG_RING_SIZE > 0
+        // the callback owns the interrupt now; diag_capture(false) must
+        // not turn it off behind the application's back
+        _diag_irq_mask &= ~(1u << type);
+#endif
         can_irq_set(&_can, (CanIrqType)type, 1);
     } else {
         // unlock deep sleep only the first time
@@ -148,7 +194,16 @@ void CAN::attach(Callback<void()> func, IrqType type)
             sleep_manager_unlock_deep_sleep();
         }
         _irq[(CanIrqType)type] = nullptr;
-        can_irq_set(&_can, (CanIrqType)type, 0);
+#if MBED_CONF_DRIVERS_CAN_DIAG_RING_SIZE > 0
+        if (_diag_capture && diag_uses_irq((CanIrqType)type)) {
+            // capture still needs this interrupt; take it over instead of
+            // disabling it
+            _diag_irq_mask |= (1u << type);
+        } else
+#endif
+        {
+            can_irq_set(&_can, (CanIrqType)type, 0);
+        }
     }
     unlock();
 }
@@ -156,11 +211,139 @@ void CAN::attach(Callback<void()> func, IrqType type)
 void CAN::_irq_handler(uint32_t id, CanIrqType type)
 {
     CAN *handler = (CAN *)id;
+#if MBED_CONF_DRIVERS_CAN_DIAG_RING_SIZE > 0
+    if (handler->_diag_capture) {
+        handler->diag_count(type, ticker_read(get_us_ticker_data()));
+    }
+#endif
+#if MBED_CONF_DRIVERS_CAN_RX_RING_SIZE > 0
+    if (type == IRQ_RX) {
+        // Drain the hardware-filtered FIFO into the ring so a burst longer
+        // than the controller's FIFO survives until a reader thread runs.
+        CANMessage msg;
+#if MBED_CONF_DRIVERS_CAN_DIAG_RING_SIZE > 0
+        timestamp_t now = ticker_read(get_us_ticker_data());
+#endif
+        while (!handler->_rxring.full() && can_read(&handler->_can, &msg, 0)) {
+            handler->_rxring.push(msg);
+#if MBED_CONF_DRIVERS_CAN_DIAG_RING_SIZE > 0
+            handler->diag_frame(msg, now);
+#endif
+        }
+    }
+#endif
     if (handler->_irq[type]) {
         handler->_irq[type].call();
     }
 }
 
+#if MBED_CONF_DRIVERS_CAN_DIAG_RING_SIZE > 0
+
+bool CAN::diag_uses_irq(CanIrqType type)
+{
+    switch (type) {
+        case IRQ_ERROR:
+        case IRQ_OVERRUN:
+        case IRQ_PASSIVE:
+        case IRQ_ARB:
+        case IRQ_BUS:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void CAN::diag_count(CanIrqType type, timestamp_t now)
+{
+    switch (type) {
+        case IRQ_BUS:
+            _diag_stats.bus_error_cnt++;
+            _diag_stats.last_bus_error_time = now;
+            break;
+        case IRQ_ARB:
+            _diag_stats.arb_lost_cnt++;
+            _diag_stats.last_arb_lost_time = now;
+            break;
+        case IRQ_OVERRUN:
+            _diag_stats.overrun_cnt++;
+            break;
+        case IRQ_ERROR:
+            _diag_stats.error_warning_cnt++;
+            break;
+        case IRQ_PASSIVE:
+            _diag_stats.error_passive_cnt++;
+            break;
+        default:
+            break;
+    }
+}
+
+void CAN::diag_frame(const CANMessage &msg, timestamp_t timestamp)
+{
+    if (!_diag_capture) {
+        return;
+    }
+    can_diag_frame_t frame;
+    frame.msg = msg;
+    frame.timestamp = timestamp;
+    // push() overwrites the oldest entry when full, keeping the most
+    // recent traffic for post-mortem reads
+    _diag_ring.push(frame);
+}
+
+void CAN::diag_capture(bool enable)
+{
+    lock();
+    if (enable && !_diag_capture) {
+        sleep_manager_lock_deep_sleep();
+        _diag_capture = true;
+        // enable the error interrupts the counters rely on, unless a
+        // callback already holds them
+        for (int irq = 0; irq < IrqType::IrqCnt; irq++) {
+            if (diag_uses_irq((CanIrqType)irq) && !_irq[irq]) {
+                _diag_irq_mask |= (1u << irq);
+                can_irq_set(&_can, (CanIrqType)irq, 1);
+            }
+        }
+    } else if (!enable && _diag_capture) {
+        _diag_capture = false;
+        for (int irq = 0; irq < IrqType::IrqCnt; irq++) {
+            if (_diag_irq_mask & (1u << irq)) {
+                can_irq_set(&_can, (CanIrqType)irq, 0);
+            }
+        }
+        _diag_irq_mask = 0;
+        sleep_manager_unlock_deep_sleep();
+    }
+    unlock();
+}
+
+void CAN::diag_stats(can_diag_stats_t &stats)
+{
+    core_util_critical_section_enter();
+    stats = _diag_stats;
+    core_util_critical_section_exit();
+}
+
+int CAN::diag_read(can_diag_frame_t *frames, int count)
+{
+    int read = 0;
+    while (read < count && _diag_ring.pop(frames[read])) {
+        read++;
+    }
+    return read;
+}
+
+void CAN::diag_reset()
+{
+    core_util_critical_section_enter();
+    _diag_stats = {};
+    _diag_ring.reset();
+    core_util_critical_section_exit();
+}
+
+#endif // MBED_CONF_DRIVERS_CAN_DIAG_RING_SIZE > 0
+
 void CAN::lock()
 {
     _mutex.lock();
@@ -0,0 +1,284 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "drivers/DisplayPipeline.h"
+
+#if DEVICE_SPI
+
+#include <string.h>
+
+namespace mbed {
+
+DisplayPipeline::DisplayPipeline(SPI &spi, uint16_t width, uint16_t height, uint8_t bytes_per_pixel,
+                                 void *buffer_a, void *buffer_b,
+                                 Callback<void(const Rect &)> set_window)
+    : _spi(spi), _width(width), _height(height), _bpp(bytes_per_pixel),
+      _front((uint8_t *)buffer_a), _back((uint8_t *)buffer_b),
+      _set_window(set_window),
+      _rect_count(0), _flush_count(0),
+      _flushing(false), _cur_rect(0), _cur_row(0),
+      _pixels(0), _frames(0)
+{
+}
+
+uint8_t *DisplayPipeline::frame()
+{
+    return _back;
+}
+
+/* True when the rectangles overlap or share an edge, so their union has no
+ * undamaged interior gap */
+static bool rects_touch(const DisplayPipeline::Rect &a, const DisplayPipeline::Rect &b)
+{
+    return a.x <= (uint16_t)(b.x + b.w) && b.x <= (uint16_t)(a.x + a.w) &&
+           a.y <= (uint16_t)(b.y + b.h) && b.y <= (uint16_t)(a.y + a.h);
+}
+
+void DisplayPipeline::merge(Rect &into, const Rect &from)
+{
+    uint16_t right = (into.x + into.w > from.x + from.w) ? into.x + into.w : from.x + from.w;
+    uint16_t bottom = (into.y + into.h > from.y + from.h) ? into.y + into.h : from.y + from.h;
+    if (from.x < into.x) {
+        into.x = from.x;
+    }
+    if (from.y < into.y) {
+        into.y = from.y;
+    }
+    into.w = right - into.x;
+    into.h = bottom - into.y;
+}
+
+void DisplayPipeline::mark_dirty(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+    if (x >= _width || y >= _height) {
+        return;
+    }
+    if (w > _width - x) {
+        w = _width - x;
+    }
+    if (h > _height - y) {
+        h = _height - y;
+    }
+    if (w == 0 || h == 0) {
+        return;
+    }
+    Rect r = {x, y, w, h};
+
+    for (int i = 0; i < _rect_count; i++) {
+        if (rects_touch(_rects[i], r)) {
+            merge(_rects[i], r);
+            return;
+        }
+    }
+
+    if (_rect_count < MBED_CONF_DRIVERS_DISPLAY_PIPELINE_MAX_RECTS) {
+        _rects[_rect_count++] = r;
+        return;
+    }
+
+    // Table full - merge into the rectangle that grows by the least area
+    int best = 0;
+    uint32_t best_growth = (uint32_t) -1;
+    for (int i = 0; i < _rect_count; i++) {
+        Rect u = _rects[i];
+        merge(u, r);
+        uint32_t growth = (uint32_t)u.w * u.h - (uint32_t)_rects[i].w * _rects[i].h;
+        if (growth < best_growth) {
+            best_growth = growth;
+            best = i;
+        }
+    }
+    merge(_rects[best], r);
+}
+
+void DisplayPipeline::mark_all_dirty()
+{
+    _rects[0].x = 0;
+    _rects[0].y = 0;
+    _rects[0].w = _width;
+    _rects[0].h = _height;
+    _rect_count = 1;
+}
+
+void DisplayPipeline::copy_rect_to_back(const Rect &r)
+{
+    size_t row_bytes = (size_t)r.w * _bpp;
+    size_t offset = ((size_t)r.y * _width + r.x) * _bpp;
+    size_t stride = (size_t)_width * _bpp;
+    for (uint16_t row = 0; row < r.h; row++) {
+        memcpy(_back + offset, _front + offset, row_bytes);
+        offset += stride;
+    }
+}
+
+bool DisplayPipeline::flush(Callback<void()> done)
+{
+    if (_flushing) {
+        return false;
+    }
+    if (_rect_count == 0) {
+        if (done) {
+            done();
+        }
+        return true;
+    }
+
+    memcpy(_flush_rects, _rects, _rect_count * sizeof(Rect));
+    _flush_count = _rect_count;
+    _rect_count = 0;
+    _done = done;
+
+    // The buffer just drawn becomes the front buffer being streamed; carry
+    // its flushed regions over so the new back buffer stays a complete frame
+    uint8_t *tmp = _front;
+    _front = _back;
+    _back = tmp;
+    for (int i = 0; i < _flush_count; i++) {
+        copy_rect_to_back(_flush_rects[i]);
+        _pixels += (uint32_t)_flush_rects[i].w * _flush_rects[i].h;
+    }
+
+    _flushing = true;
+    _cur_rect = 0;
+#if DEVICE_SPI_ASYNCH
+    start_rect();
+#else
+    flush_blocking();
+#endif
+    return true;
+}
+
+bool DisplayPipeline::flushing() const
+{
+    return _flushing;
+}
+
+uint32_t DisplayPipeline::pixels_flushed() const
+{
+    return _pixels;
+}
+
+uint32_t DisplayPipeline::frames_flushed() const
+{
+    return _frames;
+}
+
+void DisplayPipeline::flush_blocking()
+{
+    for (int i = 0; i < _flush_count; i++) {
+        const Rect &r = _flush_rects[i];
+        _set_window(r);
+        size_t row_bytes = (size_t)r.w * _bpp;
+        const uint8_t *row = _front + ((size_t)r.y * _width + r.x) * _bpp;
+        if (r.x == 0 && r.w == _width) {
+            // Contiguous - one write covers the whole rectangle
+            _spi.write((const char *)row, r.h * row_bytes, NULL, 0);
+        } else {
+            for (uint16_t y = 0; y < r.h; y++) {
+                _spi.write((const char *)row, row_bytes, NULL, 0);
+                row += (size_t)_width * _bpp;
+            }
+        }
+    }
+    _flushing = false;
+    _frames++;
+    if (_done) {
+        _done();
+    }
+}
+
+#if DEVICE_SPI_ASYNCH
+
+void DisplayPipeline::start_rect()
+{
+    _set_window(_flush_rects[_cur_rect]);
+    _cur_row = 0;
+    next_batch();
+}
+
+void DisplayPipeline::next_batch()
+{
+    const Rect &r = _flush_rects[_cur_rect];
+    size_t row_bytes = (size_t)r.w * _bpp;
+    size_t stride = (size_t)_width * _bpp;
+    const uint8_t *row = _front + ((size_t)(r.y + _cur_row) * _width + r.x) * _bpp;
+    size_t count = 0;
+
+    if (r.x == 0 && r.w == _width) {
+        // Contiguous rows stream as a single scatter-gather segment
+        _segments[0].tx_buffer = (void *)row;
+        _segments[0].tx_length = (size_t)(r.h - _cur_row) * row_bytes;
+        _segments[0].rx_buffer = NULL;
+        _segments[0].rx_length = 0;
+        _segments[0].width = 8;
+        count = 1;
+        _cur_row = r.h;
+    } else {
+        while (_cur_row < r.h && count < MBED_CONF_DRIVERS_DISPLAY_PIPELINE_SEGMENTS) {
+            _segments[count].tx_buffer = (void *)row;
+            _segments[count].tx_length = row_bytes;
+            _segments[count].rx_buffer = NULL;
+            _segments[count].rx_length = 0;
+            _segments[count].width = 8;
+            count++;
+            _cur_row++;
+            row += stride;
+        }
+    }
+
+    if (_spi.transfer_sequence(_segments, count,
+                               callback(this, &DisplayPipeline::transfer_done),
+                               SPI_EVENT_COMPLETE | SPI_EVENT_ERROR) != 0) {
+        // Peripheral claimed by another transfer - abandon this flush
+        _flushing = false;
+        if (_done) {
+            _done();
+        }
+    }
+}
+
+void DisplayPipeline::transfer_done(int event)
+{
+    if (event & SPI_EVENT_ERROR) {
+        _flushing = false;
+        if (_done) {
+            _done();
+        }
+        return;
+    }
+
+    if (_cur_row < _flush_rects[_cur_rect].h) {
+        next_batch();
+        return;
+    }
+    if (++_cur_rect < _flush_count) {
+        start_rect();
+        return;
+    }
+
+    _flushing = false;
+    _frames++;
+    if (_done) {
+        _done();
+    }
+}
+
+#endif // DEVICE_SPI_ASYNCH
+
+} // namespace mbed
+
+#endif // DEVICE_SPI
@@ -0,0 +1,175 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "drivers/DmaCopy.h"
+
+#include <string.h>
+
+#include "hal/dma_api.h"
+#include "platform/mbed_atomic.h"
+#include "platform/mbed_critical.h"
+
+namespace mbed {
+namespace dma {
+
+struct copy_slot_t {
+#if DEVICE_DMA
+    dma_transfer_t desc;  /**< Descriptor handed to the controller */
+    int channel;          /**< Channel running this move */
+    size_t bytes;         /**< Total size, for the CPU fallback on error */
+    uint32_t fill_value;  /**< Source word for fills, replicated from the fill byte */
+    bool is_fill;         /**< Distinguishes the error fallback */
+#endif
+    uint32_t generation;  /**< Odd while a move is in flight; bumped on completion */
+};
+
+bool TransferHandle::done() const
+{
+    if (_slot == nullptr) {
+        return true;
+    }
+    return core_util_atomic_load_u32(&_slot->generation) != _generation;
+}
+
+void TransferHandle::wait() const
+{
+    while (!done()) {
+    }
+}
+
+#if DEVICE_DMA
+
+static copy_slot_t slots[DMA_COPY_SLOTS];
+
+static void copy_handler(uint32_t id, dma_event_t event)
+{
+    copy_slot_t *slot = (copy_slot_t *)id;
+    if (event == DMA_EVENT_TRANSFER_ERROR) {
+        // redo the whole move on the CPU so the handle still completes
+        if (slot->is_fill) {
+            memset(slot->desc.dst, (uint8_t)slot->fill_value, slot->bytes);
+        } else {
+            memcpy(slot->desc.dst, slot->desc.src, slot->bytes);
+        }
+    }
+    dma_channel_free(slot->channel);
+    // publish completion - the generation becomes even and the slot reusable
+    core_util_atomic_store_u32(&slot->generation, slot->generation + 1);
+}
+
+static copy_slot_t *claim_slot()
+{
+    copy_slot_t *slot = NULL;
+    core_util_critical_section_enter();
+    for (int i = 0; i < DMA_COPY_SLOTS; i++) {
+        if (!(slots[i].generation & 1)) {
+            int channel = dma_channel_allocate(0);
+            if (channel == DMA_ERROR_OUT_OF_CHANNELS) {
+                break;
+            }
+            slots[i].channel = channel;
+            slots[i].generation++;
+            slot = &slots[i];
+            break;
+        }
+    }
+    core_util_critical_section_exit();
+    return slot;
+}
+
+static void release_slot(copy_slot_t *slot)
+{
+    core_util_critical_section_enter();
+    dma_channel_free(slot->channel);
+    slot->generation++;
+    core_util_critical_section_exit();
+}
+
+TransferHandle start_move(copy_slot_t *slot, size_t n)
+{
+    // word moves when everything is 32 bit aligned, byte moves otherwise
+    if (((((uintptr_t)slot->desc.src) | ((uintptr_t)slot->desc.dst) | n) & 3) == 0) {
+        slot->desc.width = DMA_WIDTH_32BIT;
+        slot->desc.length = n / 4;
+    } else {
+        slot->desc.width = DMA_WIDTH_8BIT;
+        slot->desc.length = n;
+    }
+    slot->desc.direction = DMA_MEM_TO_MEM;
+    slot->desc.trigger = 0;
+    slot->desc.next = NULL;
+    slot->bytes = n;
+    if (dma_transfer_setup(slot->channel, &slot->desc, copy_handler, (uint32_t)slot) != 0) {
+        release_slot(slot);
+        return TransferHandle();
+    }
+    // capture the generation before starting - the completion interrupt
+    // may run before dma_transfer_start returns
+    TransferHandle handle(slot, slot->generation);
+    dma_transfer_start(slot->channel);
+    return handle;
+}
+
+#endif // DEVICE_DMA
+
+TransferHandle copy(void *dst, const void *src, size_t n)
+{
+#if DEVICE_DMA
+    if (n >= DMA_COPY_THRESHOLD) {
+        copy_slot_t *slot = claim_slot();
+        if (slot != NULL) {
+            slot->desc.src = src;
+            slot->desc.dst = dst;
+            slot->desc.src_increment = true;
+            slot->desc.dst_increment = true;
+            slot->is_fill = false;
+            TransferHandle handle = start_move(slot, n);
+            if (handle._slot != nullptr) {
+                return handle;
+            }
+            // setup was refused - fall through to the CPU
+        }
+    }
+#endif
+    memcpy(dst, src, n);
+    return TransferHandle();
+}
+
+TransferHandle fill(void *dst, uint8_t value, size_t n)
+{
+#if DEVICE_DMA
+    if (n >= DMA_COPY_THRESHOLD) {
+        copy_slot_t *slot = claim_slot();
+        if (slot != NULL) {
+            slot->fill_value = value * 0x01010101u;
+            slot->desc.src = &slot->fill_value;
+            slot->desc.dst = dst;
+            slot->desc.src_increment = false;
+            slot->desc.dst_increment = true;
+            slot->is_fill = true;
+            TransferHandle handle = start_move(slot, n);
+            if (handle._slot != nullptr) {
+                return handle;
+            }
+        }
+    }
+#endif
+    memset(dst, value, n);
+    return TransferHandle();
+}
+
+} // namespace dma
+} // namespace mbed
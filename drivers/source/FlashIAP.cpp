@@ -213,6 +213,87 @@ int FlashIAP::erase(uint32_t addr, uint32_t size)
     return ret;
 }
 
+int FlashIAP::erase_async(uint32_t addr, uint32_t size, mbed::Callback<void(int)> callback)
+{
+    if (size == 0 || !is_aligned_to_sector(addr, size)) {
+        return -1;
+    }
+    int ret = 0;
+    _mutex->lock();
+    if (_async_queue.full()) {
+        ret = -1;
+    } else {
+        _async_queue.push({NULL, addr, size, callback});
+    }
+    _mutex->unlock();
+    return ret;
+}
+
+int FlashIAP::program_async(const void *buffer, uint32_t addr, uint32_t size, mbed::Callback<void(int)> callback)
+{
+    if (!buffer || size == 0 || !is_aligned(addr, get_page_size())) {
+        return -1;
+    }
+    int ret = 0;
+    _mutex->lock();
+    if (_async_queue.full()) {
+        ret = -1;
+    } else {
+        _async_queue.push({(const uint8_t *) buffer, addr, size, callback});
+    }
+    _mutex->unlock();
+    return ret;
+}
+
+bool FlashIAP::process()
+{
+    async_op_t op;
+
+    _mutex->lock();
+    if (!_async_queue.pop(op)) {
+        _mutex->unlock();
+        return false;
+    }
+    _mutex->unlock();
+
+    // One sector per step bounds how long the caller is stalled; erase()
+    // and program() do their own locking and retries.
+    uint32_t step = std::min(flash_get_sector_size(&_flash, op.addr) - (op.addr % flash_get_sector_size(&_flash, op.addr)), op.size);
+    int ret;
+    if (op.buffer) {
+        ret = program(op.buffer, op.addr, step);
+    } else {
+        ret = erase(op.addr, step);
+    }
+
+    if (ret != 0) {
+        // Drop the rest of the failed operation.
+        if (op.callback) {
+            op.callback(-1);
+        }
+    } else if (op.size == step) {
+        if (op.callback) {
+            op.callback(0);
+        }
+    } else {
+        // Re-queue the remainder at the back: queued operations on
+        // independent regions progress round-robin, one sector per step.
+        op.addr += step;
+        op.size -= step;
+        if (op.buffer) {
+            op.buffer += step;
+        }
+        _mutex->lock();
+        _async_queue.push(op);
+        _mutex->unlock();
+    }
+
+    _mutex->lock();
+    bool pending = !_async_queue.empty();
+    _mutex->unlock();
+    return pending;
+}
+
 uint32_t FlashIAP::get_page_size() const
 {
     return flash_get_page_size(&_flash);
@@ -0,0 +1,236 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string.h>
+#include <algorithm>
+#include "drivers/FlashUpdatePipeline.h"
+#include "platform/mbed_assert.h"
+
+#if DEVICE_FLASH
+
+namespace mbed {
+
+FlashUpdatePipeline::FlashUpdatePipeline(FlashIAP *flash)
+    : _flash(flash), _decompressor(), _crc_ctx(), _crc(0),
+      _buf{nullptr, nullptr}, _fill(0), _staged(0), _addr(0),
+      _erased_until(0), _bytes_written(0), _program_pending(false),
+      _program_result(0), _running(false)
+{
+}
+
+FlashUpdatePipeline::~FlashUpdatePipeline()
+{
+    if (_running) {
+        drain();
+    }
+    delete[] _buf[0];
+    delete[] _buf[1];
+}
+
+int FlashUpdatePipeline::start(uint32_t addr, decompressor_t decompressor)
+{
+    if (_running) {
+        return -1;
+    }
+
+    uint32_t page_size = _flash->get_page_size();
+    MBED_ASSERT((MBED_CONF_DRIVERS_FLASH_UPDATE_PIPELINE_BUFFER_SIZE % page_size) == 0);
+    if ((addr % _flash->get_sector_size(addr)) != 0) {
+        return -1;
+    }
+
+    if (!_buf[0]) {
+        _buf[0] = new uint8_t[MBED_CONF_DRIVERS_FLASH_UPDATE_PIPELINE_BUFFER_SIZE];
+        _buf[1] = new uint8_t[MBED_CONF_DRIVERS_FLASH_UPDATE_PIPELINE_BUFFER_SIZE];
+    }
+
+    _decompressor = decompressor;
+    _fill = 0;
+    _staged = 0;
+    _addr = addr;
+    _erased_until = addr;
+    _bytes_written = 0;
+    _program_pending = false;
+    _program_result = 0;
+    _running = true;
+    _crc_ctx.compute_partial_start(&_crc);
+    return 0;
+}
+
+int FlashUpdatePipeline::write(const void *chunk, uint32_t size)
+{
+    if (!_running || !chunk) {
+        return -1;
+    }
+
+    const uint8_t *in = (const uint8_t *) chunk;
+    while (size) {
+        uint32_t free_space = MBED_CONF_DRIVERS_FLASH_UPDATE_PIPELINE_BUFFER_SIZE - _staged;
+        uint8_t *out = _buf[_fill] + _staged;
+        uint32_t produced, consumed;
+        if (_decompressor) {
+            int ret = _decompressor(in, size, out, free_space);
+            if (ret < 0) {
+                // Output did not fit - flush the staged data and retry
+                // once with an almost empty buffer.
+                ret = flush_staged();
+                if (ret) {
+                    return ret;
+                }
+                out = _buf[_fill] + _staged;
+                ret = _decompressor(in, size, out, MBED_CONF_DRIVERS_FLASH_UPDATE_PIPELINE_BUFFER_SIZE - _staged);
+                if (ret < 0) {
+                    return ret;
+                }
+            }
+            produced = ret;
+            consumed = size;
+        } else {
+            produced = std::min(size, free_space);
+            memcpy(out, in, produced);
+            consumed = produced;
+        }
+
+        _crc_ctx.compute_partial(out, produced, &_crc);
+        _staged += produced;
+        _bytes_written += produced;
+        in += consumed;
+        size -= consumed;
+
+        if (_staged == MBED_CONF_DRIVERS_FLASH_UPDATE_PIPELINE_BUFFER_SIZE) {
+            int ret = flush_staged();
+            if (ret) {
+                return ret;
+            }
+        } else if (_program_pending) {
+            // Overlap: advance the in-flight program by one sector while
+            // the next chunk is still being staged.
+            _flash->process();
+        }
+    }
+    return 0;
+}
+
+int FlashUpdatePipeline::finish(uint32_t *crc)
+{
+    if (!_running) {
+        return -1;
+    }
+    _running = false;
+
+    int ret = 0;
+    uint32_t page_size = _flash->get_page_size();
+    if (_staged) {
+        // Pad the final page with the erase value; the padding is not
+        // part of the image, so the CRC was already computed above.
+        uint32_t prog_size = (_staged + page_size - 1) / page_size * page_size;
+        memset(_buf[_fill] + _staged, _flash->get_erase_value(), prog_size - _staged);
+        ret = drain();
+        if (!ret) {
+            ret = erase_until(_addr + prog_size);
+        }
+        if (!ret) {
+            ret = _flash->program(_buf[_fill], _addr, prog_size);
+        }
+        _addr += prog_size;
+        _staged = 0;
+    } else {
+        ret = drain();
+    }
+
+    _crc_ctx.compute_partial_stop(&_crc);
+    if (crc) {
+        *crc = _crc;
+    }
+    return ret;
+}
+
+uint32_t FlashUpdatePipeline::get_bytes_written() const
+{
+    return _bytes_written;
+}
+
+int FlashUpdatePipeline::flush_staged()
+{
+    uint32_t page_size = _flash->get_page_size();
+    uint32_t prog_size = _staged / page_size * page_size;
+    if (prog_size == 0) {
+        return 0;
+    }
+
+    // The other buffer must be free before staging continues into it.
+    int ret = drain();
+    if (ret) {
+        return ret;
+    }
+    ret = erase_until(_addr + prog_size);
+    if (ret) {
+        return ret;
+    }
+    ret = _flash->program_async(_buf[_fill], _addr, prog_size,
+                                callback(this, &FlashUpdatePipeline::program_done));
+    if (ret) {
+        return ret;
+    }
+    _program_pending = true;
+    _addr += prog_size;
+
+    // Carry the unaligned tail over to the other buffer and stage there
+    // while the program is in flight.
+    uint32_t tail = _staged - prog_size;
+    int other = _fill ^ 1;
+    memcpy(_buf[other], _buf[_fill] + prog_size, tail);
+    _fill = other;
+    _staged = tail;
+
+    // Give the queued program a head start.
+    _flash->process();
+    return 0;
+}
+
+int FlashUpdatePipeline::drain()
+{
+    while (_program_pending) {
+        _flash->process();
+    }
+    return _program_result;
+}
+
+int FlashUpdatePipeline::erase_until(uint32_t end)
+{
+    while (_erased_until < end) {
+        uint32_t sector_size = _flash->get_sector_size(_erased_until);
+        int ret = _flash->erase(_erased_until, sector_size);
+        if (ret) {
+            return ret;
+        }
+        _erased_until += sector_size;
+    }
+    return 0;
+}
+
+void FlashUpdatePipeline::program_done(int result)
+{
+    _program_pending = false;
+    if (result != 0 && _program_result == 0) {
+        _program_result = result;
+    }
+}
+
+} /* namespace mbed */
+
+#endif /* DEVICE_FLASH */
@@ -33,6 +33,7 @@ SingletonPtr<PlatformMutex> I2C::_mutex;
 I2C::I2C(PinName sda, PinName scl) :
 #if DEVICE_I2C_ASYNCH
     _irq(this), _usage(DMA_USAGE_NEVER), _deep_sleep_locked(false),
+    _list(NULL), _list_count(0), _list_index(0), _list_event(0),
 #endif
     _i2c(), _hz(100000)
 {
@@ -50,6 +51,7 @@ I2C::I2C(PinName sda, PinName scl) :
 I2C::I2C(const i2c_pinmap_t &static_pinmap) :
 #if DEVICE_I2C_ASYNCH
     _irq(this), _usage(DMA_USAGE_NEVER), _deep_sleep_locked(false),
+    _list(NULL), _list_count(0), _list_index(0), _list_event(0),
 #endif
     _i2c(), _hz(100000)
 {
@@ -134,6 +136,39 @@ int I2C::read(int ack)
     return ret;
 }
 
+int I2C::transfer_list(const transaction_segment_t *segments, int count)
+{
+    int completed = 0;
+
+    lock();
+    aquire();
+
+    for (int i = 0; i < count; i++) {
+        const transaction_segment_t *segment = &segments[i];
+        bool last = (i + 1 == count);
+
+        if (segment->tx_buffer && segment->tx_length > 0) {
+            // Never send a stop after the write - a read in the same segment
+            // or the next segment follows with a repeated start.
+            int stop = (last && !(segment->rx_buffer && segment->rx_length > 0)) ? 1 : 0;
+            if (i2c_write(&_i2c, segment->address, segment->tx_buffer, segment->tx_length, stop) != segment->tx_length) {
+                i2c_stop(&_i2c);
+                break;
+            }
+        }
+        if (segment->rx_buffer && segment->rx_length > 0) {
+            if (i2c_read(&_i2c, segment->address, segment->rx_buffer, segment->rx_length, last ? 1 : 0) != segment->rx_length) {
+                i2c_stop(&_i2c);
+                break;
+            }
+        }
+        completed++;
+    }
+
+    unlock();
+    return completed;
+}
+
 void I2C::start(void)
 {
     lock();
@@ -225,9 +260,44 @@ int I2C::transfer(int address, const char *tx_buffer, int tx_length, char *rx_bu
     return 0;
 }
 
+int I2C::transfer_list(const transaction_segment_t *segments, int count, const event_callback_t &callback, int event)
+{
+    if (count <= 0) {
+        return -1;
+    }
+    lock();
+    if (i2c_active(&_i2c)) {
+        unlock();
+        return -1; // transaction ongoing
+    }
+    lock_deep_sleep();
+    aquire();
+
+    _callback = callback;
+    _list = segments;
+    _list_count = count;
+    _list_index = 0;
+    _list_event = event;
+    _irq.callback(&I2C::irq_handler_asynch);
+    start_list_segment(&segments[0], count == 1);
+    unlock();
+    return 0;
+}
+
+void I2C::start_list_segment(const transaction_segment_t *segment, bool last)
+{
+    // Subscribe to completion internally so segments can be chained even if
+    // the caller only asked for error events.
+    i2c_transfer_asynch(&_i2c, (void *)segment->tx_buffer, segment->tx_length,
+                        (void *)segment->rx_buffer, segment->rx_length,
+                        segment->address, last ? 1 : 0, _irq.entry(),
+                        _list_event | I2C_EVENT_TRANSFER_COMPLETE, _usage);
+}
+
 void I2C::abort_transfer(void)
 {
     lock();
+    _list = NULL;
     i2c_abort_asynch(&_i2c);
     unlock_deep_sleep();
     unlock();
@@ -236,6 +306,17 @@ void I2C::abort_transfer(void)
 void I2C::irq_handler_asynch(void)
 {
     int event = i2c_irq_handler_asynch(&_i2c);
+    if (_list && event) {
+        if ((event & I2C_EVENT_TRANSFER_COMPLETE) && (++_list_index < _list_count)) {
+            // Chain the next segment with a repeated start.
+            start_list_segment(&_list[_list_index], _list_index + 1 == _list_count);
+            return;
+        }
+        // Last segment done (or error) - report only what the caller asked for.
+        _list = NULL;
+        unlock_deep_sleep();
+        event &= _list_event;
+    }
     if (_callback && event) {
         _callback.call(event);
     }
@@ -18,6 +18,10 @@
 
 #if DEVICE_INTERRUPTIN
 
+#if DEVICE_INTERRUPTIN_DIRECT
+#include "cmsis.h"
+#endif
+
 namespace mbed {
 
 // Note: This single-parameter constructor exists to maintain binary
@@ -47,12 +51,18 @@ InterruptIn::InterruptIn(PinName pin, PinMode mode) :
 
 void InterruptIn::irq_init(PinName pin)
 {
+#if DEVICE_INTERRUPTIN_DIRECT
+    _saved_vector = 0;
+#endif
     gpio_irq_init(&gpio_irq, pin, (&InterruptIn::_irq_handler), (uint32_t)this);
 }
 
 InterruptIn::~InterruptIn()
 {
     // No lock needed in the destructor
+#if DEVICE_INTERRUPTIN_DIRECT
+    detach_direct();
+#endif
     gpio_irq_free(&gpio_irq);
 }
 
@@ -95,6 +105,30 @@ void InterruptIn::fall(Callback<void()> func)
     core_util_critical_section_exit();
 }
 
+#if DEVICE_INTERRUPTIN_DIRECT
+void InterruptIn::attach_direct(gpio_irq_event edge, void (*handler)(void))
+{
+    core_util_critical_section_enter();
+    IRQn_Type irqn = gpio_irq_get_irqn(&gpio_irq);
+    if (_saved_vector == 0) {
+        _saved_vector = NVIC_GetVector(irqn);
+    }
+    gpio_irq_set(&gpio_irq, edge, 1);
+    NVIC_SetVector(irqn, (uint32_t)handler);
+    core_util_critical_section_exit();
+}
+
+void InterruptIn::detach_direct()
+{
+    core_util_critical_section_enter();
+    if (_saved_vector != 0) {
+        NVIC_SetVector(gpio_irq_get_irqn(&gpio_irq), _saved_vector);
+        _saved_vector = 0;
+    }
+    core_util_critical_section_exit();
+}
+#endif
+
 void InterruptIn::_irq_handler(uint32_t id, gpio_irq_event event)
 {
     InterruptIn *handler = (InterruptIn *)id;
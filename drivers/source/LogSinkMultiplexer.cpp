@@ -0,0 +1,109 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "drivers/LogSinkMultiplexer.h"
+
+#include "platform/mbed_atomic.h"
+#include "platform/mbed_critical.h"
+
+namespace mbed {
+
+LogSinkMultiplexer::LogSinkMultiplexer(events::EventQueue *queue) :
+    _queue(queue),
+    _sinks(),
+    _sink_count(0),
+    _drain_pending(false)
+{
+}
+
+int LogSinkMultiplexer::add_sink(FileHandle *sink)
+{
+    core_util_critical_section_enter();
+    int index = -1;
+    if (_sink_count < MBED_CONF_DRIVERS_LOG_SINK_COUNT) {
+        index = _sink_count;
+        _sinks[index].handle = sink;
+        _sinks[index].dropped = 0;
+        _sink_count = index + 1;
+    }
+    core_util_critical_section_exit();
+    return index;
+}
+
+ssize_t LogSinkMultiplexer::write(const void *buffer, size_t size)
+{
+    const char *data = static_cast<const char *>(buffer);
+
+    for (int i = 0; i < _sink_count; i++) {
+        sink_t &sink = _sinks[i];
+        for (size_t pos = 0; pos < size; pos++) {
+            if (sink.ring.full()) {
+                // dropping the tail keeps the buffered output contiguous;
+                // the counter makes the loss visible
+                core_util_atomic_incr_u32(&sink.dropped, size - pos);
+                break;
+            }
+            sink.ring.push(data[pos]);
+        }
+    }
+
+    // one drain event per burst, however many writes race to schedule it
+    if (!core_util_atomic_exchange_bool(&_drain_pending, true)) {
+        if (_queue->call(this, &LogSinkMultiplexer::drain) == 0) {
+            // queue out of memory; retry from the next write
+            core_util_atomic_store_bool(&_drain_pending, false);
+        }
+    }
+
+    return size;
+}
+
+uint32_t LogSinkMultiplexer::dropped(int sink) const
+{
+    if (sink < 0 || sink >= _sink_count) {
+        return 0;
+    }
+    return core_util_atomic_load_u32(&_sinks[sink].dropped);
+}
+
+void LogSinkMultiplexer::drain()
+{
+    // clear the flag before draining: writes landing while we forward
+    // get a fresh event rather than being stranded in the rings
+    core_util_atomic_store_bool(&_drain_pending, false);
+
+    for (int i = 0; i < _sink_count; i++) {
+        sink_t &sink = _sinks[i];
+        char chunk[32];
+        size_t len;
+        do {
+            len = 0;
+            while (len < sizeof(chunk) && sink.ring.pop(chunk[len])) {
+                len++;
+            }
+            if (len) {
+                sink.handle->write(chunk, len);
+            }
+        } while (len == sizeof(chunk));
+    }
+}
+
+void LogSinkMultiplexer::flush()
+{
+    drain();
+}
+
+} // namespace mbed
@@ -0,0 +1,129 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "drivers/PortScanner.h"
+
+#if DEVICE_PORTIN
+
+#include "platform/mbed_critical.h"
+
+namespace mbed {
+
+PortScanner::PortScanner(std::chrono::microseconds scan_interval, uint8_t debounce_scans) :
+    _interval(scan_interval),
+    _port_count(0),
+    _debounce_scans(debounce_scans > 0 ? debounce_scans : 1),
+    _running(false)
+{
+}
+
+PortScanner::~PortScanner()
+{
+    stop();
+}
+
+int PortScanner::add_port(PortName port, int mask)
+{
+    core_util_critical_section_enter();
+    if (_port_count >= PORTSCANNER_MAX_PORTS) {
+        core_util_critical_section_exit();
+        return -1;
+    }
+    scan_port_t *entry = &_ports[_port_count];
+    port_init(&entry->port, port, mask, PIN_INPUT);
+    entry->mask = mask;
+    // the current level is the initial debounced state
+    entry->stable = port_read(&entry->port) & entry->mask;
+    entry->pending = 0;
+    int index = _port_count++;
+    core_util_critical_section_exit();
+    return index;
+}
+
+void PortScanner::attach(Callback<void(int, int, int)> func)
+{
+    core_util_critical_section_enter();
+    _on_change = func;
+    core_util_critical_section_exit();
+}
+
+void PortScanner::start()
+{
+    core_util_critical_section_enter();
+    if (!_running) {
+        _ticker.attach(callback(this, &PortScanner::_scan), _interval);
+        _running = true;
+    }
+    core_util_critical_section_exit();
+}
+
+void PortScanner::stop()
+{
+    core_util_critical_section_enter();
+    if (_running) {
+        _ticker.detach();
+        _running = false;
+    }
+    core_util_critical_section_exit();
+}
+
+int PortScanner::read(int index) const
+{
+    return _ports[index].stable;
+}
+
+void PortScanner::_scan()
+{
+    for (int i = 0; i < _port_count; i++) {
+        scan_port_t *entry = &_ports[i];
+        uint32_t raw = port_read(&entry->port) & entry->mask;
+        uint32_t diff = raw ^ entry->stable;
+        if ((diff | entry->pending) == 0) {
+            // nothing moved - the common case costs one read and one XOR
+            continue;
+        }
+        uint32_t changed = 0;
+        uint32_t to_process = diff | entry->pending;
+        for (int pin = 0; to_process != 0; pin++, to_process >>= 1) {
+            if (!(to_process & 1)) {
+                continue;
+            }
+            uint32_t bit = 1 << pin;
+            if (diff & bit) {
+                if (++entry->counters[pin] >= _debounce_scans) {
+                    // level held long enough - commit and report it
+                    entry->stable ^= bit;
+                    changed |= bit;
+                    entry->counters[pin] = 0;
+                    entry->pending &= ~bit;
+                } else {
+                    entry->pending |= bit;
+                }
+            } else {
+                // bounced back to the debounced level
+                entry->counters[pin] = 0;
+                entry->pending &= ~bit;
+            }
+        }
+        if (changed && _on_change) {
+            _on_change(i, changed, entry->stable);
+        }
+    }
+}
+
+} // namespace mbed
+
+#endif
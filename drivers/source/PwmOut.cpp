@@ -33,11 +33,19 @@ PwmOut::PwmOut(PinName pin) :
     _duty_cycle(0),
     _period_us(0)
 {
+#if DEVICE_PWMOUT_SEQUENCE
+    _seq_active = false;
+    _seq_circular = false;
+#endif
     PwmOut::init();
 }
 
 PwmOut::PwmOut(const PinMap &pinmap) : _deep_sleep_locked(false)
 {
+#if DEVICE_PWMOUT_SEQUENCE
+    _seq_active = false;
+    _seq_circular = false;
+#endif
     core_util_critical_section_enter();
     pwmout_init_direct(&_pwm, &pinmap);
     core_util_critical_section_exit();
@@ -121,6 +129,47 @@ int PwmOut::read_pulsewitdth_us()
     return val;
 }
 
+#if DEVICE_PWMOUT_SEQUENCE
+
+int PwmOut::write_sequence(const pwmout_seq_entry_t *entries, uint32_t count, Callback<void(pwmout_seq_event)> refill, bool circular)
+{
+    core_util_critical_section_enter();
+    if (_seq_active) {
+        pwmout_seq_stop(&_pwm);
+        _seq_active = false;
+    }
+    _seq_refill = refill;
+    _seq_circular = circular;
+    int ret = pwmout_seq_start(&_pwm, entries, count, circular, (&PwmOut::_seq_handler), (uint32_t)this);
+    _seq_active = (ret == 0);
+    core_util_critical_section_exit();
+    return ret;
+}
+
+void PwmOut::stop_sequence()
+{
+    core_util_critical_section_enter();
+    if (_seq_active) {
+        pwmout_seq_stop(&_pwm);
+        _seq_active = false;
+    }
+    core_util_critical_section_exit();
+}
+
+void PwmOut::_seq_handler(uint32_t id, pwmout_seq_event event)
+{
+    PwmOut *handler = (PwmOut *)id;
+    if ((event == PWMOUT_SEQ_COMPLETE) && !handler->_seq_circular) {
+        // one-shot playback ends by itself
+        handler->_seq_active = false;
+    }
+    if (handler->_seq_refill) {
+        handler->_seq_refill(event);
+    }
+}
+
+#endif // DEVICE_PWMOUT_SEQUENCE
+
 void PwmOut::suspend()
 {
     core_util_critical_section_enter();
@@ -177,6 +226,12 @@ void PwmOut::deinit()
     core_util_critical_section_enter();
 
     if (_initialized) {
+#if DEVICE_PWMOUT_SEQUENCE
+        if (_seq_active) {
+            pwmout_seq_stop(&_pwm);
+            _seq_active = false;
+        }
+#endif
         pwmout_free(&_pwm);
         unlock_deep_sleep();
         _initialized = false;
@@ -0,0 +1,94 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "drivers/QuadratureEncoder.h"
+
+#if DEVICE_PULSE_COUNTER
+
+#include "platform/mbed_critical.h"
+#include "platform/mbed_error.h"
+
+namespace mbed {
+
+QuadratureEncoder::QuadratureEncoder(PinName phase_a, PinName phase_b, pulse_counter_mode_t mode)
+    : _base(0), _last_position(0)
+{
+    if (pulse_counter_init(&_counter, phase_a, phase_b, mode) != 0) {
+        MBED_ERROR1(MBED_MAKE_ERROR(MBED_MODULE_DRIVER, MBED_ERROR_CODE_INITIALIZATION_FAILED),
+                    "QuadratureEncoder: pins or mode not supported", phase_a);
+    }
+    _wrap = (int64_t)1 << pulse_counter_get_width(&_counter);
+    pulse_counter_set_overflow_handler(&_counter, &QuadratureEncoder::_overflow, this);
+    _last_time = HighResClock::now();
+}
+
+QuadratureEncoder::~QuadratureEncoder()
+{
+    pulse_counter_set_overflow_handler(&_counter, NULL, NULL);
+    pulse_counter_free(&_counter);
+}
+
+void QuadratureEncoder::_overflow(void *context, int direction)
+{
+    QuadratureEncoder *self = static_cast<QuadratureEncoder *>(context);
+    self->_base += (direction > 0) ? self->_wrap : -self->_wrap;
+}
+
+int64_t QuadratureEncoder::position()
+{
+    int64_t base;
+    uint32_t count;
+
+    // The wrap base only changes in the overflow interrupt. Re-read until
+    // it was stable across the count read, so a wrap between the two reads
+    // cannot pair an old base with a wrapped count.
+    do {
+        base = _base;
+        count = pulse_counter_read(&_counter);
+    } while (base != _base);
+
+    return base + count;
+}
+
+void QuadratureEncoder::reset()
+{
+    core_util_critical_section_enter();
+    pulse_counter_reset(&_counter);
+    _base = 0;
+    core_util_critical_section_exit();
+    _last_position = 0;
+}
+
+int32_t QuadratureEncoder::speed()
+{
+    HighResClock::time_point now = HighResClock::now();
+    int64_t pos = position();
+
+    int64_t elapsed_us = std::chrono::duration_cast<std::chrono::microseconds>(now - _last_time).count();
+    int32_t result = 0;
+    if (elapsed_us > 0) {
+        result = (int32_t)((pos - _last_position) * 1000000 / elapsed_us);
+    }
+
+    _last_position = pos;
+    _last_time = now;
+    return result;
+}
+
+} // namespace mbed
+
+#endif // DEVICE_PULSE_COUNTER
@@ -118,8 +118,17 @@ void SPI::_do_construct()
 {
     // No lock needed in the constructor
 #if DEVICE_SPI_ASYNCH
+#if DEVICE_DMA
+    // targets with the generic DMA HAL back async transfers with DMA by default
+    _usage = DMA_USAGE_OPPORTUNISTIC;
+#else
     _usage = DMA_USAGE_NEVER;
+#endif
     _deep_sleep_locked = false;
+    _sequence = nullptr;
+    _sequence_count = 0;
+    _sequence_index = 0;
+    _sequence_event = 0;
 #endif
     _select_count = 0;
     _bits = 8;
@@ -287,8 +296,33 @@ int SPI::transfer(const void *tx_buffer, int tx_length, void *rx_buffer, int rx_
     return 0;
 }
 
+int SPI::transfer_sequence(const transaction_t *sequence, size_t count, const event_callback_t &callback, int event)
+{
+    if (count == 0) {
+        return -1;
+    }
+    core_util_critical_section_enter();
+    if (spi_active(&_peripheral->spi)) {
+        // Sequences cannot be queued behind other transfers - the chip select
+        // would be released in between.
+        core_util_critical_section_exit();
+        return -1;
+    }
+    _sequence = sequence;
+    _sequence_count = count;
+    _sequence_index = 0;
+    _sequence_event = event;
+    // Subscribe to completion internally so segments can be chained even if
+    // the caller only asked for error events.
+    start_transfer(sequence->tx_buffer, sequence->tx_length, sequence->rx_buffer, sequence->rx_length,
+                   sequence->width ? sequence->width : 8, callback, event | SPI_EVENT_COMPLETE);
+    core_util_critical_section_exit();
+    return 0;
+}
+
 void SPI::abort_transfer()
 {
+    _sequence = nullptr;
     spi_abort_asynch(&_peripheral->spi);
     unlock_deep_sleep();
 #if TRANSACTION_QUEUE_SIZE_SPI
@@ -395,6 +429,21 @@ void SPI::dequeue_transaction()
 void SPI::irq_handler_asynch(void)
 {
     int event = spi_irq_handler_asynch(&_peripheral->spi);
+    if (_sequence && (event & SPI_EVENT_ALL)) {
+        if (!(event & (SPI_EVENT_ERROR | SPI_EVENT_RX_OVERFLOW)) && (++_sequence_index < _sequence_count)) {
+            // Chain the next segment without releasing the chip select, so the
+            // whole sequence goes out in one assertion.
+            const transaction_t *segment = &_sequence[_sequence_index];
+            spi_master_transfer(&_peripheral->spi, segment->tx_buffer, segment->tx_length,
+                                segment->rx_buffer, segment->rx_length,
+                                segment->width ? segment->width : 8, _irq.entry(),
+                                _sequence_event | SPI_EVENT_COMPLETE, _usage);
+            return;
+        }
+        // Last segment done (or error) - report only what the caller asked for.
+        event &= _sequence_event | SPI_EVENT_ERROR | SPI_EVENT_RX_OVERFLOW;
+        _sequence = nullptr;
+    }
     if (_callback && (event & SPI_EVENT_ALL)) {
         _set_ssel(1);
         unlock_deep_sleep();
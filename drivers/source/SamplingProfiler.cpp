@@ -0,0 +1,147 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "drivers/SamplingProfiler.h"
+#include "platform/mbed_assert.h"
+#include "platform/mbed_critical.h"
+
+#include "cmsis.h"
+
+namespace mbed {
+
+/* Stacked exception frame of the interrupted thread: r0-r3, r12, lr, pc,
+ * xpsr. Threads run on the process stack, so from any handler the frame
+ * at PSP belongs to the thread code that was last running. */
+#define PROFILER_FRAME_LR 5
+#define PROFILER_FRAME_PC 6
+
+static const uint32_t *profiler_exception_frame()
+{
+#if defined(__CORTEX_M)
+    return (const uint32_t *)__get_PSP();
+#else
+    return NULL;
+#endif
+}
+
+SamplingProfiler::SamplingProfiler(uint32_t *buffer, size_t words, bool capture_lr)
+    : _timeout(), _buffer(buffer), _words(words), _capture_lr(capture_lr),
+      _running(false), _period_us(0), _jitter_state(0),
+      _head(0), _tail(0), _dropped(0)
+{
+    MBED_ASSERT(buffer && words >= (capture_lr ? 2u : 1u));
+}
+
+SamplingProfiler::~SamplingProfiler()
+{
+    stop();
+}
+
+bool SamplingProfiler::start(uint32_t rate_hz)
+{
+#if !defined(__CORTEX_M)
+    return false;
+#endif
+    MBED_ASSERT(rate_hz > 0);
+    if (_running || rate_hz == 0) {
+        return false;
+    }
+    _period_us = 1000000 / rate_hz;
+    if (_period_us < 50) {
+        // Below ~20 kHz the capture itself dominates; refuse rather
+        // than livelock the system
+        return false;
+    }
+    _jitter_state = 0x5bd1e995u ^ rate_hz;
+    _running = true;
+    schedule_next();
+    return true;
+}
+
+void SamplingProfiler::stop()
+{
+    if (_running) {
+        _running = false;
+        _timeout.detach();
+    }
+}
+
+void SamplingProfiler::schedule_next()
+{
+    // xorshift32 jitter of +/- a quarter period, so code synchronous
+    // with the nominal rate cannot hide between samples
+    uint32_t x = _jitter_state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    _jitter_state = x;
+
+    uint32_t quarter = _period_us / 4;
+    uint32_t delay = _period_us - quarter + (quarter ? (x % (2 * quarter)) : 0);
+    _timeout.attach(callback(this, &SamplingProfiler::sample),
+                    std::chrono::microseconds(delay));
+}
+
+void SamplingProfiler::sample()
+{
+    if (!_running) {
+        return;
+    }
+
+    const uint32_t *frame = profiler_exception_frame();
+    if (frame) {
+        uint32_t need = _capture_lr ? 2 : 1;
+        uint32_t head = _head;
+        if (_words - (head - _tail) < need) {
+            _dropped += need;
+        } else {
+            _buffer[head % _words] = frame[PROFILER_FRAME_PC];
+            if (_capture_lr) {
+                _buffer[(head + 1) % _words] = frame[PROFILER_FRAME_LR];
+            }
+            _head = head + need;
+        }
+    }
+
+    schedule_next();
+}
+
+size_t SamplingProfiler::read(uint32_t *out, size_t max)
+{
+    size_t n = 0;
+    uint32_t tail = _tail;
+    while (n < max && tail != _head) {
+        out[n++] = _buffer[tail % _words];
+        tail++;
+        // Publish per word: the producer regains space as we go, and an
+        // interrupt mid-drain sees a consistent ring
+        _tail = tail;
+    }
+    return n;
+}
+
+uint32_t SamplingProfiler::dropped() const
+{
+    return _dropped;
+}
+
+bool SamplingProfiler::running() const
+{
+    return _running;
+}
+
+} // namespace mbed
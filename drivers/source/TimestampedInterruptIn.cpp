@@ -0,0 +1,158 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "drivers/TimestampedInterruptIn.h"
+
+#if DEVICE_INTERRUPTIN
+
+#include "platform/mbed_atomic.h"
+#if !DEVICE_EDGE_CAPTURE
+#include "hal/us_ticker_api.h"
+#endif
+
+namespace mbed {
+
+TimestampedInterruptIn::TimestampedInterruptIn(PinName pin, size_t buffer_size) :
+    InterruptIn(pin)
+{
+    _init(pin, buffer_size);
+}
+
+TimestampedInterruptIn::TimestampedInterruptIn(PinName pin, PinMode mode, size_t buffer_size) :
+    InterruptIn(pin, mode)
+{
+    _init(pin, buffer_size);
+}
+
+void TimestampedInterruptIn::_init(PinName pin, size_t buffer_size)
+{
+    // No lock needed in the constructor
+    _edges = new timestamped_edge_t[buffer_size];
+    _size = buffer_size;
+    _head = 0;
+    _tail = 0;
+    _dropped = 0;
+#if DEVICE_EDGE_CAPTURE
+    edge_capture_init(&_capture, pin, (&TimestampedInterruptIn::_capture_handler), (uint32_t)this);
+#else
+    (void)pin;
+#endif
+}
+
+TimestampedInterruptIn::~TimestampedInterruptIn()
+{
+    // No lock needed in the destructor
+#if DEVICE_EDGE_CAPTURE
+    edge_capture_free(&_capture);
+#endif
+    delete[] _edges;
+}
+
+void TimestampedInterruptIn::capture_rise(bool enable)
+{
+#if DEVICE_EDGE_CAPTURE
+    core_util_critical_section_enter();
+    edge_capture_set(&_capture, IRQ_RISE, enable);
+    core_util_critical_section_exit();
+#else
+    if (enable) {
+        rise(callback(this, &TimestampedInterruptIn::_sw_rise));
+    } else {
+        rise(nullptr);
+    }
+#endif
+}
+
+void TimestampedInterruptIn::capture_fall(bool enable)
+{
+#if DEVICE_EDGE_CAPTURE
+    core_util_critical_section_enter();
+    edge_capture_set(&_capture, IRQ_FALL, enable);
+    core_util_critical_section_exit();
+#else
+    if (enable) {
+        fall(callback(this, &TimestampedInterruptIn::_sw_fall));
+    } else {
+        fall(nullptr);
+    }
+#endif
+}
+
+size_t TimestampedInterruptIn::read_edges(timestamped_edge_t *edges, size_t count)
+{
+    // Single consumer - only the interrupt moves _head, only this
+    // function moves _tail, so no critical section is needed
+    size_t read = 0;
+    uint32_t tail = _tail;
+    while ((read < count) && (tail != core_util_atomic_load_u32(&_head))) {
+        edges[read++] = _edges[tail];
+        tail = (tail + 1 == _size) ? 0 : tail + 1;
+        core_util_atomic_store_u32(&_tail, tail);
+    }
+    return read;
+}
+
+size_t TimestampedInterruptIn::edges_available() const
+{
+    uint32_t head = core_util_atomic_load_u32(&_head);
+    uint32_t tail = core_util_atomic_load_u32(&_tail);
+    return (head >= tail) ? (head - tail) : (_size - tail + head);
+}
+
+uint32_t TimestampedInterruptIn::dropped() const
+{
+    return core_util_atomic_load_u32(&_dropped);
+}
+
+void TimestampedInterruptIn::_push(gpio_irq_event edge, timestamp_t timestamp)
+{
+    uint32_t head = _head;
+    uint32_t next = (head + 1 == _size) ? 0 : head + 1;
+    if (next == core_util_atomic_load_u32(&_tail)) {
+        core_util_atomic_incr_u32(&_dropped, 1);
+        return;
+    }
+    _edges[head].timestamp = timestamp;
+    _edges[head].edge = edge;
+    // Publish the slot only once it is filled in
+    core_util_atomic_store_u32(&_head, next);
+}
+
+#if DEVICE_EDGE_CAPTURE
+
+void TimestampedInterruptIn::_capture_handler(uint32_t id, gpio_irq_event event, timestamp_t timestamp)
+{
+    TimestampedInterruptIn *handler = (TimestampedInterruptIn *)id;
+    handler->_push(event, timestamp);
+}
+
+#else
+
+void TimestampedInterruptIn::_sw_rise()
+{
+    _push(IRQ_RISE, ticker_read(get_us_ticker_data()));
+}
+
+void TimestampedInterruptIn::_sw_fall()
+{
+    _push(IRQ_FALL, ticker_read(get_us_ticker_data()));
+}
+
+#endif
+
+} // namespace mbed
+
+#endif
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2021 Arm Limited and affiliates.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(DEVICE_WATCHDOG) && defined(MBED_CONF_RTOS_PRESENT)
+
+#include "drivers/WatchdogService.h"
+#include "events/mbed_shared_queues.h"
+#include "platform/mbed_atomic.h"
+#include "platform/mbed_critical.h"
+#include "platform/mbed_error.h"
+#include "rtos/Kernel.h"
+
+namespace mbed {
+
+static uint32_t now_ms()
+{
+    return (uint32_t)rtos::Kernel::Clock::now().time_since_epoch().count();
+}
+
+WatchdogService &WatchdogService::get_instance()
+{
+    // Use this implementation of singleton (Meyer's) rather than the one that allocates
+    // the instance on the heap because it ensures destruction at program end (preventing warnings
+    // from memory checking tools, such as valgrind).
+    static WatchdogService instance;
+    return instance;
+}
+
+WatchdogService::WatchdogService() : _clients(), _monitor_id(0), _running(false)
+{
+}
+
+bool WatchdogService::start(uint32_t timeout)
+{
+    if (_running) {
+        return false;
+    }
+    if (!Watchdog::get_instance().start(timeout)) {
+        return false;
+    }
+    // Four checks per hardware timeout leaves the monitor ample margin to
+    // kick before the hardware fires
+    _monitor_id = mbed_bottom_half_queue()->call_every(
+                      std::chrono::milliseconds(timeout / 4),
+                      this, &WatchdogService::monitor);
+    if (!_monitor_id) {
+        Watchdog::get_instance().stop();
+        return false;
+    }
+    _running = true;
+    return true;
+}
+
+bool WatchdogService::stop()
+{
+    if (!_running) {
+        return false;
+    }
+    mbed_bottom_half_queue()->cancel(_monitor_id);
+    _monitor_id = 0;
+    _running = false;
+    return Watchdog::get_instance().stop();
+}
+
+int8_t WatchdogService::register_client(const char *name, uint32_t period)
+{
+    int8_t id = -1;
+    core_util_critical_section_enter();
+    for (int i = 0; i < MBED_CONF_DRIVERS_WATCHDOG_SERVICE_MAX_CLIENTS; i++) {
+        if (!_clients[i].name) {
+            _clients[i].name = name;
+            _clients[i].thread = osThreadGetId();
+            _clients[i].period = period;
+            _clients[i].last_checkin = now_ms();
+            id = i;
+            break;
+        }
+    }
+    core_util_critical_section_exit();
+    return id;
+}
+
+void WatchdogService::deregister_client(int8_t id)
+{
+    if (id < 0 || id >= MBED_CONF_DRIVERS_WATCHDOG_SERVICE_MAX_CLIENTS) {
+        return;
+    }
+    core_util_critical_section_enter();
+    _clients[id].name = NULL;
+    core_util_critical_section_exit();
+}
+
+void WatchdogService::checkin(int8_t id)
+{
+    if (id < 0 || id >= MBED_CONF_DRIVERS_WATCHDOG_SERVICE_MAX_CLIENTS) {
+        return;
+    }
+    core_util_atomic_store_u32(&_clients[id].last_checkin, now_ms());
+}
+
+void WatchdogService::monitor()
+{
+    const char *late_name = NULL;
+    osThreadId_t late_thread = NULL;
+
+    uint32_t now = now_ms();
+    core_util_critical_section_enter();
+    for (int i = 0; i < MBED_CONF_DRIVERS_WATCHDOG_SERVICE_MAX_CLIENTS; i++) {
+        if (_clients[i].name && (now - _clients[i].last_checkin) > _clients[i].period) {
+            late_name = _clients[i].name;
+            late_thread = _clients[i].thread;
+            break;
+        }
+    }
+    core_util_critical_section_exit();
+
+    if (late_name) {
+        // Record the hang while state is still intact, rather than letting
+        // the hardware produce an anonymous reset. With crash capture
+        // enabled the name pointer and thread id survive the reboot in the
+        // crash-data region.
+        MBED_ERROR1(MBED_MAKE_ERROR(MBED_MODULE_DRIVER_WATCHDOG, MBED_ERROR_CODE_TIME_OUT),
+                    late_name, (uint32_t)(uintptr_t)late_thread);
+    }
+
+    Watchdog::get_instance().kick();
+}
+
+} // namespace mbed
+
+#endif // DEVICE_WATCHDOG && MBED_CONF_RTOS_PRESENT
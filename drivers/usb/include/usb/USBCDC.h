@@ -134,6 +134,44 @@ public:
      */
     void receive_nb(uint8_t *buffer, uint32_t size, uint32_t *actual);
 
+    /**
+     * Send a whole buffer as back to back bulk transfers
+     *
+     * The buffer is sent directly from the caller's memory, one packet per
+     * transfer, with the next packet started from the transfer complete
+     * interrupt. This bypasses the internal packet buffer and its copy, so
+     * the buffer must stay valid and unchanged until the callback runs. A
+     * block whose size is a multiple of the packet size is terminated with
+     * a zero length packet so the host flushes it.
+     *
+     * @param buffer data to send
+     * @param size number of bytes to send
+     * @param callback function called when the block has been sent, with
+     *        true on success and false if the transfer was cut short by a
+     *        state change. Warning: called in ISR context
+     * @return true if the block transfer was started, false if the
+     *         transmitter is busy, the terminal is not connected or size is 0
+     */
+    bool send_block_nb(uint8_t *buffer, uint32_t size, mbed::Callback<void(bool)> callback);
+
+    /**
+     * Receive directly into a buffer as back to back bulk transfers
+     *
+     * Packets are read straight into the caller's buffer and the next read
+     * is started from the transfer complete interrupt. The transfer ends
+     * when the buffer cannot hold another packet or when the host sends a
+     * short packet. The buffer must stay valid until the callback runs.
+     *
+     * @param buffer buffer to fill with data
+     * @param size buffer size, at least one max packet size
+     * @param callback function called when the block transfer ends, with
+     *        the number of bytes received. Warning: called in ISR context
+     * @return true if the block transfer was started, false if another
+     *         block transfer is in progress, the terminal is not connected
+     *         or the buffer cannot hold a packet
+     */
+    bool receive_block_nb(uint8_t *buffer, uint32_t size, mbed::Callback<void(uint32_t)> callback);
+
 protected:
     /*
     * Get device descriptor. Warning: this method has to store the length of the report descriptor in reportLength.
@@ -205,6 +243,8 @@ protected:
     void _send_isr_start();
     void _send_isr();
 
+    void _send_block_isr_start();
+
     void _receive_isr_start();
     void _receive_isr();
 
@@ -230,6 +270,17 @@ protected:
     uint8_t _rx_buffer[CDC_MAX_PACKET_SIZE];
     uint8_t *_rx_buf;
     uint32_t _rx_size;
+
+    uint8_t *_tx_block_buf;
+    uint32_t _tx_block_size;
+    uint32_t _tx_block_sent;
+    mbed::Callback<void(bool)> _tx_block_done;
+
+    uint8_t *_rx_block_buf;
+    uint32_t _rx_block_size;
+    uint32_t _rx_block_read;
+    bool _rx_block_direct;
+    mbed::Callback<void(uint32_t)> _rx_block_done;
 };
 
 /** @}*/
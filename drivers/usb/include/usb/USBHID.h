@@ -31,6 +31,11 @@
  * @{
  */
 
+/* Number of reports the fire-and-forget send queue can hold. */
+#ifndef USBHID_SEND_QUEUE_SIZE
+#define USBHID_SEND_QUEUE_SIZE 8
+#endif
+
 /**
  * USBHID example
  * @code
@@ -126,6 +131,23 @@ public:
     */
     bool send_nb(const HID_REPORT *report);
 
+    /**
+    * Queue a report for transmission. warning: non blocking
+    *
+    * The report is copied into a fixed size queue which is drained from
+    * the IN endpoint's transfer complete interrupt, so back to back
+    * reports go out on consecutive USB frames without the application
+    * thread in the loop.
+    *
+    * @param report Report which will be sent (a report is defined by all data and the length)
+    * @param frame_delay Number of USB frames to wait after the preceding
+    *                    report before this one may start (0 to send as soon
+    *                    as the endpoint is free)
+    * @returns true if the report was queued, false if the queue is full or
+    *          the device is not configured
+    */
+    bool send_queue_nb(const HID_REPORT *report, uint16_t frame_delay = 0);
+
     /**
     * Read a report: blocking
     *
@@ -199,6 +221,14 @@ protected:
     */
     virtual void callback_state_change(DeviceState new_state);
 
+    /**
+    * Called on every USB frame while a queued report waits out its
+    * frame delay
+    *
+    * Warning: Called in ISR context
+    */
+    virtual void callback_sof(int frame_number);
+
     /*
     * This is used to handle extensions to standard requests
     * and class specific requests
@@ -252,14 +282,24 @@ private:
     void _init(uint8_t output_report_length, uint8_t input_report_length);
     void _send_isr();
     void _read_isr();
+    void _send_queue_start();
 
     class AsyncSend;
     class AsyncRead;
     class AsyncWait;
 
+    struct queued_report_t {
+        HID_REPORT report;
+        uint16_t frames;
+    };
+
     OperationList<AsyncWait> _connect_list;
     OperationList<AsyncSend> _send_list;
     bool _send_idle;
+    queued_report_t _send_queue[USBHID_SEND_QUEUE_SIZE];
+    uint8_t _send_queue_head;
+    uint8_t _send_queue_count;
+    bool _sof_enabled;
     OperationList<AsyncRead> _read_list;
     bool _read_idle;
 
@@ -35,6 +35,14 @@
  * @{
  */
 
+/* Number of blocks moved per storage access. A larger value turns a host
+ * transfer into fewer, bigger BlockDevice reads and programs at the cost
+ * of block_size * MSD_AGGREGATE_BLOCKS bytes of RAM (must fit in the
+ * 8 bit count of disk_read/disk_write). */
+#ifndef MSD_AGGREGATE_BLOCKS
+#define MSD_AGGREGATE_BLOCKS 8
+#endif
+
 /**
  * USBMSD class: generic class in order to use all kinds of blocks storage chip
  *
@@ -239,9 +247,19 @@ private:
     // memory OK (after a memoryVerify)
     bool _mem_ok;
 
-    // cache in RAM before writing in memory. Useful also to read a block.
+    // cache in RAM holding a run of blocks before writing them in memory.
+    // Useful also to read several blocks at once.
     uint8_t *_page;
 
+    // number of blocks _page can hold
+    uint32_t _page_blocks;
+
+    // byte address of the first buffered block
+    uint32_t _page_base;
+
+    // number of valid or collected bytes in _page
+    uint32_t _page_len;
+
     int _block_size;
     uint64_t _memory_size;
     uint64_t _block_count;
@@ -292,6 +310,8 @@ private:
     void _process();
     void _write_next(uint8_t *data, uint32_t size);
     void _read_next();
+    void _read_chunk();
+    void _flush_chunk();
 
     void CBWDecode(uint8_t *buf, uint16_t size);
     void sendCSW(void);
@@ -21,6 +21,7 @@
 #include <stddef.h>
 #include "USBDevice_Types.h"
 #include "USBPhy.h"
+#include "ByteBuffer.h"
 #include "mbed_critical.h"
 #include "Callback.h"
 
@@ -263,6 +264,69 @@ public:
      */
     uint32_t write_finish(usb_ep_t endpoint);
 
+    /**
+     * Stream data to the host from a buffer
+     *
+     * Packets are pulled out of the buffer and sent without per-transfer
+     * application involvement. Two packets are staged at a time so that the
+     * next transfer is handed to the USBPhy directly from the transfer
+     * complete interrupt, back to back with the one that finished. When the
+     * buffer runs empty the stream pauses; add more data and call
+     * stream_resume to continue it.
+     *
+     * @param endpoint IN endpoint to stream on
+     * @param buffer buffer to send data from. It must stay valid until the
+     *        stream is stopped with stream_stop
+     * @return true if streaming was set up, otherwise false
+     * @note The endpoint callback is still called after every completed
+     *       transfer, after the next one has been started. read_start and
+     *       write_start cannot be used on this endpoint while it is streaming.
+     * @note This endpoint must already have been setup with endpoint_add
+     */
+    bool stream_write_start(usb_ep_t endpoint, ByteBuffer *buffer);
+
+    /**
+     * Stream data from the host into a buffer
+     *
+     * Received packets are copied into the buffer and the endpoint is
+     * re-armed directly from the transfer complete interrupt without
+     * per-transfer application involvement. When less than two packets of
+     * space are left the stream pauses and the endpoint NAKs; drain the
+     * buffer and call stream_resume to continue it.
+     *
+     * @param endpoint OUT endpoint to stream on
+     * @param buffer buffer to receive data into. It must stay valid until
+     *        the stream is stopped with stream_stop
+     * @return true if streaming was set up, otherwise false
+     * @note The endpoint callback is still called after every completed
+     *       transfer, after the next one has been started. read_start and
+     *       write_start cannot be used on this endpoint while it is streaming.
+     * @note This endpoint must already have been setup with endpoint_add
+     */
+    bool stream_read_start(usb_ep_t endpoint, ByteBuffer *buffer);
+
+    /**
+     * Resume a paused stream
+     *
+     * Restart a stream which paused because its buffer ran empty (IN) or
+     * full (OUT). This function is safe to call at any time, including from
+     * the endpoint callback; it does nothing if the stream is running.
+     *
+     * @param endpoint endpoint the stream was started on
+     */
+    void stream_resume(usb_ep_t endpoint);
+
+    /**
+     * Stop streaming on the given endpoint
+     *
+     * Any transfer in progress is aborted and staged data which has not
+     * been transferred yet is dropped. The endpoint can be used with
+     * read_start and write_start again afterwards.
+     *
+     * @param endpoint endpoint the stream was started on
+     */
+    void stream_stop(usb_ep_t endpoint);
+
     /*
     * Get device descriptor.
     *
@@ -547,8 +611,17 @@ private:
     void _complete_set_configuration();
     void _complete_set_interface();
 
+    struct stream_info_t {
+        ByteBuffer *buffer;
+        uint8_t *packets;
+        uint16_t size[2];
+        uint8_t active;
+        bool idle;
+    };
+
     struct endpoint_info_t {
         mbed::Callback<void()> callback;
+        stream_info_t *stream;
         uint16_t max_packet_size;
         uint16_t transfer_size;
         uint8_t flags;
@@ -599,6 +672,14 @@ private:
         complete_args_t args;
     };
 
+    uint16_t _stream_stage(endpoint_info_t *info, uint8_t index);
+    void _stream_tx_start(usb_ep_t endpoint);
+    void _stream_rx_start(usb_ep_t endpoint);
+    void _stream_in_progress(usb_ep_t endpoint);
+    void _stream_out_progress(usb_ep_t endpoint);
+    void _stream_free(endpoint_info_t *info);
+    void _stream_free_all();
+
     endpoint_info_t _endpoint_info[32 - 2];
 
     USBPhy *_phy;
@@ -186,6 +186,15 @@ void USBCDC::_init()
     _rx_in_progress = false;
     _rx_buf = _rx_buffer;
     _rx_size = 0;
+
+    _tx_block_buf = NULL;
+    _tx_block_size = 0;
+    _tx_block_sent = 0;
+
+    _rx_block_buf = NULL;
+    _rx_block_size = 0;
+    _rx_block_read = 0;
+    _rx_block_direct = false;
 }
 
 void USBCDC::callback_reset()
@@ -322,6 +331,14 @@ void USBCDC::_change_terminal_connected(bool connected)
         }
         _tx_buf = _tx_buffer;
         _tx_size = 0;
+        if (_tx_block_buf != NULL) {
+            mbed::Callback<void(bool)> done = _tx_block_done;
+            _tx_block_buf = NULL;
+            _tx_block_done = nullptr;
+            if (done) {
+                done(false);
+            }
+        }
         _tx_list.process();
         MBED_ASSERT(_tx_list.empty());
 
@@ -332,6 +349,15 @@ void USBCDC::_change_terminal_connected(bool connected)
         }
         _rx_buf = _rx_buffer;
         _rx_size = 0;
+        if (_rx_block_buf != NULL) {
+            mbed::Callback<void(uint32_t)> done = _rx_block_done;
+            _rx_block_buf = NULL;
+            _rx_block_done = nullptr;
+            _rx_block_direct = false;
+            if (done) {
+                done(_rx_block_read);
+            }
+        }
         _rx_list.process();
         MBED_ASSERT(_rx_list.empty());
 
@@ -395,6 +421,26 @@ void USBCDC::send_nb(uint8_t *buffer, uint32_t size, uint32_t *actual, bool now)
     unlock();
 }
 
+bool USBCDC::send_block_nb(uint8_t *buffer, uint32_t size, mbed::Callback<void(bool)> callback)
+{
+    lock();
+
+    if (!_terminal_connected || _tx_in_progress || (_tx_size > 0) ||
+            (_tx_block_buf != NULL) || (size == 0)) {
+        unlock();
+        return false;
+    }
+
+    _tx_block_buf = buffer;
+    _tx_block_size = size;
+    _tx_block_sent = 0;
+    _tx_block_done = callback;
+    _send_block_isr_start();
+
+    unlock();
+    return true;
+}
+
 void USBCDC::_send_isr_start()
 {
     assert_locked();
@@ -406,6 +452,17 @@ void USBCDC::_send_isr_start()
     }
 }
 
+void USBCDC::_send_block_isr_start()
+{
+    assert_locked();
+
+    uint32_t remaining = _tx_block_size - _tx_block_sent;
+    uint32_t packet_size = remaining > CDC_MAX_PACKET_SIZE ? CDC_MAX_PACKET_SIZE : remaining;
+    if (USBDevice::write_start(_bulk_in, _tx_block_buf + _tx_block_sent, packet_size)) {
+        _tx_in_progress = true;
+    }
+}
+
 /*
 * Called by when CDC data is sent
 * Warning: Called in ISR
@@ -414,6 +471,29 @@ void USBCDC::_send_isr()
 {
     assert_locked();
 
+    if (_tx_block_buf != NULL) {
+        uint32_t sent = write_finish(_bulk_in);
+        _tx_in_progress = false;
+        _tx_block_sent += sent;
+        if ((_tx_block_sent < _tx_block_size) || (sent == CDC_MAX_PACKET_SIZE)) {
+            // More data to go, or a terminating zero length packet after
+            // a block which is a multiple of the packet size
+            _send_block_isr_start();
+        } else {
+            mbed::Callback<void(bool)> done = _tx_block_done;
+            _tx_block_buf = NULL;
+            _tx_block_done = nullptr;
+            if (done) {
+                done(true);
+            }
+            _tx_list.process();
+            if (!_tx_in_progress) {
+                data_tx();
+            }
+        }
+        return;
+    }
+
     write_finish(_bulk_in);
     _tx_buf = _tx_buffer;
     _tx_size = 0;
@@ -459,6 +539,57 @@ void USBCDC::receive_nb(uint8_t *buffer, uint32_t size,  uint32_t *size_read)
     }
 }
 
+bool USBCDC::receive_block_nb(uint8_t *buffer, uint32_t size, mbed::Callback<void(uint32_t)> callback)
+{
+    lock();
+
+    if (!_terminal_connected || (_rx_block_buf != NULL) || (size < CDC_MAX_PACKET_SIZE)) {
+        unlock();
+        return false;
+    }
+
+    _rx_block_buf = buffer;
+    _rx_block_size = size;
+    _rx_block_read = 0;
+    _rx_block_done = callback;
+    _rx_block_direct = false;
+
+    // Serve data already held in the packet buffer first
+    if (_rx_size > 0) {
+        uint32_t copy_size = _rx_size > size ? size : _rx_size;
+        memcpy(buffer, _rx_buf, copy_size);
+        _rx_block_read = copy_size;
+        _rx_buf += copy_size;
+        _rx_size -= copy_size;
+    }
+
+    if (_rx_block_size - _rx_block_read < CDC_MAX_PACKET_SIZE) {
+        // The block was filled from buffered data alone
+        mbed::Callback<void(uint32_t)> done = _rx_block_done;
+        uint32_t total = _rx_block_read;
+        _rx_block_buf = NULL;
+        _rx_block_done = nullptr;
+        _receive_isr_start();
+        if (done) {
+            done(total);
+        }
+        unlock();
+        return true;
+    }
+
+    if (!_rx_in_progress) {
+        // Read the next packet straight into the block buffer. If a read
+        // into the packet buffer is already in flight its data is moved
+        // over when it completes.
+        _rx_in_progress = true;
+        _rx_block_direct = true;
+        read_start(_bulk_out, _rx_block_buf + _rx_block_read, _rx_block_size - _rx_block_read);
+    }
+
+    unlock();
+    return true;
+}
+
 void USBCDC::_receive_isr_start()
 {
     if ((_rx_size == 0) && !_rx_in_progress) {
@@ -476,6 +607,37 @@ void USBCDC::_receive_isr()
 {
     assert_locked();
 
+    if (_rx_block_buf != NULL) {
+        uint32_t size = read_finish(_bulk_out);
+        _rx_in_progress = false;
+        if (!_rx_block_direct) {
+            // This read was armed into the packet buffer before the block
+            // transfer started, move it over
+            memcpy(_rx_block_buf + _rx_block_read, _rx_buffer, size);
+        }
+        _rx_block_read += size;
+        if ((size == CDC_MAX_PACKET_SIZE) &&
+                (_rx_block_size - _rx_block_read >= CDC_MAX_PACKET_SIZE)) {
+            // A full packet with room for another, read the next one
+            // straight into the block buffer
+            _rx_in_progress = true;
+            _rx_block_direct = true;
+            read_start(_bulk_out, _rx_block_buf + _rx_block_read, _rx_block_size - _rx_block_read);
+        } else {
+            // A short packet or a full buffer ends the block
+            mbed::Callback<void(uint32_t)> done = _rx_block_done;
+            uint32_t total = _rx_block_read;
+            _rx_block_buf = NULL;
+            _rx_block_done = nullptr;
+            _rx_block_direct = false;
+            _receive_isr_start();
+            if (done) {
+                done(total);
+            }
+        }
+        return;
+    }
+
     MBED_ASSERT(_rx_size == 0);
     _rx_buf = _rx_buffer;
     _rx_size = read_finish(_bulk_out);
@@ -402,6 +402,7 @@ void USBDevice::_complete_set_configuration()
     if ((_abort_control || !success) && !configured()) {
         // The set configuration request was aborted or failed so
         // reset any endpoints which may have been added.
+        _stream_free_all();
         memset(_endpoint_info, 0, sizeof(_endpoint_info));
         _device.configuration = 0;
         _endpoint_add_remove_allowed = false;
@@ -982,6 +983,9 @@ void USBDevice::out(usb_ep_t endpoint)
 
     MBED_ASSERT(info->pending >= 1);
     info->pending -= 1;
+    if (info->stream) {
+        _stream_out_progress(endpoint);
+    }
     if (info->callback) {
         info->callback();
     }
@@ -1009,6 +1013,9 @@ void USBDevice::in(usb_ep_t endpoint)
 
     MBED_ASSERT(info->pending >= 1);
     info->pending -= 1;
+    if (info->stream) {
+        _stream_in_progress(endpoint);
+    }
     if (info->callback) {
         info->callback();
     }
@@ -1177,6 +1184,10 @@ void USBDevice::endpoint_remove(usb_ep_t endpoint)
         _phy->endpoint_abort(endpoint);
     }
 
+    if (info->stream) {
+        _stream_free(info);
+    }
+
     info->callback = nullptr;
     info->flags = 0;
     info->pending = 0;
@@ -1425,6 +1436,14 @@ void USBDevice::endpoint_abort(usb_ep_t endpoint)
         info->pending = 0;
     }
 
+    if (info->stream) {
+        // The aborted transfer and anything staged for it are gone,
+        // stream_resume restarts the stream
+        info->stream->size[0] = 0;
+        info->stream->size[1] = 0;
+        info->stream->idle = true;
+    }
+
     unlock();
 }
 
@@ -1470,8 +1489,8 @@ bool USBDevice::read_start(usb_ep_t endpoint, uint8_t *buffer, uint32_t max_size
 #endif // MBED_TRAP_ERRORS_ENABLED
     }
 
-    if (info->pending) {
-        // Only allow 1 packet
+    if (info->pending || info->stream) {
+        // Only allow 1 packet and no streaming
         unlock();
         return false;
     }
@@ -1561,8 +1580,8 @@ bool USBDevice::write_start(usb_ep_t endpoint, uint8_t *buffer, uint32_t size)
 #endif // MBED_TRAP_ERRORS_ENABLED
     }
 
-    if (info->pending) {
-        // Only allow 1 packet
+    if (info->pending || info->stream) {
+        // Only allow 1 packet and no streaming
         unlock();
         return false;
     }
@@ -1615,6 +1634,296 @@ uint32_t USBDevice::write_finish(usb_ep_t endpoint)
     return ret;
 }
 
+bool USBDevice::stream_write_start(usb_ep_t endpoint, ByteBuffer *buffer)
+{
+    lock();
+
+    if (!EP_INDEXABLE(endpoint) || !EP_RX(endpoint)) {
+#if MBED_TRAP_ERRORS_ENABLED
+        MBED_ERROR(
+            MBED_MAKE_ERROR(
+                MBED_MODULE_DRIVER_USB,
+                MBED_ERROR_CODE_INVALID_INDEX
+            ),
+            "The endpoint is not an indexable IN endpoint."
+        );
+#else
+        unlock();
+        return false;
+#endif // MBED_TRAP_ERRORS_ENABLED
+    }
+
+    endpoint_info_t *info = &_endpoint_info[EP_TO_INDEX(endpoint)];
+    if (!(info->flags & ENDPOINT_ENABLED)) {
+        // Assert that only valid endpoints are used when in the configured state
+        MBED_ASSERT(!configured());
+        unlock();
+        return false;
+    }
+
+    if (info->pending || info->stream) {
+        // A transfer or another stream still owns this endpoint
+        unlock();
+        return false;
+    }
+
+    stream_info_t *stream = new stream_info_t;
+    stream->buffer = buffer;
+    stream->packets = new uint8_t[2 * info->max_packet_size];
+    stream->size[0] = 0;
+    stream->size[1] = 0;
+    stream->active = 0;
+    stream->idle = true;
+    info->stream = stream;
+
+    if (_stream_stage(info, 0) > 0) {
+        _stream_tx_start(endpoint);
+        _stream_stage(info, 1);
+    }
+
+    unlock();
+    return true;
+}
+
+bool USBDevice::stream_read_start(usb_ep_t endpoint, ByteBuffer *buffer)
+{
+    lock();
+
+    if (!EP_INDEXABLE(endpoint) || EP_RX(endpoint)) {
+#if MBED_TRAP_ERRORS_ENABLED
+        MBED_ERROR(
+            MBED_MAKE_ERROR(
+                MBED_MODULE_DRIVER_USB,
+                MBED_ERROR_CODE_INVALID_INDEX
+            ),
+            "The endpoint is not an indexable OUT endpoint."
+        );
+#else
+        unlock();
+        return false;
+#endif // MBED_TRAP_ERRORS_ENABLED
+    }
+
+    endpoint_info_t *info = &_endpoint_info[EP_TO_INDEX(endpoint)];
+    if (!(info->flags & ENDPOINT_ENABLED)) {
+        // Assert that only valid endpoints are used when in the configured state
+        MBED_ASSERT(!configured());
+        unlock();
+        return false;
+    }
+
+    if (info->pending || info->stream) {
+        // A transfer or another stream still owns this endpoint
+        unlock();
+        return false;
+    }
+
+    stream_info_t *stream = new stream_info_t;
+    stream->buffer = buffer;
+    stream->packets = new uint8_t[2 * info->max_packet_size];
+    stream->size[0] = 0;
+    stream->size[1] = 0;
+    stream->active = 0;
+    stream->idle = true;
+    info->stream = stream;
+
+    _stream_rx_start(endpoint);
+
+    unlock();
+    return true;
+}
+
+void USBDevice::stream_resume(usb_ep_t endpoint)
+{
+    lock();
+
+    if (!EP_INDEXABLE(endpoint)) {
+#if MBED_TRAP_ERRORS_ENABLED
+        MBED_ERROR(
+            MBED_MAKE_ERROR(
+                MBED_MODULE_DRIVER_USB,
+                MBED_ERROR_CODE_INVALID_INDEX
+            ),
+            "The endpoint is not indexable."
+        );
+#else
+        unlock();
+        return;
+#endif // MBED_TRAP_ERRORS_ENABLED
+    }
+
+    endpoint_info_t *info = &_endpoint_info[EP_TO_INDEX(endpoint)];
+    stream_info_t *stream = info->stream;
+    if ((stream == NULL) || !stream->idle) {
+        unlock();
+        return;
+    }
+
+    if (EP_RX(endpoint)) {
+        // Both halves are empty when an IN stream is idle
+        if (_stream_stage(info, stream->active) > 0) {
+            _stream_tx_start(endpoint);
+            _stream_stage(info, stream->active ^ 1);
+        }
+    } else {
+        _stream_rx_start(endpoint);
+    }
+
+    unlock();
+}
+
+void USBDevice::stream_stop(usb_ep_t endpoint)
+{
+    lock();
+
+    if (!EP_INDEXABLE(endpoint)) {
+#if MBED_TRAP_ERRORS_ENABLED
+        MBED_ERROR(
+            MBED_MAKE_ERROR(
+                MBED_MODULE_DRIVER_USB,
+                MBED_ERROR_CODE_INVALID_INDEX
+            ),
+            "The endpoint is not indexable."
+        );
+#else
+        unlock();
+        return;
+#endif // MBED_TRAP_ERRORS_ENABLED
+    }
+
+    endpoint_info_t *info = &_endpoint_info[EP_TO_INDEX(endpoint)];
+    if (info->stream == NULL) {
+        unlock();
+        return;
+    }
+
+    if (info->pending) {
+        _phy->endpoint_abort(endpoint);
+        info->pending = 0;
+    }
+
+    _stream_free(info);
+
+    unlock();
+}
+
+uint16_t USBDevice::_stream_stage(endpoint_info_t *info, uint8_t index)
+{
+    assert_locked();
+
+    stream_info_t *stream = info->stream;
+    uint32_t available = stream->buffer->size();
+    uint16_t size = USB_MIN(available, info->max_packet_size);
+    if (size > 0) {
+        stream->buffer->read(stream->packets + index * info->max_packet_size, size);
+    }
+    stream->size[index] = size;
+    return size;
+}
+
+void USBDevice::_stream_tx_start(usb_ep_t endpoint)
+{
+    assert_locked();
+
+    endpoint_info_t *info = &_endpoint_info[EP_TO_INDEX(endpoint)];
+    stream_info_t *stream = info->stream;
+    if (_phy->endpoint_write(endpoint, stream->packets + stream->active * info->max_packet_size,
+                             stream->size[stream->active])) {
+        info->transfer_size = stream->size[stream->active];
+        info->pending += 1;
+        stream->idle = false;
+    }
+}
+
+void USBDevice::_stream_rx_start(usb_ep_t endpoint)
+{
+    assert_locked();
+
+    endpoint_info_t *info = &_endpoint_info[EP_TO_INDEX(endpoint)];
+    stream_info_t *stream = info->stream;
+    if (stream->buffer->free() < 2u * info->max_packet_size) {
+        // Not enough room for the packet being armed plus the next one,
+        // leave the endpoint NAKing until stream_resume
+        stream->idle = true;
+        return;
+    }
+
+    if (_phy->endpoint_read(endpoint, stream->packets + stream->active * info->max_packet_size,
+                            info->max_packet_size)) {
+        info->pending += 1;
+        stream->idle = false;
+    }
+}
+
+void USBDevice::_stream_in_progress(usb_ep_t endpoint)
+{
+    assert_locked();
+
+    endpoint_info_t *info = &_endpoint_info[EP_TO_INDEX(endpoint)];
+    stream_info_t *stream = info->stream;
+    uint8_t done = stream->active;
+    uint8_t next = done ^ 1;
+
+    // Hand the pre-staged packet to the phy first so the gap between
+    // transfers stays as short as possible
+    if (stream->size[next] > 0) {
+        stream->active = next;
+        _stream_tx_start(endpoint);
+    }
+
+    // Refill the half that just completed for the round after this one
+    _stream_stage(info, done);
+
+    if (info->pending == 0) {
+        if (stream->size[done] > 0) {
+            // The pre-stage ran dry but data arrived since, restart from here
+            stream->active = done;
+            _stream_tx_start(endpoint);
+        } else {
+            // The buffer is empty, stream_resume restarts transmission
+            stream->idle = true;
+        }
+    }
+}
+
+void USBDevice::_stream_out_progress(usb_ep_t endpoint)
+{
+    assert_locked();
+
+    endpoint_info_t *info = &_endpoint_info[EP_TO_INDEX(endpoint)];
+    stream_info_t *stream = info->stream;
+    uint8_t done = stream->active;
+    uint32_t size = _phy->endpoint_read_result(endpoint);
+
+    // Re-arm into the other half before copying so reception continues
+    // while the completed packet is moved into the stream buffer
+    stream->active = done ^ 1;
+    _stream_rx_start(endpoint);
+
+    // Room for this packet was reserved when its transfer was armed
+    stream->buffer->write(stream->packets + done * info->max_packet_size, size);
+}
+
+void USBDevice::_stream_free(endpoint_info_t *info)
+{
+    assert_locked();
+
+    delete[] info->stream->packets;
+    delete info->stream;
+    info->stream = NULL;
+}
+
+void USBDevice::_stream_free_all()
+{
+    assert_locked();
+
+    for (uint32_t i = 0; i < sizeof(_endpoint_info) / sizeof(_endpoint_info[0]); i++) {
+        if (_endpoint_info[i].stream) {
+            _stream_free(_endpoint_info + i);
+        }
+    }
+}
+
 const uint8_t *USBDevice::device_desc()
 {
     uint8_t device_descriptor_temp[] = {
@@ -1754,6 +2063,7 @@ void USBDevice::_change_state(DeviceState new_state)
     bool leaving_default_state = (old_state >= Default) && (new_state < Default);
 
     if (leaving_configured_state) {
+        _stream_free_all();
         memset(_endpoint_info, 0, sizeof(_endpoint_info));
         _device.configuration = 0;
         _endpoint_add_remove_allowed = false;
@@ -144,6 +144,9 @@ void USBHID::_init(uint8_t output_report_length, uint8_t input_report_length)
 
     _send_idle = true;
     _read_idle = true;
+    _send_queue_head = 0;
+    _send_queue_count = 0;
+    _sof_enabled = false;
     _output_length = output_report_length;
     _input_length = input_report_length;
     reportLength = 0;
@@ -203,6 +206,50 @@ bool USBHID::send_nb(const HID_REPORT *report)
     return success;
 }
 
+bool USBHID::send_queue_nb(const HID_REPORT *report, uint16_t frame_delay)
+{
+    lock();
+
+    if (!configured() || (_send_queue_count == USBHID_SEND_QUEUE_SIZE)) {
+        unlock();
+        return false;
+    }
+
+    uint8_t index = (_send_queue_head + _send_queue_count) % USBHID_SEND_QUEUE_SIZE;
+    memcpy(&_send_queue[index].report, report, sizeof(HID_REPORT));
+    _send_queue[index].frames = frame_delay;
+    _send_queue_count++;
+    _send_queue_start();
+
+    unlock();
+    return true;
+}
+
+void USBHID::_send_queue_start()
+{
+    assert_locked();
+
+    if (!_send_idle || (_send_queue_count == 0)) {
+        return;
+    }
+
+    queued_report_t *head = &_send_queue[_send_queue_head];
+    if (head->frames > 0) {
+        // wait for callback_sof to count the delay down
+        if (!_sof_enabled) {
+            sof_enable();
+            _sof_enabled = true;
+        }
+        return;
+    }
+
+    memcpy(&_input_report, &head->report, sizeof(_input_report));
+    _send_queue_head = (_send_queue_head + 1) % USBHID_SEND_QUEUE_SIZE;
+    _send_queue_count--;
+    write_start(_int_in, _input_report.data, _input_report.length);
+    _send_idle = false;
+}
+
 bool USBHID::read(HID_REPORT *report)
 {
     lock();
@@ -245,7 +292,10 @@ void USBHID::_send_isr()
     write_finish(_int_in);
     _send_idle = true;
 
-    _send_list.process();
+    _send_queue_start();
+    if (_send_idle) {
+        _send_list.process();
+    }
     if (_send_idle) {
         report_tx();
     }
@@ -272,6 +322,28 @@ uint16_t USBHID::report_desc_length()
 }
 
 
+void USBHID::callback_sof(int frame_number)
+{
+    (void)frame_number;
+    lock();
+
+    if (_send_queue_count > 0) {
+        queued_report_t *head = &_send_queue[_send_queue_head];
+        if (head->frames > 0) {
+            head->frames--;
+        }
+        _send_queue_start();
+    }
+
+    // keep the frame interrupt only while a report waits on a frame boundary
+    if (_sof_enabled && ((_send_queue_count == 0) || (_send_queue[_send_queue_head].frames == 0))) {
+        sof_disable();
+        _sof_enabled = false;
+    }
+
+    unlock();
+}
+
 void USBHID::callback_state_change(DeviceState new_state)
 {
     if (new_state != Configured) {
@@ -283,6 +355,12 @@ void USBHID::callback_state_change(DeviceState new_state)
             endpoint_abort(_int_out);
             _read_idle = true;
         }
+        _send_queue_head = 0;
+        _send_queue_count = 0;
+        if (_sof_enabled) {
+            sof_disable();
+            _sof_enabled = false;
+        }
     }
     _send_list.process();
     _read_list.process();
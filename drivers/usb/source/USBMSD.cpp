@@ -114,6 +114,9 @@ void USBMSD::_init()
     memset((void *)&_cbw, 0, sizeof(CBW));
     memset((void *)&_csw, 0, sizeof(CSW));
     _page = NULL;
+    _page_blocks = 0;
+    _page_base = 0;
+    _page_len = 0;
 }
 
 USBMSD::~USBMSD()
@@ -154,12 +157,26 @@ bool USBMSD::connect()
         _block_size = _memory_size / _block_count;
         if (_block_size != 0) {
             free(_page);
-            _page = (uint8_t *)malloc(_block_size * sizeof(uint8_t));
+            _page_blocks = MSD_AGGREGATE_BLOCKS;
+            if (_page_blocks > _block_count) {
+                _page_blocks = _block_count;
+            }
+            if (_page_blocks > 0xff) {
+                // disk_read/disk_write take an 8 bit block count
+                _page_blocks = 0xff;
+            }
+            _page = (uint8_t *)malloc(_block_size * _page_blocks);
+            if (_page == NULL) {
+                // fall back to a single block when memory is tight
+                _page_blocks = 1;
+                _page = (uint8_t *)malloc(_block_size * sizeof(uint8_t));
+            }
             if (_page == NULL) {
                 _mutex.unlock();
                 _mutex_init.unlock();
                 return false;
             }
+            _page_len = 0;
         }
     } else {
         _mutex.unlock();
@@ -586,16 +603,18 @@ void USBMSD::memoryWrite(uint8_t *buf, uint16_t size)
         endpoint_stall(_bulk_out);
     }
 
-    // we fill an array in RAM of 1 block before writing it in memory
+    // we collect a run of blocks in RAM before writing it in memory
+    if (_page_len == 0) {
+        _page_base = _addr;
+    }
     for (int i = 0; i < size; i++) {
-        _page[_addr % _block_size + i] = buf[i];
+        _page[_addr - _page_base + i] = buf[i];
     }
+    _page_len = _addr - _page_base + size;
 
-    // if the array is filled, write it in memory
-    if (!((_addr + size) % _block_size)) {
-        if (!(disk_status() & WRITE_PROTECT)) {
-            disk_write(_page, _addr / _block_size, 1);
-        }
+    // if the buffer is filled, write the whole run in one storage access
+    if (_page_len == _page_blocks * (uint32_t)_block_size) {
+        _flush_chunk();
     }
 
     _addr += size;
@@ -603,6 +622,7 @@ void USBMSD::memoryWrite(uint8_t *buf, uint16_t size)
     _csw.DataResidue -= size;
 
     if ((!_length) || (_stage != PROCESS_CBW)) {
+        _flush_chunk();
         _csw.Status = (_stage == ERROR) ? CSW_FAILED : CSW_PASSED;
         sendCSW();
     }
@@ -618,14 +638,14 @@ void USBMSD::memoryVerify(uint8_t *buf, uint16_t size)
         endpoint_stall(_bulk_out);
     }
 
-    // beginning of a new block -> load a whole block in RAM
-    if (!(_addr % _block_size)) {
-        disk_read(_page, _addr / _block_size, 1);
+    // beginning of a new run of blocks -> load them in RAM in one read
+    if ((_addr < _page_base) || (_addr >= _page_base + _page_len)) {
+        _read_chunk();
     }
 
     // info are in RAM -> no need to re-read memory
     for (n = 0; n < size; n++) {
-        if (_page[_addr % _block_size + n] != buf[n]) {
+        if (_page[_addr - _page_base + n] != buf[n]) {
             _mem_ok = false;
             break;
         }
@@ -890,18 +910,24 @@ void USBMSD::memoryRead(void)
     }
 
     if (n > 0) {
-        // we read an entire block
-        if (!(_addr % _block_size)) {
-            disk_read(_page, _addr / _block_size, 1);
+        // the requested data are not buffered yet -> read a run of blocks
+        if ((_addr < _page_base) || (_addr >= _page_base + _page_len)) {
+            _read_chunk();
         }
 
         // write data which are in RAM
-        _write_next(&_page[_addr % _block_size], MAX_PACKET);
+        _write_next(&_page[_addr - _page_base], MAX_PACKET);
 
         _addr += n;
         _length -= n;
 
         _csw.DataResidue -= n;
+
+        // prefetch the next run while the packet above is in flight so the
+        // storage read overlaps the USB transfer
+        if ((_length > 0) && (_stage == PROCESS_CBW) && (_addr >= _page_base + _page_len)) {
+            _read_chunk();
+        }
     }
 
     if (!_length || (_stage != PROCESS_CBW)) {
@@ -910,6 +936,33 @@ void USBMSD::memoryRead(void)
     }
 }
 
+void USBMSD::_read_chunk()
+{
+    // fetch as much of the remaining transfer as the buffer holds in a
+    // single storage read
+    uint32_t block = _addr / _block_size;
+    uint32_t count = (_length + _block_size - 1) / _block_size;
+    if (count > _page_blocks) {
+        count = _page_blocks;
+    }
+    if (count > _block_count - block) {
+        count = _block_count - block;
+    }
+    disk_read(_page, block, count);
+    _page_base = block * _block_size;
+    _page_len = count * _block_size;
+}
+
+void USBMSD::_flush_chunk()
+{
+    // write all complete blocks collected so far in a single storage access
+    uint32_t count = _page_len / _block_size;
+    if ((count > 0) && !(disk_status() & WRITE_PROTECT)) {
+        disk_write(_page, _page_base / _block_size, count);
+    }
+    _page_len = 0;
+}
+
 
 bool USBMSD::infoTransfer(void)
 {
@@ -961,10 +1014,14 @@ bool USBMSD::infoTransfer(void)
         return false;
     }
 
+    // a new transfer invalidates whatever the block buffer holds
+    _page_len = 0;
+
     return true;
 }
 
 void USBMSD::msd_reset()
 {
     _stage = READ_CBW;
+    _page_len = 0;
 }
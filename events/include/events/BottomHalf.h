@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef BOTTOM_HALF_H
+#define BOTTOM_HALF_H
+
+#include "events/EventQueue.h"
+#include "platform/Callback.h"
+#include "platform/NonCopyable.h"
+
+namespace events {
+/** \addtogroup events-public-api */
+/** @{*/
+
+/** A deferred second-stage interrupt handler.
+ *
+ * Two-stage interrupt handling keeps the hard interrupt handler minimal -
+ * acknowledge the peripheral, capture volatile state - and defers the rest
+ * to a BottomHalf: the handler runs shortly afterwards in a dedicated
+ * dispatch context above the shared event queues (see
+ * mbed_bottom_half_queue()), where it may take longer, use synchronization
+ * primitives and call APIs that are not interrupt safe.
+ *
+ * schedule() is interrupt safe and coalesces: while a run is already
+ * pending, further schedule() calls are free no-ops, so a burst of
+ * interrupts costs one deferred run rather than one queue slot each. The
+ * pending flag clears as the handler starts, so an interrupt arriving
+ * during the run correctly triggers another one.
+ *
+ * Each BottomHalf accounts for its own behaviour: how often it ran, the
+ * total and worst-case processor cycles spent in the handler (on cores
+ * with the DWT cycle counter), and how often scheduling failed because
+ * the dispatch queue was exhausted. This makes latency budgets checkable
+ * from telemetry rather than asserted in review.
+ *
+ * @note Synchronization level: Interrupt safe (schedule), but the
+ *       BottomHalf must be constructed in thread context so it can bind
+ *       to its dispatch queue.
+ */
+class BottomHalf : private mbed::NonCopyable<BottomHalf> {
+public:
+    /** Create a bottom half running on the shared bottom-half context.
+     *
+     * Must be called in thread context - the shared dispatch context is
+     * created on first use and that creation is not interrupt safe.
+     *
+     *  @param handler Deferred handler to run in dispatch context.
+     */
+    BottomHalf(mbed::Callback<void()> handler);
+
+    /** Create a bottom half running on a caller-provided queue.
+     *
+     *  @param handler Deferred handler to run in dispatch context.
+     *  @param queue   Queue whose dispatch context runs the handler.
+     */
+    BottomHalf(mbed::Callback<void()> handler, EventQueue *queue);
+
+    /** Request a deferred run of the handler. Safe from any context.
+     *
+     * A no-op while a run is already pending.
+     *
+     *  @return true if a run is now pending, false if the dispatch queue
+     *          was exhausted (counted by schedule_failures()).
+     */
+    bool schedule();
+
+    /** Check whether a run is currently pending. */
+    bool pending() const;
+
+    /** Get the number of times the handler has run. */
+    uint32_t run_count() const;
+
+    /** Get the total processor cycles spent in the handler.
+     *
+     * Zero on cores without the DWT cycle counter.
+     */
+    uint32_t total_cycles() const;
+
+    /** Get the worst-case processor cycles of a single handler run.
+     *
+     * Zero on cores without the DWT cycle counter.
+     */
+    uint32_t max_cycles() const;
+
+    /** Get the number of schedule() calls that failed for lack of queue
+     * memory. Persistent failures mean the dispatch queue is undersized
+     * or a handler is running too long.
+     */
+    uint32_t schedule_failures() const;
+
+private:
+    void dispatch();
+
+    mbed::Callback<void()> _handler;
+    EventQueue *_queue;
+    volatile uint8_t _pending;
+    volatile uint32_t _failures;
+    /* Written only from the dispatch context */
+    uint32_t _run_count;
+    uint32_t _total_cycles;
+    uint32_t _max_cycles;
+};
+
+/** @}*/
+
+}
+
+#endif
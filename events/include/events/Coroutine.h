@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef EVENTS_COROUTINE_H
+#define EVENTS_COROUTINE_H
+
+#include <cstdint>
+
+#include "events/EventQueue.h"
+#include "platform/NonCopyable.h"
+#include "rtos/EventFlags.h"
+
+namespace events {
+/** \addtogroup events-public-api */
+/** @{*/
+
+/* Re-check period, in milliseconds, while a coroutine awaits
+ * rtos::EventFlags. EventFlags has no wakeup callback, so CORO_AWAIT_FLAGS
+ * polls; awaits driven by a Coroutine::Signal or wake() are push-style and
+ * never poll. */
+#ifndef MBED_CONF_EVENTS_COROUTINE_FLAGS_POLL_PERIOD
+#define MBED_CONF_EVENTS_COROUTINE_FLAGS_POLL_PERIOD 10
+#endif
+
+/** A stackless cooperative coroutine dispatched by an EventQueue.
+ *
+ * Protocol sequences - modem bring-up, OTA, provisioning - are naturally
+ * sequential but are usually written as chains of callbacks on the shared
+ * event queue, with per-step state scattered across bound arguments. A
+ * Coroutine lets the sequence be written top to bottom in one function
+ * while costing what a hand-written state machine costs: the object holds
+ * a resume point and whatever members the sequence needs, not a 4 KB
+ * thread stack.
+ *
+ * Derive from Coroutine, put every value that must survive a suspension
+ * in members, and write step() with the CORO_* macros:
+ *
+ * @code
+ * class Provisioner : public events::Coroutine {
+ * public:
+ *     Provisioner(events::EventQueue *queue) : Coroutine(queue) {}
+ *     Signal link_up;      // set from the network status callback
+ *
+ * private:
+ *     void step() override
+ *     {
+ *         CORO_BEGIN();
+ *         modem_power_on();
+ *         CORO_SLEEP(200ms);                 // boot delay, no thread blocked
+ *         CORO_AWAIT(link_up);
+ *         _socket.sigio(mbed::callback(this, &Provisioner::wake));
+ *         CORO_AWAIT_UNTIL((_err = _socket.send(_req, sizeof _req))
+ *                          != NSAPI_ERROR_WOULD_BLOCK);
+ *         CORO_AWAIT_FLAGS(_flags, DONE_FLAG);
+ *         CORO_END();
+ *     }
+ *
+ *     TCPSocket _socket;
+ *     rtos::EventFlags _flags;
+ *     nsapi_size_or_error_t _err;
+ *     uint8_t _req[64];
+ * };
+ * @endcode
+ *
+ * The suspension mechanism is the classic switch-based continuation: each
+ * CORO_* suspension point records its line number and returns, and the
+ * next resume jumps straight back to it. Two rules follow. step() must
+ * contain the CORO_BEGIN()/CORO_END() bracket at its top level (not inside
+ * a nested switch), and local variables do not survive a suspension -
+ * state that must persist belongs in members.
+ *
+ * Resumption always happens from the queue's dispatch context, so the
+ * code in step() needs no locking against itself. wake() is interrupt
+ * safe and coalesces like BottomHalf::schedule(): a burst of wakeups
+ * while a resume is already pending costs nothing.
+ *
+ * @note Synchronization level: Interrupt safe (wake, Signal::set); all
+ *       other methods belong to the dispatch context or to the thread
+ *       that owns the coroutine.
+ */
+class Coroutine : private mbed::NonCopyable<Coroutine> {
+public:
+    /** A push-style wakeup source a coroutine can await with CORO_AWAIT().
+     *
+     * set() latches; the await consumes the latch, so a signal set before
+     * the coroutine reaches the await is not lost. One coroutine may wait
+     * on a signal at a time.
+     */
+    class Signal : private mbed::NonCopyable<Signal> {
+    public:
+        constexpr Signal() = default;
+
+        /** Latch the signal and resume the awaiting coroutine, if any.
+         * Safe from any context.
+         */
+        void set();
+
+    private:
+        friend class Coroutine;
+        Coroutine *_waiter = nullptr;
+        uint8_t _set = 0;
+    };
+
+    /** Create a coroutine dispatched by the given queue.
+     *
+     *  @param queue Queue whose dispatch context runs step().
+     */
+    Coroutine(EventQueue *queue);
+
+    virtual ~Coroutine() = default;
+
+    /** Start (or restart) the coroutine from the top of step(). */
+    void start();
+
+    /** Resume the coroutine so its pending await re-checks its condition.
+     *
+     * Safe from any context; attach it to push sources such as
+     * Socket::sigio(). Coalesced - wakeups while a resume is already
+     * queued are free no-ops.
+     *
+     *  @return true if a resume is now pending, false if the dispatch
+     *          queue was exhausted (also latched by failed()).
+     */
+    bool wake();
+
+    /** Check whether the coroutine has run past CORO_END(). */
+    bool finished() const;
+
+    /** Check whether the coroutine lost a resume because the dispatch
+     * queue was exhausted. A failed coroutine stops making progress
+     * until start() is called again; persistent failures mean the queue
+     * is undersized.
+     */
+    bool failed() const;
+
+protected:
+    /** The coroutine body, bracketed by CORO_BEGIN()/CORO_END(). */
+    virtual void step() = 0;
+
+    /* Support functions for the CORO_* macros. */
+    uint16_t coro_line() const
+    {
+        return _line;
+    }
+    void coro_set_line(uint16_t line)
+    {
+        _line = line;
+    }
+    void coro_sleep(EventQueue::duration rel_time);
+    bool coro_await(Signal &sig);
+    bool coro_await_flags(rtos::EventFlags &flags, uint32_t mask);
+    void coro_finish();
+
+private:
+    void run();
+
+    EventQueue *_queue;
+    uint16_t _line;
+    uint8_t _pending;
+    bool _started;
+    bool _finished;
+    bool _failed;
+};
+
+/** Open the coroutine body. Must be first in step(), at its top level. */
+#define CORO_BEGIN() switch (coro_line()) { case 0:
+
+/** Close the coroutine body and mark the coroutine finished. */
+#define CORO_END() } coro_finish()
+
+/** Suspend and resume on the next wake() - a cooperative yield. */
+#define CORO_YIELD() \
+    do { \
+        coro_set_line(__LINE__); \
+        return; \
+    case __LINE__:; \
+    } while (0)
+
+/** Suspend for a relative time, resuming via the queue's timer. */
+#define CORO_SLEEP(rel_time) \
+    do { \
+        coro_set_line(__LINE__); \
+        coro_sleep(rel_time); \
+        return; \
+    case __LINE__:; \
+    } while (0)
+
+/** Suspend until the Signal is set; consumes the signal's latch. */
+#define CORO_AWAIT(sig) \
+    do { \
+        coro_set_line(__LINE__); \
+    case __LINE__: \
+        if (!coro_await(sig)) { \
+            return; \
+        } \
+    } while (0)
+
+/** Suspend until the condition holds. The condition is re-evaluated on
+ * every wake(), so pair it with a push source (sigio, a callback calling
+ * wake()) that fires when the condition may have changed. */
+#define CORO_AWAIT_UNTIL(condition) \
+    do { \
+        coro_set_line(__LINE__); \
+    case __LINE__: \
+        if (!(condition)) { \
+            return; \
+        } \
+    } while (0)
+
+/** Suspend until any flag in mask is set on the rtos::EventFlags, then
+ * clear the satisfied flags. Re-checked every
+ * MBED_CONF_EVENTS_COROUTINE_FLAGS_POLL_PERIOD milliseconds - if the
+ * flag setter can call wake() instead, prefer a Signal, which resumes
+ * immediately. */
+#define CORO_AWAIT_FLAGS(flags, mask) \
+    do { \
+        coro_set_line(__LINE__); \
+    case __LINE__: \
+        if (!coro_await_flags(flags, mask)) { \
+            return; \
+        } \
+    } while (0)
+
+/** @}*/
+
+}
+
+#endif
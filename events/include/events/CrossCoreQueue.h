@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef EVENTS_CROSS_CORE_QUEUE_H
+#define EVENTS_CROSS_CORE_QUEUE_H
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "events/EventQueue.h"
+#include "platform/Callback.h"
+#include "platform/NonCopyable.h"
+
+namespace events {
+/** \addtogroup events-public-api */
+/** @{*/
+
+/* Entries per direction in a cross-core channel. Both images must be
+ * built with the same value - the channel layout is part of the
+ * inter-core ABI. */
+#ifndef MBED_CONF_EVENTS_CROSS_CORE_SLOTS
+#define MBED_CONF_EVENTS_CROSS_CORE_SLOTS 8
+#endif
+
+/* Payload bytes per entry. Part of the inter-core ABI, like the slot
+ * count. Posts carry at most this much trivially-copyable state. */
+#ifndef MBED_CONF_EVENTS_CROSS_CORE_PAYLOAD
+#define MBED_CONF_EVENTS_CROSS_CORE_PAYLOAD 32
+#endif
+
+/** One direction of a cross-core channel: a single-producer
+ * single-consumer ring in memory both cores can see.
+ *
+ * Placement is the application's job and matters: the struct must live
+ * in a shared RAM region that is either non-cacheable or configured
+ * write-through on both cores (on STM32H7, SRAM4 is the usual choice).
+ * The producing core writes head, the consuming core writes tail, so no
+ * lock is needed - each index has exactly one writer.
+ */
+struct CrossCoreChannel {
+    volatile uint32_t head;     /**< next slot to fill, written by producer */
+    volatile uint32_t tail;     /**< next slot to drain, written by consumer */
+    struct {
+        uint8_t id;             /**< handler id bound on the consuming core */
+        uint8_t size;           /**< payload bytes used */
+        alignas(uint64_t) uint8_t payload[MBED_CONF_EVENTS_CROSS_CORE_PAYLOAD];
+    } slots[MBED_CONF_EVENTS_CROSS_CORE_SLOTS];
+};
+
+/** Post work to an event queue running on the other core.
+ *
+ * Dual-core parts (STM32H745, PSoC6, LPC55S69) run one image per core,
+ * so a function pointer captured on one core means nothing on the other.
+ * Work is therefore addressed by small handler ids: the consuming core
+ * binds an id to a handler, the producing core posts the id plus a
+ * trivially-copyable payload, and the consumer's CrossCoreQueue forwards
+ * each entry to its local EventQueue - remote work is dispatched exactly
+ * like local work, after it.
+ *
+ * Producer side:
+ * @code
+ * sensor_sample_t sample = read_sample();
+ * remote.post(FUSION_STEP, sample);      // returns false if the ring is full
+ * @endcode
+ *
+ * Consumer side (other core):
+ * @code
+ * remote.bind(FUSION_STEP, handle_fusion_step);
+ * // from the inter-core mailbox interrupt, or polled:
+ * remote.process();
+ * @endcode
+ *
+ * After filling a slot the producer calls the notify hook - attach the
+ * target's inter-core doorbell there (HSEM release on STM32H7, IPC
+ * notify on PSoC6); without one the producer falls back to __SEV(),
+ * which only wakes a core that is waiting for events.
+ *
+ * Payloads must be trivially copyable and fit
+ * MBED_CONF_EVENTS_CROSS_CORE_PAYLOAD - both checked at compile time -
+ * because the bytes are memcpy'd through shared memory between images
+ * that share no heap and no code addresses.
+ *
+ * @note Synchronization level: post() and process() are each single
+ *       context - one posting context per direction, one draining
+ *       context. bind() must complete before the first process().
+ */
+class CrossCoreQueue : private mbed::NonCopyable<CrossCoreQueue> {
+public:
+    /** Handler bound to an id on the consuming core. */
+    typedef void (*handler_t)(const void *payload, size_t size);
+
+    /** Ids available for bind()/post(). */
+    static const int MAX_HANDLERS = 16;
+
+    /** Create a proxy over one channel per direction.
+     *
+     *  @param tx    Channel this core produces into, or NULL if this
+     *               core only consumes.
+     *  @param rx    Channel this core drains, or NULL if it only posts.
+     *  @param queue Local queue that runs received work. NULL runs it
+     *               directly in process()'s context instead.
+     */
+    CrossCoreQueue(CrossCoreChannel *tx, CrossCoreChannel *rx, EventQueue *queue = nullptr);
+
+    /** Reset a channel before first use. Call on exactly one core,
+     * before the other core starts posting or draining.
+     */
+    static void channel_init(CrossCoreChannel *channel);
+
+    /** Attach the doorbell that wakes the consuming core after a post.
+     *
+     *  @param notify Interrupt-safe hook, e.g. the HSEM/IPC trigger.
+     */
+    void attach_notify(mbed::Callback<void()> notify);
+
+    /** Bind a handler id to the function that runs received entries. */
+    void bind(int id, handler_t handler);
+
+    /** Post a payload-carrying entry to the other core.
+     *
+     *  @param id      Handler id bound on the other core.
+     *  @param payload Trivially-copyable value, copied into the ring.
+     *  @return true on success, false if the ring was full (counted by
+     *          dropped()).
+     */
+    template <typename T>
+    bool post(int id, const T &payload)
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "cross-core payloads are copied between images as raw bytes");
+        static_assert(sizeof(T) <= MBED_CONF_EVENTS_CROSS_CORE_PAYLOAD,
+                      "payload exceeds MBED_CONF_EVENTS_CROSS_CORE_PAYLOAD");
+        return post_raw(id, &payload, sizeof(T));
+    }
+
+    /** Post an entry with no payload. */
+    bool post(int id)
+    {
+        return post_raw(id, nullptr, 0);
+    }
+
+    /** Drain received entries, forwarding each to the local queue.
+     *
+     * Call from the inter-core mailbox interrupt, or poll it. Entries
+     * with no bound handler are discarded and counted by unbound().
+     *
+     *  @return number of entries drained.
+     */
+    int process();
+
+    /** Get the number of posts refused because the ring was full. */
+    uint32_t dropped() const;
+
+    /** Get the number of received entries with no bound handler. */
+    uint32_t unbound() const;
+
+private:
+    bool post_raw(int id, const void *payload, size_t size);
+
+    /* Received entry copied out of the ring, dispatched by value so the
+     * slot is free again before the local queue runs it. */
+    struct Envelope {
+        handler_t handler;
+        uint8_t size;
+        alignas(uint64_t) uint8_t payload[MBED_CONF_EVENTS_CROSS_CORE_PAYLOAD];
+    };
+    static void deliver(Envelope envelope);
+
+    CrossCoreChannel *_tx;
+    CrossCoreChannel *_rx;
+    EventQueue *_queue;
+    mbed::Callback<void()> _notify;
+    handler_t _handlers[MAX_HANDLERS];
+    uint32_t _dropped;
+    uint32_t _unbound;
+};
+
+/** @}*/
+
+}
+
+#endif
@@ -71,6 +71,7 @@ public:
             _event->id = 0;
             _event->delay = duration(0);
             _event->period = non_periodic;
+            _event->priority = 0;
 
             _event->post = &Event::event_post<F>;
             _event->dtor = &Event::event_dtor<F>;
@@ -174,6 +175,20 @@ public:
         period(duration(p));
     }
 
+    /** Configure the priority band of an event
+     *
+     *  @param prio Priority band, 0 (the default) to EQUEUE_NUM_PRIORITIES-1.
+     *              When several events are due in the same dispatch pass,
+     *              higher bands are dispatched before lower ones, so
+     *              latency-critical events are not queued behind bulk work.
+     */
+    void priority(int prio)
+    {
+        if (_event) {
+            _event->priority = prio;
+        }
+    }
+
     /** Posts an event onto the underlying event queue
      *
      *  The event is posted to the underlying queue and is executed in the
@@ -252,6 +267,7 @@ private:
 
         duration delay;
         duration period;
+        int priority;
 
         int (*post)(struct event *, ArgTs... args);
         void (*dtor)(struct event *);
@@ -272,6 +288,7 @@ private:
         new (p) C(*(F *)(e + 1), args...);
         equeue_event_delay(p, e->delay.count());
         equeue_event_period(p, e->period.count());
+        equeue_event_priority(p, e->priority);
         equeue_event_dtor(p, &EventQueue::function_dtor<C>);
         return equeue_post(e->equeue, &EventQueue::function_call<C>, p);
     }
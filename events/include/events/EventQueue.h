@@ -321,6 +321,26 @@ public:
     template <typename F, typename ...Args>
     int call(F f, Args ...args);
 
+    /** Calls an event on the queue, coalescing with a pending one
+     *
+     *  Like call, but any event previously posted through the same
+     *  caller-owned id slot that has not yet started executing is cancelled
+     *  and replaced, so a handler posted faster than it is dispatched runs
+     *  only for the newest posting. The slot must be initialized to 0 and
+     *  acts as the coalescing key; use one slot per logical handler.
+     *
+     *  The call_coalesced function is IRQ safe.
+     *
+     *  @param id       Caller-owned coalescing slot, updated with the new event's id
+     *  @param f        Function to execute in the context of the dispatch loop
+     *  @param args     Arguments to pass to the callback
+     *  @return         A unique ID that represents the posted event and can
+     *                  be passed to cancel, or an ID of 0 if there is not
+     *                  enough memory to allocate the event.
+     */
+    template <typename F, typename ...Args>
+    int call_coalesced(int *id, F f, Args ...args);
+
     /** Calls an event on the queue
      *
      *  The specified callback is executed in the context of the event
@@ -795,6 +815,38 @@ public:
         return call(context<F, ArgTs...>(std::move(f), args...));
     }
 
+    /** Calls an event on the queue, coalescing with a pending one
+     *  @see                    EventQueue::call
+     *  @param id               Caller-owned coalescing slot, initialized to 0,
+     *                          updated with the new event's id
+     *  @param f                Function to execute in the context of the dispatch loop
+     */
+    template <typename F>
+    int call_coalesced(int *id, F f)
+    {
+        void *p = equeue_alloc(&_equeue, sizeof(F));
+        if (!p) {
+            return 0;
+        }
+
+        F *e = new (p) F(std::move(f));
+        equeue_event_dtor(e, &EventQueue::function_dtor<F>);
+        return equeue_post_coalesced(&_equeue, id, &EventQueue::function_call<F>, e);
+    }
+
+    /** Calls an event on the queue, coalescing with a pending one
+     *  @see                    EventQueue::call_coalesced
+     *  @param id               Caller-owned coalescing slot, initialized to 0,
+     *                          updated with the new event's id
+     *  @param f                Function to execute in the context of the dispatch loop
+     *  @param args             Arguments to pass to the callback
+     */
+    template <typename F, typename... ArgTs>
+    int call_coalesced(int *id, F f, ArgTs... args)
+    {
+        return call_coalesced(id, context<F, ArgTs...>(std::move(f), args...));
+    }
+
     /** Calls an event on the queue
      *  @see EventQueue::call
      */
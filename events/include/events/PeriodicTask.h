@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PERIODIC_TASK_H
+#define PERIODIC_TASK_H
+
+#include "events/EventQueue.h"
+#include "platform/Callback.h"
+#include "platform/NonCopyable.h"
+
+namespace events {
+/** \addtogroup events-public-api */
+/** @{*/
+
+/** A phase-locked periodic task on an event queue.
+ *
+ * call_every() schedules each period relative to when the previous
+ * dispatch ran, so any lateness - a long-running event ahead in the
+ * queue, a slow handler - accumulates and the task slips phase over
+ * time. PeriodicTask instead derives every deadline from the start
+ * time: run n is due at t0 + n * period, so lateness in one run never
+ * moves the deadlines of the runs after it. That is the behaviour
+ * control loops and sensor sampling need - a late sample is late, but
+ * the sampling grid itself does not drift.
+ *
+ * Each run's start-time jitter against its deadline is accumulated
+ * (count, last, worst, total) so the loop's timing can be watched from
+ * telemetry. When a run misses its deadline by more than the period the
+ * task has overrun; the overrun callback, if set, is told by how much,
+ * and the catch-up policy decides what happens to the missed runs:
+ *
+ * - CATCHUP_RUN (default): missed runs execute back to back until the
+ *   task catches up with its grid. Total run count is preserved.
+ * - CATCHUP_SKIP: missed runs are dropped and the task resumes on the
+ *   next grid point in the future. Phase is preserved, rate is not.
+ *
+ * @note Synchronization level: Not protected. start(), stop() and the
+ *       accessors must run in the queue's dispatch context or while
+ *       dispatch is not running.
+ */
+class PeriodicTask : private mbed::NonCopyable<PeriodicTask> {
+public:
+    /** What to do with runs missed during an overrun */
+    enum catchup_policy_t {
+        CATCHUP_RUN,    /**< Execute missed runs immediately, preserving count */
+        CATCHUP_SKIP,   /**< Drop missed runs, resuming on the next grid point */
+    };
+
+    /** Start-time jitter of runs against their absolute deadlines */
+    struct jitter_stats_t {
+        uint32_t count;     /**< Runs measured */
+        uint32_t overruns;  /**< Runs late by more than a period */
+        int32_t last_ms;    /**< Jitter of the most recent run */
+        int32_t max_ms;     /**< Worst jitter seen */
+        int64_t total_ms;   /**< Sum of jitter, for averaging */
+    };
+
+    /** Create a periodic task on an event queue.
+     *
+     *  @param queue    Queue whose dispatch context runs the task
+     *  @param task     Task to run each period
+     *  @param period   Period of the task
+     */
+    PeriodicTask(EventQueue *queue, mbed::Callback<void()> task,
+                 EventQueue::duration period);
+
+    /** Stops the task if it is running */
+    ~PeriodicTask();
+
+    /** Start periodic execution.
+     *
+     * The first run is due one period from now and every later run is
+     * due a whole number of periods after that, regardless of when
+     * earlier runs actually executed.
+     *
+     *  @return 0 on success, negative error code if the queue is
+     *          exhausted
+     */
+    int start();
+
+    /** Stop periodic execution.
+     *
+     * A run already being dispatched still completes.
+     */
+    void stop();
+
+    /** Check whether the task is running */
+    bool running() const;
+
+    /** Choose what happens to runs missed during an overrun.
+     *
+     *  @param policy   Catch-up policy, CATCHUP_RUN by default
+     */
+    void set_catchup_policy(catchup_policy_t policy);
+
+    /** Set a callback invoked when the task overruns.
+     *
+     * Called in dispatch context with the lateness in milliseconds
+     * whenever a run starts more than a period after its deadline.
+     *
+     *  @param callback Overrun callback, or an empty callback to clear
+     */
+    void set_overrun_callback(mbed::Callback<void(int32_t)> callback);
+
+    /** Get the accumulated jitter statistics */
+    jitter_stats_t jitter() const;
+
+    /** Reset the jitter statistics */
+    void reset_jitter();
+
+private:
+    void run();
+    int schedule(int32_t delay_ms);
+
+    EventQueue *_queue;
+    mbed::Callback<void()> _task;
+    mbed::Callback<void(int32_t)> _overrun;
+    uint32_t _period_ms;
+    catchup_policy_t _policy;
+    unsigned _t0;           // Queue tick the grid is anchored to
+    uint32_t _n;            // Index of the next run on the grid
+    int _id;                // Queued event, 0 when stopped
+    jitter_stats_t _stats;
+};
+
+/** @}*/
+
+} // namespace events
+
+#endif
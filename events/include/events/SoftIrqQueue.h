@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SOFT_IRQ_QUEUE_H
+#define SOFT_IRQ_QUEUE_H
+
+#include <stdint.h>
+
+#include "platform/Callback.h"
+#include "platform/NonCopyable.h"
+
+namespace events {
+/** \addtogroup events-public-api */
+/** @{*/
+
+/* Entries in a soft-IRQ queue. Posts beyond this while the dispatcher
+ * has not caught up fail and are counted. */
+#ifndef MBED_CONF_EVENTS_SOFTIRQ_SLOTS
+#define MBED_CONF_EVENTS_SOFTIRQ_SLOTS 8
+#endif
+
+/* Default cycle budget applied to posts that do not carry their own;
+ * 0 leaves them unbudgeted. */
+#ifndef MBED_CONF_EVENTS_SOFTIRQ_DEFAULT_BUDGET
+#define MBED_CONF_EVENTS_SOFTIRQ_DEFAULT_BUDGET 0
+#endif
+
+/* When set, a handler exceeding its cycle budget raises MBED_ERROR
+ * instead of only being counted and reported. */
+#ifndef MBED_CONF_EVENTS_SOFTIRQ_TRAP_OVERRUN
+#define MBED_CONF_EVENTS_SOFTIRQ_TRAP_OVERRUN 0
+#endif
+
+/** A run-to-completion dispatcher in a reserved software interrupt.
+ *
+ * An EventQueue dispatches in a thread, so even a zero-delay event waits
+ * behind a context switch and whatever the scheduler is doing - too slow
+ * for work like an 8kHz current loop. SoftIrqQueue instead drains its
+ * queue directly in an interrupt the application reserves for it: bind
+ * an interrupt the target does not use (most parts have spare lines) at
+ * a priority above SysTick/PendSV but below the hard real-time
+ * peripherals, and posted handlers run there, preempting every thread
+ * with interrupt-entry latency rather than scheduler latency. Handlers
+ * stay within the Mbed programming model - Callbacks, no registers, no
+ * vector table editing in application code - but run to completion and
+ * must not block.
+ *
+ * Discipline is enforced rather than assumed: each post carries a cycle
+ * budget (or inherits MBED_CONF_EVENTS_SOFTIRQ_DEFAULT_BUDGET) measured
+ * with the DWT cycle counter on cores that have one. A handler exceeding
+ * its budget is counted, reported through the overrun callback with the
+ * cycles it used, and with MBED_CONF_EVENTS_SOFTIRQ_TRAP_OVERRUN traps
+ * as a system error - a 100us budget violation in a control loop is a
+ * bug, not a statistic.
+ *
+ * post() is safe from any context. On builds without an NVIC the
+ * reserved-interrupt machinery does not exist and posted handlers run
+ * in the posting context instead, after the handler already running.
+ *
+ * @note Synchronization level: Interrupt safe (post), but init() must
+ *       run in thread context before the first post.
+ */
+class SoftIrqQueue : private mbed::NonCopyable<SoftIrqQueue> {
+public:
+    /** Create a dispatcher on a reserved interrupt line.
+     *
+     *  @param irq      Interrupt number to reserve, a line the target
+     *                  does not otherwise use
+     *  @param priority Interrupt priority for the dispatcher; pick it
+     *                  below the hard real-time peripherals
+     */
+    SoftIrqQueue(int irq, uint32_t priority);
+
+    ~SoftIrqQueue();
+
+    /** Claim the interrupt and start accepting posts.
+     *
+     *  @return 0 on success, negative error code if the line could not
+     *          be claimed
+     */
+    int init();
+
+    /** Post a handler to run in the dispatcher's interrupt context.
+     *
+     * Safe from any context. The handler runs to completion above all
+     * threads and must not block.
+     *
+     *  @param handler  Handler to run
+     *  @param budget   Cycle budget for this handler, or 0 for the
+     *                  configured default
+     *  @return true if queued, false if the queue is full (counted by
+     *          post_failures())
+     */
+    bool post(mbed::Callback<void()> handler, uint32_t budget = 0);
+
+    /** Set a callback invoked when a handler exceeds its cycle budget.
+     *
+     * Runs in the dispatcher's interrupt context, after the offending
+     * handler, with the cycles used and the budget it was given.
+     *
+     *  @param callback Overrun callback, or an empty callback to clear
+     */
+    void set_overrun_callback(mbed::Callback<void(uint32_t, uint32_t)> callback);
+
+    /** Get the number of handlers dispatched */
+    uint32_t run_count() const;
+
+    /** Get the worst handler cycle count seen, 0 without a cycle counter */
+    uint32_t max_cycles() const;
+
+    /** Get the number of budget overruns */
+    uint32_t overruns() const;
+
+    /** Get the number of posts rejected because the queue was full */
+    uint32_t post_failures() const;
+
+private:
+    struct entry_t {
+        mbed::Callback<void()> handler;
+        uint32_t budget;
+    };
+
+    void dispatch();
+    void pend();
+    static void irq_entry();
+
+    int _irq;
+    uint32_t _priority;
+    entry_t _slots[MBED_CONF_EVENTS_SOFTIRQ_SLOTS];
+    uint32_t _head;     // Next slot to fill
+    uint32_t _tail;     // Next slot to drain
+    bool _dispatching;
+    mbed::Callback<void(uint32_t, uint32_t)> _overrun;
+    uint32_t _run_count;
+    uint32_t _max_cycles;
+    uint32_t _overruns;
+    uint32_t _failures;
+};
+
+/** @}*/
+
+} // namespace events
+
+#endif
@@ -86,7 +86,7 @@ public:
      *  @param f        Function to execute when the event is dispatched
      *  @param args     Arguments to bind to the callback
      */
-    constexpr UserAllocatedEvent(F f,  ArgTs... args) : _e(get_default_equeue_event()), _c(f, args...), _delay(), _period(-1), _equeue(), _post_ref()
+    constexpr UserAllocatedEvent(F f,  ArgTs... args) : _e(get_default_equeue_event()), _c(f, args...), _delay(), _period(-1), _priority(), _equeue(), _post_ref()
     {
     }
 
@@ -100,7 +100,7 @@ public:
      *  @param f        Function to execute when the event is dispatched
      *  @param args     Arguments to bind to the callback
      */
-    constexpr UserAllocatedEvent(EventQueue *queue, F f,  ArgTs... args) : _e(get_default_equeue_event()), _c(f, args...), _delay(), _period(-1), _equeue(&queue->_equeue), _post_ref()
+    constexpr UserAllocatedEvent(EventQueue *queue, F f,  ArgTs... args) : _e(get_default_equeue_event()), _c(f, args...), _delay(), _period(-1), _priority(), _equeue(&queue->_equeue), _post_ref()
     {
     }
 
@@ -228,6 +228,18 @@ public:
         _period = period;
     }
 
+    /** Configure the priority band of an event
+     *
+     *  @param priority Priority band, 0 (the default) to EQUEUE_NUM_PRIORITIES-1.
+     *                  When several events are due in the same dispatch pass,
+     *                  higher bands are dispatched first.
+     */
+    void priority(int priority)
+    {
+        MBED_ASSERT(!_post_ref);
+        _priority = priority;
+    }
+
     /** Cancels posted event
      *
      *  Attempts to cancel posted event. It is not safe to call
@@ -253,6 +265,7 @@ private:
     C _c;
     int _delay;
     int _period;
+    int _priority;
     struct equeue *_equeue;
     uint8_t _post_ref;
 
@@ -264,6 +277,7 @@ private:
         core_util_atomic_incr_u8(&_post_ref, 1);
         equeue_event_delay(&_e + 1, _delay);
         equeue_event_period(&_e + 1, _period);
+        equeue_event_priority(&_e + 1, _priority);
         equeue_post_user_allocated(_equeue, &EventQueue::function_call<C>, &_e);
         return true;
     }
@@ -278,6 +292,7 @@ private:
         core_util_atomic_incr_u8(&_post_ref, 1);
         equeue_event_delay(&_e + 1, _delay);
         equeue_event_period(&_e + 1, _period);
+        equeue_event_priority(&_e + 1, _priority);
         equeue_post_user_allocated(_equeue, &EventQueue::function_call<C>, &_e);
         return true;
     }
@@ -39,6 +39,20 @@ extern "C" {
 // This size is guaranteed to fit events created by event_call
 #define EQUEUE_EVENT_SIZE (sizeof(struct equeue_event) + 2*sizeof(void*))
 
+// Optional timing-wheel backend for delayed events
+//
+// By default pending events are kept in a sorted list, which makes posting
+// a delayed event O(n) in the number of events outstanding. Compiling with
+// EQUEUE_TIMING_WHEEL defined replaces the sorted list with a hierarchical
+// timing wheel, giving O(1) insert and cancel regardless of how many timers
+// are pending, at the cost of EQUEUE_WHEEL_LEVELS * EQUEUE_WHEEL_SLOTS
+// pointers of additional RAM per queue.
+#ifdef EQUEUE_TIMING_WHEEL
+#define EQUEUE_WHEEL_BITS 5
+#define EQUEUE_WHEEL_SLOTS (1 << EQUEUE_WHEEL_BITS)
+#define EQUEUE_WHEEL_LEVELS 4
+#endif
+
 // Internal event structure
 struct equeue_event {
     unsigned size;
@@ -54,14 +68,42 @@ struct equeue_event {
     void (*dtor)(void *);
 
     void (*cb)(void *);
+    // keep priority last so existing aggregate initializers stay valid
+    uint8_t priority;
     // data follows
 };
 
+// Number of priority bands recognized by equeue_event_priority
+#define EQUEUE_NUM_PRIORITIES 4
+
+// Number of exact-fit size classes in the event allocator. Freed events of
+// up to EQUEUE_NUM_SIZE_CLASSES-1 pointer-sized words of payload are kept
+// on per-class free lists, making allocation and free of recurring event
+// sizes O(1); larger events fall back to the sorted overflow list.
+#ifndef EQUEUE_NUM_SIZE_CLASSES
+#define EQUEUE_NUM_SIZE_CLASSES 8
+#endif
+
+// Number of distinct callbacks tracked by the dispatch profiler when
+// compiled with EQUEUE_PROFILE defined
+#ifndef EQUEUE_PROFILE_SLOTS
+#define EQUEUE_PROFILE_SLOTS 16
+#endif
+
 // Event queue structure
 typedef struct equeue {
     struct equeue_event *queue;
     unsigned tick;
 
+#ifdef EQUEUE_TIMING_WHEEL
+    struct equeue_wheel {
+        struct equeue_event *slots[EQUEUE_WHEEL_LEVELS][EQUEUE_WHEEL_SLOTS];
+        struct equeue_event *due;
+        struct equeue_event **due_tail;
+        unsigned tick;
+    } wheel;
+#endif
+
     uint16_t generation;
     bool break_requested;
 
@@ -70,17 +112,44 @@ typedef struct equeue {
     void *allocated;
 
     struct equeue_event *chunks;
+    struct equeue_event *classes[EQUEUE_NUM_SIZE_CLASSES];
     struct equeue_slab {
         size_t size;
         unsigned char *data;
     } slab;
 
+#ifdef EQUEUE_ALLOC_STATS
+    struct equeue_alloc_counters {
+        size_t live;
+        size_t hwm;
+        size_t failures;
+    } alloc_counters[EQUEUE_NUM_SIZE_CLASSES + 1];
+#endif
+
+#ifdef EQUEUE_PROFILE
+    struct equeue_profile_counters {
+        void (*cb)(void *);
+        size_t count;
+        unsigned total_ms;
+        unsigned max_ms;
+        unsigned max_lateness_ms;
+    } profile_counters[EQUEUE_PROFILE_SLOTS];
+#endif
+
     struct equeue_background {
         bool active;
         void (*update)(void *timer, int ms);
         void *timer;
     } background;
 
+    struct equeue_isr_lane {
+        unsigned char *slots;
+        size_t slot_size;
+        size_t count;
+        size_t hint;
+        struct equeue_event *volatile incoming;
+    } isr_lane;
+
     equeue_sema_t eventsema;
     equeue_mutex_t queuelock;
     equeue_mutex_t memlock;
@@ -138,6 +207,24 @@ int equeue_call(equeue_t *queue, void (*cb)(void *), void *data);
 int equeue_call_in(equeue_t *queue, int ms, void (*cb)(void *), void *data);
 int equeue_call_every(equeue_t *queue, int ms, void (*cb)(void *), void *data);
 
+// Coalescing event calls
+//
+// Like equeue_call, but coalesces through a caller-owned id slot: any event
+// previously posted through the same slot that has not yet started
+// executing is cancelled and replaced, so when a handler is posted faster
+// than it is dispatched only the newest posting runs. The slot must be
+// initialized to 0 and acts as the coalescing key; use one slot per
+// logical handler. The replaced event's destructor runs in the caller's
+// context.
+//
+// The equeue_call_coalesced function is irq safe. If the pending event has
+// already started executing it cannot be replaced and both run, matching
+// equeue_cancel semantics.
+//
+// The new event's id is stored in the slot and returned; 0 is returned if
+// there is not enough memory to allocate the event.
+int equeue_call_coalesced(equeue_t *queue, int *id, void (*cb)(void *), void *data);
+
 // Allocate memory for events
 //
 // The equeue_alloc function allocates an event that can be manually dispatched
@@ -158,14 +245,64 @@ int equeue_call_every(equeue_t *queue, int ms, void (*cb)(void *), void *data);
 void *equeue_alloc(equeue_t *queue, size_t size);
 void equeue_dealloc(equeue_t *queue, void *event);
 
+// Allocator instrumentation
+//
+// When compiled with EQUEUE_ALLOC_STATS defined, the queue counts per size
+// class how many events are outstanding, the high-water mark of outstanding
+// events, and how many allocation attempts failed, so event-queue memory
+// can be sized from measurement instead of guesswork.
+//
+// The equeue_alloc_stats function fills stats with up to count entries, one
+// per size class plus a final entry for allocations beyond the largest
+// class (reported with size 0), and returns the number of entries written.
+// Without EQUEUE_ALLOC_STATS it writes nothing and returns 0.
+typedef struct equeue_alloc_stats {
+    size_t size;      // total event size in bytes served by this class
+    size_t live;      // allocations currently outstanding
+    size_t hwm;       // most allocations ever outstanding at once
+    size_t failures;  // allocation attempts that returned null
+} equeue_alloc_stats_t;
+
+size_t equeue_alloc_stats(equeue_t *queue, equeue_alloc_stats_t *stats, size_t count);
+
+// Dispatch instrumentation
+//
+// When compiled with EQUEUE_PROFILE defined, equeue_dispatch records per
+// callback address how many times the callback ran, its total and
+// worst-case execution time, and its worst lateness - how long past its
+// target time an event waited before the callback started. Times come from
+// the platform tick and so share its millisecond granularity. The first
+// EQUEUE_PROFILE_SLOTS distinct callbacks are tracked; further callbacks
+// are silently dropped.
+//
+// The equeue_profile function fills profile with up to count entries, one
+// per tracked callback, and returns the number of entries written. Without
+// EQUEUE_PROFILE it writes nothing and returns 0.
+typedef struct equeue_profile {
+    void (*cb)(void *);       // profiled callback
+    size_t count;             // times the callback was dispatched
+    unsigned total_ms;        // total milliseconds spent in the callback
+    unsigned max_ms;          // longest single execution in milliseconds
+    unsigned max_lateness_ms; // worst delay from target time to dispatch
+} equeue_profile_t;
+
+size_t equeue_profile(equeue_t *queue, equeue_profile_t *profile, size_t count);
+
 // Configure an allocated event
 //
-// equeue_event_delay  - Millisecond delay before dispatching an event
-// equeue_event_period - Millisecond period for repeating dispatching an event
-// equeue_event_dtor   - Destructor to run when the event is deallocated
+// equeue_event_delay    - Millisecond delay before dispatching an event
+// equeue_event_period   - Millisecond period for repeating dispatching an event
+// equeue_event_dtor     - Destructor to run when the event is deallocated
+// equeue_event_priority - Priority band, 0 (the default) to
+//                         EQUEUE_NUM_PRIORITIES-1; out-of-range values are
+//                         clamped. When several events are due in the same
+//                         dispatch pass, higher bands are drained first, so
+//                         latency-critical events are not queued behind bulk
+//                         work. Order within a band remains FIFO.
 void equeue_event_delay(void *event, int ms);
 void equeue_event_period(void *event, int ms);
 void equeue_event_dtor(void *event, void (*dtor)(void *));
+void equeue_event_priority(void *event, int priority);
 
 // Post an event onto the event queue
 //
@@ -181,6 +318,13 @@ void equeue_event_dtor(void *event, void (*dtor)(void *));
 // be passed to equeue_cancel.
 int equeue_post(equeue_t *queue, void (*cb)(void *), void *event);
 
+// Post an event through a coalescing id slot
+//
+// Like equeue_post, but first cancels any event previously posted through
+// the same caller-owned id slot, as described for equeue_call_coalesced.
+// The new event's id is stored in the slot and returned.
+int equeue_post_coalesced(equeue_t *queue, int *id, void (*cb)(void *), void *event);
+
 // Post an user allocated event onto the event queue
 //
 // The equeue_post_user_allocated function takes a callback and a pointer
@@ -192,6 +336,43 @@ int equeue_post(equeue_t *queue, void (*cb)(void *), void *event);
 // a mechanism for moving events out of irq contexts.
 void equeue_post_user_allocated(equeue_t *queue, void (*cb)(void *), void *event);
 
+// Set up a lock-free posting lane for interrupt producers
+//
+// Preallocates a pool of count events, each able to carry a payload of up
+// to size bytes, for use with equeue_alloc_isr and equeue_post_isr. Unlike
+// the main allocator and queue, which briefly mask interrupts on mbed, the
+// lane claims and posts events with atomic operations only, so high-rate
+// interrupt producers do not add to interrupt-masked time.
+//
+// The lane must be set up before the queue is used concurrently; setting
+// it up is not itself irq safe. Returns a negative error code if the pool
+// cannot be allocated.
+int equeue_isr_lane_create(equeue_t *queue, size_t count, size_t size);
+
+// Allocate an event from the lock-free posting lane
+//
+// Claims a slot from the pool set up by equeue_isr_lane_create without
+// taking any lock. Returns null if the requested size exceeds the lane's
+// slot size or all slots are in flight; callers in thread context may fall
+// back to equeue_alloc, interrupt callers should treat this as the event
+// being shed. Events allocated here are configured with equeue_event_period
+// and equeue_event_dtor as usual and may be released with equeue_dealloc if
+// never posted.
+void *equeue_alloc_isr(equeue_t *queue, size_t size);
+
+// Post an event from the lock-free posting lane onto the event queue
+//
+// Takes a callback and an event allocated by equeue_alloc_isr and pushes it
+// onto the queue with a single atomic exchange - no lock is taken in the
+// caller's context. The dispatch loop drains all lane events in one batch
+// before collecting expired events, so per-event overhead amortizes across
+// bursts.
+//
+// Lane events are dispatched at the next dispatch wakeup - delays set with
+// equeue_event_delay are ignored, and lane events cannot be cancelled.
+// Their slot returns to the pool when the event is deallocated.
+void equeue_post_isr(equeue_t *queue, void (*cb)(void *), void *event);
+
 // Cancel an in-flight event
 //
 // Attempts to cancel an event referenced by the unique id returned from
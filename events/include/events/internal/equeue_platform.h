@@ -97,6 +97,16 @@ void equeue_mutex_lock(equeue_mutex_t *mutex);
 void equeue_mutex_unlock(equeue_mutex_t *mutex);
 
 
+// Platform atomic operations
+//
+// The equeue_atomic_cas_ptr performs a single-word compare-and-swap: if
+// *ptr equals *expected, *ptr is set to desired and true is returned,
+// otherwise *expected is updated to the observed value and false is
+// returned. It must be safe in interrupt contexts and must not itself
+// mask interrupts. It is used by the lock-free interrupt posting lane.
+bool equeue_atomic_cas_ptr(void *volatile *ptr, void **expected, void *desired);
+
+
 // Platform semaphore type
 //
 // The equeue library requires a binary semaphore type that can be safely
@@ -126,7 +136,7 @@ typedef struct equeue_sema {
 #endif
 } equeue_sema_t;
 #elif defined(EQUEUE_PLATFORM_MBED)
-typedef int equeue_sema_t;
+typedef bool equeue_sema_t;
 #endif
 
 // Platform semaphore operations
@@ -85,6 +85,33 @@ events::EventQueue *mbed_highprio_event_queue();
 
 #endif // MBED_CONF_RTOS_PRESENT
 
+/**
+ * Return a pointer to the EventQueue dispatching deferred second-stage
+ * interrupt handlers (see events::BottomHalf).
+ *
+ * All calls to this return the same EventQueue - it and its thread are
+ * created on the first call to this function. The dispatch thread runs
+ * above both shared queues (currently osPriorityRealtime), so bottom
+ * halves are delayed only by interrupts and other bottom halves, never by
+ * ordinary threads or shared-queue events.
+ *
+ * Work on this queue must be brief - tens of microseconds - as it starves
+ * every thread in the system, including the high-priority shared queue.
+ * Anything longer belongs on mbed_highprio_event_queue().
+ *
+ * Without an RTOS this returns mbed_event_queue(), and bottom halves run
+ * wherever the application dispatches that queue.
+ *
+ * @note
+ * mbed_bottom_half_queue is not itself IRQ safe. To use it in interrupt
+ * context, you must first call `mbed_bottom_half_queue()` in threaded
+ * context and store the pointer for later use - constructing an
+ * events::BottomHalf does this for you.
+ *
+ * @return pointer to the bottom-half dispatch queue
+ */
+events::EventQueue *mbed_bottom_half_queue();
+
 /** @}*/
 
 }
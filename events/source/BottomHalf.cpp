@@ -0,0 +1,116 @@
+/* events
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "events/BottomHalf.h"
+#include "events/mbed_shared_queues.h"
+#include "platform/mbed_atomic.h"
+
+#include "cmsis.h"
+
+namespace events {
+
+#if defined(DWT) && defined(DWT_CTRL_CYCCNTENA_Msk)
+static uint32_t bh_cycles(void)
+{
+    static uint8_t started;
+    if (!started) {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+        started = 1;
+    }
+    return DWT->CYCCNT;
+}
+#else
+static uint32_t bh_cycles(void)
+{
+    return 0;
+}
+#endif
+
+BottomHalf::BottomHalf(mbed::Callback<void()> handler)
+    : _handler(handler),
+      _queue(mbed::mbed_bottom_half_queue()),
+      _pending(0), _failures(0),
+      _run_count(0), _total_cycles(0), _max_cycles(0)
+{
+}
+
+BottomHalf::BottomHalf(mbed::Callback<void()> handler, EventQueue *queue)
+    : _handler(handler), _queue(queue),
+      _pending(0), _failures(0),
+      _run_count(0), _total_cycles(0), _max_cycles(0)
+{
+}
+
+bool BottomHalf::schedule()
+{
+    if (core_util_atomic_exchange_u8(&_pending, 1)) {
+        // Already pending - the run about to happen covers this request
+        return true;
+    }
+    if (!_queue->call(mbed::callback(this, &BottomHalf::dispatch))) {
+        core_util_atomic_store_u8(&_pending, 0);
+        core_util_atomic_incr_u32(&_failures, 1);
+        return false;
+    }
+    return true;
+}
+
+bool BottomHalf::pending() const
+{
+    return core_util_atomic_load_u8(&_pending);
+}
+
+uint32_t BottomHalf::run_count() const
+{
+    return core_util_atomic_load_u32(&_run_count);
+}
+
+uint32_t BottomHalf::total_cycles() const
+{
+    return core_util_atomic_load_u32(&_total_cycles);
+}
+
+uint32_t BottomHalf::max_cycles() const
+{
+    return core_util_atomic_load_u32(&_max_cycles);
+}
+
+uint32_t BottomHalf::schedule_failures() const
+{
+    return core_util_atomic_load_u32(&_failures);
+}
+
+void BottomHalf::dispatch()
+{
+    // Clear before running, so an interrupt arriving while the handler
+    // executes schedules a fresh run rather than being lost
+    core_util_atomic_store_u8(&_pending, 0);
+
+    uint32_t start = bh_cycles();
+    _handler();
+    uint32_t elapsed = bh_cycles() - start;
+
+    core_util_atomic_store_u32(&_run_count, _run_count + 1);
+    core_util_atomic_store_u32(&_total_cycles, _total_cycles + elapsed);
+    if (elapsed > _max_cycles) {
+        core_util_atomic_store_u32(&_max_cycles, elapsed);
+    }
+}
+
+}
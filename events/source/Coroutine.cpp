@@ -0,0 +1,138 @@
+/* events
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "events/Coroutine.h"
+#include "platform/mbed_atomic.h"
+#include "platform/mbed_critical.h"
+
+namespace events {
+
+void Coroutine::Signal::set()
+{
+    Coroutine *waiter;
+    core_util_critical_section_enter();
+    _set = 1;
+    waiter = _waiter;
+    _waiter = nullptr;
+    core_util_critical_section_exit();
+    if (waiter) {
+        waiter->wake();
+    }
+}
+
+Coroutine::Coroutine(EventQueue *queue)
+    : _queue(queue), _line(0), _pending(0),
+      _started(false), _finished(false), _failed(false)
+{
+}
+
+void Coroutine::start()
+{
+    _line = 0;
+    _started = true;
+    _finished = false;
+    _failed = false;
+    wake();
+}
+
+bool Coroutine::wake()
+{
+    if (!_started || _finished || _failed) {
+        return false;
+    }
+    if (core_util_atomic_exchange_u8(&_pending, 1)) {
+        // Already pending - the resume about to happen covers this wakeup
+        return true;
+    }
+    if (!_queue->call(this, &Coroutine::run)) {
+        core_util_atomic_store_u8(&_pending, 0);
+        _failed = true;
+        return false;
+    }
+    return true;
+}
+
+bool Coroutine::finished() const
+{
+    return _finished;
+}
+
+bool Coroutine::failed() const
+{
+    return _failed;
+}
+
+void Coroutine::run()
+{
+    // Clear before stepping so a wakeup arriving mid-step queues another
+    // resume rather than being lost
+    core_util_atomic_store_u8(&_pending, 0);
+    if (!_finished && !_failed) {
+        step();
+    }
+}
+
+void Coroutine::coro_sleep(EventQueue::duration rel_time)
+{
+    // Resume directly from the timer; wakeups during the sleep are
+    // absorbed by the pending flag so the resume point runs exactly once
+    core_util_atomic_store_u8(&_pending, 1);
+    if (!_queue->call_in(rel_time, this, &Coroutine::run)) {
+        core_util_atomic_store_u8(&_pending, 0);
+        _failed = true;
+    }
+}
+
+bool Coroutine::coro_await(Signal &sig)
+{
+    bool taken;
+    core_util_critical_section_enter();
+    if (sig._set) {
+        sig._set = 0;
+        sig._waiter = nullptr;
+        taken = true;
+    } else {
+        sig._waiter = this;
+        taken = false;
+    }
+    core_util_critical_section_exit();
+    return taken;
+}
+
+bool Coroutine::coro_await_flags(rtos::EventFlags &flags, uint32_t mask)
+{
+    uint32_t value = flags.wait_any_for(mask, rtos::Kernel::Clock::duration_u32(0));
+    if (!(value & osFlagsError)) {
+        return true;
+    }
+    // EventFlags has no wakeup callback, so re-check on a poll tick
+    core_util_atomic_store_u8(&_pending, 1);
+    if (!_queue->call_in(
+                std::chrono::milliseconds(MBED_CONF_EVENTS_COROUTINE_FLAGS_POLL_PERIOD),
+                this, &Coroutine::run)) {
+        core_util_atomic_store_u8(&_pending, 0);
+        _failed = true;
+    }
+    return false;
+}
+
+void Coroutine::coro_finish()
+{
+    _finished = true;
+}
+
+}
@@ -0,0 +1,132 @@
+/* events
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "events/CrossCoreQueue.h"
+#include "platform/mbed_assert.h"
+#include "platform/mbed_atomic.h"
+
+#include "cmsis.h"
+
+namespace events {
+
+CrossCoreQueue::CrossCoreQueue(CrossCoreChannel *tx, CrossCoreChannel *rx, EventQueue *queue)
+    : _tx(tx), _rx(rx), _queue(queue), _notify(),
+      _handlers(), _dropped(0), _unbound(0)
+{
+}
+
+void CrossCoreQueue::channel_init(CrossCoreChannel *channel)
+{
+    memset(channel, 0, sizeof(*channel));
+}
+
+void CrossCoreQueue::attach_notify(mbed::Callback<void()> notify)
+{
+    _notify = notify;
+}
+
+void CrossCoreQueue::bind(int id, handler_t handler)
+{
+    MBED_ASSERT(id >= 0 && id < MAX_HANDLERS);
+    _handlers[id] = handler;
+}
+
+bool CrossCoreQueue::post_raw(int id, const void *payload, size_t size)
+{
+    MBED_ASSERT(id >= 0 && id < MAX_HANDLERS);
+    MBED_ASSERT(size <= MBED_CONF_EVENTS_CROSS_CORE_PAYLOAD);
+    MBED_ASSERT(_tx);
+
+    // Free-running indices; only this core writes head, only the
+    // consumer writes tail, so a full ring is just a distance check
+    uint32_t head = _tx->head;
+    if (head - core_util_atomic_load_u32(&_tx->tail) >= MBED_CONF_EVENTS_CROSS_CORE_SLOTS) {
+        _dropped++;
+        return false;
+    }
+
+    auto &slot = _tx->slots[head % MBED_CONF_EVENTS_CROSS_CORE_SLOTS];
+    slot.id = (uint8_t)id;
+    slot.size = (uint8_t)size;
+    if (size) {
+        memcpy(slot.payload, payload, size);
+    }
+    // The store to head publishes the slot - the atomic store orders it
+    // after the payload writes, on this core and as seen by the other
+    core_util_atomic_store_u32(&_tx->head, head + 1);
+
+    if (_notify) {
+        _notify();
+    } else {
+#ifdef __SEV
+        // Fallback doorbell: only wakes a core sitting in WFE
+        __SEV();
+#endif
+    }
+    return true;
+}
+
+void CrossCoreQueue::deliver(Envelope envelope)
+{
+    envelope.handler(envelope.payload, envelope.size);
+}
+
+int CrossCoreQueue::process()
+{
+    MBED_ASSERT(_rx);
+
+    int drained = 0;
+    uint32_t tail = _rx->tail;
+    while (tail != core_util_atomic_load_u32(&_rx->head)) {
+        const auto &slot = _rx->slots[tail % MBED_CONF_EVENTS_CROSS_CORE_SLOTS];
+
+        Envelope envelope;
+        envelope.handler = _handlers[slot.id];
+        envelope.size = slot.size;
+        if (slot.size) {
+            memcpy(envelope.payload, slot.payload, slot.size);
+        }
+        // Copied out - release the slot before running the handler so
+        // the producer regains capacity even if the handler is slow
+        tail++;
+        core_util_atomic_store_u32(&_rx->tail, tail);
+        drained++;
+
+        if (!envelope.handler) {
+            _unbound++;
+            continue;
+        }
+        if (!_queue || !_queue->call(&CrossCoreQueue::deliver, envelope)) {
+            // No local queue, or it is out of memory: run in place
+            // rather than lose work that already crossed the cores
+            deliver(envelope);
+        }
+    }
+    return drained;
+}
+
+uint32_t CrossCoreQueue::dropped() const
+{
+    return _dropped;
+}
+
+uint32_t CrossCoreQueue::unbound() const
+{
+    return _unbound;
+}
+
+}
@@ -0,0 +1,142 @@
+/* events
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "events/PeriodicTask.h"
+#include <errno.h>
+#include <string.h>
+
+namespace events {
+
+PeriodicTask::PeriodicTask(EventQueue *queue, mbed::Callback<void()> task,
+                           EventQueue::duration period)
+    : _queue(queue), _task(task), _period_ms(period.count()),
+      _policy(CATCHUP_RUN), _t0(0), _n(0), _id(0)
+{
+    memset(&_stats, 0, sizeof(_stats));
+}
+
+PeriodicTask::~PeriodicTask()
+{
+    stop();
+}
+
+int PeriodicTask::schedule(int32_t delay_ms)
+{
+    _id = _queue->call_in(EventQueue::duration(delay_ms), this, &PeriodicTask::run);
+    if (!_id) {
+        return -ENOMEM;
+    }
+    return 0;
+}
+
+int PeriodicTask::start()
+{
+    if (_id) {
+        return -EINVAL;
+    }
+
+    _t0 = _queue->tick();
+    _n = 1;
+    return schedule(_period_ms);
+}
+
+void PeriodicTask::stop()
+{
+    if (_id) {
+        _queue->cancel(_id);
+        _id = 0;
+    }
+}
+
+bool PeriodicTask::running() const
+{
+    return _id != 0;
+}
+
+void PeriodicTask::set_catchup_policy(catchup_policy_t policy)
+{
+    _policy = policy;
+}
+
+void PeriodicTask::set_overrun_callback(mbed::Callback<void(int32_t)> callback)
+{
+    _overrun = callback;
+}
+
+PeriodicTask::jitter_stats_t PeriodicTask::jitter() const
+{
+    return _stats;
+}
+
+void PeriodicTask::reset_jitter()
+{
+    memset(&_stats, 0, sizeof(_stats));
+}
+
+void PeriodicTask::run()
+{
+    // Deadlines are absolute multiples of the period from t0, so a late
+    // run never pushes the runs after it. Tick arithmetic is done on
+    // unsigned differences to survive the counter wrapping
+    unsigned deadline = _t0 + _n * _period_ms;
+    int32_t late = (int32_t)(_queue->tick() - deadline);
+
+    _stats.count++;
+    _stats.last_ms = late;
+    if (late > _stats.max_ms) {
+        _stats.max_ms = late;
+    }
+    _stats.total_ms += late;
+
+    bool overrun = late > (int32_t) _period_ms;
+    if (overrun) {
+        _stats.overruns++;
+        if (_overrun) {
+            _overrun(late);
+        }
+    }
+
+    _task();
+
+    if (!_id) {
+        // The task stopped itself
+        return;
+    }
+
+    _n++;
+    if (overrun && (_policy == CATCHUP_SKIP)) {
+        // Jump to the first grid point still in the future
+        int32_t behind = (int32_t)(_queue->tick() - (_t0 + _n * _period_ms));
+        if (behind > 0) {
+            _n += behind / _period_ms + 1;
+        }
+    }
+
+    int32_t delay = -(int32_t)(_queue->tick() - (_t0 + _n * _period_ms));
+    if (delay < 0) {
+        // Behind the grid - run again as soon as the queue allows
+        delay = 0;
+    }
+    _id = 0;
+    if (schedule(delay)) {
+        // Queue exhausted - the task stops rather than silently losing
+        // its grid; running() exposes this to the application
+        _id = 0;
+    }
+}
+
+} // namespace events
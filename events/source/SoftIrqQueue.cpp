@@ -0,0 +1,216 @@
+/* events
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "events/SoftIrqQueue.h"
+#include "platform/mbed_atomic.h"
+#include "platform/mbed_critical.h"
+#include "platform/mbed_error.h"
+#include <errno.h>
+
+#include "cmsis.h"
+
+namespace events {
+
+#if defined(DWT) && defined(DWT_CTRL_CYCCNTENA_Msk)
+static uint32_t si_cycles(void)
+{
+    static uint8_t started;
+    if (!started) {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+        started = 1;
+    }
+    return DWT->CYCCNT;
+}
+#else
+static uint32_t si_cycles(void)
+{
+    return 0;
+}
+#endif
+
+// Queues bound to interrupt lines. The shared vector resolves the
+// active line from IPSR, so one trampoline serves them all
+static const int max_bound_queues = 4;
+static SoftIrqQueue *bound_queues[max_bound_queues];
+static int bound_irqs[max_bound_queues];
+
+SoftIrqQueue::SoftIrqQueue(int irq, uint32_t priority)
+    : _irq(irq), _priority(priority), _head(0), _tail(0), _dispatching(false),
+      _run_count(0), _max_cycles(0), _overruns(0), _failures(0)
+{
+}
+
+SoftIrqQueue::~SoftIrqQueue()
+{
+    core_util_critical_section_enter();
+    for (int i = 0; i < max_bound_queues; i++) {
+        if (bound_queues[i] == this) {
+#if defined(__CORTEX_M)
+            NVIC_DisableIRQ((IRQn_Type) _irq);
+#endif
+            bound_queues[i] = nullptr;
+        }
+    }
+    core_util_critical_section_exit();
+}
+
+int SoftIrqQueue::init()
+{
+    core_util_critical_section_enter();
+    int slot = -1;
+    for (int i = 0; i < max_bound_queues; i++) {
+        if (bound_queues[i] == this) {
+            core_util_critical_section_exit();
+            return -EINVAL;
+        }
+        if (bound_queues[i] && (bound_irqs[i] == _irq)) {
+            // Line already serving another queue
+            core_util_critical_section_exit();
+            return -EADDRINUSE;
+        }
+        if (!bound_queues[i] && (slot < 0)) {
+            slot = i;
+        }
+    }
+    if (slot < 0) {
+        core_util_critical_section_exit();
+        return -ENOMEM;
+    }
+    bound_irqs[slot] = _irq;
+    bound_queues[slot] = this;
+    core_util_critical_section_exit();
+
+#if defined(__CORTEX_M)
+    NVIC_SetVector((IRQn_Type) _irq, (uint32_t) &SoftIrqQueue::irq_entry);
+    NVIC_SetPriority((IRQn_Type) _irq, _priority);
+    NVIC_ClearPendingIRQ((IRQn_Type) _irq);
+    NVIC_EnableIRQ((IRQn_Type) _irq);
+#endif
+    return 0;
+}
+
+void SoftIrqQueue::irq_entry()
+{
+#if defined(__CORTEX_M)
+    int irq = (int)(__get_IPSR() & 0x1ff) - 16;
+    for (int i = 0; i < max_bound_queues; i++) {
+        if (bound_queues[i] && (bound_irqs[i] == irq)) {
+            bound_queues[i]->dispatch();
+            return;
+        }
+    }
+#endif
+}
+
+void SoftIrqQueue::pend()
+{
+#if defined(__CORTEX_M)
+    NVIC_SetPendingIRQ((IRQn_Type) _irq);
+#else
+    // No NVIC to take the work - run it here, unless a dispatch is
+    // already active above us on the stack, which will drain it
+    core_util_critical_section_enter();
+    bool active = _dispatching;
+    _dispatching = true;
+    core_util_critical_section_exit();
+    if (!active) {
+        dispatch();
+    }
+#endif
+}
+
+bool SoftIrqQueue::post(mbed::Callback<void()> handler, uint32_t budget)
+{
+    core_util_critical_section_enter();
+    if (_head - _tail >= MBED_CONF_EVENTS_SOFTIRQ_SLOTS) {
+        _failures++;
+        core_util_critical_section_exit();
+        return false;
+    }
+    entry_t &e = _slots[_head % MBED_CONF_EVENTS_SOFTIRQ_SLOTS];
+    e.handler = handler;
+    e.budget = budget ? budget : MBED_CONF_EVENTS_SOFTIRQ_DEFAULT_BUDGET;
+    _head++;
+    core_util_critical_section_exit();
+
+    pend();
+    return true;
+}
+
+void SoftIrqQueue::set_overrun_callback(mbed::Callback<void(uint32_t, uint32_t)> callback)
+{
+    _overrun = callback;
+}
+
+void SoftIrqQueue::dispatch()
+{
+    while (true) {
+        core_util_critical_section_enter();
+        if (_tail == _head) {
+            _dispatching = false;
+            core_util_critical_section_exit();
+            return;
+        }
+        entry_t entry = _slots[_tail % MBED_CONF_EVENTS_SOFTIRQ_SLOTS];
+        _slots[_tail % MBED_CONF_EVENTS_SOFTIRQ_SLOTS].handler = nullptr;
+        _tail++;
+        core_util_critical_section_exit();
+
+        uint32_t start = si_cycles();
+        entry.handler();
+        uint32_t elapsed = si_cycles() - start;
+
+        _run_count++;
+        if (elapsed > _max_cycles) {
+            _max_cycles = elapsed;
+        }
+        if (entry.budget && (elapsed > entry.budget)) {
+            _overruns++;
+            if (_overrun) {
+                _overrun(elapsed, entry.budget);
+            }
+#if MBED_CONF_EVENTS_SOFTIRQ_TRAP_OVERRUN
+            MBED_ERROR(MBED_MAKE_ERROR(MBED_MODULE_PLATFORM, MBED_ERROR_CODE_TIME_OUT),
+                       "softirq handler exceeded its cycle budget");
+#endif
+        }
+    }
+}
+
+uint32_t SoftIrqQueue::run_count() const
+{
+    return core_util_atomic_load_u32(&_run_count);
+}
+
+uint32_t SoftIrqQueue::max_cycles() const
+{
+    return core_util_atomic_load_u32(&_max_cycles);
+}
+
+uint32_t SoftIrqQueue::overruns() const
+{
+    return core_util_atomic_load_u32(&_overruns);
+}
+
+uint32_t SoftIrqQueue::post_failures() const
+{
+    return core_util_atomic_load_u32(&_failures);
+}
+
+} // namespace events
@@ -92,19 +92,40 @@ int equeue_create_inplace(equeue_t *q, size_t size, void *buffer)
     }
 
     q->chunks = 0;
+    memset(q->classes, 0, sizeof(q->classes));
     q->slab.size = size;
     q->slab.data = q->buffer;
 
+#ifdef EQUEUE_ALLOC_STATS
+    memset(q->alloc_counters, 0, sizeof(q->alloc_counters));
+#endif
+#ifdef EQUEUE_PROFILE
+    memset(q->profile_counters, 0, sizeof(q->profile_counters));
+#endif
+
     q->queue = 0;
     equeue_tick_init();
     q->tick = equeue_tick();
     q->generation = 0;
     q->break_requested = false;
 
+#ifdef EQUEUE_TIMING_WHEEL
+    memset(q->wheel.slots, 0, sizeof(q->wheel.slots));
+    q->wheel.due = 0;
+    q->wheel.due_tail = &q->wheel.due;
+    q->wheel.tick = q->tick;
+#endif
+
     q->background.active = false;
     q->background.update = 0;
     q->background.timer = 0;
 
+    q->isr_lane.slots = 0;
+    q->isr_lane.slot_size = 0;
+    q->isr_lane.count = 0;
+    q->isr_lane.hint = 0;
+    q->isr_lane.incoming = 0;
+
     // initialize platform resources
     int err;
     err = equeue_sema_create(&q->eventsema);
@@ -128,6 +149,22 @@ int equeue_create_inplace(equeue_t *q, size_t size, void *buffer)
 void equeue_destroy(equeue_t *q)
 {
     // call destructors on pending events
+#ifdef EQUEUE_TIMING_WHEEL
+    for (struct equeue_event *e = q->wheel.due; e; e = e->next) {
+        if (e->dtor) {
+            e->dtor(e + 1);
+        }
+    }
+    for (int level = 0; level < EQUEUE_WHEEL_LEVELS; level++) {
+        for (int i = 0; i < EQUEUE_WHEEL_SLOTS; i++) {
+            for (struct equeue_event *e = q->wheel.slots[level][i]; e; e = e->next) {
+                if (e->dtor) {
+                    e->dtor(e + 1);
+                }
+            }
+        }
+    }
+#else
     for (struct equeue_event *es = q->queue; es; es = es->next) {
         for (struct equeue_event *e = es->sibling; e; e = e->sibling) {
             if (e->dtor) {
@@ -138,6 +175,13 @@ void equeue_destroy(equeue_t *q)
             es->dtor(es + 1);
         }
     }
+#endif
+    // call destructors on lane events posted but not yet drained
+    for (struct equeue_event *e = q->isr_lane.incoming; e; e = e->next) {
+        if (e->dtor) {
+            e->dtor(e + 1);
+        }
+    }
     // notify background timer
     if (q->background.update) {
         q->background.update(q->background.timer, -1);
@@ -147,20 +191,63 @@ void equeue_destroy(equeue_t *q)
     equeue_mutex_destroy(&q->memlock);
     equeue_mutex_destroy(&q->queuelock);
     equeue_sema_destroy(&q->eventsema);
+    free(q->isr_lane.slots);
     free(q->allocated);
 }
 
 
 // equeue chunk allocation functions
+
+// map a rounded event size to its exact-fit size class, or
+// EQUEUE_NUM_SIZE_CLASSES for sizes beyond the largest class
+static inline size_t equeue_size_class(size_t size)
+{
+    size_t klass = (size - sizeof(struct equeue_event)) / sizeof(void *);
+    return klass < EQUEUE_NUM_SIZE_CLASSES ? klass : EQUEUE_NUM_SIZE_CLASSES;
+}
+
+// account for an allocation result; must be called with memlock held
+static inline void equeue_mem_account(equeue_t *q, size_t klass, struct equeue_event *e)
+{
+#ifdef EQUEUE_ALLOC_STATS
+    if (!e) {
+        q->alloc_counters[klass].failures += 1;
+        return;
+    }
+    struct equeue_alloc_counters *c = &q->alloc_counters[equeue_size_class(e->size)];
+    c->live += 1;
+    if (c->live > c->hwm) {
+        c->hwm = c->live;
+    }
+#else
+    (void)q;
+    (void)klass;
+    (void)e;
+#endif
+}
+
 static struct equeue_event *equeue_mem_alloc(equeue_t *q, size_t size)
 {
     // add event overhead
     size += sizeof(struct equeue_event);
     size = (size + sizeof(void *) -1) & ~(sizeof(void *) -1);
+    size_t klass = equeue_size_class(size);
 
     equeue_mutex_lock(&q->memlock);
 
-    // check if a good chunk is available
+    // an exact-fit size class is a single pop
+    for (size_t k = klass; k < EQUEUE_NUM_SIZE_CLASSES; k++) {
+        if (q->classes[k]) {
+            struct equeue_event *e = q->classes[k];
+            q->classes[k] = e->next;
+
+            equeue_mem_account(q, klass, e);
+            equeue_mutex_unlock(&q->memlock);
+            return e;
+        }
+    }
+
+    // check if a good oversized chunk is available
     for (struct equeue_event **p = &q->chunks; *p; p = &(*p)->next) {
         if ((*p)->size >= size) {
             struct equeue_event *e = *p;
@@ -171,6 +258,7 @@ static struct equeue_event *equeue_mem_alloc(equeue_t *q, size_t size)
                 *p = e->next;
             }
 
+            equeue_mem_account(q, klass, e);
             equeue_mutex_unlock(&q->memlock);
             return e;
         }
@@ -184,19 +272,36 @@ static struct equeue_event *equeue_mem_alloc(equeue_t *q, size_t size)
         e->size = size;
         e->id = 1;
 
+        equeue_mem_account(q, klass, e);
         equeue_mutex_unlock(&q->memlock);
         return e;
     }
 
+    equeue_mem_account(q, klass, 0);
     equeue_mutex_unlock(&q->memlock);
     return 0;
 }
 
 static void equeue_mem_dealloc(equeue_t *q, struct equeue_event *e)
 {
+    size_t klass = equeue_size_class(e->size);
+
     equeue_mutex_lock(&q->memlock);
 
-    // stick chunk into list of chunks
+#ifdef EQUEUE_ALLOC_STATS
+    q->alloc_counters[klass].live -= 1;
+#endif
+
+    // events with a size class go on their class's free list
+    if (klass < EQUEUE_NUM_SIZE_CLASSES) {
+        e->next = q->classes[klass];
+        q->classes[klass] = e;
+
+        equeue_mutex_unlock(&q->memlock);
+        return;
+    }
+
+    // stick oversized chunks into the sorted list of chunks
     struct equeue_event **p = &q->chunks;
     while (*p && (*p)->size < e->size) {
         p = &(*p)->next;
@@ -214,6 +319,177 @@ static void equeue_mem_dealloc(equeue_t *q, struct equeue_event *e)
     equeue_mutex_unlock(&q->memlock);
 }
 
+size_t equeue_alloc_stats(equeue_t *q, equeue_alloc_stats_t *stats, size_t count)
+{
+#ifdef EQUEUE_ALLOC_STATS
+    if (count > EQUEUE_NUM_SIZE_CLASSES + 1) {
+        count = EQUEUE_NUM_SIZE_CLASSES + 1;
+    }
+
+    equeue_mutex_lock(&q->memlock);
+    for (size_t i = 0; i < count; i++) {
+        stats[i].size = i < EQUEUE_NUM_SIZE_CLASSES ?
+                        sizeof(struct equeue_event) + i * sizeof(void *) : 0;
+        stats[i].live = q->alloc_counters[i].live;
+        stats[i].hwm = q->alloc_counters[i].hwm;
+        stats[i].failures = q->alloc_counters[i].failures;
+    }
+    equeue_mutex_unlock(&q->memlock);
+    return count;
+#else
+    (void)q;
+    (void)stats;
+    (void)count;
+    return 0;
+#endif
+}
+
+// simple callback wrapper, dispatched by the simple call functions below
+struct ecallback {
+    void (*cb)(void *);
+    void *data;
+};
+
+static void ecallback_dispatch(void *p);
+
+#ifdef EQUEUE_PROFILE
+// the profiler looks through the simple callback wrapper so equeue_call
+// posts are attributed to the user's callback rather than the shared wrapper
+static void (*equeue_profile_key(struct equeue_event *e))(void *)
+{
+    if (e->cb == ecallback_dispatch) {
+        return ((struct ecallback *)(e + 1))->cb;
+    }
+    return e->cb;
+}
+
+static void equeue_profile_account(equeue_t *q, void (*cb)(void *),
+                                   unsigned lateness, unsigned duration)
+{
+    equeue_mutex_lock(&q->queuelock);
+    size_t i;
+    for (i = 0; i < EQUEUE_PROFILE_SLOTS; i++) {
+        // slots fill front to back, so the first empty slot means the
+        // callback has not been seen before
+        if (q->profile_counters[i].cb == cb || !q->profile_counters[i].cb) {
+            break;
+        }
+    }
+
+    if (i < EQUEUE_PROFILE_SLOTS) {
+        struct equeue_profile_counters *c = &q->profile_counters[i];
+        c->cb = cb;
+        c->count += 1;
+        c->total_ms += duration;
+        if (duration > c->max_ms) {
+            c->max_ms = duration;
+        }
+        if (lateness > c->max_lateness_ms) {
+            c->max_lateness_ms = lateness;
+        }
+    }
+    equeue_mutex_unlock(&q->queuelock);
+}
+#endif
+
+size_t equeue_profile(equeue_t *q, equeue_profile_t *profile, size_t count)
+{
+#ifdef EQUEUE_PROFILE
+    equeue_mutex_lock(&q->queuelock);
+    size_t i;
+    for (i = 0; i < count && i < EQUEUE_PROFILE_SLOTS; i++) {
+        if (!q->profile_counters[i].cb) {
+            break;
+        }
+        profile[i].cb = q->profile_counters[i].cb;
+        profile[i].count = q->profile_counters[i].count;
+        profile[i].total_ms = q->profile_counters[i].total_ms;
+        profile[i].max_ms = q->profile_counters[i].max_ms;
+        profile[i].max_lateness_ms = q->profile_counters[i].max_lateness_ms;
+    }
+    equeue_mutex_unlock(&q->queuelock);
+    return i;
+#else
+    (void)q;
+    (void)profile;
+    (void)count;
+    return 0;
+#endif
+}
+
+// lock-free posting lane functions
+//
+// Each lane slot is a claim word followed by an event and its payload. The
+// claim word is compare-and-swapped from null to the owning queue when the
+// slot is taken and back to null when the event is deallocated, so neither
+// direction takes memlock or masks interrupts.
+#define EQUEUE_ISR_LANE_CLAIM(e) ((void *volatile *)((unsigned char *)(e) - sizeof(void *)))
+
+static bool equeue_isr_lane_contains(equeue_t *q, struct equeue_event *e)
+{
+    unsigned char *slot = (unsigned char *)e - sizeof(void *);
+    return q->isr_lane.slots && slot >= q->isr_lane.slots &&
+           slot < q->isr_lane.slots + q->isr_lane.count * q->isr_lane.slot_size;
+}
+
+int equeue_isr_lane_create(equeue_t *q, size_t count, size_t size)
+{
+    // add event overhead and the claim word
+    size += sizeof(struct equeue_event);
+    size = (size + sizeof(void *) - 1) & ~(sizeof(void *) - 1);
+    size += sizeof(void *);
+
+    unsigned char *slots = malloc(count * size);
+    if (!slots) {
+        return -1;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        *(void **)(slots + i * size) = 0;
+    }
+
+    q->isr_lane.slot_size = size;
+    q->isr_lane.count = count;
+    q->isr_lane.hint = 0;
+    q->isr_lane.incoming = 0;
+    q->isr_lane.slots = slots;
+    return 0;
+}
+
+void *equeue_alloc_isr(equeue_t *q, size_t size)
+{
+    struct equeue_isr_lane *lane = &q->isr_lane;
+    if (!lane->slots ||
+            size + sizeof(struct equeue_event) + sizeof(void *) > lane->slot_size) {
+        return 0;
+    }
+
+    // claim a free slot, starting from a rotating hint to shorten the scan
+    size_t start = lane->hint;
+    for (size_t i = 0; i < lane->count; i++) {
+        size_t slot = start + i < lane->count ? start + i : start + i - lane->count;
+        void *volatile *claim = (void *volatile *)(lane->slots + slot * lane->slot_size);
+        void *expected = 0;
+        if (equeue_atomic_cas_ptr(claim, &expected, q)) {
+            lane->hint = slot + 1 < lane->count ? slot + 1 : 0;
+            struct equeue_event *e = (struct equeue_event *)(claim + 1);
+            e->target = 0;
+            e->period = -1;
+            e->dtor = 0;
+            e->priority = 0;
+            return e + 1;
+        }
+    }
+
+    return 0;
+}
+
+static void equeue_isr_lane_release(equeue_t *q, struct equeue_event *e)
+{
+    void *expected = q;
+    equeue_atomic_cas_ptr(EQUEUE_ISR_LANE_CLAIM(e), &expected, 0);
+}
+
 void *equeue_alloc(equeue_t *q, size_t size)
 {
     struct equeue_event *e = equeue_mem_alloc(q, size);
@@ -224,6 +500,7 @@ void *equeue_alloc(equeue_t *q, size_t size)
     e->target = 0;
     e->period = -1;
     e->dtor = 0;
+    e->priority = 0;
 
     return e + 1;
 }
@@ -236,13 +513,163 @@ void equeue_dealloc(equeue_t *q, void *p)
         e->dtor(e + 1);
     }
 
-    if (EQUEUE_IS_USER_ALLOCATED_EVENT(e)) {
+    if (equeue_isr_lane_contains(q, e)) {
+        equeue_isr_lane_release(q, e);
+    } else if (EQUEUE_IS_USER_ALLOCATED_EVENT(e)) {
         e->id = EQUEUE_USER_ALLOCATED_EVENT_STATE_DONE;
     } else {
         equeue_mem_dealloc(q, e);
     }
 }
 
+#ifdef EQUEUE_TIMING_WHEEL
+// timing wheel functions
+//
+// Pending delayed events live in a hierarchical timing wheel: an array of
+// slot lists per level, where each level's slots cover a span
+// EQUEUE_WHEEL_SLOTS times coarser than the level below. Insertion hashes
+// the target tick to a slot and pushes at the head, removal unlinks through
+// the event's ref pointer, so both are O(1). As the wheel's tick advances
+// past a coarser level's boundary, that level's current slot cascades back
+// down, re-inserting its events by their absolute target; events that come
+// due collect in a FIFO due list drained by equeue_dequeue.
+
+// reverse a slot list from newest-first to oldest-first
+static struct equeue_event *equeue_wheel_reverse(struct equeue_event *es)
+{
+    struct equeue_event *prev = 0;
+    while (es) {
+        struct equeue_event *next = es->next;
+        es->next = prev;
+        prev = es;
+        es = next;
+    }
+    return prev;
+}
+
+static void equeue_wheel_insert(equeue_t *q, struct equeue_event *e)
+{
+    e->sibling = 0;
+
+    int diff = equeue_tickdiff(e->target, q->wheel.tick);
+    if (diff <= 0) {
+        // already due, append to the due list in arrival order
+        e->next = 0;
+        e->ref = q->wheel.due_tail;
+        *q->wheel.due_tail = e;
+        q->wheel.due_tail = &e->next;
+        return;
+    }
+
+    // pick the finest level whose span still covers the delay, clamping
+    // far-out targets into the top level - they cascade back down by their
+    // absolute target as the wheel turns
+    unsigned target = e->target;
+    int level = 0;
+    while (level < EQUEUE_WHEEL_LEVELS - 1 &&
+            (unsigned)diff >= 1u << (EQUEUE_WHEEL_BITS * (level + 1))) {
+        level++;
+    }
+    if ((unsigned)diff >= 1u << (EQUEUE_WHEEL_BITS * EQUEUE_WHEEL_LEVELS)) {
+        target = q->wheel.tick + (1u << (EQUEUE_WHEEL_BITS * EQUEUE_WHEEL_LEVELS)) - 1;
+    }
+
+    struct equeue_event **slot = &q->wheel.slots[level]
+                                 [(target >> (EQUEUE_WHEEL_BITS * level)) & (EQUEUE_WHEEL_SLOTS - 1)];
+    e->next = *slot;
+    if (e->next) {
+        e->next->ref = &e->next;
+    }
+    *slot = e;
+    e->ref = slot;
+}
+
+static void equeue_wheel_remove(equeue_t *q, struct equeue_event *e)
+{
+    *e->ref = e->next;
+    if (e->next) {
+        e->next->ref = e->ref;
+    } else if (q->wheel.due_tail == &e->next) {
+        q->wheel.due_tail = e->ref;
+    }
+}
+
+// re-insert the current slot of a coarser level into the levels below
+static void equeue_wheel_cascade(equeue_t *q, int level)
+{
+    struct equeue_event **slot = &q->wheel.slots[level]
+                                 [(q->wheel.tick >> (EQUEUE_WHEEL_BITS * level)) & (EQUEUE_WHEEL_SLOTS - 1)];
+    struct equeue_event *es = equeue_wheel_reverse(*slot);
+    *slot = 0;
+
+    while (es) {
+        struct equeue_event *next = es->next;
+        equeue_wheel_insert(q, es);
+        es = next;
+    }
+}
+
+// turn the wheel up to the target tick, moving expired events to the due list
+static void equeue_wheel_advance(equeue_t *q, unsigned target)
+{
+    while (equeue_tickdiff(q->wheel.tick, target) <= 0) {
+        for (int level = 1; level < EQUEUE_WHEEL_LEVELS; level++) {
+            if (q->wheel.tick & ((1u << (EQUEUE_WHEEL_BITS * level)) - 1)) {
+                break;
+            }
+            equeue_wheel_cascade(q, level);
+        }
+
+        struct equeue_event **slot = &q->wheel.slots[0]
+                                     [q->wheel.tick & (EQUEUE_WHEEL_SLOTS - 1)];
+        struct equeue_event *es = equeue_wheel_reverse(*slot);
+        *slot = 0;
+
+        // everything in the current level-0 slot is due now
+        while (es) {
+            struct equeue_event *next = es->next;
+            equeue_wheel_insert(q, es);
+            es = next;
+        }
+
+        q->wheel.tick += 1;
+    }
+}
+
+// find the milliseconds until the earliest pending event, or -1 if none;
+// must be called with queuelock held
+static int equeue_next_deadline(equeue_t *q, unsigned tick)
+{
+    if (q->wheel.due) {
+        return 0;
+    }
+
+    int deadline = -1;
+    for (int level = 0; level < EQUEUE_WHEEL_LEVELS; level++) {
+        unsigned shift = EQUEUE_WHEEL_BITS * level;
+        unsigned index = q->wheel.tick >> shift;
+        for (unsigned i = 0; i < EQUEUE_WHEEL_SLOTS; i++) {
+            if (q->wheel.slots[level][(index + i) & (EQUEUE_WHEEL_SLOTS - 1)]) {
+                // distance to the start of the occupied slot; for coarser
+                // levels this is conservative - waking early just advances
+                // the wheel and recomputes
+                int diff = equeue_tickdiff((index + i) << shift, tick);
+                if (diff < 1 && level > 0) {
+                    diff = 1;
+                } else if (diff < 0) {
+                    diff = 0;
+                }
+                if (deadline < 0 || diff < deadline) {
+                    deadline = diff;
+                }
+                break;
+            }
+        }
+    }
+    return deadline;
+}
+#endif
+
 void equeue_enqueue(equeue_t *q, struct equeue_event *e, unsigned tick)
 {
     e->target = tick + equeue_clampdiff(e->target, tick);
@@ -250,6 +677,17 @@ void equeue_enqueue(equeue_t *q, struct equeue_event *e, unsigned tick)
 
     equeue_mutex_lock(&q->queuelock);
 
+#ifdef EQUEUE_TIMING_WHEEL
+    equeue_wheel_insert(q, e);
+
+    // notify background timer
+    if (q->background.update && q->background.active) {
+        int deadline = equeue_next_deadline(q, tick);
+        if (deadline >= 0) {
+            q->background.update(q->background.timer, deadline);
+        }
+    }
+#else
     // find the event slot
     struct equeue_event **p = &q->queue;
     while (*p && equeue_tickdiff((*p)->target, e->target) < 0) {
@@ -282,6 +720,7 @@ void equeue_enqueue(equeue_t *q, struct equeue_event *e, unsigned tick)
         q->background.update(q->background.timer,
                              equeue_clampdiff(e->target, tick));
     }
+#endif
     equeue_mutex_unlock(&q->queuelock);
 }
 
@@ -306,6 +745,9 @@ static struct equeue_event *equeue_unqueue_by_address(equeue_t *q, struct equeue
     }
 
     // disentangle from queue
+#ifdef EQUEUE_TIMING_WHEEL
+    equeue_wheel_remove(q, e);
+#else
     if (e->sibling) {
         e->sibling->next = e->next;
         if (e->sibling->next) {
@@ -320,6 +762,7 @@ static struct equeue_event *equeue_unqueue_by_address(equeue_t *q, struct equeue
             e->next->ref = e->ref;
         }
     }
+#endif
     equeue_mutex_unlock(&q->queuelock);
     return e;
 }
@@ -357,6 +800,24 @@ static struct equeue_event *equeue_dequeue(equeue_t *q, unsigned target)
         q->tick = target;
     }
 
+#ifdef EQUEUE_TIMING_WHEEL
+    equeue_wheel_advance(q, target);
+
+    struct equeue_event *due = q->wheel.due;
+    q->wheel.due = 0;
+    q->wheel.due_tail = &q->wheel.due;
+
+    /* we only increment the generation if events have been taken off the queue
+     * as this is the only time cancellation may conflict with dequeueing */
+    if (due) {
+        q->generation += 1;
+    }
+
+    equeue_mutex_unlock(&q->queuelock);
+
+    // the due list is already flat and in insertion order
+    return due;
+#else
     struct equeue_event *head = q->queue;
     struct equeue_event **p = &head;
     while (*p && equeue_tickdiff((*p)->target, target) <= 0) {
@@ -396,6 +857,7 @@ static struct equeue_event *equeue_dequeue(equeue_t *q, unsigned target)
     }
 
     return head;
+#endif
 }
 
 int equeue_post(equeue_t *q, void (*cb)(void *), void *p)
@@ -411,6 +873,25 @@ int equeue_post(equeue_t *q, void (*cb)(void *), void *p)
     return id;
 }
 
+int equeue_post_coalesced(equeue_t *q, int *id, void (*cb)(void *), void *p)
+{
+    struct equeue_event *e = (struct equeue_event *)p - 1;
+    unsigned tick = equeue_tick();
+    e->cb = cb;
+    e->target = tick + e->target;
+
+    // replace any pending event in the slot under the queue lock so no
+    // dispatch pass can observe both; the lock is recursive on all platforms
+    equeue_mutex_lock(&q->queuelock);
+    equeue_cancel(q, *id);
+    equeue_enqueue(q, e, tick);
+    *id = equeue_event_id(q, e);
+    equeue_mutex_unlock(&q->queuelock);
+
+    equeue_sema_signal(&q->eventsema);
+    return *id;
+}
+
 void equeue_post_user_allocated(equeue_t *q, void (*cb)(void *), void *p)
 {
     struct equeue_event *e = (struct equeue_event *)p;
@@ -423,6 +904,20 @@ void equeue_post_user_allocated(equeue_t *q, void (*cb)(void *), void *p)
     equeue_sema_signal(&q->eventsema);
 }
 
+void equeue_post_isr(equeue_t *q, void (*cb)(void *), void *p)
+{
+    struct equeue_event *e = (struct equeue_event *)p - 1;
+    e->cb = cb;
+
+    // push onto the incoming stack; the dispatch loop drains it in a batch
+    void *head = q->isr_lane.incoming;
+    do {
+        e->next = (struct equeue_event *)head;
+    } while (!equeue_atomic_cas_ptr((void *volatile *)&q->isr_lane.incoming, &head, e));
+
+    equeue_sema_signal(&q->eventsema);
+}
+
 bool equeue_cancel(equeue_t *q, int id)
 {
     if (!id) {
@@ -496,6 +991,64 @@ void equeue_break(equeue_t *q)
     equeue_sema_signal(&q->eventsema);
 }
 
+// stable-partition a batch of dequeued events so that higher priority
+// bands dispatch first; order within a band is preserved
+static struct equeue_event *equeue_sort_priorities(struct equeue_event *es)
+{
+    struct equeue_event *heads[EQUEUE_NUM_PRIORITIES] = { 0 };
+    struct equeue_event **tails[EQUEUE_NUM_PRIORITIES];
+    for (int band = 0; band < EQUEUE_NUM_PRIORITIES; band++) {
+        tails[band] = &heads[band];
+    }
+
+    while (es) {
+        struct equeue_event *next = es->next;
+        int band = es->priority < EQUEUE_NUM_PRIORITIES ?
+                   es->priority : EQUEUE_NUM_PRIORITIES - 1;
+        es->next = 0;
+        *tails[band] = es;
+        tails[band] = &es->next;
+        es = next;
+    }
+
+    for (int band = 0; band < EQUEUE_NUM_PRIORITIES; band++) {
+        if (heads[band]) {
+            *tails[band] = es;
+            es = heads[band];
+        }
+    }
+    return es;
+}
+
+static void equeue_drain_isr_lane(equeue_t *q, unsigned tick)
+{
+    // grab the whole incoming stack in one swap
+    void *head = q->isr_lane.incoming;
+    do {
+        if (!head) {
+            return;
+        }
+    } while (!equeue_atomic_cas_ptr((void *volatile *)&q->isr_lane.incoming, &head, 0));
+
+    // the stack comes off newest-first, reverse it to preserve posting order
+    struct equeue_event *es = 0;
+    struct equeue_event *e = (struct equeue_event *)head;
+    while (e) {
+        struct equeue_event *next = e->next;
+        e->next = es;
+        es = e;
+        e = next;
+    }
+
+    // lane events are due immediately
+    while (es) {
+        struct equeue_event *next = es->next;
+        es->target = tick;
+        equeue_enqueue(q, es, tick);
+        es = next;
+    }
+}
+
 void equeue_dispatch(equeue_t *q, int ms)
 {
     unsigned tick = equeue_tick();
@@ -503,8 +1056,10 @@ void equeue_dispatch(equeue_t *q, int ms)
     q->background.active = false;
 
     while (1) {
+        // move events posted from interrupts onto the main queue, then
         // collect all the available events and next deadline
-        struct equeue_event *es = equeue_dequeue(q, tick);
+        equeue_drain_isr_lane(q, tick);
+        struct equeue_event *es = equeue_sort_priorities(equeue_dequeue(q, tick));
 
         // dispatch events
         while (es) {
@@ -514,7 +1069,17 @@ void equeue_dispatch(equeue_t *q, int ms)
             // actually dispatch the callbacks
             void (*cb)(void *) = e->cb;
             if (cb) {
+#ifdef EQUEUE_PROFILE
+                void (*key)(void *) = equeue_profile_key(e);
+                unsigned start = equeue_tick();
+                int lateness = equeue_tickdiff(start, e->target);
+                cb(e + 1);
+                equeue_profile_account(q, key,
+                                       lateness > 0 ? (unsigned)lateness : 0,
+                                       equeue_tick() - start);
+#else
                 cb(e + 1);
+#endif
             }
 
             // reenqueue periodic events or deallocate
@@ -539,10 +1104,17 @@ void equeue_dispatch(equeue_t *q, int ms)
                 // update background timer if necessary
                 if (q->background.update) {
                     equeue_mutex_lock(&q->queuelock);
+#ifdef EQUEUE_TIMING_WHEEL
+                    int next = equeue_next_deadline(q, tick);
+                    if (q->background.update && next >= 0) {
+                        q->background.update(q->background.timer, next);
+                    }
+#else
                     if (q->background.update && q->queue) {
                         q->background.update(q->background.timer,
                                              equeue_clampdiff(q->queue->target, tick));
                     }
+#endif
                     q->background.active = true;
                     equeue_mutex_unlock(&q->queuelock);
                 }
@@ -553,12 +1125,19 @@ void equeue_dispatch(equeue_t *q, int ms)
 
         // find closest deadline
         equeue_mutex_lock(&q->queuelock);
+#ifdef EQUEUE_TIMING_WHEEL
+        int diff = equeue_next_deadline(q, tick);
+        if (diff >= 0 && (unsigned)diff < (unsigned)deadline) {
+            deadline = diff;
+        }
+#else
         if (q->queue) {
             int diff = equeue_clampdiff(q->queue->target, tick);
             if ((unsigned)diff < (unsigned)deadline) {
                 deadline = diff;
             }
         }
+#endif
         equeue_mutex_unlock(&q->queuelock);
 
         // wait for events
@@ -600,13 +1179,19 @@ void equeue_event_dtor(void *p, void (*dtor)(void *))
     e->dtor = dtor;
 }
 
+void equeue_event_priority(void *p, int priority)
+{
+    struct equeue_event *e = (struct equeue_event *)p - 1;
+    if (priority < 0) {
+        priority = 0;
+    } else if (priority > EQUEUE_NUM_PRIORITIES - 1) {
+        priority = EQUEUE_NUM_PRIORITIES - 1;
+    }
+    e->priority = priority;
+}
 
-// simple callbacks
-struct ecallback {
-    void (*cb)(void *);
-    void *data;
-};
 
+// simple callbacks
 static void ecallback_dispatch(void *p)
 {
     struct ecallback *e = (struct ecallback *)p;
@@ -625,6 +1210,18 @@ int equeue_call(equeue_t *q, void (*cb)(void *), void *data)
     return equeue_post(q, ecallback_dispatch, e);
 }
 
+int equeue_call_coalesced(equeue_t *q, int *id, void (*cb)(void *), void *data)
+{
+    struct ecallback *e = equeue_alloc(q, sizeof(struct ecallback));
+    if (!e) {
+        return 0;
+    }
+
+    e->cb = cb;
+    e->data = data;
+    return equeue_post_coalesced(q, id, ecallback_dispatch, e);
+}
+
 int equeue_call_in(equeue_t *q, int ms, void (*cb)(void *), void *data)
 {
     struct ecallback *e = equeue_alloc(q, sizeof(struct ecallback));
@@ -665,10 +1262,17 @@ void equeue_background(equeue_t *q,
     q->background.update = update;
     q->background.timer = timer;
 
+#ifdef EQUEUE_TIMING_WHEEL
+    int next = equeue_next_deadline(q, equeue_tick());
+    if (q->background.update && next >= 0) {
+        q->background.update(q->background.timer, next);
+    }
+#else
     if (q->background.update && q->queue) {
         q->background.update(q->background.timer,
                              equeue_clampdiff(q->queue->target, equeue_tick()));
     }
+#endif
     q->background.active = true;
     equeue_mutex_unlock(&q->queuelock);
 }
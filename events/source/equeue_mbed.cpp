@@ -21,17 +21,14 @@
 
 #if defined(EQUEUE_PLATFORM_MBED)
 
+#include <chrono>
 #include <stdbool.h>
 #include <string.h>
 #include "cmsis.h"
+#include "platform/mbed_atomic.h"
 #include "platform/mbed_critical.h"
 #include "platform/mbed_power_mgmt.h"
-#include "drivers/Timer.h"
-#include "drivers/Ticker.h"
-#include "drivers/Timeout.h"
-#include "drivers/LowPowerTimeout.h"
-#include "drivers/LowPowerTicker.h"
-#include "drivers/LowPowerTimer.h"
+#include "platform/internal/mbed_os_timer.h"
 
 using namespace mbed;
 
@@ -39,7 +36,6 @@ using namespace mbed;
 #if MBED_CONF_RTOS_API_PRESENT
 
 #include "rtos/Kernel.h"
-#include "platform/internal/mbed_os_timer.h"
 
 void equeue_tick_init()
 {
@@ -81,54 +77,19 @@ unsigned equeue_tick()
 
 #else
 
-#if MBED_CONF_EVENTS_USE_LOWPOWER_TIMER_TICKER
-
-#define ALIAS_TIMER      LowPowerTimer
-#define ALIAS_TICKER     LowPowerTicker
-#define ALIAS_TIMEOUT    LowPowerTimeout
-#else
-#define ALIAS_TIMER      Timer
-#define ALIAS_TICKER     Ticker
-#define ALIAS_TIMEOUT    Timeout
-#endif
-
-static volatile unsigned equeue_minutes = 0;
-static unsigned equeue_timer[
-     (sizeof(ALIAS_TIMER) + sizeof(unsigned) - 1) / sizeof(unsigned)];
-static unsigned equeue_ticker[
-     (sizeof(ALIAS_TICKER) + sizeof(unsigned) - 1) / sizeof(unsigned)];
-
-static void equeue_tick_update()
-{
-    equeue_minutes += reinterpret_cast<ALIAS_TIMER *>(equeue_timer)->read_ms();
-    reinterpret_cast<ALIAS_TIMER *>(equeue_timer)->reset();
-}
-
+// Without an RTOS the tick is driven directly by the OS timer, which runs
+// from the low-power ticker when the target has one. Unlike a free-running
+// us-ticker Timer, it does not hold a deep sleep lock while the queue idles.
 void equeue_tick_init()
 {
-    static_assert(sizeof(equeue_timer) >= sizeof(ALIAS_TIMER),
-                  "The equeue_timer buffer must fit the class Timer");
-    static_assert(sizeof(equeue_ticker) >= sizeof(ALIAS_TICKER),
-                  "The equeue_ticker buffer must fit the class Ticker");
-    ALIAS_TIMER *timer = new (equeue_timer) ALIAS_TIMER;
-    ALIAS_TICKER *ticker = new (equeue_ticker) ALIAS_TICKER;
-
-    equeue_minutes = 0;
-    timer->start();
-    ticker->attach_us(equeue_tick_update, 1000 << 16);
+    mbed::internal::init_os_timer();
 }
 
 unsigned equeue_tick()
 {
-    unsigned minutes;
-    unsigned ms;
-
-    do {
-        minutes = equeue_minutes;
-        ms = reinterpret_cast<ALIAS_TIMER *>(equeue_timer)->read_ms();
-    } while (minutes != equeue_minutes);
+    using unsigned_ms_t = std::chrono::duration<unsigned, std::milli>;
 
-    return minutes + ms;
+    return std::chrono::duration_cast<unsigned_ms_t>(mbed::internal::os_timer->get_time().time_since_epoch()).count();
 }
 
 #endif
@@ -151,6 +112,13 @@ void equeue_mutex_unlock(equeue_mutex_t *m)
 }
 
 
+// Atomic operations
+bool equeue_atomic_cas_ptr(void *volatile *ptr, void **expected, void *desired)
+{
+    return core_util_atomic_cas_ptr(ptr, expected, desired);
+}
+
+
 // Semaphore operations
 #ifdef MBED_CONF_RTOS_API_PRESENT
 
@@ -191,7 +159,7 @@ bool equeue_sema_wait(equeue_sema_t *s, int ms)
 // Semaphore operations
 int equeue_sema_create(equeue_sema_t *s)
 {
-    *s = 0;
+    *s = false;
     return 0;
 }
 
@@ -201,34 +169,25 @@ void equeue_sema_destroy(equeue_sema_t *s)
 
 void equeue_sema_signal(equeue_sema_t *s)
 {
-    *s = 1;
+    core_util_atomic_store_bool(s, true);
 }
 
-static void equeue_sema_timeout(equeue_sema_t *s)
+static bool equeue_sema_wake_predicate(void *s)
 {
-    *s = -1;
+    return core_util_atomic_load_bool(static_cast<equeue_sema_t *>(s));
 }
 
 bool equeue_sema_wait(equeue_sema_t *s, int ms)
 {
-    ALIAS_TIMEOUT timeout;
-    if (ms > 0) {
-        timeout.attach_us(callback(equeue_sema_timeout, s), (us_timestamp_t)ms * 1000);
-    }
-
-    core_util_critical_section_enter();
-    while (!*s && ms != 0) {
-        sleep();
-        core_util_critical_section_exit();
-        __ISB();
-        core_util_critical_section_enter();
-    }
-
-    int signal = *s;
-    *s = 0;
-    core_util_critical_section_exit();
+    // The timed sleep programs the OS timer for exactly the next-event
+    // deadline and enters sleep through the sleep manager, so the core can
+    // drop to deep sleep for the whole idle period when nothing blocks it.
+    internal::OsClock::duration_u32 delay = (ms < 0)
+                                            ? internal::OsClock::duration_u32::max()
+                                            : internal::OsClock::duration_u32(ms);
+    internal::do_timed_sleep_relative_or_forever(delay, equeue_sema_wake_predicate, s);
 
-    return (signal > 0);
+    return core_util_atomic_exchange_bool(s, false);
 }
 
 #endif
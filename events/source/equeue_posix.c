@@ -63,6 +63,14 @@ void equeue_mutex_unlock(equeue_mutex_t *m)
 }
 
 
+// Atomic operations
+bool equeue_atomic_cas_ptr(void *volatile *ptr, void **expected, void *desired)
+{
+    return __atomic_compare_exchange_n(ptr, expected, desired, false,
+                                       __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+
+
 // Semaphore operations
 int equeue_sema_create(equeue_sema_t *s)
 {
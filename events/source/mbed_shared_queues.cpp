@@ -24,6 +24,16 @@ using rtos::Thread;
 
 using namespace events;
 
+/* Bottom-half events are bare member-function calls, so the queue can be
+ * much smaller than the shared queues */
+#ifndef MBED_CONF_EVENTS_BOTTOM_HALF_EVENTSIZE
+#define MBED_CONF_EVENTS_BOTTOM_HALF_EVENTSIZE 256
+#endif
+
+#ifndef MBED_CONF_EVENTS_BOTTOM_HALF_STACKSIZE
+#define MBED_CONF_EVENTS_BOTTOM_HALF_STACKSIZE 1024
+#endif
+
 namespace mbed {
 
 #ifdef MBED_CONF_RTOS_PRESENT
@@ -74,4 +84,15 @@ EventQueue *mbed_highprio_event_queue()
 }
 #endif
 
+EventQueue *mbed_bottom_half_queue()
+{
+#ifdef MBED_CONF_RTOS_PRESENT
+    return do_shared_event_queue_with_thread<osPriorityRealtime, MBED_CONF_EVENTS_BOTTOM_HALF_EVENTSIZE, MBED_CONF_EVENTS_BOTTOM_HALF_STACKSIZE>("bottom_half_queue");
+#else
+    /* No dedicated context to create - bottom halves run wherever the
+     * application dispatches the shared queue */
+    return mbed_event_queue();
+#endif
+}
+
 }
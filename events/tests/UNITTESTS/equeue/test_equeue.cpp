@@ -1112,3 +1112,204 @@ TEST_F(TestEqueue, test_equeue_user_allocated_event_post)
 
     equeue_destroy(&q);
 }
+
+/** Test that ISR lane events can be claimed, posted, and dispatched.
+ *
+ *  Given queue with a lock-free posting lane is initialized.
+ *  When events are claimed with equeue_alloc_isr and posted with equeue_post_isr.
+ *  Then they are dispatched in posting order and their slots return to the pool.
+ */
+TEST_F(TestEqueue, test_equeue_isr_lane_post)
+{
+    equeue_t q;
+    int err = equeue_create(&q, TEST_EQUEUE_SIZE);
+    ASSERT_EQ(0, err);
+
+    err = equeue_isr_lane_create(&q, 4, sizeof(struct indirect));
+    ASSERT_EQ(0, err);
+
+    uint8_t touched = 0;
+    for (int round = 0; round < 2; round++) {
+        struct indirect *is[4];
+        for (int i = 0; i < 4; i++) {
+            is[i] = reinterpret_cast<struct indirect *>(equeue_alloc_isr(&q, sizeof(struct indirect)));
+            ASSERT_TRUE(is[i] != NULL);
+            is[i]->touched = &touched;
+        }
+
+        // the pool is exhausted until the in-flight events complete
+        EXPECT_TRUE(equeue_alloc_isr(&q, sizeof(struct indirect)) == NULL);
+
+        for (int i = 0; i < 4; i++) {
+            equeue_post_isr(&q, indirect_func, is[i]);
+        }
+
+        equeue_dispatch(&q, 0);
+        EXPECT_EQ(4 * (round + 1), touched);
+    }
+
+    // requests larger than the lane's slot size are refused
+    EXPECT_TRUE(equeue_alloc_isr(&q, TEST_EQUEUE_SIZE) == NULL);
+
+    equeue_destroy(&q);
+}
+
+static uint8_t prio_log[8];
+static uint8_t prio_pos = 0;
+
+static void prio_func(void *p)
+{
+    prio_log[prio_pos++] = *(reinterpret_cast<uint8_t *>(p));
+}
+
+/** Test that higher priority bands dispatch before lower ones.
+ *
+ *  Given queue is initialized.
+ *  When events due in the same dispatch pass carry different priority bands.
+ *  Then higher bands are dispatched first and order within a band stays FIFO.
+ */
+TEST_F(TestEqueue, test_equeue_priority_bands)
+{
+    equeue_t q;
+    int err = equeue_create(&q, TEST_EQUEUE_SIZE);
+    ASSERT_EQ(0, err);
+
+    uint8_t tags[6] = { 0, 1, 2, 3, 4, 5 };
+    int prios[6] = { 0, 2, 1, 3, 2, 0 };
+    for (int i = 0; i < 6; i++) {
+        uint8_t *e = reinterpret_cast<uint8_t *>(equeue_alloc(&q, sizeof(uint8_t)));
+        ASSERT_TRUE(e != NULL);
+        *e = tags[i];
+        equeue_event_priority(e, prios[i]);
+        ASSERT_NE(0, equeue_post(&q, prio_func, e));
+    }
+
+    equeue_dispatch(&q, 0);
+
+    uint8_t expected[6] = { 3, 1, 4, 2, 0, 5 };
+    ASSERT_EQ(6, prio_pos);
+    for (int i = 0; i < 6; i++) {
+        EXPECT_EQ(expected[i], prio_log[i]);
+    }
+
+    equeue_destroy(&q);
+}
+
+/** Test that the allocator reports per-size-class statistics.
+ *
+ *  Given queue is initialized and compiled with EQUEUE_ALLOC_STATS.
+ *  When events are allocated, freed, and allocation is driven to failure.
+ *  Then live counts, high-water marks, and failure counts are reported per class.
+ */
+TEST_F(TestEqueue, test_equeue_alloc_stats)
+{
+    equeue_t q;
+    int err = equeue_create(&q, TEST_EQUEUE_SIZE);
+    ASSERT_EQ(0, err);
+
+    equeue_alloc_stats_t stats[EQUEUE_NUM_SIZE_CLASSES + 1];
+    ASSERT_EQ(EQUEUE_NUM_SIZE_CLASSES + 1u,
+              equeue_alloc_stats(&q, stats, EQUEUE_NUM_SIZE_CLASSES + 1));
+    for (int i = 0; i < EQUEUE_NUM_SIZE_CLASSES + 1; i++) {
+        EXPECT_EQ(0, stats[i].live);
+        EXPECT_EQ(0, stats[i].hwm);
+        EXPECT_EQ(0, stats[i].failures);
+    }
+
+    // two outstanding single-pointer events peak the class at two
+    void *a = equeue_alloc(&q, sizeof(void *));
+    void *b = equeue_alloc(&q, sizeof(void *));
+    ASSERT_TRUE(a && b);
+    equeue_dealloc(&q, a);
+
+    equeue_alloc_stats(&q, stats, EQUEUE_NUM_SIZE_CLASSES + 1);
+    EXPECT_EQ(1, stats[1].live);
+    EXPECT_EQ(2, stats[1].hwm);
+    EXPECT_EQ(sizeof(struct equeue_event) + sizeof(void *), stats[1].size);
+
+    // freed events are reused exactly
+    void *c = equeue_alloc(&q, sizeof(void *));
+    EXPECT_EQ(a, c);
+
+    // an impossible allocation is counted against the overflow class
+    EXPECT_TRUE(equeue_alloc(&q, 2 * TEST_EQUEUE_SIZE) == NULL);
+    equeue_alloc_stats(&q, stats, EQUEUE_NUM_SIZE_CLASSES + 1);
+    EXPECT_EQ(1, stats[EQUEUE_NUM_SIZE_CLASSES].failures);
+
+    equeue_dealloc(&q, b);
+    equeue_dealloc(&q, c);
+    equeue_destroy(&q);
+}
+
+/** Test that posts through a coalescing slot replace the pending event.
+ *
+ *  Given queue is initialized.
+ *  When several events are posted through the same coalescing id slot
+ *  before the queue dispatches.
+ *  Then only the newest of them executes, and independent events are unaffected.
+ */
+TEST_F(TestEqueue, test_equeue_call_coalesced)
+{
+    equeue_t q;
+    int err = equeue_create(&q, TEST_EQUEUE_SIZE);
+    ASSERT_EQ(0, err);
+
+    uint8_t coalesced = 0;
+    uint8_t separate = 0;
+    int slot = 0;
+    for (int i = 0; i < 5; i++) {
+        ASSERT_NE(0, equeue_call_coalesced(&q, &slot, simple_func, &coalesced));
+    }
+    ASSERT_NE(0, equeue_call(&q, simple_func, &separate));
+
+    equeue_dispatch(&q, 0);
+    EXPECT_EQ(1, coalesced);
+    EXPECT_EQ(1, separate);
+
+    // the slot is reusable after dispatch, and its id cancels like any other
+    ASSERT_NE(0, equeue_call_coalesced(&q, &slot, simple_func, &coalesced));
+    EXPECT_TRUE(equeue_cancel(&q, slot));
+    equeue_dispatch(&q, 0);
+    EXPECT_EQ(1, coalesced);
+
+    equeue_destroy(&q);
+}
+
+/** Test that the dispatch profiler accounts execution time and lateness.
+ *
+ *  Given queue is initialized and built with EQUEUE_PROFILE.
+ *  When a slow and a fast callback due at the same tick are dispatched.
+ *  Then the profile reports their counts, the slow callback's execution
+ *  time, and the lateness the slow callback imposed on the fast one.
+ */
+TEST_F(TestEqueue, test_equeue_profile)
+{
+    equeue_t q;
+    int err = equeue_create(&q, TEST_EQUEUE_SIZE);
+    ASSERT_EQ(0, err);
+
+    uint8_t slow = 0;
+    uint8_t fast = 0;
+    ASSERT_NE(0, equeue_call(&q, sloth_func, &slow));
+    ASSERT_NE(0, equeue_call(&q, simple_func, &fast));
+    equeue_dispatch(&q, 0);
+    ASSERT_EQ(1, slow);
+    ASSERT_EQ(1, fast);
+
+    equeue_profile_t profile[EQUEUE_PROFILE_SLOTS];
+    ASSERT_EQ(2u, equeue_profile(&q, profile, EQUEUE_PROFILE_SLOTS));
+
+    // entries appear in first-dispatch order, keyed on the user callback
+    // rather than the shared equeue_call wrapper
+    EXPECT_EQ(&sloth_func, profile[0].cb);
+    EXPECT_EQ(1u, profile[0].count);
+    EXPECT_EQ(10u, profile[0].total_ms);
+    EXPECT_EQ(10u, profile[0].max_ms);
+
+    EXPECT_EQ(&simple_func, profile[1].cb);
+    EXPECT_EQ(1u, profile[1].count);
+    EXPECT_EQ(0u, profile[1].max_ms);
+    EXPECT_EQ(10u, profile[1].max_lateness_ms);
+
+    equeue_destroy(&q);
+}
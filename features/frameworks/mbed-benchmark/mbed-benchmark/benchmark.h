@@ -0,0 +1,135 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** \file benchmark.h
+ * Cycle-accurate microbenchmark harness for greentea tests.
+ *
+ * Where the functional test frameworks answer "does it work", this one
+ * answers "how many cycles does it cost". Benchmarks are registered with the
+ * BENCHMARK() macro and run by mbed::benchmark::run_all(), which times each
+ * one repeatedly with the DWT cycle counter (or the microsecond ticker on
+ * cores without a DWT), subtracts the calibrated measurement overhead, and
+ * reports min/median/p99/max over the samples. The median makes the numbers
+ * stable against interrupt noise; the p99 exposes it.
+ *
+ * usage example:
+ * \code(main.cpp:)
+ *      #include "benchmark.h"
+ *
+ *      BENCHMARK(mutex_lock_unlock)
+ *      {
+ *          mutex.lock();
+ *          mutex.unlock();
+ *      }
+ *
+ *      int main()
+ *      {
+ *          return mbed::benchmark::run_all("rtos benchmarks");
+ *      }
+ * \endcode
+ *
+ * Results are printed as a table and emitted as greentea key-value pairs
+ * ("benchmark", name, median, p99) so the host side can track the numbers
+ * across runs and fail CI on regressions.
+ */
+
+#ifndef MBED_BENCHMARK_H
+#define MBED_BENCHMARK_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/** Number of timed samples per benchmark */
+#ifndef MBED_BENCHMARK_SAMPLES
+#define MBED_BENCHMARK_SAMPLES 128
+#endif
+
+/** Untimed runs before sampling starts, to warm caches and lazy init paths */
+#ifndef MBED_BENCHMARK_WARMUP
+#define MBED_BENCHMARK_WARMUP 8
+#endif
+
+namespace mbed {
+namespace benchmark {
+
+/** Distribution of one benchmark's samples, in timer units */
+struct statistics_t {
+    uint32_t minimum;
+    uint32_t median;
+    uint32_t p99;
+    uint32_t maximum;
+};
+
+/** One registered benchmark. Use the BENCHMARK() macro rather than
+ *  instantiating this directly; instances register themselves in
+ *  construction order. */
+class Benchmark {
+public:
+    Benchmark(const char *name, void (*function)());
+
+    const char *name() const
+    {
+        return _name;
+    }
+
+    /** First registered benchmark, or NULL */
+    static const Benchmark *first();
+
+    /** Next registered benchmark, or NULL */
+    const Benchmark *next() const
+    {
+        return _next;
+    }
+
+    /** Run this benchmark now and return its sample statistics */
+    statistics_t measure() const;
+
+private:
+    const char *_name;
+    void (*_function)();
+    Benchmark *_next;
+};
+
+/** Unit of all reported numbers: "cycles" with a DWT, "us" without one */
+const char *timer_unit();
+
+/** Run every registered benchmark under greentea.
+ *
+ * Performs the greentea handshake, times each benchmark, prints a result
+ * table and sends one key-value pair per benchmark to the host. Call from
+ * the test's main().
+ *
+ * @param suite name reported for the suite
+ * @return 0, as the exit value for main()
+ */
+int run_all(const char *suite);
+
+} // namespace benchmark
+} // namespace mbed
+
+/** Define and register a benchmark.
+ *
+ * The body is the code under measurement; it runs once per sample, between
+ * two timestamps. Keep it minimal - per-benchmark state belongs in statics
+ * outside the body, set-up cost in the first warm-up runs.
+ */
+#define BENCHMARK(name) \
+    static void mbed_benchmark_fn_##name(); \
+    static ::mbed::benchmark::Benchmark mbed_benchmark_##name(#name, mbed_benchmark_fn_##name); \
+    static void mbed_benchmark_fn_##name()
+
+#endif // MBED_BENCHMARK_H
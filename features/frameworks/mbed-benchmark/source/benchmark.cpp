@@ -0,0 +1,149 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "benchmark.h"
+
+#include <algorithm>
+#include <stdio.h>
+
+#include "greentea-client/test_env.h"
+#include "cmsis.h"
+#if !defined(DWT) && DEVICE_USTICKER
+#include "drivers/HighResClock.h"
+#endif
+
+namespace mbed {
+namespace benchmark {
+
+/* Prefer the DWT cycle counter; Cortex-M0(+) has no DWT, so fall back to the
+ * microsecond ticker there and accept its coarser resolution. */
+#if defined(DWT) && defined(DWT_CTRL_CYCCNTENA_Msk)
+
+static uint32_t timer_read()
+{
+    if (!(DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk)) {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+    return DWT->CYCCNT;
+}
+
+const char *timer_unit()
+{
+    return "cycles";
+}
+
+#elif DEVICE_USTICKER
+
+static uint32_t timer_read()
+{
+    return (uint32_t)HighResClock::now().time_since_epoch().count();
+}
+
+const char *timer_unit()
+{
+    return "us";
+}
+
+#else
+#error [NOT_SUPPORTED] benchmark timing requires a DWT cycle counter or the usticker
+#endif
+
+static Benchmark *benchmark_list = NULL;
+static Benchmark **benchmark_list_tail = &benchmark_list;
+
+Benchmark::Benchmark(const char *name, void (*function)()) :
+    _name(name), _function(function), _next(NULL)
+{
+    /* Append so run_all() visits benchmarks in definition order */
+    *benchmark_list_tail = this;
+    benchmark_list_tail = &_next;
+}
+
+const Benchmark *Benchmark::first()
+{
+    return benchmark_list;
+}
+
+/* The cost of taking the two timestamps themselves, measured around an empty
+ * function and subtracted from every sample */
+static uint32_t measurement_overhead()
+{
+    static uint32_t overhead;
+    static bool calibrated = false;
+
+    if (!calibrated) {
+        overhead = UINT32_MAX;
+        for (int i = 0; i < MBED_BENCHMARK_SAMPLES; i++) {
+            uint32_t start = timer_read();
+            uint32_t elapsed = timer_read() - start;
+            overhead = std::min(overhead, elapsed);
+        }
+        calibrated = true;
+    }
+    return overhead;
+}
+
+statistics_t Benchmark::measure() const
+{
+    static uint32_t samples[MBED_BENCHMARK_SAMPLES];
+    uint32_t overhead = measurement_overhead();
+
+    for (int i = 0; i < MBED_BENCHMARK_WARMUP; i++) {
+        _function();
+    }
+
+    for (int i = 0; i < MBED_BENCHMARK_SAMPLES; i++) {
+        uint32_t start = timer_read();
+        _function();
+        uint32_t elapsed = timer_read() - start;
+        samples[i] = (elapsed > overhead) ? (elapsed - overhead) : 0;
+    }
+
+    std::sort(samples, samples + MBED_BENCHMARK_SAMPLES);
+
+    statistics_t stats;
+    stats.minimum = samples[0];
+    stats.median = samples[MBED_BENCHMARK_SAMPLES / 2];
+    stats.p99 = samples[(MBED_BENCHMARK_SAMPLES * 99) / 100];
+    stats.maximum = samples[MBED_BENCHMARK_SAMPLES - 1];
+    return stats;
+}
+
+int run_all(const char *suite)
+{
+    GREENTEA_SETUP(60, "default_auto");
+
+    printf("benchmark suite: %s (%d samples each, %s)\n",
+           suite, MBED_BENCHMARK_SAMPLES, timer_unit());
+    printf("%-32s %10s %10s %10s %10s\n", "benchmark", "min", "median", "p99", "max");
+
+    for (const Benchmark *benchmark = Benchmark::first(); benchmark; benchmark = benchmark->next()) {
+        statistics_t stats = benchmark->measure();
+        printf("%-32s %10lu %10lu %10lu %10lu\n", benchmark->name(),
+               (unsigned long)stats.minimum, (unsigned long)stats.median,
+               (unsigned long)stats.p99, (unsigned long)stats.maximum);
+        /* One record per benchmark for the host side to collect and compare
+         * across runs */
+        greentea_send_kv("benchmark", benchmark->name(), (int)stats.median, (int)stats.p99);
+    }
+
+    GREENTEA_TESTSUITE_RESULT(1);
+    return 0;
+}
+
+} // namespace benchmark
+} // namespace mbed
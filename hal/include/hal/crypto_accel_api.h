@@ -0,0 +1,134 @@
+/** \addtogroup hal */
+/** @{*/
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_CRYPTO_ACCEL_API_H
+#define MBED_CRYPTO_ACCEL_API_H
+
+#include "device.h"
+#include <stdint.h>
+
+#if DEVICE_CRYPTO_ACCEL_AES || DEVICE_CRYPTO_ACCEL_SHA256 || defined(DOXYGEN_ONLY)
+
+/* Capability bits reported by crypto_accel_get_capabilities() */
+#define CRYPTO_ACCEL_CAP_AES_128     (1u << 0)  ///< AES with 128-bit keys
+#define CRYPTO_ACCEL_CAP_AES_192     (1u << 1)  ///< AES with 192-bit keys
+#define CRYPTO_ACCEL_CAP_AES_256     (1u << 2)  ///< AES with 256-bit keys
+#define CRYPTO_ACCEL_CAP_AES_CBC     (1u << 3)  ///< CBC chaining done by the engine
+#define CRYPTO_ACCEL_CAP_SHA256     (1u << 4)   ///< SHA-224/SHA-256 compression
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \defgroup crypto_accel_hal Crypto acceleration HAL API
+ *
+ * Low-level entry points into a target's AES and SHA hardware engines.
+ * A target that implements this API and declares CRYPTO_ACCEL_AES or
+ * CRYPTO_ACCEL_SHA256 in its device_has list gets the corresponding
+ * mbed TLS module routed to hardware by generic glue in
+ * connectivity/mbedtls; no per-target ALT port is needed.
+ *
+ * The API is stateless: the key accompanies every call so that
+ * contexts stay plain memory and survive the copying and cloning that
+ * mbed TLS does internally. Implementations are expected to cache the
+ * expanded key schedule keyed on the key bytes when expansion is
+ * expensive. Calls are made from thread context only, but possibly
+ * from several threads; implementations must serialize access to the
+ * engine themselves.
+ * @{
+ */
+
+/** Report which operations the engine supports.
+ *
+ * The CRYPTO_ACCEL_CAP_AES_xxx key-size bits must reflect what the
+ * engine can actually key: a key size without its bit set fails over
+ * to an error at setkey time, there is no software fallback.
+ *
+ * @return Bitwise or of CRYPTO_ACCEL_CAP_xxx values
+ */
+uint32_t crypto_accel_get_capabilities(void);
+
+#if DEVICE_CRYPTO_ACCEL_AES || defined(DOXYGEN_ONLY)
+
+/** Run AES-ECB over a run of 16-byte blocks.
+ *
+ * @param key     Key bytes
+ * @param keybits Key size in bits: 128, 192 or 256
+ * @param encrypt Non-zero to encrypt, zero to decrypt
+ * @param input   Input blocks, 16 * blocks bytes
+ * @param output  Output blocks, may equal input
+ * @param blocks  Number of 16-byte blocks
+ * @return 0 on success, -1 on failure
+ */
+int crypto_accel_aes_crypt_ecb(const unsigned char *key, unsigned int keybits,
+                               int encrypt, const unsigned char *input,
+                               unsigned char *output, unsigned int blocks);
+
+/** Run AES-CBC over a run of 16-byte blocks.
+ *
+ * Optional: a default built on crypto_accel_aes_crypt_ecb() is linked
+ * unless the target overrides it; override and set
+ * CRYPTO_ACCEL_CAP_AES_CBC when the engine chains natively.
+ *
+ * @param key     Key bytes
+ * @param keybits Key size in bits: 128, 192 or 256
+ * @param encrypt Non-zero to encrypt, zero to decrypt
+ * @param iv      Initialization vector, updated to the last ciphertext
+ *                block so runs can be chained
+ * @param input   Input blocks, 16 * blocks bytes
+ * @param output  Output blocks, may equal input
+ * @param blocks  Number of 16-byte blocks
+ * @return 0 on success, -1 on failure
+ */
+int crypto_accel_aes_crypt_cbc(const unsigned char *key, unsigned int keybits,
+                               int encrypt, unsigned char iv[16],
+                               const unsigned char *input,
+                               unsigned char *output, unsigned int blocks);
+
+#endif /* DEVICE_CRYPTO_ACCEL_AES */
+
+#if DEVICE_CRYPTO_ACCEL_SHA256 || defined(DOXYGEN_ONLY)
+
+/** Run the SHA-256 compression function over a run of 64-byte blocks.
+ *
+ * Message padding and length encoding are done by the caller; the
+ * same entry point therefore serves SHA-224, which differs only in
+ * the initial state and output truncation.
+ *
+ * @param state  Working state, eight big-endian words, updated in place
+ * @param input  Input blocks, 64 * blocks bytes
+ * @param blocks Number of 64-byte blocks
+ * @return 0 on success, -1 on failure
+ */
+int crypto_accel_sha256_process(uint32_t state[8], const unsigned char *input,
+                                unsigned int blocks);
+
+#endif /* DEVICE_CRYPTO_ACCEL_SHA256 */
+
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DEVICE_CRYPTO_ACCEL_AES || DEVICE_CRYPTO_ACCEL_SHA256 */
+
+#endif
+
+/** @}*/
@@ -21,6 +21,8 @@
 #define MBED_DMA_API_H
 
 #include <stdint.h>
+#include <stdbool.h>
+#include "device.h"
 
 #define DMA_ERROR_OUT_OF_CHANNELS (-1)
 
@@ -42,6 +44,115 @@ int dma_channel_allocate(uint32_t capabilities);
 
 int dma_channel_free(int channelid);
 
+#if DEVICE_DMA
+
+/** Direction of a DMA transfer
+ */
+typedef enum {
+    DMA_MEM_TO_MEM,    /**< Memory to memory */
+    DMA_MEM_TO_PERIPH, /**< Memory to a peripheral data register */
+    DMA_PERIPH_TO_MEM  /**< A peripheral data register to memory */
+} dma_direction_t;
+
+/** Width of each element a DMA transfer moves
+ */
+typedef enum {
+    DMA_WIDTH_8BIT  = 1,
+    DMA_WIDTH_16BIT = 2,
+    DMA_WIDTH_32BIT = 4
+} dma_width_t;
+
+/** DMA transfer events
+ */
+typedef enum {
+    DMA_EVENT_TRANSFER_COMPLETE, /**< The last descriptor of the transfer finished */
+    DMA_EVENT_TRANSFER_ERROR     /**< The controller reported a bus or configuration error */
+} dma_event_t;
+
+typedef void (*dma_handler)(uint32_t id, dma_event_t event);
+
+/** One leg of a DMA transfer
+ *
+ * Descriptors can be chained through the next pointer; the controller
+ * moves on to the next descriptor without software involvement, so a
+ * scatter-gather transfer completes with a single interrupt. The
+ * descriptor chain is read while the transfer runs and must stay valid
+ * until it completes or is aborted.
+ */
+typedef struct dma_transfer_s {
+    const void *src;                   /**< Source address of the first element */
+    void *dst;                         /**< Destination address of the first element */
+    uint32_t length;                   /**< Number of elements to move */
+    dma_width_t width;                 /**< Size of each element */
+    dma_direction_t direction;         /**< What the source and destination are */
+    bool src_increment;                /**< Advance the source address after each element */
+    bool dst_increment;                /**< Advance the destination address after each element */
+    uint32_t trigger;                  /**< Peripheral request line pacing the transfer, target specific, 0 for none */
+    const struct dma_transfer_s *next; /**< Next descriptor of a linked-list transfer, NULL for the last */
+} dma_transfer_t;
+
+/**
+ * \defgroup hal_dma DMA HAL functions
+ *
+ * Targets with a generic DMA controller implement these functions and
+ * define DEVICE_DMA; drivers then back async I/O with DMA on any such
+ * target instead of taking an interrupt per word.
+ *
+ * # Defined behavior
+ * * ::dma_transfer_setup programs an allocated channel with a descriptor chain
+ * * ::dma_transfer_start begins the transfer; all linked descriptors are
+ *   played without software involvement
+ * * The handler is invoked once with ::DMA_EVENT_TRANSFER_COMPLETE after the
+ *   last descriptor, or with ::DMA_EVENT_TRANSFER_ERROR
+ * * The handler may be invoked from interrupt context
+ * * ::dma_transfer_abort stops the channel; no handler is invoked for an
+ *   aborted transfer
+ * * Descriptors are read while the transfer runs and must stay valid until
+ *   completion or abort
+ *
+ * # Undefined behavior
+ * * Calling these functions on a channel not obtained from ::dma_channel_allocate
+ * * Calling ::dma_transfer_setup while the channel is active
+ * * Modifying a descriptor after ::dma_transfer_start
+ *
+ * @{
+ */
+
+/** Program a channel with a descriptor chain
+ *
+ * @param channelid Channel returned by ::dma_channel_allocate
+ * @param transfer  First descriptor of the transfer
+ * @param handler   The handler invoked on completion or error
+ * @param id        The object ID passed to the handler (id != 0, 0 is reserved)
+ * @return 0 on success, -1 if the descriptor chain is not supported by the controller
+ */
+int dma_transfer_setup(int channelid, const dma_transfer_t *transfer, dma_handler handler, uint32_t id);
+
+/** Start a programmed transfer
+ *
+ * @param channelid Channel returned by ::dma_channel_allocate
+ */
+void dma_transfer_start(int channelid);
+
+/** Abort a running transfer
+ *
+ * The channel stops at an element boundary. No handler is invoked.
+ *
+ * @param channelid Channel returned by ::dma_channel_allocate
+ */
+void dma_transfer_abort(int channelid);
+
+/** Check whether a transfer is running
+ *
+ * @param channelid Channel returned by ::dma_channel_allocate
+ * @return true if the channel is moving data
+ */
+bool dma_transfer_active(int channelid);
+
+/**@}*/
+
+#endif // DEVICE_DMA
+
 #ifdef __cplusplus
 }
 #endif
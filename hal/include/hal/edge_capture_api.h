@@ -0,0 +1,111 @@
+
+/** \addtogroup hal */
+/** @{*/
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_EDGE_CAPTURE_API_H
+#define MBED_EDGE_CAPTURE_API_H
+
+#include "device.h"
+#include "pinmap.h"
+#include "hal/gpio_irq_api.h"
+#include "hal/ticker_api.h"
+
+#if DEVICE_EDGE_CAPTURE
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Edge capture HAL structure. edge_capture_s is declared in the target's HAL
+ */
+typedef struct edge_capture_s edge_capture_t;
+
+typedef void (*edge_capture_handler)(uint32_t id, gpio_irq_event event, timestamp_t timestamp);
+
+/**
+ * \defgroup hal_edge_capture Edge capture HAL functions
+ *
+ * Timer capture channels latch a timestamp in hardware at the moment a pin
+ * transitions, so the reported edge time does not depend on interrupt
+ * latency. Targets with capture-capable timer peripherals implement this
+ * API and define DEVICE_EDGE_CAPTURE; the handler is still invoked from the
+ * capture interrupt, but the timestamp it carries was taken by the hardware
+ * at the edge itself.
+ *
+ * # Defined behavior
+ * * ::edge_capture_init binds the pin to a free capture channel and attaches the handler
+ * * ::edge_capture_free releases the capture channel
+ * * ::edge_capture_set enables/disables capture of an edge
+ * * Timestamps are reported in microseconds, in the same time base as the
+ *   microsecond ticker, so they can be compared with ticker_read()
+ * * The handler may be invoked from interrupt context
+ *
+ * # Undefined behavior
+ * * Calling other functions before ::edge_capture_init
+ *
+ * @{
+ */
+
+/** Initialize edge capture on a pin
+ *
+ * Binds the pin to a capture channel of a timer peripheral. The handler
+ * receives the edge direction and the timestamp latched by the hardware
+ * when the edge occurred.
+ *
+ * @param obj     The edge capture object to initialize
+ * @param pin     The pin to capture edges on
+ * @param handler The handler to be attached to capture events
+ * @param id      The object ID (id != 0, 0 is reserved)
+ * @return -1 if the pin has no capture channel, 0 otherwise
+ */
+int edge_capture_init(edge_capture_t *obj, PinName pin, edge_capture_handler handler, uint32_t id);
+
+/** Release the capture channel
+ *
+ * @param obj The edge capture object
+ */
+void edge_capture_free(edge_capture_t *obj);
+
+/** Enable/disable capture of an edge
+ *
+ * @param obj    The edge capture object
+ * @param event  The edge to capture, IRQ_RISE or IRQ_FALL
+ * @param enable The enable flag
+ */
+void edge_capture_set(edge_capture_t *obj, gpio_irq_event event, uint32_t enable);
+
+/** Get the pins that support edge capture
+ *
+ * Return a PinMap array of pins that have a capture channel.
+ * The array is terminated with {NC, NC, 0}.
+ *
+ * @return PinMap array
+ */
+const PinMap *edge_capture_pinmap(void);
+
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+#endif
+
+/** @}*/
@@ -108,6 +108,22 @@ void gpio_irq_enable(gpio_irq_t *obj);
  */
 void gpio_irq_disable(gpio_irq_t *obj);
 
+#if DEVICE_INTERRUPTIN_DIRECT
+/** Get the NVIC interrupt number serving this pin's GPIO interrupt
+ *
+ * Only available on targets declaring the INTERRUPTIN_DIRECT capability.
+ * The returned number lets a time-critical handler be registered straight
+ * into the relocated vector table with NVIC_SetVector, bypassing the
+ * driver dispatch entirely. Depending on the target the vector may be
+ * shared by a whole port or EXTI line group; a handler installed on it
+ * takes over every pin routed there.
+ *
+ * @param obj The GPIO object
+ * @return The IRQn of the vector that this pin's interrupt is routed to
+ */
+IRQn_Type gpio_irq_get_irqn(gpio_irq_t *obj);
+#endif
+
 /** Get the pins that support all GPIO IRQ tests
  *
  * Return a PinMap array of pins that support GPIO IRQ.
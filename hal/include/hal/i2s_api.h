@@ -0,0 +1,183 @@
+/** \addtogroup hal */
+/** @{*/
+
+/*
+ * Copyright (c) 2021 Arm Limited and affiliates.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MBED_I2S_API_H
+#define MBED_I2S_API_H
+
+#include "device.h"
+#include "pinmap.h"
+
+#if DEVICE_I2S
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \defgroup hal_i2s I2S HAL API
+ * Low-level interface to the I2S/SAI audio serial interfaces of a target.
+ *
+ * Audio streaming needs a sample delivered every frame period without
+ * exception, which only a hardware-paced circular DMA can guarantee. This
+ * module exposes the target's I2S or SAI blocks in exactly that shape: the
+ * peripheral clocks samples between the wire and a caller-provided ring
+ * buffer via DMA, and software is notified at the half and full points of
+ * the ring - the conventional double-buffer cadence - to produce or
+ * consume the idle half.
+ *
+ * One i2s_t handles one direction. Full duplex uses two instances, the
+ * second initialized as clock slave on the same bit and word clock pins.
+ *
+ * # Defined behavior
+ * * After ::i2s_transfer_start the peripheral transfers continuously,
+ * wrapping at the buffer end, until ::i2s_transfer_stop; no per-sample or
+ * per-period software action is required to keep the stream running.
+ * * The event handler is called from interrupt context with
+ * I2S_EVENT_HALF_COMPLETE and I2S_EVENT_COMPLETE strictly alternating
+ * while the stream keeps up.
+ * * A transmit FIFO starved of data or a receive FIFO overflowing raises
+ * I2S_EVENT_ERROR; the stream continues.
+ * * Sample rate, word length, channel count and format only change while
+ * no transfer is active.
+ *
+ * # Undefined behavior
+ * * Calling any function other than ::i2s_init on an uninitialized object.
+ * * Freeing or reusing the ring buffer while a transfer is active.
+ *
+ * @{
+ */
+
+/** I2S HAL structure. i2s_s is declared in the target's HAL
+ */
+typedef struct i2s_s i2s_t;
+
+/** Direction of an I2S instance */
+typedef enum {
+    I2S_TRANSMIT, /**< Memory to wire */
+    I2S_RECEIVE   /**< Wire to memory */
+} i2s_direction_t;
+
+/** Frame format on the wire */
+typedef enum {
+    I2S_PHILIPS,         /**< Standard I2S: data one bit clock after word select */
+    I2S_LEFT_JUSTIFIED,  /**< Data aligned to the word select edge */
+    I2S_RIGHT_JUSTIFIED, /**< Data aligned to the end of the word slot */
+    I2S_PCM_SHORT        /**< PCM with a one-clock frame sync pulse */
+} i2s_format_t;
+
+/** Stream events reported to the transfer handler */
+typedef enum {
+    I2S_EVENT_HALF_COMPLETE, /**< The first half of the ring was transferred */
+    I2S_EVENT_COMPLETE,      /**< The second half of the ring was transferred */
+    I2S_EVENT_ERROR          /**< Transmit underrun or receive overrun in hardware */
+} i2s_event_t;
+
+/** Transfer notification, called in interrupt context.
+ *
+ * @param context Context pointer given to ::i2s_transfer_start.
+ * @param event   The event being reported.
+ */
+typedef void (*i2s_event_handler_t)(void *context, i2s_event_t event);
+
+/** Initialize the I2S peripheral on the given pins.
+ *
+ * The instance is created clock master unless another instance already
+ * drives the same clock pins, in which case it attaches as slave - this is
+ * how the receive side of a full-duplex pair is created.
+ *
+ * @param obj       The I2S object to initialize.
+ * @param direction Whether this instance transmits or receives.
+ * @param data      The serial data pin.
+ * @param ws        The word select / frame sync pin.
+ * @param sck       The bit clock pin.
+ * @param mclk      The master clock output pin, or NC if unused.
+ * @return 0 on success, -1 if the pins are not supported.
+ */
+int i2s_init(i2s_t *obj, i2s_direction_t direction, PinName data, PinName ws, PinName sck, PinName mclk);
+
+/** Release the peripheral, the DMA channel and the pins.
+ *
+ * @param obj The I2S object.
+ */
+void i2s_free(i2s_t *obj);
+
+/** Configure the audio format. Only valid while no transfer is active.
+ *
+ * @param obj         The I2S object.
+ * @param sample_rate Frame rate in Hz, for example 48000.
+ * @param word_bits   Bits per sample: 16, 24 or 32.
+ * @param channels    Channels per frame: 1 or 2.
+ * @param format      Frame format on the wire.
+ * @return 0 on success, -1 if the combination is not supported or a
+ *         transfer is active.
+ */
+int i2s_configure(i2s_t *obj, uint32_t sample_rate, uint8_t word_bits, uint8_t channels, i2s_format_t format);
+
+/** Start a continuous circular DMA transfer over the given ring buffer.
+ *
+ * The handler is called at the ring's half and full points; the buffer
+ * must hold a whole number of frames in each half.
+ *
+ * @param obj     The I2S object.
+ * @param buffer  The ring buffer, valid and DMA-reachable until stop.
+ * @param length  Size of the ring buffer in bytes.
+ * @param handler Event handler, called in interrupt context.
+ * @param context Opaque pointer passed through to the handler.
+ * @return 0 on success, -1 if a transfer is already active.
+ */
+int i2s_transfer_start(i2s_t *obj, void *buffer, size_t length, i2s_event_handler_t handler, void *context);
+
+/** Stop the active transfer and silence the output.
+ *
+ * @param obj The I2S object.
+ */
+void i2s_transfer_stop(i2s_t *obj);
+
+/** Check whether a transfer is active.
+ *
+ * @param obj The I2S object.
+ * @return true if the peripheral is streaming.
+ */
+bool i2s_active(i2s_t *obj);
+
+/** Get the pins that support I2S serial data.
+ *
+ * Return a PinMap array of pins that support I2S data in or out. The
+ * array is terminated with {NC, NC, 0}.
+ *
+ * @return PinMap array
+ */
+const PinMap *i2s_data_pinmap(void);
+
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+#endif
+
+/** @}*/
@@ -0,0 +1,135 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** \addtogroup hal */
+/** @{*/
+
+#ifndef MBED_PTP_API_H
+#define MBED_PTP_API_H
+
+#include "device.h"
+
+#include <stdint.h>
+
+#if DEVICE_PTP
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \defgroup hal_ptp PTP hal
+ *
+ * Low level interface to the IEEE 1588 (PTP) hardware clock of a target's
+ * Ethernet MAC. The clock counts in seconds and nanoseconds, can be set
+ * outright, slewed by a signed offset, and trimmed in rate by parts per
+ * billion - the three operations a PTP servo needs.
+ *
+ * # Defined behaviour
+ * * The function ::ptp_init is safe to call repeatedly.
+ * * ::ptp_read returns a monotonically increasing time between writes -
+ *   frequency adjustment never makes the clock step or run backwards.
+ * * ::ptp_adjust_frequency applies relative to the nominal rate, not
+ *   cumulatively: passing 0 returns the clock to nominal.
+ * * Adjustments survive ::ptp_free / ::ptp_init cycles; init does not
+ *   reset the clock.
+ * * All functions are callable from interrupt context.
+ *
+ * # Undefined behaviour
+ * * Calling any function other than ::ptp_init before the PTP clock has
+ *   been initialized.
+ * * Frequency adjustments beyond the range reported by
+ *   ::ptp_get_info.
+ *
+ * @{
+ */
+
+/** PTP hardware clock time, as seconds and nanoseconds.
+ *
+ * Seconds are 64-bit to carry the 48-bit seconds field of PTP
+ * timestamps without truncation.
+ */
+typedef struct ptp_timestamp {
+    uint64_t seconds;
+    uint32_t nanoseconds;   /**< 0-999999999 */
+} ptp_timestamp_t;
+
+/** PTP clock capabilities.
+ */
+typedef struct ptp_info {
+    int32_t max_frequency_adjustment;   /**< Largest magnitude ::ptp_adjust_frequency accepts, in parts per billion */
+} ptp_info_t;
+
+/** Initialize the PTP hardware clock
+ *
+ * Enables access to the clock and starts it counting if it is not
+ * already. Does not reset the time or any adjustment.
+ */
+void ptp_init(void);
+
+/** Release the PTP hardware clock
+ *
+ * The clock keeps counting; only software access is shut down.
+ */
+void ptp_free(void);
+
+/** Read the current time of the PTP clock
+ *
+ * @param timestamp Destination for the current time
+ */
+void ptp_read(ptp_timestamp_t *timestamp);
+
+/** Set the PTP clock outright
+ *
+ * Used for the initial coarse set; once a servo is in lock it should
+ * slew with ::ptp_adjust_offset and ::ptp_adjust_frequency instead.
+ *
+ * @param timestamp Time to set
+ */
+void ptp_write(const ptp_timestamp_t *timestamp);
+
+/** Step the PTP clock by a signed offset
+ *
+ * @param offset_ns Nanoseconds to add to the current time, negative to
+ *                  move the clock backwards
+ */
+void ptp_adjust_offset(int64_t offset_ns);
+
+/** Trim the rate of the PTP clock
+ *
+ * @param adjustment_ppb Parts per billion to run fast (positive) or
+ *                       slow (negative) of nominal; 0 restores nominal
+ */
+void ptp_adjust_frequency(int32_t adjustment_ppb);
+
+/** Get the capabilities of the PTP clock
+ *
+ * @param info Destination for the capabilities
+ */
+void ptp_get_info(ptp_info_t *info);
+
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DEVICE_PTP */
+
+#endif
+
+/** @}*/
@@ -0,0 +1,150 @@
+/** \addtogroup hal */
+/** @{*/
+
+/*
+ * Copyright (c) 2021 Arm Limited and affiliates.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MBED_PULSE_COUNTER_API_H
+#define MBED_PULSE_COUNTER_API_H
+
+#include "device.h"
+#include "pinmap.h"
+
+#if DEVICE_PULSE_COUNTER
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \defgroup hal_pulse_counter Pulse counter HAL API
+ * Low-level interface to hardware pulse-counting and quadrature-decoding
+ * timer modes of a target.
+ *
+ * Counting edges in software tops out at tens of kilohertz and saturates
+ * the CPU doing it; the counter peripherals present on every supported MCU
+ * family count in hardware at megahertz rates with no CPU involvement.
+ * This module exposes those modes: the counter register advances (and, in
+ * quadrature modes, retreats) purely in hardware, and software only reads
+ * the count or reacts to the rare overflow interrupt.
+ *
+ * # Defined behavior
+ * * The counter starts from zero at ::pulse_counter_init and counts with
+ * no software involvement per edge.
+ * * ::pulse_counter_read returns the momentary hardware count; it is
+ * interrupt safe and never disturbs counting.
+ * * In quadrature modes the count decrements on reverse motion, wrapping
+ * modulo 2^width; the overflow handler reports the wrap direction so a
+ * wider position can be reconstructed (see mbed::QuadratureEncoder).
+ * * The overflow handler is called from interrupt context.
+ *
+ * # Undefined behavior
+ * * Calling any function other than ::pulse_counter_init on an
+ * uninitialized counter.
+ * * Edge rates beyond the peripheral's input filter specification.
+ *
+ * @{
+ */
+
+/** Pulse counter HAL structure. pulse_counter_s is declared in the target's HAL
+ */
+typedef struct pulse_counter_s pulse_counter_t;
+
+/** Counting mode */
+typedef enum {
+    PULSE_COUNTER_RISING,         /**< Count rising edges on the count input */
+    PULSE_COUNTER_FALLING,        /**< Count falling edges on the count input */
+    PULSE_COUNTER_BOTH,           /**< Count both edges on the count input */
+    PULSE_COUNTER_QUADRATURE_X2,  /**< Quadrature decode, counting edges of input A */
+    PULSE_COUNTER_QUADRATURE_X4   /**< Quadrature decode, counting edges of both inputs */
+} pulse_counter_mode_t;
+
+/** Overflow notification, called in interrupt context on counter wrap.
+ *
+ * @param context   Context pointer given at handler registration.
+ * @param direction +1 for a wrap while counting up, -1 while counting down.
+ */
+typedef void (*pulse_counter_overflow_handler_t)(void *context, int direction);
+
+/** Initialize the pulse counter on the given pins and start counting.
+ *
+ * @param obj   The pulse counter object to initialize.
+ * @param pin_a The count input, or quadrature phase A.
+ * @param pin_b The quadrature phase B input; NC in non-quadrature modes.
+ * @param mode  The counting mode.
+ * @return 0 on success, -1 if the pins or mode are not supported.
+ */
+int pulse_counter_init(pulse_counter_t *obj, PinName pin_a, PinName pin_b, pulse_counter_mode_t mode);
+
+/** Stop the counter and release the pins and the timer.
+ *
+ * @param obj The pulse counter object.
+ */
+void pulse_counter_free(pulse_counter_t *obj);
+
+/** Read the momentary hardware count. Interrupt safe.
+ *
+ * @param obj The pulse counter object.
+ * @return The count, in the range [0, 2^width).
+ */
+uint32_t pulse_counter_read(pulse_counter_t *obj);
+
+/** Reset the hardware count to zero.
+ *
+ * @param obj The pulse counter object.
+ */
+void pulse_counter_reset(pulse_counter_t *obj);
+
+/** Get the width of the hardware counter in bits.
+ *
+ * @param obj The pulse counter object.
+ * @return Counter width in bits, for example 16 or 32.
+ */
+uint8_t pulse_counter_get_width(pulse_counter_t *obj);
+
+/** Register a handler for counter overflow and underflow.
+ *
+ * At most one handler is registered per counter; NULL deregisters.
+ *
+ * @param obj     The pulse counter object.
+ * @param handler Handler called on each wrap, in interrupt context.
+ * @param context Opaque pointer passed through to the handler.
+ */
+void pulse_counter_set_overflow_handler(pulse_counter_t *obj, pulse_counter_overflow_handler_t handler, void *context);
+
+/** Get the pins that support pulse counting.
+ *
+ * Return a PinMap array of pins that support pulse counting as the count
+ * or phase A input. The array is terminated with {NC, NC, 0}.
+ *
+ * @return PinMap array
+ */
+const PinMap *pulse_counter_pinmap(void);
+
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+#endif
+
+/** @}*/
@@ -22,6 +22,7 @@
 
 #include "device.h"
 #include "pinmap.h"
+#include <stdbool.h>
 
 #if DEVICE_PWMOUT
 
@@ -173,6 +174,76 @@ const PinMap *pwmout_pinmap(void);
 
 /**@}*/
 
+#if DEVICE_PWMOUT_SEQUENCE
+
+/** One cycle of a PWM sequence
+ */
+typedef struct {
+    uint32_t pulsewidth_ns; /**< High time of the cycle in nanoseconds */
+    uint32_t period_ns;     /**< Total length of the cycle in nanoseconds */
+} pwmout_seq_entry_t;
+
+/** PWM sequence events
+ */
+typedef enum {
+    PWMOUT_SEQ_HALF_COMPLETE, /**< The first half of the entry buffer has been played */
+    PWMOUT_SEQ_COMPLETE       /**< The last entry of the buffer has been played */
+} pwmout_seq_event;
+
+typedef void (*pwmout_seq_handler)(uint32_t id, pwmout_seq_event event);
+
+/**
+ * \defgroup hal_pwmout_seq Pwmout sequence hal functions
+ *
+ * Targets whose PWM timers can be fed by DMA implement this API and
+ * define DEVICE_PWMOUT_SEQUENCE. The DMA engine reloads the compare and
+ * period registers from the entry buffer at each timer update event, so
+ * the waveform plays out with no CPU involvement. The handler is invoked
+ * from the DMA interrupt when half of the buffer and the whole buffer
+ * have been played, allowing the halves to be refilled while the other
+ * half is playing.
+ *
+ * # Defined behavior
+ * * ::pwmout_seq_start begins autonomous playback of the entry buffer
+ * * In circular mode playback restarts from the first entry after the last
+ *   and the handler keeps being invoked at every half and full pass
+ * * In one-shot mode the output holds the duty of the last entry after
+ *   ::PWMOUT_SEQ_COMPLETE
+ * * The entry buffer is read by the DMA and must stay valid until playback
+ *   stops
+ * * The handler may be invoked from interrupt context
+ * * ::pwmout_seq_stop ends playback; the static duty and period configured
+ *   through ::pwmout_write and ::pwmout_period_us are restored
+ *
+ * # Undefined behavior
+ * * Calling ::pwmout_seq_start before ::pwmout_init
+ * * Modifying an entry while the DMA is reading it
+ *
+ * @{
+ */
+
+/** Start autonomous playback of a PWM sequence
+ *
+ * @param obj      The pwmout object
+ * @param entries  Buffer of cycles to play, one after the other
+ * @param count    Number of entries in the buffer
+ * @param circular True to loop over the buffer until stopped, false to play it once
+ * @param handler  The handler invoked at half and full buffer completion
+ * @param id       The object ID passed to the handler (id != 0, 0 is reserved)
+ * @return 0 on success, -1 if no DMA channel or timer support is available
+ */
+int pwmout_seq_start(pwmout_t *obj, const pwmout_seq_entry_t *entries, uint32_t count, bool circular, pwmout_seq_handler handler, uint32_t id);
+
+/** Stop sequence playback
+ *
+ * @param obj The pwmout object
+ */
+void pwmout_seq_stop(pwmout_t *obj);
+
+/**@}*/
+
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -28,8 +28,53 @@
 #include "qspi_api.h"
 #include "ospi_api.h"
 #include "can_api.h"
+#include "platform/mbed_assert.h"
 #include <mstd_cstddef>
 
+/** Validate a map returned by one of the get_*_pinmap() functions
+ *
+ * Returns the map unchanged when every pin resolved to a peripheral.
+ * When the lookup failed, the assert call is not constexpr, so
+ * evaluating pinmap_validated() at compile time turns the unresolved
+ * mapping into a build error instead of an NC peripheral discovered at
+ * run time; in a runtime evaluation it asserts.
+ *
+ * On targets without STATIC_PINMAP_READY the maps deliberately carry NC
+ * peripherals and are resolved by the HAL at init time, so validation
+ * passes them through.
+ *
+ * @param map Map returned by a get_*_pinmap() function
+ * @return The validated map
+ */
+template <typename T>
+MSTD_CONSTEXPR_FN_14 T pinmap_validated(T map)
+{
+#if STATIC_PINMAP_READY
+    if (map.peripheral == (int) NC) {
+        mbed_assert_internal("pinmap did not resolve", __FILE__, __LINE__);
+    }
+#endif
+    return map;
+}
+
+/** Define a pin mapping resolved and validated at compile time
+ *
+ * Expands to a static constexpr object definition, so the pinmap table
+ * search runs entirely in the compiler, the image carries only the
+ * resolved map and a mapping that does not resolve fails the build.
+ *
+ * @code
+ * MBED_STATIC_PINMAP(spi_map, get_spi_pinmap, D11, D12, D13, NC);
+ * SPI spi(spi_map);
+ * @endcode
+ *
+ * @param name Name of the object to define
+ * @param func The get_*_pinmap() function to resolve with
+ * @param ...  Pins forwarded to the lookup function
+ */
+#define MBED_STATIC_PINMAP(name, func, ...) \
+    static MSTD_CONSTEXPR_OBJ_14 auto name = pinmap_validated(func(__VA_ARGS__))
+
 #if STATIC_PINMAP_READY
 #include "PeripheralPinMaps.h"
 
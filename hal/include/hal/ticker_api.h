@@ -105,11 +105,38 @@ typedef struct {
 #define MBED_TICKER_CONSTANT_MASK LP_TICKER_MASK
 #endif
 
+/** Number of buckets in the optional ticker timing wheel.
+ *
+ * With the default of 0 pending events are kept on a single sorted list,
+ * whose insert walks the list with interrupts disabled - O(n) per insert.
+ * A power-of-two bucket count instead spreads events over a timing wheel:
+ * inserts and removes touch only one short bucket chain, so heavy timer
+ * fan-out no longer degrades interrupt response. The trade-off is a scan
+ * across the bucket heads whenever the earliest event is consumed.
+ */
+#ifndef MBED_CONF_HAL_TICKER_WHEEL_BUCKETS
+#define MBED_CONF_HAL_TICKER_WHEEL_BUCKETS 0
+#endif
+
+/** Log2 of the wheel bucket width in microseconds.
+ *
+ * The default of 10 gives roughly 1 ms buckets; events closer together
+ * than the bucket width share a chain.
+ */
+#ifndef MBED_CONF_HAL_TICKER_WHEEL_GRANULARITY_SHIFT
+#define MBED_CONF_HAL_TICKER_WHEEL_GRANULARITY_SHIFT 10
+#endif
+
 /** Ticker's event queue structure
  */
 typedef struct {
     ticker_event_handler event_handler; /**< Event handler */
     ticker_event_t *head;               /**< A pointer to head */
+#if MBED_CONF_HAL_TICKER_WHEEL_BUCKETS
+    /** Timing wheel chains holding every pending event except the earliest,
+     * which stays in head; each chain is sorted and typically short */
+    ticker_event_t *buckets[MBED_CONF_HAL_TICKER_WHEEL_BUCKETS];
+#endif
 #ifndef MBED_TICKER_CONSTANT_PERIOD_NUM
     uint32_t period_num;                /**< Ratio of period to 1us, numerator */
 #endif
@@ -128,6 +155,7 @@ typedef struct {
     uint32_t tick_remainder;            /**< Ticks that have not been added to base_time */
 #endif
     us_timestamp_t present_time;        /**< Store the timestamp used for present time */
+    uint32_t seq;                       /**< Sequence counter allowing lock-free reads of present time */
     bool initialized;                   /**< Indicate if the instance is initialized */
     bool dispatching;                   /**< The function ticker_irq_handler is dispatching */
     bool suspended;                     /**< Indicate if the instance is suspended */
@@ -0,0 +1,62 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hal/crypto_accel_api.h"
+#include "mbed_toolchain.h"
+#include <string.h>
+
+#if DEVICE_CRYPTO_ACCEL_AES
+
+/* Default CBC built on the mandatory ECB entry point, for engines that
+ * only do single-block operations. Targets whose engine chains natively
+ * override this and report CRYPTO_ACCEL_CAP_AES_CBC. */
+MBED_WEAK int crypto_accel_aes_crypt_cbc(const unsigned char *key,
+                                         unsigned int keybits, int encrypt,
+                                         unsigned char iv[16],
+                                         const unsigned char *input,
+                                         unsigned char *output,
+                                         unsigned int blocks)
+{
+    unsigned char block[16];
+
+    for (unsigned int b = 0; b < blocks; b++) {
+        if (encrypt) {
+            for (int i = 0; i < 16; i++) {
+                block[i] = input[i] ^ iv[i];
+            }
+            if (crypto_accel_aes_crypt_ecb(key, keybits, 1, block, output, 1) != 0) {
+                return -1;
+            }
+            memcpy(iv, output, 16);
+        } else {
+            // keep a copy so in-place decryption does not lose the IV
+            memcpy(block, input, 16);
+            if (crypto_accel_aes_crypt_ecb(key, keybits, 0, input, output, 1) != 0) {
+                return -1;
+            }
+            for (int i = 0; i < 16; i++) {
+                output[i] ^= iv[i];
+            }
+            memcpy(iv, block, 16);
+        }
+        input += 16;
+        output += 16;
+    }
+    return 0;
+}
+
+#endif /* DEVICE_CRYPTO_ACCEL_AES */
@@ -18,6 +18,7 @@
 #include <stddef.h>
 #include "hal/ticker_api.h"
 #include "platform/mbed_critical.h"
+#include "platform/mbed_atomic.h"
 #include "platform/mbed_assert.h"
 #include "platform/mbed_error.h"
 
@@ -97,6 +98,21 @@ static void update_present_time(const ticker_data_t *const ticker);
 #define TICKER_MAX_DELTA_US(queue) ((queue)->max_delta_us)
 #endif
 
+/* Mark the start and end of an update to the time state read by the
+ * lock-free path of ticker_read_us. Must be called with the critical
+ * section held - an odd count therefore never escapes an update, and
+ * readers interrupted by a complete update see the counter change.
+ */
+static inline void time_state_update_begin(ticker_event_queue_t *queue)
+{
+    core_util_atomic_store_u32(&queue->seq, queue->seq + 1);
+}
+
+static inline void time_state_update_end(ticker_event_queue_t *queue)
+{
+    core_util_atomic_store_u32(&queue->seq, queue->seq + 1);
+}
+
 #if COMPUTE_RATIO_FROM_FREQUENCY
 static inline uint32_t gcd(uint32_t a, uint32_t b)
 {
@@ -227,9 +243,16 @@ static void initialize(const ticker_data_t *ticker)
 
     ticker->queue->event_handler = NULL;
     ticker->queue->head = NULL;
+#if MBED_CONF_HAL_TICKER_WHEEL_BUCKETS
+    for (unsigned i = 0; i < MBED_CONF_HAL_TICKER_WHEEL_BUCKETS; i++) {
+        ticker->queue->buckets[i] = NULL;
+    }
+#endif
+    time_state_update_begin(ticker->queue);
     ticker->queue->tick_last_read = ticker->interface->read();
     TICKER_SET_TICK_REMAINDER(ticker->queue, 0);
     ticker->queue->present_time = 0;
+    time_state_update_end(ticker->queue);
     ticker->queue->dispatching = false;
     ticker->queue->suspended = false;
     ticker->queue->initialized = true;
@@ -278,25 +301,12 @@ static us_timestamp_t convert_timestamp(us_timestamp_t ref, timestamp_t timestam
 }
 
 /**
- * Update the present timestamp value of a ticker.
+ * Convert elapsed_ticks to us as (elapsed_ticks * period_num / period_den),
+ * adding in the remainder left over from the previous conversion and
+ * returning the new remainder through *remainder.
  */
-static void update_present_time(const ticker_data_t *const ticker)
+static uint64_t scale_ticks_to_us(const ticker_event_queue_t *queue, uint32_t elapsed_ticks, uint32_t *remainder)
 {
-    ticker_event_queue_t *queue = ticker->queue;
-    if (queue->suspended) {
-        return;
-    }
-    uint32_t ticker_time = ticker->interface->read();
-    if (ticker_time == queue->tick_last_read) {
-        // No work to do
-        return;
-    }
-
-    uint32_t elapsed_ticks = (ticker_time - queue->tick_last_read) & TICKER_BITMASK(queue);
-    queue->tick_last_read = ticker_time;
-
-    // Convert elapsed_ticks to elapsed_us as (elapsed_ticks * period_num / period_den)
-    // adding in any remainder from the last division
     uint64_t scaled_ticks;
     if (SLOW_MULTIPLY && TICKER_PERIOD_NUM_SHIFTS(queue) >= 0) {
         scaled_ticks = (uint64_t) elapsed_ticks << TICKER_PERIOD_NUM_SHIFTS(queue);
@@ -308,20 +318,45 @@ static void update_present_time(const ticker_data_t *const ticker)
         // Optimized for cases that don't need division
         elapsed_us = scaled_ticks;
     } else {
-        scaled_ticks += TICKER_TICK_REMAINDER(queue);
+        scaled_ticks += *remainder;
         if (TICKER_PERIOD_DEN_SHIFTS(queue) >= 0) {
             // Speed-optimised for shifts
             elapsed_us = scaled_ticks >> TICKER_PERIOD_DEN_SHIFTS(queue);
-            TICKER_SET_TICK_REMAINDER(queue, scaled_ticks - (elapsed_us << TICKER_PERIOD_DEN_SHIFTS(queue)));
+            *remainder = scaled_ticks - (elapsed_us << TICKER_PERIOD_DEN_SHIFTS(queue));
         } else {
             // General case division
             elapsed_us = scaled_ticks / TICKER_PERIOD_DEN(queue);
-            TICKER_SET_TICK_REMAINDER(queue, scaled_ticks - elapsed_us * TICKER_PERIOD_DEN(queue));
+            *remainder = scaled_ticks - elapsed_us * TICKER_PERIOD_DEN(queue);
         }
     }
+    return elapsed_us;
+}
+
+/**
+ * Update the present timestamp value of a ticker.
+ */
+static void update_present_time(const ticker_data_t *const ticker)
+{
+    ticker_event_queue_t *queue = ticker->queue;
+    if (queue->suspended) {
+        return;
+    }
+    uint32_t ticker_time = ticker->interface->read();
+    if (ticker_time == queue->tick_last_read) {
+        // No work to do
+        return;
+    }
+
+    uint32_t elapsed_ticks = (ticker_time - queue->tick_last_read) & TICKER_BITMASK(queue);
+    uint32_t remainder = TICKER_TICK_REMAINDER(queue);
+    uint64_t elapsed_us = scale_ticks_to_us(queue, elapsed_ticks, &remainder);
 
     // Update current time
+    time_state_update_begin(queue);
+    queue->tick_last_read = ticker_time;
+    TICKER_SET_TICK_REMAINDER(queue, remainder);
     queue->present_time += elapsed_us;
+    time_state_update_end(queue);
 }
 
 /**
@@ -365,6 +400,68 @@ static timestamp_t compute_tick_round_up(const ticker_data_t *const ticker, us_t
     return (queue->tick_last_read + delta) & TICKER_BITMASK(queue);
 }
 
+#if MBED_CONF_HAL_TICKER_WHEEL_BUCKETS
+
+MBED_STATIC_ASSERT((MBED_CONF_HAL_TICKER_WHEEL_BUCKETS & (MBED_CONF_HAL_TICKER_WHEEL_BUCKETS - 1)) == 0,
+                   "Ticker wheel bucket count must be a power of two");
+
+/* The wheel keeps the earliest pending event in queue->head, as the sorted
+ * list did, so dispatch and next-timestamp queries are untouched. Every
+ * other event hangs off the bucket its timestamp falls into; chains are
+ * sorted but typically hold only the few events within one bucket width of
+ * each other, so all the walks below are short and the critical sections
+ * around them bounded. */
+
+static unsigned wheel_bucket(us_timestamp_t timestamp)
+{
+    return (unsigned)((timestamp >> MBED_CONF_HAL_TICKER_WHEEL_GRANULARITY_SHIFT) &
+                      (MBED_CONF_HAL_TICKER_WHEEL_BUCKETS - 1));
+}
+
+static void wheel_push(ticker_event_queue_t *queue, ticker_event_t *obj)
+{
+    ticker_event_t **pp = &queue->buckets[wheel_bucket(obj->timestamp)];
+    while (*pp != NULL && (*pp)->timestamp <= obj->timestamp) {
+        pp = &(*pp)->next;
+    }
+    obj->next = *pp;
+    *pp = obj;
+}
+
+static void wheel_remove(ticker_event_queue_t *queue, ticker_event_t *obj)
+{
+    ticker_event_t **pp = &queue->buckets[wheel_bucket(obj->timestamp)];
+    while (*pp != NULL) {
+        if (*pp == obj) {
+            *pp = obj->next;
+            return;
+        }
+        pp = &(*pp)->next;
+    }
+}
+
+/* Unlink and return the earliest pending event - the minimum over the
+ * bucket chain heads, since chains are sorted. */
+static ticker_event_t *wheel_pop_earliest(ticker_event_queue_t *queue)
+{
+    ticker_event_t **earliest = NULL;
+    for (unsigned i = 0; i < MBED_CONF_HAL_TICKER_WHEEL_BUCKETS; i++) {
+        ticker_event_t *p = queue->buckets[i];
+        if (p != NULL && (earliest == NULL || p->timestamp < (*earliest)->timestamp)) {
+            earliest = &queue->buckets[i];
+        }
+    }
+    if (earliest == NULL) {
+        return NULL;
+    }
+    ticker_event_t *obj = *earliest;
+    *earliest = obj->next;
+    obj->next = NULL;
+    return obj;
+}
+
+#endif // MBED_CONF_HAL_TICKER_WHEEL_BUCKETS
+
 //NOTE: Must be called from critical section!
 static void insert_event(const ticker_data_t *const ticker, ticker_event_t *obj, us_timestamp_t timestamp, uint32_t id)
 {
@@ -374,6 +471,22 @@ static void insert_event(const ticker_data_t *const ticker, ticker_event_t *obj,
     obj->timestamp = timestamp;
     obj->id = id;
 
+#if MBED_CONF_HAL_TICKER_WHEEL_BUCKETS
+    if (queue->head == NULL || timestamp < queue->head->timestamp) {
+        /* New earliest event - demote the previous head into its bucket */
+        if (queue->head != NULL) {
+            wheel_push(queue, queue->head);
+        }
+        obj->next = NULL;
+        queue->head = obj;
+        schedule_interrupt(ticker);
+    } else {
+        wheel_push(queue, obj);
+        if (timestamp <= queue->present_time) {
+            schedule_interrupt(ticker);
+        }
+    }
+#else
     /* Go through the list until we either reach the end, or find
        an element this should come before (which is possibly the
        head). */
@@ -401,6 +514,7 @@ static void insert_event(const ticker_data_t *const ticker, ticker_event_t *obj,
     if (prev == NULL || timestamp <= queue->present_time) {
         schedule_interrupt(ticker);
     }
+#endif
 }
 
 /**
@@ -503,7 +617,11 @@ void ticker_irq_handler(const ticker_data_t *const ticker)
             // This event was in the past:
             //      point to the following one and execute its handler
             ticker_event_t *p = ticker->queue->head;
+#if MBED_CONF_HAL_TICKER_WHEEL_BUCKETS
+            queue->head = wheel_pop_earliest(queue);
+#else
             queue->head = queue->head->next;
+#endif
             if (queue->event_handler != NULL) {
                 (*queue->event_handler)(p->id); // NOTE: the handler can set new events
             }
@@ -555,6 +673,15 @@ void ticker_remove_event(const ticker_data_t *const ticker, ticker_event_t *obj)
     ticker_event_queue_t *queue = ticker->queue;
 
     // remove this object from the list
+#if MBED_CONF_HAL_TICKER_WHEEL_BUCKETS
+    if (queue->head == obj) {
+        // the earliest event, so promote the next one out of the wheel
+        queue->head = wheel_pop_earliest(queue);
+        schedule_interrupt(ticker);
+    } else {
+        wheel_remove(queue, obj);
+    }
+#else
     if (queue->head == obj) {
         // first in the list, so just drop me
         queue->head = obj->next;
@@ -570,6 +697,7 @@ void ticker_remove_event(const ticker_data_t *const ticker, ticker_event_t *obj)
             p = p->next;
         }
     }
+#endif
 
     core_util_critical_section_exit();
 }
@@ -581,16 +709,39 @@ timestamp_t ticker_read(const ticker_data_t *const ticker)
 
 us_timestamp_t ticker_read_us(const ticker_data_t *const ticker)
 {
-    us_timestamp_t ret;
-
     initialize(ticker);
 
-    core_util_critical_section_enter();
-    update_present_time(ticker);
-    ret = ticker->queue->present_time;
-    core_util_critical_section_exit();
+    ticker_event_queue_t *queue = ticker->queue;
 
-    return ret;
+    /* Lock-free read: snapshot the cached 64 bit time under the sequence
+     * counter, then add the ticks elapsed since the cache was last brought
+     * up to date. No critical section is entered and the cached state is
+     * not written back, so an update from the ticker interrupt arriving
+     * mid-snapshot only causes a retry.
+     */
+    while (true) {
+        uint32_t seq = core_util_atomic_load_u32(&queue->seq);
+        if (seq & 1) {
+            // An update is in flight - reread the counter
+            continue;
+        }
+        us_timestamp_t present_time = queue->present_time;
+        uint32_t tick_last_read = queue->tick_last_read;
+        uint32_t remainder = TICKER_TICK_REMAINDER(queue);
+        bool suspended = queue->suspended;
+        if (core_util_atomic_load_u32(&queue->seq) != seq) {
+            continue;
+        }
+
+        if (suspended) {
+            return present_time;
+        }
+
+        // The snapshot is older than or equal to the hardware read, so the
+        // elapsed ticks between them always bring the result up to now
+        uint32_t elapsed_ticks = (ticker->interface->read() - tick_last_read) & TICKER_BITMASK(queue);
+        return present_time + scale_ticks_to_us(queue, elapsed_ticks, &remainder);
+    }
 }
 
 int ticker_get_next_timestamp(const ticker_data_t *const data, timestamp_t *timestamp)
@@ -627,7 +778,9 @@ void ticker_suspend(const ticker_data_t *const ticker)
 {
     core_util_critical_section_enter();
 
+    time_state_update_begin(ticker->queue);
     ticker->queue->suspended = true;
+    time_state_update_end(ticker->queue);
 
     core_util_critical_section_exit();
 }
@@ -636,10 +789,13 @@ void ticker_resume(const ticker_data_t *const ticker)
 {
     core_util_critical_section_enter();
 
+    time_state_update_begin(ticker->queue);
     ticker->queue->suspended = false;
     if (ticker->queue->initialized) {
         ticker->queue->tick_last_read = ticker->interface->read();
-
+    }
+    time_state_update_end(ticker->queue);
+    if (ticker->queue->initialized) {
         update_present_time(ticker);
         schedule_interrupt(ticker);
     } else {
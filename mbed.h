@@ -60,6 +60,7 @@
 #include "drivers/PortIn.h"
 #include "drivers/PortInOut.h"
 #include "drivers/PortOut.h"
+#include "drivers/PortScanner.h"
 #include "drivers/AnalogIn.h"
 #include "drivers/AnalogOut.h"
 #include "drivers/PwmOut.h"
@@ -71,6 +72,7 @@
 #include "drivers/UnbufferedSerial.h"
 #include "drivers/BufferedSerial.h"
 #include "drivers/FlashIAP.h"
+#include "drivers/FlashUpdatePipeline.h"
 #include "drivers/MbedCRC.h"
 #include "drivers/QSPI.h"
 #include "drivers/Watchdog.h"
@@ -88,6 +90,8 @@
 #include "drivers/RealTimeClock.h"
 #include "platform/LocalFileSystem.h"
 #include "drivers/InterruptIn.h"
+#include "drivers/TimestampedInterruptIn.h"
+#include "drivers/DmaCopy.h"
 #include "platform/mbed_wait_api.h"
 #include "platform/mbed_thread.h"
 #include "hal/sleep_api.h"
@@ -26,6 +26,17 @@
 #include "platform/NonCopyable.h"
 #include "platform/FileHandle.h"
 
+/* Number of bytes getc() pulls from the FileHandle in one read. With the
+ * default of 1 every character is a separate FileHandle call, matching the
+ * historical behaviour. Raising it makes the parser drain whole received
+ * chunks per call, which cuts the per-character overhead considerably at
+ * sustained data rates; it requires the FileHandle to follow the POSIX
+ * read semantics of returning pending data immediately (BufferedSerial
+ * does). */
+#ifndef MBED_CONF_PLATFORM_ATCMDPARSER_RX_CHUNK_SIZE
+#define MBED_CONF_PLATFORM_ATCMDPARSER_RX_CHUNK_SIZE 1
+#endif
+
 namespace mbed {
 /** \addtogroup platform-public-api Platform */
 /** @{*/
@@ -76,8 +87,17 @@ private:
         const char *prefix;
         mbed::Callback<void()> cb;
         oob *next;
+        // Chains the candidates still matching the current line
+        oob *next_active;
     };
     oob *_oobs;
+    oob *_oob_active;
+
+    // Lookahead chunk for getc()
+    char _rx_chunk[MBED_CONF_PLATFORM_ATCMDPARSER_RX_CHUNK_SIZE];
+    int _rx_chunk_pos;
+    int _rx_chunk_len;
+    bool _buffer_owned;
 
     /**
      * Receive an AT response
@@ -110,7 +130,8 @@ public:
      */
     ATCmdParser(FileHandle *fh, const char *output_delimiter = "\r",
                 int buffer_size = 256, int timeout = 8000, bool debug = false)
-        : _fh(fh), _buffer_size(buffer_size), _oob_cb_count(0), _in_prev(0), _aborted(false), _oobs(NULL)
+        : _fh(fh), _buffer_size(buffer_size), _oob_cb_count(0), _in_prev(0), _aborted(false), _oobs(NULL),
+          _oob_active(NULL), _rx_chunk_pos(0), _rx_chunk_len(0), _buffer_owned(true)
     {
         _buffer = new char[buffer_size];
         set_timeout(timeout);
@@ -118,6 +139,30 @@ public:
         debug_on(debug);
     }
 
+    /**
+     * Constructor using caller-provided working storage
+     *
+     * Lets the transaction buffer come from outside the heap - for example
+     * from an ArenaAllocator region - so the parser performs no allocation
+     * of its own. The storage must outlive the parser.
+     *
+     * @param fh A FileHandle to the digital interface, used for AT commands
+     * @param buffer Working storage for transactions
+     * @param buffer_size Size of the storage in bytes
+     * @param output_delimiter End of command-line termination
+     * @param timeout Timeout of the connection
+     * @param debug Turns on/off debug output for AT commands
+     */
+    ATCmdParser(FileHandle *fh, char *buffer, int buffer_size,
+                const char *output_delimiter = "\r", int timeout = 8000, bool debug = false)
+        : _fh(fh), _buffer_size(buffer_size), _buffer(buffer), _oob_cb_count(0), _in_prev(0), _aborted(false), _oobs(NULL),
+          _oob_active(NULL), _rx_chunk_pos(0), _rx_chunk_len(0), _buffer_owned(false)
+    {
+        set_timeout(timeout);
+        set_delimiter(output_delimiter);
+        debug_on(debug);
+    }
+
     /**
      * Destructor
      */
@@ -128,7 +173,9 @@ public:
             _oobs = oob->next;
             delete oob;
         }
-        delete[] _buffer;
+        if (_buffer_owned) {
+            delete[] _buffer;
+        }
     }
 
     /**
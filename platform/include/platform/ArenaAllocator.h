@@ -0,0 +1,170 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_ARENAALLOCATOR_H
+#define MBED_ARENAALLOCATOR_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "platform/mbed_atomic.h"
+#include "platform/NonCopyable.h"
+
+namespace mbed {
+
+/** \addtogroup platform-public-api */
+/** @{*/
+/**
+ * \defgroup platform_ArenaAllocator ArenaAllocator class
+ * @{
+ */
+
+/** A region allocator over a fixed backing buffer.
+ *
+ * Allocation is a bump of an offset, so it cannot fragment and never takes
+ * the malloc lock; the whole region is freed wholesale with an O(1) reset()
+ * or unwound to a saved mark. This fits request-scoped work such as packet
+ * parsing, where everything allocated while handling one request is dead
+ * once the request completes.
+ *
+ * The bump is performed with an atomic compare-and-swap, so alloc() may be
+ * called from interrupt handlers and from multiple threads concurrently.
+ * reset() and rewind() release memory behind any other context still using
+ * it, so they require exclusive access to the arena.
+ *
+ * Individual allocations cannot be freed - that is the trade-off that makes
+ * the allocator constant-time and fragmentation-free. Allocations are
+ * aligned suitably for any object type.
+ *
+ * @note Synchronization level: Interrupt safe (alloc), not protected
+ *       (reset/rewind)
+ */
+class ArenaAllocator : private NonCopyable<ArenaAllocator> {
+public:
+    /** Create an arena over caller-provided storage.
+     *
+     *  @param buffer Backing storage for the arena.
+     *  @param size   Size of the backing storage in bytes.
+     */
+    ArenaAllocator(void *buffer, size_t size)
+        : _buffer(static_cast<uint8_t *>(buffer)), _size(size), _offset(0)
+    {
+    }
+
+    /** Allocate a block from the arena.
+     *
+     *  @param size Number of bytes to allocate.
+     *  @return Pointer to the block, or NULL if the arena is exhausted.
+     */
+    void *alloc(size_t size)
+    {
+        if (size > _size) {
+            return NULL;
+        }
+        size = (size + alignment - 1) & ~(alignment - 1);
+        uint32_t offset = core_util_atomic_load_u32(&_offset);
+        uint32_t next;
+        do {
+            if (size > _size - offset) {
+                return NULL;
+            }
+            next = offset + size;
+        } while (!core_util_atomic_cas_u32(&_offset, &offset, next));
+        return _buffer + offset;
+    }
+
+    /** Free every allocation made from the arena. O(1).
+     *
+     * Requires exclusive access: no other context may hold or allocate
+     * arena memory across this call.
+     */
+    void reset()
+    {
+        core_util_atomic_store_u32(&_offset, 0);
+    }
+
+    /** Take a mark of the current allocation point, to rewind() to later. */
+    size_t mark() const
+    {
+        return core_util_atomic_load_u32(&_offset);
+    }
+
+    /** Free every allocation made since the given mark was taken. O(1).
+     *
+     * Requires exclusive access, like reset().
+     *
+     *  @param mark A value returned by mark().
+     */
+    void rewind(size_t mark)
+    {
+        core_util_atomic_store_u32(&_offset, mark);
+    }
+
+    /** Get the number of bytes currently allocated, including alignment padding. */
+    size_t used() const
+    {
+        return core_util_atomic_load_u32(&_offset);
+    }
+
+    /** Get the number of bytes still available. */
+    size_t remaining() const
+    {
+        return _size - used();
+    }
+
+    /** An RAII scope that rewinds the arena on destruction.
+     *
+     * Everything allocated from the arena while a Scope is alive is freed
+     * when the Scope is destroyed, in the style of ScopedLock:
+     *
+     * @code
+     * void handle_request() {
+     *     ArenaAllocator::Scope scope(arena);
+     *     ... parse using arena.alloc() ...
+     * } // all parse allocations released here
+     * @endcode
+     */
+    class Scope : private NonCopyable<Scope> {
+    public:
+        Scope(ArenaAllocator &arena) : _arena(arena), _mark(arena.mark())
+        {
+        }
+
+        ~Scope()
+        {
+            _arena.rewind(_mark);
+        }
+
+    private:
+        ArenaAllocator &_arena;
+        size_t _mark;
+    };
+
+private:
+    /* Sufficient for any scalar type on supported targets */
+    static const uint32_t alignment = 8;
+
+    uint8_t *_buffer;
+    uint32_t _size;
+    volatile uint32_t _offset;
+};
+
+/**@}*/
+
+/**@}*/
+
+}
+
+#endif
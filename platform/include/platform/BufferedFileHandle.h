@@ -0,0 +1,107 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_BUFFEREDFILEHANDLE_H
+#define MBED_BUFFEREDFILEHANDLE_H
+
+#include "platform/FileHandle.h"
+#include "platform/PlatformMutex.h"
+#include "platform/NonCopyable.h"
+
+namespace mbed {
+
+/**
+ * \defgroup platform_BufferedFileHandle BufferedFileHandle functions
+ * \ingroup platform-public-api-file
+ * @{
+ */
+
+/** A FileHandle wrapper that coalesces small sequential writes.
+ *
+ * Each write() appends into an internal buffer, and the underlying
+ * FileHandle only sees block-sized writes when the buffer fills or when
+ * the data has to be made visible (sync, seek, read, close). This turns
+ * a stream of small fwrite()-style calls - which would otherwise each
+ * pay a full transaction on filesystems such as LittleFileSystem - into
+ * a much smaller number of large ones.
+ *
+ * The buffer can be supplied by the caller, setvbuf-style, via
+ * set_buffer(); otherwise one is allocated from the heap.
+ *
+ * Reads are not buffered: read() flushes pending writes and forwards to
+ * the underlying handle, so the wrapper is transparent for mixed access
+ * at the cost of no read-ahead.
+ *
+ * @note Synchronization level: Thread safe
+ */
+class BufferedFileHandle : public FileHandle, private NonCopyable<BufferedFileHandle> {
+public:
+    /** Wrap an open FileHandle with a write-coalescing buffer.
+     *
+     *  @param fh           The handle to forward I/O to. Not owned; close()
+     *                      closes it but does not delete it.
+     *  @param buffer_size  Size of the internal write buffer in bytes.
+     */
+    BufferedFileHandle(FileHandle *fh, size_t buffer_size);
+
+    /** Destroy the wrapper, flushing any pending data.
+     *
+     * The underlying handle is left open.
+     */
+    ~BufferedFileHandle() override;
+
+    /** Replace the internal buffer with caller-provided storage, setvbuf-style.
+     *
+     *  The storage must remain valid for the lifetime of the wrapper.
+     *
+     *  @param buffer   The storage to buffer writes in.
+     *  @param size     Size of the storage in bytes.
+     *  @return         0 on success, -EINVAL if size is 0 or a flush of
+     *                  previously buffered data failed.
+     */
+    int set_buffer(void *buffer, size_t size);
+
+    ssize_t read(void *buffer, size_t size) override;
+    ssize_t write(const void *buffer, size_t size) override;
+    off_t seek(off_t offset, int whence = SEEK_SET) override;
+    int close() override;
+    int sync() override;
+    int isatty() override;
+    off_t size() override;
+    int truncate(off_t length) override;
+    int set_blocking(bool blocking) override;
+    bool is_blocking() const override;
+    short poll(short events) const override;
+    void sigio(Callback<void()> func) override;
+
+private:
+    /* Push buffered data to the underlying handle. Must be called with
+     * the mutex held. Returns 0 or a negative error code. */
+    int flush();
+
+    FileHandle *_fh;
+    unsigned char *_buffer;
+    size_t _buffer_size;
+    size_t _level;
+    bool _owns_buffer;
+    PlatformMutex _mutex;
+};
+
+/**@}*/
+
+} // namespace mbed
+
+#endif
@@ -0,0 +1,183 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_BUFFEREDFILESTREAM_H
+#define MBED_BUFFEREDFILESTREAM_H
+
+#include "platform/FileHandle.h"
+#include "platform/NonCopyable.h"
+#include "platform/Span.h"
+
+namespace mbed {
+
+/**
+ * \defgroup platform_BufferedFileStream BufferedFileStream functions
+ * \ingroup platform-public-api-file
+ * @{
+ */
+
+/** A read-ahead stream over a FileHandle for sequential parsers.
+ *
+ * Tokenizers that pull a few bytes at a time straight from a FileHandle
+ * pay a full filesystem transaction per token on filesystems such as
+ * LittleFileSystem. BufferedFileStream refills an internal buffer with
+ * one bulk FileHandle::read and serves reads, single bytes and
+ * zero-copy peeks from it, so a pass over a file costs a handful of
+ * filesystem calls instead of one per token.
+ *
+ * peek() exposes the buffered bytes directly as a Span, letting a
+ * parser scan a token in place and consume() it without copying.
+ * seek() is lazy: a target inside the buffered window just moves the
+ * read position, and an outside target only records it, deferring the
+ * underlying seek to the next refill.
+ *
+ * This is the read-side counterpart of BufferedFileHandle, which
+ * coalesces writes. The buffer can be supplied by the caller,
+ * setvbuf-style, via set_buffer(); otherwise one is allocated from the
+ * heap.
+ *
+ * @note Synchronization level: Not protected. Spans returned by peek()
+ *       point into the internal buffer, so locking has to sit around
+ *       the whole peek/consume sequence and is left to the caller.
+ */
+class BufferedFileStream : private NonCopyable<BufferedFileStream> {
+public:
+    /** Wrap an open FileHandle with a read-ahead buffer.
+     *
+     *  Reading starts at the handle's current position.
+     *
+     *  @param fh           The handle to read from. Not owned and not closed
+     *                      by the wrapper; it must not be read or seeked
+     *                      behind the wrapper's back.
+     *  @param buffer_size  Size of the read-ahead buffer in bytes.
+     */
+    BufferedFileStream(FileHandle *fh, size_t buffer_size);
+
+    ~BufferedFileStream();
+
+    /** Replace the internal buffer with caller-provided storage, setvbuf-style.
+     *
+     *  Buffered data is dropped and re-read on the next refill; the read
+     *  position is unaffected.
+     *
+     *  @param buffer   The storage to read ahead into, must remain valid for
+     *                  the lifetime of the wrapper.
+     *  @param size     Size of the storage in bytes.
+     *  @return         0 on success, -EINVAL if size is 0.
+     */
+    int set_buffer(void *buffer, size_t size);
+
+    /** Read from the buffered position, refilling in bulk as needed.
+     *
+     *  Requests no larger than the buffer are served with at most one
+     *  underlying read; larger ones bypass the buffer and go straight to
+     *  the handle.
+     *
+     *  @param buffer   The buffer to read into.
+     *  @param size     The number of bytes to read.
+     *  @return         The number of bytes read, 0 at end of file, negative
+     *                  error code on failure.
+     */
+    ssize_t read(void *buffer, size_t size);
+
+    /** Read one byte from the buffered position.
+     *
+     *  The common case is an inline array access with no function call.
+     *
+     *  @return The byte read, or EOF (-1) at end of file, or a negative
+     *          error code on failure.
+     */
+    int getc()
+    {
+        if (_start < _level) {
+            return _buffer[_start++];
+        }
+        return refill_getc();
+    }
+
+    /** View upcoming bytes in place without consuming them.
+     *
+     *  Refills the buffer as needed to make size bytes available; fewer are
+     *  returned only at end of file or on error. The span points into the
+     *  internal buffer and is invalidated by any other call on the stream.
+     *
+     *  @param size     The number of bytes wanted, capped to the buffer size.
+     *  @return         A span of the upcoming bytes, empty at end of file.
+     */
+    Span<const uint8_t> peek(size_t size);
+
+    /** Advance the read position past bytes scanned with peek()
+     *
+     *  Advancing beyond the buffered window degenerates to a lazy seek.
+     *
+     *  @param size     The number of bytes to consume.
+     */
+    void consume(size_t size);
+
+    /** Move the read position, lazily.
+     *
+     *  A target within the buffered window is a pointer adjustment; any
+     *  other target defers the underlying seek to the next refill, so
+     *  seek-then-read costs a single filesystem round-trip.
+     *
+     *  @param offset   The offset to seek to.
+     *  @param whence   SEEK_SET, SEEK_CUR or SEEK_END.
+     *  @return         The new position, or a negative error code.
+     */
+    off_t seek(off_t offset, int whence = SEEK_SET);
+
+    /** Get the current read position
+     *
+     *  @return The position from which the next byte will be read.
+     */
+    off_t tell() const
+    {
+        return _buffer_pos + static_cast<off_t>(_start);
+    }
+
+    /** Get the size of the underlying file
+     *
+     *  @return The size of the file in bytes, or a negative error code.
+     */
+    off_t size()
+    {
+        return _fh->size();
+    }
+
+private:
+    /* Compact the unconsumed bytes to the front of the buffer, resolve a
+     * pending seek and top the buffer up with one underlying read. Returns
+     * the number of bytes added, 0 at end of file, negative on error. */
+    ssize_t refill();
+
+    /* Out-of-line slow path of getc() for an empty buffer. */
+    int refill_getc();
+
+    FileHandle *_fh;
+    uint8_t *_buffer;
+    size_t _buffer_size;
+    size_t _start;          /* index of the next unconsumed byte */
+    size_t _level;          /* valid bytes in the buffer */
+    off_t _buffer_pos;      /* file offset of _buffer[0] */
+    bool _seek_pending;
+    bool _owns_buffer;
+};
+
+/**@}*/
+
+} // namespace mbed
+
+#endif
@@ -29,6 +29,13 @@
 // Controlling switches from config:
 // MBED_CONF_PLATFORM_CALLBACK_NONTRIVIAL - support storing non-trivial function objects
 // MBED_CONF_PLATFORM_CALLBACK_COMPARABLE - support memcmp comparing stored objects (requires zero padding)
+// MBED_CONF_PLATFORM_CALLBACK_EXTRA_STORAGE - additional pointer-sized words of
+//   inline storage in every Callback, allowing larger function objects (such as
+//   lambdas produced by callback_bind) to be stored without heap allocation
+
+#ifndef MBED_CONF_PLATFORM_CALLBACK_EXTRA_STORAGE
+#define MBED_CONF_PLATFORM_CALLBACK_EXTRA_STORAGE 0
+#endif
 
 #ifdef __ICCARM__
 /* Force platform.callback-nontrivial for IAR */
@@ -177,7 +184,7 @@ struct [[gnu::may_alias]] CallbackBase {
      * even in C++14 mode, so we add [[gnu::may_alias]] unconditionally.
      */
     struct alignas(_model_function_object) [[gnu::may_alias]] Store {
-        char data[sizeof(_model_function_object)];
+        char data[sizeof(_model_function_object) + MBED_CONF_PLATFORM_CALLBACK_EXTRA_STORAGE * sizeof(void *)];
     };
     Store _storage;
 
@@ -797,6 +804,38 @@ callback(F &&f)
     return Callback<detail::unqualify_fn_t<detail::member_type_t<decltype(&mstd::remove_cvref_t<F>::operator())>>>(std::forward<F>(f));
 }
 
+/** Create a callback binding argument values to a member function, with no
+ *  heap allocation
+ *
+ *  The object pointer, member pointer and bound argument values are captured
+ *  by value into the Callback's inline storage, so no allocation happens at
+ *  bind time or call time. The default storage only fits the object and
+ *  member pointers; binding arguments requires growing every Callback by
+ *  setting the configuration option platform.callback-extra-storage to the
+ *  number of extra pointer-sized words needed - the static_assert in
+ *  Callback will point this out if the bound object does not fit.
+ *
+ *  @param obj      Pointer to object to invoke member function on
+ *  @param method   Member function to attach
+ *  @param args     Argument values to bind to the call
+ *  @return         Callback taking no arguments
+ */
+template <typename T, typename U, typename R, typename... ArgTs>
+Callback<R()> callback_bind(U *obj, R(T::*method)(ArgTs...), ArgTs... args)
+{
+    return Callback<R()>([ = ]() -> R {
+        return (obj->*method)(args...);
+    });
+}
+
+template <typename T, typename U, typename R, typename... ArgTs>
+Callback<R()> callback_bind(const U *obj, R(T::*method)(ArgTs...) const, ArgTs... args)
+{
+    return Callback<R()>([ = ]() -> R {
+        return (obj->*method)(args...);
+    });
+}
+
 #if __cplusplus >= 201703 || __cpp_deduction_guides >= 201703
 /* Deduction guides that can replace callback() helper */
 template <typename R, typename... Args>
@@ -298,6 +298,14 @@ public:
         return elements;
     }
 
+    /**
+     * Get the number of elements the circular_buffer can hold.
+     */
+    static constexpr CounterType capacity()
+    {
+        return BufferSize;
+    }
+
     /** Peek into circular buffer without popping.
      *
      * @param data Data to be peeked from the buffer.
@@ -315,6 +323,49 @@ public:
         return data_updated;
     }
 
+    /** Get direct read access to the longest contiguous run of stored elements.
+     *
+     * Combined with drop(), this allows consuming buffered data in place
+     * without copying it out. The elements stay in the buffer until dropped,
+     * so the pointer remains valid until something pops, drops or resets the
+     * buffer. Stored data may wrap around the end of the internal storage, in
+     * which case a second call after dropping the first run is needed to
+     * reach the remainder.
+     *
+     * @param data Updated to point at the first stored element.
+     * @return The number of contiguous elements readable from data.
+     */
+    CounterType peek_contiguous(const T **data) const
+    {
+        core_util_critical_section_enter();
+        CounterType contiguous = non_critical_size();
+        if ((_tail + contiguous) > BufferSize) {
+            contiguous = BufferSize - _tail;
+        }
+        *data = _buffer + _tail;
+        core_util_critical_section_exit();
+        return contiguous;
+    }
+
+    /** Drop elements from the front of the buffer without reading them.
+     *
+     * @param len The number of elements to drop.
+     * @return The number of elements actually dropped.
+     */
+    CounterType drop(CounterType len)
+    {
+        core_util_critical_section_enter();
+        if (len > non_critical_size()) {
+            len = non_critical_size();
+        }
+        if (len > 0) {
+            _tail = incrementCounter(_tail, len);
+            _full = false;
+        }
+        core_util_critical_section_exit();
+        return len;
+    }
+
 private:
     bool non_critical_empty() const
     {
@@ -0,0 +1,182 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_DEFERREDOBJECT_H
+#define MBED_DEFERREDOBJECT_H
+
+#include <new>
+#include <tuple>
+#include <utility>
+
+#include "platform/SingletonPtr.h"
+#include "platform/mbed_assert.h"
+#include "platform/mbed_atomic.h"
+
+namespace mbed {
+
+/** \addtogroup platform-public-api */
+/** @{*/
+
+/**
+ * \defgroup platform_DeferredObject DeferredObject class
+ * @{
+ */
+
+/** A global driver object whose constructor runs on first use, not
+ * before main().
+ *
+ * A global driver object - a BufferedSerial, an SPI, a network
+ * interface - constructs in the pre-main() initializer chain, clocking
+ * and configuring hardware that the boot path may not touch for
+ * minutes, and paying for it before the application can run a line of
+ * code. DeferredObject extends the SingletonPtr idea to objects with
+ * constructor arguments: the arguments are captured at (constant)
+ * initialization time, and the wrapped constructor runs on the first
+ * get(), in the caller's context.
+ *
+ * @code
+ * // nothing touches the UART before first use
+ * DeferredObject<BufferedSerial, PinName, PinName, int>
+ *     gps(GPS_TX, GPS_RX, 9600);
+ *
+ * void read_fix()
+ * {
+ *     gps->read(buffer, sizeof buffer);  // constructs here, once
+ * }
+ * @endcode
+ *
+ * Applications that want the old eager behaviour - paying the bringup
+ * cost at a moment of their choosing rather than on the first I/O -
+ * call prewarm():
+ *
+ * @code
+ * int main()
+ * {
+ *     start_ui();       // visible fast
+ *     gps.prewarm();    // bring the UART up before the first fix is due
+ *     ...
+ * }
+ * @endcode
+ *
+ * The captured arguments must be literal types (pins, integers,
+ * pointers) so the wrapper is constant-initialized and lives in flash
+ * and .bss rather than adding a dynamic initializer of its own - that
+ * is the point. Arguments are stored by value; pass pointers for
+ * by-reference semantics, and keep what they point at alive.
+ *
+ * Construction is serialized on the singleton mutex, like SingletonPtr.
+ * As with SingletonPtr, the wrapped destructor never runs
+ * automatically; call destroy() in the rare case it matters.
+ *
+ * @note Synchronization level: Thread safe
+ */
+template <class T, typename... ArgTs>
+class DeferredObject {
+public:
+    /** Capture constructor arguments; does not construct the object.
+     *
+     *  @param args Arguments forwarded to T's constructor on first use.
+     */
+    constexpr DeferredObject(ArgTs... args) noexcept
+        : _args(args...), _ptr(), _data()
+    {
+    }
+
+    /** Get the object, constructing it on the first call.
+     *
+     *  @return Pointer to the wrapped object.
+     */
+    T *get() const
+    {
+        // Same double-checked scheme as SingletonPtr: after
+        // construction every call is one acquire-load and a branch
+        T *p = core_util_atomic_load_explicit(&_ptr, mbed_memory_order_acquire);
+        if (p == NULL) {
+            singleton_lock();
+            p = _ptr;
+            if (p == NULL) {
+                p = construct(std::index_sequence_for<ArgTs...>{});
+                core_util_atomic_store_explicit(&_ptr, p, mbed_memory_order_release);
+            }
+            singleton_unlock();
+        }
+        MBED_ASSERT(p == reinterpret_cast<T *>(&_data));
+        return p;
+    }
+
+    T *operator->() const
+    {
+        return get();
+    }
+
+    T &operator*() const
+    {
+        return *get();
+    }
+
+    /** Construct the object now if it has not been already.
+     *
+     * For applications that prefer eager bringup at a chosen moment -
+     * during a splash screen, before entering a latency-critical phase -
+     * over a stall on the first I/O.
+     */
+    void prewarm() const
+    {
+        get();
+    }
+
+    /** Check whether the object has been constructed, without
+     * constructing it.
+     */
+    bool is_constructed() const
+    {
+        return core_util_atomic_load_explicit(&_ptr, mbed_memory_order_acquire) != NULL;
+    }
+
+    /** Destroy the underlying object, if constructed.
+     *
+     * Not thread-safe, like SingletonPtr::destroy(); no further
+     * operations are permitted afterwards except a fresh get(), which
+     * constructs a new object from the captured arguments.
+     */
+    void destroy()
+    {
+        T *p = _ptr;
+        if (p) {
+            _ptr = NULL;
+            p->~T();
+        }
+    }
+
+private:
+    template <size_t... Is>
+    T *construct(std::index_sequence<Is...>) const
+    {
+        return new (_data) T(std::get<Is>(_args)...);
+    }
+
+    std::tuple<ArgTs...> _args;
+    mutable T *_ptr;
+    alignas(T) mutable char _data[sizeof(T)];
+};
+
+/**@}*/
+
+/**@}*/
+
+} // namespace mbed
+
+#endif
@@ -0,0 +1,228 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_DMABUFFER_H
+#define MBED_DMABUFFER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "platform/mbed_assert.h"
+#include "platform/NonCopyable.h"
+#include "cmsis.h"
+
+/** Alignment and granule of DMA buffers: the data cache line size on cores
+ * with a data cache, otherwise the bus width */
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+#define MBED_DMA_BUFFER_ALIGN 32
+#else
+#define MBED_DMA_BUFFER_ALIGN 4
+#endif
+
+namespace mbed {
+
+/** \addtogroup platform-public-api */
+/** @{*/
+/**
+ * \defgroup platform_DmaBuffer DmaBuffer class
+ * @{
+ */
+
+/** Direction of a DMA transfer, from the CPU's point of view. */
+enum class DmaDirection {
+    ToDevice,   /**< Memory to peripheral (transmit) */
+    FromDevice  /**< Peripheral to memory (receive) */
+};
+
+/** Clean a range out of the data cache ahead of a device read.
+ *
+ * A no-op on cores without a data cache. The range is expanded to cache
+ * line boundaries, so the caller must ensure no unrelated live data shares
+ * those lines - DmaBuffer guarantees this by construction.
+ *
+ *  @param ptr Start of the range.
+ *  @param len Length of the range in bytes.
+ */
+inline void dma_cache_clean(const void *ptr, size_t len)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_CleanDCache_by_Addr((uint32_t *)((uintptr_t)ptr & ~(MBED_DMA_BUFFER_ALIGN - 1)),
+                            (int32_t)(((uintptr_t)ptr & (MBED_DMA_BUFFER_ALIGN - 1)) + len));
+#else
+    (void)ptr;
+    (void)len;
+#endif
+}
+
+/** Invalidate a range in the data cache around a device write.
+ *
+ * A no-op on cores without a data cache. The range is expanded to cache
+ * line boundaries, so the caller must ensure no unrelated live data shares
+ * those lines - invalidation discards whatever the CPU had there.
+ *
+ *  @param ptr Start of the range.
+ *  @param len Length of the range in bytes.
+ */
+inline void dma_cache_invalidate(void *ptr, size_t len)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_InvalidateDCache_by_Addr((uint32_t *)((uintptr_t)ptr & ~(MBED_DMA_BUFFER_ALIGN - 1)),
+                                 (int32_t)(((uintptr_t)ptr & (MBED_DMA_BUFFER_ALIGN - 1)) + len));
+#else
+    (void)ptr;
+    (void)len;
+#endif
+}
+
+/** Allocate non-cacheable memory for DMA from the dedicated pool.
+ *
+ * Available when platform.dma-noncacheable-pool-size is set on a core with
+ * a v7-M MPU: the pool is a statically placed region the MPU marks normal
+ * non-cacheable, so buffers inside it need no cache maintenance at all -
+ * the right choice for descriptors and small buffers touched by both CPU
+ * and device mid-transfer. Allocations are cache-line aligned.
+ *
+ * Allocation is bump-style and permanent, in the manner of
+ * ArenaAllocator: allocate at initialization and keep the buffer for the
+ * peripheral's lifetime.
+ *
+ *  @param size Number of bytes to allocate.
+ *  @return Pointer to non-cacheable memory, or NULL if the pool is
+ *          disabled or exhausted.
+ */
+void *dma_pool_alloc(size_t size);
+
+/** Check whether a pointer lies in the non-cacheable DMA pool.
+ *
+ * Buffers in the pool need no ownership transitions; drivers handling
+ * caller-provided memory can test for this and skip maintenance.
+ *
+ *  @param ptr Pointer to test.
+ *  @return true if the pointer is inside the non-cacheable pool.
+ */
+bool dma_pool_owns(const void *ptr);
+
+/** A buffer that is handed back and forth between CPU and DMA correctly.
+ *
+ * On cores with a data cache (Cortex-M7), every DMA transfer needs cache
+ * maintenance: clean before the device reads, invalidate around the device
+ * writing. Getting the range wrong corrupts adjacent data; doing it over
+ * the whole cache costs hundreds of microseconds. DmaBuffer makes the
+ * correct, minimal-range operations part of an explicit ownership
+ * protocol:
+ *
+ * @code
+ * static DmaBuffer<512> rx_buf;
+ *
+ * rx_buf.give_to_device(DmaDirection::FromDevice, transfer_len);
+ * // ... start DMA, wait for completion ...
+ * rx_buf.give_to_cpu(DmaDirection::FromDevice, transfer_len);
+ * // rx_buf.data() now coherent
+ * @endcode
+ *
+ * The storage is cache-line aligned and its size rounded up to whole
+ * lines, so maintenance by address can never touch neighbouring objects -
+ * the classic invalidation corruption is impossible by construction. Only
+ * the transferred length is maintained, not the whole buffer. On cores
+ * without a data cache all transitions compile to nothing but the
+ * ownership assertions.
+ *
+ * @note Synchronization level: Not protected - a buffer belongs to one
+ *       transfer at a time, which the ownership assertions enforce in
+ *       debug builds.
+ *
+ * @tparam BufferSize Usable size of the buffer in bytes.
+ */
+template<size_t BufferSize>
+class DmaBuffer : private NonCopyable<DmaBuffer<BufferSize>> {
+public:
+    DmaBuffer() : _device_owned(false)
+    {
+    }
+
+    /** Get the buffer contents. Only valid while the CPU owns the buffer. */
+    uint8_t *data()
+    {
+        MBED_ASSERT(!_device_owned);
+        return _storage;
+    }
+
+    /** Get the usable size of the buffer in bytes. */
+    size_t size() const
+    {
+        return BufferSize;
+    }
+
+    /** Pass ownership to the device, ahead of starting a DMA transfer.
+     *
+     * For a transmit the transferred range is cleaned to memory; for a
+     * receive it is invalidated so no dirty line can be evicted on top of
+     * the incoming data mid-transfer.
+     *
+     *  @param direction Direction of the upcoming transfer.
+     *  @param length    Bytes the device will transfer, defaulting to the
+     *                   whole buffer. Only this much is maintained.
+     */
+    void give_to_device(DmaDirection direction, size_t length = BufferSize)
+    {
+        MBED_ASSERT(length <= BufferSize);
+        MBED_ASSERT(!_device_owned);
+        _device_owned = true;
+        if (direction == DmaDirection::ToDevice) {
+            dma_cache_clean(_storage, length);
+        } else {
+            dma_cache_invalidate(_storage, length);
+        }
+    }
+
+    /** Take ownership back from the device, after the transfer completed.
+     *
+     * For a receive the transferred range is invalidated again, discarding
+     * any line the CPU speculatively fetched while the device was writing.
+     *
+     *  @param direction Direction of the completed transfer.
+     *  @param length    Bytes the device transferred, defaulting to the
+     *                   whole buffer.
+     */
+    void give_to_cpu(DmaDirection direction, size_t length = BufferSize)
+    {
+        MBED_ASSERT(length <= BufferSize);
+        MBED_ASSERT(_device_owned);
+        _device_owned = false;
+        if (direction == DmaDirection::FromDevice) {
+            dma_cache_invalidate(_storage, length);
+        }
+    }
+
+    /** Check whether the device currently owns the buffer. */
+    bool device_owns() const
+    {
+        return _device_owned;
+    }
+
+private:
+    /* Whole cache lines, so by-address maintenance stays inside _storage */
+    alignas(MBED_DMA_BUFFER_ALIGN) uint8_t _storage[(BufferSize + MBED_DMA_BUFFER_ALIGN - 1)
+                                                    & ~(size_t)(MBED_DMA_BUFFER_ALIGN - 1)];
+    bool _device_owned;
+};
+
+/**@}*/
+
+/**@}*/
+
+}
+
+#endif
@@ -0,0 +1,246 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_FRAMECODEC_H
+#define MBED_FRAMECODEC_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <type_traits>
+
+#include "platform/Span.h"
+
+namespace mbed {
+
+/** \addtogroup platform-public-api */
+/** @{*/
+/**
+ * \defgroup platform_FrameCodec FrameCodec class
+ * @{
+ */
+
+/** Byte order of a frame field on the wire.
+ */
+enum class FrameByteOrder {
+    little_endian,
+    big_endian
+};
+
+// Internal details of FrameCodec
+namespace frame_detail {
+
+// Unsigned carrier type for a field of the given width; field bytes are
+// assembled into it before conversion to the declared value type.
+template<size_t Size>
+struct carrier;
+
+template<>
+struct carrier<1> {
+    using type = uint8_t;
+};
+template<>
+struct carrier<2> {
+    using type = uint16_t;
+};
+template<>
+struct carrier<4> {
+    using type = uint32_t;
+};
+template<>
+struct carrier<8> {
+    using type = uint64_t;
+};
+
+constexpr size_t max_of(size_t a)
+{
+    return a;
+}
+
+template<typename... Rest>
+constexpr size_t max_of(size_t a, size_t b, Rest... rest)
+{
+    return max_of(a > b ? a : b, rest...);
+}
+
+}
+
+/** One field of a binary frame: value type, byte offset and byte order.
+ *
+ * The field is a pure compile-time description - it holds no data. Declare
+ * each field of a frame as a distinct type and use the types as keys into
+ * FrameCodec:
+ *
+ * @code
+ *  using MsgId   = FrameField<uint8_t,  0>;
+ *  using Address = FrameField<uint16_t, 1, FrameByteOrder::big_endian>;
+ * @endcode
+ *
+ * The value type must be an integral type or an enum of 1, 2, 4 or 8
+ * bytes. Fields may overlap, as protocol unions do; nothing requires them
+ * to tile the frame.
+ *
+ * @tparam T      Value type of the field.
+ * @tparam Offset Byte offset of the field from the start of the frame.
+ * @tparam Order  Byte order of the field on the wire.
+ */
+template<typename T, size_t Offset, FrameByteOrder Order = FrameByteOrder::big_endian>
+struct FrameField {
+    static_assert(std::is_integral<T>::value || std::is_enum<T>::value,
+                  "FrameField value type must be an integral or enum type");
+    static_assert(sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8,
+                  "FrameField value type must be 1, 2, 4 or 8 bytes wide");
+
+    /** Value type of the field. */
+    using value_type = T;
+
+    /** Byte offset of the field from the start of the frame. */
+    static constexpr size_t offset = Offset;
+
+    /** Size of the field on the wire in bytes. */
+    static constexpr size_t size = sizeof(T);
+
+    /** Byte order of the field on the wire. */
+    static constexpr FrameByteOrder order = Order;
+
+    /** Load the field value from its position in a frame.
+     *
+     *  The byte loop has a constant trip count and unrolls; on targets
+     *  with unaligned access the compiler reduces it to a single load
+     *  (plus a byte reverse when the byte orders differ).
+     *
+     *  @param frame Pointer to the start of the frame.
+     *  @return      The field value.
+     */
+    static constexpr T load(const uint8_t *frame)
+    {
+        using carrier_t = typename frame_detail::carrier<sizeof(T)>::type;
+        carrier_t value = 0;
+        for (size_t i = 0; i < sizeof(T); i++) {
+            size_t shift = (Order == FrameByteOrder::little_endian) ? i : sizeof(T) - 1 - i;
+            value = static_cast<carrier_t>(value | (static_cast<carrier_t>(frame[Offset + i]) << (8 * shift)));
+        }
+        return static_cast<T>(value);
+    }
+
+    /** Store a field value at its position in a frame.
+     *
+     *  @param frame Pointer to the start of the frame.
+     *  @param value The value to store.
+     */
+    static constexpr void store(uint8_t *frame, T value)
+    {
+        using carrier_t = typename frame_detail::carrier<sizeof(T)>::type;
+        carrier_t bits = static_cast<carrier_t>(value);
+        for (size_t i = 0; i < sizeof(T); i++) {
+            size_t shift = (Order == FrameByteOrder::little_endian) ? i : sizeof(T) - 1 - i;
+            frame[Offset + i] = static_cast<uint8_t>(bits >> (8 * shift));
+        }
+    }
+};
+
+/** Compile-time codec for a fixed-layout binary frame.
+ *
+ * A frame is described once as a set of FrameField types and the codec
+ * derives the frame size and per-field accessors from the description.
+ * All offsets and widths are compile-time constants, so a decode is a
+ * sequence of fixed-offset loads - no per-field bounds checks and no
+ * runtime layout walk, unlike the usual read-cursor helpers.
+ *
+ * Bounds are checked exactly once, at the type boundary: the accessors
+ * take a fixed-extent Span of the frame size, which can only be obtained
+ * from a runtime buffer by checking its length. fits() performs that
+ * check:
+ *
+ * @code
+ *  using MsgId   = FrameField<uint8_t,  0>;
+ *  using Address = FrameField<uint16_t, 1, FrameByteOrder::big_endian>;
+ *  using Value   = FrameField<int32_t,  3, FrameByteOrder::big_endian>;
+ *  using Codec   = FrameCodec<MsgId, Address, Value>;
+ *
+ *  void on_frame(Span<const uint8_t> buf)
+ *  {
+ *      if (!Codec::fits(buf)) {
+ *          return;             // the only bounds check
+ *      }
+ *      auto frame = buf.first<Codec::frame_size>();
+ *      uint8_t  id    = Codec::read<MsgId>(frame);
+ *      uint16_t addr  = Codec::read<Address>(frame);
+ *      int32_t  value = Codec::read<Value>(frame);
+ *  }
+ * @endcode
+ *
+ * @tparam Fields FrameField types making up the frame.
+ */
+template<typename... Fields>
+class FrameCodec {
+public:
+    /** Size of the frame in bytes: the end of the furthest field. */
+    static constexpr size_t frame_size = frame_detail::max_of(0, (Fields::offset + Fields::size)...);
+
+    /** View of a frame to decode from. */
+    using ConstView = Span<const uint8_t, frame_size>;
+
+    /** View of a frame to encode into. */
+    using View = Span<uint8_t, frame_size>;
+
+    /** Check that a buffer is large enough to hold the frame.
+     *
+     *  @param buffer The buffer to check.
+     *  @return       True if a full frame fits in the buffer.
+     */
+    static constexpr bool fits(Span<const uint8_t> buffer)
+    {
+        return buffer.size() >= static_cast<ptrdiff_t>(frame_size);
+    }
+
+    /** Read one field out of a frame.
+     *
+     *  @tparam Field The FrameField to read; must be one of Fields.
+     *  @param frame  View of the frame.
+     *  @return       The field value.
+     */
+    template<typename Field>
+    static constexpr typename Field::value_type read(ConstView frame)
+    {
+        static_assert(Field::offset + Field::size <= frame_size,
+                      "field lies outside the frame");
+        return Field::load(frame.data());
+    }
+
+    /** Write one field into a frame.
+     *
+     *  Bytes not covered by any field are left untouched.
+     *
+     *  @tparam Field The FrameField to write; must be one of Fields.
+     *  @param frame  View of the frame.
+     *  @param value  The value to write.
+     */
+    template<typename Field>
+    static constexpr void write(View frame, typename Field::value_type value)
+    {
+        static_assert(Field::offset + Field::size <= frame_size,
+                      "field lies outside the frame");
+        Field::store(frame.data(), value);
+    }
+};
+
+/**@}*/
+
+/**@}*/
+
+} // namespace mbed
+
+#endif // MBED_FRAMECODEC_H
@@ -0,0 +1,220 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_IPCCHANNEL_H
+#define MBED_IPCCHANNEL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "platform/Callback.h"
+#include "platform/DmaBuffer.h"
+#include "platform/NonCopyable.h"
+#include "platform/Span.h"
+
+namespace mbed {
+
+/** \addtogroup platform-public-api */
+/** @{*/
+/**
+ * \defgroup platform_IpcChannel IpcChannel class
+ * @{
+ */
+
+/** Control block of an IpcChannel, placed in shared RAM.
+ *
+ * Each index sits in its own cache-line-sized granule: head is written
+ * only by the producing core and tail only by the consuming core, so
+ * giving each its own line lets either core clean or invalidate one
+ * without trampling the other's.
+ */
+struct IpcChannelBlock {
+    alignas(MBED_DMA_BUFFER_ALIGN) volatile uint32_t head;  /**< bytes produced, free-running */
+    alignas(MBED_DMA_BUFFER_ALIGN) volatile uint32_t tail;  /**< bytes consumed, free-running */
+};
+
+/** One-directional bulk data channel between the cores of an
+ * asymmetric multicore part.
+ *
+ * Where events::CrossCoreQueue moves small fixed-size work items, an
+ * IpcChannel streams bulk bytes - network frames to an lwIP core,
+ * sample blocks to a fusion core - through a fixed ring in shared RAM
+ * with no copy on either side: the producer claims a contiguous region
+ * of the ring, builds data in place and commits it; the consumer
+ * acquires the readable region in place and releases it when done.
+ *
+ * Both cores construct an IpcChannel over the same control block and
+ * buffer; one core uses only the producer API (claim/commit), the
+ * other only the consumer API (acquire/release). Exactly one core
+ * calls init(), before the other touches the channel.
+ *
+ * Producer:
+ * @code
+ * Span<uint8_t> region = channel.claim();
+ * size_t n = build_frame(region.data(), region.size());
+ * channel.commit(n);
+ * @endcode
+ *
+ * Consumer (other core):
+ * @code
+ * Span<const uint8_t> data = channel.acquire();
+ * if (!data.empty()) {
+ *     consume(data.data(), data.size());
+ *     channel.release(data.size());
+ * }
+ * @endcode
+ *
+ * Ownership handoff is cache-correct on cores with a data cache (the
+ * M7 side of an H745): commit cleans the committed bytes and the head
+ * index out of the cache, acquire invalidates the readable bytes, and
+ * index updates are cleaned/invalidated line-by-line - so the buffer
+ * and control block may live in ordinary cacheable shared RAM. The
+ * buffer must be cache-line aligned with a power-of-two, line-multiple
+ * size so maintenance never touches unrelated data.
+ *
+ * Signaling follows the channel's watermark: the producing side's
+ * notify hook fires when a commit brings the fill level up across the
+ * watermark, the consuming side's when a release brings free space up
+ * across it. Attach the target's inter-core doorbell (HSEM on STM32H7,
+ * IPC notify on PSoC6) to interrupt the other core; with no hook
+ * attached the peer must poll.
+ *
+ * A claim or acquire spans at most to the end of the ring storage -
+ * zero copy means no hidden bounce buffer to stitch a wrap together.
+ * Loop until the returned span is empty to move everything available.
+ *
+ * @note Synchronization level: one posting context per side - the
+ *       producer API from one context, the consumer API from one
+ *       context on the other core.
+ */
+class IpcChannel : private NonCopyable<IpcChannel> {
+public:
+    /** Create a view of a channel over shared memory.
+     *
+     *  @param block  Control block in shared RAM.
+     *  @param buffer Ring storage in shared RAM, cache-line aligned.
+     *  @param size   Storage size in bytes; a power of two and a
+     *                multiple of the cache line size.
+     */
+    IpcChannel(IpcChannelBlock *block, uint8_t *buffer, size_t size);
+
+    /** Reset a control block before first use. Call on exactly one
+     * core, before the other core's first operation.
+     */
+    static void init(IpcChannelBlock *block);
+
+    /** Attach the doorbell that interrupts the other core.
+     *
+     * On the producing core it fires when a commit raises the fill
+     * level across the watermark; on the consuming core when a release
+     * raises free space across it.
+     *
+     *  @param notify Interrupt-safe hook, e.g. the HSEM/IPC trigger.
+     */
+    void attach_notify(Callback<void()> notify);
+
+    /** Set the watermark, in bytes, for notify signaling.
+     *
+     * Defaults to 1: every commit that fills an empty channel (and
+     * every release that unblocks a full one) signals. Raise it to
+     * batch doorbells for high-rate small commits.
+     *
+     *  @param bytes Watermark level in bytes.
+     */
+    void set_watermark(size_t bytes);
+
+    /** Claim the contiguous writable region of the ring.
+     *
+     *  @param max Claim at most this many bytes (default: no limit).
+     *  @return Writable region; empty when the ring is full. May be
+     *          shorter than the total free space when the free space
+     *          wraps.
+     */
+    Span<uint8_t> claim(size_t max = SIZE_MAX);
+
+    /** Publish bytes built in the claimed region.
+     *
+     * Cleans the committed range from the data cache and publishes the
+     * new head, in that order, so the consumer can never see an index
+     * ahead of its data.
+     *
+     *  @param size Bytes to publish; at most the last claim's size.
+     */
+    void commit(size_t size);
+
+    /** Acquire the contiguous readable region of the ring.
+     *
+     * Invalidates the range in the data cache before returning it.
+     *
+     *  @param max Acquire at most this many bytes (default: no limit).
+     *  @return Readable region; empty when the ring is empty. May be
+     *          shorter than the total fill when the data wraps.
+     */
+    Span<const uint8_t> acquire(size_t max = SIZE_MAX);
+
+    /** Return acquired bytes to the ring.
+     *
+     *  @param size Bytes consumed; at most the last acquire's size.
+     */
+    void release(size_t size);
+
+    /** Copy bytes into the channel - the non-zero-copy convenience.
+     *
+     *  @param data Bytes to write.
+     *  @param size Number of bytes.
+     *  @return Bytes actually written; less than size when the ring
+     *          fills.
+     */
+    size_t write(const void *data, size_t size);
+
+    /** Copy bytes out of the channel - the non-zero-copy convenience.
+     *
+     *  @param data Buffer to fill.
+     *  @param size Buffer size.
+     *  @return Bytes actually read.
+     */
+    size_t read(void *data, size_t size);
+
+    /** Get the bytes currently readable. */
+    size_t readable() const;
+
+    /** Get the bytes currently writable. */
+    size_t writable() const;
+
+    /** Get the ring capacity in bytes. */
+    size_t capacity() const
+    {
+        return _size;
+    }
+
+private:
+    static uint32_t index_load(const volatile uint32_t *index);
+    static void index_store(volatile uint32_t *index, uint32_t value);
+
+    IpcChannelBlock *_block;
+    uint8_t *_buffer;
+    size_t _size;
+    size_t _watermark;
+    Callback<void()> _notify;
+};
+
+/**@}*/
+
+/**@}*/
+
+} // namespace mbed
+
+#endif
@@ -0,0 +1,211 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_ISRPOOL_H
+#define MBED_ISRPOOL_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "platform/mbed_atomic.h"
+#include "platform/mbed_critical.h"
+#include "platform/NonCopyable.h"
+
+namespace mbed {
+
+/** \addtogroup platform-public-api */
+/** @{*/
+/**
+ * \defgroup platform_IsrPool IsrPool class
+ * @{
+ */
+
+/** Lock-free fixed-block pool for small control structures.
+ *
+ * Drivers repeatedly need tiny fixed-size blocks in interrupt context -
+ * transaction descriptors, deferred-work records, event carriers - and the
+ * general-purpose heap cannot be used there. IsrPool carves PoolSize blocks
+ * of sizeof(T) out of the object itself at compile time and hands them out
+ * with a bounded number of atomic operations: no critical section is
+ * entered, so try_alloc() and free() are safe from any context, including
+ * zero-latency interrupt handlers, and cannot delay other interrupts.
+ *
+ * Blocks are tracked in a free bitmap. Claiming a block is a
+ * compare-and-swap clearing one bit; a failed CAS means another context
+ * just claimed or released a block in the same word, so the pool as a
+ * whole always makes progress. Releasing is a single atomic OR, which
+ * also makes the bitmap immune to the ABA problem.
+ *
+ * Exhaustion is counted rather than silent: alloc_failures() reports how
+ * often the pool was empty, so PoolSize can be tuned from field telemetry
+ * instead of guessed. For callers that can tolerate unbounded latency when
+ * the pool runs dry, alloc() falls back to the heap - but only in thread
+ * context; in an interrupt handler it degrades to try_alloc() and returns
+ * NULL on exhaustion. free() routes each block back to wherever it came
+ * from.
+ *
+ * Blocks are returned uninitialized and are not destructed on free, in
+ * the style of rtos::MemoryPool: placement-construct in the block if T is
+ * not trivially constructible.
+ *
+ * @note Synchronization level: Interrupt safe (try_alloc/free),
+ *       thread safe (alloc)
+ *
+ * @tparam T        Type of the pooled blocks.
+ * @tparam PoolSize Number of blocks in the pool.
+ */
+template<typename T, uint32_t PoolSize>
+class IsrPool : private NonCopyable<IsrPool<T, PoolSize>> {
+    static_assert(PoolSize > 0, "IsrPool: PoolSize must be non-zero");
+
+public:
+    IsrPool() : _failures(0), _heap_fallbacks(0)
+    {
+        for (uint32_t word = 0; word < map_words; word++) {
+            _free_map[word] = 0xffffffff;
+        }
+        if (PoolSize % 32) {
+            _free_map[map_words - 1] = (1u << (PoolSize % 32)) - 1;
+        }
+    }
+
+    /** Allocate a block from the pool. Safe from any context.
+     *
+     * @return Pointer to an uninitialized block, or NULL if the pool is
+     *         exhausted (counted by alloc_failures()).
+     */
+    T *try_alloc()
+    {
+        for (uint32_t word = 0; word < map_words; word++) {
+            uint32_t bits = core_util_atomic_load_u32(&_free_map[word]);
+            while (bits) {
+                uint32_t bit = bits & -bits;
+                // A failed CAS reloads bits, so contention within the word
+                // just moves us on to whichever bits are still free
+                if (core_util_atomic_cas_u32(&_free_map[word], &bits, bits & ~bit)) {
+                    uint32_t index = word * 32 + bit_index(bit);
+                    return reinterpret_cast<T *>(_storage + index * sizeof(T));
+                }
+            }
+        }
+        core_util_atomic_incr_u32(&_failures, 1);
+        return NULL;
+    }
+
+    /** Allocate a block, overflowing to the heap when the pool is empty.
+     *
+     * The heap fallback keeps rare bursts working without permanently
+     * over-provisioning the pool. It is taken only in thread context; from
+     * an interrupt handler this behaves exactly like try_alloc().
+     *
+     * @return Pointer to an uninitialized block, or NULL if the pool is
+     *         exhausted and no heap fallback was possible.
+     */
+    T *alloc()
+    {
+        T *block = try_alloc();
+        if (!block && !core_util_is_isr_active()) {
+            block = static_cast<T *>(malloc(sizeof(T)));
+            if (block) {
+                core_util_atomic_incr_u32(&_heap_fallbacks, 1);
+            }
+        }
+        return block;
+    }
+
+    /** Return a block obtained from try_alloc() or alloc(). Safe from any
+     * context for pool blocks; heap-fallback blocks are freed to the heap
+     * and so follow the heap's synchronization rules.
+     *
+     * @param block Block to free. NULL is ignored.
+     */
+    void free(T *block)
+    {
+        if (!block) {
+            return;
+        }
+        uint8_t *p = reinterpret_cast<uint8_t *>(block);
+        if (p >= _storage && p < _storage + sizeof(_storage)) {
+            uint32_t index = (p - _storage) / sizeof(T);
+            core_util_atomic_fetch_or_u32(&_free_map[index / 32], 1u << (index % 32));
+        } else {
+            ::free(block);
+        }
+    }
+
+    /** Get the total number of blocks in the pool. */
+    uint32_t capacity() const
+    {
+        return PoolSize;
+    }
+
+    /** Get the number of blocks currently free. A snapshot under
+     * concurrent use.
+     */
+    uint32_t free_blocks() const
+    {
+        uint32_t count = 0;
+        for (uint32_t word = 0; word < map_words; word++) {
+            uint32_t bits = core_util_atomic_load_u32(&_free_map[word]);
+            while (bits) {
+                bits &= bits - 1;
+                count++;
+            }
+        }
+        return count;
+    }
+
+    /** Get the number of times an allocation found the pool exhausted.
+     *
+     * Incremented even when alloc() subsequently satisfied the request
+     * from the heap - the counter measures pool sizing, not caller
+     * failures.
+     */
+    uint32_t alloc_failures() const
+    {
+        return core_util_atomic_load_u32(&_failures);
+    }
+
+    /** Get the number of allocations satisfied from the heap by alloc(). */
+    uint32_t heap_fallbacks() const
+    {
+        return core_util_atomic_load_u32(&_heap_fallbacks);
+    }
+
+private:
+    static const uint32_t map_words = (PoolSize + 31) / 32;
+
+    static uint32_t bit_index(uint32_t bit)
+    {
+        uint32_t index = 0;
+        while (bit >>= 1) {
+            index++;
+        }
+        return index;
+    }
+
+    alignas(T) uint8_t _storage[PoolSize * sizeof(T)];
+    volatile uint32_t _free_map[map_words];
+    volatile uint32_t _failures;
+    volatile uint32_t _heap_fallbacks;
+};
+
+/**@}*/
+
+/**@}*/
+
+}
+
+#endif
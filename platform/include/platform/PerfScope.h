@@ -0,0 +1,88 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_PERFSCOPE_H
+#define MBED_PERFSCOPE_H
+
+#include "platform/mbed_perf_counters.h"
+#include "platform/NonCopyable.h"
+
+namespace mbed {
+/** \addtogroup platform-public-api */
+/** @{*/
+/**
+ * \defgroup platform_PerfScope PerfScope class
+ * @{
+ */
+
+/** RAII measurement of a named code region with the hardware counters.
+ *
+ * Constructing a PerfScope snapshots the cycle and auxiliary counters;
+ * destruction accumulates the deltas into the slot named in the
+ * constructor. Scopes nest, and the accumulated slots are read back with
+ * mbed_stats_perf_get_each().
+ *
+ * When MBED_PERF_COUNTERS_ENABLED is not defined the class is empty and
+ * optimizes away entirely, so instrumentation can be left in production
+ * code.
+ *
+ * @code
+ * {
+ *     PerfScope perf("tls_handshake");
+ *     ssl_handshake(&ctx);
+ * }
+ * @endcode
+ *
+ * @note Synchronization level: Interrupt safe
+ */
+#if defined(MBED_PERF_COUNTERS_ENABLED) || defined(DOXYGEN_ONLY)
+class PerfScope : private NonCopyable<PerfScope> {
+public:
+    /** Open a scope accumulating into the named slot.
+     *
+     *  @param name Name of the slot; stored by pointer, pass a string
+     *  literal
+     */
+    PerfScope(const char *name) : _slot(mbed_perf_slot(name))
+    {
+        mbed_perf_begin(&_sample);
+    }
+
+    ~PerfScope()
+    {
+        mbed_perf_end(_slot, &_sample);
+    }
+
+private:
+    int _slot;
+    mbed_perf_sample_t _sample;
+};
+#else
+class PerfScope {
+public:
+    PerfScope(const char *)
+    {
+    }
+};
+#endif
+
+/**@}*/
+
+/**@}*/
+
+} // namespace mbed
+
+#endif
@@ -0,0 +1,208 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_SPSCCIRCULARBUFFER_H
+#define MBED_SPSCCIRCULARBUFFER_H
+
+#include <stdint.h>
+#include "platform/mbed_atomic.h"
+
+namespace mbed {
+
+/** \addtogroup platform-public-api */
+/** @{*/
+/**
+ * \defgroup platform_SPSCCircularBuffer SPSCCircularBuffer functions
+ * @{
+ */
+
+/** Lock-free single-producer/single-consumer circular buffer.
+ *
+ * A specialization of the CircularBuffer concept for the common case of
+ * exactly one producer context and one consumer context (for example an
+ * interrupt handler feeding a thread). Unlike CircularBuffer, no critical
+ * section is entered on either side: the producer only writes the head
+ * index and the consumer only writes the tail index, with acquire/release
+ * ordering making the element visible before the index update. This keeps
+ * interrupts enabled and makes push() safe to call from zero-latency
+ * contexts such as high-priority ISRs.
+ *
+ * The buffer never overwrites: push() fails when full, as a lock-free
+ * producer cannot safely reclaim the consumer's slot. One storage slot is
+ * kept empty to distinguish full from empty, so the usable capacity is
+ * BufferSize.
+ *
+ *  @note Synchronization level: Interrupt safe, for one producer and one
+ *        consumer only. Multiple producers or consumers require
+ *        CircularBuffer or external locking.
+ */
+template<typename T, uint32_t BufferSize>
+class SPSCCircularBuffer {
+public:
+    SPSCCircularBuffer() : _head(0), _tail(0)
+    {
+    }
+
+    ~SPSCCircularBuffer()
+    {
+    }
+
+    /** Push the transaction to the buffer. Producer context only.
+     *
+     * @param data Data to be pushed to the buffer.
+     * @return True if the data was pushed, false if the buffer was full.
+     */
+    bool push(const T &data)
+    {
+        uint32_t head = _head;
+        uint32_t next = increment(head);
+        if (next == core_util_atomic_load_explicit_u32(&_tail, mbed_memory_order_acquire)) {
+            return false;
+        }
+        _buffer[head] = data;
+        // Publish the element before the index so the consumer never reads
+        // an unwritten slot.
+        core_util_atomic_store_explicit_u32(&_head, next, mbed_memory_order_release);
+        return true;
+    }
+
+    /** Push multiple elements to the buffer. Producer context only.
+     *
+     * @param src Data to be pushed to the buffer.
+     * @param len Number of elements to push.
+     * @return The number of elements actually pushed, less than len if the
+     *         buffer filled up.
+     */
+    uint32_t push(const T *src, uint32_t len)
+    {
+        uint32_t pushed = 0;
+        while (pushed < len && push(src[pushed])) {
+            pushed++;
+        }
+        return pushed;
+    }
+
+    /** Pop from the buffer. Consumer context only.
+     *
+     * @param data Container to store the data to be popped from the buffer.
+     * @return True if data popped.
+     */
+    bool pop(T &data)
+    {
+        uint32_t tail = _tail;
+        if (tail == core_util_atomic_load_explicit_u32(&_head, mbed_memory_order_acquire)) {
+            return false;
+        }
+        data = _buffer[tail];
+        core_util_atomic_store_explicit_u32(&_tail, increment(tail), mbed_memory_order_release);
+        return true;
+    }
+
+    /** Pop multiple elements from the buffer. Consumer context only.
+     *
+     * @param dest The array which will receive the elements.
+     * @param len The number of elements to pop.
+     * @return The number of elements popped.
+     */
+    uint32_t pop(T *dest, uint32_t len)
+    {
+        uint32_t popped = 0;
+        while (popped < len && pop(dest[popped])) {
+            popped++;
+        }
+        return popped;
+    }
+
+    /** Peek into the buffer without popping. Consumer context only.
+     *
+     * @param data Data to be peeked from the buffer.
+     * @return True if the buffer is not empty and data contains a transaction, false otherwise.
+     */
+    bool peek(T &data) const
+    {
+        uint32_t tail = _tail;
+        if (tail == core_util_atomic_load_explicit_u32(&_head, mbed_memory_order_acquire)) {
+            return false;
+        }
+        data = _buffer[tail];
+        return true;
+    }
+
+    /** Check if the buffer is empty. Exact in the consumer context,
+     * conservative elsewhere.
+     *
+     * @return True if the buffer is empty, false if not.
+     */
+    bool empty() const
+    {
+        return core_util_atomic_load_explicit_u32(&_head, mbed_memory_order_acquire) ==
+               core_util_atomic_load_explicit_u32(&_tail, mbed_memory_order_acquire);
+    }
+
+    /** Check if the buffer is full. Exact in the producer context,
+     * conservative elsewhere.
+     *
+     * @return True if the buffer is full, false if not.
+     */
+    bool full() const
+    {
+        return increment(core_util_atomic_load_explicit_u32(&_head, mbed_memory_order_acquire)) ==
+               core_util_atomic_load_explicit_u32(&_tail, mbed_memory_order_acquire);
+    }
+
+    /** Get the number of elements currently stored in the circular buffer.
+     *
+     * The result is exact if called from the producer or consumer context,
+     * otherwise a snapshot.
+     */
+    uint32_t size() const
+    {
+        uint32_t head = core_util_atomic_load_explicit_u32(&_head, mbed_memory_order_acquire);
+        uint32_t tail = core_util_atomic_load_explicit_u32(&_tail, mbed_memory_order_acquire);
+        return (head >= tail) ? (head - tail) : (BufferSize + 1 + head - tail);
+    }
+
+    /** Reset the buffer.
+     *
+     * @note Not lock-free: only call while neither producer nor consumer
+     *       is active.
+     */
+    void reset()
+    {
+        core_util_atomic_store_explicit_u32(&_head, 0, mbed_memory_order_release);
+        core_util_atomic_store_explicit_u32(&_tail, 0, mbed_memory_order_release);
+    }
+
+private:
+    static uint32_t increment(uint32_t val)
+    {
+        return (val == BufferSize) ? 0 : (val + 1);
+    }
+
+    T _buffer[BufferSize + 1];
+    /* Written only by the producer */
+    volatile uint32_t _head;
+    /* Written only by the consumer */
+    volatile uint32_t _tail;
+};
+
+/**@}*/
+
+/**@}*/
+
+}
+
+#endif
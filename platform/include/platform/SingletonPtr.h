@@ -124,13 +124,17 @@ struct SingletonPtr {
      */
     T *get() const
     {
-        T *p = core_util_atomic_load(&_ptr);
+        // Double-checked: after initialization every call is this one
+        // acquire-load and branch, with no mutex round-trip. Acquire here
+        // pairs with the release store below so that a thread seeing the
+        // pointer also sees the constructed object.
+        T *p = core_util_atomic_load_explicit(&_ptr, mbed_memory_order_acquire);
         if (p == NULL) {
             singleton_lock();
             p = _ptr;
             if (p == NULL) {
                 p = new (_data) T();
-                core_util_atomic_store(&_ptr, p);
+                core_util_atomic_store_explicit(&_ptr, p, mbed_memory_order_release);
             }
             singleton_unlock();
         }
@@ -205,6 +209,82 @@ struct SingletonPtr {
 #endif
 };
 
+/** Variant of SingletonPtr for types constructible at compile time
+ *
+ * @note Synchronization level: Thread safe
+ *
+ * When T has a constexpr default constructor there is nothing to do
+ * lazily: the wrapped object is constant-initialized before any code
+ * runs, so access needs no flag check, no mutex and no atomics at all -
+ * get() is a plain address computation. Use this in place of
+ * SingletonPtr where T permits it; the accessor surface is the same, so
+ * call sites do not change.
+ *
+ * As with SingletonPtr, the destructor of the wrapped object is never
+ * run automatically, keeping it linker-excludable from images that
+ * never exit, and an unused instance is excluded entirely.
+ */
+template <class T>
+struct ConstSingletonPtr {
+
+    constexpr ConstSingletonPtr() noexcept : _instance() { }
+
+    /** Get a pointer to the underlying singleton
+     *
+     * @returns
+     *   A pointer to the singleton
+     */
+    T *get() const
+    {
+        return &_instance;
+    }
+
+    /** Get a pointer to the underlying singleton
+     *
+     * @returns
+     *   A pointer to the singleton
+     */
+    T *operator->() const
+    {
+        return get();
+    }
+
+    /** Get a reference to the underlying singleton
+     *
+     * @returns
+     *   A reference to the singleton
+     */
+    T &operator*() const
+    {
+        return *get();
+    }
+
+    /** Get a pointer to the underlying singleton
+     *
+     * Provided for signature compatibility with SingletonPtr; the
+     * object is always initialized, so this is equivalent to get().
+     *
+     * @returns
+     *   A pointer to the singleton
+     */
+    T *get_no_init() const
+    {
+        return get();
+    }
+
+    /** Destroy the underlying singleton
+     *
+     * See SingletonPtr::destroy. Not thread-safe, and no further
+     * operations on the object are permitted afterwards.
+     */
+    void destroy()
+    {
+        _instance.~T();
+    }
+
+    mutable T _instance;
+};
+
 #endif
 /**@}*/
 
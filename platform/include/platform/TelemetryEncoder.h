@@ -0,0 +1,355 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_TELEMETRYENCODER_H
+#define MBED_TELEMETRYENCODER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform/Span.h"
+
+namespace mbed {
+
+/** \addtogroup platform-public-api */
+/** @{*/
+/**
+ * \defgroup platform_TelemetryEncoder TelemetryEncoder classes
+ * @{
+ */
+
+/** Streaming JSON writer into a caller-supplied buffer
+ *
+ *  Serializes a record field by field directly into a Span - typically a
+ *  socket send buffer - with no heap allocation and no intermediate
+ *  document tree. Commas and quoting are handled by the writer, string
+ *  literal keys have their length computed at compile time, and each
+ *  scalar costs a handful of digit operations rather than a printf
+ *  format-string parse.
+ *
+ *  Writes past the end of the buffer latch an overflow flag instead of
+ *  failing per call, so a record can be encoded without per-field error
+ *  checks and validated once at the end:
+ *
+ *  @code
+ *  char buf[128];
+ *  JsonEncoder json(buf);
+ *  json.begin_object();
+ *  json.key("temp").value(23.5f);
+ *  json.key("samples").value(1024);
+ *  json.end_object();
+ *  if (!json.overflowed()) {
+ *      socket.send(json.data().data(), json.size());
+ *  }
+ *  @endcode
+ *
+ *  Non-finite floats encode as null, which JSON cannot represent.
+ *  Containers may nest up to 32 levels deep; deeper nesting latches the
+ *  overflow flag.
+ *
+ * @note Synchronization level: Not protected
+ */
+class JsonEncoder {
+public:
+    /** Construct an encoder writing into the given buffer
+     *
+     *  @param buffer   Destination for the encoded record
+     */
+    JsonEncoder(Span<char> buffer) : _buffer(buffer)
+    {
+        reset();
+    }
+
+    /** Discard everything written and start a new record */
+    void reset()
+    {
+        _size = 0;
+        _depth = 0;
+        _overflowed = false;
+        _first = 0;
+        _in_object = 0;
+    }
+
+    /** Get the encoded bytes written so far
+     *
+     *  @return         View of the written part of the buffer
+     */
+    Span<const char> data() const
+    {
+        return _buffer.first(_size);
+    }
+
+    /** Get the number of bytes written so far
+     *
+     *  @return         Encoded size in bytes
+     */
+    size_t size() const
+    {
+        return _size;
+    }
+
+    /** Check whether the record outgrew the buffer
+     *
+     *  @return         True if any write did not fit; the buffer contents
+     *                  are then truncated and must not be sent
+     */
+    bool overflowed() const
+    {
+        return _overflowed;
+    }
+
+    /** Open an object. Also valid as an object or array member */
+    JsonEncoder &begin_object();
+
+    /** Close the innermost object */
+    JsonEncoder &end_object();
+
+    /** Open an array. Also valid as an object or array member */
+    JsonEncoder &begin_array();
+
+    /** Close the innermost array */
+    JsonEncoder &end_array();
+
+    /** Write a member key from a string literal
+     *
+     *  The length is deduced at compile time, so no strlen runs on the
+     *  encode path.
+     *
+     *  @param name     Key, escaped as needed
+     */
+    template <size_t N>
+    JsonEncoder &key(const char (&name)[N])
+    {
+        return key(name, N - 1);
+    }
+
+    /** Write a member key
+     *
+     *  @param name     Key, escaped as needed
+     *  @param len      Length of the key in bytes
+     */
+    JsonEncoder &key(const char *name, size_t len);
+
+    /** Write a string value from a string literal
+     *
+     *  @param str      Value, escaped as needed
+     */
+    template <size_t N>
+    JsonEncoder &value(const char (&str)[N])
+    {
+        return value(str, N - 1);
+    }
+
+    /** Write a string value
+     *
+     *  @param str      Value, escaped as needed
+     *  @param len      Length of the value in bytes
+     */
+    JsonEncoder &value(const char *str, size_t len);
+
+    /** Write an integer value */
+    JsonEncoder &value(int32_t v)
+    {
+        return value((int64_t) v);
+    }
+
+    /** Write an integer value */
+    JsonEncoder &value(uint32_t v)
+    {
+        return value((uint64_t) v);
+    }
+
+    /** Write an integer value */
+    JsonEncoder &value(int64_t v);
+
+    /** Write an integer value */
+    JsonEncoder &value(uint64_t v);
+
+    /** Write a boolean value */
+    JsonEncoder &value(bool v);
+
+    /** Write a floating point value with up to six fractional digits */
+    JsonEncoder &value(float v);
+
+    /** Write a null value */
+    JsonEncoder &null();
+
+private:
+    void put(char c);
+    void put(const char *s, size_t len);
+    void put_escaped(const char *s, size_t len);
+    void put_uint(uint64_t v);
+    void separate();
+    void separate_value();
+
+    Span<char> _buffer;
+    size_t _size;
+    uint32_t _depth;
+    bool _overflowed;
+    uint32_t _first;        // Bit per depth: next member is the first
+    uint32_t _in_object;    // Bit per depth: container is an object
+};
+
+/** Streaming CBOR writer into a caller-supplied buffer
+ *
+ *  The binary counterpart of JsonEncoder with the same shape: fields are
+ *  emitted straight into a Span with no allocation, overflow latches,
+ *  and string literal lengths are computed at compile time. Integers use
+ *  the shortest CBOR encoding, floats encode as single precision.
+ *
+ *  Containers may be opened with their member count when it is known
+ *  (the usual case for a fixed telemetry schema), or indefinite-length
+ *  with begin_map()/begin_array() and closed with end().
+ *
+ * @note Synchronization level: Not protected
+ */
+class CborEncoder {
+public:
+    /** Construct an encoder writing into the given buffer
+     *
+     *  @param buffer   Destination for the encoded record
+     */
+    CborEncoder(Span<uint8_t> buffer) : _buffer(buffer)
+    {
+        reset();
+    }
+
+    /** Discard everything written and start a new record */
+    void reset()
+    {
+        _size = 0;
+        _overflowed = false;
+    }
+
+    /** Get the encoded bytes written so far
+     *
+     *  @return         View of the written part of the buffer
+     */
+    Span<const uint8_t> data() const
+    {
+        return _buffer.first(_size);
+    }
+
+    /** Get the number of bytes written so far
+     *
+     *  @return         Encoded size in bytes
+     */
+    size_t size() const
+    {
+        return _size;
+    }
+
+    /** Check whether the record outgrew the buffer
+     *
+     *  @return         True if any write did not fit; the buffer contents
+     *                  are then truncated and must not be sent
+     */
+    bool overflowed() const
+    {
+        return _overflowed;
+    }
+
+    /** Open a map of a known number of key/value pairs */
+    CborEncoder &begin_map(size_t pairs);
+
+    /** Open an array of a known number of members */
+    CborEncoder &begin_array(size_t items);
+
+    /** Open an indefinite-length map, closed with end() */
+    CborEncoder &begin_map();
+
+    /** Open an indefinite-length array, closed with end() */
+    CborEncoder &begin_array();
+
+    /** Close the innermost indefinite-length container */
+    CborEncoder &end();
+
+    /** Write a map key from a string literal
+     *
+     *  @param name     Key text
+     */
+    template <size_t N>
+    CborEncoder &key(const char (&name)[N])
+    {
+        return value(name, N - 1);
+    }
+
+    /** Write a text string value from a string literal
+     *
+     *  @param str      Value text
+     */
+    template <size_t N>
+    CborEncoder &value(const char (&str)[N])
+    {
+        return value(str, N - 1);
+    }
+
+    /** Write a text string value
+     *
+     *  @param str      Value text
+     *  @param len      Length of the value in bytes
+     */
+    CborEncoder &value(const char *str, size_t len);
+
+    /** Write a byte string value
+     *
+     *  @param bytes    Value bytes
+     */
+    CborEncoder &value(Span<const uint8_t> bytes);
+
+    /** Write an integer value */
+    CborEncoder &value(int32_t v)
+    {
+        return value((int64_t) v);
+    }
+
+    /** Write an integer value */
+    CborEncoder &value(uint32_t v)
+    {
+        return value((uint64_t) v);
+    }
+
+    /** Write an integer value */
+    CborEncoder &value(int64_t v);
+
+    /** Write an integer value */
+    CborEncoder &value(uint64_t v);
+
+    /** Write a boolean value */
+    CborEncoder &value(bool v);
+
+    /** Write a floating point value as single precision */
+    CborEncoder &value(float v);
+
+    /** Write a null value */
+    CborEncoder &null();
+
+private:
+    void put(uint8_t b);
+    void put_head(uint8_t major, uint64_t arg);
+
+    Span<uint8_t> _buffer;
+    size_t _size;
+    bool _overflowed;
+};
+
+/**@}*/
+
+/**@}*/
+
+} // namespace mbed
+
+#endif
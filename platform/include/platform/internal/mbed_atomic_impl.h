@@ -54,6 +54,36 @@ extern "C" {
 #define MBED_ATOMIC_PTR_SIZE 64
 #endif
 
+/* Optional contention instrumentation, enabled with MBED_ATOMIC_STATS_ENABLED.
+ *
+ * Counts exclusive-access retries (STREX failures), failed compare-and-swap
+ * attempts and critical-section fallbacks per atomic object, accumulated in
+ * mbed_atomic_impl.c and read back with mbed_stats_atomic_get_each(). The
+ * operations are inlined into their callers, so attribution is by the
+ * address of the atomic variable - which names the contended object exactly
+ * - rather than by call site. The hooks cost a branch per loop iteration
+ * and a function call per contended operation; this is a measurement mode,
+ * not for production builds.
+ */
+#ifdef MBED_ATOMIC_STATS_ENABLED
+/* Implemented in mbed_atomic_impl.c */
+void mbed_atomic_stats_record_retries(const volatile void *object, uint32_t retries);
+void mbed_atomic_stats_record_fail(const volatile void *object);
+void mbed_atomic_stats_record_locked(const volatile void *object);
+
+#define MBED_ATOMIC_STATS_RETRY_DECL uint32_t stats_retries_ = 0
+#define MBED_ATOMIC_STATS_RETRY_COUNT do { if (fail) { ++stats_retries_; } } while (0)
+#define MBED_ATOMIC_STATS_RETRY_REPORT(object) do { \
+        if (stats_retries_) { mbed_atomic_stats_record_retries((object), stats_retries_); } \
+    } while (0)
+#define MBED_ATOMIC_STATS_CAS_FAIL(object) mbed_atomic_stats_record_fail(object)
+#else
+#define MBED_ATOMIC_STATS_RETRY_DECL (void)0
+#define MBED_ATOMIC_STATS_RETRY_COUNT (void)0
+#define MBED_ATOMIC_STATS_RETRY_REPORT(object) (void)0
+#define MBED_ATOMIC_STATS_CAS_FAIL(object) (void)0
+#endif
+
 /* Place barrier after a load or read-modify-write if a consume or acquire operation */
 #define MBED_ACQUIRE_BARRIER(order) do { \
     if ((order) & (mbed_memory_order_consume|mbed_memory_order_acquire)) { \
@@ -345,11 +375,14 @@ inline T core_util_atomic_exchange_##fn_suffix(volatile T *valuePtr, T newValue)
 {                                                                               \
     T oldValue;                                                                 \
     uint32_t fail;                                                              \
+    MBED_ATOMIC_STATS_RETRY_DECL;                                               \
     MBED_BARRIER();                                                             \
     do {                                                                        \
         DO_MBED_LOCKFREE_EXCHG_ASM(M);                                          \
+        MBED_ATOMIC_STATS_RETRY_COUNT;                                          \
     } while (fail);                                                             \
     MBED_BARRIER();                                                             \
+    MBED_ATOMIC_STATS_RETRY_REPORT(valuePtr);                                   \
     return oldValue;                                                            \
 }                                                                               \
                                                                                 \
@@ -358,11 +391,14 @@ MBED_FORCEINLINE T core_util_atomic_exchange_explicit_##fn_suffix(
 {                                                                               \
     T oldValue;                                                                 \
     uint32_t fail;                                                              \
+    MBED_ATOMIC_STATS_RETRY_DECL;                                               \
     MBED_RELEASE_BARRIER(order);                                                \
     do {                                                                        \
         DO_MBED_LOCKFREE_EXCHG_ASM(M);                                          \
+        MBED_ATOMIC_STATS_RETRY_COUNT;                                          \
     } while (fail);                                                             \
     MBED_ACQUIRE_BARRIER(order);                                                \
+    MBED_ATOMIC_STATS_RETRY_REPORT(valuePtr);                                   \
     return oldValue;                                                            \
 }
 
@@ -375,6 +411,7 @@ inline bool core_util_atomic_compare_exchange_weak_##fn_suffix(volatile T *ptr,
     DO_MBED_LOCKFREE_CAS_WEAK_ASM(M);                                           \
     if (fail) {                                                                 \
         *expectedCurrentValue = oldValue;                                       \
+        MBED_ATOMIC_STATS_CAS_FAIL(ptr);                                        \
     }                                                                           \
     MBED_BARRIER();                                                             \
     return !fail;                                                               \
@@ -389,6 +426,7 @@ MBED_FORCEINLINE bool core_util_atomic_compare_exchange_weak_explicit_##fn_suffi
     DO_MBED_LOCKFREE_CAS_WEAK_ASM(M);                                           \
     if (fail) {                                                                 \
         *expectedCurrentValue = oldValue;                                       \
+        MBED_ATOMIC_STATS_CAS_FAIL(ptr);                                        \
     }                                                                           \
     MBED_ACQUIRE_BARRIER(fail ? failure : success);                             \
     return !fail;                                                               \
@@ -403,6 +441,7 @@ inline bool core_util_atomic_cas_##fn_suffix(volatile T *ptr, T *expectedCurrent
     DO_MBED_LOCKFREE_CAS_STRONG_ASM(M);                                         \
     if (fail) {                                                                 \
         *expectedCurrentValue = oldValue;                                       \
+        MBED_ATOMIC_STATS_CAS_FAIL(ptr);                                        \
     }                                                                           \
     MBED_BARRIER();                                                             \
     return !fail;                                                               \
@@ -417,6 +456,7 @@ MBED_FORCEINLINE bool core_util_atomic_cas_explicit_##fn_suffix(volatile T *ptr,
     DO_MBED_LOCKFREE_CAS_STRONG_ASM(M);                                         \
     if (fail) {                                                                 \
         *expectedCurrentValue = oldValue;                                       \
+        MBED_ATOMIC_STATS_CAS_FAIL(ptr);                                        \
     }                                                                           \
     MBED_ACQUIRE_BARRIER(fail ? failure : success);                             \
     return !fail;                                                               \
@@ -427,11 +467,14 @@ MBED_FORCEINLINE bool core_util_atomic_cas_explicit_##fn_suffix(volatile T *ptr,
 inline T core_util_atomic_##name##_##fn_suffix(volatile T *valuePtr, T arg)     \
 {                                                                               \
     uint32_t fail, newValue;                                                    \
+    MBED_ATOMIC_STATS_RETRY_DECL;                                               \
     MBED_BARRIER();                                                             \
     do {                                                                        \
         DO_MBED_LOCKFREE_NEWVAL_2OP_ASM(OP, Constants, M);                      \
+        MBED_ATOMIC_STATS_RETRY_COUNT;                                          \
     } while (fail);                                                             \
     MBED_BARRIER();                                                             \
+    MBED_ATOMIC_STATS_RETRY_REPORT(valuePtr);                                   \
     return (T) newValue;                                                        \
 }                                                                               \
                                                                                 \
@@ -439,11 +482,14 @@ MBED_FORCEINLINE T core_util_atomic_##name##_explicit_##fn_suffix(
         volatile T *valuePtr, T arg, mbed_memory_order order)                   \
 {                                                                               \
     uint32_t fail, newValue;                                                    \
+    MBED_ATOMIC_STATS_RETRY_DECL;                                               \
     MBED_RELEASE_BARRIER(order);                                                \
     do {                                                                        \
         DO_MBED_LOCKFREE_NEWVAL_2OP_ASM(OP, Constants, M);                      \
+        MBED_ATOMIC_STATS_RETRY_COUNT;                                          \
     } while (fail);                                                             \
     MBED_ACQUIRE_BARRIER(order);                                                \
+    MBED_ATOMIC_STATS_RETRY_REPORT(valuePtr);                                   \
     return (T) newValue;                                                        \
 }                                                                               \
 
@@ -452,11 +498,14 @@ inline T core_util_atomic_##name##_##fn_suffix(volatile T *valuePtr, T arg)
 {                                                                               \
     T oldValue;                                                                 \
     uint32_t fail, newValue;                                                    \
+    MBED_ATOMIC_STATS_RETRY_DECL;                                               \
     MBED_BARRIER();                                                             \
     do {                                                                        \
         DO_MBED_LOCKFREE_OLDVAL_2OP_ASM(OP, Constants, M);                      \
+        MBED_ATOMIC_STATS_RETRY_COUNT;                                          \
     } while (fail);                                                             \
     MBED_BARRIER();                                                             \
+    MBED_ATOMIC_STATS_RETRY_REPORT(valuePtr);                                   \
     return oldValue;                                                            \
 }                                                                               \
                                                                                 \
@@ -465,11 +514,14 @@ MBED_FORCEINLINE T core_util_atomic_##name##_explicit_##fn_suffix(
 {                                                                               \
     T oldValue;                                                                 \
     uint32_t fail, newValue;                                                    \
+    MBED_ATOMIC_STATS_RETRY_DECL;                                               \
     MBED_RELEASE_BARRIER(order);                                                \
     do {                                                                        \
         DO_MBED_LOCKFREE_OLDVAL_2OP_ASM(OP, Constants, M);                      \
+        MBED_ATOMIC_STATS_RETRY_COUNT;                                          \
     } while (fail);                                                             \
     MBED_ACQUIRE_BARRIER(order);                                                \
+    MBED_ATOMIC_STATS_RETRY_REPORT(valuePtr);                                   \
     return oldValue;                                                            \
 }                                                                               \
 
@@ -477,11 +529,14 @@ MBED_FORCEINLINE T core_util_atomic_##name##_explicit_##fn_suffix(
 inline T core_util_atomic_##name##_##fn_suffix(volatile T *valuePtr, T arg) {   \
     T oldValue;                                                                 \
     uint32_t fail, newValue;                                                    \
+    MBED_ATOMIC_STATS_RETRY_DECL;                                               \
     MBED_BARRIER();                                                             \
     do {                                                                        \
         DO_MBED_LOCKFREE_OLDVAL_3OP_ASM(OP, Constants, M);                      \
+        MBED_ATOMIC_STATS_RETRY_COUNT;                                          \
     } while (fail);                                                             \
     MBED_BARRIER();                                                             \
+    MBED_ATOMIC_STATS_RETRY_REPORT(valuePtr);                                   \
     return oldValue;                                                            \
 }                                                                               \
                                                                                 \
@@ -490,11 +545,14 @@ MBED_FORCEINLINE T core_util_atomic_##name##_explicit_##fn_suffix(
 {                                                                               \
     T oldValue;                                                                 \
     uint32_t fail, newValue;                                                    \
+    MBED_ATOMIC_STATS_RETRY_DECL;                                               \
     MBED_RELEASE_BARRIER(order);                                                \
     do {                                                                        \
         DO_MBED_LOCKFREE_OLDVAL_3OP_ASM(OP, Constants, M);                      \
+        MBED_ATOMIC_STATS_RETRY_COUNT;                                          \
     } while (fail);                                                             \
     MBED_ACQUIRE_BARRIER(order);                                                \
+    MBED_ATOMIC_STATS_RETRY_REPORT(valuePtr);                                   \
     return oldValue;                                                            \
 }                                                                               \
 
@@ -503,10 +561,13 @@ inline bool core_util_atomic_flag_test_and_set(volatile core_util_atomic_flag *v
     MBED_BARRIER();
     bool oldValue, newValue = true;
     uint32_t fail;
+    MBED_ATOMIC_STATS_RETRY_DECL;
     do {
         DO_MBED_LOCKFREE_EXCHG_ASM(B);
+        MBED_ATOMIC_STATS_RETRY_COUNT;
     } while (fail);
     MBED_BARRIER();
+    MBED_ATOMIC_STATS_RETRY_REPORT(valuePtr);
     return oldValue;
 }
 
@@ -515,10 +576,13 @@ MBED_FORCEINLINE bool core_util_atomic_flag_test_and_set_explicit(volatile core_
     MBED_RELEASE_BARRIER(order);
     bool oldValue, newValue = true;
     uint32_t fail;
+    MBED_ATOMIC_STATS_RETRY_DECL;
     do {
         DO_MBED_LOCKFREE_EXCHG_ASM(B);
+        MBED_ATOMIC_STATS_RETRY_COUNT;
     } while (fail);
     MBED_ACQUIRE_BARRIER(order);
+    MBED_ATOMIC_STATS_RETRY_REPORT(valuePtr);
     return oldValue;
 }
 
@@ -1130,13 +1194,13 @@ inline void core_util_atomic_store(T **valuePtr, T *val) noexcept
 template<typename T>
 inline void core_util_atomic_store_explicit(T *volatile *valuePtr, T *val, mbed_memory_order order) noexcept
 {
-    core_util_atomic_store_ptr((void *volatile *) valuePtr, val, order);
+    core_util_atomic_store_explicit_ptr((void *volatile *) valuePtr, val, order);
 }
 
 template<typename T>
 inline void core_util_atomic_store_explicit(T **valuePtr, T *val, mbed_memory_order order) noexcept
 {
-    core_util_atomic_store_ptr((void **) valuePtr, val, order);
+    core_util_atomic_store_explicit_ptr((void **) valuePtr, val, order);
 }
 
 DO_MBED_ATOMIC_STORE_TEMPLATE(uint8_t,  u8)
@@ -0,0 +1,100 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_LP_DRIFT_H
+#define MBED_LP_DRIFT_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** \addtogroup platform-public-api */
+/** @{*/
+
+/**
+ * \defgroup platform_lp_drift Low-power ticker drift model
+ *
+ * A 32kHz crystal drifts tens of ppm with temperature, so deadlines
+ * programmed on the low-power ticker land early or late by that factor -
+ * time-synchronized applications then pad every wakeup by the worst-case
+ * drift and pay for it in radio-on time.
+ *
+ * This service maintains a measured frequency-error model for the
+ * low-power ticker. Calling mbed_lp_drift_sample() periodically
+ * disciplines it against the high-speed ticker: each sample compares the
+ * elapsed time both tickers report over the window since the previous
+ * sample and folds the difference into a filtered error estimate, so the
+ * estimate follows temperature as it changes. Nodes with a better
+ * reference (network time) can set the error directly instead.
+ *
+ * When MBED_CONF_PLATFORM_LP_DRIFT_COMPENSATION is enabled, SysTimer
+ * scales its wake deadlines by the modelled error, so tick and wake
+ * programming lands on the true deadline without application padding.
+ *
+ * The error convention: positive means the low-power ticker runs fast
+ * (reports more elapsed time than true), negative means it runs slow.
+ * @{
+ */
+
+/** Sample the low-power ticker against the high-speed ticker
+ *
+ * Call periodically from thread context - every few seconds to minutes
+ * is enough to follow temperature. The first call only establishes a
+ * baseline; later calls measure the window since the previous one and
+ * update the filtered error estimate. Windows shorter than one second
+ * are ignored, as quantization would dominate the measurement.
+ *
+ * Does nothing when the target has no high-speed ticker to compare
+ * against; use mbed_lp_drift_set_ppb() there.
+ */
+void mbed_lp_drift_sample(void);
+
+/** Set the low-power ticker frequency error from an external reference
+ *
+ * For nodes that can measure their clock against network time. Replaces
+ * the current model value; a later mbed_lp_drift_sample() continues
+ * filtering from it.
+ *
+ * @param ppb Frequency error in parts per billion, positive = fast
+ */
+void mbed_lp_drift_set_ppb(int32_t ppb);
+
+/** Get the modelled low-power ticker frequency error
+ *
+ * @return Frequency error in parts per billion, positive = fast; 0 until
+ *         the model has a measurement
+ */
+int32_t mbed_lp_drift_get_ppb(void);
+
+/** Get the modelled low-power ticker frequency error in ppm
+ *
+ * Convenience scaling of mbed_lp_drift_get_ppb() for reporting.
+ *
+ * @return Frequency error in parts per million, positive = fast
+ */
+int32_t mbed_lp_drift_get_ppm(void);
+
+/**@}*/
+
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
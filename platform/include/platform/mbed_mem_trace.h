@@ -162,6 +162,62 @@ void mbed_mem_trace_free(void *ptr, void *caller);
  */
 void mbed_mem_trace_default_callback(uint8_t op, void *res, void *caller, ...);
 
+/**
+ * A fixed-size binary record of a single memory operation, as stored by the
+ * ring tracer. 'ptr' is the result of the operation, or the freed pointer
+ * for 'free'. 'size' is the requested size ('nmemb * size' for 'calloc',
+ * 0 for 'free').
+ */
+typedef struct {
+    void *caller;
+    void *ptr;
+    uint32_t size;
+    uint8_t op;
+} mbed_mem_trace_record_t;
+
+/**
+ * Start tracing into a preallocated ring of binary records instead of the
+ * printf-based callback. Each traced operation stores a fixed-size
+ * mbed_mem_trace_record_t, so the per-allocation overhead is a few stores
+ * rather than a formatted print, making the tracer usable on live devices.
+ * When the ring is full, the oldest record is overwritten.
+ *
+ * This installs a callback via 'mbed_mem_trace_set_callback', so it replaces
+ * any callback set earlier.
+ *
+ * @param records       caller-allocated storage for the ring.
+ * @param count         number of records the storage can hold. Must be non-zero.
+ * @param sample_rate   record every Nth operation (1 records everything).
+ *                      Must be non-zero.
+ * @return 0 on success, -1 on invalid arguments.
+ */
+int mbed_mem_trace_ring_setup(mbed_mem_trace_record_t *records, size_t count, uint32_t sample_rate);
+
+/**
+ * Stop the ring tracer and detach it from the trace callback. The records
+ * already stored remain available to 'mbed_mem_trace_ring_drain'.
+ */
+void mbed_mem_trace_ring_stop(void);
+
+/**
+ * Copy and remove the oldest records from the ring. Can be called while
+ * tracing is active; records stored concurrently are picked up by the next
+ * drain.
+ *
+ * @param dest      destination array for the drained records.
+ * @param max_count capacity of 'dest' in records.
+ * @return the number of records copied.
+ */
+size_t mbed_mem_trace_ring_drain(mbed_mem_trace_record_t *dest, size_t max_count);
+
+/**
+ * Number of records overwritten before they could be drained since the last
+ * call to 'mbed_mem_trace_ring_setup'.
+ *
+ * @return the number of lost records.
+ */
+size_t mbed_mem_trace_ring_dropped(void);
+
 /** @}*/
 
 #ifdef __cplusplus
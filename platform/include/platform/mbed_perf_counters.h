@@ -0,0 +1,134 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_PERF_COUNTERS_H
+#define MBED_PERF_COUNTERS_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "platform/mbed_stats.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** \addtogroup platform-public-api */
+/** @{*/
+
+/**
+ * \defgroup platform_perf_counters Performance counters
+ *
+ * Cycle-accurate measurement of named code regions using the core's
+ * hardware counters. A region is timed by snapshotting the counters with
+ * mbed_perf_begin(), running the code, and accumulating the deltas into a
+ * named slot with mbed_perf_end(); mbed::PerfScope does both from a single
+ * RAII object. Accumulated slots are read back through
+ * mbed_stats_perf_get_each().
+ *
+ * Cycles come from the DWT cycle counter. Beside cycles, one auxiliary
+ * event can be counted at a time, selected with mbed_perf_event_select():
+ * on Armv8.1-M cores with a PMU the event is multiplexed onto a 16-bit PMU
+ * event counter; on other Cortex-M cores it maps to the corresponding
+ * 8-bit DWT profiling counter, whose delta is only exact for scopes
+ * shorter than 256 occurrences of the event.
+ *
+ * Everything is compiled out unless MBED_PERF_COUNTERS_ENABLED is
+ * defined: the functions below become empty macros and mbed::PerfScope an
+ * empty object, so instrumentation can stay in the code.
+ * @{
+ */
+
+/** Auxiliary events countable beside cycles */
+typedef enum {
+    MBED_PERF_EVENT_NONE = 0,   /**< Count cycles only */
+    MBED_PERF_EVENT_INST,       /**< Instructions: retired (PMU) or additional cycles per instruction (DWT CPI counter) */
+    MBED_PERF_EVENT_EXC,        /**< Exception entries (PMU) or cycles of exception overhead (DWT) */
+    MBED_PERF_EVENT_SLEEP,      /**< Cycles spent sleeping (DWT only) */
+    MBED_PERF_EVENT_LSU,        /**< Memory accesses (PMU) or additional load/store cycles (DWT) */
+    MBED_PERF_EVENT_FOLD,       /**< Folded (zero-cycle) instructions (DWT only) */
+} mbed_perf_event_t;
+
+/** Counter snapshot taken at the start of a scope; lives on the caller's
+ * stack so scopes nest freely
+ */
+typedef struct {
+    uint32_t cycles;    /**< Cycle counter at mbed_perf_begin() */
+    uint32_t events;    /**< Auxiliary counter at mbed_perf_begin() */
+} mbed_perf_sample_t;
+
+#if defined(MBED_PERF_COUNTERS_ENABLED) || defined(DOXYGEN_ONLY)
+
+/** Find or create the slot with the given name.
+ *
+ *  The name is stored by pointer, so it must remain valid - pass a string
+ *  literal. Safe to call repeatedly: the same name returns the same slot.
+ *
+ *  @param name Name of the slot
+ *  @return the slot index, or -1 when all MBED_PERF_STATS_SLOTS slots
+ *  have been taken by other names or counters are unavailable on this core
+ */
+int mbed_perf_slot(const char *name);
+
+/** Select the auxiliary event counted beside cycles.
+ *
+ *  The selection is global: one auxiliary event is counted at a time and
+ *  every scope accumulates the currently selected one. Changing the event
+ *  mid-scope makes that scope's event delta meaningless; counts
+ *  accumulated under the previous selection are retained.
+ *
+ *  @param event the event to count
+ *  @return 0 on success, -1 if the event is not countable on this core
+ */
+int mbed_perf_event_select(mbed_perf_event_t event);
+
+/** Snapshot the counters at the start of a scope.
+ *
+ *  @param sample filled with the current counter values
+ */
+void mbed_perf_begin(mbed_perf_sample_t *sample);
+
+/** Accumulate a scope's counter deltas into a slot.
+ *
+ *  @param slot the slot returned by mbed_perf_slot(); negative values are
+ *  ignored so a failed slot lookup degrades to a no-op
+ *  @param sample the snapshot taken by mbed_perf_begin()
+ */
+void mbed_perf_end(int slot, const mbed_perf_sample_t *sample);
+
+/** Clear all slots and their accumulated counts. */
+void mbed_perf_reset(void);
+
+#else
+
+#define mbed_perf_slot(name)            ((void)(name), -1)
+#define mbed_perf_event_select(event)   ((void)(event), -1)
+#define mbed_perf_begin(sample)         ((void)(sample))
+#define mbed_perf_end(slot, sample)     ((void)(slot), (void)(sample))
+#define mbed_perf_reset()               ((void)0)
+
+#endif // MBED_PERF_COUNTERS_ENABLED
+
+/**@}*/
+
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
@@ -142,6 +142,47 @@ void sleep_manager_lock_deep_sleep_internal(void);
  */
 void sleep_manager_unlock_deep_sleep_internal(void);
 
+/** Maximum tolerable wake latency registration
+ *
+ * Allocate one of these (statically or as part of a driver's state) and
+ * pass it to sleep_manager_register_latency_budget(). The structure must
+ * stay valid until it is deregistered.
+ */
+typedef struct sleep_manager_latency_budget {
+    uint32_t latency_us;                        /**< Maximum tolerable wake latency in us */
+    struct sleep_manager_latency_budget *next;  /**< Internal list link, do not touch */
+} sleep_manager_latency_budget_t;
+
+/** Register a maximum tolerable wake latency
+ *
+ * sleep_manager_sleep_auto() only selects deep sleep while the target's
+ * documented deep sleep wake latency (the target.deep-sleep-latency
+ * configuration) fits within every registered budget. Unlike the deep
+ * sleep lock this does not rule deep sleep out - a target that wakes
+ * fast enough can still use it.
+ *
+ * Fill in latency_us before registering. This function is IRQ and
+ * thread safe.
+ *
+ * @param budget Budget to register, must stay valid until deregistered
+ */
+void sleep_manager_register_latency_budget(sleep_manager_latency_budget_t *budget);
+
+/** Deregister a wake latency budget registered previously
+ *
+ * This function is IRQ and thread safe.
+ *
+ * @param budget Budget passed to sleep_manager_register_latency_budget()
+ */
+void sleep_manager_deregister_latency_budget(sleep_manager_latency_budget_t *budget);
+
+/** Get the tightest registered wake latency budget
+ *
+ * @return the smallest registered latency in us, or UINT32_MAX if no
+ *         budget is registered
+ */
+uint32_t sleep_manager_get_latency_budget(void);
+
 /** Get the status of deep sleep allowance for a target
  *
  * @return true if a target can go to deepsleep, false otherwise
@@ -0,0 +1,103 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_SIMD_H
+#define MBED_SIMD_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** \addtogroup platform-public-api */
+/** @{*/
+
+/**
+ * \defgroup platform_simd SIMD kernels
+ *
+ * Small data-movement and checksum kernels with vectorised implementations.
+ *
+ * On cores with the M-profile vector extension (Helium, selected by
+ * `__ARM_FEATURE_MVE` at compile time) the kernels process sixteen bytes per
+ * iteration; on every other core they fall back to word-at-a-time scalar
+ * code, so callers never need their own fallback path. All functions have C
+ * linkage so they are usable from the C network and storage stacks as well
+ * as C++ drivers.
+ * @{
+ */
+
+/** One's-complement 16-bit sum of a buffer, as used by the IP checksum.
+ *
+ * The data is treated as a sequence of little-endian 16-bit words starting
+ * at the first byte, with an odd trailing byte added as the low byte of a
+ * final word - the same contract as lwIP's checksum routines for any
+ * alignment of the input. The result is the folded sum, not inverted;
+ * invert it to produce the value placed in an IP header.
+ *
+ * @param data Buffer to sum, any alignment
+ * @param len  Number of bytes to sum
+ * @return Folded 16-bit one's-complement sum
+ */
+uint16_t mbed_simd_sum16(const void *data, size_t len);
+
+/** Exclusive-OR a source block into a destination block.
+ *
+ * Computes dst[i] ^= src[i] for each byte. The regions must not overlap.
+ *
+ * @param dst Destination block, updated in place
+ * @param src Source block
+ * @param len Number of bytes to combine
+ */
+void mbed_simd_xor(void *dst, const void *src, size_t len);
+
+/** Byte-swap an array of 32-bit words.
+ *
+ * Reverses the byte order of each word, converting between big-endian and
+ * little-endian representations. Source and destination may be the same
+ * array but must not partially overlap.
+ *
+ * @param dst   Destination array
+ * @param src   Source array
+ * @param count Number of 32-bit words to swap
+ */
+void mbed_simd_bswap32(uint32_t *dst, const uint32_t *src, size_t count);
+
+/** Compare two memory blocks.
+ *
+ * Same contract as memcmp: returns zero when the blocks are equal, and
+ * otherwise the sign of the difference of the first differing bytes. The
+ * vectorised path only locates the differing block, so the run time still
+ * depends on the position of the first difference - do not use this for
+ * secrets that require constant-time comparison.
+ *
+ * @param a   First block
+ * @param b   Second block
+ * @param len Number of bytes to compare
+ * @return 0 if equal, negative if a < b, positive if a > b
+ */
+int mbed_simd_memcmp(const void *a, const void *b, size_t len);
+
+/**@}*/
+
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -49,6 +49,15 @@ extern "C" {
 #ifndef MBED_THREAD_STATS_ENABLED
 #define MBED_THREAD_STATS_ENABLED   1
 #endif
+#ifndef MBED_CRITICAL_STATS_ENABLED
+#define MBED_CRITICAL_STATS_ENABLED 1
+#endif
+#ifndef MBED_BOOT_STATS_ENABLED
+#define MBED_BOOT_STATS_ENABLED     1
+#endif
+#ifndef MBED_SLEEP_STATS_ENABLED
+#define MBED_SLEEP_STATS_ENABLED    1
+#endif
 
 #endif // MBED_ALL_STATS_ENABLED
 
@@ -75,6 +84,94 @@ typedef struct {
  */
 void mbed_stats_heap_get(mbed_stats_heap_t *stats);
 
+/** Number of free-block size buckets reported by mbed_stats_heap_frag_get() */
+#define MBED_STATS_HEAP_FRAG_BUCKETS     8
+
+/**
+ * struct mbed_stats_heap_frag_t definition
+ */
+typedef struct {
+    uint32_t free_size;             /**< Bytes currently on the allocator's free list */
+    uint32_t largest_free_block;    /**< Size of the largest contiguous free block in bytes */
+    uint32_t free_block_cnt;        /**< Number of blocks on the allocator's free list */
+    uint32_t histogram[MBED_STATS_HEAP_FRAG_BUCKETS];   /**< Free block counts bucketed by size. Bucket 0 counts blocks smaller than 32 bytes, bucket N blocks from (16 << N) to (32 << N) - 1 bytes, and the last bucket also counts all larger blocks */
+} mbed_stats_heap_frag_t;
+
+/**
+ *  Fill the passed in structure with a snapshot of heap fragmentation state,
+ *  computed on demand by walking the allocator's free list. A shrinking
+ *  largest_free_block combined with a growing free_block_cnt while
+ *  mbed_stats_heap_get() still reports heap headroom is the signature of
+ *  fragmentation, and can be used to trigger recovery before allocations
+ *  start failing.
+ *
+ *  The walk takes time proportional to the number of free blocks and holds
+ *  the heap statistics lock for its duration, so this is intended for
+ *  periodic monitoring rather than per-allocation use.
+ *
+ *  Requires MBED_HEAP_STATS_ENABLED together with either the TLSF heap
+ *  backend (MBED_CONF_PLATFORM_HEAP_TLSF) or the GCC_ARM toolchain, whose
+ *  allocator exposes the free list; otherwise the structure is zeroed.
+ *
+ *  @param stats    A pointer to the mbed_stats_heap_frag_t structure to fill
+ */
+void mbed_stats_heap_frag_get(mbed_stats_heap_frag_t *stats);
+
+/** Maximum number of heap tags, including the implicit "untagged" slot 0 */
+#define MBED_STATS_HEAP_MAX_TAGS     8
+
+/**
+ * struct mbed_stats_heap_tag_t definition
+ */
+typedef struct {
+    const char *name;           /**< Name given at registration, "untagged" for slot 0 */
+    uint32_t current_size;      /**< Bytes currently allocated under this tag */
+    uint32_t max_size;          /**< Maximum bytes allocated under this tag at one time since reset */
+    uint32_t alloc_cnt;         /**< Current number of allocations under this tag that have not been freed */
+} mbed_stats_heap_tag_t;
+
+/**
+ *  Register a heap tag for per-module heap accounting.
+ *
+ *  Subsystems register a tag once at startup and bracket their allocation
+ *  phases with mbed_stats_heap_tag_set(). The name is not copied and must
+ *  stay valid for the lifetime of the program, so use a string literal.
+ *
+ *  Requires MBED_HEAP_TAG_STATS_ENABLED (which in turn requires
+ *  MBED_HEAP_STATS_ENABLED).
+ *
+ *  @param name     Name reported back by mbed_stats_heap_tag_get
+ *  @return         The new tag, or negative if the tag table is full or
+ *                  tag statistics are disabled
+ */
+int8_t mbed_stats_heap_tag_register(const char *name);
+
+/**
+ *  Set the tag that subsequent heap allocations are accounted to.
+ *
+ *  The tag is recorded per allocation, so a block is always credited back to
+ *  the tag it was allocated under no matter who frees it. The current tag is
+ *  process wide: an allocation made on another thread while a tag window is
+ *  open is attributed to that tag, so keep windows short - typically around
+ *  a subsystem init or processing call.
+ *
+ *  @param tag      Tag from mbed_stats_heap_tag_register, or 0 for untagged.
+ *                  Out-of-range values leave the current tag unchanged
+ *  @return         The previous tag, so callers can restore it
+ */
+int8_t mbed_stats_heap_tag_set(int8_t tag);
+
+/**
+ *  Fill the passed array of structures with the per-tag heap statistics.
+ *
+ *  @param stats    A pointer to an array of mbed_stats_heap_tag_t structures to fill
+ *  @param count    The number of mbed_stats_heap_tag_t structures in the provided array
+ *  @return         The number of registered tags that have been filled,
+ *                  including the untagged slot, or 0 if tag statistics are
+ *                  disabled
+ */
+size_t mbed_stats_heap_tag_get(mbed_stats_heap_tag_t *stats, size_t count);
+
 /**
  * struct mbed_stats_stack_t definition
  */
@@ -144,6 +241,299 @@ typedef struct {
  */
 size_t mbed_stats_thread_get_each(mbed_stats_thread_t *stats, size_t count);
 
+/**
+ * struct mbed_stats_thread_cpu_t definition
+ */
+typedef struct {
+    uint32_t id;                /**< ID of the thread */
+    uint64_t cycles;            /**< Cumulative CPU cycles consumed by the thread */
+    uint32_t switch_cnt;        /**< Number of times the thread has been switched in */
+    uint32_t max_slice_cycles;  /**< Longest uninterrupted run of the thread, in CPU cycles */
+} mbed_stats_thread_cpu_t;
+
+/**
+ *  Fill the passed array of stat structures with the per-thread CPU accounting
+ *  gathered at context switch.
+ *
+ *  Only available when MBED_THREAD_CPU_STATS_ENABLED is defined, on cores with
+ *  a DWT cycle counter and the RTX kernel; otherwise no entries are returned.
+ *  The accounting itself is a cycle-counter read per context switch, cheap
+ *  enough to stay enabled in production builds.
+ *
+ *  @param stats    A pointer to an array of mbed_stats_thread_cpu_t structures to fill
+ *  @param count    The number of mbed_stats_thread_cpu_t structures in the provided array
+ *  @return         The number of mbed_stats_thread_cpu_t structures that have been filled.
+ */
+size_t mbed_stats_thread_cpu_get_each(mbed_stats_thread_cpu_t *stats, size_t count);
+
+/**
+ * struct mbed_stats_scheduler_t definition
+ */
+typedef struct {
+    uint32_t sample_cnt;        /**< Number of wakeup-to-switch intervals measured */
+    uint64_t total_cycles;      /**< Cumulative CPU cycles from thread wakeup to context switch */
+    uint32_t max_cycles;        /**< Worst-case CPU cycles from thread wakeup to context switch */
+} mbed_stats_scheduler_t;
+
+/**
+ *  Fill the passed in structure with scheduler latency statistics.
+ *
+ *  Latency is measured from the moment a blocked thread is made ready
+ *  (typically by an interrupt) to the context switch that resumes a thread,
+ *  so it captures the kernel's dispatch overhead including any interrupt
+ *  tail-chaining in between.
+ *
+ *  Only available when MBED_SCHEDULER_STATS_ENABLED is defined, on cores with
+ *  a DWT cycle counter and the RTX kernel; otherwise all fields are zero.
+ *  The measurement is a cycle-counter read per thread wakeup and context
+ *  switch, cheap enough to stay enabled in production builds.
+ *
+ *  @param stats    A pointer to the mbed_stats_scheduler_t structure to fill
+ */
+void mbed_stats_scheduler_get(mbed_stats_scheduler_t *stats);
+
+/** Number of call sites tracked by the critical-section statistics. Only the
+ *  call sites with the longest masked windows observed since reset are kept.
+ */
+#ifndef MBED_CRITICAL_STATS_ENTRIES
+#define MBED_CRITICAL_STATS_ENTRIES 8
+#endif
+
+/**
+ * struct mbed_stats_critical_t definition
+ */
+typedef struct {
+    uint32_t caller;            /**< Address of the code that entered the outermost critical section */
+    uint32_t cycles;            /**< Longest run of CPU cycles that call site kept interrupts masked */
+} mbed_stats_critical_t;
+
+/**
+ *  Fill the passed array of stat structures with the longest critical-section
+ *  windows recorded since reset, longest first, one entry per call site.
+ *
+ *  A window is measured from the outermost core_util_critical_section_enter()
+ *  to the matching exit, so it covers the whole time interrupts stayed masked
+ *  including any nested sections in between. The caller address identifies the
+ *  code that opened the window.
+ *
+ *  Only available when MBED_CRITICAL_STATS_ENABLED is defined, on cores with
+ *  a DWT cycle counter; otherwise no entries are returned. The measurement is
+ *  a cycle-counter read per outermost enter and exit, cheap enough to stay
+ *  enabled in production builds.
+ *
+ *  @param stats    A pointer to an array of mbed_stats_critical_t structures to fill
+ *  @param count    The number of mbed_stats_critical_t structures in the provided array
+ *  @return         The number of mbed_stats_critical_t structures that have been filled.
+ */
+size_t mbed_stats_critical_get_each(mbed_stats_critical_t *stats, size_t count);
+
+/** Number of atomic objects tracked by the atomic contention statistics.
+ *  Objects first touched after all entries are taken are not counted.
+ */
+#ifndef MBED_ATOMIC_STATS_ENTRIES
+#define MBED_ATOMIC_STATS_ENTRIES 8
+#endif
+
+/**
+ * struct mbed_stats_atomic_t definition
+ */
+typedef struct {
+    uint32_t object;        /**< Address of the atomic variable */
+    uint32_t retries;       /**< Exclusive-access retries (STREX failures) on the object */
+    uint32_t cas_failures;  /**< Failed compare-and-swap attempts on the object */
+    uint32_t locked_ops;    /**< Operations on the object that fell back to a critical section */
+} mbed_stats_atomic_t;
+
+/**
+ *  Fill the passed array of stat structures with the atomic contention
+ *  counters accumulated since reset, one entry per atomic object.
+ *
+ *  An exclusive-access retry means a load-exclusive/store-exclusive sequence
+ *  had to run again because another context touched the object in between; a
+ *  CAS failure means a compare-and-swap returned false; a locked operation
+ *  means the operation was implemented by masking interrupts, which is every
+ *  read-modify-write on cores without LDREX and every 64-bit operation
+ *  elsewhere. Hot entries point at the atomics worth redesigning; the object
+ *  address is resolved to a symbol with the map file.
+ *
+ *  Only available when MBED_ATOMIC_STATS_ENABLED is defined; otherwise no
+ *  entries are returned. The instrumentation adds a branch per retry loop
+ *  iteration and a call per contended or locked operation, so it is a
+ *  measurement mode rather than something to leave on in production.
+ *
+ *  @param stats    A pointer to an array of mbed_stats_atomic_t structures to fill
+ *  @param count    The number of mbed_stats_atomic_t structures in the provided array
+ *  @return         The number of mbed_stats_atomic_t structures that have been filled.
+ */
+size_t mbed_stats_atomic_get_each(mbed_stats_atomic_t *stats, size_t count);
+
+/** Number of distinct wake sources tracked by the sleep statistics; wakes
+ *  from IRQs beyond this many distinct sources are not attributed.
+ */
+#ifndef MBED_SLEEP_STATS_WAKE_SOURCES
+#define MBED_SLEEP_STATS_WAKE_SOURCES 8
+#endif
+
+/** Wake source value reported when no pending interrupt could be identified
+ *  at wakeup.
+ */
+#define MBED_SLEEP_STATS_WAKE_UNKNOWN INT16_MIN
+
+/**
+ * struct mbed_stats_sleep_mode_t definition
+ */
+typedef struct {
+    uint32_t entry_cnt;             /**< Number of times this sleep state was entered */
+    us_timestamp_t time;            /**< Cumulative time spent in this sleep state */
+    uint32_t wake_latency_cnt;      /**< Number of wakes with a measurable latency */
+    us_timestamp_t wake_latency;    /**< Cumulative scheduled-wake to first-instruction latency */
+    uint32_t wake_latency_max;      /**< Longest scheduled-wake to first-instruction latency, in us */
+} mbed_stats_sleep_mode_t;
+
+/**
+ * struct mbed_stats_sleep_t definition
+ */
+typedef struct {
+    mbed_stats_sleep_mode_t sleep;          /**< Shallow sleep (hal_sleep) */
+    mbed_stats_sleep_mode_t deep_sleep;     /**< Deep sleep (hal_deepsleep) */
+    int16_t last_wake_irqn;                 /**< IRQ that ended the most recent sleep, CMSIS numbering,
+                                                 or MBED_SLEEP_STATS_WAKE_UNKNOWN */
+} mbed_stats_sleep_t;
+
+/**
+ *  Fill the passed in structure with sleep statistics.
+ *
+ *  Entry counts and durations give the actual duty cycle per sleep state for
+ *  battery modelling. Wake latency is the time from the low-power ticker
+ *  match that was scheduled to end the sleep until the first instruction
+ *  after the core resumes, so it covers the hardware wake-up sequence plus
+ *  clock restore; it is only recorded for sleeps ended by that match, as
+ *  other wake sources give no reference point to measure from.
+ *
+ *  Only available when MBED_SLEEP_STATS_ENABLED is defined, on targets with
+ *  sleep and a low-power ticker; otherwise all fields are zero. The
+ *  accounting is two ticker reads per sleep, cheap enough to stay enabled in
+ *  production builds.
+ *
+ *  @param stats    A pointer to the mbed_stats_sleep_t structure to fill
+ */
+void mbed_stats_sleep_get(mbed_stats_sleep_t *stats);
+
+/**
+ * struct mbed_stats_wake_source_t definition
+ */
+typedef struct {
+    int16_t irqn;               /**< IRQ number, CMSIS numbering (core exceptions are negative) */
+    uint32_t count;             /**< Number of sleeps this IRQ ended */
+} mbed_stats_wake_source_t;
+
+/**
+ *  Fill the passed array of stat structures with wake-source attribution,
+ *  one entry per IRQ that has ended a sleep.
+ *
+ *  The wake source is the highest-priority interrupt pending when the core
+ *  resumes; when several interrupts pend during the same sleep only that one
+ *  is counted. At most MBED_SLEEP_STATS_WAKE_SOURCES distinct IRQs are
+ *  tracked.
+ *
+ *  Only available when MBED_SLEEP_STATS_ENABLED is defined, on targets with
+ *  sleep and a low-power ticker; otherwise no entries are returned.
+ *
+ *  @param stats    A pointer to an array of mbed_stats_wake_source_t structures to fill
+ *  @param count    The number of mbed_stats_wake_source_t structures in the provided array
+ *  @return         The number of mbed_stats_wake_source_t structures that have been filled.
+ */
+size_t mbed_stats_sleep_wake_get_each(mbed_stats_wake_source_t *stats, size_t count);
+
+/** Maximum number of boot stages recorded by the boot statistics; further
+ *  stages are dropped.
+ */
+#ifndef MBED_BOOT_STATS_ENTRIES
+#define MBED_BOOT_STATS_ENTRIES 16
+#endif
+
+/**
+ * struct mbed_stats_boot_stage_t definition
+ */
+typedef struct {
+    const char *name;           /**< Name of the stage, as passed to mbed_stats_boot_stage() */
+    uint32_t cycles;            /**< CPU cycle count at which the stage completed */
+} mbed_stats_boot_stage_t;
+
+/**
+ * struct mbed_stats_boot_t definition
+ */
+typedef struct {
+    uint32_t stage_cnt;                                         /**< Number of stages recorded */
+    mbed_stats_boot_stage_t stages[MBED_BOOT_STATS_ENTRIES];    /**< Stages in completion order */
+} mbed_stats_boot_t;
+
+/**
+ *  Fill the passed in structure with the boot stage timestamps recorded
+ *  between reset and main().
+ *
+ *  The boot code records a stage when RAM initialization, SDK init, the
+ *  kernel bring-up and the C++ constructor chain complete; targets and
+ *  applications can add their own stages with mbed_stats_boot_stage().
+ *  Timestamps count CPU cycles from the point the DWT cycle counter started:
+ *  from reset if the target enables it in SystemInit, otherwise from the
+ *  first recorded stage.
+ *
+ *  Only available when MBED_BOOT_STATS_ENABLED is defined, on cores with a
+ *  DWT cycle counter; otherwise no stages are returned.
+ *
+ *  @param stats    A pointer to the mbed_stats_boot_t structure to fill
+ */
+void mbed_stats_boot_get(mbed_stats_boot_t *stats);
+
+/**
+ *  Record the completion of a boot stage.
+ *
+ *  Called by the boot code for the built-in stages; targets can call it from
+ *  mbed_sdk_init() and applications from mbed_main() or later to time their
+ *  own initialization. The name is stored by pointer, so it must remain
+ *  valid - pass a string literal.
+ *
+ *  @param name    Name of the stage that just completed
+ */
+#if defined(MBED_BOOT_STATS_ENABLED) || defined(DOXYGEN_ONLY)
+void mbed_stats_boot_stage(const char *name);
+#else
+#define mbed_stats_boot_stage(name) ((void)(name))
+#endif
+
+/** Maximum number of named performance counter slots */
+#ifndef MBED_PERF_STATS_SLOTS
+#define MBED_PERF_STATS_SLOTS 8
+#endif
+
+/**
+ * struct mbed_stats_perf_t definition
+ */
+typedef struct {
+    const char *name;   /**< Name of the slot, NULL if the slot is unused */
+    uint32_t hits;      /**< Completed begin/end pairs accumulated into the slot */
+    uint64_t cycles;    /**< CPU cycles spent inside the scope */
+    uint64_t events;    /**< Occurrences of the selected auxiliary event inside the scope */
+} mbed_stats_perf_t;
+
+/**
+ *  Fill the passed array of structures with the accumulated performance
+ *  counter slots, and return the number of slots in use.
+ *
+ *  Slots are created and accumulated through the API in
+ *  mbed_perf_counters.h, most conveniently with the mbed::PerfScope RAII
+ *  object. Only available when MBED_PERF_COUNTERS_ENABLED is defined, on
+ *  cores with a DWT cycle counter; otherwise no slots are returned.
+ *
+ *  @param stats    A pointer to an array of mbed_stats_perf_t structures to fill
+ *  @param count    The number of mbed_stats_perf_t structures in the provided array
+ *  @return         The number of mbed_stats_perf_t structures that have been filled.
+ *                  If the number of slots in use is less than the provided count,
+ *                  the returned value is the number of slots in use.
+ */
+size_t mbed_stats_perf_get_each(mbed_stats_perf_t *stats, size_t count);
+
 /**
  * enum mbed_compiler_id_t definition
  */
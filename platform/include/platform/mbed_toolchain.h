@@ -276,6 +276,28 @@
 #endif
 #endif
 
+/** MBED_HOT_CODE
+ *  Place a function in the .text.mbed_hot section, which the code
+ *  placement profile (tools/cmake/mbed_code_placement.cmake) collects
+ *  into fast flash or ITCM ahead of any listed symbols. Without a
+ *  placement profile the section links like ordinary code.
+ *
+ *  @code
+ *  #include "mbed_toolchain.h"
+ *
+ *  MBED_HOT_CODE void checksum_inner_loop() {
+ *
+ *  }
+ *  @endcode
+ */
+#ifndef MBED_HOT_CODE
+#if defined(__GNUC__) || defined(__clang__) || defined(__ICCARM__)
+#define MBED_HOT_CODE __attribute__((section(".text.mbed_hot")))
+#else
+#define MBED_HOT_CODE
+#endif
+#endif
+
 /** MBED_FORCEINLINE
  *  Declare a function that must always be inlined. Failure to inline
  *  such a function will result in an error.
@@ -455,6 +477,44 @@
 #endif
 #endif
 
+/** MBED_FAST_CODE
+ *  Place a function in RAM so it executes without XIP or flash wait states.
+ *
+ *  Intended for hot functions identified by measurement (see
+ *  mbed_xip_stats.h): when code runs in place from QSPI or slow flash, an
+ *  instruction fetch miss costs tens of cycles, and copying the few
+ *  functions that dominate that cost into RAM removes it deterministically.
+ *
+ *  For GCC and ARM Compiler 6 the function is emitted into a ".data"
+ *  subsection, so the standard startup copy of the data region places it in
+ *  RAM without linker script changes; long calls are forced so callers in
+ *  flash reach it at any distance, and inlining is suppressed so the body
+ *  is not duplicated back into flash at call sites. IAR uses its native
+ *  __ramfunc support.
+ *
+ *  @code
+ *  #include "mbed_toolchain.h"
+ *
+ *  MBED_FAST_CODE void encoder_edge_handler(void)
+ *  {
+ *      // runs from RAM
+ *  }
+ *  @endcode
+ */
+#ifndef MBED_FAST_CODE
+#if (defined(__GNUC__) || defined(__clang__))
+#if defined(__arm__)
+#define MBED_FAST_CODE __attribute__((noinline, long_call, section(".data.fast_code")))
+#else
+#define MBED_FAST_CODE __attribute__((noinline, section(".data.fast_code")))
+#endif
+#elif defined(__ICCARM__)
+#define MBED_FAST_CODE __ramfunc
+#else
+#define MBED_FAST_CODE
+#endif
+#endif
+
 /**
  * Macro expanding to a string literal of the enclosing function name.
  *
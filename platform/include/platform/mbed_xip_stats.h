@@ -0,0 +1,87 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_XIP_STATS_H
+#define MBED_XIP_STATS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** \addtogroup platform-public-api */
+/** @{*/
+
+/**
+ * \defgroup platform_xip_stats XIP stall profiling functions
+ *
+ * Measures where a code region's cycles go using the DWT profiling
+ * counters, to decide which functions deserve MBED_FAST_CODE placement in
+ * RAM when executing in place from QSPI or slow flash. A region whose
+ * cpi_stalls dominate its cycles is paying for instruction fetches; move
+ * it to RAM with MBED_FAST_CODE, measure again, and keep the change if the
+ * numbers say so - placement by measurement rather than guesswork.
+ *
+ * The stall counters (everything except cycles) are 8 bits wide in the
+ * DWT, so profile a single invocation of a candidate function at a time;
+ * a stall count of 255 means the counter saturated and the region is
+ * longer than one sample can resolve. The cycle counter is 32 bits.
+ *
+ * Only one region can be measured at a time, and measuring from inside an
+ * interrupt handler that preempts another measurement corrupts both.
+ * @{
+ */
+
+/** Breakdown of where a measured region's CPU cycles went */
+typedef struct {
+    uint32_t cycles;       /**< Elapsed CPU cycles over the region */
+    uint32_t cpi_stalls;   /**< Extra cycles from instruction fetch stalls and
+                                multi-cycle instructions - the XIP miss signal */
+    uint32_t lsu_stalls;   /**< Extra cycles spent waiting on loads and stores */
+    uint32_t exc_cycles;   /**< Cycles spent on exception entry and exit */
+    uint32_t sleep_cycles; /**< Cycles spent asleep */
+    uint32_t folded;       /**< Instructions that took zero cycles */
+} mbed_xip_stats_t;
+
+/** Check whether the DWT profiling counters exist on this core
+ *
+ * @return true if start/stop will produce measurements, false if they
+ *         will report all zeros
+ */
+bool mbed_xip_stats_supported(void);
+
+/** Start measuring: zero and enable the DWT profiling counters
+ */
+void mbed_xip_stats_start(void);
+
+/** Stop measuring and report the counters since the matching start
+ *
+ * @param stats Filled with the measured breakdown; all zeros when the
+ *              core has no DWT profiling counters
+ */
+void mbed_xip_stats_stop(mbed_xip_stats_t *stats);
+
+/**@}*/
+
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -114,34 +114,58 @@ extern "C" {
 /** special level for cmdline. Behaviours like "plain mode" */
 #define TRACE_LEVEL_CMD           0x01
 
+/** Highest trace level compiled in. Calls above this level are removed
+ *  entirely, including the evaluation of their arguments. The limit is
+ *  applied per translation unit, so a single module can be built more (or
+ *  less) verbose than the rest of the image by defining MBED_TRACE_MAX_LEVEL
+ *  before including this header. */
 #ifndef MBED_TRACE_MAX_LEVEL
 #define MBED_TRACE_MAX_LEVEL TRACE_LEVEL_INFO
 #endif
 
+/** When set, every compiled-in trace call first checks the runtime per-group
+ *  level mask (see mbed_trace_group_level_set) at the call site, before any
+ *  arguments are marshalled. Costs one table lookup per emitted trace. */
+#ifndef MBED_CONF_MBED_TRACE_GROUP_MASKS
+#define MBED_CONF_MBED_TRACE_GROUP_MASKS 0
+#endif
+
+/** Size of the per-group level mask table */
+#ifndef MBED_TRACE_GROUP_MASK_ENTRIES
+#define MBED_TRACE_GROUP_MASK_ENTRIES 8
+#endif
+
+#if MBED_CONF_MBED_TRACE_GROUP_MASKS
+#define MBED_TRACE_IF_ENABLED(dlevel, grp, ...) \
+    (mbed_trace_group_enabled(dlevel, grp) ? mbed_tracef(dlevel, grp, __VA_ARGS__) : (void) 0)
+#else
+#define MBED_TRACE_IF_ENABLED(dlevel, grp, ...) mbed_tracef(dlevel, grp, __VA_ARGS__)
+#endif
+
 //usage macros:
 #if MBED_TRACE_MAX_LEVEL >= TRACE_LEVEL_DEBUG
-#define tr_debug(...)           mbed_tracef(TRACE_LEVEL_DEBUG,   TRACE_GROUP, __VA_ARGS__)   //!< Print debug message
+#define tr_debug(...)           MBED_TRACE_IF_ENABLED(TRACE_LEVEL_DEBUG,   TRACE_GROUP, __VA_ARGS__)   //!< Print debug message
 #else
 #define tr_debug(...)
 #endif
 
 #if MBED_TRACE_MAX_LEVEL >= TRACE_LEVEL_INFO
-#define tr_info(...)            mbed_tracef(TRACE_LEVEL_INFO,    TRACE_GROUP, __VA_ARGS__)   //!< Print info message
+#define tr_info(...)            MBED_TRACE_IF_ENABLED(TRACE_LEVEL_INFO,    TRACE_GROUP, __VA_ARGS__)   //!< Print info message
 #else
 #define tr_info(...)
 #endif
 
 #if MBED_TRACE_MAX_LEVEL >= TRACE_LEVEL_WARN
-#define tr_warning(...)         mbed_tracef(TRACE_LEVEL_WARN,    TRACE_GROUP, __VA_ARGS__)   //!< Print warning message
-#define tr_warn(...)            mbed_tracef(TRACE_LEVEL_WARN,    TRACE_GROUP, __VA_ARGS__)   //!< Alternative warning message
+#define tr_warning(...)         MBED_TRACE_IF_ENABLED(TRACE_LEVEL_WARN,    TRACE_GROUP, __VA_ARGS__)   //!< Print warning message
+#define tr_warn(...)            MBED_TRACE_IF_ENABLED(TRACE_LEVEL_WARN,    TRACE_GROUP, __VA_ARGS__)   //!< Alternative warning message
 #else
 #define tr_warning(...)
 #define tr_warn(...)
 #endif
 
 #if MBED_TRACE_MAX_LEVEL >= TRACE_LEVEL_ERROR
-#define tr_error(...)           mbed_tracef(TRACE_LEVEL_ERROR,   TRACE_GROUP, __VA_ARGS__)   //!< Print Error Message
-#define tr_err(...)             mbed_tracef(TRACE_LEVEL_ERROR,   TRACE_GROUP, __VA_ARGS__)   //!< Alternative error message
+#define tr_error(...)           MBED_TRACE_IF_ENABLED(TRACE_LEVEL_ERROR,   TRACE_GROUP, __VA_ARGS__)   //!< Print Error Message
+#define tr_err(...)             MBED_TRACE_IF_ENABLED(TRACE_LEVEL_ERROR,   TRACE_GROUP, __VA_ARGS__)   //!< Alternative error message
 #else
 #define tr_error(...)
 #define tr_err(...)
@@ -282,6 +306,43 @@ void mbed_trace_include_filters_set(char *filters);
 /** get trace include filters
  */
 const char *mbed_trace_include_filters_get(void);
+/**
+ * Set the runtime trace levels for one group.
+ * Only used when MBED_CONF_MBED_TRACE_GROUP_MASKS is set; the mask is then
+ * checked by the tr_xxx macros at the call site, so traces from masked
+ * groups cost one table lookup and nothing else - no argument marshalling,
+ * no mutex. Unlike the include/exclude string filters, which run inside
+ * mbed_vtracef after formatting has begun, this makes selective enabling
+ * cheap enough for release builds.
+ * e.g. silence everything except one group under investigation:
+ *   mbed_trace_group_level_default_set(TRACE_ACTIVE_LEVEL_ERROR);
+ *   mbed_trace_group_level_set("wifi", TRACE_ACTIVE_LEVEL_ALL);
+ * @param grp            trace group, first 8 characters are significant
+ * @param active_levels  TRACE_ACTIVE_LEVEL_* bitmask for this group
+ */
+void mbed_trace_group_level_set(const char *grp, uint8_t active_levels);
+/** get the runtime trace levels for one group
+ * @param grp trace group
+ * @return the group's TRACE_ACTIVE_LEVEL_* bitmask, or the default mask if
+ *         the group has not been configured
+ */
+uint8_t mbed_trace_group_level_get(const char *grp);
+/**
+ * Set the runtime trace levels applied to groups without an entry of their
+ * own. Defaults to TRACE_ACTIVE_LEVEL_ALL, which leaves filtering to the
+ * normal configuration in mbed_trace_config_set().
+ * @param active_levels  TRACE_ACTIVE_LEVEL_* bitmask
+ */
+void mbed_trace_group_level_default_set(uint8_t active_levels);
+/**
+ * Check whether a trace at the given level would be emitted for a group.
+ * Used by the tr_xxx macros; can also be used to guard expensive trace
+ * preparation in application code.
+ * @param dlevel debug level
+ * @param grp    trace group
+ * @return nonzero when the trace would be emitted
+ */
+int mbed_trace_group_enabled(uint8_t dlevel, const char *grp);
 /**
  * General trace function
  * This should be used every time when user want to print out something important thing
@@ -394,6 +455,10 @@ char *mbed_trace_array(const uint8_t *buf, uint16_t len);
 #undef mbed_trace_exclude_filters_get
 #undef mbed_trace_include_filters_set
 #undef mbed_trace_include_filters_get
+#undef mbed_trace_group_level_set
+#undef mbed_trace_group_level_get
+#undef mbed_trace_group_level_default_set
+#undef mbed_trace_group_enabled
 #undef mbed_tracef
 #undef mbed_vtracef
 #undef mbed_trace_last
@@ -419,6 +484,10 @@ char *mbed_trace_array(const uint8_t *buf, uint16_t len);
 #define mbed_trace_exclude_filters_get(...)         ((const char *) 0)
 #define mbed_trace_include_filters_set(...)         ((void) 0)
 #define mbed_trace_include_filters_get(...)         ((const char *) 0)
+#define mbed_trace_group_level_set(...)             ((void) 0)
+#define mbed_trace_group_level_get(...)             ((uint8_t) 0)
+#define mbed_trace_group_level_default_set(...)     ((void) 0)
+#define mbed_trace_group_enabled(...)               ((int) 0)
 #define mbed_trace_last(...)                        ((const char *) 0)
 #define mbed_tracef(...)                            ((void) 0)
 #define mbed_vtracef(...)                           ((void) 0)
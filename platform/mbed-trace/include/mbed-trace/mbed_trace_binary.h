@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026 ARM Limited. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * \file mbed_trace_binary.h
+ * Deferred-formatting binary trace points.
+ *
+ * The regular mbed_tracef() formats every message with vsnprintf at the call
+ * site, inside the trace mutex. That costs tens of microseconds per trace and
+ * perturbs the timing of the code being traced. The binary trace points below
+ * instead record only the format string pointer, a cycle timestamp and the
+ * raw 32-bit arguments - formatting is deferred to the host, which reads the
+ * format strings out of the ELF image.
+ *
+ * A trace point costs a handful of word writes, so it can be left in
+ * production firmware. Records go to a lock-free RAM ring by default, which a
+ * debugger can dump at any time (symbols mbed_trace_binary_ring and
+ * mbed_trace_binary_ring_seq), or they can be streamed live through an output
+ * backend - a built-in ITM backend is provided, and third-party transports
+ * such as SEGGER RTT can be plugged in with one function. Decode captures
+ * with platform/mbed-trace/mbed_trace_binary_decoder.py.
+ *
+ * usage example:
+ * \code(main.c:)
+ *      #include "mbed_trace_binary.h"
+ *
+ *      void irq_handler(void) {
+ *          tr_bin("dma complete ch=%d residue=%u", channel, residue);
+ *      }
+ * \endcode
+ * Activate with the macro MBED_CONF_MBED_TRACE_BINARY_ENABLE; when it is not
+ * set the tr_bin() macro compiles to nothing.
+ *
+ * Arguments are recorded as 32-bit words: integers, pointers and %s strings
+ * that live in the image are supported; 64-bit and floating-point arguments
+ * are not.
+ */
+#ifndef MBED_TRACE_BINARY_H_
+#define MBED_TRACE_BINARY_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifndef MBED_CONF_MBED_TRACE_BINARY_ENABLE
+#define MBED_CONF_MBED_TRACE_BINARY_ENABLE 0
+#endif
+
+/** Number of records kept in the RAM ring. Must be a power of two. */
+#ifndef MBED_TRACE_BINARY_BUFFER_RECORDS
+#define MBED_TRACE_BINARY_BUFFER_RECORDS 64
+#endif
+
+/** Maximum number of arguments recorded per trace point; extra arguments are
+ *  dropped. The host decoder must be told if this is changed. */
+#define MBED_TRACE_BINARY_MAX_ARGS 4
+
+/** One binary trace record, as stored in the RAM ring */
+typedef struct mbed_trace_binary_record {
+    uint32_t seq;                                   /**< 1-based sequence number, 0 while empty */
+    uint32_t fmt;                                   /**< Address of the format string in the image */
+    uint32_t timestamp;                             /**< DWT cycle counter at the trace point, 0 without DWT */
+    uint32_t args[MBED_TRACE_BINARY_MAX_ARGS];      /**< Raw arguments, only as many as the format consumes */
+} mbed_trace_binary_record_t;
+
+#if MBED_CONF_MBED_TRACE_BINARY_ENABLE
+
+/** Record a binary trace point.
+ *
+ * Expands to one call of mbed_trace_binary_emit() with the argument count
+ * computed at compile time. Safe from threads and interrupt handlers.
+ */
+#define tr_bin(...) mbed_trace_binary_emit(MBED_TRACE_BINARY_NARG_(__VA_ARGS__, 9, 8, 7, 6, 5, 4, 3, 2, 1) - 1, __VA_ARGS__)
+#define MBED_TRACE_BINARY_NARG_(_1, _2, _3, _4, _5, _6, _7, _8, _9, N, ...) N
+
+#else
+
+#define tr_bin(...) ((void) 0)
+
+#endif /* MBED_CONF_MBED_TRACE_BINARY_ENABLE */
+
+/**
+ * Record one binary trace point.
+ *
+ * Use the tr_bin() macro rather than calling this directly - the macro counts
+ * the arguments and disappears entirely when binary tracing is disabled.
+ *
+ * Each variable argument is read as one 32-bit word. When an output backend
+ * is set the record is streamed through it from the calling context;
+ * otherwise it is written into the RAM ring, overwriting the oldest record
+ * once the ring is full.
+ *
+ * @param nargs number of variable arguments following fmt
+ * @param fmt   printf-style format string; must live in the image so the
+ *              host can read it, which is the case for string literals
+ * @param ...   arguments, each recorded as a 32-bit word
+ */
+void mbed_trace_binary_emit(unsigned nargs, const char *fmt, ...);
+
+/**
+ * Set the output backend for binary trace records.
+ *
+ * When a backend is set, each trace point passes its record to the backend as
+ * a sequence of 32-bit words - format string address, timestamp, then the
+ * arguments - instead of writing it to the RAM ring. The backend is called
+ * from the traced context, including interrupt handlers, so it must not
+ * block or take locks; writing to a hardware FIFO or an RTT up-buffer is the
+ * intended use. For SEGGER RTT, pass a small wrapper around
+ * SEGGER_RTT_Write().
+ *
+ * @param out backend function, or NULL to return to the RAM ring
+ */
+void mbed_trace_binary_output_set(void (*out)(const uint32_t *data, size_t words));
+
+#if DEVICE_ITM
+/**
+ * Built-in ITM output backend.
+ *
+ * Streams records over the ITM stimulus port as 32-bit writes, for capture
+ * through SWO. Pass this to mbed_trace_binary_output_set(); the ITM is
+ * initialized on first use.
+ */
+void mbed_trace_binary_itm_output(const uint32_t *data, size_t words);
+#endif
+
+/**
+ * Read records from the RAM ring.
+ *
+ * Copies records in order of capture, oldest first, resuming where the
+ * previous call stopped. Records overwritten before they could be read are
+ * skipped. Intended for forwarding the ring over a slow channel from a
+ * background thread; only one reader is supported.
+ *
+ * @param records buffer to fill
+ * @param count   capacity of the buffer in records
+ * @return number of records copied
+ */
+size_t mbed_trace_binary_read(mbed_trace_binary_record_t *records, size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MBED_TRACE_BINARY_H_ */
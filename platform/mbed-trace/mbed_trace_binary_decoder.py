@@ -0,0 +1,152 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026 ARM Limited. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+"""Decode binary trace captures produced by mbed_trace_binary.
+
+The firmware records only format string addresses, cycle timestamps and raw
+32-bit arguments; this script reads the format strings back out of the ELF
+image and formats the messages on the host. No third-party packages are
+required - the little-endian 32-bit ELF segments are parsed directly.
+
+Two capture formats are supported:
+
+  stream (default)  The word stream emitted through an output backend such as
+                    ITM or RTT: format address, timestamp, then as many
+                    argument words as the format string consumes.
+
+  --ring            A raw dump of the mbed_trace_binary_ring array, e.g. from
+                    a debugger. Records are fixed size and carry a sequence
+                    number; they are printed in order of capture.
+
+Usage:
+  mbed_trace_binary_decoder.py image.elf capture.bin [--ring] [--max-args N]
+
+64-bit and floating-point conversions are not supported by the firmware side
+and are rejected here as well.
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+PT_LOAD = 1
+
+# One C conversion specifier: flags, width, precision, length modifier,
+# conversion character. %% is filtered out before this is applied.
+CONVERSION_RE = re.compile(r'%[-+ #0]*\d*(?:\.\d*)?(hh|h|ll|l|j|z|t)?([diouxXcsp])')
+
+
+class Image(object):
+    """Loadable segments of a little-endian ELF32 image."""
+
+    def __init__(self, path):
+        with open(path, 'rb') as f:
+            data = f.read()
+        if data[:4] != b'\x7fELF' or data[4] != 1 or data[5] != 1:
+            raise SystemExit('%s: not a little-endian ELF32 image' % path)
+        e_phoff, = struct.unpack_from('<I', data, 28)
+        e_phentsize, e_phnum = struct.unpack_from('<HH', data, 42)
+        self.segments = []
+        for i in range(e_phnum):
+            p_type, p_offset, p_vaddr, p_paddr, p_filesz = \
+                struct.unpack_from('<IIIII', data, e_phoff + i * e_phentsize)
+            if p_type == PT_LOAD and p_filesz > 0:
+                self.segments.append((p_vaddr, data[p_offset:p_offset + p_filesz]))
+
+    def string_at(self, address):
+        """Return the NUL-terminated string at a target address, or None."""
+        for vaddr, contents in self.segments:
+            if vaddr <= address < vaddr + len(contents):
+                end = contents.find(b'\0', address - vaddr)
+                if end < 0:
+                    return None
+                return contents[address - vaddr:end].decode('ascii', 'replace')
+        return None
+
+
+def conversions(fmt):
+    """Return the conversion characters consumed by a format string."""
+    return [m.group(2) for m in CONVERSION_RE.finditer(fmt.replace('%%', ''))]
+
+
+def render(image, fmt, args):
+    """Format one record, resolving %s arguments through the image."""
+    values = []
+    for conv, arg in zip(conversions(fmt), args):
+        if conv == 's':
+            values.append(image.string_at(arg) or '<str@%#x>' % arg)
+        elif conv in 'dic':
+            # Sign-extend: the capture stores every argument as a raw word
+            values.append(arg - (1 << 32) if arg & (1 << 31) else arg)
+        else:
+            values.append(arg)
+    # Python's % accepts the C flags/width but not length modifiers or %p
+    def pythonify(match):
+        spec = match.group(0)
+        if match.group(1):
+            spec = spec.replace(match.group(1), '', 1)
+        return spec.replace('%p', '%#x')
+
+    text = CONVERSION_RE.sub(pythonify, fmt)
+    try:
+        return text % tuple(values)
+    except (TypeError, ValueError):
+        return '%s %r' % (fmt, args)
+
+
+def decode_stream(image, data, max_args):
+    words = struct.unpack('<%dI' % (len(data) // 4), data[:len(data) - len(data) % 4])
+    i = 0
+    while i + 2 <= len(words):
+        fmt_addr, timestamp = words[i], words[i + 1]
+        fmt = image.string_at(fmt_addr)
+        if fmt is None:
+            # Lost sync - skip a word and look for a plausible format address
+            i += 1
+            continue
+        nargs = min(len(conversions(fmt)), max_args)
+        args = words[i + 2:i + 2 + nargs]
+        if len(args) < nargs:
+            break
+        yield timestamp, fmt, args
+        i += 2 + nargs
+
+
+def decode_ring(image, data, max_args):
+    record_words = 3 + max_args
+    record_size = 4 * record_words
+    records = []
+    for off in range(0, len(data) - record_size + 1, record_size):
+        fields = struct.unpack_from('<%dI' % record_words, data, off)
+        if fields[0] != 0:
+            records.append(fields)
+    for fields in sorted(records):
+        fmt = image.string_at(fields[1])
+        if fmt is None:
+            continue
+        nargs = min(len(conversions(fmt)), max_args)
+        yield fields[2], fmt, fields[3:3 + nargs]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('elf', help='firmware ELF image')
+    parser.add_argument('capture', help='captured trace data')
+    parser.add_argument('--ring', action='store_true',
+                        help='capture is a dump of the RAM ring, not a stream')
+    parser.add_argument('--max-args', type=int, default=4,
+                        help='MBED_TRACE_BINARY_MAX_ARGS of the firmware (default 4)')
+    options = parser.parse_args()
+
+    image = Image(options.elf)
+    with open(options.capture, 'rb') as f:
+        data = f.read()
+
+    decode = decode_ring if options.ring else decode_stream
+    for timestamp, fmt, args in decode(image, data, options.max_args):
+        sys.stdout.write('[%10u] %s\n' % (timestamp, render(image, fmt, args)))
+
+
+if __name__ == '__main__':
+    main()
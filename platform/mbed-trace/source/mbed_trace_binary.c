@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026 ARM Limited. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "mbed_trace_binary.h"
+
+#if MBED_CONF_MBED_TRACE_BINARY_ENABLE
+
+#include <stdarg.h>
+#include <string.h>
+
+#include "platform/mbed_assert.h"
+#include "platform/mbed_atomic.h"
+#if defined(TARGET_CORTEX_M) || defined(__CORTEX_M)
+#include "cmsis.h"
+#endif
+#if DEVICE_ITM
+#include "hal/itm_api.h"
+#endif
+
+MBED_STATIC_ASSERT((MBED_TRACE_BINARY_BUFFER_RECORDS & (MBED_TRACE_BINARY_BUFFER_RECORDS - 1)) == 0,
+                   "MBED_TRACE_BINARY_BUFFER_RECORDS must be a power of two");
+
+/* The ring and its sequence counter are deliberately non-static so a debugger
+ * can locate and dump them by name while the target is running. */
+mbed_trace_binary_record_t mbed_trace_binary_ring[MBED_TRACE_BINARY_BUFFER_RECORDS];
+volatile uint32_t mbed_trace_binary_ring_seq = 0;
+
+static void (*output_function)(const uint32_t *data, size_t words) = NULL;
+
+/* Sequence number of the next record mbed_trace_binary_read() will return */
+static uint32_t read_seq = 0;
+
+/* Timestamps come from the DWT cycle counter, which is started on first use.
+ * Cortex-M0(+) has no DWT; records there carry a zero timestamp. */
+#if defined(DWT) && defined(DWT_CTRL_CYCCNTENA_Msk)
+static uint32_t trace_binary_cyccnt(void)
+{
+    if (!(DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk)) {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+    return DWT->CYCCNT;
+}
+#else
+static uint32_t trace_binary_cyccnt(void)
+{
+    return 0;
+}
+#endif
+
+void mbed_trace_binary_emit(unsigned nargs, const char *fmt, ...)
+{
+    uint32_t words[2 + MBED_TRACE_BINARY_MAX_ARGS];
+    va_list ap;
+
+    if (nargs > MBED_TRACE_BINARY_MAX_ARGS) {
+        nargs = MBED_TRACE_BINARY_MAX_ARGS;
+    }
+
+    words[0] = (uint32_t)(uintptr_t)fmt;
+    words[1] = trace_binary_cyccnt();
+    va_start(ap, fmt);
+    for (unsigned i = 0; i < nargs; i++) {
+        words[2 + i] = va_arg(ap, uint32_t);
+    }
+    va_end(ap);
+
+    void (*out)(const uint32_t *, size_t) = output_function;
+    if (out) {
+        out(words, 2 + nargs);
+        return;
+    }
+
+    /* Claim a slot with one atomic increment - no lock, safe against threads
+     * and interrupts alike. The slot's sequence word is cleared first and
+     * written last, so a half-written record is identifiable by its stale or
+     * zero sequence number. */
+    uint32_t seq = core_util_atomic_incr_u32(&mbed_trace_binary_ring_seq, 1);
+    mbed_trace_binary_record_t *slot = &mbed_trace_binary_ring[(seq - 1) & (MBED_TRACE_BINARY_BUFFER_RECORDS - 1)];
+    core_util_atomic_store_u32(&slot->seq, 0);
+    slot->fmt = words[0];
+    slot->timestamp = words[1];
+    for (unsigned i = 0; i < nargs; i++) {
+        slot->args[i] = words[2 + i];
+    }
+    core_util_atomic_store_u32(&slot->seq, seq);
+}
+
+void mbed_trace_binary_output_set(void (*out)(const uint32_t *data, size_t words))
+{
+    output_function = out;
+}
+
+#if DEVICE_ITM
+void mbed_trace_binary_itm_output(const uint32_t *data, size_t words)
+{
+    mbed_itm_init();
+    mbed_itm_send_block(ITM_PORT_SWO, data, words * sizeof(uint32_t));
+}
+#endif
+
+size_t mbed_trace_binary_read(mbed_trace_binary_record_t *records, size_t count)
+{
+    size_t got = 0;
+    uint32_t write_seq = core_util_atomic_load_u32(&mbed_trace_binary_ring_seq);
+
+    /* If the writer has lapped the reader, the overwritten records are gone -
+     * resume from the oldest record still in the ring. */
+    if (write_seq - read_seq > MBED_TRACE_BINARY_BUFFER_RECORDS) {
+        read_seq = write_seq - MBED_TRACE_BINARY_BUFFER_RECORDS;
+    }
+
+    while (read_seq != write_seq && got < count) {
+        const mbed_trace_binary_record_t *slot = &mbed_trace_binary_ring[read_seq & (MBED_TRACE_BINARY_BUFFER_RECORDS - 1)];
+        records[got] = *slot;
+        /* Drop records that were overwritten or still being written while we
+         * copied them; the sequence number proves a consistent copy. */
+        if (records[got].seq == read_seq + 1) {
+            got++;
+        }
+        read_seq++;
+    }
+    return got;
+}
+
+#endif /* MBED_CONF_MBED_TRACE_BINARY_ENABLE */
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026 ARM Limited. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "mbed_trace.h"
+
+#if MBED_CONF_MBED_TRACE_GROUP_MASKS
+
+#include <string.h>
+
+/* Trace groups are conventionally four characters; eight are kept so that
+ * longer names still distinguish themselves. Comparisons use the same
+ * truncation, so a stored name matches exactly the groups it was set for. */
+#define GROUP_NAME_LENGTH 8
+
+static struct {
+    char name[GROUP_NAME_LENGTH + 1];
+    uint8_t levels;
+} group_masks[MBED_TRACE_GROUP_MASK_ENTRIES];
+static int group_mask_count = 0;
+static uint8_t group_level_default = TRACE_ACTIVE_LEVEL_ALL;
+
+static int group_mask_find(const char *grp)
+{
+    for (int i = 0; i < group_mask_count; i++) {
+        if (strncmp(group_masks[i].name, grp, GROUP_NAME_LENGTH) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+void mbed_trace_group_level_set(const char *grp, uint8_t active_levels)
+{
+    int i = group_mask_find(grp);
+    if (i < 0) {
+        if (group_mask_count == MBED_TRACE_GROUP_MASK_ENTRIES) {
+            /* Table full - the group stays on the default mask */
+            return;
+        }
+        i = group_mask_count;
+        strncpy(group_masks[i].name, grp, GROUP_NAME_LENGTH);
+        group_masks[i].name[GROUP_NAME_LENGTH] = '\0';
+        /* The entry becomes visible to concurrent lookups only once the
+         * count is bumped, after the name is in place */
+        group_masks[i].levels = active_levels;
+        group_mask_count = i + 1;
+        return;
+    }
+    group_masks[i].levels = active_levels;
+}
+
+uint8_t mbed_trace_group_level_get(const char *grp)
+{
+    int i = group_mask_find(grp);
+    return (i < 0) ? group_level_default : group_masks[i].levels;
+}
+
+void mbed_trace_group_level_default_set(uint8_t active_levels)
+{
+    group_level_default = active_levels;
+}
+
+int mbed_trace_group_enabled(uint8_t dlevel, const char *grp)
+{
+    return (mbed_trace_group_level_get(grp) & dlevel) != 0;
+}
+
+#endif /* MBED_CONF_MBED_TRACE_GROUP_MASKS */
@@ -59,21 +59,32 @@ int ATCmdParser::putc(char c)
 
 int ATCmdParser::getc()
 {
-    pollfh fhs;
-    fhs.fh = _fh;
-    fhs.events = POLLIN;
+    if (_rx_chunk_pos >= _rx_chunk_len) {
+        pollfh fhs;
+        fhs.fh = _fh;
+        fhs.events = POLLIN;
 
-    int count = poll(&fhs, 1, _timeout);
-    if (count > 0 && (fhs.revents & POLLIN)) {
-        unsigned char ch;
-        return _fh->read(&ch, 1) == 1 ? ch : -1;
-    } else {
-        return -1;
+        int count = poll(&fhs, 1, _timeout);
+        if (count <= 0 || !(fhs.revents & POLLIN)) {
+            return -1;
+        }
+        // Pull in whatever is already pending, up to the chunk size, so
+        // sustained input costs one FileHandle call per chunk rather than
+        // per character.
+        ssize_t len = _fh->read(_rx_chunk, sizeof(_rx_chunk));
+        if (len <= 0) {
+            return -1;
+        }
+        _rx_chunk_pos = 0;
+        _rx_chunk_len = len;
     }
+    return static_cast<unsigned char>(_rx_chunk[_rx_chunk_pos++]);
 }
 
 void ATCmdParser::flush()
 {
+    _rx_chunk_pos = 0;
+    _rx_chunk_len = 0;
     while (_fh->readable()) {
         unsigned char ch;
         _fh->read(&ch, 1);
@@ -213,7 +224,7 @@ restart:
 
             // If just peeking for OOBs, and at start of line, check
             // readability
-            if (!response && j == 0 && !_fh->readable()) {
+            if (!response && j == 0 && _rx_chunk_pos >= _rx_chunk_len && !_fh->readable()) {
                 return -1;
             }
 
@@ -245,10 +256,35 @@ restart:
             _buffer[offset + j] = 0;
 
             // Check for oob data
+            //
+            // The first byte of a line selects the candidate set from the
+            // registered oobs; each further byte only re-checks the
+            // survivors, so matching cost is independent of how many
+            // handlers are registered.
             if (multiline) {
-                for (struct oob *oob = _oobs; oob; oob = oob->next) {
-                    if ((unsigned)j == oob->len && memcmp(
-                                oob->prefix, _buffer + offset, oob->len) == 0) {
+                if (j == 1) {
+                    _oob_active = NULL;
+                    for (struct oob *oob = _oobs; oob; oob = oob->next) {
+                        if (oob->len && oob->prefix[0] == (char)c) {
+                            oob->next_active = _oob_active;
+                            _oob_active = oob;
+                        }
+                    }
+                } else {
+                    struct oob **p = &_oob_active;
+                    while (*p) {
+                        struct oob *oob = *p;
+                        if ((unsigned)j > oob->len || oob->prefix[j - 1] != (char)c) {
+                            *p = oob->next_active;
+                        } else {
+                            p = &oob->next_active;
+                        }
+                    }
+                }
+                for (struct oob *oob = _oob_active; oob; oob = oob->next_active) {
+                    // Every byte so far matched incrementally, so reaching
+                    // the prefix length is a full match
+                    if ((unsigned)j == oob->len) {
                         debug_if(_dbg_on, "AT! %s\n", oob->prefix);
                         _oob_cb_count++;
                         oob->cb();
@@ -359,6 +395,7 @@ void ATCmdParser::oob(const char *prefix, Callback<void()> cb)
     oob->prefix = prefix;
     oob->cb = cb;
     oob->next = _oobs;
+    oob->next_active = NULL;
     _oobs = oob;
 }
 
@@ -373,6 +410,9 @@ void ATCmdParser::remove_oob(const char *prefix)
             } else {
                 _oobs = oob->next;
             }
+            // The candidate chain may reference the deleted oob; it is
+            // rebuilt on the next start of line
+            _oob_active = NULL;
             delete oob;
             return;
         }
@@ -0,0 +1,209 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "platform/BufferedFileHandle.h"
+
+#include <string.h>
+
+namespace mbed {
+
+BufferedFileHandle::BufferedFileHandle(FileHandle *fh, size_t buffer_size) :
+    _fh(fh),
+    _buffer(new unsigned char[buffer_size]),
+    _buffer_size(buffer_size),
+    _level(0),
+    _owns_buffer(true)
+{
+}
+
+BufferedFileHandle::~BufferedFileHandle()
+{
+    if (_fh) {
+        flush();
+    }
+    if (_owns_buffer) {
+        delete[] _buffer;
+    }
+}
+
+int BufferedFileHandle::set_buffer(void *buffer, size_t size)
+{
+    if (size == 0) {
+        return -EINVAL;
+    }
+    _mutex.lock();
+    int err = flush();
+    if (err < 0) {
+        _mutex.unlock();
+        return -EINVAL;
+    }
+    if (_owns_buffer) {
+        delete[] _buffer;
+    }
+    _buffer = static_cast<unsigned char *>(buffer);
+    _buffer_size = size;
+    _owns_buffer = false;
+    _mutex.unlock();
+    return 0;
+}
+
+int BufferedFileHandle::flush()
+{
+    size_t written = 0;
+    while (written < _level) {
+        ssize_t ret = _fh->write(_buffer + written, _level - written);
+        if (ret < 0) {
+            /* Keep the unwritten tail so a later flush can retry. */
+            memmove(_buffer, _buffer + written, _level - written);
+            _level -= written;
+            return ret;
+        }
+        written += ret;
+    }
+    _level = 0;
+    return 0;
+}
+
+ssize_t BufferedFileHandle::read(void *buffer, size_t size)
+{
+    _mutex.lock();
+    /* Make buffered writes visible before reading past them. */
+    int err = flush();
+    if (err < 0) {
+        _mutex.unlock();
+        return err;
+    }
+    ssize_t ret = _fh->read(buffer, size);
+    _mutex.unlock();
+    return ret;
+}
+
+ssize_t BufferedFileHandle::write(const void *buffer, size_t size)
+{
+    _mutex.lock();
+    if (_level + size > _buffer_size) {
+        int err = flush();
+        if (err < 0) {
+            _mutex.unlock();
+            return err;
+        }
+    }
+    ssize_t ret;
+    if (size >= _buffer_size) {
+        /* Too big to ever fit - skip the copy and pass it straight down. */
+        ret = _fh->write(buffer, size);
+    } else {
+        memcpy(_buffer + _level, buffer, size);
+        _level += size;
+        ret = size;
+    }
+    _mutex.unlock();
+    return ret;
+}
+
+off_t BufferedFileHandle::seek(off_t offset, int whence)
+{
+    _mutex.lock();
+    /* The underlying position must account for buffered data before the
+     * seek target is computed. */
+    int err = flush();
+    if (err < 0) {
+        _mutex.unlock();
+        return err;
+    }
+    off_t ret = _fh->seek(offset, whence);
+    _mutex.unlock();
+    return ret;
+}
+
+int BufferedFileHandle::close()
+{
+    _mutex.lock();
+    int err = flush();
+    int err_close = _fh->close();
+    /* The underlying handle may free itself in close() - make sure the
+     * destructor does not try to flush into it. */
+    _fh = NULL;
+    _level = 0;
+    _mutex.unlock();
+    return err < 0 ? err : err_close;
+}
+
+int BufferedFileHandle::sync()
+{
+    _mutex.lock();
+    int err = flush();
+    if (err < 0) {
+        _mutex.unlock();
+        return err;
+    }
+    int ret = _fh->sync();
+    _mutex.unlock();
+    return ret;
+}
+
+int BufferedFileHandle::isatty()
+{
+    return _fh->isatty();
+}
+
+off_t BufferedFileHandle::size()
+{
+    _mutex.lock();
+    int err = flush();
+    if (err < 0) {
+        _mutex.unlock();
+        return err;
+    }
+    off_t ret = _fh->size();
+    _mutex.unlock();
+    return ret;
+}
+
+int BufferedFileHandle::truncate(off_t length)
+{
+    _mutex.lock();
+    int err = flush();
+    if (err < 0) {
+        _mutex.unlock();
+        return err;
+    }
+    int ret = _fh->truncate(length);
+    _mutex.unlock();
+    return ret;
+}
+
+int BufferedFileHandle::set_blocking(bool blocking)
+{
+    return _fh->set_blocking(blocking);
+}
+
+bool BufferedFileHandle::is_blocking() const
+{
+    return _fh->is_blocking();
+}
+
+short BufferedFileHandle::poll(short events) const
+{
+    return _fh->poll(events);
+}
+
+void BufferedFileHandle::sigio(Callback<void()> func)
+{
+    _fh->sigio(func);
+}
+
+} // namespace mbed
@@ -0,0 +1,212 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "platform/BufferedFileStream.h"
+
+#include <stdio.h>
+#include <string.h>
+
+namespace mbed {
+
+BufferedFileStream::BufferedFileStream(FileHandle *fh, size_t buffer_size) :
+    _fh(fh),
+    _buffer(new uint8_t[buffer_size]),
+    _buffer_size(buffer_size),
+    _start(0),
+    _level(0),
+    _buffer_pos(0),
+    _seek_pending(false),
+    _owns_buffer(true)
+{
+    off_t pos = fh->seek(0, SEEK_CUR);
+    if (pos > 0) {
+        _buffer_pos = pos;
+    }
+}
+
+BufferedFileStream::~BufferedFileStream()
+{
+    if (_owns_buffer) {
+        delete[] _buffer;
+    }
+}
+
+int BufferedFileStream::set_buffer(void *buffer, size_t size)
+{
+    if (size == 0) {
+        return -EINVAL;
+    }
+    if (_owns_buffer) {
+        delete[] _buffer;
+    }
+    _buffer = static_cast<uint8_t *>(buffer);
+    _buffer_size = size;
+    _owns_buffer = false;
+    /* Drop the window but keep the position; the next refill re-seeks. */
+    _buffer_pos += _start;
+    _start = _level = 0;
+    _seek_pending = true;
+    return 0;
+}
+
+ssize_t BufferedFileStream::refill()
+{
+    if (_start > 0) {
+        memmove(_buffer, _buffer + _start, _level - _start);
+        _buffer_pos += _start;
+        _level -= _start;
+        _start = 0;
+    }
+    if (_seek_pending) {
+        off_t ret = _fh->seek(_buffer_pos + static_cast<off_t>(_level), SEEK_SET);
+        if (ret < 0) {
+            return ret;
+        }
+        _seek_pending = false;
+    }
+    if (_level == _buffer_size) {
+        return 0;
+    }
+    ssize_t ret = _fh->read(_buffer + _level, _buffer_size - _level);
+    if (ret > 0) {
+        _level += ret;
+    }
+    return ret;
+}
+
+int BufferedFileStream::refill_getc()
+{
+    ssize_t ret = refill();
+    if (ret < 0) {
+        return ret;
+    }
+    if (_start >= _level) {
+        return EOF;
+    }
+    return _buffer[_start++];
+}
+
+ssize_t BufferedFileStream::read(void *buffer, size_t size)
+{
+    uint8_t *out = static_cast<uint8_t *>(buffer);
+    size_t done = 0;
+    while (done < size) {
+        size_t avail = _level - _start;
+        if (avail > 0) {
+            size_t chunk = avail < size - done ? avail : size - done;
+            memcpy(out + done, _buffer + _start, chunk);
+            _start += chunk;
+            done += chunk;
+            continue;
+        }
+        /* Buffer exhausted - normalize the window to the read position. */
+        _buffer_pos += _level;
+        _start = _level = 0;
+        size_t want = size - done;
+        if (want >= _buffer_size) {
+            /* Too big to ever fit - skip the copy and read straight into
+             * the caller's buffer. */
+            if (_seek_pending) {
+                off_t sret = _fh->seek(_buffer_pos, SEEK_SET);
+                if (sret < 0) {
+                    return done ? (ssize_t) done : sret;
+                }
+                _seek_pending = false;
+            }
+            ssize_t ret = _fh->read(out + done, want);
+            if (ret < 0) {
+                return done ? (ssize_t) done : ret;
+            }
+            if (ret == 0) {
+                break;
+            }
+            _buffer_pos += ret;
+            done += ret;
+        } else {
+            ssize_t ret = refill();
+            if (ret < 0) {
+                return done ? (ssize_t) done : ret;
+            }
+            if (ret == 0) {
+                break;
+            }
+        }
+    }
+    return done;
+}
+
+Span<const uint8_t> BufferedFileStream::peek(size_t size)
+{
+    if (size > _buffer_size) {
+        size = _buffer_size;
+    }
+    while (_level - _start < size) {
+        ssize_t ret = refill();
+        if (ret <= 0) {
+            /* End of file or error - expose what is buffered. */
+            break;
+        }
+    }
+    size_t avail = _level - _start;
+    return Span<const uint8_t>(_buffer + _start, avail < size ? avail : size);
+}
+
+void BufferedFileStream::consume(size_t size)
+{
+    if (size <= _level - _start) {
+        _start += size;
+    } else {
+        seek(tell() + static_cast<off_t>(size), SEEK_SET);
+    }
+}
+
+off_t BufferedFileStream::seek(off_t offset, int whence)
+{
+    off_t target;
+    switch (whence) {
+        case SEEK_SET:
+            target = offset;
+            break;
+        case SEEK_CUR:
+            target = tell() + offset;
+            break;
+        case SEEK_END: {
+            off_t file_size = _fh->size();
+            if (file_size < 0) {
+                return file_size;
+            }
+            target = file_size + offset;
+            break;
+        }
+        default:
+            return -EINVAL;
+    }
+    if (target < 0) {
+        return -EINVAL;
+    }
+    if (target >= _buffer_pos && target <= _buffer_pos + static_cast<off_t>(_level)) {
+        /* Still within the buffered window - no filesystem call. */
+        _start = target - _buffer_pos;
+        return target;
+    }
+    /* Drop the window and defer the underlying seek to the next refill. */
+    _buffer_pos = target;
+    _start = _level = 0;
+    _seek_pending = true;
+    return target;
+}
+
+} // namespace mbed
@@ -0,0 +1,119 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "platform/DmaBuffer.h"
+#include "platform/ArenaAllocator.h"
+#include "platform/mbed_critical.h"
+
+#ifndef MBED_CONF_PLATFORM_DMA_NONCACHEABLE_POOL_SIZE
+#define MBED_CONF_PLATFORM_DMA_NONCACHEABLE_POOL_SIZE 0
+#endif
+
+namespace mbed {
+
+#if MBED_CONF_PLATFORM_DMA_NONCACHEABLE_POOL_SIZE > 0
+
+#if !((__ARM_ARCH_7M__ == 1U) || (__ARM_ARCH_7EM__ == 1U)) || \
+    !defined(__MPU_PRESENT) || (__MPU_PRESENT != 1U)
+#error "The non-cacheable DMA pool requires a v7-M MPU"
+#endif
+
+#define DMA_POOL_SIZE MBED_CONF_PLATFORM_DMA_NONCACHEABLE_POOL_SIZE
+
+static_assert((DMA_POOL_SIZE & (DMA_POOL_SIZE - 1)) == 0 && DMA_POOL_SIZE >= 256,
+              "platform.dma-noncacheable-pool-size must be a power of two, at least 256");
+
+/* v7-M MPU regions must be naturally aligned to their size */
+alignas(DMA_POOL_SIZE) static uint8_t dma_pool_mem[DMA_POOL_SIZE];
+static ArenaAllocator dma_pool(dma_pool_mem, sizeof dma_pool_mem);
+static bool dma_pool_mapped;
+
+/* Claims the highest-numbered MPU region, which takes precedence over the
+ * lower-numbered background regions mbed_mpu_init() programs */
+static void dma_pool_map()
+{
+    __DMB();
+    const uint32_t regions = (MPU->TYPE & MPU_TYPE_DREGION_Msk) >> MPU_TYPE_DREGION_Pos;
+    MBED_ASSERT(regions > 0);
+
+    ARM_MPU_SetRegion(
+        ARM_MPU_RBAR(
+            regions - 1,                // Region
+            (uint32_t)dma_pool_mem),    // Base
+        ARM_MPU_RASR(
+            1,                          // DisableExec
+            ARM_MPU_AP_FULL,            // AccessPermission
+            1,                          // TypeExtField
+            1,                          // IsShareable
+            0,                          // IsCacheable
+            0,                          // IsBufferable
+            0,                          // SubRegionDisable
+            // The RASR size field encodes log2(size) - 1
+            __builtin_ctz(DMA_POOL_SIZE) - 1)
+    );
+
+    if (!(MPU->CTRL & MPU_CTRL_ENABLE_Msk)) {
+        ARM_MPU_Enable(MPU_CTRL_PRIVDEFENA_Msk);
+    }
+
+    // Evict whatever the cache held for the pool range while it was still
+    // cacheable - from here on the MPU keeps the cache out entirely
+    dma_cache_clean(dma_pool_mem, sizeof dma_pool_mem);
+    dma_cache_invalidate(dma_pool_mem, sizeof dma_pool_mem);
+
+    __DSB();
+    __ISB();
+}
+
+void *dma_pool_alloc(size_t size)
+{
+    core_util_critical_section_enter();
+    if (!dma_pool_mapped) {
+        dma_pool_map();
+        dma_pool_mapped = true;
+    }
+    core_util_critical_section_exit();
+
+    // Whole cache lines per allocation, so no two allocations share a line
+    // with each other or with the arena's bump pointer arithmetic
+    size = (size + MBED_DMA_BUFFER_ALIGN - 1) & ~(size_t)(MBED_DMA_BUFFER_ALIGN - 1);
+    return dma_pool.alloc(size);
+}
+
+bool dma_pool_owns(const void *ptr)
+{
+    return (const uint8_t *)ptr >= dma_pool_mem &&
+           (const uint8_t *)ptr < dma_pool_mem + sizeof dma_pool_mem;
+}
+
+#else
+
+void *dma_pool_alloc(size_t size)
+{
+    (void)size;
+    return NULL;
+}
+
+bool dma_pool_owns(const void *ptr)
+{
+    (void)ptr;
+    return false;
+}
+
+#endif
+
+}
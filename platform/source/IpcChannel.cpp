@@ -0,0 +1,184 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "platform/IpcChannel.h"
+#include "platform/mbed_assert.h"
+#include "platform/mbed_atomic.h"
+
+#include <string.h>
+
+namespace mbed {
+
+IpcChannel::IpcChannel(IpcChannelBlock *block, uint8_t *buffer, size_t size)
+    : _block(block), _buffer(buffer), _size(size), _watermark(1), _notify()
+{
+    MBED_ASSERT(block && buffer && size);
+    // Power-of-two size keeps free-running indices correct across wrap;
+    // line alignment keeps cache maintenance inside the ring storage
+    MBED_ASSERT((size & (size - 1)) == 0);
+    MBED_ASSERT((size % MBED_DMA_BUFFER_ALIGN) == 0);
+    MBED_ASSERT(((uintptr_t)buffer % MBED_DMA_BUFFER_ALIGN) == 0);
+}
+
+void IpcChannel::init(IpcChannelBlock *block)
+{
+    block->head = 0;
+    block->tail = 0;
+    dma_cache_clean((const void *)block, sizeof(*block));
+}
+
+void IpcChannel::attach_notify(Callback<void()> notify)
+{
+    _notify = notify;
+}
+
+void IpcChannel::set_watermark(size_t bytes)
+{
+    MBED_ASSERT(bytes >= 1 && bytes <= _size);
+    _watermark = bytes;
+}
+
+uint32_t IpcChannel::index_load(const volatile uint32_t *index)
+{
+    // The other core owns this index; drop any stale cached copy first
+    dma_cache_invalidate(const_cast<uint32_t *>(index), sizeof(*index));
+    return core_util_atomic_load_u32(index);
+}
+
+void IpcChannel::index_store(volatile uint32_t *index, uint32_t value)
+{
+    core_util_atomic_store_u32(index, value);
+    dma_cache_clean((const void *)index, sizeof(*index));
+}
+
+Span<uint8_t> IpcChannel::claim(size_t max)
+{
+    uint32_t head = _block->head;
+    size_t free = _size - (head - index_load(&_block->tail));
+    size_t offset = head % _size;
+
+    size_t len = free;
+    if (len > _size - offset) {
+        len = _size - offset;   // stop at the wrap - the region is a real pointer
+    }
+    if (len > max) {
+        len = max;
+    }
+    return Span<uint8_t>(_buffer + offset, len);
+}
+
+void IpcChannel::commit(size_t size)
+{
+    if (size == 0) {
+        return;
+    }
+    uint32_t head = _block->head;
+    size_t offset = head % _size;
+    MBED_ASSERT(size <= _size - offset);
+
+    // Data first, then the index that publishes it
+    dma_cache_clean(_buffer + offset, size);
+    index_store(&_block->head, head + size);
+
+    if (_notify) {
+        size_t level = (head + size) - index_load(&_block->tail);
+        if (level >= _watermark && level - size < _watermark) {
+            _notify();
+        }
+    }
+}
+
+Span<const uint8_t> IpcChannel::acquire(size_t max)
+{
+    uint32_t tail = _block->tail;
+    size_t available = index_load(&_block->head) - tail;
+    size_t offset = tail % _size;
+
+    size_t len = available;
+    if (len > _size - offset) {
+        len = _size - offset;
+    }
+    if (len > max) {
+        len = max;
+    }
+    if (len) {
+        dma_cache_invalidate(_buffer + offset, len);
+    }
+    return Span<const uint8_t>(_buffer + offset, len);
+}
+
+void IpcChannel::release(size_t size)
+{
+    if (size == 0) {
+        return;
+    }
+    uint32_t tail = _block->tail;
+    MBED_ASSERT(size <= _size - (tail % _size));
+
+    index_store(&_block->tail, tail + size);
+
+    if (_notify) {
+        size_t free = _size - (index_load(&_block->head) - (tail + size));
+        if (free >= _watermark && free - size < _watermark) {
+            _notify();
+        }
+    }
+}
+
+size_t IpcChannel::write(const void *data, size_t size)
+{
+    const uint8_t *src = static_cast<const uint8_t *>(data);
+    size_t written = 0;
+    while (written < size) {
+        Span<uint8_t> region = claim(size - written);
+        if (region.empty()) {
+            break;
+        }
+        memcpy(region.data(), src + written, region.size());
+        commit(region.size());
+        written += region.size();
+    }
+    return written;
+}
+
+size_t IpcChannel::read(void *data, size_t size)
+{
+    uint8_t *dst = static_cast<uint8_t *>(data);
+    size_t got = 0;
+    while (got < size) {
+        Span<const uint8_t> region = acquire(size - got);
+        if (region.empty()) {
+            break;
+        }
+        memcpy(dst + got, region.data(), region.size());
+        release(region.size());
+        got += region.size();
+    }
+    return got;
+}
+
+size_t IpcChannel::readable() const
+{
+    return index_load(&_block->head) - _block->tail;
+}
+
+size_t IpcChannel::writable() const
+{
+    return _size - (_block->head - index_load(&_block->tail));
+}
+
+} // namespace mbed
@@ -21,6 +21,7 @@
 #include "mbed_critical.h"
 #include "mbed_assert.h"
 #include "platform/mbed_power_mgmt.h"
+#include "platform/mbed_lp_drift.h"
 #include "platform/CriticalSectionLock.h"
 #include "platform/internal/SysTimer.h"
 extern "C" {
@@ -33,6 +34,14 @@ using namespace std::chrono;
 
 constexpr milliseconds deep_sleep_latency{MBED_CONF_TARGET_DEEP_SLEEP_LATENCY};
 
+/* Scale wake deadlines by the modelled low-power ticker frequency error
+ * (see mbed_lp_drift.h), so time-synchronized applications need not pad
+ * wakeups by worst-case crystal drift. Off by default: it only helps when
+ * something disciplines the model. */
+#ifndef MBED_CONF_PLATFORM_LP_DRIFT_COMPENSATION
+#define MBED_CONF_PLATFORM_LP_DRIFT_COMPENSATION 0
+#endif
+
 #if (defined(NO_SYSTICK))
 /**
  * Return an IRQ number that can be used in the absence of SysTick
@@ -103,6 +112,18 @@ void SysTimer<Period, IRQ>::set_wake_time(time_point at)
     duration ticks_to_sleep = at - get_tick();
     highres_time_point wake_time = _epoch + at.time_since_epoch();
 
+#if MBED_CONF_PLATFORM_LP_DRIFT_COMPENSATION
+    /* The ticker reports time assuming nominal crystal frequency; if the
+     * crystal runs fast the reported deadline is reached early, and late
+     * if it runs slow. Stretch or shrink the interval by the modelled
+     * error so the hardware wake lands on the true deadline. */
+    int32_t drift_ppb = mbed_lp_drift_get_ppb();
+    if (drift_ppb != 0) {
+        highres_duration interval = duration_cast<highres_duration>(ticks_to_sleep);
+        wake_time += highres_duration(interval.count() * drift_ppb / 1000000000);
+    }
+#endif
+
     /* Set this first, before attaching the interrupt that can unset it */
     _wake_time_set = true;
     _wake_time_passed = false;
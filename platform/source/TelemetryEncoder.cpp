@@ -0,0 +1,391 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "platform/TelemetryEncoder.h"
+#include <math.h>
+#include <string.h>
+
+namespace mbed {
+
+////// JsonEncoder //////
+
+void JsonEncoder::put(char c)
+{
+    if (_size >= (size_t) _buffer.size()) {
+        _overflowed = true;
+        return;
+    }
+    _buffer[_size++] = c;
+}
+
+void JsonEncoder::put(const char *s, size_t len)
+{
+    if (len > (size_t) _buffer.size() - _size) {
+        _overflowed = true;
+        len = _buffer.size() - _size;
+    }
+    memcpy(_buffer.data() + _size, s, len);
+    _size += len;
+}
+
+void JsonEncoder::put_escaped(const char *s, size_t len)
+{
+    static const char hex[] = "0123456789abcdef";
+    put('"');
+    for (size_t i = 0; i < len; i++) {
+        char c = s[i];
+        if ((c == '"') || (c == '\\')) {
+            put('\\');
+            put(c);
+        } else if ((unsigned char) c >= 0x20) {
+            put(c);
+        } else if (c == '\n') {
+            put("\\n", 2);
+        } else if (c == '\r') {
+            put("\\r", 2);
+        } else if (c == '\t') {
+            put("\\t", 2);
+        } else {
+            put("\\u00", 4);
+            put(hex[(c >> 4) & 0xf]);
+            put(hex[c & 0xf]);
+        }
+    }
+    put('"');
+}
+
+// Emit the comma before a key or array member and claim the "first
+// member" bit of the current depth
+void JsonEncoder::separate()
+{
+    if (!_depth) {
+        return;
+    }
+    uint32_t bit = 1u << (_depth - 1);
+    if (_first & bit) {
+        _first &= ~bit;
+    } else {
+        put(',');
+    }
+}
+
+// Values separate themselves only inside arrays - in an object the
+// preceding key already did
+void JsonEncoder::separate_value()
+{
+    if (_depth && !(_in_object & (1u << (_depth - 1)))) {
+        separate();
+    }
+}
+
+void JsonEncoder::put_uint(uint64_t v)
+{
+    char digits[20];
+    size_t n = 0;
+    do {
+        digits[n++] = '0' + (v % 10);
+        v /= 10;
+    } while (v);
+    while (n) {
+        put(digits[--n]);
+    }
+}
+
+JsonEncoder &JsonEncoder::begin_object()
+{
+    if (_depth >= 32) {
+        _overflowed = true;
+        return *this;
+    }
+    if (!_depth || !(_in_object & (1u << (_depth - 1)))) {
+        separate();
+    }
+    put('{');
+    _depth++;
+    _first |= 1u << (_depth - 1);
+    _in_object |= 1u << (_depth - 1);
+    return *this;
+}
+
+JsonEncoder &JsonEncoder::end_object()
+{
+    if (!_depth) {
+        _overflowed = true;
+        return *this;
+    }
+    put('}');
+    _depth--;
+    return *this;
+}
+
+JsonEncoder &JsonEncoder::begin_array()
+{
+    if (_depth >= 32) {
+        _overflowed = true;
+        return *this;
+    }
+    if (!_depth || !(_in_object & (1u << (_depth - 1)))) {
+        separate();
+    }
+    put('[');
+    _depth++;
+    _first |= 1u << (_depth - 1);
+    _in_object &= ~(1u << (_depth - 1));
+    return *this;
+}
+
+JsonEncoder &JsonEncoder::end_array()
+{
+    if (!_depth) {
+        _overflowed = true;
+        return *this;
+    }
+    put(']');
+    _depth--;
+    return *this;
+}
+
+JsonEncoder &JsonEncoder::key(const char *name, size_t len)
+{
+    separate();
+    put_escaped(name, len);
+    put(':');
+    return *this;
+}
+
+JsonEncoder &JsonEncoder::value(const char *str, size_t len)
+{
+    separate_value();
+    put_escaped(str, len);
+    return *this;
+}
+
+JsonEncoder &JsonEncoder::value(int64_t v)
+{
+    separate_value();
+    if (v < 0) {
+        put('-');
+        // Avoid overflow negating INT64_MIN
+        put_uint((uint64_t) - (v + 1) + 1);
+    } else {
+        put_uint(v);
+    }
+    return *this;
+}
+
+JsonEncoder &JsonEncoder::value(uint64_t v)
+{
+    separate_value();
+    put_uint(v);
+    return *this;
+}
+
+JsonEncoder &JsonEncoder::value(bool v)
+{
+    separate_value();
+    if (v) {
+        put("true", 4);
+    } else {
+        put("false", 5);
+    }
+    return *this;
+}
+
+JsonEncoder &JsonEncoder::null()
+{
+    separate_value();
+    put("null", 4);
+    return *this;
+}
+
+JsonEncoder &JsonEncoder::value(float v)
+{
+    if (!isfinite(v)) {
+        // JSON has no representation for NaN or infinities
+        return null();
+    }
+
+    separate_value();
+
+    double d = v;
+    if (d < 0) {
+        put('-');
+        d = -d;
+    }
+
+    // Normalize large magnitudes into exponent form so the integer part
+    // fits a uint64_t; a float's six decimal digits of precision are
+    // kept either way
+    int exponent = 0;
+    while (d >= 1e15) {
+        d /= 10;
+        exponent++;
+    }
+
+    uint64_t whole = (uint64_t) d;
+    uint64_t frac = (uint64_t)((d - (double) whole) * 1e6 + 0.5);
+    if (frac >= 1000000) {
+        whole++;
+        frac = 0;
+    }
+
+    put_uint(whole);
+    if (frac) {
+        char digits[7];
+        for (int i = 5; i >= 0; i--) {
+            digits[i] = '0' + (frac % 10);
+            frac /= 10;
+        }
+        size_t n = 6;
+        while (n && (digits[n - 1] == '0')) {
+            n--;
+        }
+        put('.');
+        put(digits, n);
+    }
+    if (exponent) {
+        put('e');
+        put_uint(exponent);
+    }
+    return *this;
+}
+
+////// CborEncoder //////
+
+void CborEncoder::put(uint8_t b)
+{
+    if (_size >= (size_t) _buffer.size()) {
+        _overflowed = true;
+        return;
+    }
+    _buffer[_size++] = b;
+}
+
+// Major type and argument in the shortest of the five head encodings
+void CborEncoder::put_head(uint8_t major, uint64_t arg)
+{
+    if (arg < 24) {
+        put((major << 5) | arg);
+        return;
+    }
+    int bytes;
+    if (arg <= 0xff) {
+        put((major << 5) | 24);
+        bytes = 1;
+    } else if (arg <= 0xffff) {
+        put((major << 5) | 25);
+        bytes = 2;
+    } else if (arg <= 0xffffffff) {
+        put((major << 5) | 26);
+        bytes = 4;
+    } else {
+        put((major << 5) | 27);
+        bytes = 8;
+    }
+    for (int i = bytes - 1; i >= 0; i--) {
+        put((arg >> (8 * i)) & 0xff);
+    }
+}
+
+CborEncoder &CborEncoder::begin_map(size_t pairs)
+{
+    put_head(5, pairs);
+    return *this;
+}
+
+CborEncoder &CborEncoder::begin_array(size_t items)
+{
+    put_head(4, items);
+    return *this;
+}
+
+CborEncoder &CborEncoder::begin_map()
+{
+    put(0xbf);
+    return *this;
+}
+
+CborEncoder &CborEncoder::begin_array()
+{
+    put(0x9f);
+    return *this;
+}
+
+CborEncoder &CborEncoder::end()
+{
+    put(0xff);
+    return *this;
+}
+
+CborEncoder &CborEncoder::value(const char *str, size_t len)
+{
+    put_head(3, len);
+    for (size_t i = 0; i < len; i++) {
+        put(str[i]);
+    }
+    return *this;
+}
+
+CborEncoder &CborEncoder::value(Span<const uint8_t> bytes)
+{
+    put_head(2, bytes.size());
+    for (size_t i = 0; i < (size_t) bytes.size(); i++) {
+        put(bytes[i]);
+    }
+    return *this;
+}
+
+CborEncoder &CborEncoder::value(int64_t v)
+{
+    if (v < 0) {
+        put_head(1, (uint64_t) - (v + 1));
+    } else {
+        put_head(0, (uint64_t) v);
+    }
+    return *this;
+}
+
+CborEncoder &CborEncoder::value(uint64_t v)
+{
+    put_head(0, v);
+    return *this;
+}
+
+CborEncoder &CborEncoder::value(bool v)
+{
+    put(v ? 0xf5 : 0xf4);
+    return *this;
+}
+
+CborEncoder &CborEncoder::value(float v)
+{
+    uint32_t bits;
+    memcpy(&bits, &v, sizeof(bits));
+    put(0xfa);
+    for (int i = 3; i >= 0; i--) {
+        put((bits >> (8 * i)) & 0xff);
+    }
+    return *this;
+}
+
+CborEncoder &CborEncoder::null()
+{
+    put(0xf6);
+    return *this;
+}
+
+} // namespace mbed
@@ -25,6 +25,17 @@
 #include <string.h>
 #include <stdlib.h>
 
+/* Route the malloc family to the TLSF backend instead of the toolchain
+ * allocator - see mbed_tlsf.h. The stats and tracing machinery stays on
+ * top of whichever backend is selected. */
+#ifndef MBED_CONF_PLATFORM_HEAP_TLSF
+#define MBED_CONF_PLATFORM_HEAP_TLSF 0
+#endif
+
+#if MBED_CONF_PLATFORM_HEAP_TLSF
+#include "mbed_tlsf.h"
+#endif
+
 /* There are two memory tracers in mbed OS:
 
 - the first can be used to detect the maximum heap usage at runtime. It is
@@ -46,12 +57,49 @@ typedef struct {
     uint32_t signature;
 } alloc_info_t;
 
+#if MBED_HEAP_TAG_STATS_ENABLED && !MBED_HEAP_STATS_ENABLED
+#error Heap tag statistics require MBED_HEAP_STATS_ENABLED
+#endif
+
 #if MBED_HEAP_STATS_ENABLED
 #define MBED_HEAP_STATS_SIGNATURE       (0xdeadbeef)
 
+#if MBED_HEAP_TAG_STATS_ENABLED
+/* The low signature byte records the owning tag, so tagging adds no
+ * per-allocation memory overhead */
+#define MBED_HEAP_STATS_SIGNATURE_MASK  (0xffffff00)
+#else
+#define MBED_HEAP_STATS_SIGNATURE_MASK  (0xffffffff)
+#endif
+
 static SingletonPtr<PlatformMutex> malloc_stats_mutex;
 static mbed_stats_heap_t heap_stats = {0, 0, 0, 0, 0, 0, 0};
 
+#if MBED_HEAP_TAG_STATS_ENABLED
+static mbed_stats_heap_tag_t heap_tag_stats[MBED_STATS_HEAP_MAX_TAGS] = {{"untagged", 0, 0, 0}};
+static uint8_t heap_tag_count = 1;
+static volatile uint8_t heap_tag_current = 0;
+
+// Both called with malloc_stats_mutex held
+static void heap_tag_alloc_update(uint8_t tag, uint32_t size)
+{
+    mbed_stats_heap_tag_t *tag_stats = &heap_tag_stats[tag];
+    tag_stats->current_size += size;
+    tag_stats->alloc_cnt += 1;
+    if (tag_stats->current_size > tag_stats->max_size) {
+        tag_stats->max_size = tag_stats->current_size;
+    }
+}
+
+static void heap_tag_free_update(uint8_t tag, uint32_t size)
+{
+    if (tag < MBED_STATS_HEAP_MAX_TAGS) {
+        heap_tag_stats[tag].current_size -= size;
+        heap_tag_stats[tag].alloc_cnt -= 1;
+    }
+}
+#endif
+
 typedef struct mbed_heap_overhead  {
     int size; // Size of the allocated memory block, including internal overhead size
     struct mbed_heap_overhead *next; // The memory is either the next free block, or allocated memory block
@@ -59,6 +107,9 @@ typedef struct mbed_heap_overhead  {
 
 static int get_malloc_block_total_size(void *ptr)
 {
+#if MBED_CONF_PLATFORM_HEAP_TLSF
+    return mbed_tlsf_block_total_size(ptr);
+#else
     mbed_heap_overhead_t *c = (mbed_heap_overhead_t *)((char *)ptr - offsetof(mbed_heap_overhead, next));
 
     // Skip the padding area
@@ -67,6 +118,7 @@ static int get_malloc_block_total_size(void *ptr)
     }
     //  Mask LSB as it is used for usage flags
     return (c->size & ~0x1);
+#endif
 }
 #endif
 
@@ -84,6 +136,97 @@ void mbed_stats_heap_get(mbed_stats_heap_t *stats)
 #endif
 }
 
+#if MBED_HEAP_STATS_ENABLED
+static void heap_frag_account(mbed_stats_heap_frag_t *stats, uint32_t size)
+{
+    stats->free_size += size;
+    stats->free_block_cnt += 1;
+    if (size > stats->largest_free_block) {
+        stats->largest_free_block = size;
+    }
+    uint32_t bucket = 0;
+    while ((bucket < MBED_STATS_HEAP_FRAG_BUCKETS - 1) && (size >= (32UL << bucket))) {
+        bucket++;
+    }
+    stats->histogram[bucket] += 1;
+}
+
+#if MBED_CONF_PLATFORM_HEAP_TLSF
+static void heap_frag_visit(size_t size, void *context)
+{
+    heap_frag_account((mbed_stats_heap_frag_t *)context, size);
+}
+#endif
+#endif
+
+void mbed_stats_heap_frag_get(mbed_stats_heap_frag_t *stats)
+{
+    memset(stats, 0, sizeof(mbed_stats_heap_frag_t));
+#if MBED_HEAP_STATS_ENABLED && MBED_CONF_PLATFORM_HEAP_TLSF
+    mbed_tlsf_free_blocks_visit(heap_frag_visit, stats);
+#elif MBED_HEAP_STATS_ENABLED && defined(TOOLCHAIN_GCC)
+    // Newlib-nano's free list - chunks have the same layout that
+    // get_malloc_block_total_size() already relies on
+    extern mbed_heap_overhead_t *__malloc_free_list;
+
+    // The wrappers hold this mutex across the real allocator calls, so the
+    // free list cannot change under the walk
+    malloc_stats_mutex->lock();
+    for (mbed_heap_overhead_t *c = __malloc_free_list; c != NULL; c = c->next) {
+        heap_frag_account(stats, c->size);
+    }
+    malloc_stats_mutex->unlock();
+#endif
+}
+
+int8_t mbed_stats_heap_tag_register(const char *name)
+{
+#if MBED_HEAP_TAG_STATS_ENABLED
+    int8_t tag = -1;
+    malloc_stats_mutex->lock();
+    if (heap_tag_count < MBED_STATS_HEAP_MAX_TAGS) {
+        tag = heap_tag_count;
+        heap_tag_stats[tag].name = name;
+        heap_tag_count += 1;
+    }
+    malloc_stats_mutex->unlock();
+    return tag;
+#else
+    (void)name;
+    return -1;
+#endif
+}
+
+int8_t mbed_stats_heap_tag_set(int8_t tag)
+{
+#if MBED_HEAP_TAG_STATS_ENABLED
+    int8_t prev = heap_tag_current;
+    if ((tag >= 0) && (tag < heap_tag_count)) {
+        heap_tag_current = tag;
+    }
+    return prev;
+#else
+    (void)tag;
+    return 0;
+#endif
+}
+
+size_t mbed_stats_heap_tag_get(mbed_stats_heap_tag_t *stats, size_t count)
+{
+    memset(stats, 0, count * sizeof(mbed_stats_heap_tag_t));
+#if MBED_HEAP_TAG_STATS_ENABLED
+    malloc_stats_mutex->lock();
+    if (count > heap_tag_count) {
+        count = heap_tag_count;
+    }
+    memcpy(stats, heap_tag_stats, count * sizeof(mbed_stats_heap_tag_t));
+    malloc_stats_mutex->unlock();
+    return count;
+#else
+    return 0;
+#endif
+}
+
 /******************************************************************************/
 /* GCC memory allocation wrappers                                             */
 /******************************************************************************/
@@ -100,6 +243,20 @@ extern "C" {
     void free_wrapper(struct _reent *r, void *ptr, void *caller);
 }
 
+#if MBED_CONF_PLATFORM_HEAP_TLSF
+#define backend_malloc_r(r, size)               mbed_tlsf_malloc(size)
+#define backend_realloc_r(r, ptr, size)         mbed_tlsf_realloc(ptr, size)
+#define backend_calloc_r(r, nmemb, size)        mbed_tlsf_calloc(nmemb, size)
+#define backend_free_r(r, ptr)                  mbed_tlsf_free(ptr)
+#define backend_memalign_r(r, alignment, bytes) mbed_tlsf_memalign(alignment, bytes)
+#else
+#define backend_malloc_r(r, size)               __real__malloc_r(r, size)
+#define backend_realloc_r(r, ptr, size)         __real__realloc_r(r, ptr, size)
+#define backend_calloc_r(r, nmemb, size)        __real__calloc_r(r, nmemb, size)
+#define backend_free_r(r, ptr)                  __real__free_r(r, ptr)
+#define backend_memalign_r(r, alignment, bytes) __real__memalign_r(r, alignment, bytes)
+#endif
+
 
 extern "C" void *__wrap__malloc_r(struct _reent *r, size_t size)
 {
@@ -116,11 +273,17 @@ extern "C" void *malloc_wrapper(struct _reent *r, size_t size, void *caller)
     malloc_stats_mutex->lock();
     alloc_info_t *alloc_info = NULL;
     if (size <= SIZE_MAX - sizeof(alloc_info_t)) {
-        alloc_info = (alloc_info_t *)__real__malloc_r(r, size + sizeof(alloc_info_t));
+        alloc_info = (alloc_info_t *)backend_malloc_r(r, size + sizeof(alloc_info_t));
     }
     if (alloc_info != NULL) {
         alloc_info->size = size;
+#if MBED_HEAP_TAG_STATS_ENABLED
+        uint8_t tag = heap_tag_current;
+        alloc_info->signature = (MBED_HEAP_STATS_SIGNATURE & MBED_HEAP_STATS_SIGNATURE_MASK) | tag;
+        heap_tag_alloc_update(tag, size);
+#else
         alloc_info->signature = MBED_HEAP_STATS_SIGNATURE;
+#endif
         ptr = (void *)(alloc_info + 1);
         heap_stats.current_size += size;
         heap_stats.total_size += size;
@@ -134,7 +297,7 @@ extern "C" void *malloc_wrapper(struct _reent *r, size_t size, void *caller)
     }
     malloc_stats_mutex->unlock();
 #else // #if MBED_HEAP_STATS_ENABLED
-    ptr = __real__malloc_r(r, size);
+    ptr = backend_malloc_r(r, size);
 #endif // #if MBED_HEAP_STATS_ENABLED
 #if MBED_MEM_TRACING_ENABLED
     mbed_mem_trace_malloc(ptr, size, caller);
@@ -177,7 +340,7 @@ extern "C" void *__wrap__realloc_r(struct _reent *r, void *ptr, size_t size)
         free(ptr);
     }
 #else // #if MBED_HEAP_STATS_ENABLED
-    new_ptr = __real__realloc_r(r, ptr, size);
+    new_ptr = backend_realloc_r(r, ptr, size);
 #endif // #if MBED_HEAP_STATS_ENABLED
 #if MBED_MEM_TRACING_ENABLED
     mbed_mem_trace_realloc(new_ptr, ptr, size, MBED_CALLER_ADDR());
@@ -201,22 +364,25 @@ extern "C" void free_wrapper(struct _reent *r, void *ptr, void *caller)
     alloc_info_t *alloc_info = NULL;
     if (ptr != NULL) {
         alloc_info = ((alloc_info_t *)ptr) - 1;
-        if (MBED_HEAP_STATS_SIGNATURE == alloc_info->signature) {
+        if ((MBED_HEAP_STATS_SIGNATURE & MBED_HEAP_STATS_SIGNATURE_MASK) == (alloc_info->signature & MBED_HEAP_STATS_SIGNATURE_MASK)) {
             size_t user_size = alloc_info->size;
             size_t alloc_size = get_malloc_block_total_size((void *)alloc_info);
+#if MBED_HEAP_TAG_STATS_ENABLED
+            heap_tag_free_update(alloc_info->signature & 0xff, user_size);
+#endif
             alloc_info->signature = 0x0;
             heap_stats.current_size -= user_size;
             heap_stats.alloc_cnt -= 1;
             heap_stats.overhead_size -= (alloc_size - user_size);
-            __real__free_r(r, (void *)alloc_info);
+            backend_free_r(r, (void *)alloc_info);
         } else {
-            __real__free_r(r, ptr);
+            backend_free_r(r, ptr);
         }
     }
 
     malloc_stats_mutex->unlock();
 #else // #if MBED_HEAP_STATS_ENABLED
-    __real__free_r(r, ptr);
+    backend_free_r(r, ptr);
 #endif // #if MBED_HEAP_STATS_ENABLED
 #if MBED_MEM_TRACING_ENABLED
     mbed_mem_trace_free(ptr, caller);
@@ -238,7 +404,7 @@ extern "C" void *__wrap__calloc_r(struct _reent *r, size_t nmemb, size_t size)
         memset(ptr, 0, nmemb * size);
     }
 #else // #if MBED_HEAP_STATS_ENABLED
-    ptr = __real__calloc_r(r, nmemb, size);
+    ptr = backend_calloc_r(r, nmemb, size);
 #endif // #if MBED_HEAP_STATS_ENABLED
 #if MBED_MEM_TRACING_ENABLED
     mbed_mem_trace_calloc(ptr, nmemb, size, MBED_CALLER_ADDR());
@@ -249,7 +415,7 @@ extern "C" void *__wrap__calloc_r(struct _reent *r, size_t nmemb, size_t size)
 
 extern "C" void *__wrap__memalign_r(struct _reent *r, size_t alignment, size_t bytes)
 {
-    return __real__memalign_r(r, alignment, bytes);
+    return backend_memalign_r(r, alignment, bytes);
 }
 
 
@@ -279,8 +445,9 @@ extern "C" void *__wrap__memalign_r(struct _reent *r, size_t alignment, size_t b
 #define SUB_FREE        $Sub$$__iar_dlfree
 #endif
 
-/* Enable hooking of memory function only if tracing is also enabled */
-#if defined(MBED_MEM_TRACING_ENABLED) || defined(MBED_HEAP_STATS_ENABLED)
+/* Enable hooking of memory functions only if tracing, statistics or a
+ * non-default heap backend needs them */
+#if defined(MBED_MEM_TRACING_ENABLED) || defined(MBED_HEAP_STATS_ENABLED) || MBED_CONF_PLATFORM_HEAP_TLSF
 
 extern "C" {
     void *SUPER_MALLOC(size_t size);
@@ -291,6 +458,18 @@ extern "C" {
     void free_wrapper(void *ptr, void *caller);
 }
 
+#if MBED_CONF_PLATFORM_HEAP_TLSF
+#define backend_malloc(size)        mbed_tlsf_malloc(size)
+#define backend_realloc(ptr, size)  mbed_tlsf_realloc(ptr, size)
+#define backend_calloc(nmemb, size) mbed_tlsf_calloc(nmemb, size)
+#define backend_free(ptr)           mbed_tlsf_free(ptr)
+#else
+#define backend_malloc(size)        SUPER_MALLOC(size)
+#define backend_realloc(ptr, size)  SUPER_REALLOC(ptr, size)
+#define backend_calloc(nmemb, size) SUPER_CALLOC(nmemb, size)
+#define backend_free(ptr)           SUPER_FREE(ptr)
+#endif
+
 extern "C" void *SUB_MALLOC(size_t size)
 {
     return malloc_wrapper(size, MBED_CALLER_ADDR());
@@ -306,11 +485,17 @@ extern "C" void *malloc_wrapper(size_t size, void *caller)
     malloc_stats_mutex->lock();
     alloc_info_t *alloc_info = NULL;
     if (size <= SIZE_MAX - sizeof(alloc_info_t)) {
-        alloc_info = (alloc_info_t *)SUPER_MALLOC(size + sizeof(alloc_info_t));
+        alloc_info = (alloc_info_t *)backend_malloc(size + sizeof(alloc_info_t));
     }
     if (alloc_info != NULL) {
         alloc_info->size = size;
+#if MBED_HEAP_TAG_STATS_ENABLED
+        uint8_t tag = heap_tag_current;
+        alloc_info->signature = (MBED_HEAP_STATS_SIGNATURE & MBED_HEAP_STATS_SIGNATURE_MASK) | tag;
+        heap_tag_alloc_update(tag, size);
+#else
         alloc_info->signature = MBED_HEAP_STATS_SIGNATURE;
+#endif
         ptr = (void *)(alloc_info + 1);
         heap_stats.current_size += size;
         heap_stats.total_size += size;
@@ -324,7 +509,7 @@ extern "C" void *malloc_wrapper(size_t size, void *caller)
     }
     malloc_stats_mutex->unlock();
 #else // #if MBED_HEAP_STATS_ENABLED
-    ptr = SUPER_MALLOC(size);
+    ptr = backend_malloc(size);
 #endif // #if MBED_HEAP_STATS_ENABLED
 #if MBED_MEM_TRACING_ENABLED
     mbed_mem_trace_malloc(ptr, size, caller);
@@ -373,7 +558,7 @@ extern "C" void *SUB_REALLOC(void *ptr, size_t size)
         }
     }
 #else // #if MBED_HEAP_STATS_ENABLED
-    new_ptr = SUPER_REALLOC(ptr, size);
+    new_ptr = backend_realloc(ptr, size);
 #endif // #if MBED_HEAP_STATS_ENABLED
 #if MBED_MEM_TRACING_ENABLED
     mbed_mem_trace_realloc(new_ptr, ptr, size, MBED_CALLER_ADDR());
@@ -405,7 +590,7 @@ extern "C" void *SUB_CALLOC(size_t nmemb, size_t size)
         }
     }
 #else // #if MBED_HEAP_STATS_ENABLED
-    ptr = SUPER_CALLOC(nmemb, size);
+    ptr = backend_calloc(nmemb, size);
 #endif // #if MBED_HEAP_STATS_ENABLED
 #if MBED_MEM_TRACING_ENABLED
     mbed_mem_trace_calloc(ptr, nmemb, size, MBED_CALLER_ADDR());
@@ -429,22 +614,25 @@ extern "C" void free_wrapper(void *ptr, void *caller)
     alloc_info_t *alloc_info = NULL;
     if (ptr != NULL) {
         alloc_info = ((alloc_info_t *)ptr) - 1;
-        if (MBED_HEAP_STATS_SIGNATURE == alloc_info->signature) {
+        if ((MBED_HEAP_STATS_SIGNATURE & MBED_HEAP_STATS_SIGNATURE_MASK) == (alloc_info->signature & MBED_HEAP_STATS_SIGNATURE_MASK)) {
             size_t user_size = alloc_info->size;
             size_t alloc_size = get_malloc_block_total_size((void *)alloc_info);
+#if MBED_HEAP_TAG_STATS_ENABLED
+            heap_tag_free_update(alloc_info->signature & 0xff, user_size);
+#endif
             alloc_info->signature = 0x0;
             heap_stats.current_size -= user_size;
             heap_stats.alloc_cnt -= 1;
             heap_stats.overhead_size -= (alloc_size - user_size);
-            SUPER_FREE((void *)alloc_info);
+            backend_free((void *)alloc_info);
         } else {
-            SUPER_FREE(ptr);
+            backend_free(ptr);
         }
     }
 
     malloc_stats_mutex->unlock();
 #else // #if MBED_HEAP_STATS_ENABLED
-    SUPER_FREE(ptr);
+    backend_free(ptr);
 #endif // #if MBED_HEAP_STATS_ENABLED
 #if MBED_MEM_TRACING_ENABLED
     mbed_mem_trace_free(ptr, caller);
@@ -25,12 +25,91 @@ static_assert(sizeof(bool) == sizeof(uint8_t), "Surely bool is a byte");
 /* Inline implementations in the header use uint32_t versions to manipulate pointers */
 static_assert(sizeof(void *) == sizeof(uint32_t), "Alas, pointers must be 32-bit");
 
+#if defined(MBED_ATOMIC_STATS_ENABLED)
+
+#include <string.h>
+#include "platform/mbed_stats.h"
+
+/* One entry per atomic object, first come first tracked; objects seen once
+ * all entries are taken are not counted. The hooks in the header and the
+ * locked operations below feed this table. */
+static mbed_stats_atomic_t atomic_stats_table[MBED_ATOMIC_STATS_ENTRIES];
+
+static mbed_stats_atomic_t *atomic_stats_entry(const volatile void *object)
+{
+    uint32_t address = (uint32_t)object;
+    int free_slot = -1;
+    for (int i = 0; i < MBED_ATOMIC_STATS_ENTRIES; i++) {
+        if (atomic_stats_table[i].object == address) {
+            return &atomic_stats_table[i];
+        }
+        if (free_slot < 0 && atomic_stats_table[i].object == 0) {
+            free_slot = i;
+        }
+    }
+    if (free_slot < 0) {
+        return NULL;
+    }
+    atomic_stats_table[free_slot].object = address;
+    return &atomic_stats_table[free_slot];
+}
+
+void mbed_atomic_stats_record_retries(const volatile void *object, uint32_t retries)
+{
+    core_util_critical_section_enter();
+    mbed_stats_atomic_t *entry = atomic_stats_entry(object);
+    if (entry) {
+        entry->retries += retries;
+    }
+    core_util_critical_section_exit();
+}
+
+void mbed_atomic_stats_record_fail(const volatile void *object)
+{
+    core_util_critical_section_enter();
+    mbed_stats_atomic_t *entry = atomic_stats_entry(object);
+    if (entry) {
+        entry->cas_failures++;
+    }
+    core_util_critical_section_exit();
+}
+
+/* Called with the critical section already held by the locked operation */
+void mbed_atomic_stats_record_locked(const volatile void *object)
+{
+    mbed_stats_atomic_t *entry = atomic_stats_entry(object);
+    if (entry) {
+        entry->locked_ops++;
+    }
+}
+
+/* Called by mbed_stats_atomic_get_each() in mbed_stats.c */
+size_t mbed_atomic_stats_fetch(mbed_stats_atomic_t *stats, size_t count)
+{
+    size_t i = 0;
+    core_util_critical_section_enter();
+    for (; i < count && i < MBED_ATOMIC_STATS_ENTRIES && atomic_stats_table[i].object != 0; i++) {
+        stats[i] = atomic_stats_table[i];
+    }
+    core_util_critical_section_exit();
+    return i;
+}
+
+#define MBED_ATOMIC_STATS_LOCKED(object) mbed_atomic_stats_record_locked(object)
+
+#else
+
+#define MBED_ATOMIC_STATS_LOCKED(object) (void)0
+
+#endif // MBED_ATOMIC_STATS_ENABLED
+
 
 #define DO_MBED_LOCKED_OP(name, OP, retValue, T, fn_suffix)             \
 T core_util_atomic_##name##_##fn_suffix(volatile T *valuePtr, T arg)    \
 {                                                                       \
     T oldValue, newValue;                                               \
     core_util_critical_section_enter();                                 \
+    MBED_ATOMIC_STATS_LOCKED(valuePtr);                                 \
     oldValue = *valuePtr;                                               \
     newValue = OP;                                                      \
     *valuePtr = newValue;                                               \
@@ -44,6 +123,7 @@ bool core_util_atomic_cas_##fn_suffix(volatile T *ptr, T *expectedCurrentValue,
     bool success;                                                                               \
     T currentValue;                                                                             \
     core_util_critical_section_enter();                                                         \
+    MBED_ATOMIC_STATS_LOCKED(ptr);                                                              \
     currentValue = *ptr;                                                                        \
     if (currentValue == *expectedCurrentValue) {                                                \
         *ptr = desiredValue;                                                                    \
@@ -106,6 +186,7 @@ extern inline bool core_util_atomic_compare_exchange_weak_u32(volatile uint32_t
 bool core_util_atomic_flag_test_and_set(volatile core_util_atomic_flag *flagPtr)
 {
     core_util_critical_section_enter();
+    MBED_ATOMIC_STATS_LOCKED(flagPtr);
     uint8_t currentValue = flagPtr->_flag;
     flagPtr->_flag = true;
     core_util_critical_section_exit();
@@ -25,6 +25,94 @@
 
 static uint32_t critical_section_reentrancy_counter = 0;
 
+#if defined(MBED_CRITICAL_STATS_ENABLED) && defined(DWT) && defined(DWT_CTRL_CYCCNTENA_Msk)
+#define CRITICAL_STATS_AVAILABLE 1
+#else
+#define CRITICAL_STATS_AVAILABLE 0
+#endif
+
+#if defined(MBED_CRITICAL_STATS_ENABLED)
+#include "platform/mbed_stats.h"
+#include "platform/mbed_toolchain.h"
+#endif
+
+#if CRITICAL_STATS_AVAILABLE
+
+static uint8_t dwt_cyccnt_started;
+static uint32_t crit_start_cycles;
+static uint32_t crit_caller;
+static mbed_stats_critical_t crit_table[MBED_CRITICAL_STATS_ENTRIES];
+
+static uint32_t dwt_cyccnt(void)
+{
+    if (!dwt_cyccnt_started) {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+        dwt_cyccnt_started = 1;
+    }
+    return DWT->CYCCNT;
+}
+
+/* Keeps the table sorted longest-first with one entry per call site. Runs
+ * after the window has been timed, with interrupts still masked, so its own
+ * cost is neither counted nor racing against other recordings. */
+static void critical_stats_record(uint32_t caller, uint32_t cycles)
+{
+    int i;
+
+    // A call site already in the table only grows its longest window
+    for (i = 0; i < MBED_CRITICAL_STATS_ENTRIES; i++) {
+        if (crit_table[i].caller == caller) {
+            if (cycles <= crit_table[i].cycles) {
+                return;
+            }
+            crit_table[i].cycles = cycles;
+            break;
+        }
+    }
+
+    if (i == MBED_CRITICAL_STATS_ENTRIES) {
+        // Displace the shortest tracked window; unused entries are zero
+        i = MBED_CRITICAL_STATS_ENTRIES - 1;
+        if (cycles <= crit_table[i].cycles) {
+            return;
+        }
+        crit_table[i].caller = caller;
+        crit_table[i].cycles = cycles;
+    }
+
+    // Bubble the grown entry towards the front to restore the ordering
+    while ((i > 0) && (crit_table[i].cycles > crit_table[i - 1].cycles)) {
+        mbed_stats_critical_t tmp = crit_table[i - 1];
+        crit_table[i - 1] = crit_table[i];
+        crit_table[i] = tmp;
+        i--;
+    }
+}
+
+#endif // CRITICAL_STATS_AVAILABLE
+
+#if defined(MBED_CRITICAL_STATS_ENABLED)
+// Called by mbed_stats_critical_get_each()
+size_t mbed_critical_stats_fetch(mbed_stats_critical_t *stats, size_t count)
+{
+    size_t i = 0;
+#if CRITICAL_STATS_AVAILABLE
+    core_util_critical_section_enter();
+    while ((i < count) && (i < MBED_CRITICAL_STATS_ENTRIES) && (crit_table[i].cycles != 0)) {
+        stats[i] = crit_table[i];
+        i++;
+    }
+    core_util_critical_section_exit();
+#else
+    (void)stats;
+    (void)count;
+#endif
+    return i;
+}
+#endif // MBED_CRITICAL_STATS_ENABLED
+
 bool core_util_are_interrupts_enabled(void)
 {
 #if defined(__CORTEX_A)
@@ -62,6 +150,13 @@ void core_util_critical_section_enter(void)
     // If the reentrancy counter overflows something has gone badly wrong.
     MBED_ASSERT(critical_section_reentrancy_counter < UINT32_MAX);
 
+#if CRITICAL_STATS_AVAILABLE
+    if (critical_section_reentrancy_counter == 0) {
+        crit_caller = (uint32_t)MBED_CALLER_ADDR();
+        crit_start_cycles = dwt_cyccnt();
+    }
+#endif
+
     ++critical_section_reentrancy_counter;
 }
 
@@ -76,6 +171,9 @@ void core_util_critical_section_exit(void)
     --critical_section_reentrancy_counter;
 
     if (critical_section_reentrancy_counter == 0) {
+#if CRITICAL_STATS_AVAILABLE
+        critical_stats_record(crit_caller, dwt_cyccnt() - crit_start_cycles);
+#endif
         hal_critical_section_exit();
     }
 }
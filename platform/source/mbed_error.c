@@ -46,6 +46,18 @@
 #define MAX(a, b) ((a) > (b) ? (a) : (b))
 #endif
 
+/* When set, the fatal error path only stores the binary error context into
+ * the crash data RAM and skips the console error report, deferring all
+ * string formatting to the next boot. This keeps time-in-fault down to the
+ * context capture and makes reboot-to-recovery near immediate. */
+#ifndef MBED_CONF_PLATFORM_ERROR_REPORT_DEFERRED
+#define MBED_CONF_PLATFORM_ERROR_REPORT_DEFERRED 0
+#endif
+
+#if MBED_CONF_PLATFORM_ERROR_REPORT_DEFERRED && !MBED_CONF_PLATFORM_CRASH_CAPTURE_ENABLED
+#error "platform.error-report-deferred requires platform.crash-capture-enabled to preserve the context"
+#endif
+
 #ifndef NDEBUG
 #define ERROR_REPORT(ctx, error_msg, error_filename, error_line) print_error_report(ctx, error_msg, error_filename, error_line)
 static void print_error_report(const mbed_error_ctx *ctx, const char *, const char *error_filename, int error_line);
@@ -96,7 +108,9 @@ WEAK MBED_NORETURN void error(const char *format, ...)
     // Prevent recursion if error is called again during store+print attempt
     if (!core_util_atomic_exchange_bool(&mbed_error_in_progress, true)) {
         handle_error(MBED_ERROR_UNKNOWN, 0, NULL, 0, MBED_CALLER_ADDR());
+#if !MBED_CONF_PLATFORM_ERROR_REPORT_DEFERRED
         ERROR_REPORT(&last_error_ctx, "Fatal Run-time error", NULL, 0);
+#endif
 
 #ifndef NDEBUG
         va_list arg;
@@ -224,6 +238,48 @@ WEAK void mbed_error_reboot_callback(mbed_error_ctx *error_context)
     //Dont do anything here, let application override this if required.
 }
 
+#if MBED_CONF_PLATFORM_ERROR_REPORT_DEFERRED && !defined(NDEBUG)
+//Prints the error context preserved across reboot. Unlike print_error_report
+//this must not follow any pointer captured before the reset - the thread
+//structures it would name are gone - so only the stored values are printed.
+static void print_deferred_error_report(void)
+{
+    const mbed_error_ctx *ctx = &report_error_ctx;
+
+    mbed_error_printf("\n\n++ MbedOS Error Info (captured before reboot) ++\nError Status: 0x%X Code: %d Module: %d",
+                      ctx->error_status, MBED_GET_ERROR_CODE(ctx->error_status), MBED_GET_ERROR_MODULE(ctx->error_status));
+    mbed_error_printf("\nLocation: 0x%" PRIX32 "\nError Value: 0x%" PRIX32 "\nReboot count: %" PRIi32,
+                      ctx->error_address, ctx->error_value, ctx->error_reboot_count);
+#if MBED_CONF_PLATFORM_ERROR_FILENAME_CAPTURE_ENABLED
+    char error_filename[MBED_CONF_PLATFORM_MAX_ERROR_FILENAME_LEN + 1];
+    memcpy(error_filename, ctx->error_filename, MBED_CONF_PLATFORM_MAX_ERROR_FILENAME_LEN);
+    error_filename[MBED_CONF_PLATFORM_MAX_ERROR_FILENAME_LEN] = 0;
+    if (error_filename[0]) {
+        mbed_error_puts("\nFile: ");
+        mbed_error_puts(error_filename);
+        mbed_error_printf("+%" PRIu32, ctx->error_line_number);
+    }
+#endif
+#ifdef MBED_CONF_RTOS_PRESENT
+    mbed_error_printf("\nThread Id: 0x%" PRIX32 " Entry: 0x%" PRIX32 " StackSize: 0x%" PRIX32 " StackMem: 0x%" PRIX32 " SP: 0x%" PRIX32,
+                      ctx->thread_id, ctx->thread_entry_address, ctx->thread_stack_size, ctx->thread_stack_mem, ctx->thread_current_sp);
+#endif
+#ifdef TARGET_CORTEX_M
+    if (mbed_error_is_hw_fault(ctx->error_status)) {
+        //The registers saved by the fault handler live in the crash data
+        //region next to the error context, so they survive the reset too
+        const mbed_fault_context_t *mfc = &MBED_CRASH_DATA.fault.context;
+        mbed_error_printf("\nRegisters (from fault handler):");
+        mbed_error_printf("\nR0: 0x%" PRIX32 " R1: 0x%" PRIX32 " R2: 0x%" PRIX32 " R3: 0x%" PRIX32,
+                          mfc->R0_reg, mfc->R1_reg, mfc->R2_reg, mfc->R3_reg);
+        mbed_error_printf("\nR12: 0x%" PRIX32 " SP: 0x%" PRIX32 " LR: 0x%" PRIX32 " PC: 0x%" PRIX32 " xPSR: 0x%" PRIX32,
+                          mfc->R12_reg, mfc->SP_reg, mfc->LR_reg, mfc->PC_reg, mfc->xPSR);
+    }
+#endif
+    mbed_error_printf("\n-- MbedOS Error Info --\n");
+}
+#endif //MBED_CONF_PLATFORM_ERROR_REPORT_DEFERRED && !defined(NDEBUG)
+
 //Initialize Error handling system and report any errors detected on rebooted
 mbed_error_status_t mbed_error_initialize(void)
 {
@@ -243,6 +299,11 @@ mbed_error_status_t mbed_error_initialize(void)
             //We let the callback reset the error info, so check if its still valid and do the rest only if its still valid.
             if (report_error_ctx.error_reboot_count > 0) {
 
+#if MBED_CONF_PLATFORM_ERROR_REPORT_DEFERRED && !defined(NDEBUG)
+                //The crash path skipped all formatting; report the preserved context now
+                print_deferred_error_report();
+#endif
+
                 report_error_ctx.is_error_processed = 1;//Set the flag that we already processed this error
                 crc_val = mbed_tiny_compute_crc32(&report_error_ctx, offsetof(mbed_error_ctx, crc_error_ctx));
                 report_error_ctx.crc_error_ctx = crc_val;
@@ -301,8 +362,10 @@ WEAK MBED_NORETURN mbed_error_status_t mbed_error(mbed_error_status_t error_stat
         //set the error reported
         (void) handle_error(error_status, error_value, filename, line_number, MBED_CALLER_ADDR());
 
+#if !MBED_CONF_PLATFORM_ERROR_REPORT_DEFERRED
         //On fatal errors print the error context/report
         ERROR_REPORT(&last_error_ctx, error_msg, filename, line_number);
+#endif
     }
 
 #if MBED_CONF_PLATFORM_CRASH_CAPTURE_ENABLED
@@ -0,0 +1,117 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "platform/mbed_lp_drift.h"
+#include "platform/mbed_atomic.h"
+#include "platform/mbed_critical.h"
+
+#if DEVICE_LPTICKER
+
+#include "hal/ticker_api.h"
+#include "hal/lp_ticker_api.h"
+#if DEVICE_USTICKER
+#include "hal/us_ticker_api.h"
+#endif
+
+/* Measurement windows shorter than this would be dominated by the
+ * quantization of the 32kHz ticks (one tick is ~31us, so over 1s a single
+ * tick of jitter is ~31ppm - comparable to what we measure; the filter
+ * averages the remainder out). */
+#define DRIFT_MIN_WINDOW_US 1000000ULL
+
+/* Modelled error in parts per billion; written atomically so SysTimer can
+ * read it from interrupt context. */
+static volatile int32_t lp_drift_ppb;
+
+#if DEVICE_USTICKER
+static bool lp_drift_baseline_valid;
+static us_timestamp_t lp_drift_lp_base;
+static us_timestamp_t lp_drift_us_base;
+#endif
+
+void mbed_lp_drift_sample(void)
+{
+#if DEVICE_USTICKER
+    /* Read the two tickers as close together as interrupts allow; the
+     * pairing error is constant-ish and mostly cancels across the window. */
+    core_util_critical_section_enter();
+    us_timestamp_t lp_now = ticker_read_us(get_lp_ticker_data());
+    us_timestamp_t us_now = ticker_read_us(get_us_ticker_data());
+    core_util_critical_section_exit();
+
+    if (!lp_drift_baseline_valid) {
+        lp_drift_baseline_valid = true;
+        lp_drift_lp_base = lp_now;
+        lp_drift_us_base = us_now;
+        return;
+    }
+
+    us_timestamp_t us_window = us_now - lp_drift_us_base;
+    if (us_window < DRIFT_MIN_WINDOW_US) {
+        return;
+    }
+
+    int64_t diff = (int64_t)(lp_now - lp_drift_lp_base) - (int64_t)us_window;
+    int32_t sample_ppb = (int32_t)(diff * 1000000000 / (int64_t)us_window);
+
+    /* Single-pole filter, 1/4 new sample: settles in a few samples but
+     * smooths the per-window quantization jitter. */
+    int32_t old = lp_drift_ppb;
+    core_util_atomic_store_s32(&lp_drift_ppb, old + (sample_ppb - old) / 4);
+
+    lp_drift_lp_base = lp_now;
+    lp_drift_us_base = us_now;
+#endif
+}
+
+void mbed_lp_drift_set_ppb(int32_t ppb)
+{
+    core_util_atomic_store_s32(&lp_drift_ppb, ppb);
+}
+
+int32_t mbed_lp_drift_get_ppb(void)
+{
+    return core_util_atomic_load_s32(&lp_drift_ppb);
+}
+
+int32_t mbed_lp_drift_get_ppm(void)
+{
+    return mbed_lp_drift_get_ppb() / 1000;
+}
+
+#else /* DEVICE_LPTICKER */
+
+void mbed_lp_drift_sample(void)
+{
+}
+
+void mbed_lp_drift_set_ppb(int32_t ppb)
+{
+    (void)ppb;
+}
+
+int32_t mbed_lp_drift_get_ppb(void)
+{
+    return 0;
+}
+
+int32_t mbed_lp_drift_get_ppm(void)
+{
+    return 0;
+}
+
+#endif /* DEVICE_LPTICKER */
@@ -37,6 +37,65 @@ static SingletonPtr<PlatformMutex> mem_trace_mutex;
 
 #define TRACE_FIRST_LOCK() (trace_lock_count < 2)
 
+/* State of the binary ring tracer. All of it is written inside the trace
+ * lock: the recording callback runs under mbed_mem_trace_lock() taken by the
+ * allocation wrappers, and the drain/setup functions take it themselves. */
+static mbed_mem_trace_record_t *ring_records;
+static size_t ring_size;
+/* Index of the next record to write; the oldest record is at
+ * (ring_head + ring_size - ring_count) % ring_size. */
+static size_t ring_head;
+static size_t ring_count;
+static size_t ring_dropped;
+static uint32_t ring_sample_rate;
+static uint32_t ring_sample_countdown;
+
+static void mbed_mem_trace_ring_callback(uint8_t op, void *res, void *caller, ...)
+{
+    va_list va;
+    void *ptr = res;
+    uint32_t size = 0;
+
+    va_start(va, caller);
+    switch (op) {
+        case MBED_MEM_TRACE_MALLOC:
+            size = va_arg(va, size_t);
+            break;
+
+        case MBED_MEM_TRACE_REALLOC:
+            (void) va_arg(va, void *);
+            size = va_arg(va, size_t);
+            break;
+
+        case MBED_MEM_TRACE_CALLOC:
+            size = va_arg(va, size_t);
+            size *= va_arg(va, size_t);
+            break;
+
+        case MBED_MEM_TRACE_FREE:
+            ptr = va_arg(va, void *);
+            break;
+    }
+    va_end(va);
+
+    if (--ring_sample_countdown > 0) {
+        return;
+    }
+    ring_sample_countdown = ring_sample_rate;
+
+    mbed_mem_trace_record_t *rec = &ring_records[ring_head];
+    rec->caller = caller;
+    rec->ptr = ptr;
+    rec->size = size;
+    rec->op = op;
+    ring_head = (ring_head + 1) % ring_size;
+    if (ring_count == ring_size) {
+        ring_dropped++;
+    } else {
+        ring_count++;
+    }
+}
+
 
 /******************************************************************************
  * Public interface
@@ -151,3 +210,48 @@ void mbed_mem_trace_default_callback(uint8_t op, void *res, void *caller, ...)
     }
     va_end(va);
 }
+
+int mbed_mem_trace_ring_setup(mbed_mem_trace_record_t *records, size_t count, uint32_t sample_rate)
+{
+    if (records == NULL || count == 0 || sample_rate == 0) {
+        return -1;
+    }
+    mbed_mem_trace_lock();
+    ring_records = records;
+    ring_size = count;
+    ring_head = 0;
+    ring_count = 0;
+    ring_dropped = 0;
+    ring_sample_rate = sample_rate;
+    ring_sample_countdown = sample_rate;
+    mbed_mem_trace_unlock();
+    mbed_mem_trace_set_callback(mbed_mem_trace_ring_callback);
+    return 0;
+}
+
+void mbed_mem_trace_ring_stop(void)
+{
+    if (mem_trace_cb == mbed_mem_trace_ring_callback) {
+        mbed_mem_trace_set_callback(NULL);
+    }
+}
+
+size_t mbed_mem_trace_ring_drain(mbed_mem_trace_record_t *dest, size_t max_count)
+{
+    size_t drained = 0;
+
+    mbed_mem_trace_lock();
+    while (drained < max_count && ring_count > 0) {
+        size_t tail = (ring_head + ring_size - ring_count) % ring_size;
+        dest[drained++] = ring_records[tail];
+        ring_count--;
+    }
+    mbed_mem_trace_unlock();
+
+    return drained;
+}
+
+size_t mbed_mem_trace_ring_dropped(void)
+{
+    return ring_dropped;
+}
@@ -0,0 +1,242 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "platform/mbed_perf_counters.h"
+
+#if defined(MBED_PERF_COUNTERS_ENABLED)
+
+#include <string.h>
+
+#include "cmsis.h"
+#include "platform/mbed_critical.h"
+
+#if defined(DWT) && defined(DWT_CTRL_CYCCNTENA_Msk)
+#define PERF_COUNTERS_AVAILABLE 1
+#else
+#define PERF_COUNTERS_AVAILABLE 0
+#endif
+
+#if PERF_COUNTERS_AVAILABLE
+
+/* On Armv8.1-M the auxiliary event goes onto a 16-bit PMU event counter;
+ * elsewhere it maps to the matching 8-bit DWT profiling counter. */
+#if defined(__PMU_PRESENT) && (__PMU_PRESENT == 1U) && defined(ARM_PMU_INST_RETIRED)
+#define PERF_AUX_PMU 1
+#define PERF_AUX_MASK 0xFFFFu
+#else
+#define PERF_AUX_PMU 0
+#define PERF_AUX_MASK 0xFFu
+#endif
+
+static mbed_stats_perf_t perf_slots[MBED_PERF_STATS_SLOTS];
+static int perf_slot_cnt;
+static mbed_perf_event_t perf_aux_event = MBED_PERF_EVENT_NONE;
+static uint8_t perf_started;
+
+static void perf_start_counters(void)
+{
+    if (perf_started) {
+        return;
+    }
+    /* A cycle counter that is already running (boot stats, a debugger) is
+     * left alone so its time base is not disturbed. */
+    if (!(DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk)) {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+#if PERF_AUX_PMU
+    ARM_PMU_Enable();
+#endif
+    perf_started = 1;
+}
+
+static uint32_t perf_read_aux(void)
+{
+#if PERF_AUX_PMU
+    return ARM_PMU_Get_EVCNTR(0);
+#else
+    switch (perf_aux_event) {
+        case MBED_PERF_EVENT_INST:
+            return DWT->CPICNT;
+        case MBED_PERF_EVENT_EXC:
+            return DWT->EXCCNT;
+        case MBED_PERF_EVENT_SLEEP:
+            return DWT->SLEEPCNT;
+        case MBED_PERF_EVENT_LSU:
+            return DWT->LSUCNT;
+        case MBED_PERF_EVENT_FOLD:
+            return DWT->FOLDCNT;
+        default:
+            return 0;
+    }
+#endif
+}
+
+int mbed_perf_slot(const char *name)
+{
+    core_util_critical_section_enter();
+    perf_start_counters();
+    int index = -1;
+    for (int i = 0; i < perf_slot_cnt; i++) {
+        if (perf_slots[i].name == name || strcmp(perf_slots[i].name, name) == 0) {
+            index = i;
+            break;
+        }
+    }
+    if (index < 0 && perf_slot_cnt < MBED_PERF_STATS_SLOTS) {
+        index = perf_slot_cnt;
+        perf_slots[index].name = name;
+        perf_slot_cnt = index + 1;
+    }
+    core_util_critical_section_exit();
+    return index;
+}
+
+int mbed_perf_event_select(mbed_perf_event_t event)
+{
+    int ret = 0;
+    core_util_critical_section_enter();
+    perf_start_counters();
+#if PERF_AUX_PMU
+    uint32_t pmu_event;
+    switch (event) {
+        case MBED_PERF_EVENT_NONE:
+            pmu_event = ARM_PMU_SW_INCR;
+            break;
+        case MBED_PERF_EVENT_INST:
+            pmu_event = ARM_PMU_INST_RETIRED;
+            break;
+        case MBED_PERF_EVENT_EXC:
+            pmu_event = ARM_PMU_EXC_TAKEN;
+            break;
+        case MBED_PERF_EVENT_LSU:
+            pmu_event = ARM_PMU_MEM_ACCESS;
+            break;
+        default:
+            /* sleep and folded-instruction counts have no PMU equivalent */
+            ret = -1;
+            break;
+    }
+    if (ret == 0) {
+        ARM_PMU_CNTR_Disable(PMU_CNTENCLR_CNT0_ENABLE_Msk);
+        ARM_PMU_Set_EVTYPER(0, pmu_event);
+        ARM_PMU_EVCNTR_ALL_Reset();
+        ARM_PMU_CNTR_Enable(PMU_CNTENSET_CNT0_ENABLE_Msk);
+        perf_aux_event = event;
+    }
+#else
+    /* The DWT profiling counters each count a fixed event; selection just
+     * decides which one scopes sample. Enable them all once. */
+    DWT->CTRL |= DWT_CTRL_CPIEVTENA_Msk | DWT_CTRL_EXCEVTENA_Msk |
+                 DWT_CTRL_SLEEPEVTENA_Msk | DWT_CTRL_LSUEVTENA_Msk |
+                 DWT_CTRL_FOLDEVTENA_Msk;
+    if (DWT->CTRL & DWT_CTRL_NOPRFCNT_Msk) {
+        /* this implementation has no profiling counters */
+        ret = (event == MBED_PERF_EVENT_NONE) ? 0 : -1;
+    } else {
+        perf_aux_event = event;
+    }
+#endif
+    core_util_critical_section_exit();
+    return ret;
+}
+
+void mbed_perf_begin(mbed_perf_sample_t *sample)
+{
+    perf_start_counters();
+    sample->events = perf_read_aux();
+    /* cycles are sampled last on entry and first on exit so the aux read
+     * is not counted against the scope */
+    sample->cycles = DWT->CYCCNT;
+}
+
+void mbed_perf_end(int slot, const mbed_perf_sample_t *sample)
+{
+    uint32_t cycles = DWT->CYCCNT - sample->cycles;
+    uint32_t events = (perf_read_aux() - sample->events) & PERF_AUX_MASK;
+
+    if (slot < 0 || slot >= MBED_PERF_STATS_SLOTS) {
+        return;
+    }
+    core_util_critical_section_enter();
+    perf_slots[slot].hits++;
+    perf_slots[slot].cycles += cycles;
+    perf_slots[slot].events += events;
+    core_util_critical_section_exit();
+}
+
+void mbed_perf_reset(void)
+{
+    core_util_critical_section_enter();
+    memset(perf_slots, 0, sizeof(perf_slots));
+    perf_slot_cnt = 0;
+    core_util_critical_section_exit();
+}
+
+/* Called by mbed_stats_perf_get_each() in mbed_stats.c */
+size_t mbed_perf_stats_fetch(mbed_stats_perf_t *stats, size_t count)
+{
+    core_util_critical_section_enter();
+    if (count > (size_t)perf_slot_cnt) {
+        count = perf_slot_cnt;
+    }
+    memcpy(stats, perf_slots, count * sizeof(mbed_stats_perf_t));
+    core_util_critical_section_exit();
+    return count;
+}
+
+#else // PERF_COUNTERS_AVAILABLE
+
+int mbed_perf_slot(const char *name)
+{
+    (void)name;
+    return -1;
+}
+
+int mbed_perf_event_select(mbed_perf_event_t event)
+{
+    (void)event;
+    return -1;
+}
+
+void mbed_perf_begin(mbed_perf_sample_t *sample)
+{
+    sample->cycles = 0;
+    sample->events = 0;
+}
+
+void mbed_perf_end(int slot, const mbed_perf_sample_t *sample)
+{
+    (void)slot;
+    (void)sample;
+}
+
+void mbed_perf_reset(void)
+{
+}
+
+size_t mbed_perf_stats_fetch(mbed_stats_perf_t *stats, size_t count)
+{
+    (void)stats;
+    (void)count;
+    return 0;
+}
+
+#endif // PERF_COUNTERS_AVAILABLE
+
+#endif // MBED_PERF_COUNTERS_ENABLED
@@ -17,28 +17,51 @@
 #include "mbed_poll.h"
 #include "FileHandle.h"
 #include "mbed_thread.h"
+#include "rtos/EventFlags.h"
 
 namespace mbed {
 
+#define POLL_WAKEUP_FLAG 0x1
+
+static void poll_wakeup(rtos::EventFlags *flags)
+{
+    flags->set(POLL_WAKEUP_FLAG);
+}
+
 // timeout -1 forever, or milliseconds
 int poll(pollfh fhs[], unsigned nfhs, int timeout)
 {
     /*
-     * TODO Proper wake-up mechanism.
-     * In order to correctly detect availability of read/write a FileHandle, we needed
-     * a select or poll mechanisms. We opted for poll as POSIX defines in
-     * http://pubs.opengroup.org/onlinepubs/009695399/functions/poll.html Currently,
-     * mbed::poll() just spins and scans filehandles looking for any events we are
-     * interested in. In future, his spinning behaviour will be replaced with
-     * condition variables.
+     * We have no way to ask a FileHandle to report just the events a caller
+     * is interested in, but every FileHandle signals state changes through
+     * sigio(). So rather than spinning on poll(), register a wakeup on each
+     * handle's sigio and block on an EventFlags between scans - wakeups are
+     * then bound by interrupt latency rather than by a tick.
+     *
+     * sigio() is documented as a building block for poll-like functionality;
+     * any callback the caller had attached is displaced for the duration of
+     * this call and detached on return.
      */
     uint64_t start_time = 0;
     if (timeout > 0) {
         start_time = get_ms_count();
     }
 
+    rtos::EventFlags flags;
+    if (timeout != 0) {
+        for (unsigned n = 0; n < nfhs; n++) {
+            if (fhs[n].fh) {
+                fhs[n].fh->sigio(callback(poll_wakeup, &flags));
+            }
+        }
+    }
+
     int count = 0;
     for (;;) {
+        /* Clear before the scan: an event signalled mid-scan must make the
+         * subsequent wait return immediately rather than be lost. */
+        flags.clear(POLL_WAKEUP_FLAG);
+
         /* Scan the file handles */
         for (unsigned n = 0; n < nfhs; n++) {
             FileHandle *fh = fhs[n].fh;
@@ -57,13 +80,26 @@ int poll(pollfh fhs[], unsigned nfhs, int timeout)
             break;
         }
 
-        /* Nothing selected - this is where timeout handling would be needed */
-        if (timeout == 0 || (timeout > 0 && int64_t(get_ms_count() - start_time) > timeout)) {
+        /* Nothing selected - wait for a sigio wakeup or the deadline */
+        if (timeout == 0) {
             break;
+        } else if (timeout > 0) {
+            int64_t remaining = timeout - int64_t(get_ms_count() - start_time);
+            if (remaining <= 0) {
+                break;
+            }
+            flags.wait_any_for(POLL_WAKEUP_FLAG, rtos::Kernel::Clock::duration_u32(static_cast<uint32_t>(remaining)));
+        } else {
+            flags.wait_any(POLL_WAKEUP_FLAG);
+        }
+    }
+
+    if (timeout != 0) {
+        for (unsigned n = 0; n < nfhs; n++) {
+            if (fhs[n].fh) {
+                fhs[n].fh->sigio(nullptr);
+            }
         }
-        // TODO - proper blocking
-        // wait for condition variable, wait queue whatever here
-        thread_sleep_for(1);
     }
     return count;
 }
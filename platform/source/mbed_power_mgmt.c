@@ -23,6 +23,9 @@
 #include "platform/mbed_stats.h"
 
 #include "hal/sleep_api.h"
+#if defined(MBED_SLEEP_STATS_ENABLED)
+#include "cmsis.h"
+#endif
 #include "hal/us_ticker_api.h"
 #include "hal/lp_ticker_api.h"
 #include "platform/mbed_wait_api.h"
@@ -33,16 +36,41 @@
 
 // deep sleep locking counter. A target is allowed to deep sleep if counter == 0
 static uint16_t deep_sleep_lock = 0U;
+
+// registered wake latency budgets - the tightest one must fit the target's
+// deep sleep wake latency for deep sleep to be selected
+static sleep_manager_latency_budget_t *latency_budgets = NULL;
+
+// the target's documented deep sleep wake latency, in ms
+#ifndef MBED_CONF_TARGET_DEEP_SLEEP_LATENCY
+#define MBED_CONF_TARGET_DEEP_SLEEP_LATENCY 0
+#endif
+
+// both the CPU statistics and the sleep statistics need sleeps timestamped
+#if (defined(MBED_CPU_STATS_ENABLED) || defined(MBED_SLEEP_STATS_ENABLED)) && DEVICE_LPTICKER
+#define SLEEP_TIME_TRACKED 1
+#else
+#define SLEEP_TIME_TRACKED 0
+#endif
+
+#if defined(MBED_SLEEP_STATS_ENABLED) && DEVICE_LPTICKER
+#define SLEEP_STATS_AVAILABLE 1
+#else
+#define SLEEP_STATS_AVAILABLE 0
+#endif
+
 #if defined(MBED_CPU_STATS_ENABLED) && DEVICE_LPTICKER
 static us_timestamp_t sleep_time = 0;
 static us_timestamp_t deep_sleep_time = 0;
+#endif
 
+#if SLEEP_TIME_TRACKED
 static const ticker_data_t *sleep_ticker = NULL;
 #endif
 
 static inline us_timestamp_t read_us(void)
 {
-#if defined(MBED_CPU_STATS_ENABLED) && DEVICE_LPTICKER
+#if SLEEP_TIME_TRACKED
     if (NULL == sleep_ticker) {
         sleep_ticker = get_lp_ticker_data();
     }
@@ -184,6 +212,91 @@ void sleep_tracker_unlock(const char *const filename, int line)
 
 #endif // MBED_SLEEP_TRACING_ENABLED
 
+#if SLEEP_STATS_AVAILABLE
+
+// [0] shallow sleep, [1] deep sleep; updated inside the sleep critical section
+static mbed_stats_sleep_mode_t sleep_mode_stats[2];
+static int16_t last_wake_irqn = MBED_SLEEP_STATS_WAKE_UNKNOWN;
+static mbed_stats_wake_source_t wake_sources[MBED_SLEEP_STATS_WAKE_SOURCES];
+static uint32_t wake_source_cnt = 0;
+
+static int16_t sleep_stats_pending_irqn(void)
+{
+#if defined(SCB_ICSR_VECTPENDING_Msk)
+    // interrupts are still masked, so the interrupt that ended the sleep is
+    // pending rather than active; VECTPENDING names the highest-priority one
+    uint32_t vect = (SCB->ICSR & SCB_ICSR_VECTPENDING_Msk) >> SCB_ICSR_VECTPENDING_Pos;
+    if (vect != 0) {
+        return (int16_t)vect - 16;
+    }
+#endif
+    return MBED_SLEEP_STATS_WAKE_UNKNOWN;
+}
+
+static void sleep_stats_update(bool deep, us_timestamp_t start, us_timestamp_t end,
+                               bool have_wake, us_timestamp_t scheduled_wake)
+{
+    mbed_stats_sleep_mode_t *mode = &sleep_mode_stats[deep ? 1 : 0];
+
+    mode->entry_cnt++;
+    mode->time += end - start;
+
+    /* Wake latency can only be attributed when the wake event's time is
+     * known - the low-power ticker match that was scheduled before sleeping.
+     * Resuming at or after the scheduled time means the match fired and
+     * everything past it is hardware wake-up plus clock restore; an earlier
+     * resume came from some other interrupt and has no reference point. */
+    if (have_wake && end >= scheduled_wake && start < scheduled_wake) {
+        us_timestamp_t latency = end - scheduled_wake;
+        mode->wake_latency_cnt++;
+        mode->wake_latency += latency;
+        if (latency > mode->wake_latency_max) {
+            mode->wake_latency_max = (uint32_t)latency;
+        }
+    }
+
+    int16_t irqn = sleep_stats_pending_irqn();
+    last_wake_irqn = irqn;
+    if (irqn == MBED_SLEEP_STATS_WAKE_UNKNOWN) {
+        return;
+    }
+    for (uint32_t i = 0; i < wake_source_cnt; ++i) {
+        if (wake_sources[i].irqn == irqn) {
+            wake_sources[i].count++;
+            return;
+        }
+    }
+    if (wake_source_cnt < MBED_SLEEP_STATS_WAKE_SOURCES) {
+        wake_sources[wake_source_cnt].irqn = irqn;
+        wake_sources[wake_source_cnt].count = 1;
+        wake_source_cnt++;
+    }
+}
+
+// called from mbed_stats_sleep_get in mbed_stats.c
+void mbed_sleep_stats_fetch(mbed_stats_sleep_t *stats)
+{
+    core_util_critical_section_enter();
+    stats->sleep = sleep_mode_stats[0];
+    stats->deep_sleep = sleep_mode_stats[1];
+    stats->last_wake_irqn = last_wake_irqn;
+    core_util_critical_section_exit();
+}
+
+// called from mbed_stats_sleep_wake_get_each in mbed_stats.c
+size_t mbed_sleep_wake_stats_fetch(mbed_stats_wake_source_t *stats, size_t count)
+{
+    core_util_critical_section_enter();
+    size_t filled = wake_source_cnt < count ? wake_source_cnt : count;
+    for (size_t i = 0; i < filled; ++i) {
+        stats[i] = wake_sources[i];
+    }
+    core_util_critical_section_exit();
+    return filled;
+}
+
+#endif // SLEEP_STATS_AVAILABLE
+
 void sleep_manager_lock_deep_sleep_internal(void)
 {
     if (core_util_atomic_incr_u16(&deep_sleep_lock, 1) == 0) {
@@ -198,9 +311,47 @@ void sleep_manager_unlock_deep_sleep_internal(void)
     }
 }
 
+void sleep_manager_register_latency_budget(sleep_manager_latency_budget_t *budget)
+{
+    core_util_critical_section_enter();
+    budget->next = latency_budgets;
+    latency_budgets = budget;
+    core_util_critical_section_exit();
+}
+
+void sleep_manager_deregister_latency_budget(sleep_manager_latency_budget_t *budget)
+{
+    core_util_critical_section_enter();
+    for (sleep_manager_latency_budget_t **p = &latency_budgets; *p != NULL; p = &(*p)->next) {
+        if (*p == budget) {
+            *p = budget->next;
+            break;
+        }
+    }
+    core_util_critical_section_exit();
+}
+
+uint32_t sleep_manager_get_latency_budget(void)
+{
+    uint32_t budget = UINT32_MAX;
+    core_util_critical_section_enter();
+    for (const sleep_manager_latency_budget_t *p = latency_budgets; p != NULL; p = p->next) {
+        if (p->latency_us < budget) {
+            budget = p->latency_us;
+        }
+    }
+    core_util_critical_section_exit();
+    return budget;
+}
+
 bool sleep_manager_can_deep_sleep(void)
 {
-    return core_util_atomic_load_u16(&deep_sleep_lock) == 0;
+    if (core_util_atomic_load_u16(&deep_sleep_lock) != 0) {
+        return false;
+    }
+    // waking from deep sleep must also be fast enough for every
+    // registered latency budget
+    return (uint64_t)MBED_CONF_TARGET_DEEP_SLEEP_LATENCY * 1000 <= sleep_manager_get_latency_budget();
 }
 
 bool sleep_manager_can_deep_sleep_test_check()
@@ -224,17 +375,22 @@ void sleep_manager_sleep_auto(void)
     sleep_tracker_print_stats();
 #endif
     core_util_critical_section_enter();
-#if defined(MBED_CPU_STATS_ENABLED) && DEVICE_LPTICKER
+#if SLEEP_TIME_TRACKED
     us_timestamp_t start = read_us();
     bool deep = false;
 #endif
+#if SLEEP_STATS_AVAILABLE
+    // the event this sleep is expected to end on, for wake latency
+    us_timestamp_t scheduled_wake = 0;
+    bool have_wake = ticker_get_next_timestamp_us(get_lp_ticker_data(), &scheduled_wake) != 0;
+#endif
 
 // debug profile should keep debuggers attached, no deep sleep allowed
 #ifdef MBED_DEBUG
     hal_sleep();
 #else
     if (sleep_manager_can_deep_sleep()) {
-#if defined(MBED_CPU_STATS_ENABLED) && DEVICE_LPTICKER
+#if SLEEP_TIME_TRACKED
         deep = true;
 #endif
         hal_deepsleep();
@@ -243,13 +399,18 @@ void sleep_manager_sleep_auto(void)
     }
 #endif
 
-#if defined(MBED_CPU_STATS_ENABLED) && DEVICE_LPTICKER
+#if SLEEP_TIME_TRACKED
     us_timestamp_t end = read_us();
+#if defined(MBED_CPU_STATS_ENABLED)
     if (true == deep) {
         deep_sleep_time += end - start;
     } else {
         sleep_time += end - start;
     }
+#endif
+#if SLEEP_STATS_AVAILABLE
+    sleep_stats_update(deep, start, end, have_wake, scheduled_wake);
+#endif
 #endif
     core_util_critical_section_exit();
 }
@@ -269,6 +430,21 @@ void sleep_manager_unlock_deep_sleep_internal(void)
 
 }
 
+void sleep_manager_register_latency_budget(sleep_manager_latency_budget_t *budget)
+{
+    (void)budget;
+}
+
+void sleep_manager_deregister_latency_budget(sleep_manager_latency_budget_t *budget)
+{
+    (void)budget;
+}
+
+uint32_t sleep_manager_get_latency_budget(void)
+{
+    return UINT32_MAX;
+}
+
 bool sleep_manager_can_deep_sleep(void)
 {
     // no sleep implemented
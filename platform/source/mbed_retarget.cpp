@@ -43,6 +43,7 @@
 #include <stdio.h>
 #include <errno.h>
 #include "platform/mbed_retarget.h"
+#include "platform/BufferedFileHandle.h"
 
 static SingletonPtr<PlatformMutex> _mutex;
 
@@ -85,6 +86,13 @@ asm(" .global __use_full_stdio\n");
 
 #define FILE_HANDLE_RESERVED    ((FileHandle*)0xFFFFFFFF)
 
+/* When non-zero, files opened through open() are wrapped in a
+ * BufferedFileHandle with a write buffer of this many bytes, so small
+ * sequential writes coalesce into block-sized filesystem operations. */
+#ifndef MBED_CONF_PLATFORM_RETARGET_WRITE_BUFFER_SIZE
+#define MBED_CONF_PLATFORM_RETARGET_WRITE_BUFFER_SIZE 0
+#endif
+
 /**
  * Macros for setting console flow control.
  */
@@ -133,7 +141,7 @@ void remove_filehandle(FileHandle *file)
     /* Remove all open filehandles for this */
     for (unsigned int fh_i = 0; fh_i < sizeof(filehandles) / sizeof(*filehandles); fh_i++) {
         if (filehandles[fh_i] == file) {
-            filehandles[fh_i] = NULL;
+            core_util_atomic_store(&filehandles[fh_i], static_cast<FileHandle *>(NULL));
         }
     }
     filehandle_mutex->unlock();
@@ -380,9 +388,13 @@ FileHandle *mbed_file_handle(int fd)
     if (fd >= RETARGET_OPEN_MAX) {
         return NULL;
     }
-    FileHandle *fh = filehandles[fd];
+    /* Lock-free fast path: slots are published with atomic stores, so a
+     * plain atomic load suffices and read/write never contend on
+     * filehandle_mutex. */
+    FileHandle *fh = core_util_atomic_load(&filehandles[fd]);
     if (fh == FILE_HANDLE_RESERVED && fd < 3) {
-        filehandles[fd] = fh = get_console(fd);
+        fh = get_console(fd);
+        core_util_atomic_store(&filehandles[fd], fh);
     }
     return fh;
 #else
@@ -404,7 +416,7 @@ static int handle_open_errors(int error, unsigned filehandle_idx)
 {
     errno = -error;
     // Free file handle
-    filehandles[filehandle_idx] = NULL;
+    core_util_atomic_store(&filehandles[filehandle_idx], static_cast<FileHandle *>(NULL));
     return -1;
 }
 
@@ -487,9 +499,9 @@ int mbed::bind_to_fd(FileHandle *fh)
         return fildes;
     }
 
-    filehandles[fildes] = fh;
     stdio_in_prev[fildes] = 0;
     stdio_out_prev[fildes] = 0;
+    core_util_atomic_store(&filehandles[fildes], fh);
 
     return fildes;
 }
@@ -497,7 +509,7 @@ int mbed::bind_to_fd(FileHandle *fh)
 static int unbind_from_fd(int fd, FileHandle *fh)
 {
     if (filehandles[fd] == fh) {
-        filehandles[fd] = NULL;
+        core_util_atomic_store(&filehandles[fd], static_cast<FileHandle *>(NULL));
         return 0;
     } else {
         errno = EBADF;
@@ -602,6 +614,26 @@ extern "C" FILEHANDLE PREFIX(_open)(const char *name, int openflags)
 }
 
 #if !MBED_CONF_PLATFORM_STDIO_MINIMAL_CONSOLE_ONLY
+#if MBED_CONF_PLATFORM_RETARGET_WRITE_BUFFER_SIZE > 0
+/* Wrapper whose lifetime follows the fd, mirroring the Managed handles
+ * returned by FileSystem::open. The wrapped handle frees itself in its own
+ * close(), which BufferedFileHandle::close() forwards to after flushing. */
+class ManagedBufferedFileHandle : public BufferedFileHandle {
+public:
+    ManagedBufferedFileHandle(FileHandle *fh) :
+        BufferedFileHandle(fh, MBED_CONF_PLATFORM_RETARGET_WRITE_BUFFER_SIZE)
+    {
+    }
+
+    virtual int close()
+    {
+        int err = BufferedFileHandle::close();
+        delete this;
+        return err;
+    }
+};
+#endif
+
 extern "C" int open(const char *name, int oflag, ...)
 {
     int fildes = reserve_filehandle();
@@ -630,11 +662,14 @@ extern "C" int open(const char *name, int oflag, ...)
         if (err) {
             return handle_open_errors(err, fildes);
         }
+#if MBED_CONF_PLATFORM_RETARGET_WRITE_BUFFER_SIZE > 0
+        res = new ManagedBufferedFileHandle(res);
+#endif
     }
 
-    filehandles[fildes] = res;
     stdio_in_prev[fildes] = 0;
     stdio_out_prev[fildes] = 0;
+    core_util_atomic_store(&filehandles[fildes], res);
 
     return fildes;
 }
@@ -653,7 +688,7 @@ extern "C" int PREFIX(_close)(FILEHANDLE fh)
 extern "C" int close(int fildes)
 {
     FileHandle *fhc = mbed_file_handle(fildes);
-    filehandles[fildes] = NULL;
+    core_util_atomic_store(&filehandles[fildes], static_cast<FileHandle *>(NULL));
     if (fhc == NULL) {
         errno = EBADF;
         return -1;
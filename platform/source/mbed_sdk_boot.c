@@ -20,6 +20,7 @@
 #include <stdint.h>
 #include "cmsis.h"
 #include "hal/us_ticker_api.h"
+#include "platform/mbed_stats.h"
 
 /* This startup is for baremetal. There is no RTOS in baremetal,
  * therefore we protect this file with MBED_CONF_RTOS_PRESENT.
@@ -77,6 +78,9 @@ void mbed_copy_nvic(void)
 
 void mbed_init(void)
 {
+    // By the time execution reaches here SystemInit has run and the C
+    // runtime has initialized RAM
+    mbed_stats_boot_stage("ram init");
 #ifdef MBED_DEBUG
     // Configs to make debugging easier
 #ifdef SCnSCB_ACTLR_DISDEFWBUF_Msk
@@ -89,6 +93,7 @@ void mbed_init(void)
 #endif
     mbed_copy_nvic();
     mbed_sdk_init();
+    mbed_stats_boot_stage("sdk init");
 #if DEVICE_USTICKER && MBED_CONF_TARGET_INIT_US_TICKER_AT_BOOT
     us_ticker_init();
 #endif
@@ -137,8 +142,10 @@ int $Sub$$main(void)
     _platform_post_stackheap_init();
 #endif
     mbed_toolchain_init();
+    mbed_stats_boot_stage("ctor chain");
     mbed_main();
     mbed_error_initialize();
+    mbed_stats_boot_stage("pre-main");
     return $Super$$main();
 }
 
@@ -172,8 +179,11 @@ void software_init_hook(void)
 
 int __wrap_main(void)
 {
+    // The C library has run the C++ global object constructors by now
+    mbed_stats_boot_stage("ctor chain");
     mbed_main();
     mbed_error_initialize();
+    mbed_stats_boot_stage("pre-main");
     return __real_main();
 }
 
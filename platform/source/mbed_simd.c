@@ -0,0 +1,207 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "platform/mbed_simd.h"
+
+#include <string.h>
+
+#if defined(__ARM_FEATURE_MVE) && (__ARM_FEATURE_MVE & 1)
+#include <arm_mve.h>
+#define SIMD_HAVE_MVE 1
+#else
+#define SIMD_HAVE_MVE 0
+#endif
+
+/* Fold a 32-bit accumulator into a 16-bit one's-complement sum */
+static uint16_t fold_sum(uint32_t sum)
+{
+    sum = (sum & 0xffff) + (sum >> 16);
+    sum = (sum & 0xffff) + (sum >> 16);
+    return (uint16_t)sum;
+}
+
+uint16_t mbed_simd_sum16(const void *data, size_t len)
+{
+    const uint8_t *p = data;
+    uint32_t sum = 0;
+    int swapped = 0;
+
+    /* An odd start address is handled as in lwIP: the first byte goes in at
+     * the high position and the final sum is byte-swapped back, which makes
+     * the result independent of alignment. */
+    if (((uintptr_t)p & 1) && (len > 0)) {
+        sum = (uint32_t)*p++ << 8;
+        len--;
+        swapped = 1;
+    }
+
+#if SIMD_HAVE_MVE
+    while (len >= 16) {
+        uint16x8_t v = vld1q_u16((const uint16_t *)p);
+        sum += vaddvq_u16(v);
+        /* Fold each iteration - eight halfwords cannot overflow a freshly
+         * folded 32-bit accumulator */
+        sum = (sum & 0xffff) + (sum >> 16);
+        p += 16;
+        len -= 16;
+    }
+#else
+    /* Reach word alignment, then sum a word at a time with the carries
+     * folded back in - the same scheme as the hand-written Thumb-2 lwIP
+     * routine, expressed portably. */
+    if (((uintptr_t)p & 2) && (len >= 2)) {
+        sum += p[0] | ((uint32_t)p[1] << 8);
+        p += 2;
+        len -= 2;
+    }
+    while (len >= 4) {
+        uint32_t word;
+        memcpy(&word, p, 4);
+        sum += word;
+        if (sum < word) {
+            sum++;
+        }
+        p += 4;
+        len -= 4;
+    }
+    /* Fold before the tail so the halfword adds below cannot overflow */
+    sum = (sum & 0xffff) + (sum >> 16);
+#endif
+
+    while (len >= 2) {
+        sum += p[0] | ((uint32_t)p[1] << 8);
+        p += 2;
+        len -= 2;
+    }
+    if (len > 0) {
+        sum += *p;
+    }
+
+    uint16_t folded = fold_sum(sum);
+    if (swapped) {
+        folded = (uint16_t)((folded << 8) | (folded >> 8));
+    }
+    return folded;
+}
+
+void mbed_simd_xor(void *dst, const void *src, size_t len)
+{
+    uint8_t *d = dst;
+    const uint8_t *s = src;
+
+#if SIMD_HAVE_MVE
+    while (len >= 16) {
+        uint8x16_t vd = vld1q_u8(d);
+        uint8x16_t vs = vld1q_u8(s);
+        vst1q_u8(d, veorq_u8(vd, vs));
+        d += 16;
+        s += 16;
+        len -= 16;
+    }
+#else
+    /* Word at a time when both blocks share alignment */
+    if (((uintptr_t)d & 3) == ((uintptr_t)s & 3)) {
+        while (((uintptr_t)d & 3) && (len > 0)) {
+            *d++ ^= *s++;
+            len--;
+        }
+        while (len >= 4) {
+            uint32_t wd, ws;
+            memcpy(&wd, d, 4);
+            memcpy(&ws, s, 4);
+            wd ^= ws;
+            memcpy(d, &wd, 4);
+            d += 4;
+            s += 4;
+            len -= 4;
+        }
+    }
+#endif
+
+    while (len > 0) {
+        *d++ ^= *s++;
+        len--;
+    }
+}
+
+void mbed_simd_bswap32(uint32_t *dst, const uint32_t *src, size_t count)
+{
+#if SIMD_HAVE_MVE
+    while (count >= 4) {
+        uint8x16_t v = vld1q_u8((const uint8_t *)src);
+        vst1q_u8((uint8_t *)dst, vrev32q_u8(v));
+        src += 4;
+        dst += 4;
+        count -= 4;
+    }
+#endif
+
+    while (count > 0) {
+        uint32_t word = *src++;
+#if defined(__GNUC__) || defined(__clang__)
+        *dst++ = __builtin_bswap32(word);
+#else
+        *dst++ = (word >> 24) | ((word >> 8) & 0x0000ff00) |
+                 ((word << 8) & 0x00ff0000) | (word << 24);
+#endif
+        count--;
+    }
+}
+
+int mbed_simd_memcmp(const void *a, const void *b, size_t len)
+{
+    const uint8_t *pa = a;
+    const uint8_t *pb = b;
+
+#if SIMD_HAVE_MVE
+    /* Skip equal 16-byte blocks, then let the byte loop find the first
+     * difference inside the unequal block */
+    while (len >= 16) {
+        uint8x16_t va = vld1q_u8(pa);
+        uint8x16_t vb = vld1q_u8(pb);
+        if (vcmpneq_u8(va, vb)) {
+            break;
+        }
+        pa += 16;
+        pb += 16;
+        len -= 16;
+    }
+#else
+    if ((((uintptr_t)pa & 3) == 0) && (((uintptr_t)pb & 3) == 0)) {
+        while (len >= 4) {
+            uint32_t wa, wb;
+            memcpy(&wa, pa, 4);
+            memcpy(&wb, pb, 4);
+            if (wa != wb) {
+                break;
+            }
+            pa += 4;
+            pb += 4;
+            len -= 4;
+        }
+    }
+#endif
+
+    while (len > 0) {
+        if (*pa != *pb) {
+            return (int)*pa - (int)*pb;
+        }
+        pa++;
+        pb++;
+        len--;
+    }
+    return 0;
+}
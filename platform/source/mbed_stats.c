@@ -15,6 +15,7 @@
  * limitations under the License.
  */
 #include "platform/mbed_assert.h"
+#include "platform/mbed_critical.h"
 #include "platform/mbed_stats.h"
 #include "platform/mbed_power_mgmt.h"
 #include "platform/mbed_version.h"
@@ -22,6 +23,7 @@
 #include <stdlib.h>
 
 #include "device.h"
+#include "cmsis.h"
 #ifdef MBED_CONF_RTOS_PRESENT
 #include "cmsis_os2.h"
 #elif defined(MBED_STACK_STATS_ENABLED) || defined(MBED_THREAD_STATS_ENABLED)
@@ -139,6 +141,160 @@ size_t mbed_stats_thread_get_each(mbed_stats_thread_t *stats, size_t count)
     return i;
 }
 
+size_t mbed_stats_thread_cpu_get_each(mbed_stats_thread_cpu_t *stats, size_t count)
+{
+    MBED_ASSERT(stats != NULL);
+    memset(stats, 0, count * sizeof(mbed_stats_thread_cpu_t));
+
+#if defined(MBED_THREAD_CPU_STATS_ENABLED) && defined(MBED_CONF_RTOS_PRESENT)
+    // Collected at context switch by the RTX glue in mbed_rtx_handlers.c
+    extern size_t mbed_rtx_thread_cpu_stats_fetch(mbed_stats_thread_cpu_t *stats, size_t count);
+    return mbed_rtx_thread_cpu_stats_fetch(stats, count);
+#else
+    return 0;
+#endif
+}
+
+void mbed_stats_scheduler_get(mbed_stats_scheduler_t *stats)
+{
+    MBED_ASSERT(stats != NULL);
+    memset(stats, 0, sizeof(mbed_stats_scheduler_t));
+
+#if defined(MBED_SCHEDULER_STATS_ENABLED) && defined(MBED_CONF_RTOS_PRESENT)
+    // Collected at thread wakeup and context switch by the RTX glue in
+    // mbed_rtx_handlers.c
+    extern void mbed_rtx_scheduler_stats_fetch(mbed_stats_scheduler_t *stats);
+    mbed_rtx_scheduler_stats_fetch(stats);
+#endif
+}
+
+size_t mbed_stats_critical_get_each(mbed_stats_critical_t *stats, size_t count)
+{
+    MBED_ASSERT(stats != NULL);
+    memset(stats, 0, count * sizeof(mbed_stats_critical_t));
+
+#if defined(MBED_CRITICAL_STATS_ENABLED)
+    // Collected at the outermost critical-section enter and exit in
+    // mbed_critical.c
+    extern size_t mbed_critical_stats_fetch(mbed_stats_critical_t *stats, size_t count);
+    return mbed_critical_stats_fetch(stats, count);
+#else
+    return 0;
+#endif
+}
+
+void mbed_stats_sleep_get(mbed_stats_sleep_t *stats)
+{
+    MBED_ASSERT(stats != NULL);
+    memset(stats, 0, sizeof(mbed_stats_sleep_t));
+    stats->last_wake_irqn = MBED_SLEEP_STATS_WAKE_UNKNOWN;
+
+#if defined(MBED_SLEEP_STATS_ENABLED) && DEVICE_SLEEP && DEVICE_LPTICKER
+    // Collected around each sleep in mbed_power_mgmt.c
+    extern void mbed_sleep_stats_fetch(mbed_stats_sleep_t *stats);
+    mbed_sleep_stats_fetch(stats);
+#endif
+}
+
+size_t mbed_stats_sleep_wake_get_each(mbed_stats_wake_source_t *stats, size_t count)
+{
+    MBED_ASSERT(stats != NULL);
+    memset(stats, 0, count * sizeof(mbed_stats_wake_source_t));
+
+#if defined(MBED_SLEEP_STATS_ENABLED) && DEVICE_SLEEP && DEVICE_LPTICKER
+    // Collected around each sleep in mbed_power_mgmt.c
+    extern size_t mbed_sleep_wake_stats_fetch(mbed_stats_wake_source_t *stats, size_t count);
+    return mbed_sleep_wake_stats_fetch(stats, count);
+#else
+    return 0;
+#endif
+}
+
+size_t mbed_stats_atomic_get_each(mbed_stats_atomic_t *stats, size_t count)
+{
+    MBED_ASSERT(stats != NULL);
+    memset(stats, 0, count * sizeof(mbed_stats_atomic_t));
+
+#if defined(MBED_ATOMIC_STATS_ENABLED)
+    // Accumulated by the instrumented operations in mbed_atomic_impl.c
+    extern size_t mbed_atomic_stats_fetch(mbed_stats_atomic_t *stats, size_t count);
+    return mbed_atomic_stats_fetch(stats, count);
+#else
+    return 0;
+#endif
+}
+
+size_t mbed_stats_perf_get_each(mbed_stats_perf_t *stats, size_t count)
+{
+    MBED_ASSERT(stats != NULL);
+    memset(stats, 0, count * sizeof(mbed_stats_perf_t));
+
+#if defined(MBED_PERF_COUNTERS_ENABLED)
+    // Accumulated by scopes through mbed_perf_counters.c
+    extern size_t mbed_perf_stats_fetch(mbed_stats_perf_t *stats, size_t count);
+    return mbed_perf_stats_fetch(stats, count);
+#else
+    return 0;
+#endif
+}
+
+#if defined(MBED_BOOT_STATS_ENABLED) && defined(DWT) && defined(DWT_CTRL_CYCCNTENA_Msk)
+#define BOOT_STATS_AVAILABLE 1
+#else
+#define BOOT_STATS_AVAILABLE 0
+#endif
+
+#if BOOT_STATS_AVAILABLE
+
+static mbed_stats_boot_stage_t boot_stages[MBED_BOOT_STATS_ENTRIES];
+static uint32_t boot_stage_cnt;
+
+static uint32_t boot_cyccnt(void)
+{
+    /* A counter that is already running is left alone, so a target that
+     * enables it in SystemInit gets timestamps counted from reset. */
+    if (!(DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk)) {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+    return DWT->CYCCNT;
+}
+
+#endif // BOOT_STATS_AVAILABLE
+
+#if defined(MBED_BOOT_STATS_ENABLED)
+void mbed_stats_boot_stage(const char *name)
+{
+#if BOOT_STATS_AVAILABLE
+    // Timestamp taken first so the table bookkeeping is not counted
+    uint32_t cycles = boot_cyccnt();
+    core_util_critical_section_enter();
+    if (boot_stage_cnt < MBED_BOOT_STATS_ENTRIES) {
+        boot_stages[boot_stage_cnt].name = name;
+        boot_stages[boot_stage_cnt].cycles = cycles;
+        boot_stage_cnt++;
+    }
+    core_util_critical_section_exit();
+#else
+    (void)name;
+#endif
+}
+#endif // MBED_BOOT_STATS_ENABLED
+
+void mbed_stats_boot_get(mbed_stats_boot_t *stats)
+{
+    MBED_ASSERT(stats != NULL);
+    memset(stats, 0, sizeof(mbed_stats_boot_t));
+
+#if BOOT_STATS_AVAILABLE
+    core_util_critical_section_enter();
+    stats->stage_cnt = boot_stage_cnt;
+    memcpy(stats->stages, boot_stages, boot_stage_cnt * sizeof(mbed_stats_boot_stage_t));
+    core_util_critical_section_exit();
+#endif
+}
+
 void mbed_stats_sys_get(mbed_stats_sys_t *stats)
 {
     MBED_ASSERT(stats != NULL);
@@ -0,0 +1,376 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mbed_tlsf.h"
+#include "platform/mbed_critical.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Free blocks are indexed by size class: a first level per power of two and
+ * a second level dividing each power of two into SL_INDEX_COUNT linear
+ * ranges. Two bitmaps mirror which classes are non-empty, so finding a
+ * fitting block is two find-first-set instructions - no list is ever
+ * scanned. Blocks carry their size in the header with two flag bits, and a
+ * free block repeats its size in its last word so the following block can
+ * find it for coalescing. */
+
+#define ALIGN_SIZE              8
+#define SL_INDEX_COUNT_LOG2     4
+#define SL_INDEX_COUNT          (1 << SL_INDEX_COUNT_LOG2)
+#define SMALL_BLOCK_LOG2        8
+#define SMALL_BLOCK_SIZE        (1 << SMALL_BLOCK_LOG2)
+/* Class 0 covers sizes below SMALL_BLOCK_SIZE, classes 1..23 one power of
+ * two each up to 2^30, the largest request accepted */
+#define FL_INDEX_COUNT          24
+#define MAX_REQUEST_SIZE        ((size_t)1 << 30)
+
+#define BLOCK_FREE              ((size_t)0x1)
+#define BLOCK_PREV_FREE         ((size_t)0x2)
+#define BLOCK_FLAGS             (BLOCK_FREE | BLOCK_PREV_FREE)
+
+typedef struct tlsf_block {
+    size_t size;                    /* total block size with the flag bits */
+    struct tlsf_block *next_free;   /* valid only while the block is free */
+    struct tlsf_block *prev_free;
+} tlsf_block_t;
+
+#define BLOCK_HEADER_SIZE       (sizeof(size_t))
+#define MIN_BLOCK_SIZE          (sizeof(tlsf_block_t) + sizeof(size_t))
+
+static struct {
+    bool initialized;
+    uint32_t fl_bitmap;
+    uint32_t sl_bitmap[FL_INDEX_COUNT];
+    tlsf_block_t *blocks[FL_INDEX_COUNT][SL_INDEX_COUNT];
+} tlsf;
+
+static size_t block_size(const tlsf_block_t *block)
+{
+    return block->size & ~BLOCK_FLAGS;
+}
+
+static bool block_is_free(const tlsf_block_t *block)
+{
+    return (block->size & BLOCK_FREE) != 0;
+}
+
+static bool block_prev_is_free(const tlsf_block_t *block)
+{
+    return (block->size & BLOCK_PREV_FREE) != 0;
+}
+
+static tlsf_block_t *block_next(const tlsf_block_t *block)
+{
+    return (tlsf_block_t *)((char *)block + block_size(block));
+}
+
+static tlsf_block_t *block_prev(const tlsf_block_t *block)
+{
+    return (tlsf_block_t *)((char *)block - *((const size_t *)block - 1));
+}
+
+static void block_write_footer(tlsf_block_t *block)
+{
+    *((size_t *)((char *)block + block_size(block)) - 1) = block_size(block);
+}
+
+static void *block_to_ptr(tlsf_block_t *block)
+{
+    return (char *)block + BLOCK_HEADER_SIZE;
+}
+
+static tlsf_block_t *block_from_ptr(void *ptr)
+{
+    return (tlsf_block_t *)((char *)ptr - BLOCK_HEADER_SIZE);
+}
+
+static size_t align_up(size_t size)
+{
+    return (size + ALIGN_SIZE - 1) & ~(size_t)(ALIGN_SIZE - 1);
+}
+
+static void mapping_insert(size_t size, int *fl, int *sl)
+{
+    if (size < SMALL_BLOCK_SIZE) {
+        *fl = 0;
+        *sl = size / (SMALL_BLOCK_SIZE / SL_INDEX_COUNT);
+    } else {
+        int msb = 31 - __builtin_clz((uint32_t)size);
+        *sl = (size >> (msb - SL_INDEX_COUNT_LOG2)) & (SL_INDEX_COUNT - 1);
+        *fl = msb - (SMALL_BLOCK_LOG2 - 1);
+    }
+}
+
+static void mapping_search(size_t size, int *fl, int *sl)
+{
+    /* Round up to the next size class so any block found there fits */
+    if (size >= SMALL_BLOCK_SIZE) {
+        int msb = 31 - __builtin_clz((uint32_t)size);
+        size += ((size_t)1 << (msb - SL_INDEX_COUNT_LOG2)) - 1;
+    } else {
+        size += (SMALL_BLOCK_SIZE / SL_INDEX_COUNT) - 1;
+    }
+    mapping_insert(size, fl, sl);
+}
+
+static void block_insert(tlsf_block_t *block)
+{
+    int fl, sl;
+    mapping_insert(block_size(block), &fl, &sl);
+
+    tlsf_block_t *head = tlsf.blocks[fl][sl];
+    block->next_free = head;
+    block->prev_free = NULL;
+    if (head) {
+        head->prev_free = block;
+    }
+    tlsf.blocks[fl][sl] = block;
+    tlsf.fl_bitmap |= (1u << fl);
+    tlsf.sl_bitmap[fl] |= (1u << sl);
+}
+
+static void block_remove(tlsf_block_t *block)
+{
+    int fl, sl;
+    mapping_insert(block_size(block), &fl, &sl);
+
+    if (block->prev_free) {
+        block->prev_free->next_free = block->next_free;
+    } else {
+        tlsf.blocks[fl][sl] = block->next_free;
+        if (tlsf.blocks[fl][sl] == NULL) {
+            tlsf.sl_bitmap[fl] &= ~(1u << sl);
+            if (tlsf.sl_bitmap[fl] == 0) {
+                tlsf.fl_bitmap &= ~(1u << fl);
+            }
+        }
+    }
+    if (block->next_free) {
+        block->next_free->prev_free = block->prev_free;
+    }
+}
+
+static tlsf_block_t *block_find(size_t size)
+{
+    int fl, sl;
+    mapping_search(size, &fl, &sl);
+
+    uint32_t sl_map = tlsf.sl_bitmap[fl] & (~0u << sl);
+    if (sl_map == 0) {
+        uint32_t fl_map = tlsf.fl_bitmap & (~0u << (fl + 1));
+        if (fl_map == 0) {
+            return NULL;
+        }
+        fl = __builtin_ctz(fl_map);
+        sl_map = tlsf.sl_bitmap[fl];
+    }
+    sl = __builtin_ctz(sl_map);
+    return tlsf.blocks[fl][sl];
+}
+
+static bool tlsf_init(void)
+{
+    extern unsigned char *mbed_heap_start;
+    extern uint32_t mbed_heap_size;
+
+    if (mbed_heap_size == 0) {
+        return false;
+    }
+
+    char *start = (char *)align_up((uintptr_t)mbed_heap_start);
+    /* The last word of the pool holds a zero-size used sentinel block, so
+     * coalescing never runs past the end */
+    char *end = (char *)(((uintptr_t)mbed_heap_start + mbed_heap_size - sizeof(size_t))
+                         & ~(uintptr_t)(ALIGN_SIZE - 1));
+    if (end <= start || (size_t)(end - start) < MIN_BLOCK_SIZE) {
+        return false;
+    }
+
+    tlsf_block_t *pool = (tlsf_block_t *)start;
+    pool->size = (size_t)(end - start) | BLOCK_FREE;
+    block_write_footer(pool);
+    block_insert(pool);
+
+    tlsf_block_t *sentinel = (tlsf_block_t *)end;
+    sentinel->size = BLOCK_PREV_FREE;
+
+    tlsf.initialized = true;
+    return true;
+}
+
+static void *tlsf_malloc_internal(size_t size)
+{
+    if (size > MAX_REQUEST_SIZE) {
+        return NULL;
+    }
+    if (!tlsf.initialized && !tlsf_init()) {
+        return NULL;
+    }
+
+    size_t adjust = align_up(size + BLOCK_HEADER_SIZE);
+    if (adjust < MIN_BLOCK_SIZE) {
+        adjust = MIN_BLOCK_SIZE;
+    }
+
+    tlsf_block_t *block = block_find(adjust);
+    if (block == NULL) {
+        return NULL;
+    }
+    block_remove(block);
+
+    size_t total = block_size(block);
+    if (total - adjust >= MIN_BLOCK_SIZE) {
+        /* Split: the tail stays free */
+        block->size = adjust | (block->size & BLOCK_PREV_FREE);
+        tlsf_block_t *remainder = block_next(block);
+        remainder->size = (total - adjust) | BLOCK_FREE;
+        block_write_footer(remainder);
+        block_insert(remainder);
+    } else {
+        block->size &= ~BLOCK_FREE;
+        block_next(block)->size &= ~BLOCK_PREV_FREE;
+    }
+
+    return block_to_ptr(block);
+}
+
+static void tlsf_free_internal(void *ptr)
+{
+    tlsf_block_t *block = block_from_ptr(ptr);
+    size_t size = block_size(block);
+
+    tlsf_block_t *next = block_next(block);
+    if (block_is_free(next)) {
+        block_remove(next);
+        size += block_size(next);
+    }
+    if (block_prev_is_free(block)) {
+        tlsf_block_t *prev = block_prev(block);
+        block_remove(prev);
+        size += block_size(prev);
+        block = prev;
+    }
+
+    block->size = size | BLOCK_FREE | (block->size & BLOCK_PREV_FREE);
+    block_write_footer(block);
+    block_next(block)->size |= BLOCK_PREV_FREE;
+    block_insert(block);
+}
+
+void *mbed_tlsf_malloc(size_t size)
+{
+    core_util_critical_section_enter();
+    void *ptr = tlsf_malloc_internal(size);
+    core_util_critical_section_exit();
+    return ptr;
+}
+
+void mbed_tlsf_free(void *ptr)
+{
+    if (ptr == NULL) {
+        return;
+    }
+    core_util_critical_section_enter();
+    tlsf_free_internal(ptr);
+    core_util_critical_section_exit();
+}
+
+void *mbed_tlsf_realloc(void *ptr, size_t size)
+{
+    if (ptr == NULL) {
+        return mbed_tlsf_malloc(size);
+    }
+    if (size == 0) {
+        mbed_tlsf_free(ptr);
+        return NULL;
+    }
+
+    size_t old_size = block_size(block_from_ptr(ptr)) - BLOCK_HEADER_SIZE;
+    if (old_size >= size) {
+        return ptr;
+    }
+
+    void *new_ptr = mbed_tlsf_malloc(size);
+    if (new_ptr != NULL) {
+        memcpy(new_ptr, ptr, old_size);
+        mbed_tlsf_free(ptr);
+    }
+    return new_ptr;
+}
+
+void *mbed_tlsf_calloc(size_t nmemb, size_t size)
+{
+    if (size != 0 && nmemb > (size_t)-1 / size) {
+        return NULL;
+    }
+    void *ptr = mbed_tlsf_malloc(nmemb * size);
+    if (ptr != NULL) {
+        memset(ptr, 0, nmemb * size);
+    }
+    return ptr;
+}
+
+void *mbed_tlsf_memalign(size_t align, size_t size)
+{
+    if (align <= ALIGN_SIZE) {
+        return mbed_tlsf_malloc(size);
+    }
+    if ((align & (align - 1)) != 0 || size > MAX_REQUEST_SIZE - 2 * align - MIN_BLOCK_SIZE) {
+        return NULL;
+    }
+
+    core_util_critical_section_enter();
+    /* Over-allocate so an aligned position with room for a leading free
+     * block always exists, then carve the gap off as its own block */
+    void *ptr = tlsf_malloc_internal(size + 2 * align + MIN_BLOCK_SIZE);
+    if (ptr != NULL) {
+        uintptr_t aligned = ((uintptr_t)ptr + align - 1) & ~(align - 1);
+        if (aligned != (uintptr_t)ptr) {
+            while (aligned - (uintptr_t)ptr < MIN_BLOCK_SIZE) {
+                aligned += align;
+            }
+            tlsf_block_t *block = block_from_ptr(ptr);
+            tlsf_block_t *aligned_block = (tlsf_block_t *)(aligned - BLOCK_HEADER_SIZE);
+            size_t gap = (char *)aligned_block - (char *)block;
+            aligned_block->size = block_size(block) - gap;
+            block->size = gap | (block->size & BLOCK_PREV_FREE);
+            tlsf_free_internal(block_to_ptr(block));
+            ptr = (void *)aligned;
+        }
+    }
+    core_util_critical_section_exit();
+    return ptr;
+}
+
+size_t mbed_tlsf_block_total_size(void *ptr)
+{
+    return block_size(block_from_ptr(ptr));
+}
+
+void mbed_tlsf_free_blocks_visit(void (*visit)(size_t size, void *context), void *context)
+{
+    core_util_critical_section_enter();
+    for (int fl = 0; fl < FL_INDEX_COUNT; fl++) {
+        for (int sl = 0; sl < SL_INDEX_COUNT; sl++) {
+            for (const tlsf_block_t *block = tlsf.blocks[fl][sl]; block; block = block->next_free) {
+                visit(block_size(block), context);
+            }
+        }
+    }
+    core_util_critical_section_exit();
+}
@@ -0,0 +1,105 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MBED_TLSF_H
+#define MBED_TLSF_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Two-level segregated fit heap allocator.
+ *
+ * Selected as the heap backend with MBED_CONF_PLATFORM_HEAP_TLSF, in which
+ * case the allocation wrappers in mbed_alloc_wrappers.cpp route all
+ * malloc-family entry points here instead of the toolchain allocator.
+ * malloc and free are O(1): free blocks are indexed by a two-level size
+ * class bitmap, so no free-list scan ever happens, and immediate boundary-tag
+ * coalescing bounds fragmentation.
+ *
+ * The allocator manages the region described by mbed_heap_start and
+ * mbed_heap_size, initialized lazily on the first allocation. The index
+ * costs roughly 1.5 kB of static RAM on a 32-bit target.
+ *
+ * All functions are interrupt safe; operations run in a critical section.
+ */
+
+/** Allocate a block of at least the given size, aligned to 8 bytes.
+ *
+ *  @param size     Requested size in bytes.
+ *  @return         Pointer to the block, or NULL if no fit exists.
+ */
+void *mbed_tlsf_malloc(size_t size);
+
+/** Free a block returned by one of the allocation functions.
+ *
+ *  @param ptr      Block to free, may be NULL.
+ */
+void mbed_tlsf_free(void *ptr);
+
+/** Resize a block, moving it if it cannot grow in place.
+ *
+ *  @param ptr      Block to resize, or NULL to allocate.
+ *  @param size     New size in bytes, 0 to free.
+ *  @return         Pointer to the resized block, or NULL on failure (the
+ *                  original block is left intact).
+ */
+void *mbed_tlsf_realloc(void *ptr, size_t size);
+
+/** Allocate a zero-initialized array.
+ *
+ *  @param nmemb    Number of elements.
+ *  @param size     Element size in bytes.
+ *  @return         Pointer to the zeroed block, or NULL on failure or
+ *                  overflow of nmemb * size.
+ */
+void *mbed_tlsf_calloc(size_t nmemb, size_t size);
+
+/** Allocate a block with the given alignment.
+ *
+ *  @param align    Alignment in bytes, must be a power of two.
+ *  @param size     Requested size in bytes.
+ *  @return         Pointer to the aligned block, or NULL on failure.
+ */
+void *mbed_tlsf_memalign(size_t align, size_t size);
+
+/** Total size of the block backing an allocation, header included.
+ *
+ *  Used by the heap statistics to account allocator overhead.
+ *
+ *  @param ptr      Block returned by one of the allocation functions.
+ *  @return         Block size in bytes.
+ */
+size_t mbed_tlsf_block_total_size(void *ptr);
+
+/** Visit every free block, for fragmentation statistics.
+ *
+ *  The visitor runs inside the allocator's critical section, so it must be
+ *  short and must not allocate.
+ *
+ *  @param visit    Called with each free block's total size.
+ *  @param context  Passed through to the visitor.
+ */
+void mbed_tlsf_free_blocks_visit(void (*visit)(size_t size, void *context), void *context);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
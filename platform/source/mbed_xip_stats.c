@@ -0,0 +1,95 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string.h>
+
+#include "cmsis.h"
+#include "platform/mbed_xip_stats.h"
+
+/* The profiling counters are an optional DWT feature; NOPRFCNT reads as 1
+ * when an implementation left them out, so support is a runtime check on
+ * cores that have a DWT at all. */
+#if defined(DWT) && defined(DWT_CTRL_CYCCNTENA_Msk) && defined(DWT_CTRL_NOPRFCNT_Msk)
+#define XIP_STATS_AVAILABLE 1
+#else
+#define XIP_STATS_AVAILABLE 0
+#endif
+
+#if XIP_STATS_AVAILABLE
+
+#define XIP_STATS_EVTENA_MASK (DWT_CTRL_CYCCNTENA_Msk | \
+                               DWT_CTRL_CPIEVTENA_Msk | \
+                               DWT_CTRL_LSUEVTENA_Msk | \
+                               DWT_CTRL_EXCEVTENA_Msk | \
+                               DWT_CTRL_SLEEPEVTENA_Msk | \
+                               DWT_CTRL_FOLDEVTENA_Msk)
+
+bool mbed_xip_stats_supported(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    return !(DWT->CTRL & (DWT_CTRL_NOPRFCNT_Msk | DWT_CTRL_NOCYCCNT_Msk));
+}
+
+void mbed_xip_stats_start(void)
+{
+    if (!mbed_xip_stats_supported()) {
+        return;
+    }
+    DWT->CTRL &= ~XIP_STATS_EVTENA_MASK;
+    DWT->CYCCNT = 0;
+    DWT->CPICNT = 0;
+    DWT->LSUCNT = 0;
+    DWT->EXCCNT = 0;
+    DWT->SLEEPCNT = 0;
+    DWT->FOLDCNT = 0;
+    DWT->CTRL |= XIP_STATS_EVTENA_MASK;
+}
+
+void mbed_xip_stats_stop(mbed_xip_stats_t *stats)
+{
+    memset(stats, 0, sizeof(*stats));
+    if (!mbed_xip_stats_supported()) {
+        return;
+    }
+    /* Counters other than CYCCNT are 8 bits wide; a value of 255 means
+     * saturation, as documented in the header. */
+    stats->cycles = DWT->CYCCNT;
+    stats->cpi_stalls = DWT->CPICNT & 0xFF;
+    stats->lsu_stalls = DWT->LSUCNT & 0xFF;
+    stats->exc_cycles = DWT->EXCCNT & 0xFF;
+    stats->sleep_cycles = DWT->SLEEPCNT & 0xFF;
+    stats->folded = DWT->FOLDCNT & 0xFF;
+    DWT->CTRL &= ~(XIP_STATS_EVTENA_MASK & ~DWT_CTRL_CYCCNTENA_Msk);
+}
+
+#else /* XIP_STATS_AVAILABLE */
+
+bool mbed_xip_stats_supported(void)
+{
+    return false;
+}
+
+void mbed_xip_stats_start(void)
+{
+}
+
+void mbed_xip_stats_stop(mbed_xip_stats_t *stats)
+{
+    memset(stats, 0, sizeof(*stats));
+}
+
+#endif /* XIP_STATS_AVAILABLE */
@@ -0,0 +1,85 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Microbenchmarks for the hot paths of the core primitives. These cases have
+ * no pass/fail condition of their own - they exist so CI records the cost of
+ * each operation and a regression shows up as a number. */
+
+#include "mbed.h"
+#include "benchmark.h"
+#include "events/EventQueue.h"
+
+using namespace events;
+
+/* A side effect the compiler cannot remove, shared by all benchmarks */
+static volatile uint32_t sink = 0;
+
+static void noop_handler()
+{
+    sink++;
+}
+
+#ifdef MBED_CONF_RTOS_PRESENT
+
+static rtos::Mutex benchmark_mutex;
+
+BENCHMARK(mutex_lock_unlock)
+{
+    benchmark_mutex.lock();
+    benchmark_mutex.unlock();
+}
+
+#endif
+
+static EventQueue benchmark_queue;
+
+BENCHMARK(event_queue_post_dispatch)
+{
+    benchmark_queue.call(noop_handler);
+    benchmark_queue.dispatch(0);
+}
+
+static CircularBuffer<uint32_t, 32> benchmark_buffer;
+
+BENCHMARK(circular_buffer_push_pop)
+{
+    uint32_t value;
+    benchmark_buffer.push(sink);
+    benchmark_buffer.pop(value);
+    sink = value;
+}
+
+static uint8_t memcpy_source[256];
+static uint8_t memcpy_destination[256];
+
+BENCHMARK(memcpy_256)
+{
+    memcpy(memcpy_destination, memcpy_source, sizeof memcpy_destination);
+    sink = memcpy_destination[0];
+}
+
+static Callback<void()> benchmark_callback(noop_handler);
+
+BENCHMARK(callback_call)
+{
+    benchmark_callback();
+}
+
+int main()
+{
+    return mbed::benchmark::run_all("core primitives");
+}
@@ -188,11 +188,77 @@ void test_case_realloc_size()
     TEST_ASSERT_EQUAL_UINT32(stats_start.current_size, stats_current.current_size);
 }
 
+void test_case_heap_fragmentation()
+{
+    mbed_stats_heap_frag_t frag;
+    void *data[4];
+
+    for (uint32_t i = 0; i < sizeof(data) / sizeof(data[0]); i++) {
+        data[i] = malloc(ALLOCATION_SIZE_SMALL);
+        TEST_ASSERT(data[i] != NULL);
+    }
+
+    // Punch holes in the heap by freeing alternate blocks
+    free(data[0]);
+    free(data[2]);
+
+    mbed_stats_heap_frag_get(&frag);
+#if defined(TOOLCHAIN_GCC)
+    TEST_ASSERT(frag.free_block_cnt >= 2);
+    TEST_ASSERT(frag.largest_free_block > 0);
+    TEST_ASSERT(frag.free_size >= frag.largest_free_block);
+
+    // Every free block lands in exactly one bucket
+    uint32_t bucket_total = 0;
+    for (uint32_t i = 0; i < MBED_STATS_HEAP_FRAG_BUCKETS; i++) {
+        bucket_total += frag.histogram[i];
+    }
+    TEST_ASSERT_EQUAL_UINT32(frag.free_block_cnt, bucket_total);
+#endif
+
+    free(data[1]);
+    free(data[3]);
+}
+
+#if MBED_HEAP_TAG_STATS_ENABLED
+void test_case_heap_tags()
+{
+    mbed_stats_heap_tag_t tag_stats[MBED_STATS_HEAP_MAX_TAGS];
+    void *data;
+
+    int8_t tag = mbed_stats_heap_tag_register("test");
+    TEST_ASSERT(tag > 0);
+
+    int8_t prev = mbed_stats_heap_tag_set(tag);
+    data = malloc(ALLOCATION_SIZE_DEFAULT);
+    mbed_stats_heap_tag_set(prev);
+    TEST_ASSERT(data != NULL);
+
+    size_t count = mbed_stats_heap_tag_get(tag_stats, MBED_STATS_HEAP_MAX_TAGS);
+    TEST_ASSERT(count > (size_t)tag);
+    TEST_ASSERT_EQUAL_STRING("test", tag_stats[tag].name);
+    TEST_ASSERT_EQUAL_UINT32(ALLOCATION_SIZE_DEFAULT, tag_stats[tag].current_size);
+    TEST_ASSERT_EQUAL_UINT32(ALLOCATION_SIZE_DEFAULT, tag_stats[tag].max_size);
+    TEST_ASSERT_EQUAL_UINT32(1, tag_stats[tag].alloc_cnt);
+
+    // The block is credited back to its tag even though the tag window closed
+    free(data);
+    mbed_stats_heap_tag_get(tag_stats, MBED_STATS_HEAP_MAX_TAGS);
+    TEST_ASSERT_EQUAL_UINT32(0, tag_stats[tag].current_size);
+    TEST_ASSERT_EQUAL_UINT32(ALLOCATION_SIZE_DEFAULT, tag_stats[tag].max_size);
+    TEST_ASSERT_EQUAL_UINT32(0, tag_stats[tag].alloc_cnt);
+}
+#endif
+
 Case cases[] = {
     Case("malloc and free size", test_case_malloc_free_size),
     Case("allocate size zero", test_case_allocate_zero),
     Case("allocation failure", test_case_allocate_fail),
     Case("realloc size", test_case_realloc_size),
+    Case("heap fragmentation", test_case_heap_fragmentation),
+#if MBED_HEAP_TAG_STATS_ENABLED
+    Case("heap tags", test_case_heap_tags),
+#endif
 };
 
 utest::v1::status_t greentea_test_setup(const size_t number_of_cases)
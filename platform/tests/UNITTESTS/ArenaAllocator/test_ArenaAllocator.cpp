@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2021, Arm Limited and affiliates
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+#include "platform/ArenaAllocator.h"
+
+#include <stdint.h>
+
+#define TEST_ARENA_SIZE (256)
+
+class TestArenaAllocator : public testing::Test {
+protected:
+    uint64_t storage[TEST_ARENA_SIZE / sizeof(uint64_t)];
+    mbed::ArenaAllocator *arena;
+
+    virtual void SetUp()
+    {
+        arena = new mbed::ArenaAllocator(storage, TEST_ARENA_SIZE);
+    }
+
+    virtual void TearDown()
+    {
+        delete arena;
+    }
+};
+
+TEST_F(TestArenaAllocator, constructor)
+{
+    EXPECT_TRUE(arena);
+    EXPECT_EQ(arena->used(), 0);
+    EXPECT_EQ(arena->remaining(), TEST_ARENA_SIZE);
+}
+
+TEST_F(TestArenaAllocator, alloc_returns_distinct_aligned_blocks)
+{
+    void *a = arena->alloc(10);
+    void *b = arena->alloc(1);
+    ASSERT_TRUE(a);
+    ASSERT_TRUE(b);
+    EXPECT_NE(a, b);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(a) % 8, 0);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(b) % 8, 0);
+}
+
+TEST_F(TestArenaAllocator, alloc_fails_when_exhausted)
+{
+    EXPECT_TRUE(arena->alloc(TEST_ARENA_SIZE));
+    EXPECT_FALSE(arena->alloc(1));
+    EXPECT_FALSE(arena->alloc(TEST_ARENA_SIZE + 1));
+}
+
+TEST_F(TestArenaAllocator, reset_frees_everything)
+{
+    EXPECT_TRUE(arena->alloc(TEST_ARENA_SIZE));
+    EXPECT_EQ(arena->remaining(), 0);
+    arena->reset();
+    EXPECT_EQ(arena->used(), 0);
+    EXPECT_TRUE(arena->alloc(TEST_ARENA_SIZE));
+}
+
+TEST_F(TestArenaAllocator, rewind_to_mark)
+{
+    EXPECT_TRUE(arena->alloc(16));
+    size_t mark = arena->mark();
+    EXPECT_TRUE(arena->alloc(32));
+    arena->rewind(mark);
+    EXPECT_EQ(arena->used(), 16);
+}
+
+TEST_F(TestArenaAllocator, scope_rewinds_on_destruction)
+{
+    EXPECT_TRUE(arena->alloc(16));
+    {
+        mbed::ArenaAllocator::Scope scope(*arena);
+        EXPECT_TRUE(arena->alloc(64));
+        EXPECT_EQ(arena->used(), 80);
+    }
+    EXPECT_EQ(arena->used(), 16);
+}
@@ -0,0 +1,224 @@
+/* Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+#include "platform/BufferedFileStream.h"
+
+#include <string.h>
+#include <string>
+
+using namespace mbed;
+
+/* In-memory file that counts the calls a real filesystem would pay for. */
+class MemoryFileHandle : public FileHandle {
+public:
+    MemoryFileHandle(const void *data, size_t size) : _pos(0)
+    {
+        _data.assign(static_cast<const char *>(data), size);
+    }
+
+    ssize_t read(void *buffer, size_t size) override
+    {
+        read_calls++;
+        if (_pos >= _data.size()) {
+            return 0;
+        }
+        size_t avail = _data.size() - _pos;
+        size_t n = size < avail ? size : avail;
+        memcpy(buffer, _data.data() + _pos, n);
+        _pos += n;
+        return n;
+    }
+
+    ssize_t write(const void *buffer, size_t size) override
+    {
+        return -EBADF;
+    }
+
+    off_t seek(off_t offset, int whence = SEEK_SET) override
+    {
+        seek_calls++;
+        off_t target;
+        switch (whence) {
+            case SEEK_SET:
+                target = offset;
+                break;
+            case SEEK_CUR:
+                target = _pos + offset;
+                break;
+            case SEEK_END:
+                target = _data.size() + offset;
+                break;
+            default:
+                return -EINVAL;
+        }
+        if (target < 0) {
+            return -EINVAL;
+        }
+        _pos = target;
+        return target;
+    }
+
+    off_t size() override
+    {
+        return _data.size();
+    }
+
+    int close() override
+    {
+        return 0;
+    }
+
+    int read_calls = 0;
+    int seek_calls = 0;
+
+private:
+    std::string _data;
+    size_t _pos;
+};
+
+class BufferedFileStreamTest : public testing::Test {
+protected:
+    static constexpr size_t FILE_SIZE = 1000;
+
+    virtual void SetUp()
+    {
+        for (size_t i = 0; i < FILE_SIZE; i++) {
+            data[i] = 'a' + (i % 26);
+        }
+        fh = new MemoryFileHandle(data, FILE_SIZE);
+    }
+
+    virtual void TearDown()
+    {
+        delete fh;
+    }
+
+    char data[FILE_SIZE];
+    MemoryFileHandle *fh;
+};
+
+TEST_F(BufferedFileStreamTest, read_matches_file)
+{
+    BufferedFileStream stream(fh, 64);
+    char out[FILE_SIZE];
+    EXPECT_EQ(stream.read(out, FILE_SIZE), FILE_SIZE);
+    EXPECT_EQ(memcmp(out, data, FILE_SIZE), 0);
+    EXPECT_EQ(stream.read(out, 1), 0);
+    EXPECT_EQ(stream.tell(), FILE_SIZE);
+}
+
+TEST_F(BufferedFileStreamTest, byte_reads_are_batched)
+{
+    BufferedFileStream stream(fh, 100);
+    for (size_t i = 0; i < FILE_SIZE; i++) {
+        EXPECT_EQ(stream.getc(), data[i]);
+    }
+    EXPECT_EQ(stream.getc(), EOF);
+    /* 1000 one-byte tokens cost ceil(1000 / 100) + 1 underlying reads. */
+    EXPECT_EQ(fh->read_calls, 11);
+}
+
+TEST_F(BufferedFileStreamTest, peek_is_zero_copy_and_nondestructive)
+{
+    BufferedFileStream stream(fh, 64);
+    Span<const uint8_t> token = stream.peek(10);
+    ASSERT_EQ(token.size(), 10);
+    EXPECT_EQ(memcmp(token.data(), data, 10), 0);
+    /* A second peek returns the same bytes without another refill. */
+    int reads = fh->read_calls;
+    Span<const uint8_t> again = stream.peek(10);
+    EXPECT_EQ(again.data(), token.data());
+    EXPECT_EQ(fh->read_calls, reads);
+
+    stream.consume(10);
+    token = stream.peek(5);
+    ASSERT_EQ(token.size(), 5);
+    EXPECT_EQ(memcmp(token.data(), data + 10, 5), 0);
+}
+
+TEST_F(BufferedFileStreamTest, peek_clamps_at_end_of_file)
+{
+    BufferedFileStream stream(fh, 64);
+    ASSERT_EQ(stream.seek(FILE_SIZE - 3), FILE_SIZE - 3);
+    Span<const uint8_t> tail = stream.peek(10);
+    ASSERT_EQ(tail.size(), 3);
+    EXPECT_EQ(memcmp(tail.data(), data + FILE_SIZE - 3, 3), 0);
+    stream.consume(3);
+    EXPECT_EQ(stream.peek(1).size(), 0);
+}
+
+TEST_F(BufferedFileStreamTest, seek_within_window_is_free)
+{
+    BufferedFileStream stream(fh, 64);
+    char out[16];
+    ASSERT_EQ(stream.read(out, 16), 16);
+    int seeks = fh->seek_calls;
+    /* Back into the buffered window: no underlying call. */
+    EXPECT_EQ(stream.seek(4), 4);
+    EXPECT_EQ(fh->seek_calls, seeks);
+    ASSERT_EQ(stream.read(out, 4), 4);
+    EXPECT_EQ(memcmp(out, data + 4, 4), 0);
+}
+
+TEST_F(BufferedFileStreamTest, seek_outside_window_is_deferred)
+{
+    BufferedFileStream stream(fh, 64);
+    int seeks = fh->seek_calls;
+    EXPECT_EQ(stream.seek(500), 500);
+    EXPECT_EQ(stream.seek(600), 600);
+    EXPECT_EQ(stream.tell(), 600);
+    /* Neither seek touched the filesystem yet. */
+    EXPECT_EQ(fh->seek_calls, seeks);
+    EXPECT_EQ(stream.getc(), data[600]);
+    EXPECT_EQ(fh->seek_calls, seeks + 1);
+}
+
+TEST_F(BufferedFileStreamTest, seek_whence_variants)
+{
+    BufferedFileStream stream(fh, 64);
+    EXPECT_EQ(stream.seek(10, SEEK_SET), 10);
+    EXPECT_EQ(stream.seek(5, SEEK_CUR), 15);
+    EXPECT_EQ(stream.seek(-10, SEEK_END), FILE_SIZE - 10);
+    EXPECT_EQ(stream.seek(-1, SEEK_SET), -EINVAL);
+    EXPECT_EQ(stream.seek(0, 42), -EINVAL);
+    EXPECT_EQ(stream.size(), FILE_SIZE);
+}
+
+TEST_F(BufferedFileStreamTest, large_read_bypasses_buffer)
+{
+    BufferedFileStream stream(fh, 16);
+    char out[200];
+    ASSERT_EQ(stream.read(out, 4), 4);
+    /* The remaining request dwarfs the buffer: the buffered bytes are
+     * served first, the rest comes straight from the handle. */
+    ASSERT_EQ(stream.read(out, 200), 200);
+    EXPECT_EQ(memcmp(out, data + 4, 200), 0);
+    EXPECT_EQ(stream.tell(), 204);
+    EXPECT_EQ(stream.getc(), data[204]);
+}
+
+TEST_F(BufferedFileStreamTest, set_buffer_keeps_position)
+{
+    BufferedFileStream stream(fh, 16);
+    char out[8];
+    ASSERT_EQ(stream.read(out, 8), 8);
+    char storage[128];
+    ASSERT_EQ(stream.set_buffer(storage, sizeof(storage)), 0);
+    EXPECT_EQ(stream.set_buffer(storage, 0), -EINVAL);
+    EXPECT_EQ(stream.tell(), 8);
+    EXPECT_EQ(stream.getc(), data[8]);
+}
@@ -49,6 +49,13 @@ TEST_F(TestCircularBuffer, push_pop)
     EXPECT_EQ(item, 1);
 }
 
+TEST_F(TestCircularBuffer, capacity)
+{
+    EXPECT_EQ(buf->capacity(), TEST_BUFFER_SIZE);
+    buf->push(1);
+    EXPECT_EQ(buf->capacity(), TEST_BUFFER_SIZE);
+}
+
 TEST_F(TestCircularBuffer, reset)
 {
     buf->push(1);
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2021, Arm Limited and affiliates
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+#include "platform/IsrPool.h"
+
+#include <stdint.h>
+
+struct descriptor {
+    uint32_t a;
+    uint32_t b;
+};
+
+#define TEST_POOL_SIZE (4)
+
+class TestIsrPool : public testing::Test {
+protected:
+    mbed::IsrPool<descriptor, TEST_POOL_SIZE> *pool;
+
+    virtual void SetUp()
+    {
+        pool = new mbed::IsrPool<descriptor, TEST_POOL_SIZE>;
+    }
+
+    virtual void TearDown()
+    {
+        delete pool;
+    }
+};
+
+TEST_F(TestIsrPool, constructor)
+{
+    EXPECT_TRUE(pool);
+    EXPECT_EQ(pool->capacity(), TEST_POOL_SIZE);
+    EXPECT_EQ(pool->free_blocks(), TEST_POOL_SIZE);
+    EXPECT_EQ(pool->alloc_failures(), 0);
+    EXPECT_EQ(pool->heap_fallbacks(), 0);
+}
+
+TEST_F(TestIsrPool, try_alloc_returns_distinct_aligned_blocks)
+{
+    descriptor *blocks[TEST_POOL_SIZE];
+    for (int i = 0; i < TEST_POOL_SIZE; i++) {
+        blocks[i] = pool->try_alloc();
+        ASSERT_TRUE(blocks[i]);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(blocks[i]) % alignof(descriptor), 0);
+        for (int j = 0; j < i; j++) {
+            EXPECT_NE(blocks[i], blocks[j]);
+        }
+    }
+    EXPECT_EQ(pool->free_blocks(), 0);
+    for (int i = 0; i < TEST_POOL_SIZE; i++) {
+        pool->free(blocks[i]);
+    }
+    EXPECT_EQ(pool->free_blocks(), TEST_POOL_SIZE);
+}
+
+TEST_F(TestIsrPool, exhaustion_fails_and_is_counted)
+{
+    descriptor *blocks[TEST_POOL_SIZE];
+    for (int i = 0; i < TEST_POOL_SIZE; i++) {
+        blocks[i] = pool->try_alloc();
+    }
+    EXPECT_EQ(pool->try_alloc(), nullptr);
+    EXPECT_EQ(pool->try_alloc(), nullptr);
+    EXPECT_EQ(pool->alloc_failures(), 2);
+
+    // Returning one block makes the pool usable again
+    pool->free(blocks[0]);
+    descriptor *again = pool->try_alloc();
+    EXPECT_EQ(again, blocks[0]);
+    pool->free(again);
+    for (int i = 1; i < TEST_POOL_SIZE; i++) {
+        pool->free(blocks[i]);
+    }
+}
+
+TEST_F(TestIsrPool, alloc_overflows_to_heap_in_thread_context)
+{
+    descriptor *blocks[TEST_POOL_SIZE];
+    for (int i = 0; i < TEST_POOL_SIZE; i++) {
+        blocks[i] = pool->alloc();
+        ASSERT_TRUE(blocks[i]);
+    }
+    EXPECT_EQ(pool->heap_fallbacks(), 0);
+
+    // The stubbed core_util_is_isr_active() reports thread context, so
+    // the exhausted pool falls back to the heap
+    descriptor *extra = pool->alloc();
+    ASSERT_TRUE(extra);
+    EXPECT_EQ(pool->heap_fallbacks(), 1);
+    EXPECT_EQ(pool->alloc_failures(), 1);
+
+    // free() routes the fallback block back to the heap, not the bitmap
+    pool->free(extra);
+    EXPECT_EQ(pool->free_blocks(), 0);
+
+    for (int i = 0; i < TEST_POOL_SIZE; i++) {
+        pool->free(blocks[i]);
+    }
+    EXPECT_EQ(pool->free_blocks(), TEST_POOL_SIZE);
+}
+
+TEST_F(TestIsrPool, free_null_is_a_no_op)
+{
+    pool->free(nullptr);
+    EXPECT_EQ(pool->free_blocks(), TEST_POOL_SIZE);
+}
+
+TEST_F(TestIsrPool, multi_word_bitmap)
+{
+    // 40 blocks spans two bitmap words with a partial last word
+    mbed::IsrPool<uint64_t, 40> big;
+    EXPECT_EQ(big.free_blocks(), 40);
+
+    uint64_t *blocks[40];
+    for (int i = 0; i < 40; i++) {
+        blocks[i] = big.try_alloc();
+        ASSERT_TRUE(blocks[i]);
+        *blocks[i] = i;
+    }
+    EXPECT_EQ(big.try_alloc(), nullptr);
+    for (int i = 0; i < 40; i++) {
+        EXPECT_EQ(*blocks[i], (uint64_t)i);
+        big.free(blocks[i]);
+    }
+    EXPECT_EQ(big.free_blocks(), 40);
+}
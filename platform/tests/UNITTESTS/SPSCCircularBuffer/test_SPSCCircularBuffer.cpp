@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2021, Arm Limited and affiliates
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+#include "platform/SPSCCircularBuffer.h"
+
+#define TEST_BUFFER_SIZE (10)
+
+class TestSPSCCircularBuffer : public testing::Test {
+protected:
+    mbed::SPSCCircularBuffer<int, TEST_BUFFER_SIZE> *buf;
+
+    virtual void SetUp()
+    {
+        buf = new mbed::SPSCCircularBuffer<int, TEST_BUFFER_SIZE>;
+    }
+
+    virtual void TearDown()
+    {
+        delete buf;
+    }
+};
+
+TEST_F(TestSPSCCircularBuffer, constructor)
+{
+    EXPECT_TRUE(buf);
+    EXPECT_TRUE(buf->empty());
+    EXPECT_FALSE(buf->full());
+    EXPECT_EQ(buf->size(), 0);
+}
+
+TEST_F(TestSPSCCircularBuffer, push_pop)
+{
+    int item = 0;
+    EXPECT_TRUE(buf->push(1));
+    bool ret = buf->pop(item);
+    EXPECT_TRUE(ret);
+    EXPECT_EQ(item, 1);
+}
+
+TEST_F(TestSPSCCircularBuffer, reset)
+{
+    buf->push(1);
+    EXPECT_EQ(buf->size(), 1);
+    buf->reset();
+    EXPECT_EQ(buf->size(), 0);
+}
+
+TEST_F(TestSPSCCircularBuffer, pop_empty)
+{
+    int item = 0;
+    bool ret = buf->pop(item);
+    EXPECT_FALSE(ret);
+}
+
+TEST_F(TestSPSCCircularBuffer, push_full_does_not_overwrite)
+{
+    for (int i = 0; i < TEST_BUFFER_SIZE; i++) {
+        EXPECT_TRUE(buf->push(i));
+    }
+    EXPECT_TRUE(buf->full());
+    EXPECT_FALSE(buf->push(100));
+
+    int item = -1;
+    EXPECT_TRUE(buf->pop(item));
+    EXPECT_EQ(item, 0);
+    EXPECT_FALSE(buf->full());
+}
+
+TEST_F(TestSPSCCircularBuffer, fifo_order_across_wrap)
+{
+    int item = -1;
+    // Move the indexes close to the wrap point, then fill over it.
+    for (int i = 0; i < TEST_BUFFER_SIZE - 2; i++) {
+        EXPECT_TRUE(buf->push(i));
+        EXPECT_TRUE(buf->pop(item));
+    }
+    for (int i = 0; i < TEST_BUFFER_SIZE; i++) {
+        EXPECT_TRUE(buf->push(i));
+    }
+    for (int i = 0; i < TEST_BUFFER_SIZE; i++) {
+        EXPECT_TRUE(buf->pop(item));
+        EXPECT_EQ(item, i);
+    }
+    EXPECT_TRUE(buf->empty());
+}
+
+TEST_F(TestSPSCCircularBuffer, peek_keeps_element)
+{
+    int item = 0;
+    buf->push(42);
+    EXPECT_TRUE(buf->peek(item));
+    EXPECT_EQ(item, 42);
+    EXPECT_EQ(buf->size(), 1);
+    EXPECT_TRUE(buf->pop(item));
+    EXPECT_EQ(item, 42);
+}
+
+TEST_F(TestSPSCCircularBuffer, bulk_push_pop)
+{
+    int src[TEST_BUFFER_SIZE + 5];
+    int dest[TEST_BUFFER_SIZE + 5];
+    for (int i = 0; i < TEST_BUFFER_SIZE + 5; i++) {
+        src[i] = i;
+    }
+    // Only the capacity fits; the rest is refused, not overwritten.
+    EXPECT_EQ(buf->push(src, TEST_BUFFER_SIZE + 5), TEST_BUFFER_SIZE);
+    EXPECT_EQ(buf->pop(dest, TEST_BUFFER_SIZE + 5), TEST_BUFFER_SIZE);
+    for (int i = 0; i < TEST_BUFFER_SIZE; i++) {
+        EXPECT_EQ(dest[i], i);
+    }
+}
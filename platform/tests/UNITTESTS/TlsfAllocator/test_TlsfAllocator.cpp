@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2021, Arm Limited and affiliates
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+#include "mbed_tlsf.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#define TEST_POOL_SIZE (16 * 1024)
+
+/* The allocator lazily adopts the region described by these symbols,
+ * normally provided by the target boot code */
+extern "C" {
+    unsigned char *mbed_heap_start;
+    uint32_t mbed_heap_size;
+}
+
+static uint64_t pool_storage[TEST_POOL_SIZE / sizeof(uint64_t)];
+
+struct free_counts {
+    size_t blocks;
+    size_t largest;
+};
+
+static void count_visit(size_t size, void *context)
+{
+    free_counts *c = static_cast<free_counts *>(context);
+    c->blocks++;
+    if (size > c->largest) {
+        c->largest = size;
+    }
+}
+
+static free_counts free_state()
+{
+    free_counts c = {0, 0};
+    mbed_tlsf_free_blocks_visit(count_visit, &c);
+    return c;
+}
+
+class TestTlsfAllocator : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        mbed_heap_start = reinterpret_cast<unsigned char *>(pool_storage);
+        mbed_heap_size = TEST_POOL_SIZE;
+    }
+};
+
+TEST_F(TestTlsfAllocator, malloc_returns_distinct_aligned_blocks)
+{
+    void *a = mbed_tlsf_malloc(100);
+    void *b = mbed_tlsf_malloc(1);
+    ASSERT_TRUE(a);
+    ASSERT_TRUE(b);
+    EXPECT_NE(a, b);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(a) % 8, 0);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(b) % 8, 0);
+    mbed_tlsf_free(a);
+    mbed_tlsf_free(b);
+}
+
+TEST_F(TestTlsfAllocator, malloc_fails_when_no_fit_exists)
+{
+    EXPECT_EQ(mbed_tlsf_malloc(TEST_POOL_SIZE), nullptr);
+    EXPECT_EQ(mbed_tlsf_malloc((size_t)1 << 31), nullptr);
+}
+
+TEST_F(TestTlsfAllocator, free_coalesces_neighbours)
+{
+    free_counts before = free_state();
+    EXPECT_EQ(before.blocks, 1u);
+
+    void *a = mbed_tlsf_malloc(200);
+    void *b = mbed_tlsf_malloc(200);
+    void *c = mbed_tlsf_malloc(200);
+    ASSERT_TRUE(a && b && c);
+
+    // Punch a hole, then fill it back in - the pool must fully coalesce
+    mbed_tlsf_free(b);
+    free_counts holed = free_state();
+    EXPECT_EQ(holed.blocks, 2u);
+
+    mbed_tlsf_free(a);
+    mbed_tlsf_free(c);
+    free_counts after = free_state();
+    EXPECT_EQ(after.blocks, 1u);
+    EXPECT_EQ(after.largest, before.largest);
+}
+
+TEST_F(TestTlsfAllocator, near_largest_free_block_is_allocatable)
+{
+    free_counts state = free_state();
+    ASSERT_EQ(state.blocks, 1u);
+
+    // Good-fit search rounds the request up one second-level size class,
+    // so leave that much slack below the largest free block
+    size_t size = state.largest - sizeof(size_t) - (state.largest >> 4);
+    void *p = mbed_tlsf_malloc(size);
+    ASSERT_TRUE(p);
+    memset(p, 0xa5, size);
+    mbed_tlsf_free(p);
+    EXPECT_EQ(free_state().largest, state.largest);
+}
+
+TEST_F(TestTlsfAllocator, realloc_preserves_contents)
+{
+    char *p = static_cast<char *>(mbed_tlsf_malloc(64));
+    ASSERT_TRUE(p);
+    memset(p, 0x5a, 64);
+
+    char *q = static_cast<char *>(mbed_tlsf_realloc(p, 500));
+    ASSERT_TRUE(q);
+    for (int i = 0; i < 64; i++) {
+        ASSERT_EQ(q[i], 0x5a);
+    }
+
+    // Shrinking stays in place
+    EXPECT_EQ(mbed_tlsf_realloc(q, 10), q);
+    mbed_tlsf_free(q);
+}
+
+TEST_F(TestTlsfAllocator, calloc_zeroes_and_checks_overflow)
+{
+    uint32_t *p = static_cast<uint32_t *>(mbed_tlsf_calloc(32, sizeof(uint32_t)));
+    ASSERT_TRUE(p);
+    for (int i = 0; i < 32; i++) {
+        ASSERT_EQ(p[i], 0u);
+    }
+    mbed_tlsf_free(p);
+
+    EXPECT_EQ(mbed_tlsf_calloc((size_t)-1, 8), nullptr);
+}
+
+TEST_F(TestTlsfAllocator, memalign_returns_aligned_usable_blocks)
+{
+    free_counts before = free_state();
+
+    void *p = mbed_tlsf_memalign(256, 100);
+    ASSERT_TRUE(p);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(p) % 256, 0);
+    memset(p, 0xff, 100);
+    mbed_tlsf_free(p);
+
+    // Carving the alignment gap must not leak or fragment permanently
+    EXPECT_EQ(free_state().largest, before.largest);
+}
+
+TEST_F(TestTlsfAllocator, free_null_is_a_no_op)
+{
+    mbed_tlsf_free(nullptr);
+}
+
+TEST_F(TestTlsfAllocator, block_total_size_covers_request)
+{
+    void *p = mbed_tlsf_malloc(100);
+    ASSERT_TRUE(p);
+    EXPECT_GE(mbed_tlsf_block_total_size(p), 100u + sizeof(size_t));
+    mbed_tlsf_free(p);
+}
@@ -33,8 +33,15 @@ bool core_util_atomic_cas_u16(volatile uint16_t *ptr, uint16_t *expectedCurrentV
 }
 
 
+/* A real (sequential) CAS, so that code under test built around the
+ * standard compare-and-swap retry loop terminates */
 bool core_util_atomic_cas_u32(volatile uint32_t *ptr, uint32_t *expectedCurrentValue, uint32_t desiredValue)
 {
+    if (*ptr == *expectedCurrentValue) {
+        *ptr = desiredValue;
+        return true;
+    }
+    *expectedCurrentValue = *ptr;
     return false;
 }
 
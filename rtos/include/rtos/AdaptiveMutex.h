@@ -0,0 +1,136 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2019 ARM Limited
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ADAPTIVE_MUTEX_H
+#define ADAPTIVE_MUTEX_H
+
+#include <stdint.h>
+
+#include "rtos/Semaphore.h"
+#include "rtos/mbed_rtos_types.h"
+
+#include "platform/NonCopyable.h"
+
+#ifndef MBED_NO_GLOBAL_USING_DIRECTIVE
+using namespace rtos;
+#endif
+
+namespace rtos {
+/** \addtogroup rtos-public-api */
+/** @{*/
+
+/**
+ * \defgroup rtos_AdaptiveMutex AdaptiveMutex class
+ * @{
+ */
+
+/** The AdaptiveMutex class synchronizes threads with an atomic fast path
+ * that avoids the kernel entirely when the lock is uncontended.
+ *
+ * lock() and unlock() are each a single compare-and-swap on an owner word
+ * when no other thread holds the lock - a handful of cycles instead of the
+ * SVC round trip a Mutex always pays. Only a thread that actually finds the
+ * lock held spins briefly and then parks on a kernel semaphore, and only an
+ * unlock that sees parked waiters enters the kernel to wake one.
+ *
+ * The trade-offs against Mutex, which make this class suitable for short,
+ * leaf-level critical sections such as driver register access rather than
+ * as a general replacement:
+ * - No priority inheritance: because the kernel never learns who owns the
+ *   lock on the fast path, a low-priority holder is not boosted when a
+ *   high-priority thread contends. Keep hold times short and do not block
+ *   while holding the lock.
+ * - Not recursive: locking twice from the same thread deadlocks.
+ *
+ * In bare-metal builds, the AdaptiveMutex class is a dummy, so lock() and
+ * unlock() are no-ops.
+ *
+ * @note You cannot use member functions of this class in ISR context.
+ *
+ * @note
+ * Memory considerations: The owner word and wakeup semaphore are part of
+ * this class; no RTOS object is created for the mutex itself.
+ */
+class AdaptiveMutex : private mbed::NonCopyable<AdaptiveMutex> {
+public:
+    /** Create and Initialize an AdaptiveMutex object
+     *
+     * @note You cannot call this function from ISR context.
+    */
+    AdaptiveMutex();
+
+    /**
+      Wait until the AdaptiveMutex becomes available.
+
+      @note You cannot call this function from ISR context.
+     */
+    void lock();
+
+    /** Try to lock the AdaptiveMutex, and return immediately.
+
+      @return true if the mutex was acquired, false otherwise.
+
+      @note You cannot call this function from ISR context.
+     */
+    bool trylock();
+
+    /**
+      Unlock the AdaptiveMutex that has previously been locked by the same thread.
+
+      @note You cannot call this function from ISR context.
+     */
+    void unlock();
+
+#if MBED_CONF_RTOS_PRESENT
+private:
+    void lock_slow();
+
+    void *volatile _owner;
+    uint32_t _waiters;
+    Semaphore _wakeup;
+#endif
+};
+
+#if !MBED_CONF_RTOS_PRESENT
+inline AdaptiveMutex::AdaptiveMutex()
+{
+}
+
+inline void AdaptiveMutex::lock()
+{
+}
+
+inline bool AdaptiveMutex::trylock()
+{
+    return true;
+}
+
+inline void AdaptiveMutex::unlock()
+{
+}
+#endif
+
+/** @}*/
+/** @}*/
+}
+
+#endif
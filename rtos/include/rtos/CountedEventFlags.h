@@ -0,0 +1,146 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2019 ARM Limited
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef COUNTED_EVENT_FLAG_H
+#define COUNTED_EVENT_FLAG_H
+
+#include <stdint.h>
+#include "rtos/Kernel.h"
+#include "rtos/EventFlags.h"
+#include "rtos/mbed_rtos_types.h"
+
+#include "platform/NonCopyable.h"
+
+namespace rtos {
+/** \addtogroup rtos-public-api */
+/** @{*/
+
+/**
+ * \defgroup rtos_CountedEventFlags CountedEventFlags class
+ * @{
+ */
+
+/** The CountedEventFlags class multiplexes many event sources onto one
+ * wait, draining every pending source in a single kernel call.
+ *
+ * Each set() counts as well as signals, so a flag raised five times
+ * between drains reports a count of five instead of collapsing to a
+ * single bit. A drain atomically fetches-and-clears all set flags and
+ * their counts, letting a consumer thread process one burst of activity
+ * from all its sources in one scheduling round rather than one wakeup
+ * per source.
+ *
+ * Counts are taken just before the flag is raised, so a count can at
+ * worst be reported one drain earlier than its flag; no set is ever
+ * lost or double counted across drains.
+
+ @note
+ CountedEventFlags support 31 flags. The MSB flag is ignored. It is used to return an error code (@a osFlagsError).
+
+ @note
+ Memory considerations: The control structures and the per-flag counters will be created on the current thread's stack,
+ both for the Mbed OS and underlying RTOS objects (static or dynamic RTOS memory pools are not being used).
+*/
+class CountedEventFlags : private mbed::NonCopyable<CountedEventFlags> {
+public:
+    /** Number of usable flags; the MSB is reserved for error returns. */
+    static const uint32_t num_flags = 31;
+
+    /** Create and initialize a CountedEventFlags object.
+     *
+     * @note You cannot call this function from ISR context.
+    */
+    CountedEventFlags();
+
+    /** Create and initialize a CountedEventFlags object.
+
+     @param name name to be used for this CountedEventFlags. It has to stay allocated for the lifetime of the thread.
+
+     @note You cannot call this function from ISR context.
+    */
+    CountedEventFlags(const char *name);
+
+    /** Set the specified event flags, counting each occurrence.
+      @param   flags the flags that will be set.
+      @return  event flags after setting or error code if highest bit set (see @a osFlagsError for details).
+
+      @note This function may be called from ISR context.
+     */
+    uint32_t set(uint32_t flags);
+
+    /** Fetch-and-clear all set flags and their counts, without waiting.
+      @param   counts array of num_flags elements; entry i receives the number
+               of times flag (1 << i) was set since it was last drained, or 0
+               for flags not in the returned mask.
+      @return  mask of flags that were set, 0 if none were pending, or error
+               code if highest bit set (see @a osFlagsError for details).
+
+      @note You may call this function from ISR context.
+     */
+    uint32_t drain(uint32_t counts[num_flags]);
+
+    /** Wait for any flag to become signaled, then fetch-and-clear all set
+      flags and their counts in the same kernel call.
+      @param   counts   array of num_flags elements, filled as for drain().
+      @param   millisec timeout value (default: osWaitForever).
+      @return  mask of flags that were set or error code if highest bit set
+               (see @a osFlagsError for details).
+
+      @note This function may be called from ISR context if the millisec parameter is set to 0.
+     */
+    uint32_t wait_drain(uint32_t counts[num_flags], uint32_t millisec = osWaitForever);
+
+    /** Wait for any flag to become signaled, then fetch-and-clear all set
+      flags and their counts in the same kernel call.
+      @param   counts   array of num_flags elements, filled as for drain().
+      @param   rel_time timeout value.
+      @return  mask of flags that were set or error code if highest bit set
+               (see @a osFlagsError for details).
+
+      @note This function may be called from ISR context if the rel_time parameter is set to 0.
+     */
+    uint32_t wait_drain_for(uint32_t counts[num_flags], Kernel::Clock::duration_u32 rel_time);
+
+    /** Wait for any flag to become signaled, then fetch-and-clear all set
+      flags and their counts in the same kernel call.
+      @param   counts   array of num_flags elements, filled as for drain().
+      @param   abs_time timeout value.
+      @return  mask of flags that were set or error code if highest bit set
+               (see @a osFlagsError for details).
+
+      @note You cannot call this function from ISR context.
+     */
+    uint32_t wait_drain_until(uint32_t counts[num_flags], Kernel::Clock::time_point abs_time);
+
+private:
+    uint32_t collect(uint32_t flags, uint32_t counts[num_flags]);
+
+    EventFlags _flags;
+    uint32_t _counts[num_flags];
+};
+
+/** @}*/
+/** @}*/
+
+}
+
+#endif
@@ -0,0 +1,290 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2019 ARM Limited
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef MAILBOX_H
+#define MAILBOX_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "rtos/Kernel.h"
+#include "rtos/EventFlags.h"
+#include "rtos/mbed_rtos_types.h"
+
+#include "platform/mbed_atomic.h"
+#include "platform/mbed_assert.h"
+#include "platform/NonCopyable.h"
+
+#ifndef MBED_NO_GLOBAL_USING_DIRECTIVE
+using namespace rtos;
+#endif
+
+#if MBED_CONF_RTOS_PRESENT || defined(DOXYGEN_ONLY)
+
+namespace rtos {
+/** \addtogroup rtos-public-api */
+/** @{*/
+
+/**
+ * \defgroup rtos_Mailbox Mailbox class
+ * @{
+ */
+
+/** The Mailbox class provides lock-free, copy-free messaging from multiple
+ * producers to a single consumer.
+ *
+ * Unlike Mail, the send path never enters the kernel: producers claim a slot
+ * in a fixed ring with an atomic compare-and-swap, construct the message in
+ * place, and publish it with a release store. The consumer receives messages
+ * in claim order and reads them in place; only a consumer that finds the ring
+ * empty blocks, using EventFlags, and only a producer that observes a blocked
+ * consumer signals them. Messages therefore cross threads without a copy and
+ * without SVC overhead on the hot path.
+ *
+ * There must be at most one consumer - only one thread may call the get and
+ * free functions. Any number of threads or interrupt handlers may produce.
+ *
+ * @tparam  T         Data type of a single message.
+ * @tparam  queue_sz  Maximum number of messages in the ring. Must be a power
+ *                    of two.
+ *
+ * @note
+ * Memory considerations: The message store and control structures are part of
+ * this class - they do not allocate memory on the heap.
+ *
+ * @note
+ * Bare metal profile: This class is not supported.
+ */
+template<typename T, uint32_t queue_sz>
+class Mailbox : private mbed::NonCopyable<Mailbox<T, queue_sz> > {
+    static_assert(queue_sz > 0, "Invalid mailbox size. Must be greater than 0.");
+    static_assert((queue_sz & (queue_sz - 1)) == 0, "Invalid mailbox size. Must be a power of two.");
+
+public:
+    /** Create and initialize an empty Mailbox.
+     *
+     * @note You cannot call this function from ISR context.
+     */
+    Mailbox(): _claim_pos(0), _get_pos(0), _consumer_waiting(false)
+    {
+        // each cell is free when its sequence equals the next claim position
+        // that maps to it; claiming advances it by one, freeing by queue_sz
+        for (uint32_t i = 0; i < queue_sz; i++) {
+            _cells[i].seq = i;
+        }
+    }
+
+    /** Check if the mailbox is empty.
+     *
+     * @return State of the mailbox.
+     * @retval true  Mailbox has no published messages.
+     * @retval false Mailbox contains at least one published message.
+     *
+     * @note You may call this function from ISR context.
+     */
+    bool empty() const
+    {
+        uint32_t pos = _get_pos;
+        uint32_t seq = core_util_atomic_load_explicit_u32(&_cells[pos & (queue_sz - 1)].seq, mbed_memory_order_acquire);
+        return seq != pos + 1;
+    }
+
+    /** Check if the mailbox is full.
+     *
+     * @return State of the mailbox.
+     * @retval true  Mailbox is full.
+     * @retval false Mailbox has at least one free slot.
+     *
+     * @note You may call this function from ISR context.
+     */
+    bool full() const
+    {
+        uint32_t pos = core_util_atomic_load_explicit_u32(&_claim_pos, mbed_memory_order_relaxed);
+        uint32_t seq = core_util_atomic_load_explicit_u32(&_cells[pos & (queue_sz - 1)].seq, mbed_memory_order_acquire);
+        return (int32_t)(seq - pos) < 0;
+    }
+
+    /** Claim a message slot to fill in place, without blocking.
+     *
+     * The slot's memory is uninitialized; the caller constructs or writes
+     * the message into it and then makes it visible with Mailbox::put. A
+     * claimed slot that is never put is lost until the mailbox is destroyed.
+     *
+     * @return Pointer to a message slot to fill, or nullptr if the ring is full.
+     *
+     * @note You may call this function from ISR context.
+     */
+    T *try_claim()
+    {
+        uint32_t pos = core_util_atomic_load_explicit_u32(&_claim_pos, mbed_memory_order_relaxed);
+        for (;;) {
+            cell_t *cell = &_cells[pos & (queue_sz - 1)];
+            uint32_t seq = core_util_atomic_load_explicit_u32(&cell->seq, mbed_memory_order_acquire);
+            int32_t diff = (int32_t)(seq - pos);
+            if (diff < 0) {
+                // cell still holds the message from one lap ago - ring is full
+                return nullptr;
+            }
+            if (diff == 0 &&
+                    core_util_atomic_compare_exchange_weak_explicit_u32(&_claim_pos, &pos, pos + 1,
+                                                                        mbed_memory_order_relaxed, mbed_memory_order_relaxed)) {
+                return reinterpret_cast<T *>(cell->data);
+            }
+            // another producer took this position (or the weak exchange
+            // failed spuriously) - pos was reloaded by the exchange
+            if (diff > 0) {
+                pos = core_util_atomic_load_explicit_u32(&_claim_pos, mbed_memory_order_relaxed);
+            }
+        }
+    }
+
+    /** Publish a claimed message slot to the consumer.
+     *
+     * @param   mptr  Message slot previously claimed with Mailbox::try_claim.
+     *
+     * @note You may call this function from ISR context.
+     */
+    void put(T *mptr)
+    {
+        cell_t *cell = cell_of(mptr);
+        core_util_atomic_store_explicit_u32(&cell->seq, cell->seq + 1, mbed_memory_order_release);
+        // only wake the consumer if they are (or are about to start) blocking;
+        // this keeps the uncontended publish free of kernel calls
+        if (core_util_atomic_load_bool(&_consumer_waiting)) {
+            _flags.set(1);
+        }
+    }
+
+    /** Get the oldest published message, without blocking.
+     *
+     * The message is read in place and must be returned with Mailbox::free
+     * once consumed.
+     *
+     * @return Pointer to the received message, or nullptr if none is published.
+     *
+     * @note You may call this function from ISR context.
+     */
+    T *try_get()
+    {
+        cell_t *cell = &_cells[_get_pos & (queue_sz - 1)];
+        uint32_t seq = core_util_atomic_load_explicit_u32(&cell->seq, mbed_memory_order_acquire);
+        if (seq != _get_pos + 1) {
+            return nullptr;
+        }
+        _get_pos++;
+        return reinterpret_cast<T *>(cell->data);
+    }
+
+    /** Get the oldest published message, optionally blocking.
+     *
+     * @param rel_time Timeout value or Kernel::wait_for_u32_forever.
+     *
+     * @return Pointer to the received message, or nullptr if none arrived in time.
+     *
+     * @note You may call this function from ISR context if the rel_time parameter is set to 0.
+     */
+    T *try_get_for(Kernel::Clock::duration_u32 rel_time)
+    {
+        T *mptr = try_get();
+        if (mptr || rel_time == rel_time.zero()) {
+            return mptr;
+        }
+        if (rel_time == Kernel::wait_for_u32_forever) {
+            return try_get_until(Kernel::Clock::time_point::max());
+        }
+        return try_get_until(Kernel::Clock::now() + rel_time);
+    }
+
+    /** Get the oldest published message, blocking until an absolute timeout.
+     *
+     * @param abs_time Absolute timeout time, referenced to Kernel::Clock.
+     *
+     * @return Pointer to the received message, or nullptr if none arrived in time.
+     *
+     * @note You cannot call this function from ISR context.
+     */
+    T *try_get_until(Kernel::Clock::time_point abs_time)
+    {
+        T *mptr;
+        for (;;) {
+            // the flag must be raised before the recheck so a message
+            // published between the two is guaranteed to signal us
+            core_util_atomic_store_bool(&_consumer_waiting, true);
+            mptr = try_get();
+            if (mptr) {
+                break;
+            }
+            if (abs_time == Kernel::Clock::time_point::max()) {
+                _flags.wait_any(1);
+            } else {
+                if (Kernel::Clock::now() >= abs_time) {
+                    break;
+                }
+                _flags.wait_any_until(1, abs_time);
+            }
+        }
+        core_util_atomic_store_bool(&_consumer_waiting, false);
+        return mptr;
+    }
+
+    /** Return a consumed message's slot to the ring.
+     *
+     * Slots must be freed in the order their messages were received.
+     *
+     * @param mptr Pointer to the message that was obtained with Mailbox::try_get.
+     *
+     * @note You may call this function from ISR context.
+     */
+    void free(T *mptr)
+    {
+        cell_t *cell = cell_of(mptr);
+        // the cell's sequence is one past the position it was claimed at;
+        // move it one full lap on so the producers can claim it again
+        core_util_atomic_store_explicit_u32(&cell->seq, cell->seq + queue_sz - 1, mbed_memory_order_release);
+    }
+
+private:
+    struct cell_t {
+        uint32_t seq;
+        alignas(T) char data[sizeof(T)];
+    };
+
+    static cell_t *cell_of(T *mptr)
+    {
+        return reinterpret_cast<cell_t *>(reinterpret_cast<char *>(mptr) - offsetof(cell_t, data));
+    }
+
+    cell_t _cells[queue_sz];
+    uint32_t _claim_pos;
+    uint32_t _get_pos;
+    bool _consumer_waiting;
+    EventFlags _flags;
+};
+
+/** @}*/
+/** @}*/
+
+}
+
+#endif
+
+#endif
@@ -24,11 +24,20 @@
 #define THIS_THREAD_H
 
 #include <stdint.h>
+#include <chrono>
+#include <ratio>
+#include <type_traits>
 #include "platform/mbed_toolchain.h"
 #include "rtos/Kernel.h"
 #include "rtos/mbed_rtos_types.h"
 
 namespace rtos {
+
+namespace internal {
+/** \internal Microsecond-resolution sleep backing the sub-millisecond
+ *  ThisThread::sleep_for overload */
+void hires_sleep_for(std::chrono::microseconds rel_time);
+}
 /** \addtogroup rtos-public-api */
 /** @{*/
 
@@ -222,6 +231,22 @@ void sleep_for(uint32_t millisec);
 */
 void sleep_for(Kernel::Clock::duration_u32 rel_time);
 
+/** Sleep for a specified time period, at microsecond resolution:
+  @param   rel_time  time delay value
+  @note This overload is selected for durations with a period finer than the
+        kernel tick, such as `250us`. The wake-up is programmed on the
+        microsecond ticker for the exact deadline instead of being rounded up
+        to the next kernel tick; waits of more than one tick spend the bulk of
+        the time in the ordinary kernel delay and only the final stretch on
+        the microsecond ticker. On targets without a microsecond ticker the
+        duration is rounded up to the next kernel tick.
+  @note You cannot call this function from ISR context.
+*/
+template <typename Rep, typename Period, typename std::enable_if<std::ratio_less<Period, std::milli>::value, int>::type = 0>
+void sleep_for(std::chrono::duration<Rep, Period> rel_time)
+{
+    internal::hires_sleep_for(std::chrono::duration_cast<std::chrono::microseconds>(rel_time));
+}
 
 /** Sleep until a specified time in millisec
   The specified time is according to Kernel::get_ms_count().
@@ -0,0 +1,308 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2019 ARM Limited
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <new>
+
+#include "rtos/Kernel.h"
+#include "rtos/Thread.h"
+#include "rtos/Semaphore.h"
+#include "rtos/mbed_rtos_types.h"
+
+#include "platform/Callback.h"
+#include "platform/mbed_atomic.h"
+#include "platform/mbed_assert.h"
+#include "platform/NonCopyable.h"
+
+#ifndef MBED_NO_GLOBAL_USING_DIRECTIVE
+using namespace rtos;
+#endif
+
+#if MBED_CONF_RTOS_PRESENT || defined(DOXYGEN_ONLY)
+
+namespace rtos {
+/** \addtogroup rtos-public-api */
+/** @{*/
+
+/**
+ * \defgroup rtos_ThreadPool ThreadPool class
+ * @{
+ */
+
+/** The ThreadPool class runs queued jobs on a fixed set of pre-spawned
+ * worker threads.
+ *
+ * Spawning a Thread per work item costs a stack allocation and a kernel
+ * object; a pool pays that once at start and then runs any number of jobs.
+ * Each worker owns a lock-free ring of jobs. Submission distributes jobs
+ * round-robin across the rings without taking a lock or allocating, and a
+ * worker that drains its own ring steals from its neighbours' rings before
+ * going back to sleep, so one long-running job does not strand queued work
+ * behind it.
+ *
+ * Jobs are mbed::Callback<void()> stored by value in the rings; anything
+ * that fits in a Callback is submitted without allocation. Jobs may be
+ * submitted from any thread, or from ISR context with try_submit.
+ *
+ * @tparam  pool_sz   Number of worker threads.
+ * @tparam  queue_sz  Capacity of each worker's job ring. Must be a power
+ *                    of two.
+ *
+ * @note
+ * Memory considerations: The job rings and thread control blocks are part of
+ * this class; worker stacks are allocated by Thread when the pool starts.
+ *
+ * @note
+ * Bare metal profile: This class is not supported.
+ */
+template<uint32_t pool_sz, uint32_t queue_sz = 16>
+class ThreadPool : private mbed::NonCopyable<ThreadPool<pool_sz, queue_sz> > {
+    static_assert(pool_sz > 0, "Invalid pool size. Must be greater than 0.");
+    static_assert(queue_sz > 0, "Invalid job ring size. Must be greater than 0.");
+    static_assert((queue_sz & (queue_sz - 1)) == 0, "Invalid job ring size. Must be a power of two.");
+
+public:
+    /** Create a ThreadPool without starting its workers.
+     *
+     * @param   priority    Priority the worker threads run at (default: osPriorityNormal).
+     * @param   stack_size  Stack size of each worker thread (default: OS_STACK_SIZE).
+     *
+     * @note You cannot call this function from ISR context.
+     */
+    ThreadPool(osPriority priority = osPriorityNormal, uint32_t stack_size = OS_STACK_SIZE):
+        _priority(priority), _stack_size(stack_size), _next(0), _running(false)
+    {
+    }
+
+    /** ThreadPool destructor. Stops and joins the workers.
+     *
+     * Jobs still queued when the pool is destroyed are dropped.
+     *
+     * @note You cannot call this function from ISR context.
+     */
+    ~ThreadPool()
+    {
+        stop();
+    }
+
+    /** Spawn the worker threads and start executing queued jobs.
+     *
+     * @return  Status code that indicates the execution status of the
+     *          function (osOK on success). If a worker fails to start, the
+     *          workers already started are stopped again.
+     *
+     * @note You cannot call this function from ISR context.
+     */
+    osStatus start()
+    {
+        MBED_ASSERT(!_running);
+        _running = true;
+        for (uint32_t i = 0; i < pool_sz; i++) {
+            _contexts[i].pool = this;
+            _contexts[i].index = i;
+            _workers[i] = new (&_worker_mem[i]) Thread(_priority, _stack_size);
+            osStatus status = _workers[i]->start(mbed::callback(&ThreadPool::worker_entry, &_contexts[i]));
+            if (status != osOK) {
+                _workers[i]->~Thread();
+                _workers[i] = nullptr;
+                stop();
+                return status;
+            }
+        }
+        return osOK;
+    }
+
+    /** Stop and join the worker threads.
+     *
+     * Jobs already running complete; jobs still queued are dropped.
+     *
+     * @note You cannot call this function from ISR context.
+     */
+    void stop()
+    {
+        if (!_running) {
+            return;
+        }
+        core_util_atomic_store_bool(&_running, false);
+        for (uint32_t i = 0; i < pool_sz; i++) {
+            _work_tokens.release();
+        }
+        for (uint32_t i = 0; i < pool_sz; i++) {
+            if (_workers[i]) {
+                _workers[i]->join();
+                _workers[i]->~Thread();
+                _workers[i] = nullptr;
+            }
+        }
+        for (uint32_t i = 0; i < pool_sz; i++) {
+            mbed::Callback<void()> job;
+            while (_rings[i].try_pop(&job)) {
+            }
+        }
+    }
+
+    /** Queue a job for execution on a worker thread, without blocking.
+     *
+     * @param   job  Job to execute; stored by value.
+     *
+     * @return  true if the job was queued, false if every ring was full.
+     *
+     * @note You may call this function from ISR context.
+     */
+    bool try_submit(mbed::Callback<void()> job)
+    {
+        uint32_t home = core_util_atomic_incr_u32(&_next, 1) % pool_sz;
+        for (uint32_t i = 0; i < pool_sz; i++) {
+            if (_rings[(home + i) % pool_sz].try_push(job)) {
+                _work_tokens.release();
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    // fixed ring of callbacks with per-cell sequence counters; both ends
+    // claim positions by compare-and-swap, so any worker can steal from it
+    struct job_ring {
+        struct cell_t {
+            uint32_t seq;
+            alignas(mbed::Callback<void()>) char data[sizeof(mbed::Callback<void()>)];
+        };
+
+        job_ring(): _push_pos(0), _pop_pos(0)
+        {
+            for (uint32_t i = 0; i < queue_sz; i++) {
+                _cells[i].seq = i;
+            }
+        }
+
+        bool try_push(const mbed::Callback<void()> &job)
+        {
+            uint32_t pos = core_util_atomic_load_explicit_u32(&_push_pos, mbed_memory_order_relaxed);
+            for (;;) {
+                cell_t *cell = &_cells[pos & (queue_sz - 1)];
+                uint32_t seq = core_util_atomic_load_explicit_u32(&cell->seq, mbed_memory_order_acquire);
+                int32_t diff = (int32_t)(seq - pos);
+                if (diff < 0) {
+                    return false;
+                }
+                if (diff == 0 &&
+                        core_util_atomic_compare_exchange_weak_explicit_u32(&_push_pos, &pos, pos + 1,
+                                                                            mbed_memory_order_relaxed, mbed_memory_order_relaxed)) {
+                    new (cell->data) mbed::Callback<void()>(job);
+                    core_util_atomic_store_explicit_u32(&cell->seq, pos + 1, mbed_memory_order_release);
+                    return true;
+                }
+                if (diff > 0) {
+                    pos = core_util_atomic_load_explicit_u32(&_push_pos, mbed_memory_order_relaxed);
+                }
+            }
+        }
+
+        bool try_pop(mbed::Callback<void()> *job)
+        {
+            uint32_t pos = core_util_atomic_load_explicit_u32(&_pop_pos, mbed_memory_order_relaxed);
+            for (;;) {
+                cell_t *cell = &_cells[pos & (queue_sz - 1)];
+                uint32_t seq = core_util_atomic_load_explicit_u32(&cell->seq, mbed_memory_order_acquire);
+                int32_t diff = (int32_t)(seq - (pos + 1));
+                if (diff < 0) {
+                    return false;
+                }
+                if (diff == 0 &&
+                        core_util_atomic_compare_exchange_weak_explicit_u32(&_pop_pos, &pos, pos + 1,
+                                                                            mbed_memory_order_relaxed, mbed_memory_order_relaxed)) {
+                    mbed::Callback<void()> *stored = reinterpret_cast<mbed::Callback<void()> *>(cell->data);
+                    *job = *stored;
+                    stored->~Callback();
+                    core_util_atomic_store_explicit_u32(&cell->seq, pos + queue_sz, mbed_memory_order_release);
+                    return true;
+                }
+                if (diff > 0) {
+                    pos = core_util_atomic_load_explicit_u32(&_pop_pos, mbed_memory_order_relaxed);
+                }
+            }
+        }
+
+        uint32_t _push_pos;
+        uint32_t _pop_pos;
+        cell_t _cells[queue_sz];
+    };
+
+    struct worker_ctx {
+        ThreadPool *pool;
+        uint32_t index;
+    };
+
+    static void worker_entry(worker_ctx *ctx)
+    {
+        ctx->pool->worker(ctx->index);
+    }
+
+    void worker(uint32_t index)
+    {
+        while (core_util_atomic_load_bool(&_running)) {
+            _work_tokens.acquire();
+
+            // drain our own ring, then steal from the neighbours; tokens and
+            // jobs are not strictly paired, so a fruitless wakeup just sleeps
+            // again and the job's own token wakes whoever can run it
+            mbed::Callback<void()> job;
+            bool found;
+            do {
+                found = false;
+                for (uint32_t i = 0; i < pool_sz; i++) {
+                    if (_rings[(index + i) % pool_sz].try_pop(&job)) {
+                        found = true;
+                        job();
+                    }
+                }
+            } while (found);
+        }
+    }
+
+    osPriority _priority;
+    uint32_t _stack_size;
+    uint32_t _next;
+    bool _running;
+    Semaphore _work_tokens;
+    job_ring _rings[pool_sz];
+    worker_ctx _contexts[pool_sz];
+    Thread *_workers[pool_sz] = {};
+    struct alignas(Thread) worker_mem {
+        char mem[sizeof(Thread)];
+    } _worker_mem[pool_sz];
+};
+
+/** @}*/
+/** @}*/
+
+}
+
+#endif
+
+#endif
@@ -27,13 +27,17 @@
 #include "rtos/internal/mbed_rtos_storage.h"
 #include "rtos/Kernel.h"
 #include "rtos/Thread.h"
+#include "rtos/ThreadPool.h"
 #include "rtos/ThisThread.h"
 #include "rtos/Mutex.h"
+#include "rtos/AdaptiveMutex.h"
 #include "rtos/Semaphore.h"
 #include "rtos/Mail.h"
+#include "rtos/Mailbox.h"
 #include "rtos/MemoryPool.h"
 #include "rtos/Queue.h"
 #include "rtos/EventFlags.h"
+#include "rtos/CountedEventFlags.h"
 #include "rtos/ConditionVariable.h"
 
 
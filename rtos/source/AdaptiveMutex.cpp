@@ -0,0 +1,100 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2019 ARM Limited
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "rtos/AdaptiveMutex.h"
+
+#include "platform/mbed_atomic.h"
+#include "platform/mbed_assert.h"
+
+#if MBED_CONF_RTOS_PRESENT
+
+/* How many times a contending thread re-checks the owner word before
+ * parking on the semaphore. Only useful on multi-core targets, where the
+ * holder may be mid-critical-section on the other CPU; on a single core
+ * the holder cannot be running, so contenders park immediately. */
+#ifndef MBED_CONF_RTOS_ADAPTIVE_MUTEX_SPIN
+#if defined(MBED_CONF_TARGET_CORE_COUNT) && (MBED_CONF_TARGET_CORE_COUNT > 1)
+#define MBED_CONF_RTOS_ADAPTIVE_MUTEX_SPIN 16
+#else
+#define MBED_CONF_RTOS_ADAPTIVE_MUTEX_SPIN 0
+#endif
+#endif
+
+namespace rtos {
+
+AdaptiveMutex::AdaptiveMutex(): _owner(nullptr), _waiters(0)
+{
+}
+
+void AdaptiveMutex::lock()
+{
+    void *expected = nullptr;
+    if (core_util_atomic_cas_ptr(&_owner, &expected, osThreadGetId())) {
+        return;
+    }
+    lock_slow();
+}
+
+bool AdaptiveMutex::trylock()
+{
+    void *expected = nullptr;
+    return core_util_atomic_cas_ptr(&_owner, &expected, osThreadGetId());
+}
+
+void AdaptiveMutex::lock_slow()
+{
+    void *me = osThreadGetId();
+    MBED_ASSERT(core_util_atomic_load_ptr(&_owner) != me);
+
+    for (;;) {
+        for (int i = 0; i < MBED_CONF_RTOS_ADAPTIVE_MUTEX_SPIN; i++) {
+            void *expected = nullptr;
+            if (core_util_atomic_cas_ptr(&_owner, &expected, me)) {
+                return;
+            }
+        }
+
+        // the waiter count must be raised before the final attempt so an
+        // unlock between the attempt and the park is guaranteed to wake us
+        core_util_atomic_incr_u32(&_waiters, 1);
+        void *expected = nullptr;
+        if (core_util_atomic_cas_ptr(&_owner, &expected, me)) {
+            core_util_atomic_decr_u32(&_waiters, 1);
+            return;
+        }
+        _wakeup.acquire();
+        core_util_atomic_decr_u32(&_waiters, 1);
+    }
+}
+
+void AdaptiveMutex::unlock()
+{
+    MBED_ASSERT(core_util_atomic_load_ptr(&_owner) == osThreadGetId());
+    core_util_atomic_store_ptr(&_owner, nullptr);
+    if (core_util_atomic_load_u32(&_waiters) > 0) {
+        _wakeup.release();
+    }
+}
+
+}
+
+#endif
@@ -0,0 +1,89 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2019 ARM Limited
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "rtos/CountedEventFlags.h"
+
+#include <string.h>
+#include "platform/mbed_atomic.h"
+
+namespace rtos {
+
+#define ALL_FLAGS 0x7fffffff
+
+CountedEventFlags::CountedEventFlags(): _flags(), _counts()
+{
+}
+
+CountedEventFlags::CountedEventFlags(const char *name): _flags(name), _counts()
+{
+}
+
+uint32_t CountedEventFlags::set(uint32_t flags)
+{
+    // count before raising the bit, so a drain that observes the flag also
+    // observes the count; a count can at worst arrive one drain early
+    for (uint32_t i = 0; i < num_flags; i++) {
+        if (flags & (1u << i)) {
+            core_util_atomic_incr_u32(&_counts[i], 1);
+        }
+    }
+    return _flags.set(flags);
+}
+
+uint32_t CountedEventFlags::drain(uint32_t counts[num_flags])
+{
+    return collect(_flags.clear(ALL_FLAGS), counts);
+}
+
+uint32_t CountedEventFlags::wait_drain(uint32_t counts[num_flags], uint32_t millisec)
+{
+    return collect(_flags.wait_any(ALL_FLAGS, millisec, true), counts);
+}
+
+uint32_t CountedEventFlags::wait_drain_for(uint32_t counts[num_flags], Kernel::Clock::duration_u32 rel_time)
+{
+    return collect(_flags.wait_any_for(ALL_FLAGS, rel_time, true), counts);
+}
+
+uint32_t CountedEventFlags::wait_drain_until(uint32_t counts[num_flags], Kernel::Clock::time_point abs_time)
+{
+    return collect(_flags.wait_any_until(ALL_FLAGS, abs_time, true), counts);
+}
+
+uint32_t CountedEventFlags::collect(uint32_t flags, uint32_t counts[num_flags])
+{
+    if (flags & osFlagsError) {
+        memset(counts, 0, num_flags * sizeof(counts[0]));
+        return flags;
+    }
+
+    for (uint32_t i = 0; i < num_flags; i++) {
+        if (flags & (1u << i)) {
+            counts[i] = core_util_atomic_exchange_u32(&_counts[i], 0);
+        } else {
+            counts[i] = 0;
+        }
+    }
+    return flags;
+}
+
+}
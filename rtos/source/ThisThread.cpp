@@ -31,6 +31,13 @@
 #include "platform/mbed_critical.h"
 #include "platform/internal/mbed_os_timer.h"
 
+#if DEVICE_USTICKER
+#include "drivers/Timeout.h"
+#if MBED_CONF_RTOS_PRESENT
+#include "rtos/Semaphore.h"
+#endif
+#endif
+
 using std::milli;
 using std::chrono::duration;
 using rtos::Kernel::Clock;
@@ -229,6 +236,74 @@ void ThisThread::sleep_for(Clock::duration_u32 rel_time)
 #endif
 }
 
+#if DEVICE_USTICKER
+
+#if MBED_CONF_RTOS_PRESENT
+static void hires_sleep_release(Semaphore *sem)
+{
+    sem->release();
+}
+#else
+static void hires_sleep_expire(bool *expired)
+{
+    core_util_atomic_store_bool(expired, true);
+}
+
+static bool hires_sleep_check(void *handle)
+{
+    return core_util_atomic_load_bool(static_cast<bool *>(handle));
+}
+#endif
+
+void internal::hires_sleep_for(std::chrono::microseconds rel_time)
+{
+    if (rel_time <= rel_time.zero()) {
+        return;
+    }
+
+    mbed::HighResClock::time_point wake_time = mbed::HighResClock::now() + rel_time;
+
+#if MBED_CONF_RTOS_PRESENT
+    // Waits of more than one tick spend all whole ticks but the last in the
+    // ordinary kernel delay, keeping scheduling and tickless sleep behaviour
+    // normal; shorter waits bypass the tick quantization entirely.
+    Clock::duration_u32 ticks = std::chrono::duration_cast<Clock::duration_u32>(rel_time);
+    if (ticks > Clock::duration_u32(1)) {
+        osStatus_t status = osDelay(ticks.count() - 1);
+        MBED_ASSERT(status == osOK);
+        (void) status;
+    }
+
+    if (mbed::HighResClock::now() >= wake_time) {
+        return;
+    }
+
+    // The final stretch is programmed on the microsecond ticker for the
+    // exact deadline; the timeout handler runs in interrupt context and
+    // releases the semaphore the thread is suspended on.
+    Semaphore sem(0, 1);
+    mbed::Timeout timeout;
+    timeout.attach_absolute(mbed::callback(hires_sleep_release, &sem), wake_time);
+    sem.acquire();
+#else
+    bool expired = false;
+    mbed::Timeout timeout;
+    timeout.attach_absolute(mbed::callback(hires_sleep_expire, &expired), wake_time);
+    mbed::internal::do_untimed_sleep(hires_sleep_check, &expired);
+#endif
+}
+
+#else // DEVICE_USTICKER
+
+void internal::hires_sleep_for(std::chrono::microseconds rel_time)
+{
+    // No microsecond ticker - round up to the next kernel tick
+    using namespace std::chrono;
+    ThisThread::sleep_for(duration_cast<Clock::duration_u32>(rel_time + duration<int64_t, milli>(1) - microseconds(1)));
+}
+
+#endif // DEVICE_USTICKER
+
 void ThisThread::sleep_until(uint64_t millisec)
 {
     ThisThread::sleep_until(Clock::time_point(duration<uint64_t, milli>(millisec)));
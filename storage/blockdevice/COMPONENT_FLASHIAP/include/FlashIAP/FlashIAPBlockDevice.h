@@ -24,6 +24,10 @@
 #include "blockdevice/BlockDevice.h"
 #include "platform/mbed_toolchain.h"
 
+#if FLASHIAP_BD_DEFERRED_TRIM
+#include "platform/PlatformMutex.h"
+#endif
+
 /** BlockDevice using the FlashIAP API
  *
  */
@@ -136,6 +140,34 @@ public:
     */
     virtual bool is_valid_erase(mbed::bd_addr_t addr, mbed::bd_size_t size) const;
 
+#if FLASHIAP_BD_DEFERRED_TRIM
+    /** Mark blocks as no longer in use
+     *
+     *  Queues the sectors for erasure in the background: one sector is
+     *  erased per dispatch of the shared event queue, so the erase latency
+     *  stays off the caller's critical path. A direct erase() of a queued
+     *  sector removes it from the queue. Queued sectors that have not been
+     *  erased by the time the device is deinitialized are dropped, which is
+     *  harmless as trim is only a hint.
+     *
+     *  @param addr     Address of block to mark as unused
+     *  @param size     Size to mark as unused in bytes, must be a multiple of erase block size
+     *  @return         0 on success, negative error code on failure
+     */
+    virtual int trim(mbed::bd_addr_t addr, mbed::bd_size_t size);
+#endif
+
+#if FLASHIAP_BD_ERASE_COUNTERS
+    /** Get the number of times a sector has been erased since init
+     *
+     *  Counts both direct and deferred erases, so wear distribution across
+     *  the device can be sampled at runtime.
+     *
+     *  @param addr     Address within the sector
+     *  @return         Number of erases of the sector containing addr
+     */
+    uint32_t get_erase_count(mbed::bd_addr_t addr) const;
+#endif
 
 private:
     // Device configuration
@@ -144,6 +176,20 @@ private:
     mbed::bd_size_t _size;
     bool _is_initialized;
     uint32_t _init_ref_count;
+
+#if FLASHIAP_BD_DEFERRED_TRIM || FLASHIAP_BD_ERASE_COUNTERS
+    uint32_t _sector_cnt;
+    uint32_t _sector_index(mbed::bd_addr_t virtual_address) const;
+#endif
+#if FLASHIAP_BD_ERASE_COUNTERS
+    uint32_t *_erase_count;
+#endif
+#if FLASHIAP_BD_DEFERRED_TRIM
+    uint8_t *_pending_erase;
+    int _trim_event_id;
+    PlatformMutex _trim_mutex;
+    void _deferred_erase_step();
+#endif
 };
 
 #endif /* DEVICE_FLASH */
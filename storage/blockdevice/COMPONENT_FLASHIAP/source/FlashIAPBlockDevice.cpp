@@ -21,8 +21,13 @@
 #include "mbed_atomic.h"
 #include "mbed_error.h"
 
+#if FLASHIAP_BD_DEFERRED_TRIM
+#include "events/mbed_shared_queues.h"
+#endif
+
 using namespace mbed;
 #include <inttypes.h>
+#include <string.h>
 
 #define FLASHIAP_READ_SIZE 1
 
@@ -44,6 +49,16 @@ FlashIAPBlockDevice::FlashIAPBlockDevice(uint32_t address, uint32_t size)
         MBED_ERROR(MBED_ERROR_INVALID_ARGUMENT,
                    "Base address and size need to be set in flashiap-block-device configuration in order to use default constructor");
     }
+#if FLASHIAP_BD_DEFERRED_TRIM || FLASHIAP_BD_ERASE_COUNTERS
+    _sector_cnt = 0;
+#endif
+#if FLASHIAP_BD_ERASE_COUNTERS
+    _erase_count = 0;
+#endif
+#if FLASHIAP_BD_DEFERRED_TRIM
+    _pending_erase = 0;
+    _trim_event_id = 0;
+#endif
 }
 
 FlashIAPBlockDevice::~FlashIAPBlockDevice()
@@ -90,6 +105,25 @@ int FlashIAPBlockDevice::init()
         _size = _flash.get_flash_size() - (_base - _flash.get_flash_start());
     }
 
+#if FLASHIAP_BD_DEFERRED_TRIM || FLASHIAP_BD_ERASE_COUNTERS
+    _sector_cnt = 0;
+    for (bd_addr_t addr = _base; addr < _base + _size; addr += _flash.get_sector_size(addr)) {
+        _sector_cnt++;
+    }
+#endif
+#if FLASHIAP_BD_ERASE_COUNTERS
+    if (!_erase_count) {
+        _erase_count = new uint32_t[_sector_cnt];
+        memset(_erase_count, 0, _sector_cnt * sizeof(uint32_t));
+    }
+#endif
+#if FLASHIAP_BD_DEFERRED_TRIM
+    if (!_pending_erase) {
+        _pending_erase = new uint8_t[(_sector_cnt + 7) / 8];
+        memset(_pending_erase, 0, (_sector_cnt + 7) / 8);
+    }
+#endif
+
     _is_initialized = true;
     return ret;
 }
@@ -111,6 +145,21 @@ int FlashIAPBlockDevice::deinit()
 
     _is_initialized = false;
 
+#if FLASHIAP_BD_DEFERRED_TRIM
+    _trim_mutex.lock();
+    if (_trim_event_id) {
+        mbed_event_queue()->cancel(_trim_event_id);
+        _trim_event_id = 0;
+    }
+    delete[] _pending_erase;
+    _pending_erase = 0;
+    _trim_mutex.unlock();
+#endif
+#if FLASHIAP_BD_ERASE_COUNTERS
+    delete[] _erase_count;
+    _erase_count = 0;
+#endif
+
     return _flash.deinit();
 }
 
@@ -178,13 +227,148 @@ int FlashIAPBlockDevice::erase(bd_addr_t virtual_address,
         /* Convert virtual address to the physical address for the device. */
         bd_addr_t physical_address = _base + virtual_address;
 
+#if FLASHIAP_BD_DEFERRED_TRIM
+        /* Serialize with the deferred erase step and drop queued trims for
+         * these sectors - they are about to be erased anyway */
+        _trim_mutex.lock();
+        if (_pending_erase) {
+            for (bd_addr_t addr = virtual_address; addr < virtual_address + size;
+                    addr += _flash.get_sector_size(_base + addr)) {
+                uint32_t index = _sector_index(addr);
+                _pending_erase[index / 8] &= ~(1 << (index % 8));
+            }
+        }
+#endif
+
         /* Erase sector */
         result = _flash.erase(physical_address, size);
+
+#if FLASHIAP_BD_DEFERRED_TRIM
+        _trim_mutex.unlock();
+#endif
+
+#if FLASHIAP_BD_ERASE_COUNTERS
+        if (result == 0) {
+            for (bd_addr_t addr = virtual_address; addr < virtual_address + size;
+                    addr += _flash.get_sector_size(_base + addr)) {
+                core_util_atomic_incr_u32(&_erase_count[_sector_index(addr)], 1);
+            }
+        }
+#endif
     }
 
     return result;
 }
 
+#if FLASHIAP_BD_DEFERRED_TRIM || FLASHIAP_BD_ERASE_COUNTERS
+uint32_t FlashIAPBlockDevice::_sector_index(bd_addr_t virtual_address) const
+{
+    uint32_t index = 0;
+    bd_addr_t addr = _base;
+
+    while (addr + _flash.get_sector_size(addr) <= _base + virtual_address) {
+        addr += _flash.get_sector_size(addr);
+        index++;
+    }
+
+    return index;
+}
+#endif
+
+#if FLASHIAP_BD_ERASE_COUNTERS
+uint32_t FlashIAPBlockDevice::get_erase_count(bd_addr_t addr) const
+{
+    if (!_is_initialized || !_erase_count || (addr >= _size)) {
+        return 0;
+    }
+
+    return core_util_atomic_load_u32(&_erase_count[_sector_index(addr)]);
+}
+#endif
+
+#if FLASHIAP_BD_DEFERRED_TRIM
+int FlashIAPBlockDevice::trim(bd_addr_t virtual_address, bd_size_t size)
+{
+    DEBUG_PRINTF("trim: %" PRIX64 " %" PRIX64 "\r\n", virtual_address, size);
+
+    if (!_is_initialized || !is_valid_erase(virtual_address, size)) {
+        return BD_ERROR_DEVICE_ERROR;
+    }
+
+    _trim_mutex.lock();
+
+    for (bd_addr_t addr = virtual_address; addr < virtual_address + size;
+            addr += _flash.get_sector_size(_base + addr)) {
+        uint32_t index = _sector_index(addr);
+        _pending_erase[index / 8] |= 1 << (index % 8);
+    }
+
+    if (!_trim_event_id) {
+        _trim_event_id = mbed_event_queue()->call(
+                             mbed::callback(this, &FlashIAPBlockDevice::_deferred_erase_step));
+    }
+
+    _trim_mutex.unlock();
+    return BD_ERROR_OK;
+}
+
+void FlashIAPBlockDevice::_deferred_erase_step()
+{
+    _trim_mutex.lock();
+    _trim_event_id = 0;
+
+    if (!_is_initialized || !_pending_erase) {
+        _trim_mutex.unlock();
+        return;
+    }
+
+    /* Find the first queued sector */
+    uint32_t index = 0;
+    bd_addr_t addr = _base;
+    while ((index < _sector_cnt) && !(_pending_erase[index / 8] & (1 << (index % 8)))) {
+        addr += _flash.get_sector_size(addr);
+        index++;
+    }
+
+    if (index == _sector_cnt) {
+        _trim_mutex.unlock();
+        return;
+    }
+
+    _pending_erase[index / 8] &= ~(1 << (index % 8));
+
+    /* One sector per dispatch keeps each stall of the shared queue bounded.
+     * The mutex stays held over the erase so a concurrent erase() of the
+     * same sector can't complete and be programmed over before this one
+     * finishes. */
+    int result = _flash.erase(addr, _flash.get_sector_size(addr));
+
+#if FLASHIAP_BD_ERASE_COUNTERS
+    if (result == 0) {
+        core_util_atomic_incr_u32(&_erase_count[index], 1);
+    }
+#else
+    (void)result;
+#endif
+
+    if (_is_initialized && _pending_erase && !_trim_event_id) {
+        bool any_pending = false;
+        for (uint32_t i = 0; i < (_sector_cnt + 7) / 8; i++) {
+            if (_pending_erase[i]) {
+                any_pending = true;
+                break;
+            }
+        }
+        if (any_pending) {
+            _trim_event_id = mbed_event_queue()->call(
+                                 mbed::callback(this, &FlashIAPBlockDevice::_deferred_erase_step));
+        }
+    }
+
+    _trim_mutex.unlock();
+}
+#endif // FLASHIAP_BD_DEFERRED_TRIM
+
 bd_size_t FlashIAPBlockDevice::get_read_size() const
 {
     DEBUG_PRINTF("get_read_size: %d\r\n", FLASHIAP_READ_SIZE);
@@ -192,7 +192,8 @@ OSPIFBlockDevice::OSPIFBlockDevice(PinName io0, PinName io1, PinName io2, PinNam
                                    int clock_mode, int freq)
     : _ospi(io0, io1, io2, io3, io4, io5, io6, io7, sclk, csel, dqs, clock_mode), _csel(csel), _freq(freq),
       _init_ref_count(0),
-      _is_initialized(false)
+      _is_initialized(false),
+      _xip_read_base(NULL)
 {
     _unique_device_status = add_new_csel_instance(csel);
 
@@ -403,6 +404,13 @@ int OSPIFBlockDevice::deinit()
 int OSPIFBlockDevice::read(void *buffer, bd_addr_t addr, bd_size_t size)
 {
     int status = OSPIF_BD_ERROR_OK;
+
+    if (_xip_read_base != NULL) {
+        // Flash is memory-mapped - no command phase, no locking needed.
+        memcpy(buffer, _xip_read_base + addr, size);
+        return status;
+    }
+
     tr_debug("Read Inst: 0x%xh", _read_instruction);
 
 #ifdef MX_FLASH_SUPPORT_RWW
@@ -451,6 +459,20 @@ int OSPIFBlockDevice::read(void *buffer, bd_addr_t addr, bd_size_t size)
     return status;
 }
 
+void OSPIFBlockDevice::enable_xip_reads(const void *base)
+{
+    _mutex.lock();
+    _xip_read_base = static_cast<const uint8_t *>(base);
+    _mutex.unlock();
+}
+
+void OSPIFBlockDevice::disable_xip_reads()
+{
+    _mutex.lock();
+    _xip_read_base = NULL;
+    _mutex.unlock();
+}
+
 int OSPIFBlockDevice::program(const void *buffer, bd_addr_t addr, bd_size_t size)
 {
     ospi_status_t result = OSPI_STATUS_OK;
@@ -167,6 +167,28 @@ public:
      */
     virtual int read(void *buffer, mbed::bd_addr_t addr, mbed::bd_size_t size);
 
+    /** Serve reads from a memory-mapped (XIP) window instead of read commands
+     *
+     *  On controllers that map the flash into the MCU address space, a read
+     *  becomes a plain memcpy from the mapped window, skipping the
+     *  command/address/dummy phases and the driver locking that dominate
+     *  small-read latency. The QSPI HAL has no entry point to configure
+     *  memory-mapped mode, so the target/application code must have placed
+     *  the controller in memory-mapped mode already; this call only tells
+     *  the block device where the window is. Block device offset 0 must
+     *  correspond to @p base.
+     *
+     *  Erase and program still go through command mode; on most controllers
+     *  they implicitly suspend the mapping, so avoid concurrent mapped reads
+     *  while writing.
+     *
+     *  @param base  Address at which flash offset 0 is memory-mapped
+     */
+    void enable_xip_reads(const void *base);
+
+    /** Return reads to command mode after enable_xip_reads() */
+    void disable_xip_reads();
+
     /** Program blocks to a block device
      *
      *  The blocks must have been erased prior to being programmed
@@ -394,6 +416,9 @@ private:
 
     uint32_t _init_ref_count;
     bool _is_initialized;
+
+    // Memory-mapped window for XIP reads, or NULL to use read commands
+    const uint8_t *_xip_read_base;
 };
 
 #endif
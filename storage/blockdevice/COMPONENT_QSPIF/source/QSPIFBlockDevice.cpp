@@ -131,7 +131,8 @@ QSPIFBlockDevice::QSPIFBlockDevice(PinName io0, PinName io1, PinName io2, PinNam
     :
     _qspi(io0, io1, io2, io3, sclk, csel, clock_mode), _csel(csel), _freq(freq),
     _init_ref_count(0),
-    _is_initialized(false)
+    _is_initialized(false),
+    _xip_read_base(NULL)
 {
     _unique_device_status = add_new_csel_instance(csel);
 
@@ -314,6 +315,13 @@ int QSPIFBlockDevice::deinit()
 int QSPIFBlockDevice::read(void *buffer, bd_addr_t addr, bd_size_t size)
 {
     int status = QSPIF_BD_ERROR_OK;
+
+    if (_xip_read_base != NULL) {
+        // Flash is memory-mapped - no command phase, no locking needed.
+        memcpy(buffer, _xip_read_base + addr, size);
+        return status;
+    }
+
     tr_debug("Read Inst: 0x%xh", _read_instruction);
 
     _mutex.lock();
@@ -329,6 +337,20 @@ int QSPIFBlockDevice::read(void *buffer, bd_addr_t addr, bd_size_t size)
 
 }
 
+void QSPIFBlockDevice::enable_xip_reads(const void *base)
+{
+    _mutex.lock();
+    _xip_read_base = static_cast<const uint8_t *>(base);
+    _mutex.unlock();
+}
+
+void QSPIFBlockDevice::disable_xip_reads()
+{
+    _mutex.lock();
+    _xip_read_base = NULL;
+    _mutex.unlock();
+}
+
 int QSPIFBlockDevice::program(const void *buffer, bd_addr_t addr, bd_size_t size)
 {
     qspi_status_t result = QSPI_STATUS_OK;
@@ -30,6 +30,10 @@
 #include "platform/PlatformMutex.h"
 #include "hal/static_pinmap.h"
 
+#if SD_ASYNC_SPI_ENABLED
+#include "rtos/EventFlags.h"
+#endif
+
 #ifndef MBED_CONF_SD_SPI_MOSI
 #define MBED_CONF_SD_SPI_MOSI NC
 #endif
@@ -51,6 +55,9 @@
 #ifndef MBED_CONF_SD_CRC_ENABLED
 #define MBED_CONF_SD_CRC_ENABLED 0
 #endif
+#ifndef MBED_CONF_SD_STALL_THRESHOLD
+#define MBED_CONF_SD_STALL_THRESHOLD 50     /*!< Busy waits at least this long (ms) count as stalls */
+#endif
 
 /** SDBlockDevice class
  *
@@ -192,6 +199,70 @@ public:
      */
     virtual const char *get_type() const;
 
+    /** Card busy-wait latency statistics
+     *
+     * Consumer cards stall for hundreds of milliseconds when their
+     * internal garbage collection runs; the stall shows up as the busy
+     * wait before the card accepts the next command. Every busy wait is
+     * timed, so these statistics describe the card actually fitted.
+     */
+    struct latency_stats_t {
+        uint32_t samples;   /**< Busy waits observed */
+        uint32_t last_us;   /**< Duration of the most recent wait */
+        uint32_t max_us;    /**< Longest wait observed */
+        uint32_t avg_us;    /**< Moving average, weighted to recent waits */
+        uint32_t stalls;    /**< Waits of at least MBED_CONF_SD_STALL_THRESHOLD ms */
+    };
+
+    /** Get the busy-wait latency statistics
+     *
+     *  @param stats    Filled with the statistics gathered so far
+     */
+    void get_latency_stats(latency_stats_t *stats);
+
+    /** Reset the busy-wait latency statistics */
+    void clear_latency_stats();
+
+    /** Give the card idle time for internal maintenance
+     *
+     * Keeps the card selected and clocked for up to max_ms so its
+     * internal garbage collection can run off the critical path. Call
+     * from an idle point in the write pipeline - between video clips,
+     * not between frames - to make the card less likely to stall a
+     * later program().
+     *
+     *  @param max_ms   Time to spend clocking the card, in milliseconds
+     *  @return         BD_ERROR_OK(0) - success
+     *                  SD_BLOCK_DEVICE_ERROR_NO_INIT - device is not initialized
+     */
+    int maintain(uint32_t max_ms);
+
+    /** Set the deadline for program_deferrable()
+     *
+     *  @param deadline_ms  Longest acceptable wait for the card to
+     *                      accept a write, in milliseconds, 0 to disable
+     *                      deferring
+     */
+    void set_write_deadline(uint32_t deadline_ms);
+
+    /** Program blocks unless the card is too busy to meet the deadline
+     *
+     * Behaves as program(), except that when a write deadline is set
+     * and the card does not come ready within it - typically because
+     * internal garbage collection is running - no data is sent and
+     * SD_BLOCK_DEVICE_ERROR_WOULD_BLOCK is returned. The caller keeps
+     * the data queued and retries later, instead of stalling on the
+     * spot; use plain program() for writes that must land regardless.
+     *
+     *  @param buffer   Buffer of data to write to blocks
+     *  @param addr     Address of block to begin writing to
+     *  @param size     Size to write in bytes. Must be a multiple of program block size
+     *  @return         BD_ERROR_OK(0) - success
+     *                  SD_BLOCK_DEVICE_ERROR_WOULD_BLOCK - deadline would be missed, nothing written
+     *                  or any error program() can return
+     */
+    int program_deferrable(const void *buffer, mbed::bd_addr_t addr, mbed::bd_size_t size);
+
 private:
     /* Commands : Listed below are commands supported
      * in SPI mode for SD card : Only Mandatory ones
@@ -268,6 +339,7 @@ private:
 
     bool _wait_token(uint8_t token);        /**< Wait for token */
     bool _wait_ready(std::chrono::duration<uint32_t, std::milli> timeout = std::chrono::milliseconds{300});    /**< 300ms default wait for card to be ready */
+    void _record_busy_wait(uint32_t wait_us);
     int _read(uint8_t *buffer, uint32_t length);
     int _read_bytes(uint8_t *buffer, uint32_t length);
     uint8_t _write(const uint8_t *buffer, uint8_t token, uint32_t length);
@@ -275,6 +347,22 @@ private:
     void _preclock_then_select();
     void _postclock_then_deselect();
 
+#if SD_ASYNC_SPI_ENABLED
+    /*  Run a data-phase transfer through the asynchronous SPI API, so the
+     *  data moves by DMA (where the target supports it) while the calling
+     *  thread sleeps. Falls back to a synchronous transfer if the
+     *  asynchronous one can't be started.
+     *
+     *  @param rx_buffer  Receive buffer, NULL for a write-only transfer
+     *  @param tx_buffer  Transmit buffer, NULL for a read-only transfer
+     *  @param length     Transfer length in bytes
+     *  @return           0 on success, -1 on transfer error
+     */
+    int _transfer_data(uint8_t *rx_buffer, const uint8_t *tx_buffer, uint32_t length);
+    void _async_spi_callback(int event);
+    rtos::EventFlags _async_spi_flags;  /**< Signals data-phase transfer completion */
+#endif
+
     virtual void lock()
     {
         _mutex.lock();
@@ -291,6 +379,8 @@ private:
     bool _is_initialized;
     bool _dbg;
     uint32_t _init_ref_count;
+    latency_stats_t _latency;
+    uint32_t _write_deadline_ms;
 
 #if MBED_CONF_SD_CRC_ENABLED
     bool _crc_on;
@@ -164,6 +164,14 @@ using namespace std::chrono;
 #endif
 
 
+#if SD_ASYNC_SPI_ENABLED
+#if !DEVICE_SPI_ASYNCH
+#error "SD_ASYNC_SPI_ENABLED requires a target with asynchronous SPI support"
+#endif
+#define SD_ASYNC_SPI_EVENT_DONE                  (1UL << 0)
+#define SD_ASYNC_SPI_EVENT_ERROR                 (1UL << 1)
+#endif
+
 #define SD_COMMAND_TIMEOUT                       milliseconds{MBED_CONF_SD_CMD_TIMEOUT}
 #define SD_CMD0_GO_IDLE_STATE_RETRIES            MBED_CONF_SD_CMD0_IDLE_STATE_RETRIES
 #define SD_DBG                                   0      /*!< 1 - Enable debugging */
@@ -270,6 +278,8 @@ SDBlockDevice::SDBlockDevice(PinName mosi, PinName miso, PinName sclk, PinName c
     _transfer_sck = hz;
 
     _erase_size = BLOCK_SIZE_HC;
+    _latency = {};
+    _write_deadline_ms = 0;
 }
 
 #if MBED_CONF_SD_CRC_ENABLED
@@ -291,6 +301,8 @@ SDBlockDevice::SDBlockDevice(const spi_pinmap_t &spi_pinmap, PinName cs, uint64_
     _transfer_sck = hz;
 
     _erase_size = BLOCK_SIZE_HC;
+    _latency = {};
+    _write_deadline_ms = 0;
 }
 
 SDBlockDevice::~SDBlockDevice()
@@ -673,6 +685,84 @@ int SDBlockDevice::frequency(uint64_t freq)
     return err;
 }
 
+void SDBlockDevice::get_latency_stats(latency_stats_t *stats)
+{
+    lock();
+    *stats = _latency;
+    unlock();
+}
+
+void SDBlockDevice::clear_latency_stats()
+{
+    lock();
+    _latency = {};
+    unlock();
+}
+
+int SDBlockDevice::maintain(uint32_t max_ms)
+{
+    lock();
+    if (!_is_initialized) {
+        unlock();
+        return SD_BLOCK_DEVICE_ERROR_NO_INIT;
+    }
+
+    // SPI mode has no sleep/standby transition to provoke housekeeping
+    // with; what the card's controller needs is clock. Keep the card
+    // selected and clocked for the whole window so internal garbage
+    // collection runs now instead of under a deadline-critical write
+    _preclock_then_select();
+    _wait_ready(std::chrono::duration<uint32_t, std::milli> {max_ms});
+    mbed::Timer timer;
+    timer.start();
+    while (timer.elapsed_time() < std::chrono::duration<uint32_t, std::milli> {max_ms}) {
+        _spi.write(SPI_FILL_CHAR);
+    }
+    _postclock_then_deselect();
+    unlock();
+    return BD_ERROR_OK;
+}
+
+void SDBlockDevice::set_write_deadline(uint32_t deadline_ms)
+{
+    lock();
+    _write_deadline_ms = deadline_ms;
+    unlock();
+}
+
+int SDBlockDevice::program_deferrable(const void *buffer, bd_addr_t addr, bd_size_t size)
+{
+    if (!is_valid_program(addr, size)) {
+        return SD_BLOCK_DEVICE_ERROR_PARAMETER;
+    }
+
+    lock();
+    if (!_is_initialized) {
+        unlock();
+        return SD_BLOCK_DEVICE_ERROR_NO_INIT;
+    }
+
+    if (_write_deadline_ms) {
+        // Probe the card first: if it does not come ready within the
+        // deadline the write cannot meet it either, so send nothing
+        // and let the caller keep the data queued. The probe itself
+        // feeds the latency statistics
+        _preclock_then_select();
+        bool ready = _wait_ready(std::chrono::duration<uint32_t, std::milli> {_write_deadline_ms});
+        _postclock_then_deselect();
+        if (!ready) {
+            unlock();
+            return SD_BLOCK_DEVICE_ERROR_WOULD_BLOCK;
+        }
+    }
+
+    // The mutex is recursive, so the card cannot go busy again between
+    // the probe and the write
+    int status = program(buffer, addr, size);
+    unlock();
+    return status;
+}
+
 // PRIVATE FUNCTIONS
 int SDBlockDevice::_freq(void)
 {
@@ -939,6 +1029,38 @@ int SDBlockDevice::_read_bytes(uint8_t *buffer, uint32_t length)
     return 0;
 }
 
+#if SD_ASYNC_SPI_ENABLED
+void SDBlockDevice::_async_spi_callback(int event)
+{
+    if (event & SPI_EVENT_COMPLETE) {
+        _async_spi_flags.set(SD_ASYNC_SPI_EVENT_DONE);
+    } else {
+        _async_spi_flags.set(SD_ASYNC_SPI_EVENT_ERROR);
+    }
+}
+
+int SDBlockDevice::_transfer_data(uint8_t *rx_buffer, const uint8_t *tx_buffer, uint32_t length)
+{
+    _async_spi_flags.clear(SD_ASYNC_SPI_EVENT_DONE | SD_ASYNC_SPI_EVENT_ERROR);
+
+    if (_spi.transfer(tx_buffer, tx_buffer ? length : 0, rx_buffer, rx_buffer ? length : 0,
+                      mbed::callback(this, &SDBlockDevice::_async_spi_callback), SPI_EVENT_ALL) != 0) {
+        // Peripheral busy - fall back to a synchronous transfer
+        _spi.write((const char *)tx_buffer, tx_buffer ? length : 0,
+                   (char *)rx_buffer, rx_buffer ? length : 0);
+        return 0;
+    }
+
+    uint32_t flags = _async_spi_flags.wait_any(SD_ASYNC_SPI_EVENT_DONE | SD_ASYNC_SPI_EVENT_ERROR);
+    if (flags & SD_ASYNC_SPI_EVENT_ERROR) {
+        debug_if(SD_DBG, "Asynchronous SPI transfer failed\n");
+        return -1;
+    }
+
+    return 0;
+}
+#endif // SD_ASYNC_SPI_ENABLED
+
 int SDBlockDevice::_read(uint8_t *buffer, uint32_t length)
 {
     uint16_t crc;
@@ -950,7 +1072,13 @@ int SDBlockDevice::_read(uint8_t *buffer, uint32_t length)
     }
 
     // read data
+#if SD_ASYNC_SPI_ENABLED
+    if (_transfer_data(buffer, NULL, length) != 0) {
+        return SD_BLOCK_DEVICE_ERROR_NO_RESPONSE;
+    }
+#else
     _spi.write(NULL, 0, (char *)buffer, length);
+#endif
 
     // Read the CRC16 checksum for the data block
     crc = (_spi.write(SPI_FILL_CHAR) << 8);
@@ -983,7 +1111,14 @@ uint8_t SDBlockDevice::_write(const uint8_t *buffer, uint8_t token, uint32_t len
     _spi.write(token);
 
     // write the data
+#if SD_ASYNC_SPI_ENABLED
+    if (_transfer_data(NULL, buffer, length) != 0) {
+        // Not a valid data response token - caller reports a write error
+        return 0;
+    }
+#else
     _spi.write((char *)buffer, length, NULL, 0);
+#endif
 
 #if MBED_CONF_SD_CRC_ENABLED
     if (_crc_on) {
@@ -1105,17 +1240,36 @@ bool SDBlockDevice::_wait_token(uint8_t token)
 bool SDBlockDevice::_wait_ready(std::chrono::duration<uint32_t, std::milli> timeout)
 {
     uint8_t response;
+    bool ready = false;
     _spi_timer.reset();
     _spi_timer.start();
     do {
         response = _spi.write(SPI_FILL_CHAR);
         if (response == 0xFF) {
-            _spi_timer.stop();
-            return true;
+            ready = true;
+            break;
         }
     } while (_spi_timer.elapsed_time() < timeout);
     _spi_timer.stop();
-    return false;
+    _record_busy_wait(std::chrono::duration_cast<std::chrono::microseconds>(_spi_timer.elapsed_time()).count());
+    return ready;
+}
+
+// Busy waits are where the card's internal garbage collection stalls
+// surface, so each one is timed to learn the behaviour of the card
+// actually fitted. Callers hold the mutex
+void SDBlockDevice::_record_busy_wait(uint32_t wait_us)
+{
+    _latency.samples++;
+    _latency.last_us = wait_us;
+    if (wait_us > _latency.max_us) {
+        _latency.max_us = wait_us;
+    }
+    // Exponential moving average, recent waits weighted 1/8
+    _latency.avg_us += (int32_t)(wait_us - _latency.avg_us) / 8;
+    if (wait_us >= MBED_CONF_SD_STALL_THRESHOLD * 1000u) {
+        _latency.stalls++;
+    }
 }
 
 // SPI function to wait for count
@@ -38,6 +38,12 @@
 #ifndef MBED_CONF_SPIF_DRIVER_SPI_FREQ
 #define MBED_CONF_SPIF_DRIVER_SPI_FREQ 40000000
 #endif
+// Use FAST READ (0x0B) when the device carries SFDP tables - set to 0 to
+// stay on the legacy READ (0x03) instruction, whose clock ceiling is lower
+// on most parts
+#ifndef MBED_CONF_SPIF_DRIVER_FAST_READ
+#define MBED_CONF_SPIF_DRIVER_FAST_READ 1
+#endif
 
 /** Enum spif standard error codes
  *
@@ -52,6 +58,33 @@ enum spif_bd_error {
     SPIF_BD_ERROR_INVALID_ERASE_PARAMS  = -4005, /* Erase command not on sector aligned addresses or exceeds device size */
 };
 
+/** Enum spif read bus modes
+ *
+ *  @enum spif_read_mode
+ */
+enum spif_read_mode {
+    SPIF_READ_MODE_LEGACY_READ = 0, /*!< READ (0x03), no dummy cycles */
+    SPIF_READ_MODE_FAST_READ   = 1, /*!< FAST READ (0x0B), 8 dummy cycles */
+};
+
+/** Read mode negotiated at init and the capabilities behind it
+ *
+ *  The SPI bus moves data on a single line in each direction, so the dual
+ *  and quad fast read modes a part may advertise in its SFDP tables can't
+ *  be driven from here - they need the QSPI peripheral and QSPIFBlockDevice.
+ *  The capability flags tell you when the part could go faster on different
+ *  pins than the mode that was actually selected.
+ */
+typedef struct {
+    spif_read_mode read_mode;       /*!< Read mode in use */
+    int read_instruction;           /*!< Read instruction in use */
+    uint8_t read_bus_width;         /*!< Data lines used by reads, always 1 on the SPI bus */
+    uint8_t dummy_cycles;           /*!< Dummy cycles of the read instruction */
+    bool dual_capable;              /*!< Part advertises a dual fast read in SFDP */
+    bool quad_capable;              /*!< Part advertises a quad fast read in SFDP */
+    uint32_t read_bandwidth_kbps;   /*!< Measured read throughput in kbit/s */
+} spif_performance_profile_t;
+
 
 /** BlockDevice for SFDP based flash devices over SPI bus
  *
@@ -216,6 +249,19 @@ public:
      */
     virtual const char *get_type() const;
 
+    /** Get the read mode negotiated at init and measure read bandwidth
+     *
+     *  Fills in the selected read instruction and bus configuration, the
+     *  dual/quad capabilities the part advertised in its SFDP tables, and
+     *  the read throughput measured by timing a short read burst from the
+     *  device.
+     *
+     *  @param profile  Filled with the performance profile
+     *  @return         SPIF_BD_ERROR_OK(0) - success
+     *                  SPIF_BD_ERROR_DEVICE_ERROR - device not initialized or read failed
+     */
+    int get_performance_profile(spif_performance_profile_t *profile);
+
 private:
     /****************************************/
     /* SFDP Detection and Parsing Functions */
@@ -276,6 +322,11 @@ private:
     int _prog_instruction;
     int _erase_instruction;
 
+    // Read bus mode negotiated from the SFDP tables
+    spif_read_mode _read_mode;
+    bool _dual_read_capable;
+    bool _quad_read_capable;
+
     // Data extracted from the devices SFDP structure
     mbed::sfdp_hdr_info _sfdp_info;
 
@@ -17,6 +17,7 @@
 
 #include "blockdevice/internal/SFDP.h"
 #include "SPIFBlockDevice.h"
+#include "drivers/Timer.h"
 #include "rtos/ThisThread.h"
 #include "mbed_critical.h"
 
@@ -33,6 +34,9 @@ using namespace mbed;
 #define SPIF_DEFAULT_READ_SIZE  1
 #define SPIF_DEFAULT_PROG_SIZE  1
 #define SPIF_DEFAULT_SE_SIZE    4096
+#define SPIF_DEFAULT_PAGE_SIZE  256
+// Pages read back to back when measuring bandwidth for the performance profile
+#define SPIF_PROFILE_MEASURE_PAGES 16
 #define SPI_MAX_STATUS_REGISTER_SIZE 2
 #ifndef UINT64_MAX
 #define UINT64_MAX -1
@@ -46,6 +50,11 @@ using namespace mbed;
 /**********************************/
 //READ Instruction support according to BUS Configuration
 #define SPIF_BASIC_PARAM_TABLE_FAST_READ_SUPPORT_BYTE 2
+// Fast read support flags within that byte (BFPT DWORD1 bits 23:16)
+#define SPIF_BASIC_PARAM_FAST_READ_112 0x01 // bit 16: supports 1-1-2
+#define SPIF_BASIC_PARAM_FAST_READ_122 0x10 // bit 20: supports 1-2-2
+#define SPIF_BASIC_PARAM_FAST_READ_144 0x20 // bit 21: supports 1-4-4
+#define SPIF_BASIC_PARAM_FAST_READ_114 0x40 // bit 22: supports 1-1-4
 #define SPIF_BASIC_PARAM_TABLE_QPI_READ_SUPPORT_BYTE 16
 #define SPIF_BASIC_PARAM_TABLE_222_READ_INST_BYTE 23
 #define SPIF_BASIC_PARAM_TABLE_122_READ_INST_BYTE 15
@@ -65,6 +74,7 @@ enum spif_default_instructions {
     SPIF_NOP = 0x00, // No operation
     SPIF_PP = 0x02, // Page Program data
     SPIF_READ = 0x03, // Read data
+    SPIF_FAST_READ = 0x0b, // Fast Read data, 8 dummy cycles
     SPIF_SE   = 0x20, // 4KB Sector Erase
     SPIF_SFDP = 0x5a, // Read SFDP
     SPIF_WRSR = 0x01, // Write Status/Configuration Register
@@ -89,6 +99,7 @@ SingletonPtr<PlatformMutex> SPIFBlockDevice::_mutex;
 SPIFBlockDevice::SPIFBlockDevice(PinName mosi, PinName miso, PinName sclk, PinName csel, int freq)
     :
     _spi(mosi, miso, sclk, csel, use_gpio_ssel), _prog_instruction(0), _erase_instruction(0),
+    _read_mode(SPIF_READ_MODE_LEGACY_READ), _dual_read_capable(false), _quad_read_capable(false),
     _page_size_bytes(0), _init_ref_count(0), _is_initialized(false)
 {
     _address_size = SPIF_ADDR_SIZE_3_BYTES;
@@ -634,16 +645,81 @@ int SPIFBlockDevice::_sfdp_parse_basic_param_table(Callback<int(bd_addr_t, void
 int SPIFBlockDevice::_sfdp_detect_best_bus_read_mode(uint8_t *basic_param_table_ptr, int basic_param_table_size,
                                                      int &read_inst)
 {
-    do {
+    _read_mode = SPIF_READ_MODE_LEGACY_READ;
+    _read_dummy_and_mode_cycles = 0;
+    _dual_read_capable = false;
+    _quad_read_capable = false;
+
+    if (basic_param_table_size > SPIF_BASIC_PARAM_TABLE_FAST_READ_SUPPORT_BYTE) {
+        // Note what the part could do on a wider bus. The SPI driver moves
+        // data on a single line in each direction, so the dual and quad
+        // fast reads need the QSPI peripheral and QSPIFBlockDevice - record
+        // them for get_performance_profile() rather than selecting them
+        uint8_t support_byte = basic_param_table_ptr[SPIF_BASIC_PARAM_TABLE_FAST_READ_SUPPORT_BYTE];
+        _dual_read_capable = support_byte & (SPIF_BASIC_PARAM_FAST_READ_112 | SPIF_BASIC_PARAM_FAST_READ_122);
+        _quad_read_capable = support_byte & (SPIF_BASIC_PARAM_FAST_READ_144 | SPIF_BASIC_PARAM_FAST_READ_114);
+
+#if MBED_CONF_SPIF_DRIVER_FAST_READ
+        // Every SFDP device implements FAST READ 1-1-1, which keeps full
+        // data rate at bus clocks above the legacy READ instruction's
+        // ceiling (typically 50MHz)
+        read_inst = SPIF_FAST_READ;
+        _read_mode = SPIF_READ_MODE_FAST_READ;
+        _read_dummy_and_mode_cycles = 8;
+#endif
+    }
 
-        // TBD - SPIF Dual Read Modes Require SPI driver support
-        _read_dummy_and_mode_cycles = 0;
-        tr_debug("Read Bus Mode set to 1-1-1, Instruction: 0x%xh", read_inst);
-    } while (false);
+    tr_debug("Read Bus Mode set to 1-1-1, Instruction: 0x%xh, dummy cycles: %u (part %s)",
+             read_inst, _read_dummy_and_mode_cycles,
+             _quad_read_capable ? "quad capable" : _dual_read_capable ? "dual capable" : "single line only");
 
     return 0;
 }
 
+int SPIFBlockDevice::get_performance_profile(spif_performance_profile_t *profile)
+{
+    uint8_t measure_buffer[SPIF_DEFAULT_PAGE_SIZE];
+    bd_size_t total = 0;
+
+    if (!_is_initialized || !profile) {
+        return SPIF_BD_ERROR_DEVICE_ERROR;
+    }
+
+    profile->read_mode = _read_mode;
+    profile->read_instruction = _read_instruction;
+    profile->read_bus_width = 1;
+    profile->dummy_cycles = _read_dummy_and_mode_cycles;
+    profile->dual_capable = _dual_read_capable;
+    profile->quad_capable = _quad_read_capable;
+    profile->read_bandwidth_kbps = 0;
+
+    // Time a short burst of page-sized reads from the start of the device
+    mbed::Timer timer;
+    timer.start();
+    for (int i = 0; i < SPIF_PROFILE_MEASURE_PAGES; i++) {
+        bd_addr_t addr = (bd_addr_t) i * sizeof(measure_buffer);
+        if (addr + sizeof(measure_buffer) > size()) {
+            break;
+        }
+        if (read(measure_buffer, addr, sizeof(measure_buffer)) != SPIF_BD_ERROR_OK) {
+            return SPIF_BD_ERROR_DEVICE_ERROR;
+        }
+        total += sizeof(measure_buffer);
+    }
+    timer.stop();
+
+    microseconds elapsed = timer.elapsed_time();
+    if (total && (elapsed.count() > 0)) {
+        // bits / us == Mbit/s, scale to kbit/s
+        profile->read_bandwidth_kbps = (uint32_t)((total * 8 * 1000) / elapsed.count());
+    }
+
+    tr_info("Performance profile: instruction 0x%x, %" PRIu32 " kbit/s%s", _read_instruction,
+            profile->read_bandwidth_kbps, _quad_read_capable ? ", part is quad capable" : "");
+
+    return SPIF_BD_ERROR_OK;
+}
+
 int SPIFBlockDevice::_reset_flash_mem()
 {
     // Perform Soft Reset of the Device prior to initialization
@@ -0,0 +1,285 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** \addtogroup storage */
+/** @{*/
+
+#ifndef MBED_ASYNC_BLOCK_DEVICE_H
+#define MBED_ASYNC_BLOCK_DEVICE_H
+
+#include "BlockDevice.h"
+#include "platform/Callback.h"
+
+#ifdef MBED_CONF_RTOS_PRESENT
+#include "rtos/Thread.h"
+#include "rtos/Mutex.h"
+#include "rtos/ConditionVariable.h"
+#endif
+
+// Maximum number of operations that can be queued or in flight at once
+#ifndef ASYNC_BD_QUEUE_DEPTH
+#define ASYNC_BD_QUEUE_DEPTH 4
+#endif
+
+// Stack size of the worker thread executing queued operations
+#ifndef ASYNC_BD_THREAD_STACK_SIZE
+#define ASYNC_BD_THREAD_STACK_SIZE 1024
+#endif
+
+namespace mbed {
+
+/** Handle identifying a queued asynchronous operation. Positive when the
+ *  operation was accepted, a negative error code otherwise.
+ */
+typedef int bd_async_handle_t;
+
+/** Block device adding an asynchronous interface on top of a synchronous one
+ *
+ *  read_async and program_async queue the operation and return immediately,
+ *  so the caller can overlap device latency with computation or further
+ *  submissions, up to ASYNC_BD_QUEUE_DEPTH operations deep. A worker thread
+ *  executes the queue in submission order against the underlying synchronous
+ *  device. On builds without an RTOS the same interface is kept but
+ *  operations execute before the submission call returns.
+ *
+ *  An operation's result is delivered to its completion callback when one is
+ *  given; the callback runs in the worker thread's context and must not
+ *  block. Operations submitted without a callback hold their result until it
+ *  is collected with wait(). The synchronous BlockDevice interface remains
+ *  available and acts as a barrier: it drains the queue before touching the
+ *  device, so mixed use stays ordered. Callers must not submit overlapping
+ *  operations that are sensitive to their relative completion order beyond
+ *  submission order.
+ */
+class AsyncBlockDevice : public BlockDevice {
+public:
+    /** Lifetime of an asynchronous block device wrapping a synchronous one
+     *
+     *  @param bd       Block device to back the AsyncBlockDevice
+     */
+    AsyncBlockDevice(BlockDevice *bd);
+
+    /** Lifetime of the asynchronous block device
+     */
+    virtual ~AsyncBlockDevice();
+
+    /** Initialize the underlying block device and start the worker thread
+     *
+     *  @return         0 on success or a negative error code on failure
+     */
+    virtual int init();
+
+    /** Drain queued operations, stop the worker thread and deinitialize the
+     *  underlying block device
+     *
+     *  @return         0 on success or a negative error code on failure
+     */
+    virtual int deinit();
+
+    /** Queue a read of blocks from the underlying block device
+     *
+     *  The buffer must stay valid until the operation completes. If the
+     *  queue is full the call blocks until a slot frees up.
+     *
+     *  @param buffer   Buffer to read blocks into
+     *  @param addr     Address of block to begin reading from
+     *  @param size     Size to read in bytes, must be a multiple of read block size
+     *  @param callback Invoked with the operation result on completion, or
+     *                  an empty callback to collect the result with wait()
+     *  @return         Operation handle, or a negative error code on failure
+     */
+    bd_async_handle_t read_async(void *buffer, bd_addr_t addr, bd_size_t size,
+                                 mbed::Callback<void(int)> callback = nullptr);
+
+    /** Queue a program of blocks to the underlying block device
+     *
+     *  The blocks must have been erased prior to being programmed and the
+     *  buffer must stay valid until the operation completes. If the queue is
+     *  full the call blocks until a slot frees up.
+     *
+     *  @param buffer   Buffer of data to write to blocks
+     *  @param addr     Address of block to begin writing to
+     *  @param size     Size to write in bytes, must be a multiple of program block size
+     *  @param callback Invoked with the operation result on completion, or
+     *                  an empty callback to collect the result with wait()
+     *  @return         Operation handle, or a negative error code on failure
+     */
+    bd_async_handle_t program_async(const void *buffer, bd_addr_t addr, bd_size_t size,
+                                    mbed::Callback<void(int)> callback = nullptr);
+
+    /** Wait for an asynchronous operation to complete
+     *
+     *  @param handle   Handle returned by read_async or program_async
+     *  @return         The operation's result for operations submitted
+     *                  without a callback; 0 once a callback operation has
+     *                  completed (its result went to the callback)
+     */
+    int wait(bd_async_handle_t handle);
+
+    /** Wait for all queued operations to complete
+     *
+     *  Results still held by operations submitted without a callback are
+     *  collected and their slots freed.
+     *
+     *  @return         0 if every collected operation succeeded, otherwise
+     *                  the first nonzero result found
+     */
+    int wait_all();
+
+    /** Get the maximum number of queued or in-flight operations
+     *
+     *  @return         The configured queue depth
+     */
+    uint32_t queue_depth() const;
+
+    /** Ensure data on storage is in sync with the driver
+     *
+     *  Drains the operation queue first.
+     *
+     *  @return         0 on success or a negative error code on failure
+     */
+    virtual int sync();
+
+    /** Read blocks from the underlying block device, after draining the queue
+     *
+     *  @param buffer   Buffer to read blocks into
+     *  @param addr     Address of block to begin reading from
+     *  @param size     Size to read in bytes, must be a multiple of read block size
+     *  @return         0 on success or a negative error code on failure
+     */
+    virtual int read(void *buffer, bd_addr_t addr, bd_size_t size);
+
+    /** Program blocks to the underlying block device, after draining the queue
+     *
+     *  @param buffer   Buffer of data to write to blocks
+     *  @param addr     Address of block to begin writing to
+     *  @param size     Size to write in bytes, must be a multiple of program block size
+     *  @return         0 on success or a negative error code on failure
+     */
+    virtual int program(const void *buffer, bd_addr_t addr, bd_size_t size);
+
+    /** Erase blocks on the underlying block device, after draining the queue
+     *
+     *  @param addr     Address of block to begin erasing
+     *  @param size     Size to erase in bytes, must be a multiple of erase block size
+     *  @return         0 on success or a negative error code on failure
+     */
+    virtual int erase(bd_addr_t addr, bd_size_t size);
+
+    /** Mark blocks as no longer in use, after draining the queue
+     *
+     *  @param addr     Address of block to mark as unused
+     *  @param size     Size to mark as unused in bytes, must be a multiple of erase block size
+     *  @return         0 on success or a negative error code on failure
+     */
+    virtual int trim(bd_addr_t addr, bd_size_t size);
+
+    /** Get the size of a readable block
+     *
+     *  @return         Size of a readable block in bytes
+     */
+    virtual bd_size_t get_read_size() const;
+
+    /** Get the size of a programmable block
+     *
+     *  @return         Size of a programmable block in bytes
+     */
+    virtual bd_size_t get_program_size() const;
+
+    /** Get the size of an erasable block
+     *
+     *  @return         Size of an erasable block in bytes
+     */
+    virtual bd_size_t get_erase_size() const;
+
+    /** Get the size of an erasable block given address
+     *
+     *  @param addr     Address within the erasable block
+     *  @return         Size of an erasable block in bytes
+     */
+    virtual bd_size_t get_erase_size(bd_addr_t addr) const;
+
+    /** Get the value of storage when erased
+     *
+     *  @return         The value of storage when erased, or -1 if you can't
+     *                  rely on the value of erased storage
+     */
+    virtual int get_erase_value() const;
+
+    /** Get the total size of the underlying device
+     *
+     *  @return         Size of the underlying device in bytes
+     */
+    virtual bd_size_t size() const;
+
+    /** Get the BlockDevice class type.
+     *
+     *  @return         A string represent the BlockDevice class type.
+     */
+    virtual const char *get_type() const;
+
+private:
+    enum op_state_t {
+        OP_FREE,        // Slot available for submission
+        OP_QUEUED,      // Waiting for the worker
+        OP_EXECUTING,   // Running on the underlying device
+        OP_DONE,        // Completed, result awaiting collection by wait()
+    };
+
+    struct async_op_t {
+        op_state_t state;
+        bd_async_handle_t handle;
+        bool is_program;
+        void *read_buf;
+        const void *program_buf;
+        bd_addr_t addr;
+        bd_size_t size;
+        mbed::Callback<void(int)> callback;
+        int result;
+    };
+
+    bd_async_handle_t enqueue(bool is_program, void *read_buf, const void *program_buf,
+                              bd_addr_t addr, bd_size_t size, mbed::Callback<void(int)> callback);
+    int execute(async_op_t &op);
+#ifdef MBED_CONF_RTOS_PRESENT
+    void worker();
+#endif
+
+    BlockDevice *_bd;
+    async_op_t _ops[ASYNC_BD_QUEUE_DEPTH];
+    uint32_t _submit_slot;
+    uint32_t _exec_slot;
+    bd_async_handle_t _next_handle;
+    bool _is_initialized;
+#ifdef MBED_CONF_RTOS_PRESENT
+    rtos::Thread *_thread;
+    mutable rtos::Mutex _mutex;
+    rtos::ConditionVariable _cond;
+    bool _shutdown;
+#endif
+};
+
+} // namespace mbed
+
+// Added "using" for backwards compatibility
+#ifndef MBED_NO_GLOBAL_USING_DIRECTIVE
+using mbed::AsyncBlockDevice;
+#endif
+
+#endif
+
+/** @}*/
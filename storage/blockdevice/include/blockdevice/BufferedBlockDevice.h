@@ -23,6 +23,10 @@
 
 #include "BlockDevice.h"
 
+#if BUFFERED_BD_READ_CACHE
+#include "AsyncBlockDevice.h"
+#endif
+
 namespace mbed {
 
 /** Block device for allowing minimal read and program sizes (of 1) for the underlying BD,
@@ -36,6 +40,19 @@ public:
      */
     BufferedBlockDevice(BlockDevice *bd);
 
+#if BUFFERED_BD_READ_CACHE
+    /** Lifetime of a memory-buffered block device wrapping an asynchronous block device
+     *
+     *  When a sequential read stream is detected, the following cache lines
+     *  are fetched through the device's asynchronous queue instead of
+     *  synchronously, so device latency overlaps with the caller's
+     *  processing of the data it already has.
+     *
+     *  @param bd        Asynchronous block device to back the BufferedBlockDevice
+     */
+    BufferedBlockDevice(AsyncBlockDevice *bd);
+#endif
+
     /** Lifetime of the memory-buffered block device
      */
     virtual ~BufferedBlockDevice();
@@ -178,6 +195,79 @@ protected:
      *  @return         none
      */
     void invalidate_write_cache();
+
+#if BUFFERED_BD_READ_CACHE
+    struct read_cache_line_t {
+        bd_addr_t addr;
+        bool valid;
+    };
+
+    read_cache_line_t *_cache_line;
+    uint8_t *_cache_buf;
+    bd_size_t _cache_line_size;
+    uint32_t _cache_lines;
+    uint32_t _cache_next_slot;
+    bd_addr_t _cache_seq_next;
+
+    /** Read through the multi-line read cache
+     *
+     *  @param buf      Destination buffer
+     *  @param addr     Read address
+     *  @param size     Number of bytes to read
+     *  @return         0 on success or a negative error code on failure
+     */
+    int cached_read(uint8_t *buf, bd_addr_t addr, bd_size_t size);
+
+    /** Fetch a cache line (and, on a sequential stream, the following ones)
+     *  from the underlying BD
+     *
+     *  @param line_addr Line-aligned address to fetch
+     *  @return          0 on success or a negative error code on failure
+     */
+    int cache_line_fill(bd_addr_t line_addr);
+
+    /** Find a valid cache line
+     *
+     *  @param line_addr Line-aligned address to look up
+     *  @return          Pointer to the cached data, NULL if not cached
+     */
+    uint8_t *cache_line_lookup(bd_addr_t line_addr);
+
+    /** Invalidate all cache lines intersecting an address range
+     *
+     *  @param addr     Range start address
+     *  @param size     Range size in bytes
+     *  @return         none
+     */
+    void invalidate_read_cache(bd_addr_t addr, bd_size_t size);
+
+    AsyncBlockDevice *_async_bd;
+    bd_async_handle_t _readahead_handle;
+    uint32_t _readahead_slot;
+    uint32_t _readahead_lines;
+    bd_addr_t _readahead_addr;
+
+    /** Queue an asynchronous fetch of the cache lines following the current
+     *  sequential stream
+     *
+     *  @return         none
+     */
+    void readahead_submit();
+
+    /** Completion callback of the readahead operation - marks the fetched
+     *  lines valid (runs in the async device's worker context)
+     *
+     *  @param result   Result of the underlying read
+     *  @return         none
+     */
+    void readahead_complete(int result);
+
+    /** Wait for an outstanding readahead before touching the cache
+     *
+     *  @return         none
+     */
+    void readahead_sync();
+#endif
 #endif //#if !(DOXYGEN_ONLY)
 };
 } // namespace mbed
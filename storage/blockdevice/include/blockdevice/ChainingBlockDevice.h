@@ -22,6 +22,7 @@
 #define MBED_CHAINING_BLOCK_DEVICE_H
 
 #include "BlockDevice.h"
+#include "AsyncBlockDevice.h"
 #include "platform/mbed_assert.h"
 #include <stdlib.h>
 
@@ -56,6 +57,19 @@ public:
      */
     ChainingBlockDevice(BlockDevice **bds, size_t bd_count);
 
+    /** Lifetime of the memory block device, with parallel dispatch
+     *
+     *  Reads and programs spanning several of the chained devices are
+     *  submitted to each device's asynchronous queue and run concurrently,
+     *  completing when the slowest device does. Useful when the devices sit
+     *  on independent buses. Erases are still issued serially.
+     *
+     *  @param bds         Array of asynchronous block devices to chain with sequential block addresses
+     *  @param bd_count    Number of block devices to chain
+     *  @note All block devices must have the same block size
+     */
+    ChainingBlockDevice(AsyncBlockDevice **bds, size_t bd_count);
+
     /** Lifetime of the memory block device
      *
      *  @param bds          Array of block devices to chain with sequential block addresses
@@ -65,13 +79,14 @@ public:
     ChainingBlockDevice(BlockDevice * (&bds)[Size])
         : _bds(bds), _bd_count(sizeof(bds) / sizeof(bds[0]))
         , _read_size(0), _program_size(0), _erase_size(0), _size(0),  _init_ref_count(0)
+        , _async_bds(0), _handles(0), _bds_owned(false)
     {
     }
 
     /** Lifetime of the memory block device
      *
      */
-    virtual ~ChainingBlockDevice() {}
+    virtual ~ChainingBlockDevice();
 
     /** Initialize a block device
      *
@@ -183,6 +198,9 @@ protected:
     int _erase_value;
     uint32_t _init_ref_count;
     bool _is_initialized;
+    AsyncBlockDevice **_async_bds;
+    bd_async_handle_t *_handles;
+    bool _bds_owned;
 };
 
 } // namespace mbed
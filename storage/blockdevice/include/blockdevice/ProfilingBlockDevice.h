@@ -22,9 +22,32 @@
 #define MBED_PROFILING_BLOCK_DEVICE_H
 
 #include "BlockDevice.h"
+#include "platform/Callback.h"
 
 namespace mbed {
 
+/** Operation type reported to a slow-operation callback */
+typedef enum {
+    BD_PROFILING_OP_READ,
+    BD_PROFILING_OP_PROGRAM,
+    BD_PROFILING_OP_ERASE,
+} bd_profiling_op_t;
+
+/** Latency distribution of one block device operation type
+ *
+ *  Bucket i counts operations that completed in [2^i, 2^(i+1)) microseconds;
+ *  the last bucket also collects everything slower. The totals allow mean
+ *  latency and throughput to be derived without storing every sample.
+ */
+struct bd_latency_stats_t {
+    /** Number of histogram buckets */
+    static const int BUCKETS = 16;
+
+    uint32_t count[BUCKETS];    /**< Operations per log2(microseconds) bucket */
+    uint32_t ops;               /**< Total number of operations */
+    uint64_t total_us;          /**< Total time spent in operations, in microseconds */
+    uint32_t max_us;            /**< Slowest single operation, in microseconds */
+};
 
 /** Block device for measuring storage operations of another block device
  */
@@ -158,6 +181,42 @@ public:
      */
     bd_size_t get_erase_count() const;
 
+    /** Get the latency distribution of read operations
+     *
+     *  @param stats    Filled with the read latency histogram and totals
+     *  @note Latencies are only collected on devices with a microsecond
+     *        ticker; elsewhere the histogram stays empty while the byte
+     *        counters keep working
+     */
+    void get_read_latency(bd_latency_stats_t *stats) const;
+
+    /** Get the latency distribution of program operations
+     *
+     *  @param stats    Filled with the program latency histogram and totals
+     */
+    void get_program_latency(bd_latency_stats_t *stats) const;
+
+    /** Get the latency distribution of erase operations
+     *
+     *  @param stats    Filled with the erase latency histogram and totals
+     */
+    void get_erase_latency(bd_latency_stats_t *stats) const;
+
+    /** Set a callback for operations that exceed a latency threshold
+     *
+     *  The callback runs in the caller's context, directly after the slow
+     *  operation completes, with the operation type, address, size and
+     *  elapsed time in microseconds. Outside the callback the profiling
+     *  overhead is two ticker reads per operation, so a production block
+     *  device can stay wrapped permanently and report only its outliers.
+     *
+     *  @param threshold_us  Latency above which the callback fires
+     *  @param callback      Callback to invoke, or an empty callback to
+     *                       disable reporting again
+     */
+    void set_slow_op_callback(uint32_t threshold_us,
+                              mbed::Callback<void(bd_profiling_op_t, bd_addr_t, bd_size_t, uint32_t)> callback);
+
     /** Get the BlockDevice class type.
      *
      *  @return         A string represent the BlockDevice class type.
@@ -165,10 +224,19 @@ public:
     virtual const char *get_type() const;
 
 private:
+    uint32_t _sample_begin() const;
+    void _sample_end(bd_latency_stats_t &stats, uint32_t begin_us,
+                     bd_profiling_op_t op, bd_addr_t addr, bd_size_t size);
+
     BlockDevice *_bd;
     bd_size_t _read_count;
     bd_size_t _program_count;
     bd_size_t _erase_count;
+    bd_latency_stats_t _read_latency;
+    bd_latency_stats_t _program_latency;
+    bd_latency_stats_t _erase_latency;
+    uint32_t _slow_op_threshold_us;
+    mbed::Callback<void(bd_profiling_op_t, bd_addr_t, bd_size_t, uint32_t)> _slow_op_callback;
 };
 
 } // namespace mbed
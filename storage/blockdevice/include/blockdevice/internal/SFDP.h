@@ -47,6 +47,8 @@ constexpr int SFDP_ERASE_BITMASK_ALL = 0x0F;   ///< Erase type All
 
 constexpr int SFDP_MAX_NUM_OF_ERASE_TYPES = 4;  ///< Maximum number of different erase types (erase granularity)
 
+constexpr int SFDP_CACHE_MAX_DEVICE_ID_SIZE = 16; ///< Maximum device identity size for a serialized SFDP cache entry
+
 /** JEDEC Basic Flash Parameter Table info */
 struct sfdp_bptbl_info {
     uint32_t addr; ///< Address
@@ -167,6 +169,53 @@ int sfdp_detect_device_density(uint8_t *bptbl_ptr, sfdp_bptbl_info &bptbl_info);
  */
 int sfdp_detect_addressability(uint8_t *bptbl_ptr, sfdp_bptbl_info &bptbl_info);
 
+/** Serialize parsed SFDP parameters to a cache location
+ *
+ * Writes a validated snapshot of the parsed SFDP database, so a later boot
+ * can restore it with sfdp_cache_load() instead of re-reading and re-parsing
+ * the SFDP tables from the device. The snapshot is keyed by a device identity
+ * (typically the JEDEC ID bytes read at init), which lets a restore detect
+ * that the flash part has changed. The storage behind the writer callback is
+ * chosen by the caller - for example a reserved flash region or a KVStore
+ * item - and must hold a 12-byte cache header followed by the device
+ * identity and a copy of sfdp_hdr_info.
+ *
+ * @param cache_writer   Callback function used to write the snapshot to the cache
+ *                       location; the buffer it is given is not modified
+ * @param device_id      Device identity the snapshot is keyed by
+ * @param device_id_size Size of the device identity in bytes, up to
+ *                       SFDP_CACHE_MAX_DEVICE_ID_SIZE
+ * @param sfdp_info      Parsed SFDP database to serialize
+ *
+ * @return MBED_SUCCESS on success, negative error code on failure
+ */
+int sfdp_cache_save(Callback<int(bd_addr_t, void *, bd_size_t)> cache_writer,
+                    const uint8_t *device_id,
+                    size_t device_id_size,
+                    const sfdp_hdr_info &sfdp_info);
+
+/** Restore parsed SFDP parameters from a cache location
+ *
+ * Reads back a snapshot written by sfdp_cache_save() and validates its
+ * magic, format version, CRC and device identity before applying it. On any
+ * mismatch - uninitialized cache, corrupted data, a different flash part or
+ * a layout change of sfdp_hdr_info - the output structure is left untouched
+ * and an error is returned, so the caller can fall back to a full SFDP parse.
+ *
+ * @param      cache_reader   Callback function used to read the snapshot from
+ *                            the cache location
+ * @param      device_id      Expected device identity, as read from the device
+ * @param      device_id_size Size of the device identity in bytes, up to
+ *                            SFDP_CACHE_MAX_DEVICE_ID_SIZE
+ * @param[out] sfdp_info      Filled with the restored SFDP database on success
+ *
+ * @return MBED_SUCCESS on success, negative error code on failure
+ */
+int sfdp_cache_load(Callback<int(bd_addr_t, void *, bd_size_t)> cache_reader,
+                    const uint8_t *device_id,
+                    size_t device_id_size,
+                    sfdp_hdr_info &sfdp_info);
+
 /** @}*/
 } /* namespace mbed */
 #endif
@@ -0,0 +1,416 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "blockdevice/AsyncBlockDevice.h"
+#include "platform/mbed_assert.h"
+
+namespace mbed {
+
+AsyncBlockDevice::AsyncBlockDevice(BlockDevice *bd)
+    : _bd(bd), _submit_slot(0), _exec_slot(0), _next_handle(0), _is_initialized(false)
+#ifdef MBED_CONF_RTOS_PRESENT
+    , _thread(0), _cond(_mutex), _shutdown(false)
+#endif
+{
+    MBED_ASSERT(_bd);
+    for (uint32_t i = 0; i < ASYNC_BD_QUEUE_DEPTH; i++) {
+        _ops[i].state = OP_FREE;
+    }
+}
+
+AsyncBlockDevice::~AsyncBlockDevice()
+{
+    deinit();
+}
+
+int AsyncBlockDevice::init()
+{
+    if (_is_initialized) {
+        return BD_ERROR_OK;
+    }
+
+    int err = _bd->init();
+    if (err) {
+        return err;
+    }
+
+#ifdef MBED_CONF_RTOS_PRESENT
+    _shutdown = false;
+    _thread = new rtos::Thread(osPriorityNormal, ASYNC_BD_THREAD_STACK_SIZE, nullptr, "async_bd");
+    if (_thread->start(mbed::callback(this, &AsyncBlockDevice::worker)) != osOK) {
+        delete _thread;
+        _thread = 0;
+        _bd->deinit();
+        return BD_ERROR_DEVICE_ERROR;
+    }
+#endif
+
+    _is_initialized = true;
+    return BD_ERROR_OK;
+}
+
+int AsyncBlockDevice::deinit()
+{
+    if (!_is_initialized) {
+        return BD_ERROR_OK;
+    }
+
+    wait_all();
+
+#ifdef MBED_CONF_RTOS_PRESENT
+    _mutex.lock();
+    _shutdown = true;
+    _cond.notify_all();
+    _mutex.unlock();
+    _thread->join();
+    delete _thread;
+    _thread = 0;
+#endif
+
+    _is_initialized = false;
+    return _bd->deinit();
+}
+
+int AsyncBlockDevice::execute(async_op_t &op)
+{
+    if (op.is_program) {
+        return _bd->program(op.program_buf, op.addr, op.size);
+    } else {
+        return _bd->read(op.read_buf, op.addr, op.size);
+    }
+}
+
+#ifdef MBED_CONF_RTOS_PRESENT
+
+void AsyncBlockDevice::worker()
+{
+    _mutex.lock();
+    while (true) {
+        while (!_shutdown && (_ops[_exec_slot].state != OP_QUEUED)) {
+            _cond.wait();
+        }
+        if (_shutdown) {
+            break;
+        }
+
+        async_op_t &op = _ops[_exec_slot];
+        _exec_slot = (_exec_slot + 1) % ASYNC_BD_QUEUE_DEPTH;
+        op.state = OP_EXECUTING;
+
+        // Run the operation with the queue unlocked so submissions and
+        // waiters aren't blocked behind the device
+        _mutex.unlock();
+        int result = execute(op);
+        if (op.callback) {
+            op.callback(result);
+        }
+        _mutex.lock();
+
+        op.result = result;
+        // Callback operations are fire-and-forget - their slot frees here.
+        // Others hold the result until wait() collects it.
+        op.state = op.callback ? OP_FREE : OP_DONE;
+        _cond.notify_all();
+    }
+    _mutex.unlock();
+}
+
+bd_async_handle_t AsyncBlockDevice::enqueue(bool is_program, void *read_buf, const void *program_buf,
+                                            bd_addr_t addr, bd_size_t size, mbed::Callback<void(int)> callback)
+{
+    if (!_is_initialized) {
+        return BD_ERROR_DEVICE_ERROR;
+    }
+
+    _mutex.lock();
+    while (_ops[_submit_slot].state != OP_FREE) {
+        _cond.wait();
+    }
+
+    async_op_t &op = _ops[_submit_slot];
+    _submit_slot = (_submit_slot + 1) % ASYNC_BD_QUEUE_DEPTH;
+
+    if (++_next_handle <= 0) {
+        _next_handle = 1;
+    }
+    op.handle = _next_handle;
+    op.is_program = is_program;
+    op.read_buf = read_buf;
+    op.program_buf = program_buf;
+    op.addr = addr;
+    op.size = size;
+    op.callback = callback;
+    op.state = OP_QUEUED;
+
+    _cond.notify_all();
+    _mutex.unlock();
+    return op.handle;
+}
+
+int AsyncBlockDevice::wait(bd_async_handle_t handle)
+{
+    if (handle <= 0) {
+        return BD_ERROR_DEVICE_ERROR;
+    }
+
+    int result = BD_ERROR_OK;
+    _mutex.lock();
+    while (true) {
+        async_op_t *op = 0;
+        for (uint32_t i = 0; i < ASYNC_BD_QUEUE_DEPTH; i++) {
+            if ((_ops[i].state != OP_FREE) && (_ops[i].handle == handle)) {
+                op = &_ops[i];
+                break;
+            }
+        }
+        if (!op) {
+            // Already completed and collected (or fire-and-forget)
+            break;
+        }
+        if (op->state == OP_DONE) {
+            result = op->result;
+            op->state = OP_FREE;
+            _cond.notify_all();
+            break;
+        }
+        _cond.wait();
+    }
+    _mutex.unlock();
+    return result;
+}
+
+int AsyncBlockDevice::wait_all()
+{
+    int result = BD_ERROR_OK;
+    _mutex.lock();
+    while (true) {
+        bool pending = false;
+        for (uint32_t i = 0; i < ASYNC_BD_QUEUE_DEPTH; i++) {
+            if ((_ops[i].state == OP_QUEUED) || (_ops[i].state == OP_EXECUTING)) {
+                pending = true;
+            } else if (_ops[i].state == OP_DONE) {
+                if (!result) {
+                    result = _ops[i].result;
+                }
+                _ops[i].state = OP_FREE;
+                _cond.notify_all();
+            }
+        }
+        if (!pending) {
+            break;
+        }
+        _cond.wait();
+    }
+    _mutex.unlock();
+    return result;
+}
+
+#else // MBED_CONF_RTOS_PRESENT
+
+// Without an RTOS there is no worker to hand work to - keep the interface
+// but run each operation during submission
+
+bd_async_handle_t AsyncBlockDevice::enqueue(bool is_program, void *read_buf, const void *program_buf,
+                                            bd_addr_t addr, bd_size_t size, mbed::Callback<void(int)> callback)
+{
+    if (!_is_initialized) {
+        return BD_ERROR_DEVICE_ERROR;
+    }
+
+    async_op_t &op = _ops[_submit_slot];
+    if (op.state != OP_FREE) {
+        // All slots hold uncollected results
+        return BD_ERROR_DEVICE_ERROR;
+    }
+    _submit_slot = (_submit_slot + 1) % ASYNC_BD_QUEUE_DEPTH;
+
+    if (++_next_handle <= 0) {
+        _next_handle = 1;
+    }
+    op.handle = _next_handle;
+    op.is_program = is_program;
+    op.read_buf = read_buf;
+    op.program_buf = program_buf;
+    op.addr = addr;
+    op.size = size;
+
+    int result = execute(op);
+    if (callback) {
+        callback(result);
+    } else {
+        op.result = result;
+        op.state = OP_DONE;
+    }
+    return op.handle;
+}
+
+int AsyncBlockDevice::wait(bd_async_handle_t handle)
+{
+    if (handle <= 0) {
+        return BD_ERROR_DEVICE_ERROR;
+    }
+
+    for (uint32_t i = 0; i < ASYNC_BD_QUEUE_DEPTH; i++) {
+        if ((_ops[i].state == OP_DONE) && (_ops[i].handle == handle)) {
+            int result = _ops[i].result;
+            _ops[i].state = OP_FREE;
+            return result;
+        }
+    }
+    return BD_ERROR_OK;
+}
+
+int AsyncBlockDevice::wait_all()
+{
+    int result = BD_ERROR_OK;
+    for (uint32_t i = 0; i < ASYNC_BD_QUEUE_DEPTH; i++) {
+        if (_ops[i].state == OP_DONE) {
+            if (!result) {
+                result = _ops[i].result;
+            }
+            _ops[i].state = OP_FREE;
+        }
+    }
+    return result;
+}
+
+#endif // MBED_CONF_RTOS_PRESENT
+
+bd_async_handle_t AsyncBlockDevice::read_async(void *buffer, bd_addr_t addr, bd_size_t size,
+                                               mbed::Callback<void(int)> callback)
+{
+    if (!is_valid_read(addr, size)) {
+        return BD_ERROR_DEVICE_ERROR;
+    }
+    return enqueue(false, buffer, 0, addr, size, callback);
+}
+
+bd_async_handle_t AsyncBlockDevice::program_async(const void *buffer, bd_addr_t addr, bd_size_t size,
+                                                  mbed::Callback<void(int)> callback)
+{
+    if (!is_valid_program(addr, size)) {
+        return BD_ERROR_DEVICE_ERROR;
+    }
+    return enqueue(true, 0, buffer, addr, size, callback);
+}
+
+uint32_t AsyncBlockDevice::queue_depth() const
+{
+    return ASYNC_BD_QUEUE_DEPTH;
+}
+
+int AsyncBlockDevice::sync()
+{
+    if (!_is_initialized) {
+        return BD_ERROR_DEVICE_ERROR;
+    }
+
+    int err = wait_all();
+    if (err) {
+        return err;
+    }
+    return _bd->sync();
+}
+
+int AsyncBlockDevice::read(void *buffer, bd_addr_t addr, bd_size_t size)
+{
+    if (!_is_initialized) {
+        return BD_ERROR_DEVICE_ERROR;
+    }
+
+    int err = wait_all();
+    if (err) {
+        return err;
+    }
+    return _bd->read(buffer, addr, size);
+}
+
+int AsyncBlockDevice::program(const void *buffer, bd_addr_t addr, bd_size_t size)
+{
+    if (!_is_initialized) {
+        return BD_ERROR_DEVICE_ERROR;
+    }
+
+    int err = wait_all();
+    if (err) {
+        return err;
+    }
+    return _bd->program(buffer, addr, size);
+}
+
+int AsyncBlockDevice::erase(bd_addr_t addr, bd_size_t size)
+{
+    if (!_is_initialized) {
+        return BD_ERROR_DEVICE_ERROR;
+    }
+
+    int err = wait_all();
+    if (err) {
+        return err;
+    }
+    return _bd->erase(addr, size);
+}
+
+int AsyncBlockDevice::trim(bd_addr_t addr, bd_size_t size)
+{
+    if (!_is_initialized) {
+        return BD_ERROR_DEVICE_ERROR;
+    }
+
+    int err = wait_all();
+    if (err) {
+        return err;
+    }
+    return _bd->trim(addr, size);
+}
+
+bd_size_t AsyncBlockDevice::get_read_size() const
+{
+    return _bd->get_read_size();
+}
+
+bd_size_t AsyncBlockDevice::get_program_size() const
+{
+    return _bd->get_program_size();
+}
+
+bd_size_t AsyncBlockDevice::get_erase_size() const
+{
+    return _bd->get_erase_size();
+}
+
+bd_size_t AsyncBlockDevice::get_erase_size(bd_addr_t addr) const
+{
+    return _bd->get_erase_size(addr);
+}
+
+int AsyncBlockDevice::get_erase_value() const
+{
+    return _bd->get_erase_value();
+}
+
+bd_size_t AsyncBlockDevice::size() const
+{
+    return _bd->size();
+}
+
+const char *AsyncBlockDevice::get_type() const
+{
+    return _bd->get_type();
+}
+
+} // namespace mbed
@@ -21,6 +21,37 @@
 #include <algorithm>
 #include <string.h>
 
+#if BUFFERED_BD_READ_CACHE
+
+// Number of cache lines in the read cache
+#ifndef BUFFERED_BD_READ_CACHE_BLOCKS
+#define BUFFERED_BD_READ_CACHE_BLOCKS 8
+#endif
+
+// Size of a cache line in bytes (rounded up at init to a multiple of the
+// underlying read size)
+#ifndef BUFFERED_BD_READ_CACHE_BLOCK_SIZE
+#define BUFFERED_BD_READ_CACHE_BLOCK_SIZE 512
+#endif
+
+// Number of lines fetched in one underlying read when a sequential stream
+// is detected
+#ifndef BUFFERED_BD_READ_CACHE_READAHEAD
+#define BUFFERED_BD_READ_CACHE_READAHEAD 4
+#endif
+
+// Aligned reads at least this many bytes long bypass the cache and go
+// straight to the underlying device in one transfer. Defaults to the cache
+// capacity - a read larger than the whole cache cannot be served from it,
+// and copying it through the lines would only evict hot metadata. 0
+// disables the bypass.
+#ifndef BUFFERED_BD_READ_CACHE_BYPASS_SIZE
+#define BUFFERED_BD_READ_CACHE_BYPASS_SIZE \
+    (BUFFERED_BD_READ_CACHE_BLOCKS * BUFFERED_BD_READ_CACHE_BLOCK_SIZE)
+#endif
+
+#endif
+
 namespace mbed {
 
 static inline uint32_t align_down(bd_size_t val, bd_size_t size)
@@ -33,7 +64,28 @@ BufferedBlockDevice::BufferedBlockDevice(BlockDevice *bd)
       _write_cache(0), _read_buf(0), _init_ref_count(0), _is_initialized(false)
 {
     MBED_ASSERT(_bd);
+#if BUFFERED_BD_READ_CACHE
+    _cache_line = 0;
+    _cache_buf = 0;
+    _cache_line_size = 0;
+    _cache_lines = 0;
+    _cache_next_slot = 0;
+    _cache_seq_next = 0;
+    _async_bd = 0;
+    _readahead_handle = 0;
+    _readahead_slot = 0;
+    _readahead_lines = 0;
+    _readahead_addr = 0;
+#endif
+}
+
+#if BUFFERED_BD_READ_CACHE
+BufferedBlockDevice::BufferedBlockDevice(AsyncBlockDevice *bd)
+    : BufferedBlockDevice(static_cast<BlockDevice *>(bd))
+{
+    _async_bd = bd;
 }
+#endif
 
 BufferedBlockDevice::~BufferedBlockDevice()
 {
@@ -65,6 +117,25 @@ int BufferedBlockDevice::init()
         _read_buf = new uint8_t[_bd_read_size];
     }
 
+#if BUFFERED_BD_READ_CACHE
+    if (!_cache_buf) {
+        _cache_line_size = BUFFERED_BD_READ_CACHE_BLOCK_SIZE;
+        bd_size_t rem = _cache_line_size % _bd_read_size;
+        if (rem) {
+            _cache_line_size += _bd_read_size - rem;
+        }
+        _cache_lines = BUFFERED_BD_READ_CACHE_BLOCKS;
+        _cache_line = new read_cache_line_t[_cache_lines];
+        _cache_buf = new uint8_t[_cache_lines * _cache_line_size];
+    }
+    for (uint32_t i = 0; i < _cache_lines; i++) {
+        _cache_line[i].valid = false;
+    }
+    _cache_next_slot = 0;
+    _cache_seq_next = (bd_addr_t) -1;
+    _readahead_handle = 0;
+#endif
+
     invalidate_write_cache();
 
     _is_initialized = true;
@@ -93,6 +164,13 @@ int BufferedBlockDevice::deinit()
     _write_cache = 0;
     delete[] _read_buf;
     _read_buf = 0;
+#if BUFFERED_BD_READ_CACHE
+    delete[] _cache_line;
+    _cache_line = 0;
+    delete[] _cache_buf;
+    _cache_buf = 0;
+    _cache_lines = 0;
+#endif
     _is_initialized = false;
     return _bd->deinit();
 }
@@ -109,6 +187,9 @@ int BufferedBlockDevice::flush()
         if (ret) {
             return ret;
         }
+#if BUFFERED_BD_READ_CACHE
+        invalidate_read_cache(_write_cache_addr, _bd_program_size);
+#endif
         invalidate_write_cache();
     }
     return 0;
@@ -120,6 +201,202 @@ void BufferedBlockDevice::invalidate_write_cache()
     _write_cache_valid = false;
 }
 
+#if BUFFERED_BD_READ_CACHE
+uint8_t *BufferedBlockDevice::cache_line_lookup(bd_addr_t line_addr)
+{
+    for (uint32_t i = 0; i < _cache_lines; i++) {
+        if (_cache_line[i].valid && (_cache_line[i].addr == line_addr)) {
+            return _cache_buf + (bd_size_t) i * _cache_line_size;
+        }
+    }
+    return 0;
+}
+
+void BufferedBlockDevice::readahead_sync()
+{
+    if (_readahead_handle > 0) {
+        // Result doesn't matter here - the completion callback only marks
+        // lines valid when the read succeeded
+        _async_bd->wait(_readahead_handle);
+        _readahead_handle = 0;
+    }
+}
+
+void BufferedBlockDevice::readahead_complete(int result)
+{
+    if (result) {
+        return;
+    }
+    for (uint32_t i = 0; i < _readahead_lines; i++) {
+        _cache_line[_readahead_slot + i].addr = _readahead_addr + (bd_size_t) i * _cache_line_size;
+        _cache_line[_readahead_slot + i].valid = true;
+    }
+}
+
+void BufferedBlockDevice::readahead_submit()
+{
+    MBED_ASSERT(_readahead_handle == 0);
+
+    bd_addr_t addr = _cache_seq_next;
+    // One underlying read into consecutive slots - stop at the slot ring's
+    // wrap point and at the end of the device
+    uint32_t lines = std::min((uint32_t) BUFFERED_BD_READ_CACHE_READAHEAD - 1,
+                              _cache_lines - _cache_next_slot);
+    while (lines && (addr + (bd_size_t) lines * _cache_line_size > _bd_size)) {
+        lines--;
+    }
+    if (!lines) {
+        return;
+    }
+
+    invalidate_read_cache(addr, (bd_size_t) lines * _cache_line_size);
+
+    _readahead_slot = _cache_next_slot;
+    _readahead_lines = lines;
+    _readahead_addr = addr;
+    uint8_t *dst = _cache_buf + (bd_size_t) _cache_next_slot * _cache_line_size;
+    bd_async_handle_t handle = _async_bd->read_async(dst, addr, (bd_size_t) lines * _cache_line_size,
+                                                     mbed::callback(this, &BufferedBlockDevice::readahead_complete));
+    if (handle > 0) {
+        _readahead_handle = handle;
+        _cache_next_slot = (_cache_next_slot + lines) % _cache_lines;
+        _cache_seq_next = addr + (bd_size_t) lines * _cache_line_size;
+    }
+}
+
+int BufferedBlockDevice::cache_line_fill(bd_addr_t line_addr)
+{
+    bool sequential = (line_addr == _cache_seq_next);
+    uint32_t lines = 1;
+    if (sequential && !_async_bd) {
+        // Sequential stream detected - fetch ahead
+        lines = BUFFERED_BD_READ_CACHE_READAHEAD;
+    }
+    while ((lines > 1) && (line_addr + (bd_size_t) lines * _cache_line_size > _bd_size)) {
+        lines--;
+    }
+    if (lines > _cache_lines) {
+        lines = _cache_lines;
+    }
+
+    // Drop stale copies so round robin eviction can't leave duplicate lines
+    invalidate_read_cache(line_addr, (bd_size_t) lines * _cache_line_size);
+
+    uint32_t filled = 0;
+    while (filled < lines) {
+        // Fill consecutive slots up to the wrap point, so each batch of lines
+        // is fetched from the underlying BD in a single read
+        uint32_t slots = std::min(lines - filled, _cache_lines - _cache_next_slot);
+        uint8_t *dst = _cache_buf + (bd_size_t) _cache_next_slot * _cache_line_size;
+        bd_addr_t src = line_addr + (bd_size_t) filled * _cache_line_size;
+        int ret = _bd->read(dst, src, (bd_size_t) slots * _cache_line_size);
+        if (ret) {
+            // Slots may hold partial data now
+            for (uint32_t i = 0; i < slots; i++) {
+                _cache_line[_cache_next_slot + i].valid = false;
+            }
+            _cache_seq_next = (bd_addr_t) -1;
+            return ret;
+        }
+        for (uint32_t i = 0; i < slots; i++) {
+            _cache_line[_cache_next_slot + i].addr = src + (bd_size_t) i * _cache_line_size;
+            _cache_line[_cache_next_slot + i].valid = true;
+        }
+        _cache_next_slot = (_cache_next_slot + slots) % _cache_lines;
+        filled += slots;
+    }
+
+    _cache_seq_next = line_addr + (bd_size_t) lines * _cache_line_size;
+
+    if (_async_bd && sequential) {
+        // Fetch the following lines through the async queue, so they arrive
+        // while the caller consumes the line just read
+        readahead_submit();
+    }
+    return 0;
+}
+
+int BufferedBlockDevice::cached_read(uint8_t *buf, bd_addr_t addr, bd_size_t size)
+{
+    while (size) {
+        // The cache structures are single-threaded apart from an in-flight
+        // readahead - settle it before looking anything up
+        readahead_sync();
+
+#if BUFFERED_BD_READ_CACHE_BYPASS_SIZE
+        // Direct I/O path for bulk transfers: issue one maximal read
+        // straight to the underlying device. Cache lines are never newer
+        // than the device (programs and erases invalidate them), so they
+        // can be skipped without a coherence check, and the hot lines
+        // stay intact for metadata instead of being evicted by
+        // streaming data
+        if ((size >= BUFFERED_BD_READ_CACHE_BYPASS_SIZE) && !(addr % _bd_read_size)) {
+            bd_size_t chunk = align_down(size, _bd_read_size);
+            int ret = _bd->read(buf, addr, chunk);
+            if (ret) {
+                return ret;
+            }
+            buf += chunk;
+            addr += chunk;
+            size -= chunk;
+            continue;
+        }
+#endif
+
+        bd_addr_t line_addr = addr - addr % _cache_line_size;
+        bd_size_t chunk;
+        if (line_addr + _cache_line_size <= _bd_size) {
+            uint8_t *line = cache_line_lookup(line_addr);
+            if (!line) {
+                int ret = cache_line_fill(line_addr);
+                if (ret) {
+                    return ret;
+                }
+                line = cache_line_lookup(line_addr);
+                MBED_ASSERT(line);
+            }
+            bd_size_t offs_in_line = addr - line_addr;
+            chunk = std::min(size, _cache_line_size - offs_in_line);
+            memcpy(buf, line + offs_in_line, chunk);
+        } else {
+            // Tail of the device that doesn't cover a whole cache line -
+            // fall back to the read helper buffer
+            bd_size_t offs_in_read_buf = addr % _bd_read_size;
+            int ret;
+            if (offs_in_read_buf || (size < _bd_read_size)) {
+                chunk = std::min(size, _bd_read_size - offs_in_read_buf);
+                ret = _bd->read(_read_buf, addr - offs_in_read_buf, _bd_read_size);
+                memcpy(buf, _read_buf + offs_in_read_buf, chunk);
+            } else {
+                chunk = size - size % _bd_read_size;
+                ret = _bd->read(buf, addr, chunk);
+            }
+            if (ret) {
+                return ret;
+            }
+        }
+        buf += chunk;
+        addr += chunk;
+        size -= chunk;
+    }
+    return 0;
+}
+
+void BufferedBlockDevice::invalidate_read_cache(bd_addr_t addr, bd_size_t size)
+{
+    if (!_cache_line) {
+        return;
+    }
+    readahead_sync();
+    for (uint32_t i = 0; i < _cache_lines; i++) {
+        if (_cache_line[i].valid && (_cache_line[i].addr < addr + size) &&
+                (addr < _cache_line[i].addr + _cache_line_size)) {
+            _cache_line[i].valid = false;
+        }
+    }
+}
+#endif // BUFFERED_BD_READ_CACHE
+
 int BufferedBlockDevice::sync()
 {
     if (!_is_initialized) {
@@ -146,11 +423,13 @@ int BufferedBlockDevice::read(void *b, bd_addr_t addr, bd_size_t size)
         return BD_ERROR_DEVICE_ERROR;
     }
 
+#if !BUFFERED_BD_READ_CACHE
     // Common case - no need to involve write cache or read buffer
     if (_bd->is_valid_read(addr, size) &&
             ((addr + size <= _write_cache_addr) || (addr > _write_cache_addr + _bd_program_size))) {
         return _bd->read(b, addr, size);
     }
+#endif
 
     uint8_t *buf = static_cast<uint8_t *>(b);
 
@@ -172,6 +451,12 @@ int BufferedBlockDevice::read(void *b, bd_addr_t addr, bd_size_t size)
         // Now, in case we read from the BD, make sure we are aligned with its read size.
         // If not, use read buffer as a helper.
         if (read_from_bd) {
+#if BUFFERED_BD_READ_CACHE
+            int ret = cached_read(buf, addr, chunk);
+            if (ret) {
+                return ret;
+            }
+#else
             bd_size_t offs_in_read_buf = addr % _bd_read_size;
             int ret;
             if (offs_in_read_buf || (chunk < _bd_read_size)) {
@@ -185,6 +470,7 @@ int BufferedBlockDevice::read(void *b, bd_addr_t addr, bd_size_t size)
             if (ret) {
                 return ret;
             }
+#endif
         }
 
         buf += chunk;
@@ -205,6 +491,10 @@ int BufferedBlockDevice::program(const void *b, bd_addr_t addr, bd_size_t size)
 
     int ret;
 
+#if BUFFERED_BD_READ_CACHE
+    invalidate_read_cache(addr, size);
+#endif
+
     bd_addr_t aligned_addr = align_down(addr, _bd_program_size);
 
     const uint8_t *buf = static_cast <const uint8_t *>(b);
@@ -283,6 +573,9 @@ int BufferedBlockDevice::erase(bd_addr_t addr, bd_size_t size)
     if ((_write_cache_addr >= addr) && (_write_cache_addr <= addr + size)) {
         invalidate_write_cache();
     }
+#if BUFFERED_BD_READ_CACHE
+    invalidate_read_cache(addr, size);
+#endif
     return _bd->erase(addr, size);
 }
 
@@ -299,6 +592,9 @@ int BufferedBlockDevice::trim(bd_addr_t addr, bd_size_t size)
     if ((_write_cache_addr >= addr) && (_write_cache_addr <= addr + size)) {
         invalidate_write_cache();
     }
+#if BUFFERED_BD_READ_CACHE
+    invalidate_read_cache(addr, size);
+#endif
     return _bd->trim(addr, size);
 }
 
@@ -25,9 +25,29 @@ ChainingBlockDevice::ChainingBlockDevice(BlockDevice **bds, size_t bd_count)
     : _bds(bds), _bd_count(bd_count)
     , _read_size(0), _program_size(0), _erase_size(0), _size(0)
     , _erase_value(-1), _init_ref_count(0), _is_initialized(false)
+    , _async_bds(0), _handles(0), _bds_owned(false)
 {
 }
 
+ChainingBlockDevice::ChainingBlockDevice(AsyncBlockDevice **bds, size_t bd_count)
+    : _bds(new BlockDevice *[bd_count]), _bd_count(bd_count)
+    , _read_size(0), _program_size(0), _erase_size(0), _size(0)
+    , _erase_value(-1), _init_ref_count(0), _is_initialized(false)
+    , _async_bds(bds), _handles(new bd_async_handle_t[bd_count]), _bds_owned(true)
+{
+    for (size_t i = 0; i < bd_count; i++) {
+        _bds[i] = bds[i];
+    }
+}
+
+ChainingBlockDevice::~ChainingBlockDevice()
+{
+    if (_bds_owned) {
+        delete[] _bds;
+    }
+    delete[] _handles;
+}
+
 static bool is_aligned(uint64_t x, uint64_t alignment)
 {
     return (x / alignment) * alignment == x;
@@ -148,6 +168,13 @@ int ChainingBlockDevice::read(void *b, bd_addr_t addr, bd_size_t size)
     }
 
     uint8_t *buffer = static_cast<uint8_t *>(b);
+    int err = 0;
+
+    if (_async_bds) {
+        for (size_t i = 0; i < _bd_count; i++) {
+            _handles[i] = 0;
+        }
+    }
 
     // Find block devices containing blocks, may span multiple block devices
     for (size_t i = 0; i < _bd_count && size > 0; i++) {
@@ -159,9 +186,19 @@ int ChainingBlockDevice::read(void *b, bd_addr_t addr, bd_size_t size)
                 read = bdsize - addr;
             }
 
-            int err = _bds[i]->read(buffer, addr, read);
-            if (err) {
-                return err;
+            if (_async_bds) {
+                // Queue on each device so spanning reads run concurrently
+                bd_async_handle_t handle = _async_bds[i]->read_async(buffer, addr, read);
+                if (handle < 0) {
+                    err = handle;
+                    break;
+                }
+                _handles[i] = handle;
+            } else {
+                err = _bds[i]->read(buffer, addr, read);
+                if (err) {
+                    return err;
+                }
             }
 
             buffer += read;
@@ -172,7 +209,18 @@ int ChainingBlockDevice::read(void *b, bd_addr_t addr, bd_size_t size)
         addr -= bdsize;
     }
 
-    return 0;
+    if (_async_bds) {
+        for (size_t i = 0; i < _bd_count; i++) {
+            if (_handles[i] > 0) {
+                int ret = _async_bds[i]->wait(_handles[i]);
+                if (ret && !err) {
+                    err = ret;
+                }
+            }
+        }
+    }
+
+    return err;
 }
 
 int ChainingBlockDevice::program(const void *b, bd_addr_t addr, bd_size_t size)
@@ -186,6 +234,13 @@ int ChainingBlockDevice::program(const void *b, bd_addr_t addr, bd_size_t size)
     }
 
     const uint8_t *buffer = static_cast<const uint8_t *>(b);
+    int err = 0;
+
+    if (_async_bds) {
+        for (size_t i = 0; i < _bd_count; i++) {
+            _handles[i] = 0;
+        }
+    }
 
     // Find block devices containing blocks, may span multiple block devices
     for (size_t i = 0; i < _bd_count && size > 0; i++) {
@@ -197,9 +252,19 @@ int ChainingBlockDevice::program(const void *b, bd_addr_t addr, bd_size_t size)
                 program = bdsize - addr;
             }
 
-            int err = _bds[i]->program(buffer, addr, program);
-            if (err) {
-                return err;
+            if (_async_bds) {
+                // Queue on each device so spanning programs run concurrently
+                bd_async_handle_t handle = _async_bds[i]->program_async(buffer, addr, program);
+                if (handle < 0) {
+                    err = handle;
+                    break;
+                }
+                _handles[i] = handle;
+            } else {
+                err = _bds[i]->program(buffer, addr, program);
+                if (err) {
+                    return err;
+                }
             }
 
             buffer += program;
@@ -210,7 +275,18 @@ int ChainingBlockDevice::program(const void *b, bd_addr_t addr, bd_size_t size)
         addr -= bdsize;
     }
 
-    return 0;
+    if (_async_bds) {
+        for (size_t i = 0; i < _bd_count; i++) {
+            if (_handles[i] > 0) {
+                int ret = _async_bds[i]->wait(_handles[i]);
+                if (ret && !err) {
+                    err = ret;
+                }
+            }
+        }
+    }
+
+    return err;
 }
 
 int ChainingBlockDevice::erase(bd_addr_t addr, bd_size_t size)
@@ -17,6 +17,11 @@
 
 #include "blockdevice/ProfilingBlockDevice.h"
 #include "stddef.h"
+#include "string.h"
+#if DEVICE_USTICKER
+#include "hal/ticker_api.h"
+#include "hal/us_ticker_api.h"
+#endif
 
 namespace mbed {
 
@@ -25,7 +30,49 @@ ProfilingBlockDevice::ProfilingBlockDevice(BlockDevice *bd)
     , _read_count(0)
     , _program_count(0)
     , _erase_count(0)
+    , _slow_op_threshold_us(0)
 {
+    memset(&_read_latency, 0, sizeof(_read_latency));
+    memset(&_program_latency, 0, sizeof(_program_latency));
+    memset(&_erase_latency, 0, sizeof(_erase_latency));
+}
+
+uint32_t ProfilingBlockDevice::_sample_begin() const
+{
+#if DEVICE_USTICKER
+    return (uint32_t)ticker_read_us(get_us_ticker_data());
+#else
+    return 0;
+#endif
+}
+
+void ProfilingBlockDevice::_sample_end(bd_latency_stats_t &stats, uint32_t begin_us,
+                                       bd_profiling_op_t op, bd_addr_t addr, bd_size_t size)
+{
+#if DEVICE_USTICKER
+    uint32_t elapsed_us = (uint32_t)ticker_read_us(get_us_ticker_data()) - begin_us;
+
+    if (_slow_op_callback && elapsed_us > _slow_op_threshold_us) {
+        _slow_op_callback(op, addr, size, elapsed_us);
+    }
+
+    int bucket = 0;
+    while ((elapsed_us >> (bucket + 1)) && (bucket < bd_latency_stats_t::BUCKETS - 1)) {
+        bucket++;
+    }
+    stats.count[bucket]++;
+    stats.ops++;
+    stats.total_us += elapsed_us;
+    if (elapsed_us > stats.max_us) {
+        stats.max_us = elapsed_us;
+    }
+#else
+    (void)stats;
+    (void)begin_us;
+    (void)op;
+    (void)addr;
+    (void)size;
+#endif
 }
 
 int ProfilingBlockDevice::init()
@@ -45,27 +92,33 @@ int ProfilingBlockDevice::sync()
 
 int ProfilingBlockDevice::read(void *b, bd_addr_t addr, bd_size_t size)
 {
+    uint32_t begin = _sample_begin();
     int err = _bd->read(b, addr, size);
     if (!err) {
         _read_count += size;
+        _sample_end(_read_latency, begin, BD_PROFILING_OP_READ, addr, size);
     }
     return err;
 }
 
 int ProfilingBlockDevice::program(const void *b, bd_addr_t addr, bd_size_t size)
 {
+    uint32_t begin = _sample_begin();
     int err = _bd->program(b, addr, size);
     if (!err) {
         _program_count += size;
+        _sample_end(_program_latency, begin, BD_PROFILING_OP_PROGRAM, addr, size);
     }
     return err;
 }
 
 int ProfilingBlockDevice::erase(bd_addr_t addr, bd_size_t size)
 {
+    uint32_t begin = _sample_begin();
     int err = _bd->erase(addr, size);
     if (!err) {
         _erase_count += size;
+        _sample_end(_erase_latency, begin, BD_PROFILING_OP_ERASE, addr, size);
     }
     return err;
 }
@@ -105,6 +158,9 @@ void ProfilingBlockDevice::reset()
     _read_count = 0;
     _program_count = 0;
     _erase_count = 0;
+    memset(&_read_latency, 0, sizeof(_read_latency));
+    memset(&_program_latency, 0, sizeof(_program_latency));
+    memset(&_erase_latency, 0, sizeof(_erase_latency));
 }
 
 bd_size_t ProfilingBlockDevice::get_read_count() const
@@ -122,6 +178,28 @@ bd_size_t ProfilingBlockDevice::get_erase_count() const
     return _erase_count;
 }
 
+void ProfilingBlockDevice::get_read_latency(bd_latency_stats_t *stats) const
+{
+    *stats = _read_latency;
+}
+
+void ProfilingBlockDevice::get_program_latency(bd_latency_stats_t *stats) const
+{
+    *stats = _program_latency;
+}
+
+void ProfilingBlockDevice::get_erase_latency(bd_latency_stats_t *stats) const
+{
+    *stats = _erase_latency;
+}
+
+void ProfilingBlockDevice::set_slow_op_callback(uint32_t threshold_us,
+                                                mbed::Callback<void(bd_profiling_op_t, bd_addr_t, bd_size_t, uint32_t)> callback)
+{
+    _slow_op_threshold_us = threshold_us;
+    _slow_op_callback = callback;
+}
+
 const char *ProfilingBlockDevice::get_type() const
 {
     if (_bd != NULL) {
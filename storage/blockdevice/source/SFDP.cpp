@@ -23,6 +23,7 @@
 
 #include "platform/mbed_error.h"
 #include "blockdevice/internal/SFDP.h"
+#include "drivers/MbedCRC.h"
 
 #if (DEVICE_SPI || DEVICE_QSPI || DEVICE_OSPI)
 
@@ -458,5 +459,120 @@ int sfdp_detect_addressability(uint8_t *bptbl_ptr, sfdp_bptbl_info &bptbl_info)
 }
 #endif
 
+/** Header prepended to a serialized SFDP parameter snapshot */
+struct sfdp_cache_hdr {
+    uint32_t magic; ///< Identifies a serialized SFDP snapshot
+    uint8_t version; ///< Serialization format version
+    uint8_t device_id_size; ///< Size of the device identity following the header
+    uint16_t info_size; ///< Size of the serialized sfdp_hdr_info
+    uint32_t crc; ///< CRC32 over the device identity and parameter info
+};
+
+constexpr uint32_t SFDP_CACHE_MAGIC = 0x43444653; // "SFDC"
+constexpr uint8_t SFDP_CACHE_VERSION = 1;
+
+static uint32_t sfdp_cache_calc_crc(uint32_t init_crc, const void *data, size_t data_size)
+{
+    uint32_t crc;
+    MbedCRC<POLY_32BIT_ANSI, 32> ct(init_crc, 0x0, true, false);
+    ct.compute(data, data_size, &crc);
+    return crc;
+}
+
+int sfdp_cache_save(Callback<int(bd_addr_t, void *, bd_size_t)> cache_writer,
+                    const uint8_t *device_id,
+                    size_t device_id_size,
+                    const sfdp_hdr_info &sfdp_info)
+{
+    if (!device_id || !device_id_size || (device_id_size > SFDP_CACHE_MAX_DEVICE_ID_SIZE)) {
+        return -1;
+    }
+
+    sfdp_cache_hdr hdr;
+    hdr.magic = SFDP_CACHE_MAGIC;
+    hdr.version = SFDP_CACHE_VERSION;
+    hdr.device_id_size = device_id_size;
+    hdr.info_size = sizeof(sfdp_hdr_info);
+    hdr.crc = sfdp_cache_calc_crc(sfdp_cache_calc_crc(0xFFFFFFFF, device_id, device_id_size),
+                                  &sfdp_info, sizeof(sfdp_hdr_info));
+
+    bd_addr_t addr = 0x0;
+    if (cache_writer(addr, &hdr, sizeof(hdr)) < 0) {
+        tr_error("SFDP cache: storing snapshot header failed");
+        return -1;
+    }
+    addr += sizeof(hdr);
+
+    if (cache_writer(addr, const_cast<uint8_t *>(device_id), device_id_size) < 0) {
+        tr_error("SFDP cache: storing device identity failed");
+        return -1;
+    }
+    addr += device_id_size;
+
+    if (cache_writer(addr, const_cast<sfdp_hdr_info *>(&sfdp_info), sizeof(sfdp_hdr_info)) < 0) {
+        tr_error("SFDP cache: storing parameter info failed");
+        return -1;
+    }
+
+    return MBED_SUCCESS;
+}
+
+int sfdp_cache_load(Callback<int(bd_addr_t, void *, bd_size_t)> cache_reader,
+                    const uint8_t *device_id,
+                    size_t device_id_size,
+                    sfdp_hdr_info &sfdp_info)
+{
+    if (!device_id || !device_id_size || (device_id_size > SFDP_CACHE_MAX_DEVICE_ID_SIZE)) {
+        return -1;
+    }
+
+    sfdp_cache_hdr hdr;
+    bd_addr_t addr = 0x0;
+    if (cache_reader(addr, &hdr, sizeof(hdr)) < 0) {
+        tr_debug("SFDP cache: snapshot retrieval failed");
+        return -1;
+    }
+    addr += sizeof(hdr);
+
+    if ((hdr.magic != SFDP_CACHE_MAGIC) || (hdr.version != SFDP_CACHE_VERSION)) {
+        tr_debug("SFDP cache: no valid snapshot");
+        return -1;
+    }
+
+    // A changed identity size or an sfdp_hdr_info layout change invalidates the snapshot
+    if ((hdr.device_id_size != device_id_size) || (hdr.info_size != sizeof(sfdp_hdr_info))) {
+        tr_debug("SFDP cache: snapshot layout mismatch");
+        return -1;
+    }
+
+    uint8_t stored_id[SFDP_CACHE_MAX_DEVICE_ID_SIZE];
+    if (cache_reader(addr, stored_id, device_id_size) < 0) {
+        tr_debug("SFDP cache: snapshot retrieval failed");
+        return -1;
+    }
+    addr += device_id_size;
+
+    sfdp_hdr_info stored_info;
+    if (cache_reader(addr, &stored_info, sizeof(stored_info)) < 0) {
+        tr_debug("SFDP cache: snapshot retrieval failed");
+        return -1;
+    }
+
+    uint32_t crc = sfdp_cache_calc_crc(sfdp_cache_calc_crc(0xFFFFFFFF, stored_id, device_id_size),
+                                       &stored_info, sizeof(stored_info));
+    if (crc != hdr.crc) {
+        tr_debug("SFDP cache: snapshot CRC mismatch");
+        return -1;
+    }
+
+    if (memcmp(stored_id, device_id, device_id_size) != 0) {
+        tr_info("SFDP cache: device identity changed, full parse needed");
+        return -1;
+    }
+
+    sfdp_info = stored_info;
+    return MBED_SUCCESS;
+}
+
 } /* namespace mbed */
 #endif /* (DEVICE_SPI || DEVICE_QSPI || DEVICE_OSPI) */
@@ -0,0 +1,328 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "blockdevice/StripingBlockDevice.h"
+#include "platform/mbed_atomic.h"
+#include "platform/mbed_assert.h"
+
+namespace mbed {
+
+StripingBlockDevice::StripingBlockDevice(BlockDevice **bds, size_t bd_count, bd_size_t unit_size)
+    : _bds(bds), _bd_count(bd_count), _unit_size(unit_size)
+    , _read_size(0), _program_size(0), _erase_size(0), _size(0)
+    , _erase_value(-1), _init_ref_count(0), _is_initialized(false)
+    , _async_bds(0), _handles(0), _bds_owned(false)
+{
+}
+
+StripingBlockDevice::StripingBlockDevice(AsyncBlockDevice **bds, size_t bd_count, bd_size_t unit_size)
+    : _bds(new BlockDevice *[bd_count]), _bd_count(bd_count), _unit_size(unit_size)
+    , _read_size(0), _program_size(0), _erase_size(0), _size(0)
+    , _erase_value(-1), _init_ref_count(0), _is_initialized(false)
+    , _async_bds(bds), _handles(new bd_async_handle_t[bd_count]), _bds_owned(true)
+{
+    for (size_t i = 0; i < bd_count; i++) {
+        _bds[i] = bds[i];
+    }
+}
+
+StripingBlockDevice::~StripingBlockDevice()
+{
+    if (_bds_owned) {
+        delete[] _bds;
+    }
+    delete[] _handles;
+}
+
+static bool is_aligned(uint64_t x, uint64_t alignment)
+{
+    return (x / alignment) * alignment == x;
+}
+
+int StripingBlockDevice::init()
+{
+    int err;
+    bd_size_t min_size = 0;
+    uint32_t val = core_util_atomic_incr_u32(&_init_ref_count, 1);
+
+    if (val != 1) {
+        return BD_ERROR_OK;
+    }
+
+    _read_size = 0;
+    _program_size = 0;
+    _erase_size = 0;
+    _erase_value = -1;
+    _size = 0;
+
+    // Initialize children block devices, find all sizes and
+    // assert that block sizes are similar. We can't do this in
+    // the constructor since some block devices may need to be
+    // initialized before they know their block size/count
+    for (size_t i = 0; i < _bd_count; i++) {
+        err = _bds[i]->init();
+        if (err) {
+            goto fail;
+        }
+
+        bd_size_t read = _bds[i]->get_read_size();
+        if (i == 0 || (read >= _read_size && is_aligned(read, _read_size))) {
+            _read_size = read;
+        } else {
+            MBED_ASSERT(_read_size > read && is_aligned(_read_size, read));
+        }
+
+        bd_size_t program = _bds[i]->get_program_size();
+        if (i == 0 || (program >= _program_size && is_aligned(program, _program_size))) {
+            _program_size = program;
+        } else {
+            MBED_ASSERT(_program_size > program && is_aligned(_program_size, program));
+        }
+
+        bd_size_t erase = _bds[i]->get_erase_size();
+        if (i == 0 || (erase >= _erase_size && is_aligned(erase, _erase_size))) {
+            _erase_size = erase;
+        } else {
+            MBED_ASSERT(_erase_size > erase && is_aligned(_erase_size, erase));
+        }
+
+        int value = _bds[i]->get_erase_value();
+        if (i == 0 || value == _erase_value) {
+            _erase_value = value;
+        } else {
+            _erase_value = -1;
+        }
+
+        bd_size_t bdsize = _bds[i]->size();
+        if (i == 0 || bdsize < min_size) {
+            min_size = bdsize;
+        }
+    }
+
+    if (!_unit_size) {
+        _unit_size = _erase_size;
+    }
+    // The stripe unit must hold whole erase blocks so erases never cross
+    // a device boundary mid-block
+    MBED_ASSERT(_unit_size >= _erase_size && is_aligned(_unit_size, _erase_size));
+
+    // Each device contributes the same whole number of stripe units
+    _size = (min_size / _unit_size) * _unit_size * _bd_count;
+
+    _is_initialized = true;
+    return BD_ERROR_OK;
+
+fail:
+    _is_initialized = false;
+    _init_ref_count = 0;
+    return err;
+}
+
+int StripingBlockDevice::deinit()
+{
+    if (!_is_initialized) {
+        return BD_ERROR_OK;
+    }
+
+    uint32_t val = core_util_atomic_decr_u32(&_init_ref_count, 1);
+
+    if (val) {
+        return BD_ERROR_OK;
+    }
+
+    for (size_t i = 0; i < _bd_count; i++) {
+        int err = _bds[i]->deinit();
+        if (err) {
+            return err;
+        }
+    }
+
+    _is_initialized = false;
+    return BD_ERROR_OK;
+}
+
+int StripingBlockDevice::sync()
+{
+    if (!_is_initialized) {
+        return BD_ERROR_DEVICE_ERROR;
+    }
+
+    for (size_t i = 0; i < _bd_count; i++) {
+        int err = _bds[i]->sync();
+        if (err) {
+            return err;
+        }
+    }
+
+    return 0;
+}
+
+int StripingBlockDevice::for_each_chunk(op_type_t op, void *buffer, bd_addr_t addr, bd_size_t size)
+{
+    uint8_t *buf = static_cast<uint8_t *>(buffer);
+    int err = 0;
+
+    if (_async_bds) {
+        for (size_t i = 0; i < _bd_count; i++) {
+            _handles[i] = 0;
+        }
+    }
+
+    // Walk the transfer one stripe unit at a time - consecutive units
+    // alternate devices, so the chunks naturally spread across them
+    while (size > 0) {
+        bd_addr_t unit = addr / _unit_size;
+        bd_addr_t offset = addr % _unit_size;
+        size_t dev = unit % _bd_count;
+        bd_addr_t local = (unit / _bd_count) * _unit_size + offset;
+        bd_size_t chunk = _unit_size - offset;
+        if (chunk > size) {
+            chunk = size;
+        }
+
+        if (_async_bds && (op != STRIPE_OP_ERASE)) {
+            // At most one operation in flight per device - collect the
+            // previous one before queueing the next
+            if (_handles[dev] > 0) {
+                err = _async_bds[dev]->wait(_handles[dev]);
+                _handles[dev] = 0;
+                if (err) {
+                    break;
+                }
+            }
+            bd_async_handle_t handle;
+            if (op == STRIPE_OP_READ) {
+                handle = _async_bds[dev]->read_async(buf, local, chunk);
+            } else {
+                handle = _async_bds[dev]->program_async(buf, local, chunk);
+            }
+            if (handle < 0) {
+                err = handle;
+                break;
+            }
+            _handles[dev] = handle;
+        } else if (op == STRIPE_OP_READ) {
+            err = _bds[dev]->read(buf, local, chunk);
+        } else if (op == STRIPE_OP_PROGRAM) {
+            err = _bds[dev]->program(buf, local, chunk);
+        } else {
+            err = _bds[dev]->erase(local, chunk);
+        }
+        if (err) {
+            break;
+        }
+
+        buf += chunk;
+        addr += chunk;
+        size -= chunk;
+    }
+
+    if (_async_bds) {
+        for (size_t i = 0; i < _bd_count; i++) {
+            if (_handles[i] > 0) {
+                int ret = _async_bds[i]->wait(_handles[i]);
+                if (ret && !err) {
+                    err = ret;
+                }
+            }
+        }
+    }
+
+    return err;
+}
+
+int StripingBlockDevice::read(void *buffer, bd_addr_t addr, bd_size_t size)
+{
+    if (!_is_initialized) {
+        return BD_ERROR_DEVICE_ERROR;
+    }
+
+    if (!is_valid_read(addr, size)) {
+        return BD_ERROR_DEVICE_ERROR;
+    }
+
+    return for_each_chunk(STRIPE_OP_READ, buffer, addr, size);
+}
+
+int StripingBlockDevice::program(const void *buffer, bd_addr_t addr, bd_size_t size)
+{
+    if (!_is_initialized) {
+        return BD_ERROR_DEVICE_ERROR;
+    }
+
+    if (!is_valid_program(addr, size)) {
+        return BD_ERROR_DEVICE_ERROR;
+    }
+
+    return for_each_chunk(STRIPE_OP_PROGRAM, const_cast<void *>(buffer), addr, size);
+}
+
+int StripingBlockDevice::erase(bd_addr_t addr, bd_size_t size)
+{
+    if (!_is_initialized) {
+        return BD_ERROR_DEVICE_ERROR;
+    }
+
+    if (!is_valid_erase(addr, size)) {
+        return BD_ERROR_DEVICE_ERROR;
+    }
+
+    return for_each_chunk(STRIPE_OP_ERASE, 0, addr, size);
+}
+
+bd_size_t StripingBlockDevice::get_read_size() const
+{
+    return _read_size;
+}
+
+bd_size_t StripingBlockDevice::get_program_size() const
+{
+    return _program_size;
+}
+
+bd_size_t StripingBlockDevice::get_erase_size() const
+{
+    return _erase_size;
+}
+
+bd_size_t StripingBlockDevice::get_erase_size(bd_addr_t addr) const
+{
+    (void) addr;
+    return _erase_size;
+}
+
+int StripingBlockDevice::get_erase_value() const
+{
+    return _erase_value;
+}
+
+bd_size_t StripingBlockDevice::size() const
+{
+    return _size;
+}
+
+bd_size_t StripingBlockDevice::get_unit_size() const
+{
+    return _unit_size;
+}
+
+const char *StripingBlockDevice::get_type() const
+{
+    return "STRIPING";
+}
+
+} // namespace mbed
@@ -0,0 +1,199 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Performance measurements of the target's default block device: throughput
+ * for sequential and random access across block sizes, and per-operation
+ * latency histograms from ProfilingBlockDevice. The cases are destructive to
+ * the exercised region, like the functional block device tests. */
+
+#include "mbed.h"
+#include "greentea-client/test_env.h"
+#include "unity.h"
+#include "utest.h"
+#include "BlockDevice.h"
+#include "ProfilingBlockDevice.h"
+#include <algorithm>
+#include <inttypes.h>
+#include <stdlib.h>
+
+#if !DEVICE_USTICKER
+#error [NOT_SUPPORTED] UsTicker need to be enabled for this test
+#else
+
+using namespace utest::v1;
+using namespace std::chrono;
+
+namespace {
+const int TEST_ERASE_BLOCKS = 4;      // erase blocks exercised per case
+const bd_size_t CHUNK_SIZES[] = {512, 4096};
+const int RANDOM_READS = 64;
+
+BlockDevice *base_bd;
+ProfilingBlockDevice *profiler;
+uint8_t buffer[4096];
+bd_size_t region_size;
+bd_size_t erase_size;
+}
+
+static void perf_report(const char *name, const char *unit, int value)
+{
+    printf("MBED: perf %s = %d %s\n", name, value, unit);
+    greentea_send_kv("perf", name, value);
+}
+
+static void print_latency(const char *name, const bd_latency_stats_t &stats)
+{
+    if (stats.ops == 0) {
+        return;
+    }
+    printf("MBED: %s latency over %" PRIu32 " ops, mean %" PRIu32 " us, max %" PRIu32 " us\n",
+           name, stats.ops, (uint32_t)(stats.total_us / stats.ops), stats.max_us);
+    for (int i = 0; i < bd_latency_stats_t::BUCKETS; i++) {
+        if (stats.count[i]) {
+            printf("MBED:   <%8u us: %" PRIu32 "\n", 2u << i, stats.count[i]);
+        }
+    }
+}
+
+static int throughput_kbps(bd_size_t bytes, microseconds elapsed)
+{
+    if (elapsed.count() == 0) {
+        return 0;
+    }
+    return (int)((bytes * 8 * 1000) / elapsed.count());
+}
+
+/* Chunked program of the whole test region, erasing it first */
+static void sequential_throughput(bd_size_t chunk)
+{
+    chunk = std::max(chunk, profiler->get_program_size());
+    chunk = std::min(chunk, (bd_size_t)sizeof(buffer));
+
+    TEST_ASSERT_EQUAL(0, profiler->erase(0, region_size));
+
+    for (bd_size_t i = 0; i < sizeof(buffer); i++) {
+        buffer[i] = 0xaa ^ i;
+    }
+
+    Timer timer;
+    timer.start();
+    for (bd_addr_t addr = 0; addr + chunk <= region_size; addr += chunk) {
+        TEST_ASSERT_EQUAL(0, profiler->program(buffer, addr, chunk));
+    }
+    TEST_ASSERT_EQUAL(0, profiler->sync());
+    microseconds write_time = timer.elapsed_time();
+
+    timer.reset();
+    for (bd_addr_t addr = 0; addr + chunk <= region_size; addr += chunk) {
+        TEST_ASSERT_EQUAL(0, profiler->read(buffer, addr, chunk));
+    }
+    microseconds read_time = timer.elapsed_time();
+    timer.stop();
+
+    char name[48];
+    snprintf(name, sizeof(name), "seq_write_%u", (unsigned)chunk);
+    perf_report(name, "kbit/s", throughput_kbps(region_size, write_time));
+    snprintf(name, sizeof(name), "seq_read_%u", (unsigned)chunk);
+    perf_report(name, "kbit/s", throughput_kbps(region_size, read_time));
+}
+
+void test_sequential_throughput()
+{
+    for (size_t i = 0; i < sizeof(CHUNK_SIZES) / sizeof(CHUNK_SIZES[0]); i++) {
+        sequential_throughput(CHUNK_SIZES[i]);
+    }
+}
+
+void test_random_read_throughput()
+{
+    bd_size_t chunk = std::max((bd_size_t)512, profiler->get_read_size());
+    chunk = std::min(chunk, (bd_size_t)sizeof(buffer));
+    bd_size_t positions = region_size / chunk;
+
+    profiler->reset();
+    Timer timer;
+    timer.start();
+    for (int i = 0; i < RANDOM_READS; i++) {
+        bd_addr_t addr = (rand() % positions) * chunk;
+        TEST_ASSERT_EQUAL(0, profiler->read(buffer, addr, chunk));
+    }
+    timer.stop();
+
+    perf_report("rand_read", "kbit/s",
+                throughput_kbps(chunk * RANDOM_READS, timer.elapsed_time()));
+
+    bd_latency_stats_t stats;
+    profiler->get_read_latency(&stats);
+    print_latency("rand_read", stats);
+    TEST_ASSERT_EQUAL(RANDOM_READS, stats.ops);
+}
+
+void test_erase_latency()
+{
+    profiler->reset();
+    for (bd_addr_t addr = 0; addr < region_size; addr += profiler->get_erase_size(addr)) {
+        TEST_ASSERT_EQUAL(0, profiler->erase(addr, profiler->get_erase_size(addr)));
+    }
+
+    bd_latency_stats_t stats;
+    profiler->get_erase_latency(&stats);
+    print_latency("erase", stats);
+    TEST_ASSERT_TRUE(stats.ops > 0);
+    perf_report("erase_mean", "us", (int)(stats.total_us / stats.ops));
+    perf_report("erase_max", "us", (int)stats.max_us);
+}
+
+utest::v1::status_t greentea_setup(const size_t number_of_cases)
+{
+    GREENTEA_SETUP(120, "default_auto");
+
+    base_bd = BlockDevice::get_default_instance();
+    TEST_ASSERT_NOT_NULL(base_bd);
+    static ProfilingBlockDevice profiling_bd(base_bd);
+    profiler = &profiling_bd;
+    TEST_ASSERT_EQUAL(0, profiler->init());
+
+    erase_size = profiler->get_erase_size();
+    region_size = std::min(erase_size * TEST_ERASE_BLOCKS, profiler->size());
+    printf("MBED: device %s, region %" PRIu64 " bytes, erase block %" PRIu64 "\n",
+           profiler->get_type(), (uint64_t)region_size, (uint64_t)erase_size);
+
+    return greentea_test_setup_handler(number_of_cases);
+}
+
+void greentea_teardown(const size_t passed, const size_t failed, const failure_t failure)
+{
+    if (profiler) {
+        profiler->deinit();
+    }
+    greentea_test_teardown_handler(passed, failed, failure);
+}
+
+Case cases[] = {
+    Case("Sequential throughput across block sizes", test_sequential_throughput),
+    Case("Random read throughput and latency", test_random_read_throughput),
+    Case("Erase latency histogram", test_erase_latency),
+};
+
+Specification specification(greentea_setup, cases, greentea_teardown);
+
+int main()
+{
+    return !Harness::run(specification);
+}
+
+#endif // !DEVICE_USTICKER
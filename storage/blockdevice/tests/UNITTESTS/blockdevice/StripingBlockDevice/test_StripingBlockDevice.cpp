@@ -0,0 +1,110 @@
+/* Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+#include "blockdevice/StripingBlockDevice.h"
+#include "BlockDevice_mock.h"
+
+using ::testing::_;
+using ::testing::Return;
+
+#define BLOCK_SIZE (512)
+#define SECTORS_NUM (8)
+#define DEVICE_SIZE (BLOCK_SIZE * SECTORS_NUM)
+#define UNIT_SIZE (BLOCK_SIZE)
+
+class StripingBlockModuleTest : public testing::Test {
+protected:
+    BlockDeviceMock bd_mock1;
+    BlockDeviceMock bd_mock2;
+    BlockDevice *bds[2] = {&bd_mock1, &bd_mock2};
+    StripingBlockDevice bd{bds, 2, UNIT_SIZE};
+    uint8_t buf[BLOCK_SIZE * 4];
+
+    virtual void SetUp()
+    {
+        for (BlockDeviceMock *mock : {&bd_mock1, &bd_mock2}) {
+            ON_CALL(*mock, size()).WillByDefault(Return(DEVICE_SIZE));
+            ON_CALL(*mock, get_erase_size()).WillByDefault(Return(BLOCK_SIZE));
+            ON_CALL(*mock, get_erase_size(_)).WillByDefault(Return(BLOCK_SIZE));
+            ON_CALL(*mock, get_program_size()).WillByDefault(Return(BLOCK_SIZE));
+            ON_CALL(*mock, get_read_size()).WillByDefault(Return(BLOCK_SIZE));
+            ON_CALL(*mock, init()).WillByDefault(Return(BD_ERROR_OK));
+            ON_CALL(*mock, deinit()).WillByDefault(Return(BD_ERROR_OK));
+            ON_CALL(*mock, read(_, _, _)).WillByDefault(Return(BD_ERROR_OK));
+            ON_CALL(*mock, program(_, _, _)).WillByDefault(Return(BD_ERROR_OK));
+            ON_CALL(*mock, erase(_, _)).WillByDefault(Return(BD_ERROR_OK));
+            ON_CALL(*mock, is_valid_erase(_, _)).WillByDefault(Return(true));
+        }
+        ASSERT_EQ(bd.init(), 0);
+    }
+
+    virtual void TearDown()
+    {
+        ASSERT_EQ(bd.deinit(), 0);
+    }
+};
+
+TEST_F(StripingBlockModuleTest, geometry)
+{
+    EXPECT_EQ(bd.get_read_size(), BLOCK_SIZE);
+    EXPECT_EQ(bd.get_program_size(), BLOCK_SIZE);
+    EXPECT_EQ(bd.get_erase_size(), BLOCK_SIZE);
+    EXPECT_EQ(bd.get_unit_size(), UNIT_SIZE);
+    // Sum of both devices
+    EXPECT_EQ(bd.size(), 2 * DEVICE_SIZE);
+    EXPECT_STREQ(bd.get_type(), "STRIPING");
+}
+
+TEST_F(StripingBlockModuleTest, read_alternates_devices)
+{
+    // Units 0 and 2 are device 1's local units 0 and 1, unit 1 is device 2's
+    // local unit 0
+    EXPECT_CALL(bd_mock1, read(_, 0, BLOCK_SIZE)).WillOnce(Return(BD_ERROR_OK));
+    EXPECT_CALL(bd_mock2, read(_, 0, BLOCK_SIZE)).WillOnce(Return(BD_ERROR_OK));
+    EXPECT_CALL(bd_mock1, read(_, BLOCK_SIZE, BLOCK_SIZE)).WillOnce(Return(BD_ERROR_OK));
+
+    EXPECT_EQ(bd.read(buf, 0, 3 * BLOCK_SIZE), 0);
+}
+
+TEST_F(StripingBlockModuleTest, program_alternates_devices)
+{
+    EXPECT_CALL(bd_mock1, program(_, 2 * BLOCK_SIZE, BLOCK_SIZE)).WillOnce(Return(BD_ERROR_OK));
+    EXPECT_CALL(bd_mock2, program(_, 2 * BLOCK_SIZE, BLOCK_SIZE)).WillOnce(Return(BD_ERROR_OK));
+
+    // Units 4 and 5 map to local unit 2 on each device
+    EXPECT_EQ(bd.program(buf, 4 * BLOCK_SIZE, 2 * BLOCK_SIZE), 0);
+}
+
+TEST_F(StripingBlockModuleTest, erase_alternates_devices)
+{
+    EXPECT_CALL(bd_mock1, erase(0, BLOCK_SIZE)).WillOnce(Return(BD_ERROR_OK));
+    EXPECT_CALL(bd_mock2, erase(0, BLOCK_SIZE)).WillOnce(Return(BD_ERROR_OK));
+
+    EXPECT_EQ(bd.erase(0, 2 * BLOCK_SIZE), 0);
+}
+
+TEST_F(StripingBlockModuleTest, error_propagation)
+{
+    EXPECT_CALL(bd_mock2, read(_, _, _)).WillOnce(Return(BD_ERROR_DEVICE_ERROR));
+
+    EXPECT_EQ(bd.read(buf, 0, 4 * BLOCK_SIZE), BD_ERROR_DEVICE_ERROR);
+}
+
+TEST_F(StripingBlockModuleTest, out_of_range)
+{
+    EXPECT_EQ(bd.read(buf, 2 * DEVICE_SIZE, BLOCK_SIZE), BD_ERROR_DEVICE_ERROR);
+}
@@ -20,6 +20,11 @@
 
 
 ChainingBlockDevice::ChainingBlockDevice(BlockDevice **bds, size_t bd_count)
+    : _async_bds(0), _handles(0), _bds_owned(false)
+{
+}
+
+ChainingBlockDevice::~ChainingBlockDevice()
 {
 }
 
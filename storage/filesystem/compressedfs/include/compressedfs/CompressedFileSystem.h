@@ -0,0 +1,266 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MBED_COMPRESSEDFILESYSTEM_H
+#define MBED_COMPRESSEDFILESYSTEM_H
+
+#include "filesystem/FileSystem.h"
+#include "blockdevice/BlockDevice.h"
+#include "platform/PlatformMutex.h"
+
+// Number of decompressed blocks kept in RAM. Each line costs one block
+// size of heap (block size is a property of the image, typically 4096)
+#ifndef COMPRESSED_FS_CACHE_BLOCKS
+#define COMPRESSED_FS_CACHE_BLOCKS 2
+#endif
+
+namespace mbed {
+/** \addtogroup filesystem */
+/** @{*/
+
+/** Read-only compressed file system
+ *
+ *  Mounts an image produced by mkcompressedfs.py (next to this class in
+ *  the source tree). File data is compressed in independent fixed-size
+ *  blocks, so reads at any offset only ever decompress the blocks they
+ *  touch - the squashfs approach scaled down. Blocks that do not
+ *  compress are stored raw, and whole files that do not compress are
+ *  stored contiguously and read straight into the caller's buffer with
+ *  no intermediate copy.
+ *
+ *  Decompressed blocks are cached in a small RAM-bounded pool
+ *  (COMPRESSED_FS_CACHE_BLOCKS lines), so sequential reads with
+ *  unaligned sizes do not decompress the same block twice. The file
+ *  table and name region are read into RAM at mount; block offset
+ *  tables stay on the device and are fetched per access.
+ *
+ *  The compression is a self-contained LZSS (byte-oriented, 4KB window,
+ *  heatshrink-class ratios) so the file system has no external library
+ *  dependencies.
+ *
+ *  All mutating operations fail with -EROFS. The underlying block
+ *  device must support byte-granularity reads - wrap devices with a
+ *  larger read size in a BufferedBlockDevice.
+ *
+ * @note Synchronization level: Thread safe
+ */
+class CompressedFileSystem : public FileSystem {
+public:
+    /** Lifetime of the file system
+     *
+     *  @param name     Name to add file system to tree as
+     *  @param bd       Block device holding the image, can be passed
+     *                  later in mount
+     */
+    CompressedFileSystem(const char *name = NULL, BlockDevice *bd = NULL);
+
+    virtual ~CompressedFileSystem();
+
+    /** Mount a compressed file system image on a block device
+     *
+     *  @param bd       Block device holding the image
+     *  @return         0 on success, negative error code on failure
+     */
+    virtual int mount(BlockDevice *bd);
+
+    /** Unmount the file system from the underlying block device
+     *
+     *  @return         0 on success, negative error code on failure
+     */
+    virtual int unmount();
+
+    /** Reformat is not possible on a read-only file system
+     *
+     *  @param bd       Ignored
+     *  @return         -EROFS
+     */
+    virtual int reformat(BlockDevice *bd = NULL);
+
+    /** Remove is not possible on a read-only file system
+     *
+     *  @param path     Ignored
+     *  @return         -EROFS
+     */
+    virtual int remove(const char *path);
+
+    /** Rename is not possible on a read-only file system
+     *
+     *  @param path     Ignored
+     *  @param newpath  Ignored
+     *  @return         -EROFS
+     */
+    virtual int rename(const char *path, const char *newpath);
+
+    /** Store information about the file in a stat structure
+     *
+     *  @param path     The name of the file to find information about
+     *  @param st       The stat buffer to write to
+     *  @return         0 on success, negative error code on failure
+     */
+    virtual int stat(const char *path, struct stat *st);
+
+    /** Mkdir is not possible on a read-only file system
+     *
+     *  @param path     Ignored
+     *  @param mode     Ignored
+     *  @return         -EROFS
+     */
+    virtual int mkdir(const char *path, mode_t mode);
+
+    /** Store information about the mounted file system in a statvfs structure
+     *
+     *  @param path     The name of the file to find information about
+     *  @param buf      The stat buffer to write to
+     *  @return         0 on success, negative error code on failure
+     */
+    virtual int statvfs(const char *path, struct statvfs *buf);
+
+protected:
+#if !(DOXYGEN_ONLY)
+    /** Open a file on the file system
+     *
+     *  @param file     Destination of the newly created handle to the referenced file
+     *  @param path     The name of the file to open
+     *  @param flags    The flags to open the file in, must be O_RDONLY
+     *  @return         0 on success, negative error code on failure
+     */
+    virtual int file_open(fs_file_t *file, const char *path, int flags);
+
+    /** Close a file
+     *
+     *  @param file     File handle
+     *  @return         0 on success, negative error code on failure
+     */
+    virtual int file_close(fs_file_t file);
+
+    /** Read the contents of a file into a buffer
+     *
+     *  @param file     File handle
+     *  @param buffer   The buffer to read in to
+     *  @param size     The number of bytes to read
+     *  @return         The number of bytes read, 0 at end of file, negative error on failure
+     */
+    virtual ssize_t file_read(fs_file_t file, void *buffer, size_t size);
+
+    /** Write is not possible on a read-only file system
+     *
+     *  @param file     Ignored
+     *  @param buffer   Ignored
+     *  @param size     Ignored
+     *  @return         -EROFS
+     */
+    virtual ssize_t file_write(fs_file_t file, const void *buffer, size_t size);
+
+    /** Move the file position to a given offset from a given location
+     *
+     *  @param file     File handle
+     *  @param offset   The offset from whence to move to
+     *  @param whence   SEEK_SET, SEEK_CUR or SEEK_END
+     *  @return         The new offset of the file
+     */
+    virtual off_t file_seek(fs_file_t file, off_t offset, int whence);
+
+    /** Get the file position of the file
+     *
+     *  @param file     File handle
+     *  @return         The current offset in the file
+     */
+    virtual off_t file_tell(fs_file_t file);
+
+    /** Get the size of the file
+     *
+     *  @param file     File handle
+     *  @return         Size of the file in bytes
+     */
+    virtual off_t file_size(fs_file_t file);
+
+    /** Open a directory on the file system
+     *
+     *  @param dir      Destination for the handle to the directory
+     *  @param path     Name of the directory to open
+     *  @return         0 on success, negative error code on failure
+     */
+    virtual int dir_open(fs_dir_t *dir, const char *path);
+
+    /** Close a directory
+     *
+     *  @param dir      Dir handle
+     *  @return         0 on success, negative error code on failure
+     */
+    virtual int dir_close(fs_dir_t dir);
+
+    /** Read the next directory entry
+     *
+     *  @param dir      Dir handle
+     *  @param ent      The directory entry to fill out
+     *  @return         1 on reading a filename, 0 at the end of the directory, negative error on failure
+     */
+    virtual ssize_t dir_read(fs_dir_t dir, struct dirent *ent);
+
+    /** Set the current position of the directory
+     *
+     *  @param dir      Dir handle
+     *  @param offset   Offset of the location to seek to,
+     *                  must be a value returned from dir_tell
+     */
+    virtual void dir_seek(fs_dir_t dir, off_t offset);
+
+    /** Get the current position of the directory
+     *
+     *  @param dir      Dir handle
+     *  @return         Directory position
+     */
+    virtual off_t dir_tell(fs_dir_t dir);
+
+private:
+    // On-device file table entry
+    struct file_entry_t {
+        uint32_t name_offset;   // Offset of the name in the name region
+        uint32_t size;          // Decompressed file size
+        uint32_t flags;         // entry_stored_flag when kept uncompressed
+        uint32_t table_offset;  // Block offset table, or data for stored files
+    };
+
+    struct cache_line_t {
+        uint32_t file;
+        uint32_t block;
+        bool valid;
+    };
+
+    int find_entry(const char *path) const;
+    bool is_dir_prefix(const char *path, size_t len) const;
+    const char *entry_name(uint32_t index) const;
+    int read_block(uint32_t file, uint32_t block, uint8_t *dst, size_t raw_len);
+    int cached_block(uint32_t file, uint32_t block, size_t raw_len, uint8_t **out);
+
+    BlockDevice *_bd;
+    uint32_t _block_size;
+    uint32_t _file_count;
+    file_entry_t *_entries;
+    char *_names;
+    uint8_t *_scratch;          // Compressed input for one block
+    uint8_t *_cache_buf;
+    cache_line_t _cache[COMPRESSED_FS_CACHE_BLOCKS];
+    uint32_t _cache_next;
+    PlatformMutex _mutex;
+#endif //!defined(DOXYGEN_ONLY)
+};
+
+/** @}*/
+} // namespace mbed
+
+#endif
@@ -0,0 +1,199 @@
+#!/usr/bin/env python3
+"""
+mkcompressedfs.py - build a CompressedFileSystem image from a directory
+
+Copyright (c) 2026 ARM Limited
+SPDX-License-Identifier: Apache-2.0
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+Usage:
+    mkcompressedfs.py <directory> <image> [--block-size N]
+
+Packs every file below <directory> into a read-only image mountable with
+mbed::CompressedFileSystem. Files are compressed in independent blocks
+with the LZSS codec the file system decompresses (12-bit distance,
+lengths 3-18). Blocks that do not shrink are stored raw; files that do
+not shrink at all are stored contiguously so the target can read them
+with no decompression step.
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+MAGIC = 0x53465243  # "CRFS"
+VERSION = 1
+SUPERBLOCK_SIZE = 24
+ENTRY_SIZE = 16
+ENTRY_STORED_FLAG = 0x1
+BLOCK_RAW_FLAG = 0x80000000
+
+MAX_DIST = 4096
+MIN_LEN = 3
+MAX_LEN = 18
+
+
+def lzss_compress(data):
+    """Greedy LZSS matching the decompressor in CompressedFileSystem.cpp"""
+    heads = {}
+    items = []
+    i = 0
+    n = len(data)
+    while i < n:
+        best_len = 0
+        best_dist = 0
+        key = bytes(data[i:i + MIN_LEN])
+        if len(key) == MIN_LEN:
+            for j in reversed(heads.get(key, ())):
+                dist = i - j
+                if dist > MAX_DIST:
+                    break
+                length = 0
+                while (i + length < n and length < MAX_LEN and
+                       data[j + length] == data[i + length]):
+                    length += 1
+                if length > best_len:
+                    best_len = length
+                    best_dist = dist
+                    if length == MAX_LEN:
+                        break
+        if best_len >= MIN_LEN:
+            items.append((best_dist, best_len))
+            for k in range(best_len):
+                kk = bytes(data[i + k:i + k + MIN_LEN])
+                if len(kk) == MIN_LEN:
+                    heads.setdefault(kk, []).append(i + k)
+            i += best_len
+        else:
+            items.append(data[i])
+            heads.setdefault(key, []).append(i)
+            i += 1
+
+    out = bytearray()
+    for group in (items[g:g + 8] for g in range(0, len(items), 8)):
+        control = 0
+        body = bytearray()
+        for bit, item in enumerate(group):
+            if isinstance(item, tuple):
+                control |= 1 << bit
+                dist, length = item
+                token = (dist - 1) | ((length - MIN_LEN) << 12)
+                body += struct.pack("<H", token)
+            else:
+                body.append(item)
+        out.append(control)
+        out += body
+    return bytes(out)
+
+
+def collect(root):
+    files = []
+    for dirpath, dirnames, filenames in os.walk(root):
+        dirnames.sort()
+        for name in sorted(filenames):
+            full = os.path.join(dirpath, name)
+            rel = os.path.relpath(full, root).replace(os.sep, "/")
+            files.append((rel, full))
+    # The target deduplicates directory listings against the previous
+    # entry, which relies on a sorted table
+    files.sort()
+    return files
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Build a CompressedFileSystem image from a directory")
+    parser.add_argument("directory", help="directory to pack")
+    parser.add_argument("image", help="output image file")
+    parser.add_argument("--block-size", type=int, default=4096,
+                        help="decompression block size (default 4096)")
+    args = parser.parse_args()
+
+    if not 64 <= args.block_size <= 0x10000:
+        sys.exit("error: block size must be between 64 and 65536")
+
+    files = collect(args.directory)
+
+    names = bytearray()
+    entries = []
+    blobs = []  # (table bytes or None, data chunks)
+    for rel, full in files:
+        with open(full, "rb") as f:
+            data = f.read()
+
+        chunks = []
+        raw_flags = []
+        compressed_total = 0
+        for off in range(0, len(data), args.block_size):
+            block = data[off:off + args.block_size]
+            packed = lzss_compress(block)
+            if len(packed) < len(block):
+                chunks.append(packed)
+                raw_flags.append(False)
+            else:
+                chunks.append(block)
+                raw_flags.append(True)
+            compressed_total += len(chunks[-1])
+
+        table_size = (len(chunks) + 1) * 4
+        if compressed_total + table_size >= len(data):
+            # Incompressible - store contiguously for zero-copy reads
+            entries.append([len(names), len(data), ENTRY_STORED_FLAG, None])
+            blobs.append((None, [data]))
+        else:
+            entries.append([len(names), len(data), 0, raw_flags])
+            blobs.append((raw_flags, chunks))
+        names += rel.encode() + b"\0"
+
+    names_offset = SUPERBLOCK_SIZE + len(entries) * ENTRY_SIZE
+    pos = names_offset + len(names)
+
+    # Lay out block tables and data, back-filling entry offsets
+    out_chunks = []
+    raw_in = 0
+    for entry, (raw_flags, chunks) in zip(entries, blobs):
+        raw_in += entry[1]
+        if raw_flags is None:
+            entry[3] = pos
+            out_chunks.append(chunks[0])
+            pos += len(chunks[0])
+        else:
+            entry[3] = pos
+            data_pos = pos + (len(chunks) + 1) * 4
+            table = bytearray()
+            p = data_pos
+            for chunk, raw in zip(chunks, raw_flags):
+                table += struct.pack("<I", p | (BLOCK_RAW_FLAG if raw else 0))
+                p += len(chunk)
+            table += struct.pack("<I", p)
+            out_chunks.append(bytes(table))
+            out_chunks.extend(chunks)
+            pos = p
+
+    with open(args.image, "wb") as f:
+        f.write(struct.pack("<6I", MAGIC, VERSION, args.block_size,
+                            len(entries), names_offset, len(names)))
+        for name_off, size, flags, table_off in entries:
+            f.write(struct.pack("<4I", name_off, size, flags, table_off))
+        f.write(names)
+        for chunk in out_chunks:
+            f.write(chunk)
+
+    print("%d files, %d bytes in, %d bytes image (%.0f%%)" %
+          (len(entries), raw_in, pos, 100.0 * pos / raw_in if raw_in else 100))
+
+
+if __name__ == "__main__":
+    main()
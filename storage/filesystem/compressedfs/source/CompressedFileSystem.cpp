@@ -0,0 +1,659 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "compressedfs/CompressedFileSystem.h"
+#include "platform/mbed_debug.h"
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace mbed {
+
+// Image layout (all fields little-endian u32, produced by mkcompressedfs.py):
+//
+//   superblock   magic, version, block_size, file_count,
+//                names_offset, names_size
+//   file table   file_count entries of file_entry_t, sorted by name
+//   name region  NUL-terminated paths, no leading '/'
+//   block tables per compressed file, block_count + 1 offsets into the
+//                image; bit 31 of an offset marks that block stored raw
+//   file data    compressed (or raw) blocks back to back
+//
+// Stored files (entry_stored_flag) have no block table - table_offset is
+// the offset of their contiguous raw data.
+
+static const uint32_t crofs_magic = 0x53465243; // "CRFS"
+static const uint32_t crofs_version = 1;
+static const uint32_t crofs_superblock_size = 24;
+static const uint32_t entry_stored_flag = 0x1;
+static const uint32_t block_raw_flag = 0x80000000;
+
+// Blocks are compressed with a byte-oriented LZSS. A control byte holds
+// eight flags, consumed LSB first: 0 is a literal byte, 1 is a two-byte
+// little-endian token of 12-bit distance (minus 1, so up to 4096 back)
+// and 4-bit length (minus 3, so 3 to 18 bytes). Matches may overlap their
+// own output, which encodes runs.
+static int lzss_decompress(const uint8_t *src, size_t src_len, uint8_t *dst, size_t dst_len)
+{
+    size_t si = 0;
+    size_t di = 0;
+    uint8_t control = 0;
+    int bits = 0;
+
+    while (di < dst_len) {
+        if (!bits) {
+            if (si >= src_len) {
+                return -EILSEQ;
+            }
+            control = src[si++];
+            bits = 8;
+        }
+        if (control & 1) {
+            if (si + 2 > src_len) {
+                return -EILSEQ;
+            }
+            uint32_t token = src[si] | (src[si + 1] << 8);
+            si += 2;
+            size_t dist = (token & 0x0fff) + 1;
+            size_t len = (token >> 12) + 3;
+            if ((dist > di) || (len > dst_len - di)) {
+                return -EILSEQ;
+            }
+            for (size_t i = 0; i < len; i++) {
+                dst[di] = dst[di - dist];
+                di++;
+            }
+        } else {
+            if (si >= src_len) {
+                return -EILSEQ;
+            }
+            dst[di++] = src[si++];
+        }
+        control >>= 1;
+        bits--;
+    }
+
+    return 0;
+}
+
+static uint32_t fromle32(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t) p[3] << 24);
+}
+
+// Skip the leading '/' the retargeting layer leaves on paths
+static const char *crofs_strip(const char *path)
+{
+    while (*path == '/') {
+        path++;
+    }
+    return path;
+}
+
+struct crofs_file_t {
+    uint32_t index;
+    off_t pos;
+};
+
+struct crofs_dir_t {
+    char *prefix;       // "" for the root, otherwise "subdir/" form
+    uint32_t next;      // Next file table index to examine
+};
+
+////// Generic filesystem operations //////
+
+CompressedFileSystem::CompressedFileSystem(const char *name, BlockDevice *bd)
+    : FileSystem(name), _bd(NULL), _block_size(0), _file_count(0),
+      _entries(NULL), _names(NULL), _scratch(NULL), _cache_buf(NULL), _cache_next(0)
+{
+    memset(_cache, 0, sizeof(_cache));
+    if (bd) {
+        mount(bd);
+    }
+}
+
+CompressedFileSystem::~CompressedFileSystem()
+{
+    // nop if unmounted
+    unmount();
+}
+
+int CompressedFileSystem::mount(BlockDevice *bd)
+{
+    _mutex.lock();
+    if (_bd) {
+        _mutex.unlock();
+        return -EINVAL;
+    }
+
+    int err = bd->init();
+    if (err) {
+        _mutex.unlock();
+        return err;
+    }
+
+    uint8_t superblock[crofs_superblock_size];
+    err = bd->read(superblock, 0, sizeof(superblock));
+    if (err) {
+        bd->deinit();
+        _mutex.unlock();
+        return err;
+    }
+
+    uint32_t block_size = fromle32(&superblock[8]);
+    uint32_t file_count = fromle32(&superblock[12]);
+    uint32_t names_offset = fromle32(&superblock[16]);
+    uint32_t names_size = fromle32(&superblock[20]);
+
+    if ((fromle32(&superblock[0]) != crofs_magic) ||
+            (fromle32(&superblock[4]) != crofs_version) ||
+            (block_size < 64) || (block_size > 0x10000) ||
+            (names_offset + names_size > bd->size())) {
+        debug("crofs: no valid image found\n");
+        bd->deinit();
+        _mutex.unlock();
+        return -EINVAL;
+    }
+
+    file_entry_t *entries = (file_entry_t *) malloc(file_count * sizeof(file_entry_t));
+    char *names = (char *) malloc(names_size);
+    uint8_t *scratch = (uint8_t *) malloc(block_size);
+    uint8_t *cache_buf = (uint8_t *) malloc(COMPRESSED_FS_CACHE_BLOCKS * block_size);
+    if (!entries || !names || !scratch || !cache_buf) {
+        err = -ENOMEM;
+        goto fail;
+    }
+
+    err = bd->read(entries, crofs_superblock_size, file_count * sizeof(file_entry_t));
+    if (err) {
+        goto fail;
+    }
+    err = bd->read(names, names_offset, names_size);
+    if (err) {
+        goto fail;
+    }
+
+    // Name region must end each path, including the last one
+    if (names_size && (names[names_size - 1] != '\0')) {
+        err = -EILSEQ;
+        goto fail;
+    }
+
+    _bd = bd;
+    _block_size = block_size;
+    _file_count = file_count;
+    _entries = entries;
+    _names = names;
+    _scratch = scratch;
+    _cache_buf = cache_buf;
+    memset(_cache, 0, sizeof(_cache));
+    _cache_next = 0;
+    _mutex.unlock();
+    return 0;
+
+fail:
+    free(entries);
+    free(names);
+    free(scratch);
+    free(cache_buf);
+    bd->deinit();
+    _mutex.unlock();
+    return err;
+}
+
+int CompressedFileSystem::unmount()
+{
+    _mutex.lock();
+    if (!_bd) {
+        _mutex.unlock();
+        return 0;
+    }
+
+    int err = _bd->deinit();
+    free(_entries);
+    free(_names);
+    free(_scratch);
+    free(_cache_buf);
+    _entries = NULL;
+    _names = NULL;
+    _scratch = NULL;
+    _cache_buf = NULL;
+    _file_count = 0;
+    _bd = NULL;
+    _mutex.unlock();
+    return err;
+}
+
+int CompressedFileSystem::reformat(BlockDevice *bd)
+{
+    return -EROFS;
+}
+
+int CompressedFileSystem::remove(const char *path)
+{
+    return -EROFS;
+}
+
+int CompressedFileSystem::rename(const char *path, const char *newpath)
+{
+    return -EROFS;
+}
+
+int CompressedFileSystem::mkdir(const char *path, mode_t mode)
+{
+    return -EROFS;
+}
+
+const char *CompressedFileSystem::entry_name(uint32_t index) const
+{
+    return _names + _entries[index].name_offset;
+}
+
+int CompressedFileSystem::find_entry(const char *path) const
+{
+    for (uint32_t i = 0; i < _file_count; i++) {
+        if (strcmp(entry_name(i), path) == 0) {
+            return i;
+        }
+    }
+    return -ENOENT;
+}
+
+// True if some file lives below path (path[0..len) followed by '/')
+bool CompressedFileSystem::is_dir_prefix(const char *path, size_t len) const
+{
+    for (uint32_t i = 0; i < _file_count; i++) {
+        const char *name = entry_name(i);
+        if ((strncmp(name, path, len) == 0) && (name[len] == '/')) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int CompressedFileSystem::stat(const char *path, struct stat *st)
+{
+    path = crofs_strip(path);
+    _mutex.lock();
+    if (!_bd) {
+        _mutex.unlock();
+        return -EINVAL;
+    }
+
+    memset(st, 0, sizeof(struct stat));
+    int index = find_entry(path);
+    if (index >= 0) {
+        st->st_size = _entries[index].size;
+        st->st_mode = S_IFREG | S_IRUSR | S_IRGRP | S_IROTH;
+    } else if (!*path || is_dir_prefix(path, strlen(path))) {
+        st->st_mode = S_IFDIR | S_IRWXU | S_IRWXG | S_IRWXO;
+    } else {
+        _mutex.unlock();
+        return -ENOENT;
+    }
+    _mutex.unlock();
+    return 0;
+}
+
+int CompressedFileSystem::statvfs(const char *path, struct statvfs *buf)
+{
+    _mutex.lock();
+    if (!_bd) {
+        _mutex.unlock();
+        return -EINVAL;
+    }
+
+    memset(buf, 0, sizeof(struct statvfs));
+    buf->f_bsize = _block_size;
+    buf->f_frsize = _block_size;
+    buf->f_blocks = _bd->size() / _block_size;
+    buf->f_namemax = NAME_MAX;
+    _mutex.unlock();
+    return 0;
+}
+
+////// Block access //////
+
+// Read one decompressed block of a compressed file into dst
+int CompressedFileSystem::read_block(uint32_t file, uint32_t block, uint8_t *dst, size_t raw_len)
+{
+    uint8_t table[8];
+    int err = _bd->read(table, _entries[file].table_offset + block * 4, sizeof(table));
+    if (err) {
+        return err;
+    }
+
+    uint32_t start = fromle32(&table[0]);
+    uint32_t end = fromle32(&table[4]) & ~block_raw_flag;
+    bool raw = start & block_raw_flag;
+    start &= ~block_raw_flag;
+
+    if ((end < start) || (end > _bd->size())) {
+        return -EILSEQ;
+    }
+    size_t stored_len = end - start;
+
+    if (raw) {
+        if (stored_len != raw_len) {
+            return -EILSEQ;
+        }
+        return _bd->read(dst, start, raw_len);
+    }
+
+    // The image builder stores incompressible blocks raw, so compressed
+    // blocks are always strictly smaller than a block
+    if (stored_len >= _block_size) {
+        return -EILSEQ;
+    }
+    err = _bd->read(_scratch, start, stored_len);
+    if (err) {
+        return err;
+    }
+    return lzss_decompress(_scratch, stored_len, dst, raw_len);
+}
+
+// Return a pointer to the decompressed block, through the cache
+int CompressedFileSystem::cached_block(uint32_t file, uint32_t block, size_t raw_len, uint8_t **out)
+{
+    for (uint32_t i = 0; i < COMPRESSED_FS_CACHE_BLOCKS; i++) {
+        if (_cache[i].valid && (_cache[i].file == file) && (_cache[i].block == block)) {
+            *out = _cache_buf + i * _block_size;
+            return 0;
+        }
+    }
+
+    uint32_t line = _cache_next;
+    _cache_next = (_cache_next + 1) % COMPRESSED_FS_CACHE_BLOCKS;
+    _cache[line].valid = false;
+
+    uint8_t *buf = _cache_buf + line * _block_size;
+    int err = read_block(file, block, buf, raw_len);
+    if (err) {
+        return err;
+    }
+
+    _cache[line].file = file;
+    _cache[line].block = block;
+    _cache[line].valid = true;
+    *out = buf;
+    return 0;
+}
+
+////// File operations //////
+
+int CompressedFileSystem::file_open(fs_file_t *file, const char *path, int flags)
+{
+    if ((flags & (O_WRONLY | O_RDWR | O_CREAT | O_TRUNC | O_APPEND)) != 0) {
+        return -EROFS;
+    }
+
+    path = crofs_strip(path);
+    _mutex.lock();
+    if (!_bd) {
+        _mutex.unlock();
+        return -EINVAL;
+    }
+
+    int index = find_entry(path);
+    if (index < 0) {
+        _mutex.unlock();
+        return index;
+    }
+    _mutex.unlock();
+
+    crofs_file_t *f = new crofs_file_t;
+    f->index = index;
+    f->pos = 0;
+    *file = f;
+    return 0;
+}
+
+int CompressedFileSystem::file_close(fs_file_t file)
+{
+    delete static_cast<crofs_file_t *>(file);
+    return 0;
+}
+
+ssize_t CompressedFileSystem::file_read(fs_file_t file, void *buffer, size_t size)
+{
+    crofs_file_t *f = static_cast<crofs_file_t *>(file);
+    uint8_t *buf = static_cast<uint8_t *>(buffer);
+
+    _mutex.lock();
+    if (!_bd) {
+        _mutex.unlock();
+        return -EINVAL;
+    }
+
+    const file_entry_t &entry = _entries[f->index];
+    if ((f->pos < 0) || ((uint32_t) f->pos >= entry.size)) {
+        _mutex.unlock();
+        return 0;
+    }
+    if (size > entry.size - f->pos) {
+        size = entry.size - f->pos;
+    }
+
+    if (entry.flags & entry_stored_flag) {
+        // Stored files read straight from the device into the caller's
+        // buffer - no decompression and no intermediate copy
+        int err = _bd->read(buf, entry.table_offset + f->pos, size);
+        if (err) {
+            _mutex.unlock();
+            return err;
+        }
+        f->pos += size;
+        _mutex.unlock();
+        return size;
+    }
+
+    size_t read = 0;
+    while (read < size) {
+        uint32_t block = f->pos / _block_size;
+        size_t off = f->pos % _block_size;
+        size_t raw_len = _block_size;
+        if ((block + 1) * (uint64_t) _block_size > entry.size) {
+            raw_len = entry.size - block * _block_size;
+        }
+        size_t chunk = size - read;
+        if (chunk > raw_len - off) {
+            chunk = raw_len - off;
+        }
+
+        int err;
+        if ((off == 0) && (chunk == raw_len)) {
+            // Whole block wanted - decompress directly into the caller's
+            // buffer and leave the cache for partial reads
+            err = read_block(f->index, block, buf + read, raw_len);
+        } else {
+            uint8_t *cached;
+            err = cached_block(f->index, block, raw_len, &cached);
+            if (!err) {
+                memcpy(buf + read, cached + off, chunk);
+            }
+        }
+        if (err) {
+            _mutex.unlock();
+            return err;
+        }
+
+        f->pos += chunk;
+        read += chunk;
+    }
+
+    _mutex.unlock();
+    return read;
+}
+
+ssize_t CompressedFileSystem::file_write(fs_file_t file, const void *buffer, size_t size)
+{
+    return -EROFS;
+}
+
+off_t CompressedFileSystem::file_seek(fs_file_t file, off_t offset, int whence)
+{
+    crofs_file_t *f = static_cast<crofs_file_t *>(file);
+
+    _mutex.lock();
+    off_t pos;
+    switch (whence) {
+        case SEEK_SET:
+            pos = offset;
+            break;
+        case SEEK_CUR:
+            pos = f->pos + offset;
+            break;
+        case SEEK_END:
+            pos = (off_t) _entries[f->index].size + offset;
+            break;
+        default:
+            _mutex.unlock();
+            return -EINVAL;
+    }
+    if (pos < 0) {
+        _mutex.unlock();
+        return -EINVAL;
+    }
+    f->pos = pos;
+    _mutex.unlock();
+    return pos;
+}
+
+off_t CompressedFileSystem::file_tell(fs_file_t file)
+{
+    return static_cast<crofs_file_t *>(file)->pos;
+}
+
+off_t CompressedFileSystem::file_size(fs_file_t file)
+{
+    crofs_file_t *f = static_cast<crofs_file_t *>(file);
+    _mutex.lock();
+    off_t size = _entries[f->index].size;
+    _mutex.unlock();
+    return size;
+}
+
+////// Dir operations //////
+
+int CompressedFileSystem::dir_open(fs_dir_t *dir, const char *path)
+{
+    path = crofs_strip(path);
+    _mutex.lock();
+    if (!_bd) {
+        _mutex.unlock();
+        return -EINVAL;
+    }
+
+    size_t len = strlen(path);
+    if (len && !is_dir_prefix(path, len)) {
+        _mutex.unlock();
+        return (find_entry(path) >= 0) ? -ENOTDIR : -ENOENT;
+    }
+    _mutex.unlock();
+
+    // Keep the prefix in "subdir/" form so entries can be matched with a
+    // single strncmp
+    crofs_dir_t *d = new crofs_dir_t;
+    d->prefix = (char *) malloc(len + 2);
+    if (!d->prefix) {
+        delete d;
+        return -ENOMEM;
+    }
+    memcpy(d->prefix, path, len);
+    if (len) {
+        d->prefix[len++] = '/';
+    }
+    d->prefix[len] = '\0';
+    d->next = 0;
+    *dir = d;
+    return 0;
+}
+
+int CompressedFileSystem::dir_close(fs_dir_t dir)
+{
+    crofs_dir_t *d = static_cast<crofs_dir_t *>(dir);
+    free(d->prefix);
+    delete d;
+    return 0;
+}
+
+ssize_t CompressedFileSystem::dir_read(fs_dir_t dir, struct dirent *ent)
+{
+    crofs_dir_t *d = static_cast<crofs_dir_t *>(dir);
+    size_t plen = strlen(d->prefix);
+
+    _mutex.lock();
+    if (!_bd) {
+        _mutex.unlock();
+        return -EINVAL;
+    }
+
+    while (d->next < _file_count) {
+        const char *name = entry_name(d->next);
+        d->next++;
+        if (strncmp(name, d->prefix, plen) != 0) {
+            continue;
+        }
+
+        const char *tail = name + plen;
+        const char *slash = strchr(tail, '/');
+        if (!slash) {
+            strncpy(ent->d_name, tail, NAME_MAX);
+            ent->d_name[NAME_MAX] = '\0';
+            ent->d_type = DT_REG;
+            _mutex.unlock();
+            return 1;
+        }
+
+        // First file below a subdirectory reports the directory itself.
+        // The table is sorted, so every other file below it follows
+        // immediately - deduplicate against the previous entry
+        size_t complen = slash - tail;
+        if (d->next >= 2) {
+            const char *prev = entry_name(d->next - 2);
+            if ((strncmp(prev, d->prefix, plen) == 0) &&
+                    (strncmp(prev + plen, tail, complen) == 0) &&
+                    (prev[plen + complen] == '/')) {
+                continue;
+            }
+        }
+
+        if (complen > NAME_MAX) {
+            complen = NAME_MAX;
+        }
+        memcpy(ent->d_name, tail, complen);
+        ent->d_name[complen] = '\0';
+        ent->d_type = DT_DIR;
+        _mutex.unlock();
+        return 1;
+    }
+
+    _mutex.unlock();
+    return 0;
+}
+
+void CompressedFileSystem::dir_seek(fs_dir_t dir, off_t offset)
+{
+    static_cast<crofs_dir_t *>(dir)->next = offset;
+}
+
+off_t CompressedFileSystem::dir_tell(fs_dir_t dir)
+{
+    return static_cast<crofs_dir_t *>(dir)->next;
+}
+
+} // namespace mbed
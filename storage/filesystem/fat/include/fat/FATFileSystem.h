@@ -148,6 +148,22 @@ public:
      */
     virtual int statvfs(const char *path, struct statvfs *buf);
 
+#if FF_USE_EXPAND
+    /** Preallocate a contiguous data area to a file.
+     *
+     *  Allocates the requested number of bytes to the file as a single
+     *  unfragmented extent, creating the file if it does not exist. Writes
+     *  within the preallocated area then do not need to allocate clusters,
+     *  which keeps the write latency low and the file contiguous on the
+     *  device. The file must be empty and the file size is not changed.
+     *
+     *  @param path     The name of the file to preallocate.
+     *  @param length   The number of bytes to preallocate.
+     *  @return         0 on success, negative error code on failure.
+     */
+    virtual int preallocate(const char *path, off_t length);
+#endif
+
 protected:
 #if !(DOXYGEN_ONLY)
     /** Open a file on the file system.
@@ -25,6 +25,16 @@
 #include <errno.h>
 #include <stdlib.h>
 
+#if FF_USE_FASTSEEK
+// Number of DWORD entries in the per-file cluster link map table. Each
+// fragment of the file consumes two entries, so the table covers up to
+// (size / 2) - 1 fragments. Files too fragmented for the table fall back
+// to regular FAT chain walking.
+#ifndef MBED_CONF_FAT_CHAN_FF_FASTSEEK_CLMT_SIZE
+#define MBED_CONF_FAT_CHAN_FF_FASTSEEK_CLMT_SIZE 64
+#endif
+#endif
+
 namespace mbed {
 
 using namespace mbed;
@@ -324,6 +334,7 @@ int FATFileSystem::mount(BlockDevice *bd, bool mount)
 int FATFileSystem::unmount()
 {
     lock();
+    path_cache_clear();
     if (_id == -1) {
         unlock();
         return -EINVAL;
@@ -470,6 +481,8 @@ int FATFileSystem::remove(const char *path)
         if (res == FR_DENIED) {
             return -ENOTEMPTY;
         }
+    } else {
+        path_cache_store(path, NULL);
     }
     return fat_error_remap(res);
 }
@@ -485,6 +498,9 @@ int FATFileSystem::rename(const char *oldpath, const char *newpath)
 
     if (res != FR_OK) {
         debug_if(FFS_DBG, "f_rename() failed: %d\n", res);
+    } else {
+        // Renaming a directory moves every path beneath it
+        path_cache_clear();
     }
     return fat_error_remap(res);
 }
@@ -499,12 +515,19 @@ int FATFileSystem::mkdir(const char *path, mode_t mode)
 
     if (res != FR_OK) {
         debug_if(FFS_DBG, "f_mkdir() failed: %d\n", res);
+    } else {
+        path_cache_invalidate(path);
     }
     return fat_error_remap(res);
 }
 
 int FATFileSystem::stat(const char *path, struct stat *st)
 {
+    bool negative;
+    if (path_cache_lookup(path, st, &negative)) {
+        return negative ? -ENOENT : 0;
+    }
+
     Deferred<const char *> fpath = fat_path_prefix(_id, path);
 
     lock();
@@ -514,6 +537,9 @@ int FATFileSystem::stat(const char *path, struct stat *st)
     FRESULT res = f_stat(fpath, &f);
     if (res != FR_OK) {
         unlock();
+        if (fat_error_remap(res) == -ENOENT) {
+            path_cache_store(path, NULL);
+        }
         return fat_error_remap(res);
     }
 
@@ -525,6 +551,7 @@ int FATFileSystem::stat(const char *path, struct stat *st)
                    (S_IRWXU | S_IRWXG | S_IRWXO);
     unlock();
 
+    path_cache_store(path, st);
     return 0;
 }
 
@@ -557,6 +584,38 @@ int FATFileSystem::statvfs(const char *path, struct statvfs *buf)
     return 0;
 }
 
+#if FF_USE_EXPAND
+int FATFileSystem::preallocate(const char *path, off_t length)
+{
+    debug_if(FFS_DBG, "preallocate(%s, %lld) on filesystem [%s], drv [%d]\n",
+             path, (long long)length, getName(), _id);
+
+    FIL fh;
+    Deferred<const char *> fpath = fat_path_prefix(_id, path);
+
+    lock();
+    FRESULT res = f_open(&fh, fpath, FA_WRITE | FA_OPEN_ALWAYS);
+    if (res != FR_OK) {
+        unlock();
+        debug_if(FFS_DBG, "f_open('w') failed: %d\n", res);
+        return fat_error_remap(res);
+    }
+
+    res = f_expand(&fh, length, 1);
+    if (res != FR_OK) {
+        debug_if(FFS_DBG, "f_expand() failed: %d\n", res);
+        f_close(&fh);
+        unlock();
+        return fat_error_remap(res);
+    }
+
+    res = f_close(&fh);
+    unlock();
+
+    return fat_error_remap(res);
+}
+#endif
+
 void FATFileSystem::lock()
 {
     _ffs_mutex->lock();
@@ -573,6 +632,14 @@ int FATFileSystem::file_open(fs_file_t *file, const char *path, int flags)
 {
     debug_if(FFS_DBG, "open(%s) on filesystem [%s], drv [%d]\n", path, getName(), _id);
 
+    if (!(flags & O_CREAT)) {
+        bool negative;
+        struct stat st;
+        if (path_cache_lookup(path, &st, &negative) && negative) {
+            return -ENOENT;
+        }
+    }
+
     FIL *fh = new FIL;
     Deferred<const char *> fpath = fat_path_prefix(_id, path);
 
@@ -605,11 +672,19 @@ int FATFileSystem::file_open(fs_file_t *file, const char *path, int flags)
         unlock();
         debug_if(FFS_DBG, "f_open('w') failed: %d\n", res);
         delete fh;
+        if (fat_error_remap(res) == -ENOENT) {
+            path_cache_store(path, NULL);
+        }
         return fat_error_remap(res);
     }
 
     unlock();
 
+    if (flags & (O_CREAT | O_WRONLY | O_RDWR)) {
+        // The file may be created or resized through this handle
+        path_cache_invalidate(path);
+    }
+
     *file = fh;
     return 0;
 }
@@ -622,6 +697,9 @@ int FATFileSystem::file_close(fs_file_t file)
     FRESULT res = f_close(fh);
     unlock();
 
+#if FF_USE_FASTSEEK
+    delete[] fh->cltbl;
+#endif
     delete fh;
     return fat_error_remap(res);
 }
@@ -685,6 +763,25 @@ off_t FATFileSystem::file_seek(fs_file_t file, off_t offset, int whence)
         offset += f_tell(fh);
     }
 
+#if FF_USE_FASTSEEK
+    if (!fh->cltbl && !(fh->flag & FA_WRITE)) {
+        // Build the cluster link map on the first seek of a read-only file,
+        // so subsequent seeks resolve from the map instead of walking the
+        // FAT chain. Writable files are left in regular seek mode as the
+        // fast seek mode prevents the file from being expanded.
+        DWORD *cltbl = new DWORD[MBED_CONF_FAT_CHAN_FF_FASTSEEK_CLMT_SIZE];
+        cltbl[0] = MBED_CONF_FAT_CHAN_FF_FASTSEEK_CLMT_SIZE;
+        fh->cltbl = cltbl;
+        FRESULT mres = f_lseek(fh, CREATE_LINKMAP);
+        if (mres != FR_OK) {
+            // File too fragmented for the table - fall back to regular seeks
+            debug_if(FFS_DBG, "f_lseek(CREATE_LINKMAP) failed: %d\n", mres);
+            fh->cltbl = NULL;
+            delete[] cltbl;
+        }
+    }
+#endif
+
     FRESULT res = f_lseek(fh, offset);
     off_t noffset = fh->fptr;
     unlock();
@@ -0,0 +1,269 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ASYNC_FILE_H
+#define ASYNC_FILE_H
+
+#include "filesystem/File.h"
+#include "platform/Callback.h"
+#include "events/EventQueue.h"
+
+#ifdef MBED_CONF_RTOS_PRESENT
+#include "rtos/Thread.h"
+#include "rtos/Mutex.h"
+#include "rtos/ConditionVariable.h"
+#endif
+
+// Maximum number of operations that can be queued or in flight at once
+#ifndef ASYNC_FILE_QUEUE_DEPTH
+#define ASYNC_FILE_QUEUE_DEPTH 4
+#endif
+
+// Stack size of the worker thread executing queued operations
+#ifndef ASYNC_FILE_THREAD_STACK_SIZE
+#define ASYNC_FILE_THREAD_STACK_SIZE 1024
+#endif
+
+namespace mbed {
+/** \addtogroup filesystem */
+/** @{*/
+
+/** Handle identifying a queued asynchronous file operation. Positive when
+ *  the operation was accepted, a negative error code otherwise.
+ */
+typedef int fs_async_handle_t;
+
+/** File with an asynchronous read/write interface
+ *
+ *  read_async and write_async queue the operation and return immediately,
+ *  so a latency-sensitive caller never stalls behind the storage medium -
+ *  a dedicated worker thread executes the queue in submission order
+ *  against the file and absorbs tail latency such as flash garbage
+ *  collection pauses. Operations on the file complete in the order they
+ *  were submitted. On builds without an RTOS the same interface is kept
+ *  but operations execute before the submission call returns.
+ *
+ *  An operation's result is delivered to its completion callback when one
+ *  is given. By default the callback runs in the worker thread's context
+ *  and must not block; when a completion queue is set with
+ *  set_completion_queue(), callbacks are posted there and run in that
+ *  queue's dispatch context instead. Operations submitted without a
+ *  callback hold their result until it is collected with wait(). The
+ *  synchronous File interface remains available and acts as a barrier: it
+ *  drains the queue first, so mixed use stays ordered.
+ */
+class AsyncFile : public File {
+public:
+    /** Create an uninitialized file
+     *
+     *  Must call open to initialize the file on a file system
+     */
+    AsyncFile();
+
+    /** Create a file on a filesystem
+     *
+     *  Creates and opens a file on a filesystem, and starts the worker
+     *  thread serving its queue
+     *
+     *  @param fs       Filesystem as target for the file
+     *  @param path     The name of the file to open
+     *  @param flags    The flags to open the file in, one of O_RDONLY, O_WRONLY, O_RDWR,
+     *                  bitwise or'd with one of O_CREAT, O_TRUNC, O_APPEND
+     */
+    AsyncFile(FileSystem *fs, const char *path, int flags = O_RDONLY);
+
+    /** Destroy a file
+     *
+     *  Drains the queue and closes the file if it is still open
+     */
+    virtual ~AsyncFile();
+
+    /** Open a file on the filesystem and start the worker thread
+     *
+     *  @param fs       Filesystem as target for the file
+     *  @param path     The name of the file to open
+     *  @param flags    The flags to open the file in, one of O_RDONLY, O_WRONLY, O_RDWR,
+     *                  bitwise or'd with one of O_CREAT, O_TRUNC, O_APPEND
+     *  @return         0 on success, negative error code on failure
+     */
+    virtual int open(FileSystem *fs, const char *path, int flags = O_RDONLY);
+
+    /** Drain the queue, stop the worker thread and close the file
+     *
+     *  @return         0 on success, negative error code on failure
+     */
+    virtual int close();
+
+    /** Choose where completion callbacks run
+     *
+     *  @param queue    Event queue completion callbacks are posted to, or
+     *                  NULL to run them in the worker thread's context
+     */
+    void set_completion_queue(events::EventQueue *queue);
+
+    /** Queue a read from the file at the current position
+     *
+     *  The buffer must stay valid until the operation completes. If the
+     *  queue is full the call blocks until a slot frees up.
+     *
+     *  @param buffer   The buffer to read in to
+     *  @param size     The number of bytes to read
+     *  @param callback Invoked with the operation result on completion, or
+     *                  an empty callback to collect the result with wait()
+     *  @return         Operation handle, or a negative error code on failure
+     */
+    fs_async_handle_t read_async(void *buffer, size_t size,
+                                 mbed::Callback<void(ssize_t)> callback = nullptr);
+
+    /** Queue a write to the file at the current position
+     *
+     *  The buffer must stay valid until the operation completes. If the
+     *  queue is full the call blocks until a slot frees up.
+     *
+     *  @param buffer   The buffer to write from
+     *  @param size     The number of bytes to write
+     *  @param callback Invoked with the operation result on completion, or
+     *                  an empty callback to collect the result with wait()
+     *  @return         Operation handle, or a negative error code on failure
+     */
+    fs_async_handle_t write_async(const void *buffer, size_t size,
+                                  mbed::Callback<void(ssize_t)> callback = nullptr);
+
+    /** Wait for an asynchronous operation to complete
+     *
+     *  @param handle   Handle returned by read_async or write_async
+     *  @return         The operation's result for operations submitted
+     *                  without a callback; 0 once a callback operation has
+     *                  completed (its result went to the callback)
+     */
+    ssize_t wait(fs_async_handle_t handle);
+
+    /** Wait for all queued operations to complete
+     *
+     *  Results still held by operations submitted without a callback are
+     *  collected and their slots freed.
+     *
+     *  @return         0 if every collected operation succeeded, otherwise
+     *                  the first negative result found
+     */
+    ssize_t wait_all();
+
+    /** Read the contents of a file into a buffer, after draining the queue
+     *
+     *  @param buffer   The buffer to read in to
+     *  @param size     The number of bytes to read
+     *  @return         The number of bytes read, 0 at end of file, negative error on failure
+     */
+    virtual ssize_t read(void *buffer, size_t size);
+
+    /** Write the contents of a buffer to a file, after draining the queue
+     *
+     *  @param buffer   The buffer to write from
+     *  @param size     The number of bytes to write
+     *  @return         The number of bytes written, negative error on failure
+     */
+    virtual ssize_t write(const void *buffer, size_t size);
+
+    /** Flush any buffers associated with the file, after draining the queue
+     *
+     *  @return         0 on success, negative error code on failure
+     */
+    virtual int sync();
+
+    /** Move the file position, after draining the queue
+     *
+     *  @param offset   The offset from whence to move to
+     *  @param whence   The start of where to seek
+     *      SEEK_SET to start from beginning of file,
+     *      SEEK_CUR to start from current position in file,
+     *      SEEK_END to start from end of file
+     *  @return         The new offset of the file
+     */
+    virtual off_t seek(off_t offset, int whence = SEEK_SET);
+
+    /** Get the file position of the file, after draining the queue
+     *
+     *  @return         The current offset in the file
+     */
+    virtual off_t tell();
+
+    /** Rewind the file position to the beginning of the file, after
+     *  draining the queue
+     */
+    virtual void rewind();
+
+    /** Get the size of the file, after draining the queue
+     *
+     *  @return         Size of the file in bytes
+     */
+    virtual off_t size();
+
+    /** Truncate or extend a file, after draining the queue
+     *
+     *  @param length   The requested new length for the file
+     *  @return         Zero on success, negative error code on failure
+     */
+    virtual int truncate(off_t length);
+
+private:
+    enum op_state_t {
+        OP_FREE,        // Slot available for submission
+        OP_QUEUED,      // Waiting for the worker
+        OP_EXECUTING,   // Running against the file
+        OP_DONE,        // Completed, result awaiting collection by wait()
+    };
+
+    struct async_op_t {
+        op_state_t state;
+        fs_async_handle_t handle;
+        bool is_write;
+        void *read_buf;
+        const void *write_buf;
+        size_t size;
+        mbed::Callback<void(ssize_t)> callback;
+        ssize_t result;
+    };
+
+    fs_async_handle_t enqueue(bool is_write, void *read_buf, const void *write_buf,
+                              size_t size, mbed::Callback<void(ssize_t)> callback);
+    ssize_t execute(async_op_t &op);
+    void complete(async_op_t &op, ssize_t result);
+    int start_worker();
+    int stop_worker();
+#ifdef MBED_CONF_RTOS_PRESENT
+    void worker();
+#endif
+
+    async_op_t _ops[ASYNC_FILE_QUEUE_DEPTH];
+    uint32_t _submit_slot;
+    uint32_t _exec_slot;
+    fs_async_handle_t _next_handle;
+    events::EventQueue *_completion_queue;
+    bool _is_open;
+#ifdef MBED_CONF_RTOS_PRESENT
+    rtos::Thread *_thread;
+    mutable rtos::Mutex _mutex;
+    rtos::ConditionVariable _cond;
+    bool _shutdown;
+#endif
+};
+
+
+/** @}*/
+} // namespace mbed
+
+#endif
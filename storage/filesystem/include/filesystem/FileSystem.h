@@ -26,6 +26,20 @@
 #include "platform/FileSystemLike.h"
 #include "blockdevice/BlockDevice.h"
 
+/** Number of entries in the path lookup cache shared by FileSystem
+ *  implementations. The cache remembers the outcome of recent path
+ *  resolutions - stat results and paths known not to exist - so that
+ *  repeated lookups of the same paths do not walk the on-device
+ *  directory tree again. 0 (the default) compiles the cache out.
+ */
+#ifndef MBED_CONF_FILESYSTEM_PATH_CACHE_SIZE
+#define MBED_CONF_FILESYSTEM_PATH_CACHE_SIZE 0
+#endif
+
+#if MBED_CONF_FILESYSTEM_PATH_CACHE_SIZE
+#include "platform/PlatformMutex.h"
+#endif
+
 namespace mbed {
 /** \addtogroup file system */
 /** @{*/
@@ -55,7 +69,10 @@ public:
      *  @param name       Name to add file system to tree as.
      */
     FileSystem(const char *name = NULL);
-    virtual ~FileSystem() {}
+    virtual ~FileSystem()
+    {
+        path_cache_clear();
+    }
 
     /** Return the default file system.
      *
@@ -284,12 +301,62 @@ protected:
      *  @return         Number of files in the directory.
      */
     virtual size_t dir_size(fs_dir_t dir);
+
+#if MBED_CONF_FILESYSTEM_PATH_CACHE_SIZE
+    /** Look up a path in the path lookup cache.
+     *
+     *  @param path     Path to look up, relative to the file system root.
+     *  @param st       Filled with the cached stat result on a positive hit.
+     *  @param negative Set to true when the path is cached as nonexistent.
+     *  @return         True on a cache hit, false on a miss.
+     */
+    bool path_cache_lookup(const char *path, struct stat *st, bool *negative);
+
+    /** Insert or refresh a path lookup cache entry.
+     *
+     *  @param path     Path the entry describes.
+     *  @param st       Stat result to remember, or NULL to remember that
+     *                  the path does not exist.
+     */
+    void path_cache_store(const char *path, const struct stat *st);
+
+    /** Drop the cache entry for a single path, if present.
+     *
+     *  @param path     Path to forget.
+     */
+    void path_cache_invalidate(const char *path);
+
+    /** Drop all path lookup cache entries.
+     */
+    void path_cache_clear();
+#else
+    bool path_cache_lookup(const char *path, struct stat *st, bool *negative)
+    {
+        return false;
+    }
+    void path_cache_store(const char *path, const struct stat *st) {}
+    void path_cache_invalidate(const char *path) {}
+    void path_cache_clear() {}
+#endif
 #endif //!defined(DOXYGEN_ONLY)
 
 protected:
     // Hooks for file systemHandle
     virtual int open(FileHandle **file, const char *path, int flags);
     virtual int open(DirHandle **dir, const char *path);
+
+#if MBED_CONF_FILESYSTEM_PATH_CACHE_SIZE
+private:
+    struct path_cache_entry_t {
+        char *path;
+        struct stat st;
+        bool negative;
+    };
+
+    path_cache_entry_t _path_cache[MBED_CONF_FILESYSTEM_PATH_CACHE_SIZE];
+    size_t _path_cache_next;
+    PlatformMutex _path_cache_mutex;
+#endif
 };
 
 
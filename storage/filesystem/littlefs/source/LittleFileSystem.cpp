@@ -221,6 +221,7 @@ int LittleFileSystem::unmount()
 {
     _mutex.lock();
     LFS_INFO("unmount(%s)", "");
+    path_cache_clear();
     int res = 0;
     if (_bd) {
         int err = lfs_unmount(&_lfs);
@@ -346,6 +347,9 @@ int LittleFileSystem::remove(const char *filename)
     int err = lfs_remove(&_lfs, filename);
     LFS_INFO("remove -> %d", lfs_toerror(err));
     _mutex.unlock();
+    if (!err) {
+        path_cache_store(filename, NULL);
+    }
     return lfs_toerror(err);
 }
 
@@ -356,6 +360,10 @@ int LittleFileSystem::rename(const char *oldname, const char *newname)
     int err = lfs_rename(&_lfs, oldname, newname);
     LFS_INFO("rename -> %d", lfs_toerror(err));
     _mutex.unlock();
+    if (!err) {
+        // Renaming a directory moves every path beneath it
+        path_cache_clear();
+    }
     return lfs_toerror(err);
 }
 
@@ -366,11 +374,18 @@ int LittleFileSystem::mkdir(const char *name, mode_t mode)
     int err = lfs_mkdir(&_lfs, name);
     LFS_INFO("mkdir -> %d", lfs_toerror(err));
     _mutex.unlock();
+    if (!err) {
+        path_cache_invalidate(name);
+    }
     return lfs_toerror(err);
 }
 
 int LittleFileSystem::stat(const char *name, struct stat *st)
 {
+    bool negative;
+    if (path_cache_lookup(name, st, &negative)) {
+        return negative ? -ENOENT : 0;
+    }
     struct lfs_info info;
     _mutex.lock();
     LFS_INFO("stat(\"%s\", %p)", name, st);
@@ -379,6 +394,11 @@ int LittleFileSystem::stat(const char *name, struct stat *st)
     _mutex.unlock();
     st->st_size = info.size;
     st->st_mode = lfs_tomode(info.type);
+    if (!err) {
+        path_cache_store(name, st);
+    } else if (lfs_toerror(err) == -ENOENT) {
+        path_cache_store(name, NULL);
+    }
     return lfs_toerror(err);
 }
 
@@ -414,6 +434,13 @@ int LittleFileSystem::statvfs(const char *name, struct statvfs *st)
 ////// File operations //////
 int LittleFileSystem::file_open(fs_file_t *file, const char *path, int flags)
 {
+    if (!(flags & O_CREAT)) {
+        bool negative;
+        struct stat st;
+        if (path_cache_lookup(path, &st, &negative) && negative) {
+            return -ENOENT;
+        }
+    }
     lfs_file_t *f = new lfs_file_t;
     _mutex.lock();
     LFS_INFO("file_open(%p, \"%s\", 0x%x)", *file, path, flags);
@@ -422,8 +449,15 @@ int LittleFileSystem::file_open(fs_file_t *file, const char *path, int flags)
     _mutex.unlock();
     if (!err) {
         *file = f;
+        if (flags & (O_CREAT | O_WRONLY | O_RDWR)) {
+            // The file may be created or resized through this handle
+            path_cache_invalidate(path);
+        }
     } else {
         delete f;
+        if (lfs_toerror(err) == -ENOENT) {
+            path_cache_store(path, NULL);
+        }
     }
     return lfs_toerror(err);
 }
@@ -160,6 +160,28 @@ public:
      */
     virtual int statvfs(const char *path, struct statvfs *buf);
 
+#if MBED_LFS2_MOUNT_STATS
+    /** Mount-phase statistics */
+    struct mount_stats_t {
+        uint32_t bd_init_time_us;   ///< Time spent initializing the block device
+        uint32_t fs_mount_time_us;  ///< Time spent mounting the file system
+        lfs2_size_t block_count;    ///< Number of logical blocks of the mounted device
+        lfs2_size_t lookahead_size; ///< Effective lookahead buffer size in bytes
+        lfs2_size_t cache_size;     ///< Effective cache size in bytes
+        uint32_t block_cycles;      ///< Effective erase cycles before eviction
+    };
+
+    /** Get statistics of the last successful mount
+     *
+     *  Reports how long the block device init and the file system mount
+     *  took, along with the effective geometry-derived configuration, so
+     *  the impact of tuning can be measured on real devices.
+     *
+     *  @param stats    Filled with the statistics of the last mount
+     */
+    void get_mount_stats(mount_stats_t *stats);
+#endif
+
 protected:
 #if !(DOXYGEN_ONLY)
     /** Open a file on the file system.
@@ -293,6 +315,10 @@ private:
     struct lfs2_config _config;
     mbed::BlockDevice *_bd; // The block device
 
+#if MBED_LFS2_MOUNT_STATS
+    mount_stats_t _mount_stats;
+#endif
+
     // thread-safe locking
     PlatformMutex _mutex;
 };
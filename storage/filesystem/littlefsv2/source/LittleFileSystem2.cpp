@@ -21,6 +21,21 @@
 #include "lfs2_util.h"
 #include "MbedCRC.h"
 
+#if MBED_LFS2_MOUNT_STATS
+#include "drivers/Timer.h"
+#endif
+
+#if MBED_LFS2_AUTOTUNE
+// Upper bound for the auto-tuned lookahead buffer, in bytes
+#ifndef MBED_LFS2_AUTOTUNE_LOOKAHEAD_MAX
+#define MBED_LFS2_AUTOTUNE_LOOKAHEAD_MAX 512
+#endif
+// Upper bound for the auto-tuned cache size, in bytes
+#ifndef MBED_LFS2_AUTOTUNE_CACHE_MAX
+#define MBED_LFS2_AUTOTUNE_CACHE_MAX 1024
+#endif
+#endif
+
 namespace mbed {
 
 extern "C" uint32_t lfs2_crc(uint32_t crc, const void *buffer, size_t size)
@@ -154,6 +169,9 @@ LittleFileSystem2::LittleFileSystem2(const char *name, BlockDevice *bd,
     _config.block_cycles = block_cycles;
     _config.cache_size = cache_size;
     _config.lookahead_size = lookahead_size;
+#if MBED_LFS2_MOUNT_STATS
+    memset(&_mount_stats, 0, sizeof(_mount_stats));
+#endif
     if (bd) {
         mount(bd);
     }
@@ -169,12 +187,20 @@ int LittleFileSystem2::mount(BlockDevice *bd)
 {
     _mutex.lock();
     _bd = bd;
+#if MBED_LFS2_MOUNT_STATS
+    Timer timer;
+    timer.start();
+#endif
     int err = _bd->init();
     if (err) {
         _bd = NULL;
         _mutex.unlock();
         return err;
     }
+#if MBED_LFS2_MOUNT_STATS
+    _mount_stats.bd_init_time_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                                       timer.elapsed_time()).count();
+#endif
 
     _config.context         = bd;
     _config.read            = lfs2_bd_read;
@@ -189,6 +215,36 @@ int LittleFileSystem2::mount(BlockDevice *bd)
     _config.cache_size      = lfs2_max(_config.cache_size, _config.prog_size);
     _config.lookahead_size  = lfs2_min(_config.lookahead_size, 8 * ((_config.block_count + 63) / 64));
 
+#if MBED_LFS2_AUTOTUNE
+    // Grow the lookahead window towards full device coverage (within budget),
+    // so a free-block scan takes as few passes over the device as possible
+    lfs2_size_t full_lookahead = 8 * ((_config.block_count + 63) / 64);
+    _config.lookahead_size = lfs2_max(_config.lookahead_size,
+                                      lfs2_min(full_lookahead, MBED_LFS2_AUTOTUNE_LOOKAHEAD_MAX));
+
+    // Larger caches cut block device round-trips. The cache size must be a
+    // multiple of the program size and a factor of the block size; halving
+    // from the block size keeps both properties on power-of-two geometries.
+    lfs2_size_t cache = _config.block_size;
+    while ((cache > MBED_LFS2_AUTOTUNE_CACHE_MAX) && ((cache / 2) >= _config.prog_size)
+            && ((cache / 2) % _config.prog_size == 0)) {
+        cache /= 2;
+    }
+    if (cache > _config.cache_size) {
+        _config.cache_size = cache;
+    }
+
+    // Fewer forced evictions on devices with many blocks - each block sees
+    // the allocator less often, so wear stays even with higher cycle counts
+    uint32_t cycles = _config.block_count / 8;
+    if (cycles < 100) {
+        cycles = 100;
+    } else if (cycles > 1000) {
+        cycles = 1000;
+    }
+    _config.block_cycles = cycles;
+#endif
+
     err = lfs2_mount(&_lfs, &_config);
     if (err) {
         _bd = NULL;
@@ -196,13 +252,32 @@ int LittleFileSystem2::mount(BlockDevice *bd)
         return lfs2_toerror(err);
     }
 
+#if MBED_LFS2_MOUNT_STATS
+    _mount_stats.fs_mount_time_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                                        timer.elapsed_time()).count() - _mount_stats.bd_init_time_us;
+    _mount_stats.block_count = _config.block_count;
+    _mount_stats.lookahead_size = _config.lookahead_size;
+    _mount_stats.cache_size = _config.cache_size;
+    _mount_stats.block_cycles = _config.block_cycles;
+#endif
+
     _mutex.unlock();
     return 0;
 }
 
+#if MBED_LFS2_MOUNT_STATS
+void LittleFileSystem2::get_mount_stats(mount_stats_t *stats)
+{
+    _mutex.lock();
+    *stats = _mount_stats;
+    _mutex.unlock();
+}
+#endif
+
 int LittleFileSystem2::unmount()
 {
     _mutex.lock();
+    path_cache_clear();
     int res = 0;
     if (_bd) {
         int err = lfs2_unmount(&_lfs);
@@ -306,6 +381,9 @@ int LittleFileSystem2::remove(const char *filename)
     _mutex.lock();
     int err = lfs2_remove(&_lfs, filename);
     _mutex.unlock();
+    if (!err) {
+        path_cache_store(filename, NULL);
+    }
     return lfs2_toerror(err);
 }
 
@@ -314,6 +392,10 @@ int LittleFileSystem2::rename(const char *oldname, const char *newname)
     _mutex.lock();
     int err = lfs2_rename(&_lfs, oldname, newname);
     _mutex.unlock();
+    if (!err) {
+        // Renaming a directory moves every path beneath it
+        path_cache_clear();
+    }
     return lfs2_toerror(err);
 }
 
@@ -322,17 +404,29 @@ int LittleFileSystem2::mkdir(const char *name, mode_t mode)
     _mutex.lock();
     int err = lfs2_mkdir(&_lfs, name);
     _mutex.unlock();
+    if (!err) {
+        path_cache_invalidate(name);
+    }
     return lfs2_toerror(err);
 }
 
 int LittleFileSystem2::stat(const char *name, struct stat *st)
 {
+    bool negative;
+    if (path_cache_lookup(name, st, &negative)) {
+        return negative ? -ENOENT : 0;
+    }
     struct lfs2_info info;
     _mutex.lock();
     int err = lfs2_stat(&_lfs, name, &info);
     _mutex.unlock();
     st->st_size = info.size;
     st->st_mode = lfs2_tomode(info.type);
+    if (!err) {
+        path_cache_store(name, st);
+    } else if (lfs2_toerror(err) == -ENOENT) {
+        path_cache_store(name, NULL);
+    }
     return lfs2_toerror(err);
 }
 
@@ -360,14 +454,28 @@ int LittleFileSystem2::statvfs(const char *name, struct statvfs *st)
 ////// File operations //////
 int LittleFileSystem2::file_open(fs_file_t *file, const char *path, int flags)
 {
+    if (!(flags & O_CREAT)) {
+        bool negative;
+        struct stat st;
+        if (path_cache_lookup(path, &st, &negative) && negative) {
+            return -ENOENT;
+        }
+    }
     lfs2_file_t *f = new lfs2_file_t;
     _mutex.lock();
     int err = lfs2_file_open(&_lfs, f, path, lfs2_fromflags(flags));
     _mutex.unlock();
     if (!err) {
         *file = f;
+        if (flags & (O_CREAT | O_WRONLY | O_RDWR)) {
+            // The file may be created or resized through this handle
+            path_cache_invalidate(path);
+        }
     } else {
         delete f;
+        if (lfs2_toerror(err) == -ENOENT) {
+            path_cache_store(path, NULL);
+        }
     }
     return lfs2_toerror(err);
 }
@@ -0,0 +1,408 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "filesystem/AsyncFile.h"
+#include <errno.h>
+
+namespace mbed {
+
+AsyncFile::AsyncFile()
+    : _submit_slot(0), _exec_slot(0), _next_handle(0), _completion_queue(0), _is_open(false)
+#ifdef MBED_CONF_RTOS_PRESENT
+    , _thread(0), _cond(_mutex), _shutdown(false)
+#endif
+{
+    for (uint32_t i = 0; i < ASYNC_FILE_QUEUE_DEPTH; i++) {
+        _ops[i].state = OP_FREE;
+    }
+}
+
+AsyncFile::AsyncFile(FileSystem *fs, const char *path, int flags)
+    : AsyncFile()
+{
+    open(fs, path, flags);
+}
+
+AsyncFile::~AsyncFile()
+{
+    if (_is_open) {
+        close();
+    }
+}
+
+int AsyncFile::open(FileSystem *fs, const char *path, int flags)
+{
+    if (_is_open) {
+        return -EINVAL;
+    }
+
+    int err = File::open(fs, path, flags);
+    if (err) {
+        return err;
+    }
+
+    err = start_worker();
+    if (err) {
+        File::close();
+        return err;
+    }
+
+    _is_open = true;
+    return 0;
+}
+
+int AsyncFile::close()
+{
+    if (!_is_open) {
+        return -EINVAL;
+    }
+
+    wait_all();
+    stop_worker();
+    _is_open = false;
+    return File::close();
+}
+
+void AsyncFile::set_completion_queue(events::EventQueue *queue)
+{
+    _completion_queue = queue;
+}
+
+ssize_t AsyncFile::execute(async_op_t &op)
+{
+    if (op.is_write) {
+        return File::write(op.write_buf, op.size);
+    } else {
+        return File::read(op.read_buf, op.size);
+    }
+}
+
+void AsyncFile::complete(async_op_t &op, ssize_t result)
+{
+    if (!op.callback) {
+        return;
+    }
+    if (_completion_queue) {
+        if (_completion_queue->call(op.callback, result)) {
+            return;
+        }
+        // Out of queue memory - deliver in this context rather than drop
+        // the completion
+    }
+    op.callback(result);
+}
+
+#ifdef MBED_CONF_RTOS_PRESENT
+
+int AsyncFile::start_worker()
+{
+    _shutdown = false;
+    _thread = new rtos::Thread(osPriorityNormal, ASYNC_FILE_THREAD_STACK_SIZE, nullptr, "async_file");
+    if (_thread->start(mbed::callback(this, &AsyncFile::worker)) != osOK) {
+        delete _thread;
+        _thread = 0;
+        return -ENOMEM;
+    }
+    return 0;
+}
+
+int AsyncFile::stop_worker()
+{
+    _mutex.lock();
+    _shutdown = true;
+    _cond.notify_all();
+    _mutex.unlock();
+    _thread->join();
+    delete _thread;
+    _thread = 0;
+    return 0;
+}
+
+void AsyncFile::worker()
+{
+    _mutex.lock();
+    while (true) {
+        while (!_shutdown && (_ops[_exec_slot].state != OP_QUEUED)) {
+            _cond.wait();
+        }
+        if (_shutdown) {
+            break;
+        }
+
+        async_op_t &op = _ops[_exec_slot];
+        _exec_slot = (_exec_slot + 1) % ASYNC_FILE_QUEUE_DEPTH;
+        op.state = OP_EXECUTING;
+
+        // Run the operation with the queue unlocked so submissions and
+        // waiters aren't blocked behind the storage medium
+        _mutex.unlock();
+        ssize_t result = execute(op);
+        complete(op, result);
+        _mutex.lock();
+
+        op.result = result;
+        // Callback operations are fire-and-forget - their slot frees here.
+        // Others hold the result until wait() collects it.
+        op.state = op.callback ? OP_FREE : OP_DONE;
+        _cond.notify_all();
+    }
+    _mutex.unlock();
+}
+
+fs_async_handle_t AsyncFile::enqueue(bool is_write, void *read_buf, const void *write_buf,
+                                     size_t size, mbed::Callback<void(ssize_t)> callback)
+{
+    if (!_is_open) {
+        return -EINVAL;
+    }
+
+    _mutex.lock();
+    while (_ops[_submit_slot].state != OP_FREE) {
+        _cond.wait();
+    }
+
+    async_op_t &op = _ops[_submit_slot];
+    _submit_slot = (_submit_slot + 1) % ASYNC_FILE_QUEUE_DEPTH;
+
+    if (++_next_handle <= 0) {
+        _next_handle = 1;
+    }
+    op.handle = _next_handle;
+    op.is_write = is_write;
+    op.read_buf = read_buf;
+    op.write_buf = write_buf;
+    op.size = size;
+    op.callback = callback;
+    op.state = OP_QUEUED;
+
+    _cond.notify_all();
+    _mutex.unlock();
+    return op.handle;
+}
+
+ssize_t AsyncFile::wait(fs_async_handle_t handle)
+{
+    if (handle <= 0) {
+        return -EINVAL;
+    }
+
+    ssize_t result = 0;
+    _mutex.lock();
+    while (true) {
+        async_op_t *op = 0;
+        for (uint32_t i = 0; i < ASYNC_FILE_QUEUE_DEPTH; i++) {
+            if ((_ops[i].state != OP_FREE) && (_ops[i].handle == handle)) {
+                op = &_ops[i];
+                break;
+            }
+        }
+        if (!op) {
+            // Already completed and collected (or fire-and-forget)
+            break;
+        }
+        if (op->state == OP_DONE) {
+            result = op->result;
+            op->state = OP_FREE;
+            _cond.notify_all();
+            break;
+        }
+        _cond.wait();
+    }
+    _mutex.unlock();
+    return result;
+}
+
+ssize_t AsyncFile::wait_all()
+{
+    ssize_t result = 0;
+    _mutex.lock();
+    while (true) {
+        bool pending = false;
+        for (uint32_t i = 0; i < ASYNC_FILE_QUEUE_DEPTH; i++) {
+            if ((_ops[i].state == OP_QUEUED) || (_ops[i].state == OP_EXECUTING)) {
+                pending = true;
+            } else if (_ops[i].state == OP_DONE) {
+                if (!result && (_ops[i].result < 0)) {
+                    result = _ops[i].result;
+                }
+                _ops[i].state = OP_FREE;
+                _cond.notify_all();
+            }
+        }
+        if (!pending) {
+            break;
+        }
+        _cond.wait();
+    }
+    _mutex.unlock();
+    return result;
+}
+
+#else // MBED_CONF_RTOS_PRESENT
+
+// Without an RTOS there is no worker to hand work to - keep the interface
+// but run each operation during submission
+
+int AsyncFile::start_worker()
+{
+    return 0;
+}
+
+int AsyncFile::stop_worker()
+{
+    return 0;
+}
+
+fs_async_handle_t AsyncFile::enqueue(bool is_write, void *read_buf, const void *write_buf,
+                                     size_t size, mbed::Callback<void(ssize_t)> callback)
+{
+    if (!_is_open) {
+        return -EINVAL;
+    }
+
+    async_op_t &op = _ops[_submit_slot];
+    if (op.state != OP_FREE) {
+        // All slots hold uncollected results
+        return -ENOMEM;
+    }
+    _submit_slot = (_submit_slot + 1) % ASYNC_FILE_QUEUE_DEPTH;
+
+    if (++_next_handle <= 0) {
+        _next_handle = 1;
+    }
+    op.handle = _next_handle;
+    op.is_write = is_write;
+    op.read_buf = read_buf;
+    op.write_buf = write_buf;
+    op.size = size;
+    op.callback = callback;
+
+    ssize_t result = execute(op);
+    if (callback) {
+        complete(op, result);
+    } else {
+        op.result = result;
+        op.state = OP_DONE;
+    }
+    return op.handle;
+}
+
+ssize_t AsyncFile::wait(fs_async_handle_t handle)
+{
+    if (handle <= 0) {
+        return -EINVAL;
+    }
+
+    for (uint32_t i = 0; i < ASYNC_FILE_QUEUE_DEPTH; i++) {
+        if ((_ops[i].state == OP_DONE) && (_ops[i].handle == handle)) {
+            ssize_t result = _ops[i].result;
+            _ops[i].state = OP_FREE;
+            return result;
+        }
+    }
+    return 0;
+}
+
+ssize_t AsyncFile::wait_all()
+{
+    ssize_t result = 0;
+    for (uint32_t i = 0; i < ASYNC_FILE_QUEUE_DEPTH; i++) {
+        if (_ops[i].state == OP_DONE) {
+            if (!result && (_ops[i].result < 0)) {
+                result = _ops[i].result;
+            }
+            _ops[i].state = OP_FREE;
+        }
+    }
+    return result;
+}
+
+#endif // MBED_CONF_RTOS_PRESENT
+
+fs_async_handle_t AsyncFile::read_async(void *buffer, size_t size,
+                                        mbed::Callback<void(ssize_t)> callback)
+{
+    return enqueue(false, buffer, 0, size, callback);
+}
+
+fs_async_handle_t AsyncFile::write_async(const void *buffer, size_t size,
+                                         mbed::Callback<void(ssize_t)> callback)
+{
+    return enqueue(true, 0, buffer, size, callback);
+}
+
+ssize_t AsyncFile::read(void *buffer, size_t size)
+{
+    ssize_t err = wait_all();
+    if (err < 0) {
+        return err;
+    }
+    return File::read(buffer, size);
+}
+
+ssize_t AsyncFile::write(const void *buffer, size_t size)
+{
+    ssize_t err = wait_all();
+    if (err < 0) {
+        return err;
+    }
+    return File::write(buffer, size);
+}
+
+int AsyncFile::sync()
+{
+    ssize_t err = wait_all();
+    if (err < 0) {
+        return (int) err;
+    }
+    return File::sync();
+}
+
+off_t AsyncFile::seek(off_t offset, int whence)
+{
+    wait_all();
+    return File::seek(offset, whence);
+}
+
+off_t AsyncFile::tell()
+{
+    wait_all();
+    return File::tell();
+}
+
+void AsyncFile::rewind()
+{
+    wait_all();
+    File::rewind();
+}
+
+off_t AsyncFile::size()
+{
+    wait_all();
+    return File::size();
+}
+
+int AsyncFile::truncate(off_t length)
+{
+    ssize_t err = wait_all();
+    if (err < 0) {
+        return (int) err;
+    }
+    return File::truncate(length);
+}
+
+} // namespace mbed
@@ -19,12 +19,18 @@
 #include "filesystem/File.h"
 #include "filesystem/FileSystem.h"
 #include <errno.h>
+#include <stdlib.h>
+#include <string.h>
 
 namespace mbed {
 
 FileSystem::FileSystem(const char *name)
     : FileSystemLike(name)
 {
+#if MBED_CONF_FILESYSTEM_PATH_CACHE_SIZE
+    memset(_path_cache, 0, sizeof(_path_cache));
+    _path_cache_next = 0;
+#endif
 }
 
 int FileSystem::reformat(BlockDevice *bd)
@@ -141,6 +147,102 @@ size_t FileSystem::dir_size(fs_dir_t dir)
     return size;
 }
 
+#if MBED_CONF_FILESYSTEM_PATH_CACHE_SIZE
+
+// Cached paths are keyed without leading separators so that "name" and
+// "/name" share an entry regardless of how the caller spells the path.
+static const char *path_cache_strip(const char *path)
+{
+    while (*path == '/') {
+        path++;
+    }
+    return path;
+}
+
+bool FileSystem::path_cache_lookup(const char *path, struct stat *st, bool *negative)
+{
+    path = path_cache_strip(path);
+
+    _path_cache_mutex.lock();
+    for (size_t i = 0; i < MBED_CONF_FILESYSTEM_PATH_CACHE_SIZE; i++) {
+        if (_path_cache[i].path && !strcmp(_path_cache[i].path, path)) {
+            *negative = _path_cache[i].negative;
+            if (!_path_cache[i].negative && st) {
+                *st = _path_cache[i].st;
+            }
+            _path_cache_mutex.unlock();
+            return true;
+        }
+    }
+    _path_cache_mutex.unlock();
+    return false;
+}
+
+void FileSystem::path_cache_store(const char *path, const struct stat *st)
+{
+    path = path_cache_strip(path);
+
+    _path_cache_mutex.lock();
+    path_cache_entry_t *entry = NULL;
+    for (size_t i = 0; i < MBED_CONF_FILESYSTEM_PATH_CACHE_SIZE; i++) {
+        if (_path_cache[i].path && !strcmp(_path_cache[i].path, path)) {
+            entry = &_path_cache[i];
+            break;
+        }
+    }
+
+    if (!entry) {
+        // Evict in insertion order - the cache is small enough that a
+        // smarter replacement policy isn't worth the bookkeeping
+        entry = &_path_cache[_path_cache_next];
+        _path_cache_next = (_path_cache_next + 1) % MBED_CONF_FILESYSTEM_PATH_CACHE_SIZE;
+        free(entry->path);
+        entry->path = strdup(path);
+        if (!entry->path) {
+            // Out of memory - carry on uncached
+            _path_cache_mutex.unlock();
+            return;
+        }
+    }
+
+    if (st) {
+        entry->st = *st;
+        entry->negative = false;
+    } else {
+        memset(&entry->st, 0, sizeof(entry->st));
+        entry->negative = true;
+    }
+    _path_cache_mutex.unlock();
+}
+
+void FileSystem::path_cache_invalidate(const char *path)
+{
+    path = path_cache_strip(path);
+
+    _path_cache_mutex.lock();
+    for (size_t i = 0; i < MBED_CONF_FILESYSTEM_PATH_CACHE_SIZE; i++) {
+        if (_path_cache[i].path && !strcmp(_path_cache[i].path, path)) {
+            free(_path_cache[i].path);
+            _path_cache[i].path = NULL;
+            break;
+        }
+    }
+    _path_cache_mutex.unlock();
+}
+
+void FileSystem::path_cache_clear()
+{
+    _path_cache_mutex.lock();
+    for (size_t i = 0; i < MBED_CONF_FILESYSTEM_PATH_CACHE_SIZE; i++) {
+        free(_path_cache[i].path);
+        _path_cache[i].path = NULL;
+    }
+    _path_cache_next = 0;
+    _path_cache_mutex.unlock();
+}
+
+#endif // MBED_CONF_FILESYSTEM_PATH_CACHE_SIZE
+
 // Internally used file wrapper that manages memory on close
 template <typename F>
 class Managed : public F {
@@ -0,0 +1,160 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Times the same workload on LittleFileSystem and FATFileSystem over the
+ * target's default block device: format, mount, a small-file churn that
+ * provokes each filesystem's allocation and garbage collection behaviour,
+ * and unmount. Run on the storage the product will use, the numbers say
+ * which filesystem and block size fit it - the cases are destructive to the
+ * device contents. */
+
+#include "mbed.h"
+#include "greentea-client/test_env.h"
+#include "unity/unity.h"
+#include "utest/utest.h"
+#include "BlockDevice.h"
+#include "LittleFileSystem.h"
+#include "FATFileSystem.h"
+
+#if !DEVICE_USTICKER
+#error [NOT_SUPPORTED] UsTicker need to be enabled for this test
+#else
+
+using namespace utest::v1;
+using namespace std::chrono;
+
+namespace {
+const int CHURN_FILES = 16;
+const int CHURN_REWRITES = 4;
+const size_t FILE_SIZE = 1024;
+
+BlockDevice *bd;
+Timer timer;
+char path[64];
+uint8_t file_buffer[256];
+}
+
+static void perf_report(const char *fs_name, const char *phase, milliseconds elapsed)
+{
+    char name[48];
+    snprintf(name, sizeof(name), "%s_%s", fs_name, phase);
+    printf("MBED: perf %s = %d ms\n", name, (int)elapsed.count());
+    greentea_send_kv("perf", name, (int)elapsed.count());
+}
+
+static milliseconds timed_since(microseconds start)
+{
+    return duration_cast<milliseconds>(timer.elapsed_time() - start);
+}
+
+/* Write, rewrite and delete a set of small files - the rewrites force
+ * littlefs to relocate blocks and FAT to walk and update its tables */
+static void churn(FileSystem *fs)
+{
+    for (int pass = 0; pass < CHURN_REWRITES; pass++) {
+        for (int i = 0; i < CHURN_FILES; i++) {
+            snprintf(path, sizeof(path), "file_%d.bin", i);
+            File file;
+            TEST_ASSERT_EQUAL(0, file.open(fs, path, O_WRONLY | O_CREAT | O_TRUNC));
+            for (size_t written = 0; written < FILE_SIZE; written += sizeof(file_buffer)) {
+                TEST_ASSERT_EQUAL(sizeof(file_buffer),
+                                  file.write(file_buffer, sizeof(file_buffer)));
+            }
+            TEST_ASSERT_EQUAL(0, file.close());
+        }
+    }
+    for (int i = 0; i < CHURN_FILES; i++) {
+        snprintf(path, sizeof(path), "file_%d.bin", i);
+        TEST_ASSERT_EQUAL(0, fs->remove(path));
+    }
+}
+
+static void measure_filesystem(FileSystem *fs, const char *fs_name)
+{
+    microseconds start = timer.elapsed_time();
+    TEST_ASSERT_EQUAL(0, fs->reformat(bd));
+    perf_report(fs_name, "format", timed_since(start));
+
+    TEST_ASSERT_EQUAL(0, fs->unmount());
+    start = timer.elapsed_time();
+    TEST_ASSERT_EQUAL(0, fs->mount(bd));
+    perf_report(fs_name, "mount", timed_since(start));
+
+    start = timer.elapsed_time();
+    churn(fs);
+    perf_report(fs_name, "churn", timed_since(start));
+
+    /* Mount time over a used filesystem differs from a fresh one - littlefs
+     * scans its metadata pairs, FAT reads its tables */
+    TEST_ASSERT_EQUAL(0, fs->unmount());
+    start = timer.elapsed_time();
+    TEST_ASSERT_EQUAL(0, fs->mount(bd));
+    perf_report(fs_name, "remount_used", timed_since(start));
+
+    TEST_ASSERT_EQUAL(0, fs->unmount());
+}
+
+void test_littlefs()
+{
+    LittleFileSystem fs("lfs");
+    measure_filesystem(&fs, "littlefs");
+}
+
+void test_fat()
+{
+    FATFileSystem fs("fat");
+    measure_filesystem(&fs, "fat");
+}
+
+utest::v1::status_t greentea_setup(const size_t number_of_cases)
+{
+    GREENTEA_SETUP(300, "default_auto");
+
+    bd = BlockDevice::get_default_instance();
+    TEST_ASSERT_NOT_NULL(bd);
+    TEST_ASSERT_EQUAL(0, bd->init());
+
+    for (size_t i = 0; i < sizeof(file_buffer); i++) {
+        file_buffer[i] = (uint8_t)i;
+    }
+    timer.start();
+
+    return greentea_test_setup_handler(number_of_cases);
+}
+
+void greentea_teardown(const size_t passed, const size_t failed, const failure_t failure)
+{
+    timer.stop();
+    if (bd) {
+        bd->deinit();
+    }
+    greentea_test_teardown_handler(passed, failed, failure);
+}
+
+Case cases[] = {
+    Case("littlefs format/mount/churn timing", test_littlefs),
+    Case("FAT format/mount/churn timing", test_fat),
+};
+
+Specification specification(greentea_setup, cases, greentea_teardown);
+
+int main()
+{
+    return !Harness::run(specification);
+}
+
+#endif // !DEVICE_USTICKER
@@ -20,6 +20,7 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
+#include "mbed_error.h"
 
 namespace mbed {
 
@@ -40,6 +41,8 @@ public:
 
     typedef struct _opaque_set_handle *set_handle_t;
 
+    typedef struct _opaque_batch_handle *batch_handle_t;
+
     typedef struct _opaque_key_iterator *iterator_t;
 
     /**
@@ -160,6 +163,61 @@ public:
      */
     virtual int set_finalize(set_handle_t handle) = 0;
 
+    /**
+     * @brief Start a batch of set operations.
+     *        Writes issued through batch_set are applied together at
+     *        batch_commit, allowing implementations to coalesce the flash
+     *        programming of multiple records and to block other writers for
+     *        the duration of the batch. The default implementation applies
+     *        each batch_set immediately and commits nothing, so batches
+     *        degrade to a plain sequence of set calls on stores that don't
+     *        override it.
+     *
+     * @param[out] handle               Returned batch handle.
+     *
+     * @returns MBED_SUCCESS on success or an error code on failure
+     */
+    virtual int batch_start(batch_handle_t *handle)
+    {
+        *handle = reinterpret_cast<batch_handle_t>(this);
+        return MBED_SUCCESS;
+    }
+
+    /**
+     * @brief Set one KVStore item as part of a batch.
+     *
+     * @param[in]  handle               Batch handle.
+     * @param[in]  key                  Key - must not include '*' '/' '?' ':' ';' '\' '"' '|' ' ' '<' '>' '\'.
+     * @param[in]  buffer               Value data buffer.
+     * @param[in]  size                 Value data size.
+     * @param[in]  create_flags         Flag mask.
+     *
+     * @returns MBED_SUCCESS on success or an error code on failure
+     */
+    virtual int batch_set(batch_handle_t handle, const char *key, const void *buffer, size_t size,
+                          uint32_t create_flags)
+    {
+        if (handle != reinterpret_cast<batch_handle_t>(this)) {
+            return MBED_ERROR_INVALID_ARGUMENT;
+        }
+        return set(key, buffer, size, create_flags);
+    }
+
+    /**
+     * @brief Commit a batch of set operations.
+     *
+     * @param[in]  handle               Batch handle.
+     *
+     * @returns MBED_SUCCESS on success or an error code on failure
+     */
+    virtual int batch_commit(batch_handle_t handle)
+    {
+        if (handle != reinterpret_cast<batch_handle_t>(this)) {
+            return MBED_ERROR_INVALID_ARGUMENT;
+        }
+        return MBED_SUCCESS;
+    }
+
     /**
      * @brief Start an iteration over KVStore keys.
      *
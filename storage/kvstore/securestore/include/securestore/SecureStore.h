@@ -281,6 +281,98 @@ private:
     mbedtls_entropy_context *_entropy;
     inc_set_handle_t *_ih;
     uint8_t *_scratch_buf;
+#if SECURESTORE_READ_CACHE
+    void *_cache_head;
+    size_t _cache_size;
+
+    /**
+     * @brief Try to serve a get or get_info from the read cache.
+     *
+     * @param[in]  key                  Key.
+     * @param[in]  buffer               Value data buffer (NULL for info-only lookups).
+     * @param[in]  buffer_size          Value data buffer size.
+     * @param[out] actual_size          Actual read size.
+     * @param[in]  offset               Offset to read from in data.
+     * @param[out] info                 Returned information structure.
+     *
+     * @returns true if the request was served from the cache.
+     */
+    bool cache_lookup(const char *key, void *buffer, size_t buffer_size, size_t *actual_size,
+                      size_t offset, info_t *info);
+
+    /**
+     * @brief Add a decrypted value to the read cache, evicting least
+     *        recently used entries to stay within the RAM budget.
+     *
+     * @param[in]  key                  Key.
+     * @param[in]  data                 Decrypted value data.
+     * @param[in]  data_size            Value data size.
+     * @param[in]  create_flags         Flag mask the value was stored with.
+     *
+     * @returns none
+     */
+    void cache_insert(const char *key, const void *data, uint32_t data_size, uint32_t create_flags);
+
+    /**
+     * @brief Drop a key from the read cache.
+     *
+     * @param[in]  key                  Key.
+     *
+     * @returns none
+     */
+    void cache_invalidate(const char *key);
+
+    /**
+     * @brief Drop all read cache entries.
+     *
+     * @returns none
+     */
+    void cache_clear();
+#endif
+#if SECURESTORE_KEY_CACHE
+    void *_key_cache;
+    int _key_cache_victim;
+
+    /**
+     * @brief Look a derived record key up in the derived-key cache.
+     *
+     * @param[in]  salt                 Full derivation salt (prefix + key name).
+     * @param[out] derived_key          Returned derived key.
+     *
+     * @returns true if the key was found in the cache.
+     */
+    bool key_cache_lookup(const char *salt, uint8_t *derived_key);
+
+    /**
+     * @brief Add a derived record key to the cache, replacing the oldest
+     *        entry when full.
+     *
+     * @param[in]  salt                 Full derivation salt (prefix + key name).
+     * @param[in]  derived_key          Derived key.
+     *
+     * @returns none
+     */
+    void key_cache_insert(const char *salt, const uint8_t *derived_key);
+
+    /**
+     * @brief Zeroize and free all derived-key cache entries.
+     *
+     * @returns none
+     */
+    void key_cache_clear();
+#endif
+
+    /**
+     * @brief Derive the device-unique key for a record, consulting the
+     *        derived-key cache when enabled.
+     *
+     * @param[in]  prefix               Derivation salt prefix (encryption or authentication).
+     * @param[in]  key                  Key - record name the salt is built from.
+     * @param[out] derived_key          Returned derived key.
+     *
+     * @returns 0 on success or a negative error code on failure
+     */
+    int derive_record_key(const char *prefix, const char *key, uint8_t *derived_key);
 
     /**
      * @brief Actual get function, serving get and get_info APIs.
@@ -32,6 +32,34 @@
 #include <string.h>
 #include <stdio.h>
 
+#if SECURESTORE_READ_CACHE
+#include "MbedCRC.h"
+
+// RAM budget for the decrypted-value read cache - bytes of cached values,
+// excluding per-entry bookkeeping. Repeated reads of hot values then cost a
+// memcpy instead of a key derivation plus a full decrypt and authenticate
+// pass. Note the trade-off: enabling this keeps plaintext copies of the
+// hottest secure values in heap RAM between reads.
+#ifndef SECURESTORE_READ_CACHE_SIZE
+#define SECURESTORE_READ_CACHE_SIZE 4096
+#endif
+#endif
+
+#if SECURESTORE_KEY_CACHE
+#include "mbedtls/platform_util.h"
+
+// Number of device-unique derived record keys kept in RAM. Without the
+// cache, every record operation re-reads the root of trust from storage and
+// re-runs the CMAC based derivation - twice for an encrypted record, once
+// for the encryption key and once for the authentication key. Derived keys
+// depend only on the record name, so cached entries never go stale. Note
+// the trade-off: enabling this keeps derived record keys in heap RAM until
+// deinit.
+#ifndef SECURESTORE_KEY_CACHE_SIZE
+#define SECURESTORE_KEY_CACHE_SIZE 8
+#endif
+#endif
+
 using namespace mbed;
 
 // --------------------------------------------------------- Definitions ----------------------------------------------------------
@@ -63,6 +91,26 @@ typedef struct {
     KVStore::iterator_t underlying_it;
 } key_iterator_handle_t;
 
+#if SECURESTORE_READ_CACHE
+// read cache entry - entries form a list ordered most recently used first
+typedef struct cache_entry {
+    struct cache_entry *next;
+    uint32_t data_size;
+    uint32_t create_flags;
+    uint32_t crc;
+    char *key;
+    uint8_t *data;
+} cache_entry_t;
+#endif
+
+#if SECURESTORE_KEY_CACHE
+// derived-key cache entry - a fixed array of these, replaced round-robin
+typedef struct {
+    char *salt;
+    uint8_t key[derived_key_size];
+} key_cache_entry_t;
+#endif
+
 }
 
 // incremental set handle
@@ -80,28 +128,14 @@ struct SecureStore::inc_set_handle_t {
 
 // -------------------------------------------------- Functions Implementation ----------------------------------------------------
 
-int encrypt_decrypt_start(mbedtls_aes_context &enc_aes_ctx, uint8_t *iv, const char *key,
-                          uint8_t *ctr_buf, uint8_t *salt_buf, int salt_buf_size)
+void encrypt_decrypt_start(mbedtls_aes_context &enc_aes_ctx, uint8_t *iv, const uint8_t *encrypt_key,
+                           uint8_t *ctr_buf)
 {
-    DeviceKey &devkey = DeviceKey::get_instance();
-    char *salt = reinterpret_cast<char *>(salt_buf);
-    uint8_t encrypt_key[derived_key_size];
-    strcpy(salt, enc_prefix);
-    int pos = strlen(enc_prefix);
-    strncpy(salt + pos, key, salt_buf_size - pos - 1);
-    salt_buf[salt_buf_size - 1] = 0;
-    int os_ret = devkey.generate_derived_key(salt_buf, strlen(salt), encrypt_key,  DEVICE_KEY_16BYTE);
-    if (os_ret) {
-        return os_ret;
-    }
-
     mbedtls_aes_init(&enc_aes_ctx);
     mbedtls_aes_setkey_enc(&enc_aes_ctx, encrypt_key, enc_block_size * 8);
 
     memcpy(ctr_buf, iv, iv_size);
     memset(ctr_buf + iv_size, 0, iv_size);
-
-    return 0;
 }
 
 int encrypt_decrypt_data(mbedtls_aes_context &enc_aes_ctx, const uint8_t *in_buf,
@@ -113,21 +147,10 @@ int encrypt_decrypt_data(mbedtls_aes_context &enc_aes_ctx, const uint8_t *in_buf
                                  stream_block, in_buf, out_buf);
 }
 
-int cmac_calc_start(mbedtls_cipher_context_t &auth_ctx, const char *key, uint8_t *salt_buf, int salt_buf_size)
+int cmac_calc_start(mbedtls_cipher_context_t &auth_ctx, const uint8_t *auth_key)
 {
-    DeviceKey &devkey = DeviceKey::get_instance();
-    char *salt = reinterpret_cast<char *>(salt_buf);
-    uint8_t auth_key[derived_key_size];
-    strcpy(salt, auth_prefix);
-    int pos = strlen(auth_prefix);
-    strncpy(salt + pos, key, salt_buf_size - pos - 1);
-    salt_buf[salt_buf_size - 1] = 0;
-    int os_ret = devkey.generate_derived_key(salt_buf, strlen(salt), auth_key, DEVICE_KEY_16BYTE);
-    if (os_ret) {
-        return os_ret;
-    }
-
     const mbedtls_cipher_info_t *cipher_info = mbedtls_cipher_info_from_type(MBEDTLS_CIPHER_AES_128_ECB);
+    int os_ret;
 
     mbedtls_cipher_init(&auth_ctx);
 
@@ -169,6 +192,14 @@ SecureStore::SecureStore(KVStore *underlying_kv, KVStore *rbp_kv) :
     _is_initialized(false), _underlying_kv(underlying_kv), _rbp_kv(rbp_kv), _entropy(0),
     _ih(0), _scratch_buf(0)
 {
+#if SECURESTORE_READ_CACHE
+    _cache_head = nullptr;
+    _cache_size = 0;
+#endif
+#if SECURESTORE_KEY_CACHE
+    _key_cache = nullptr;
+    _key_cache_victim = 0;
+#endif
 }
 
 SecureStore::~SecureStore()
@@ -183,6 +214,7 @@ int SecureStore::set_start(set_handle_t *handle, const char *key, size_t final_d
     int ret, os_ret;
     info_t info;
     bool enc_started = false, auth_started = false;
+    uint8_t derived_key[derived_key_size];
 
     if (!_is_initialized) {
         return MBED_ERROR_NOT_READY;
@@ -195,6 +227,12 @@ int SecureStore::set_start(set_handle_t *handle, const char *key, size_t final_d
     _mutex.lock();
     *handle = reinterpret_cast<set_handle_t>(_ih);
 
+#if SECURESTORE_READ_CACHE
+    // The value is about to change - drop any cached copy now, before the
+    // outcome of the set sequence is known
+    cache_invalidate(key);
+#endif
+
     // Validate internal RBP data
     if (_rbp_kv) {
         ret = _rbp_kv->get_info(key, &info);
@@ -244,18 +282,21 @@ int SecureStore::set_start(set_handle_t *handle, const char *key, size_t final_d
             ret = MBED_ERROR_FAILED_OPERATION;
             goto fail;
         }
-        os_ret = encrypt_decrypt_start(_ih->enc_ctx, _ih->metadata.iv, key, _ih->ctr_buf, _scratch_buf,
-                                       scratch_buf_size);
+        os_ret = derive_record_key(enc_prefix, key, derived_key);
         if (os_ret) {
             ret = MBED_ERROR_FAILED_OPERATION;
             goto fail;
         }
+        encrypt_decrypt_start(_ih->enc_ctx, _ih->metadata.iv, derived_key, _ih->ctr_buf);
         enc_started = true;
     } else {
         memset(_ih->metadata.iv, 0, iv_size);
     }
 
-    os_ret = cmac_calc_start(_ih->auth_ctx, key, _scratch_buf, scratch_buf_size);
+    os_ret = derive_record_key(auth_prefix, key, derived_key);
+    if (!os_ret) {
+        os_ret = cmac_calc_start(_ih->auth_ctx, derived_key);
+    }
     if (os_ret) {
         ret = MBED_ERROR_FAILED_OPERATION;
         goto fail;
@@ -480,6 +521,10 @@ int SecureStore::remove(const char *key)
     info_t info;
     _mutex.lock();
 
+#if SECURESTORE_READ_CACHE
+    cache_invalidate(key);
+#endif
+
     int ret = do_get(key, 0, 0, 0, 0, &info);
     // Allow deleting key if read error is of our own errors
     if ((ret != MBED_SUCCESS) && (ret != MBED_ERROR_AUTHENTICATION_FAILED) &&
@@ -528,6 +573,7 @@ int SecureStore::do_get(const char *key, void *buffer, size_t buffer_size, size_
     uint32_t create_flags;
     size_t read_len;
     info_t rbp_info;
+    uint8_t derived_key[derived_key_size];
 
     if (!is_valid_key(key)) {
         return MBED_ERROR_INVALID_ARGUMENT;
@@ -576,7 +622,10 @@ int SecureStore::do_get(const char *key, void *buffer, size_t buffer_size, size_
         goto end;
     }
 
-    os_ret = cmac_calc_start(_ih->auth_ctx, key, _scratch_buf, scratch_buf_size);
+    os_ret = derive_record_key(auth_prefix, key, derived_key);
+    if (!os_ret) {
+        os_ret = cmac_calc_start(_ih->auth_ctx, derived_key);
+    }
     if (os_ret) {
         ret = MBED_ERROR_FAILED_OPERATION;
         goto end;
@@ -596,12 +645,12 @@ int SecureStore::do_get(const char *key, void *buffer, size_t buffer_size, size_
     }
 
     if (create_flags & REQUIRE_CONFIDENTIALITY_FLAG) {
-        os_ret = encrypt_decrypt_start(_ih->enc_ctx, _ih->metadata.iv, key, _ih->ctr_buf, _scratch_buf,
-                                       scratch_buf_size);
+        os_ret = derive_record_key(enc_prefix, key, derived_key);
         if (os_ret) {
             ret = MBED_ERROR_FAILED_OPERATION;
             goto end;
         }
+        encrypt_decrypt_start(_ih->enc_ctx, _ih->metadata.iv, derived_key, _ih->ctr_buf);
         enc_started = true;
     }
 
@@ -718,11 +767,269 @@ end:
     return ret;
 }
 
+#if SECURESTORE_READ_CACHE
+
+static uint32_t cache_calc_crc(const uint8_t *data, uint32_t data_size)
+{
+    uint32_t crc;
+    MbedCRC<POLY_32BIT_ANSI, 32> ct(0xFFFFFFFF, 0x0, true, false);
+    ct.compute(data, data_size, &crc);
+    return crc;
+}
+
+bool SecureStore::cache_lookup(const char *key, void *buffer, size_t buffer_size,
+                               size_t *actual_size, size_t offset, info_t *info)
+{
+    cache_entry_t *entry = static_cast<cache_entry_t *>(_cache_head);
+    cache_entry_t *prev = nullptr;
+
+    if (!key) {
+        return false;
+    }
+
+    while (entry && strcmp(entry->key, key)) {
+        prev = entry;
+        entry = entry->next;
+    }
+    if (!entry) {
+        return false;
+    }
+
+    // A hit skips the CMAC pass, so revalidate the cached plaintext against
+    // RAM corruption before trusting it
+    if (cache_calc_crc(entry->data, entry->data_size) != entry->crc) {
+        if (prev) {
+            prev->next = entry->next;
+        } else {
+            _cache_head = entry->next;
+        }
+        _cache_size -= entry->data_size;
+        delete[] entry->key;
+        delete[] entry->data;
+        delete entry;
+        return false;
+    }
+
+    // Move to list head - entries are kept in recency order for eviction
+    if (prev) {
+        prev->next = entry->next;
+        entry->next = static_cast<cache_entry_t *>(_cache_head);
+        _cache_head = entry;
+    }
+
+    if (buffer) {
+        if (offset >= entry->data_size) {
+            // Leave out-of-range reads to the regular path
+            return false;
+        }
+        size_t copy_size = std::min(buffer_size, (size_t)(entry->data_size - offset));
+        memcpy(buffer, entry->data + offset, copy_size);
+        if (actual_size) {
+            *actual_size = copy_size;
+        }
+    } else if (actual_size) {
+        *actual_size = 0;
+    }
+
+    if (info) {
+        info->size = entry->data_size;
+        info->flags = entry->create_flags;
+    }
+
+    return true;
+}
+
+void SecureStore::cache_insert(const char *key, const void *data, uint32_t data_size,
+                               uint32_t create_flags)
+{
+    if (data_size > SECURESTORE_READ_CACHE_SIZE) {
+        return;
+    }
+
+    // No duplicates - the key may already be cached from an older read
+    cache_invalidate(key);
+
+    // Evict from the cold end of the list until the new value fits
+    while (_cache_size + data_size > SECURESTORE_READ_CACHE_SIZE) {
+        cache_entry_t *entry = static_cast<cache_entry_t *>(_cache_head);
+        cache_entry_t *prev = nullptr;
+        while (entry->next) {
+            prev = entry;
+            entry = entry->next;
+        }
+        if (prev) {
+            prev->next = nullptr;
+        } else {
+            _cache_head = nullptr;
+        }
+        _cache_size -= entry->data_size;
+        delete[] entry->key;
+        delete[] entry->data;
+        delete entry;
+    }
+
+    cache_entry_t *entry = new cache_entry_t;
+    entry->key = new char[strlen(key) + 1];
+    strcpy(entry->key, key);
+    entry->data = new uint8_t[data_size];
+    memcpy(entry->data, data, data_size);
+    entry->data_size = data_size;
+    entry->create_flags = create_flags;
+    entry->crc = cache_calc_crc(entry->data, data_size);
+    entry->next = static_cast<cache_entry_t *>(_cache_head);
+    _cache_head = entry;
+    _cache_size += data_size;
+}
+
+void SecureStore::cache_invalidate(const char *key)
+{
+    cache_entry_t *entry = static_cast<cache_entry_t *>(_cache_head);
+    cache_entry_t *prev = nullptr;
+
+    if (!key) {
+        return;
+    }
+
+    while (entry && strcmp(entry->key, key)) {
+        prev = entry;
+        entry = entry->next;
+    }
+    if (!entry) {
+        return;
+    }
+
+    if (prev) {
+        prev->next = entry->next;
+    } else {
+        _cache_head = entry->next;
+    }
+    _cache_size -= entry->data_size;
+    delete[] entry->key;
+    delete[] entry->data;
+    delete entry;
+}
+
+void SecureStore::cache_clear()
+{
+    cache_entry_t *entry = static_cast<cache_entry_t *>(_cache_head);
+
+    while (entry) {
+        cache_entry_t *next = entry->next;
+        delete[] entry->key;
+        delete[] entry->data;
+        delete entry;
+        entry = next;
+    }
+    _cache_head = nullptr;
+    _cache_size = 0;
+}
+
+#endif // SECURESTORE_READ_CACHE
+
+#if SECURESTORE_KEY_CACHE
+
+bool SecureStore::key_cache_lookup(const char *salt, uint8_t *derived_key)
+{
+    key_cache_entry_t *entries = static_cast<key_cache_entry_t *>(_key_cache);
+
+    if (!entries) {
+        return false;
+    }
+
+    for (int i = 0; i < SECURESTORE_KEY_CACHE_SIZE; i++) {
+        // Full salt string match - anything weaker could silently hand out
+        // the key of a different record
+        if (entries[i].salt && !strcmp(entries[i].salt, salt)) {
+            memcpy(derived_key, entries[i].key, derived_key_size);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void SecureStore::key_cache_insert(const char *salt, const uint8_t *derived_key)
+{
+    key_cache_entry_t *entries = static_cast<key_cache_entry_t *>(_key_cache);
+
+    if (!entries) {
+        entries = new key_cache_entry_t[SECURESTORE_KEY_CACHE_SIZE]();
+        _key_cache = entries;
+    }
+
+    key_cache_entry_t &entry = entries[_key_cache_victim];
+    char *salt_copy = new char[strlen(salt) + 1];
+    strcpy(salt_copy, salt);
+    delete[] entry.salt;
+    entry.salt = salt_copy;
+    memcpy(entry.key, derived_key, derived_key_size);
+    _key_cache_victim = (_key_cache_victim + 1) % SECURESTORE_KEY_CACHE_SIZE;
+}
+
+void SecureStore::key_cache_clear()
+{
+    key_cache_entry_t *entries = static_cast<key_cache_entry_t *>(_key_cache);
+
+    if (!entries) {
+        return;
+    }
+
+    for (int i = 0; i < SECURESTORE_KEY_CACHE_SIZE; i++) {
+        delete[] entries[i].salt;
+    }
+    mbedtls_platform_zeroize(entries, SECURESTORE_KEY_CACHE_SIZE * sizeof(key_cache_entry_t));
+    delete[] entries;
+    _key_cache = nullptr;
+    _key_cache_victim = 0;
+}
+
+#endif // SECURESTORE_KEY_CACHE
+
+int SecureStore::derive_record_key(const char *prefix, const char *key, uint8_t *derived_key)
+{
+    char *salt = reinterpret_cast<char *>(_scratch_buf);
+    strcpy(salt, prefix);
+    int pos = strlen(prefix);
+    strncpy(salt + pos, key, scratch_buf_size - pos - 1);
+    salt[scratch_buf_size - 1] = 0;
+
+#if SECURESTORE_KEY_CACHE
+    if (key_cache_lookup(salt, derived_key)) {
+        return 0;
+    }
+#endif
+
+    int os_ret = DeviceKey::get_instance().generate_derived_key(_scratch_buf, strlen(salt),
+                                                                derived_key, DEVICE_KEY_16BYTE);
+    if (os_ret) {
+        return os_ret;
+    }
+
+#if SECURESTORE_KEY_CACHE
+    key_cache_insert(salt, derived_key);
+#endif
+    return 0;
+}
+
 int SecureStore::get(const char *key, void *buffer, size_t buffer_size, size_t *actual_size,
                      size_t offset)
 {
     _mutex.lock();
+#if SECURESTORE_READ_CACHE
+    if (cache_lookup(key, buffer, buffer_size, actual_size, offset, 0)) {
+        _mutex.unlock();
+        return MBED_SUCCESS;
+    }
+
+    info_t info;
+    int ret = do_get(key, buffer, buffer_size, actual_size, offset, &info);
+    // Cache the value when the read covered all of it
+    if ((ret == MBED_SUCCESS) && buffer && (offset == 0) && (info.size <= buffer_size)) {
+        cache_insert(key, buffer, info.size, info.flags);
+    }
+#else
     int ret = do_get(key, buffer, buffer_size, actual_size, offset);
+#endif
     _mutex.unlock();
 
     return ret;
@@ -731,6 +1038,12 @@ int SecureStore::get(const char *key, void *buffer, size_t buffer_size, size_t *
 int SecureStore::get_info(const char *key, info_t *info)
 {
     _mutex.lock();
+#if SECURESTORE_READ_CACHE
+    if (cache_lookup(key, 0, 0, 0, 0, info)) {
+        _mutex.unlock();
+        return MBED_SUCCESS;
+    }
+#endif
     int ret = do_get(key, 0, 0, 0, 0, info);
     _mutex.unlock();
 
@@ -785,6 +1098,12 @@ int SecureStore::deinit()
     _mutex.lock();
     int ret;
     if (_is_initialized) {
+#if SECURESTORE_READ_CACHE
+        cache_clear();
+#endif
+#if SECURESTORE_KEY_CACHE
+        key_cache_clear();
+#endif
         if (_entropy) {
             mbedtls_entropy_free(_entropy);
             delete _entropy;
@@ -825,6 +1144,11 @@ int SecureStore::reset()
     }
 
     _mutex.lock();
+
+#if SECURESTORE_READ_CACHE
+    cache_clear();
+#endif
+
     ret = _underlying_kv->reset();
     if (ret) {
         goto end;
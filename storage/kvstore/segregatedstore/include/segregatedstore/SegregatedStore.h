@@ -0,0 +1,303 @@
+/*
+ * Copyright (c) 2026 ARM Limited. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MBED_SEGREGATEDSTORE_H
+#define MBED_SEGREGATEDSTORE_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include "KVStore.h"
+#include "PlatformMutex.h"
+
+// Number of updates observed for a key before it is moved to the hot store.
+#ifndef MBED_CONF_STORAGE_SEGREGATED_PROMOTE_THRESHOLD
+#define MBED_CONF_STORAGE_SEGREGATED_PROMOTE_THRESHOLD 3
+#endif
+
+// Number of keys whose update counts are tracked in RAM. When the table is
+// full, the least updated entry is replaced.
+#ifndef MBED_CONF_STORAGE_SEGREGATED_TRACKED_KEYS
+#define MBED_CONF_STORAGE_SEGREGATED_TRACKED_KEYS 32
+#endif
+
+namespace mbed {
+
+/** SegregatedStore class
+ *
+ *  KVStore that segregates keys by observed update frequency across two
+ *  underlying KVStores: a cold store for data written rarely (certificates,
+ *  provisioning data) and a hot store for data updated often (counters,
+ *  state). Garbage collection and erase wear stay confined to the store a
+ *  key actually lives in, so churn on a few counters no longer forces the
+ *  cold bulk of the data through erase cycles, and the hot store's
+ *  compactions copy only the small hot working set.
+ *
+ *  Placement is learned at runtime: new keys and keys set with
+ *  WRITE_ONCE_FLAG go to the cold store; a key whose updates cross the
+ *  promote threshold is moved to the hot store and stays there until it is
+ *  removed. Update counts are kept in RAM only - after a reboot a key
+ *  remains in whichever store it was last placed in, and a cold key must
+ *  show churn again to be promoted.
+ */
+
+class SegregatedStore : public KVStore {
+public:
+
+    /**
+     * @brief Class constructor
+     *
+     * @param[in]  cold_kv              KVStore holding rarely written keys.
+     * @param[in]  hot_kv               KVStore holding frequently updated keys.
+     *
+     * @returns none
+     */
+    SegregatedStore(KVStore *cold_kv, KVStore *hot_kv);
+
+    /**
+     * @brief Class destructor
+     *
+     * @returns none
+     */
+    virtual ~SegregatedStore();
+
+    /**
+     * @brief Initialize SegregatedStore class. It will also initialize
+     *        both underlying KVStores.
+     *
+     * @returns MBED_SUCCESS                        Success.
+     *          or any other error from underlying KVStore instances.
+     */
+    virtual int init();
+
+    /**
+     * @brief Deinitialize SegregatedStore class, free handles and memory allocations.
+     *
+     * @returns MBED_SUCCESS                        Success.
+     *          or any other error from underlying KVStore instances.
+     */
+    virtual int deinit();
+
+    /**
+     * @brief Reset KVStore contents (clear all keys in both underlying stores)
+     *
+     * @returns MBED_SUCCESS                        Success.
+     *          MBED_ERROR_NOT_READY                Not initialized.
+     *          or any other error from underlying KVStore instances.
+     */
+    virtual int reset();
+
+    /**
+     * @brief Set one KVStore item, given key and value.
+     *        The key is placed in the cold or hot underlying store according
+     *        to its observed update frequency.
+     *
+     * @param[in]  key                  Key - must not include '*' '/' '?' ':' ';' '\' '"' '|' ' ' '<' '>' '\'.
+     * @param[in]  buffer               Value data buffer.
+     * @param[in]  size                 Value data size.
+     * @param[in]  create_flags         Flag mask.
+     *
+     * @returns MBED_SUCCESS                        Success.
+     *          MBED_ERROR_NOT_READY                Not initialized.
+     *          MBED_ERROR_INVALID_ARGUMENT         Invalid argument given in function arguments.
+     *          MBED_ERROR_WRITE_PROTECTED          Already stored with "write once" flag.
+     *          or any other error from underlying KVStore instances.
+     */
+    virtual int set(const char *key, const void *buffer, size_t size, uint32_t create_flags);
+
+    /**
+     * @brief Get one KVStore item, given key.
+     *
+     * @param[in]  key                  Key - must not include '*' '/' '?' ':' ';' '\' '"' '|' ' ' '<' '>' '\'.
+     * @param[in]  buffer               Value data buffer.
+     * @param[in]  buffer_size          Value data buffer size.
+     * @param[out] actual_size          Actual read size.
+     * @param[in]  offset               Offset to read from in data.
+     *
+     * @returns MBED_SUCCESS                        Success.
+     *          MBED_ERROR_NOT_READY                Not initialized.
+     *          MBED_ERROR_INVALID_ARGUMENT         Invalid argument given in function arguments.
+     *          MBED_ERROR_ITEM_NOT_FOUND           No such key.
+     *          or any other error from underlying KVStore instances.
+     */
+    virtual int get(const char *key, void *buffer, size_t buffer_size, size_t *actual_size = NULL,
+                    size_t offset = 0);
+
+    /**
+     * @brief Get information of a given key.
+     *
+     * @param[in]  key                  Key - must not include '*' '/' '?' ':' ';' '\' '"' '|' ' ' '<' '>' '\'.
+     * @param[out] info                 Returned information structure containing size and flags.
+     *
+     * @returns MBED_SUCCESS                        Success.
+     *          MBED_ERROR_NOT_READY                Not initialized.
+     *          MBED_ERROR_INVALID_ARGUMENT         Invalid argument given in function arguments.
+     *          MBED_ERROR_ITEM_NOT_FOUND           No such key.
+     *          or any other error from underlying KVStore instances.
+     */
+    virtual int get_info(const char *key, info_t *info);
+
+    /**
+     * @brief Remove a KVStore item, given key.
+     *
+     * @param[in]  key                  Key - must not include '*' '/' '?' ':' ';' '\' '"' '|' ' ' '<' '>' '\'.
+     *
+     * @returns MBED_SUCCESS                        Success.
+     *          MBED_ERROR_NOT_READY                Not initialized.
+     *          MBED_ERROR_INVALID_ARGUMENT         Invalid argument given in function arguments.
+     *          MBED_ERROR_ITEM_NOT_FOUND           No such key.
+     *          MBED_ERROR_WRITE_PROTECTED          Already stored with "write once" flag.
+     *          or any other error from underlying KVStore instances.
+     */
+    virtual int remove(const char *key);
+
+    /**
+     * @brief Start an incremental KVStore set sequence. The target store is
+     *        chosen here, with the same placement rules as set.
+     *
+     * @param[out] handle               Returned incremental set handle.
+     * @param[in]  key                  Key - must not include '*' '/' '?' ':' ';' '\' '"' '|' ' ' '<' '>' '\'.
+     * @param[in]  final_data_size      Final value data size.
+     * @param[in]  create_flags         Flag mask.
+     *
+     * @returns MBED_SUCCESS                        Success.
+     *          MBED_ERROR_NOT_READY                Not initialized.
+     *          MBED_ERROR_INVALID_ARGUMENT         Invalid argument given in function arguments.
+     *          MBED_ERROR_WRITE_PROTECTED          Already stored with "write once" flag.
+     *          or any other error from underlying KVStore instances.
+     */
+    virtual int set_start(set_handle_t *handle, const char *key, size_t final_data_size, uint32_t create_flags);
+
+    /**
+     * @brief Add data to incremental KVStore set sequence.
+     *
+     * @param[in]  handle               Incremental set handle.
+     * @param[in]  value_data           value data to add.
+     * @param[in]  data_size            value data size.
+     *
+     * @returns MBED_SUCCESS                        Success.
+     *          MBED_ERROR_NOT_READY                Not initialized.
+     *          MBED_ERROR_INVALID_ARGUMENT         Invalid argument given in function arguments.
+     *          or any other error from underlying KVStore instances.
+     */
+    virtual int set_add_data(set_handle_t handle, const void *value_data, size_t data_size);
+
+    /**
+     * @brief Finalize an incremental KVStore set sequence.
+     *
+     * @param[in]  handle               Incremental set handle.
+     *
+     * @returns MBED_SUCCESS                        Success.
+     *          MBED_ERROR_NOT_READY                Not initialized.
+     *          MBED_ERROR_INVALID_ARGUMENT         Invalid argument given in function arguments.
+     *          or any other error from underlying KVStore instances.
+     */
+    virtual int set_finalize(set_handle_t handle);
+
+    /**
+     * @brief Start an iteration over KVStore keys in both underlying stores.
+     *        Hot keys are returned first, then cold keys.
+     *
+     * @param[out] it                   Returned iterator handle.
+     * @param[in]  prefix               Key prefix (null for all keys).
+     *
+     * @returns MBED_SUCCESS                        Success.
+     *          MBED_ERROR_NOT_READY                Not initialized.
+     *          MBED_ERROR_INVALID_ARGUMENT         Invalid argument given in function arguments.
+     *          or any other error from underlying KVStore instances.
+     */
+    virtual int iterator_open(iterator_t *it, const char *prefix = NULL);
+
+    /**
+     * @brief Get next key in iteration.
+     *
+     * @param[in]  it                   Iterator handle.
+     * @param[in]  key                  Buffer for returned key.
+     * @param[in]  key_size             Key buffer size.
+     *
+     * @returns MBED_SUCCESS                        Success.
+     *          MBED_ERROR_NOT_READY                Not initialized.
+     *          MBED_ERROR_INVALID_ARGUMENT         Invalid argument given in function arguments.
+     *          MBED_ERROR_ITEM_NOT_FOUND           No more keys.
+     *          or any other error from underlying KVStore instances.
+     */
+    virtual int iterator_next(iterator_t it, char *key, size_t key_size);
+
+    /**
+     * @brief Close iteration.
+     *
+     * @param[in]  it                   Iterator handle.
+     *
+     * @returns MBED_SUCCESS                        Success.
+     *          MBED_ERROR_NOT_READY                Not initialized.
+     *          MBED_ERROR_INVALID_ARGUMENT         Invalid argument given in function arguments.
+     *          or any other error from underlying KVStore instances.
+     */
+    virtual int iterator_close(iterator_t it);
+
+#if !defined(DOXYGEN_ONLY)
+private:
+    // Update count tracking entry - key names are not kept, only hashes
+    typedef struct {
+        uint32_t hash;
+        uint16_t count;
+    } key_stats_t;
+
+    // Forward declaration
+    struct inc_set_handle_t;
+
+    PlatformMutex _mutex;
+    bool _is_initialized;
+    KVStore *_cold_kv, *_hot_kv;
+    key_stats_t *_stats;
+    inc_set_handle_t *_ih;
+
+    /**
+     * @brief Record an update of a key and return its count so far.
+     *
+     * @param[in]  key                  Key.
+     *
+     * @returns the number of updates observed for the key
+     */
+    uint16_t stats_bump(const char *key);
+
+    /**
+     * @brief Drop the update count of a removed key.
+     *
+     * @param[in]  key                  Key.
+     *
+     * @returns none
+     */
+    void stats_forget(const char *key);
+
+    /**
+     * @brief Choose the underlying store for a write of the given key.
+     *
+     * @param[in]  key                  Key.
+     * @param[in]  create_flags         Flag mask of the write.
+     * @param[out] kv                   Chosen underlying store.
+     * @param[out] remove_cold          True if the cold copy must be removed
+     *                                  once the write succeeds (promotion).
+     *
+     * @returns 0 on success or a negative error code on failure
+     */
+    int route_set(const char *key, uint32_t create_flags, KVStore **kv, bool *remove_cold);
+#endif
+};
+/** @}*/
+
+} // namespace mbed
+
+#endif
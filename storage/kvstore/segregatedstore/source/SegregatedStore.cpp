@@ -0,0 +1,507 @@
+/*
+ * Copyright (c) 2026 ARM Limited. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// ----------------------------------------------------------- Includes -----------------------------------------------------------
+
+#include "segregatedstore/SegregatedStore.h"
+
+#include <string.h>
+#include <stdio.h>
+#include "mbed_error.h"
+#include "mbed_assert.h"
+#include "MbedCRC.h"
+
+using namespace mbed;
+
+// --------------------------------------------------------- Definitions ----------------------------------------------------------
+
+namespace {
+
+static const uint32_t initial_crc = 0xFFFFFFFF;
+
+} // anonymous namespace
+
+// incremental set handle
+struct SegregatedStore::inc_set_handle_t {
+    KVStore *kv;
+    KVStore::set_handle_t underlying_handle;
+    bool remove_cold;
+    char key[KVStore::MAX_KEY_SIZE + 1];
+};
+
+// iterator handle
+typedef struct {
+    KVStore::iterator_t underlying_it;
+    bool on_hot;
+    char *prefix;
+} key_iterator_handle_t;
+
+// -------------------------------------------------- Functions Implementation ----------------------------------------------------
+
+static uint32_t calc_key_hash(const char *key)
+{
+    uint32_t crc;
+    MbedCRC<POLY_32BIT_ANSI, 32> ct(initial_crc, 0x0, true, false);
+    ct.compute(key, strlen(key), &crc);
+    return crc;
+}
+
+// Class member functions
+
+SegregatedStore::SegregatedStore(KVStore *cold_kv, KVStore *hot_kv) :
+    _is_initialized(false), _cold_kv(cold_kv), _hot_kv(hot_kv), _stats(0), _ih(0)
+{
+}
+
+SegregatedStore::~SegregatedStore()
+{
+    deinit();
+}
+
+uint16_t SegregatedStore::stats_bump(const char *key)
+{
+    uint32_t hash = calc_key_hash(key);
+    int victim = 0;
+
+    for (int i = 0; i < MBED_CONF_STORAGE_SEGREGATED_TRACKED_KEYS; i++) {
+        if (_stats[i].count && (_stats[i].hash == hash)) {
+            if (_stats[i].count < UINT16_MAX) {
+                _stats[i].count++;
+            }
+            return _stats[i].count;
+        }
+        if (_stats[i].count < _stats[victim].count) {
+            victim = i;
+        }
+    }
+
+    // Not tracked yet - take an empty slot, or recycle the least updated
+    // entry. An evicted key loses its history and starts counting again.
+    _stats[victim].hash = hash;
+    _stats[victim].count = 1;
+    return 1;
+}
+
+void SegregatedStore::stats_forget(const char *key)
+{
+    uint32_t hash = calc_key_hash(key);
+
+    for (int i = 0; i < MBED_CONF_STORAGE_SEGREGATED_TRACKED_KEYS; i++) {
+        if (_stats[i].count && (_stats[i].hash == hash)) {
+            _stats[i].count = 0;
+            return;
+        }
+    }
+}
+
+int SegregatedStore::route_set(const char *key, uint32_t create_flags, KVStore **kv, bool *remove_cold)
+{
+    info_t info;
+    int ret;
+
+    *remove_cold = false;
+
+    // Write once data is cold by definition and must stay in one place for
+    // the flag to be enforced by the store holding it
+    if (create_flags & WRITE_ONCE_FLAG) {
+        *kv = _cold_kv;
+        return MBED_SUCCESS;
+    }
+
+    // A key already promoted stays hot
+    ret = _hot_kv->get_info(key, &info);
+    if (ret == MBED_SUCCESS) {
+        *kv = _hot_kv;
+        return MBED_SUCCESS;
+    }
+    if (ret != MBED_ERROR_ITEM_NOT_FOUND) {
+        return ret;
+    }
+
+    if (stats_bump(key) < MBED_CONF_STORAGE_SEGREGATED_PROMOTE_THRESHOLD) {
+        *kv = _cold_kv;
+        return MBED_SUCCESS;
+    }
+
+    // Promotion - unless the cold copy is write once protected, in which
+    // case route to the cold store so the update is properly refused
+    ret = _cold_kv->get_info(key, &info);
+    if ((ret == MBED_SUCCESS) && (info.flags & WRITE_ONCE_FLAG)) {
+        *kv = _cold_kv;
+        return MBED_SUCCESS;
+    }
+    if ((ret != MBED_SUCCESS) && (ret != MBED_ERROR_ITEM_NOT_FOUND)) {
+        return ret;
+    }
+
+    // Write the hot copy first and remove the cold one only after it
+    // succeeds, so an interrupted promotion leaves the key readable (the
+    // hot copy, when present, always wins on reads)
+    *kv = _hot_kv;
+    *remove_cold = (ret == MBED_SUCCESS);
+    return MBED_SUCCESS;
+}
+
+int SegregatedStore::set(const char *key, const void *buffer, size_t size, uint32_t create_flags)
+{
+    KVStore *kv;
+    bool remove_cold;
+    int ret;
+
+    if (!_is_initialized) {
+        return MBED_ERROR_NOT_READY;
+    }
+
+    if (!is_valid_key(key)) {
+        return MBED_ERROR_INVALID_ARGUMENT;
+    }
+
+    _mutex.lock();
+
+    ret = route_set(key, create_flags, &kv, &remove_cold);
+    if (ret) {
+        goto end;
+    }
+
+    ret = kv->set(key, buffer, size, create_flags);
+    if (ret) {
+        goto end;
+    }
+
+    if (remove_cold) {
+        int remove_ret = _cold_kv->remove(key);
+        if ((remove_ret != MBED_SUCCESS) && (remove_ret != MBED_ERROR_ITEM_NOT_FOUND)) {
+            ret = remove_ret;
+        }
+    }
+
+end:
+    _mutex.unlock();
+    return ret;
+}
+
+int SegregatedStore::get(const char *key, void *buffer, size_t buffer_size, size_t *actual_size,
+                         size_t offset)
+{
+    int ret;
+
+    if (!_is_initialized) {
+        return MBED_ERROR_NOT_READY;
+    }
+
+    ret = _hot_kv->get(key, buffer, buffer_size, actual_size, offset);
+    if (ret == MBED_ERROR_ITEM_NOT_FOUND) {
+        ret = _cold_kv->get(key, buffer, buffer_size, actual_size, offset);
+    }
+    return ret;
+}
+
+int SegregatedStore::get_info(const char *key, info_t *info)
+{
+    int ret;
+
+    if (!_is_initialized) {
+        return MBED_ERROR_NOT_READY;
+    }
+
+    ret = _hot_kv->get_info(key, info);
+    if (ret == MBED_ERROR_ITEM_NOT_FOUND) {
+        ret = _cold_kv->get_info(key, info);
+    }
+    return ret;
+}
+
+int SegregatedStore::remove(const char *key)
+{
+    int hot_ret, cold_ret;
+
+    if (!_is_initialized) {
+        return MBED_ERROR_NOT_READY;
+    }
+
+    if (!is_valid_key(key)) {
+        return MBED_ERROR_INVALID_ARGUMENT;
+    }
+
+    _mutex.lock();
+
+    // Remove from both - an interrupted promotion may have left copies in
+    // the two stores
+    hot_ret = _hot_kv->remove(key);
+    cold_ret = _cold_kv->remove(key);
+    stats_forget(key);
+
+    _mutex.unlock();
+
+    if ((hot_ret != MBED_SUCCESS) && (hot_ret != MBED_ERROR_ITEM_NOT_FOUND)) {
+        return hot_ret;
+    }
+    if ((cold_ret != MBED_SUCCESS) && (cold_ret != MBED_ERROR_ITEM_NOT_FOUND)) {
+        return cold_ret;
+    }
+    if ((hot_ret == MBED_ERROR_ITEM_NOT_FOUND) && (cold_ret == MBED_ERROR_ITEM_NOT_FOUND)) {
+        return MBED_ERROR_ITEM_NOT_FOUND;
+    }
+    return MBED_SUCCESS;
+}
+
+int SegregatedStore::set_start(set_handle_t *handle, const char *key, size_t final_data_size,
+                               uint32_t create_flags)
+{
+    KVStore *kv;
+    bool remove_cold;
+    int ret;
+
+    if (!_is_initialized) {
+        return MBED_ERROR_NOT_READY;
+    }
+
+    if (!is_valid_key(key)) {
+        return MBED_ERROR_INVALID_ARGUMENT;
+    }
+
+    _mutex.lock();
+
+    ret = route_set(key, create_flags, &kv, &remove_cold);
+    if (ret) {
+        _mutex.unlock();
+        return ret;
+    }
+
+    ret = kv->set_start(&_ih->underlying_handle, key, final_data_size, create_flags);
+    if (ret) {
+        _mutex.unlock();
+        return ret;
+    }
+
+    _ih->kv = kv;
+    _ih->remove_cold = remove_cold;
+    strcpy(_ih->key, key);
+    *handle = reinterpret_cast<set_handle_t>(_ih);
+
+    // Mutex is held between set_start and set_finalize, as the underlying
+    // stores do for their own incremental set sequences
+    return ret;
+}
+
+int SegregatedStore::set_add_data(set_handle_t handle, const void *value_data, size_t data_size)
+{
+    if (handle != reinterpret_cast<set_handle_t>(_ih)) {
+        return MBED_ERROR_INVALID_ARGUMENT;
+    }
+
+    return _ih->kv->set_add_data(_ih->underlying_handle, value_data, data_size);
+}
+
+int SegregatedStore::set_finalize(set_handle_t handle)
+{
+    int ret;
+
+    if (handle != reinterpret_cast<set_handle_t>(_ih)) {
+        return MBED_ERROR_INVALID_ARGUMENT;
+    }
+
+    ret = _ih->kv->set_finalize(_ih->underlying_handle);
+
+    if ((ret == MBED_SUCCESS) && _ih->remove_cold) {
+        int remove_ret = _cold_kv->remove(_ih->key);
+        if ((remove_ret != MBED_SUCCESS) && (remove_ret != MBED_ERROR_ITEM_NOT_FOUND)) {
+            ret = remove_ret;
+        }
+    }
+
+    _mutex.unlock();
+    return ret;
+}
+
+int SegregatedStore::iterator_open(iterator_t *it, const char *prefix)
+{
+    key_iterator_handle_t *handle;
+    int ret;
+
+    if (!_is_initialized) {
+        return MBED_ERROR_NOT_READY;
+    }
+
+    if (!it) {
+        return MBED_ERROR_INVALID_ARGUMENT;
+    }
+
+    handle = new key_iterator_handle_t;
+    handle->on_hot = true;
+    if (prefix) {
+        handle->prefix = new char[strlen(prefix) + 1];
+        strcpy(handle->prefix, prefix);
+    } else {
+        handle->prefix = 0;
+    }
+
+    ret = _hot_kv->iterator_open(&handle->underlying_it, prefix);
+    if (ret) {
+        delete[] handle->prefix;
+        delete handle;
+        return ret;
+    }
+
+    *it = reinterpret_cast<iterator_t>(handle);
+    return ret;
+}
+
+int SegregatedStore::iterator_next(iterator_t it, char *key, size_t key_size)
+{
+    key_iterator_handle_t *handle = reinterpret_cast<key_iterator_handle_t *>(it);
+    info_t info;
+    int ret;
+
+    if (!_is_initialized) {
+        return MBED_ERROR_NOT_READY;
+    }
+
+    while (true) {
+        ret = (handle->on_hot ? _hot_kv : _cold_kv)->iterator_next(handle->underlying_it, key, key_size);
+
+        if ((ret == MBED_ERROR_ITEM_NOT_FOUND) && handle->on_hot) {
+            // Hot keys exhausted - move over to the cold store
+            (void) _hot_kv->iterator_close(handle->underlying_it);
+            handle->on_hot = false;
+            ret = _cold_kv->iterator_open(&handle->underlying_it, handle->prefix);
+            if (ret) {
+                return ret;
+            }
+            continue;
+        }
+
+        // Skip cold keys shadowed by a hot copy (left by an interrupted
+        // promotion), so each key is returned once
+        if ((ret == MBED_SUCCESS) && !handle->on_hot &&
+                (_hot_kv->get_info(key, &info) == MBED_SUCCESS)) {
+            continue;
+        }
+
+        return ret;
+    }
+}
+
+int SegregatedStore::iterator_close(iterator_t it)
+{
+    key_iterator_handle_t *handle = reinterpret_cast<key_iterator_handle_t *>(it);
+    int ret;
+
+    if (!_is_initialized) {
+        return MBED_ERROR_NOT_READY;
+    }
+
+    ret = (handle->on_hot ? _hot_kv : _cold_kv)->iterator_close(handle->underlying_it);
+    delete[] handle->prefix;
+    delete handle;
+    return ret;
+}
+
+int SegregatedStore::init()
+{
+    int ret = MBED_SUCCESS;
+
+    _mutex.lock();
+
+    if (_is_initialized) {
+        goto end;
+    }
+
+    if (!_cold_kv || !_hot_kv) {
+        ret = MBED_ERROR_INVALID_ARGUMENT;
+        goto end;
+    }
+
+    ret = _cold_kv->init();
+    if (ret) {
+        goto end;
+    }
+
+    ret = _hot_kv->init();
+    if (ret) {
+        goto end;
+    }
+
+    _stats = new key_stats_t[MBED_CONF_STORAGE_SEGREGATED_TRACKED_KEYS];
+    memset(_stats, 0, sizeof(key_stats_t) * MBED_CONF_STORAGE_SEGREGATED_TRACKED_KEYS);
+
+    _ih = new inc_set_handle_t;
+
+    _is_initialized = true;
+
+end:
+    _mutex.unlock();
+    return ret;
+}
+
+int SegregatedStore::deinit()
+{
+    int ret = MBED_SUCCESS;
+
+    _mutex.lock();
+
+    if (!_is_initialized) {
+        goto end;
+    }
+
+    ret = _hot_kv->deinit();
+    if (ret) {
+        goto end;
+    }
+
+    ret = _cold_kv->deinit();
+    if (ret) {
+        goto end;
+    }
+
+    delete[] _stats;
+    _stats = 0;
+    delete _ih;
+    _ih = 0;
+
+    _is_initialized = false;
+
+end:
+    _mutex.unlock();
+    return ret;
+}
+
+int SegregatedStore::reset()
+{
+    int ret;
+
+    if (!_is_initialized) {
+        return MBED_ERROR_NOT_READY;
+    }
+
+    _mutex.lock();
+
+    ret = _hot_kv->reset();
+    if (ret) {
+        goto end;
+    }
+
+    ret = _cold_kv->reset();
+    if (ret) {
+        goto end;
+    }
+
+    memset(_stats, 0, sizeof(key_stats_t) * MBED_CONF_STORAGE_SEGREGATED_TRACKED_KEYS);
+
+end:
+    _mutex.unlock();
+    return ret;
+}
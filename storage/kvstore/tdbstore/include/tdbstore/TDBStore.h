@@ -200,6 +200,57 @@ public:
      */
     virtual int set_finalize(set_handle_t handle);
 
+    /**
+     * @brief Start a batch of set operations. This operation is blocking other operations.
+     *        Any get/set/remove operation of another thread will be blocked until batch_commit
+     *        is called. Flushing of written records and their write verification are deferred
+     *        to batch_commit, so consecutive small records share flash program cycles.
+     *        The batch is atomic with respect to concurrent readers; on power loss before
+     *        batch_commit returns, a prefix of the batch may survive (the same guarantee the
+     *        equivalent sequence of set calls gives).
+     *
+     * @param[out] handle               Returned batch handle.
+     *
+     * @returns MBED_SUCCESS                        Success.
+     *          MBED_ERROR_NOT_READY                Not initialized.
+     *          MBED_ERROR_INVALID_ARGUMENT         Batch already in progress.
+     */
+    virtual int batch_start(batch_handle_t *handle);
+
+    /**
+     * @brief Set one TDBStore item as part of a batch.
+     *
+     * @param[in]  handle               Batch handle.
+     * @param[in]  key                  Key - must not include '*' '/' '?' ':' ';' '\' '"' '|' ' ' '<' '>' '\'.
+     * @param[in]  buffer               Value data buffer.
+     * @param[in]  size                 Value data size.
+     * @param[in]  create_flags         Flag mask.
+     *
+     * @returns MBED_SUCCESS                        Success.
+     *          MBED_ERROR_NOT_READY                Not initialized.
+     *          MBED_ERROR_READ_FAILED              Unable to read from media.
+     *          MBED_ERROR_WRITE_FAILED             Unable to write to media.
+     *          MBED_ERROR_INVALID_ARGUMENT         Invalid argument given in function arguments.
+     *          MBED_ERROR_INVALID_SIZE             Invalid size given in function arguments.
+     *          MBED_ERROR_MEDIA_FULL               Not enough room on media.
+     *          MBED_ERROR_WRITE_PROTECTED          Already stored with "write once" flag.
+     */
+    virtual int batch_set(batch_handle_t handle, const char *key, const void *buffer, size_t size,
+                          uint32_t create_flags);
+
+    /**
+     * @brief Commit a batch of set operations: flush all records written by the
+     *        batch in one sync and verify them.
+     *
+     * @param[in]  handle               Batch handle.
+     *
+     * @returns MBED_SUCCESS                        Success.
+     *          MBED_ERROR_WRITE_FAILED             Unable to write to media.
+     *          MBED_ERROR_INVALID_ARGUMENT         Invalid argument given in function arguments.
+     *          MBED_ERROR_INVALID_DATA_DETECTED    Data is corrupt.
+     */
+    virtual int batch_commit(batch_handle_t handle);
+
     /**
      * @brief Start an iteration over KVStore keys.
      *        There are no issues with any other operations while iterator is open.
@@ -277,6 +328,14 @@ public:
     virtual int reserved_data_get(void *reserved_data, size_t reserved_data_buf_size,
                                   size_t *actual_data_size = 0);
 
+    /**
+     * @brief Get RAM consumed by the internal hash index used to speed up
+     *        key lookups.
+     *
+     * @returns Index size in bytes.
+     */
+    size_t index_memory_size() const;
+
 #if !defined(DOXYGEN_ONLY)
 private:
 
@@ -309,6 +368,20 @@ private:
     char *_key_buf;
     void *_inc_set_handle;
     void *_iterator_table[_max_open_iterators];
+    void *_hash_index;
+    uint32_t _hash_index_capacity;
+    uint32_t _hash_index_used;
+    bool _batch_in_progress;
+    uint32_t _batch_verify_offset;
+#if TDBSTORE_BACKGROUND_GC
+    int _bg_gc_event_id;
+    bool _bg_gc_in_progress;
+    uint32_t _bg_gc_ind;
+    uint32_t _bg_gc_to_offset;
+    uint32_t _bg_gc_generation;
+    uint32_t _bg_gc_pass_generation;
+    uint32_t *_bg_gc_new_offsets;
+#endif
 
     /**
      * @brief Read a block from an area.
@@ -541,6 +614,70 @@ private:
      */
     void update_all_iterators(bool added, uint32_t ram_table_ind);
 
+    /**
+     * @brief Rebuild the hash index from the RAM table.
+     *        Also purges slots of deleted keys.
+     *
+     * @returns none
+     */
+    void index_rebuild();
+
+    /**
+     * @brief Add a key to the hash index (or update the record offset of an
+     *        existing one).
+     *
+     * @param[in]  hash                 Key hash.
+     * @param[in]  bd_offset            Record offset in active area.
+     *
+     * @returns none
+     */
+    void index_insert(uint32_t hash, bd_size_t bd_offset);
+
+    /**
+     * @brief Remove a key from the hash index.
+     *
+     * @param[in]  hash                 Key hash.
+     *
+     * @returns none
+     */
+    void index_remove(uint32_t hash);
+
+    /**
+     * @brief Look a key hash up in the hash index.
+     *
+     * @param[in]  hash                 Key hash.
+     *
+     * @returns Record offset in active area, 0 if hash is not in the index.
+     */
+    bd_size_t index_lookup(uint32_t hash) const;
+
+#if TDBSTORE_BACKGROUND_GC
+    /**
+     * @brief Schedule a background compaction step on the shared event queue,
+     *        if the active area fill has crossed the watermark and no step
+     *        is already pending.
+     *
+     * @returns none
+     */
+    void schedule_background_gc();
+
+    /**
+     * @brief Perform one bounded background compaction step (copy a limited
+     *        number of records to the standby area), rescheduling itself
+     *        until the pass completes.
+     *
+     * @returns none
+     */
+    void background_gc_step();
+
+    /**
+     * @brief Discard any background compaction pass in progress.
+     *
+     * @returns none
+     */
+    void abort_background_gc();
+#endif
+
 #endif
 
 };
@@ -27,12 +27,40 @@
 #include "MbedCRC.h"
 #include "FlashIAP.h"
 
+#if TDBSTORE_BACKGROUND_GC
+#include "events/mbed_shared_queues.h"
+
+// Fill percentage of the active area above which a background compaction
+// pass is scheduled, so that by the time the area is actually full, records
+// have already been compacted to the standby one and a foreground set()
+// doesn't have to do it synchronously.
+#ifndef TDBSTORE_BACKGROUND_GC_WATERMARK
+#define TDBSTORE_BACKGROUND_GC_WATERMARK 75
+#endif
+
+// Number of records copied per background compaction step. Each step is a
+// separate event on the shared queue, so other pending events (and foreground
+// storage operations, which contend on the same mutex) run between steps.
+#ifndef TDBSTORE_BACKGROUND_GC_RECORDS_PER_STEP
+#define TDBSTORE_BACKGROUND_GC_RECORDS_PER_STEP 4
+#endif
+#endif
+
+// Granularity of per-chunk integrity protection, in bytes. Values larger
+// than one chunk get a CRC per chunk stored after the data, so partial
+// reads verify only the chunks they touch instead of the whole record.
+// 0 keeps the single whole-record CRC.
+#ifndef TDBSTORE_CHUNK_CRC_SIZE
+#define TDBSTORE_CHUNK_CRC_SIZE 0
+#endif
+
 using namespace mbed;
 
 // --------------------------------------------------------- Definitions ----------------------------------------------------------
 
 static const uint32_t delete_flag = (1UL << 31);
-static const uint32_t internal_flags = delete_flag;
+static const uint32_t chunk_crc_flag = (1UL << 30);
+static const uint32_t internal_flags = delete_flag | chunk_crc_flag;
 // Only write once flag is supported, other two are kept in storage but ignored
 static const uint32_t supported_flags = KVStore::WRITE_ONCE_FLAG | KVStore::REQUIRE_CONFIDENTIALITY_FLAG | KVStore::REQUIRE_REPLAY_PROTECTION_FLAG;
 
@@ -81,6 +109,13 @@ static const size_t min_work_buf_size = 64;
 static const uint32_t initial_crc = 0xFFFFFFFF;
 static const uint32_t initial_max_keys = 16;
 
+// Hash index slot states, kept in the bd_offset field. No record can live at
+// these offsets - the reserved area and master record come first, and records
+// are aligned to program units.
+static const bd_size_t index_slot_empty = 0;
+static const bd_size_t index_slot_deleted = 1;
+static const uint32_t initial_index_capacity = 32;
+
 // incremental set handle
 typedef struct {
     record_header_t header;
@@ -90,6 +125,10 @@ typedef struct {
     uint32_t ram_table_ind;
     uint32_t hash;
     bool new_key;
+#if TDBSTORE_CHUNK_CRC_SIZE
+    uint32_t *chunk_table;
+    uint32_t chunk_crc;
+#endif
 } inc_set_handle_t;
 
 // iterator handle
@@ -125,12 +164,25 @@ static uint32_t calc_crc(uint32_t init_crc, uint32_t data_size, const void *data
     return crc;
 }
 
+// Size of the per-chunk CRC table stored after the data of a chunked record.
+// The chunk size used at write time is kept in the header (reserved field),
+// so records remain readable when the configured chunk size changes.
+static uint32_t chunk_table_size(const record_header_t &header)
+{
+    if (!(header.flags & chunk_crc_flag) || !header.reserved) {
+        return 0;
+    }
+    return sizeof(uint32_t) * ((header.data_size + header.reserved - 1) / header.reserved);
+}
+
 // Class member functions
 
 TDBStore::TDBStore(BlockDevice *bd) : _ram_table(0), _max_keys(0),
     _num_keys(0), _bd(bd), _buff_bd(0),  _free_space_offset(0), _master_record_offset(0),
     _master_record_size(0), _is_initialized(false), _active_area(0), _active_area_version(0), _size(0),
-    _area_params{}, _prog_size(0), _work_buf(0), _work_buf_size(0), _key_buf(0), _inc_set_handle(0)
+    _area_params{}, _prog_size(0), _work_buf(0), _work_buf_size(0), _key_buf(0), _inc_set_handle(0),
+    _hash_index(0), _hash_index_capacity(0), _hash_index_used(0),
+    _batch_in_progress(false), _batch_verify_offset(0)
 {
     for (int i = 0; i < _num_areas; i++) {
         _area_params[i] = { 0 };
@@ -138,6 +190,15 @@ TDBStore::TDBStore(BlockDevice *bd) : _ram_table(0), _max_keys(0),
     for (int i = 0; i < _max_open_iterators; i++) {
         _iterator_table[i] = { 0 };
     }
+#if TDBSTORE_BACKGROUND_GC
+    _bg_gc_event_id = 0;
+    _bg_gc_in_progress = false;
+    _bg_gc_ind = 0;
+    _bg_gc_to_offset = 0;
+    _bg_gc_generation = 0;
+    _bg_gc_pass_generation = 0;
+    _bg_gc_new_offsets = nullptr;
+#endif
 }
 
 TDBStore::~TDBStore()
@@ -254,10 +315,15 @@ int TDBStore::read_record(uint8_t area, uint32_t offset, char *key,
 {
     int ret;
     record_header_t header;
-    uint32_t total_size, key_size, data_size;
+    uint32_t total_size, key_size, data_size, table_size;
     uint32_t curr_data_offset;
     char *user_key_ptr;
     uint32_t crc = initial_crc;
+#if TDBSTORE_CHUNK_CRC_SIZE
+    uint32_t chunk_crc = initial_crc;
+    uint32_t chunk_ind = 0, chunk_fill = 0;
+    uint32_t table_bd_offset = 0;
+#endif
     // Upper layers typically use non zero offsets for reading the records chunk by chunk,
     // so only validate entire record at first chunk (otherwise we'll have a serious performance penalty).
     bool validate = (data_offset == 0);
@@ -285,6 +351,12 @@ int TDBStore::read_record(uint8_t area, uint32_t offset, char *key,
         return MBED_ERROR_INVALID_DATA_DETECTED;
     }
 
+    // Chunked records carry the chunk size they were written with
+    if ((header.flags & chunk_crc_flag) && !header.reserved) {
+        return MBED_ERROR_INVALID_DATA_DETECTED;
+    }
+    table_size = chunk_table_size(header);
+
     total_size = key_size + data_size;
 
     // Make sure our read sizes didn't cause any wraparounds
@@ -292,7 +364,7 @@ int TDBStore::read_record(uint8_t area, uint32_t offset, char *key,
         return MBED_ERROR_INVALID_DATA_DETECTED;
     }
 
-    if (offset + total_size >= _size) {
+    if (offset + total_size + table_size >= _size) {
         return MBED_ERROR_INVALID_DATA_DETECTED;
     }
 
@@ -306,10 +378,90 @@ int TDBStore::read_record(uint8_t area, uint32_t offset, char *key,
         return MBED_ERROR_INVALID_ARGUMENT;
     }
 
+#if TDBSTORE_CHUNK_CRC_SIZE
+    if ((header.flags & chunk_crc_flag) && copy_data && actual_data_size &&
+            ((data_offset != 0) || (actual_data_size != data_size))) {
+        // Partial read of a chunked record: verify the chunks the requested
+        // range touches against their stored CRCs, instead of reading the
+        // whole record for the sake of its single CRC
+        uint32_t data_bd_offset = offset + key_size;
+        table_bd_offset = data_bd_offset + data_size;
+
+        if (check_expected_key) {
+            user_key_ptr = key;
+            uint32_t key_left = key_size;
+            uint32_t key_bd_offset = offset;
+            while (key_left) {
+                uint32_t key_chunk = std::min<size_t>(key_left, _work_buf_size);
+                ret = read_area(area, key_bd_offset, key_chunk, _work_buf);
+                if (ret) {
+                    return ret;
+                }
+                if (memcmp(user_key_ptr, _work_buf, key_chunk)) {
+                    return MBED_ERROR_ITEM_NOT_FOUND;
+                }
+                user_key_ptr += key_chunk;
+                key_bd_offset += key_chunk;
+                key_left -= key_chunk;
+            }
+        }
+
+        chunk_ind = data_offset / header.reserved;
+        uint32_t last_chunk = (data_offset + actual_data_size - 1) / header.reserved;
+
+        while (chunk_ind <= last_chunk) {
+            uint32_t chunk_start = chunk_ind * header.reserved;
+            uint32_t chunk_end = std::min<uint32_t>(chunk_start + header.reserved, data_size);
+            uint32_t pos = chunk_start;
+            chunk_crc = initial_crc;
+
+            // Parts of the chunk outside the requested range go through the
+            // work buffer, the requested part lands in the user buffer
+            while (pos < chunk_end) {
+                uint8_t *dest_buf;
+                uint32_t len;
+                if (pos < data_offset) {
+                    len = std::min<size_t>(data_offset - pos, _work_buf_size);
+                    dest_buf = _work_buf;
+                } else if (pos < data_offset + actual_data_size) {
+                    len = data_offset + actual_data_size - pos;
+                    dest_buf = static_cast<uint8_t *>(data_buf) + (pos - data_offset);
+                } else {
+                    len = std::min<size_t>(chunk_end - pos, _work_buf_size);
+                    dest_buf = _work_buf;
+                }
+                len = std::min(len, chunk_end - pos);
+                ret = read_area(area, data_bd_offset + pos, len, dest_buf);
+                if (ret) {
+                    return ret;
+                }
+                chunk_crc = calc_crc(chunk_crc, len, dest_buf);
+                pos += len;
+            }
+
+            uint32_t stored_crc;
+            ret = read_area(area, table_bd_offset + chunk_ind * sizeof(uint32_t),
+                            sizeof(uint32_t), &stored_crc);
+            if (ret) {
+                return ret;
+            }
+            if (stored_crc != chunk_crc) {
+                return MBED_ERROR_INVALID_DATA_DETECTED;
+            }
+            chunk_ind++;
+        }
+
+        return MBED_SUCCESS;
+    }
+#endif
+
     if (validate) {
         // Calculate CRC on header (excluding CRC itself)
         crc = calc_crc(crc, sizeof(record_header_t) - sizeof(crc), &header);
         curr_data_offset = 0;
+#if TDBSTORE_CHUNK_CRC_SIZE
+        table_bd_offset = offset + key_size + data_size;
+#endif
     } else {
         // Non validation case: No need to read the key, nor the parts before data_offset
         // or after the actual part requested by the user.
@@ -382,6 +534,38 @@ int TDBStore::read_record(uint8_t area, uint32_t offset, char *key,
                 offset += data_offset;
             }
         } else {
+#if TDBSTORE_CHUNK_CRC_SIZE
+            // Full validation of a chunked record also checks the stored
+            // per-chunk CRCs, so a corrupt table is caught here (at the init
+            // scan and the post-write verification) rather than failing
+            // partial reads later
+            if (validate && table_size) {
+                const uint8_t *chunk_src = dest_buf;
+                uint32_t chunk_left = chunk_size;
+                while (chunk_left) {
+                    uint32_t take = std::min<uint32_t>(chunk_left, header.reserved - chunk_fill);
+                    chunk_crc = calc_crc(chunk_crc, take, chunk_src);
+                    chunk_src += take;
+                    chunk_left -= take;
+                    chunk_fill += take;
+                    if (chunk_fill == header.reserved) {
+                        uint32_t stored_crc;
+                        ret = read_area(area, table_bd_offset + chunk_ind * sizeof(uint32_t),
+                                        sizeof(uint32_t), &stored_crc);
+                        if (ret) {
+                            goto end;
+                        }
+                        if (stored_crc != chunk_crc) {
+                            ret = MBED_ERROR_INVALID_DATA_DETECTED;
+                            goto end;
+                        }
+                        chunk_ind++;
+                        chunk_fill = 0;
+                        chunk_crc = initial_crc;
+                    }
+                }
+            }
+#endif
             curr_data_offset += chunk_size;
         }
 
@@ -389,12 +573,30 @@ int TDBStore::read_record(uint8_t area, uint32_t offset, char *key,
         offset += chunk_size;
     }
 
+#if TDBSTORE_CHUNK_CRC_SIZE
+    // Last chunk of a chunked record may be partial
+    if (validate && table_size && chunk_fill) {
+        uint32_t stored_crc;
+        ret = read_area(area, table_bd_offset + chunk_ind * sizeof(uint32_t),
+                        sizeof(uint32_t), &stored_crc);
+        if (ret) {
+            goto end;
+        }
+        if (stored_crc != chunk_crc) {
+            ret = MBED_ERROR_INVALID_DATA_DETECTED;
+            goto end;
+        }
+    }
+#endif
+
     if (validate && (crc != header.crc)) {
         ret = MBED_ERROR_INVALID_DATA_DETECTED;
         goto end;
     }
 
-    next_offset = align_up(offset, _prog_size);
+    // In the full validation case, skip the per-chunk CRC table to the true
+    // record end
+    next_offset = align_up(offset + (validate ? table_size : 0), _prog_size);
 
 end:
     return ret;
@@ -412,12 +614,21 @@ int TDBStore::find_record(uint8_t area, const char *key, uint32_t &offset,
 
     hash = calc_crc(initial_crc, strlen(key), key);
 
-    for (ram_table_ind = 0; ram_table_ind < _num_keys; ram_table_ind++) {
+    // RAM table is sorted by hash in descending order - binary search for
+    // the first entry whose hash is not greater than ours
+    uint32_t lo = 0, hi = _num_keys;
+    while (lo < hi) {
+        uint32_t mid = (lo + hi) / 2;
+        if (ram_table[mid].hash > hash) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    for (ram_table_ind = lo; ram_table_ind < _num_keys; ram_table_ind++) {
         entry = &ram_table[ram_table_ind];
         offset = entry->bd_offset;
-        if (hash < entry->hash)  {
-            continue;
-        }
         if (hash > entry->hash)  {
             return MBED_ERROR_ITEM_NOT_FOUND;
         }
@@ -432,10 +643,120 @@ int TDBStore::find_record(uint8_t area, const char *key, uint32_t &offset,
     return ret;
 }
 
+void TDBStore::index_rebuild()
+{
+    ram_table_entry_t *ram_table = (ram_table_entry_t *) _ram_table;
+    ram_table_entry_t *index;
+    uint32_t capacity = initial_index_capacity;
+
+    // Size for a load factor of at most 50%, so probe chains stay short
+    while (capacity < 2 * _num_keys) {
+        capacity *= 2;
+    }
+
+    index = new ram_table_entry_t[capacity];
+    for (uint32_t i = 0; i < capacity; i++) {
+        index[i].hash = 0;
+        index[i].bd_offset = index_slot_empty;
+    }
+
+    delete[] reinterpret_cast<ram_table_entry_t *>(_hash_index);
+    _hash_index = index;
+    _hash_index_capacity = capacity;
+    _hash_index_used = 0;
+
+    for (size_t ind = 0; ind < _num_keys; ind++) {
+        index_insert(ram_table[ind].hash, ram_table[ind].bd_offset);
+    }
+}
+
+void TDBStore::index_insert(uint32_t hash, bd_size_t bd_offset)
+{
+    // Rebuild on first use, or when the load factor (deleted slots included)
+    // would exceed 75%. A rebuild purges deleted slots and leaves the load
+    // at no more than 50%, so this cannot recurse.
+    if (!_hash_index || (4 * (_hash_index_used + 1) > 3 * _hash_index_capacity)) {
+        index_rebuild();
+    }
+
+    ram_table_entry_t *index = (ram_table_entry_t *) _hash_index;
+    uint32_t mask = _hash_index_capacity - 1;
+    uint32_t free_slot = (uint32_t) -1;
+    uint32_t i;
+
+    // Probe until an empty slot proves the hash is not present - a deleted
+    // slot may hide a later entry with our hash, so only remember it
+    for (i = hash & mask; index[i].bd_offset != index_slot_empty; i = (i + 1) & mask) {
+        if (index[i].bd_offset == index_slot_deleted) {
+            if (free_slot == (uint32_t) -1) {
+                free_slot = i;
+            }
+        } else if (index[i].hash == hash) {
+            index[i].bd_offset = bd_offset;
+            return;
+        }
+    }
+
+    if (free_slot != (uint32_t) -1) {
+        // Reusing a deleted slot doesn't change the load
+        i = free_slot;
+    } else {
+        _hash_index_used++;
+    }
+    index[i].hash = hash;
+    index[i].bd_offset = bd_offset;
+}
+
+void TDBStore::index_remove(uint32_t hash)
+{
+    if (!_hash_index) {
+        return;
+    }
+
+    ram_table_entry_t *index = (ram_table_entry_t *) _hash_index;
+    uint32_t mask = _hash_index_capacity - 1;
+
+    for (uint32_t i = hash & mask; index[i].bd_offset != index_slot_empty; i = (i + 1) & mask) {
+        if ((index[i].bd_offset != index_slot_deleted) && (index[i].hash == hash)) {
+            index[i].bd_offset = index_slot_deleted;
+            return;
+        }
+    }
+}
+
+bd_size_t TDBStore::index_lookup(uint32_t hash) const
+{
+    if (!_hash_index) {
+        return 0;
+    }
+
+    ram_table_entry_t *index = (ram_table_entry_t *) _hash_index;
+    uint32_t mask = _hash_index_capacity - 1;
+
+    for (uint32_t i = hash & mask; index[i].bd_offset != index_slot_empty; i = (i + 1) & mask) {
+        if ((index[i].bd_offset != index_slot_deleted) && (index[i].hash == hash)) {
+            return index[i].bd_offset;
+        }
+    }
+    return 0;
+}
+
+size_t TDBStore::index_memory_size() const
+{
+    return _hash_index_capacity * sizeof(ram_table_entry_t);
+}
+
 uint32_t TDBStore::record_size(const char *key, uint32_t data_size)
 {
+    uint32_t payload_size = strlen(key) + data_size;
+#if TDBSTORE_CHUNK_CRC_SIZE
+    if (data_size > TDBSTORE_CHUNK_CRC_SIZE) {
+        payload_size += sizeof(uint32_t) *
+                        ((data_size + TDBSTORE_CHUNK_CRC_SIZE - 1) / TDBSTORE_CHUNK_CRC_SIZE);
+    }
+#endif
     return align_up(sizeof(record_header_t), _prog_size) +
-           align_up(strlen(key) + data_size, _prog_size);
+           align_up(payload_size, _prog_size);
 }
 
 
@@ -456,6 +777,9 @@ int TDBStore::set_start(set_handle_t *handle, const char *key, size_t final_data
         return MBED_ERROR_INVALID_ARGUMENT;
     }
 
+    // Chunking is decided here per record, never by the caller
+    create_flags &= ~chunk_crc_flag;
+
     *handle = reinterpret_cast<set_handle_t>(_inc_set_handle);
     ih = reinterpret_cast<inc_set_handle_t *>(*handle);
 
@@ -537,6 +861,20 @@ int TDBStore::set_start(set_handle_t *handle, const char *key, size_t final_data
     ih->header.key_size = strlen(key);
     ih->header.reserved = 0;
     ih->header.data_size = final_data_size;
+#if TDBSTORE_CHUNK_CRC_SIZE
+    // Values larger than one chunk get a per-chunk CRC table after the data,
+    // letting partial reads verify only the chunks they touch. A previous
+    // aborted sequence may have left a stale table behind.
+    delete[] ih->chunk_table;
+    ih->chunk_table = nullptr;
+    ih->chunk_crc = initial_crc;
+    if (final_data_size > TDBSTORE_CHUNK_CRC_SIZE) {
+        ih->header.flags |= chunk_crc_flag;
+        ih->header.reserved = TDBSTORE_CHUNK_CRC_SIZE;
+        ih->chunk_table = new uint32_t[(final_data_size + TDBSTORE_CHUNK_CRC_SIZE - 1) /
+                                                        TDBSTORE_CHUNK_CRC_SIZE];
+    }
+#endif
     // Calculate CRC on header and key
     ih->header.crc = calc_crc(initial_crc, sizeof(record_header_t) - sizeof(ih->header.crc), &ih->header);
     ih->header.crc = calc_crc(ih->header.crc, ih->header.key_size, key);
@@ -594,6 +932,28 @@ int TDBStore::set_add_data(set_handle_t handle, const void *value_data, size_t d
     // Update CRC with data chunk
     ih->header.crc = calc_crc(ih->header.crc, data_size, value_data);
 
+#if TDBSTORE_CHUNK_CRC_SIZE
+    // Accumulate the per-chunk CRCs as the data streams by; completed
+    // chunks land in the table written at finalize
+    if (ih->chunk_table) {
+        const uint8_t *chunk_src = static_cast<const uint8_t *>(value_data);
+        uint32_t chunk_left = data_size;
+        uint32_t data_pos = ih->offset_in_data;
+        while (chunk_left) {
+            uint32_t chunk_fill = data_pos % TDBSTORE_CHUNK_CRC_SIZE;
+            uint32_t take = std::min<uint32_t>(chunk_left, TDBSTORE_CHUNK_CRC_SIZE - chunk_fill);
+            ih->chunk_crc = calc_crc(ih->chunk_crc, take, chunk_src);
+            chunk_src += take;
+            chunk_left -= take;
+            data_pos += take;
+            if (data_pos % TDBSTORE_CHUNK_CRC_SIZE == 0) {
+                ih->chunk_table[data_pos / TDBSTORE_CHUNK_CRC_SIZE - 1] = ih->chunk_crc;
+                ih->chunk_crc = initial_crc;
+            }
+        }
+    }
+#endif
+
     // Write the data chunk
     ret = write_area(_active_area, ih->bd_curr_offset, data_size, value_data);
     if (ret) {
@@ -639,6 +999,22 @@ int TDBStore::set_finalize(set_handle_t handle)
         goto end;
     }
 
+#if TDBSTORE_CHUNK_CRC_SIZE
+    // Write the per-chunk CRC table right after the data
+    if (ih->chunk_table) {
+        if (ih->header.data_size % TDBSTORE_CHUNK_CRC_SIZE) {
+            ih->chunk_table[ih->header.data_size / TDBSTORE_CHUNK_CRC_SIZE] = ih->chunk_crc;
+        }
+        ret = write_area(_active_area, ih->bd_curr_offset, chunk_table_size(ih->header),
+                         ih->chunk_table);
+        if (ret) {
+            need_gc = true;
+            goto end;
+        }
+        ih->bd_curr_offset += chunk_table_size(ih->header);
+    }
+#endif
+
     // Write header
     ret = write_area(_active_area, ih->bd_base_offset, sizeof(record_header_t), &ih->header);
     if (ret) {
@@ -646,12 +1022,16 @@ int TDBStore::set_finalize(set_handle_t handle)
         goto end;
     }
 
-    // Need to flush buffered BD as our record is totally written now
-    os_ret = _buff_bd->sync();
-    if (os_ret) {
-        ret = MBED_ERROR_WRITE_FAILED;
-        need_gc = true;
-        goto end;
+    // Need to flush buffered BD as our record is totally written now.
+    // Within a batch, flushing and write verification are deferred to
+    // batch_commit, so consecutive records share flash program cycles.
+    if (!_batch_in_progress) {
+        os_ret = _buff_bd->sync();
+        if (os_ret) {
+            ret = MBED_ERROR_WRITE_FAILED;
+            need_gc = true;
+            goto end;
+        }
     }
 
     // In master record case we don't update RAM table
@@ -661,12 +1041,14 @@ int TDBStore::set_finalize(set_handle_t handle)
 
     // Writes may fail without returning a failure (especially in flash components). Reread the record
     // to ensure write success (this won't read the data anywhere - just use the CRC calculation).
-    ret = read_record(_active_area, ih->bd_base_offset, 0, 0, (uint32_t) -1,
-                      actual_data_size, 0, false, false, false, false,
-                      hash, flags, next_offset);
-    if (ret) {
-        need_gc = true;
-        goto end;
+    if (!_batch_in_progress) {
+        ret = read_record(_active_area, ih->bd_base_offset, 0, 0, (uint32_t) -1,
+                          actual_data_size, 0, false, false, false, false,
+                          hash, flags, next_offset);
+        if (ret) {
+            need_gc = true;
+            goto end;
+        }
     }
 
     // Update RAM table
@@ -677,6 +1059,7 @@ int TDBStore::set_finalize(set_handle_t handle)
                     sizeof(ram_table_entry_t) * (_num_keys - ih->ram_table_ind));
         }
         update_all_iterators(false, ih->ram_table_ind);
+        index_remove(ih->hash);
     } else {
         if (ih->new_key) {
             if (ih->ram_table_ind < _num_keys) {
@@ -689,6 +1072,7 @@ int TDBStore::set_finalize(set_handle_t handle)
         entry = &ram_table[ih->ram_table_ind];
         entry->hash = ih->hash;
         entry->bd_offset = ih->bd_base_offset;
+        index_insert(ih->hash, ih->bd_base_offset);
     }
 
     _free_space_offset = align_up(ih->bd_curr_offset, _prog_size);
@@ -702,10 +1086,25 @@ int TDBStore::set_finalize(set_handle_t handle)
         check_erase_before_write(_active_area, _free_space_offset, sizeof(record_header_t));
     }
 
+#if TDBSTORE_BACKGROUND_GC
+    // Every committed mutation invalidates a background compaction pass in
+    // progress; schedule one if this write pushed us past the fill watermark
+    // (for a batch, batch_commit schedules once at the end).
+    _bg_gc_generation++;
+    if (!_batch_in_progress) {
+        schedule_background_gc();
+    }
+#endif
+
 end:
     // mark handle as invalid by clearing magic field in header
     ih->header.magic = 0;
 
+#if TDBSTORE_CHUNK_CRC_SIZE
+    delete[] ih->chunk_table;
+    ih->chunk_table = nullptr;
+#endif
+
     _inc_set_mutex.unlock();
 
     if (ih->bd_base_offset != _master_record_offset) {
@@ -746,6 +1145,83 @@ int TDBStore::remove(const char *key)
     return set(key, 0, 0, delete_flag);
 }
 
+int TDBStore::batch_start(batch_handle_t *handle)
+{
+    if (!_is_initialized) {
+        return MBED_ERROR_NOT_READY;
+    }
+
+    // The mutex is taken here and released in batch_commit, same as the
+    // incremental set sequence holds it from set_start to set_finalize
+    _mutex.lock();
+
+    if (_batch_in_progress) {
+        _mutex.unlock();
+        return MBED_ERROR_INVALID_ARGUMENT;
+    }
+
+    _batch_in_progress = true;
+    _batch_verify_offset = _free_space_offset;
+    *handle = reinterpret_cast<batch_handle_t>(this);
+    return MBED_SUCCESS;
+}
+
+int TDBStore::batch_set(batch_handle_t handle, const char *key, const void *buffer, size_t size,
+                        uint32_t create_flags)
+{
+    if ((handle != reinterpret_cast<batch_handle_t>(this)) || !_batch_in_progress) {
+        return MBED_ERROR_INVALID_ARGUMENT;
+    }
+
+    // set_finalize defers flushing and verification while the batch is open
+    return set(key, buffer, size, create_flags);
+}
+
+int TDBStore::batch_commit(batch_handle_t handle)
+{
+    int os_ret, ret = MBED_SUCCESS;
+    uint32_t offset;
+    uint32_t actual_data_size, hash, flags, next_offset;
+    bool need_gc = false;
+
+    if ((handle != reinterpret_cast<batch_handle_t>(this)) || !_batch_in_progress) {
+        return MBED_ERROR_INVALID_ARGUMENT;
+    }
+
+    // One flush covers every record written since batch_start
+    os_ret = _buff_bd->sync();
+    if (os_ret) {
+        ret = MBED_ERROR_WRITE_FAILED;
+        need_gc = true;
+        goto end;
+    }
+
+    // Writes may fail without returning a failure - walk and reread all
+    // records the batch appended, as set_finalize does for a single one
+    offset = _batch_verify_offset;
+    while (offset + sizeof(record_header_t) < _free_space_offset) {
+        ret = read_record(_active_area, offset, 0, 0, (uint32_t) -1,
+                          actual_data_size, 0, false, false, false, false,
+                          hash, flags, next_offset);
+        if (ret) {
+            need_gc = true;
+            goto end;
+        }
+        offset = next_offset;
+    }
+
+end:
+    _batch_in_progress = false;
+    if (need_gc) {
+        garbage_collection();
+    }
+#if TDBSTORE_BACKGROUND_GC
+    schedule_background_gc();
+#endif
+    _mutex.unlock();
+    return ret;
+}
+
 int TDBStore::get(const char *key, void *buffer, size_t buffer_size, size_t *actual_size, size_t offset)
 {
     int ret;
@@ -759,6 +1235,19 @@ int TDBStore::get(const char *key, void *buffer, size_t buffer_size, size_t *act
 
     _mutex.lock();
 
+    // Fast path - jump straight to the record via the hash index, verifying
+    // the key and copying the data in one record read
+    hash = calc_crc(initial_crc, strlen(key), key);
+    bd_offset = index_lookup(hash);
+    if (bd_offset) {
+        ret = read_record(_active_area, bd_offset, const_cast<char *>(key), buffer, buffer_size,
+                          actual_data_size, offset, false, true, true, false, hash, flags, next_bd_offset);
+        // Not found here means another key has the same hash - resolve with the full lookup
+        if (ret != MBED_ERROR_ITEM_NOT_FOUND) {
+            goto done;
+        }
+    }
+
     ret = find_record(_active_area, key, bd_offset, ram_table_ind, hash);
 
     if (ret != MBED_SUCCESS) {
@@ -768,6 +1257,7 @@ int TDBStore::get(const char *key, void *buffer, size_t buffer_size, size_t *act
     ret = read_record(_active_area, bd_offset, const_cast<char *>(key), buffer, buffer_size,
                       actual_data_size, offset, false, true, false, false, hash, flags, next_bd_offset);
 
+done:
     if (actual_size) {
         *actual_size = actual_data_size;
     }
@@ -790,6 +1280,22 @@ int TDBStore::get_info(const char *key, info_t *info)
 
     _mutex.lock();
 
+    // Fast path - jump straight to the record via the hash index
+    hash = calc_crc(initial_crc, strlen(key), key);
+    bd_offset = index_lookup(hash);
+    if (bd_offset) {
+        ret = read_record(_active_area, bd_offset, const_cast<char *>(key), 0, (uint32_t) -1,
+                          actual_data_size, 0, false, false, true, false, hash, flags,
+                          next_bd_offset);
+        // Not found here means another key has the same hash - resolve with the full lookup
+        if (ret == MBED_SUCCESS) {
+            goto found;
+        }
+        if (ret != MBED_ERROR_ITEM_NOT_FOUND) {
+            goto end;
+        }
+    }
+
     ret = find_record(_active_area, key, bd_offset, ram_table_ind, hash);
 
     if (ret) {
@@ -806,8 +1312,10 @@ int TDBStore::get_info(const char *key, info_t *info)
         goto end;
     }
 
+found:
+
     if (info) {
-        info->flags = flags;
+        info->flags = flags & ~internal_flags;
         info->size = actual_data_size;
     }
 
@@ -841,7 +1349,7 @@ int TDBStore::copy_record(uint8_t from_area, uint32_t from_offset, uint32_t to_o
     }
 
     total_size = align_up(sizeof(record_header_t), _prog_size) +
-                 align_up(header.key_size + header.data_size, _prog_size);;
+                 align_up(header.key_size + header.data_size + chunk_table_size(header), _prog_size);
 
 
     if (to_offset + total_size > _size) {
@@ -894,6 +1402,11 @@ int TDBStore::garbage_collection()
     int ret;
     size_t ind;
 
+#if TDBSTORE_BACKGROUND_GC
+    // A synchronous GC supersedes any background pass in progress
+    abort_background_gc();
+#endif
+
     // Reset the standby area
     ret = reset_area(1 - _active_area);
     if (ret) {
@@ -920,6 +1433,9 @@ int TDBStore::garbage_collection()
     to_offset = to_next_offset;
     _free_space_offset = to_next_offset;
 
+    // All record offsets have changed - rebuild the hash index
+    index_rebuild();
+
     // Now we can switch to the new active area
     _active_area = 1 - _active_area;
 
@@ -930,9 +1446,118 @@ int TDBStore::garbage_collection()
         return ret;
     }
 
+    // Records copied by GC were verified when first written - a batch only
+    // needs to verify what it appends after this point
+    if (_batch_in_progress) {
+        _batch_verify_offset = _free_space_offset;
+    }
+
     return MBED_SUCCESS;
 }
 
+#if TDBSTORE_BACKGROUND_GC
+void TDBStore::abort_background_gc()
+{
+    delete[] _bg_gc_new_offsets;
+    _bg_gc_new_offsets = nullptr;
+    _bg_gc_in_progress = false;
+    _bg_gc_ind = 0;
+}
+
+void TDBStore::schedule_background_gc()
+{
+    if (_bg_gc_event_id) {
+        return;
+    }
+
+    if ((uint64_t) _free_space_offset * 100 < (uint64_t) _size * TDBSTORE_BACKGROUND_GC_WATERMARK) {
+        return;
+    }
+
+    _bg_gc_event_id = mbed_event_queue()->call(mbed::callback(this, &TDBStore::background_gc_step));
+}
+
+void TDBStore::background_gc_step()
+{
+    ram_table_entry_t *ram_table;
+    uint32_t next_offset, records, ind;
+    int ret;
+
+    _mutex.lock();
+
+    _bg_gc_event_id = 0;
+
+    if (!_is_initialized) {
+        goto end;
+    }
+
+    // A mutation since the last step means the records copied so far may be
+    // stale - drop the pass and start over from the current RAM table.
+    if (_bg_gc_in_progress && (_bg_gc_pass_generation != _bg_gc_generation)) {
+        abort_background_gc();
+    }
+
+    if (!_bg_gc_in_progress) {
+        // Fill level may have dropped below the watermark since this step was
+        // scheduled (e.g. a synchronous GC ran) - nothing to do then
+        if ((uint64_t) _free_space_offset * 100 < (uint64_t) _size * TDBSTORE_BACKGROUND_GC_WATERMARK) {
+            goto end;
+        }
+
+        // New offsets are applied to the RAM table only when the pass
+        // completes, so reads keep being served from the active area
+        _bg_gc_new_offsets = new uint32_t[_num_keys];
+
+        ret = reset_area(1 - _active_area);
+        if (ret) {
+            abort_background_gc();
+            goto end;
+        }
+
+        _bg_gc_ind = 0;
+        _bg_gc_to_offset = _master_record_offset + _master_record_size;
+        _bg_gc_pass_generation = _bg_gc_generation;
+        _bg_gc_in_progress = true;
+    }
+
+    ram_table = (ram_table_entry_t *) _ram_table;
+
+    for (records = 0; (_bg_gc_ind < _num_keys) && (records < TDBSTORE_BACKGROUND_GC_RECORDS_PER_STEP); records++) {
+        uint32_t to_next_offset;
+        ret = copy_record(_active_area, ram_table[_bg_gc_ind].bd_offset, _bg_gc_to_offset, to_next_offset);
+        if (ret) {
+            abort_background_gc();
+            goto end;
+        }
+        _bg_gc_new_offsets[_bg_gc_ind] = _bg_gc_to_offset;
+        _bg_gc_to_offset = to_next_offset;
+        _bg_gc_ind++;
+    }
+
+    if (_bg_gc_ind < _num_keys) {
+        // More records to go - take another bounded step once the other
+        // events pending on the queue have had their turn
+        _bg_gc_event_id = mbed_event_queue()->call(mbed::callback(this, &TDBStore::background_gc_step));
+        goto end;
+    }
+
+    // All records copied with no interleaving mutation - switch to the
+    // compacted area, exactly as the synchronous GC does
+    for (ind = 0; ind < _num_keys; ind++) {
+        ram_table[ind].bd_offset = _bg_gc_new_offsets[ind];
+    }
+    index_rebuild();
+    _free_space_offset = _bg_gc_to_offset;
+    _active_area = 1 - _active_area;
+    _active_area_version++;
+    next_offset = _bg_gc_to_offset;
+    write_master_record(_active_area, _active_area_version, next_offset);
+    abort_background_gc();
+
+end:
+    _mutex.unlock();
+}
+#endif
 
 int TDBStore::build_ram_table()
 {
@@ -1135,6 +1760,8 @@ int TDBStore::init()
         goto fail;
     }
 
+    index_rebuild();
+
 end:
     _is_initialized = true;
     _mutex.unlock();
@@ -1158,6 +1785,15 @@ int TDBStore::deinit()
 {
     _mutex.lock();
     if (_is_initialized) {
+#if TDBSTORE_BACKGROUND_GC
+        // A step that already started dispatching blocks on our mutex and
+        // returns once it finds the class deinitialized
+        if (_bg_gc_event_id) {
+            mbed_event_queue()->cancel(_bg_gc_event_id);
+            _bg_gc_event_id = 0;
+        }
+        abort_background_gc();
+#endif
         _buff_bd->deinit();
         delete _buff_bd;
 
@@ -1165,6 +1801,15 @@ int TDBStore::deinit()
         delete[] ram_table;
         delete[] _work_buf;
         delete[] _key_buf;
+        delete[] reinterpret_cast<ram_table_entry_t *>(_hash_index);
+        _hash_index = nullptr;
+        _hash_index_capacity = 0;
+        _hash_index_used = 0;
+#if TDBSTORE_CHUNK_CRC_SIZE
+        // An aborted incremental set may have left its CRC table allocated
+        delete[] reinterpret_cast<inc_set_handle_t *>(_inc_set_handle)->chunk_table;
+        reinterpret_cast<inc_set_handle_t *>(_inc_set_handle)->chunk_table = nullptr;
+#endif
     }
 
     _is_initialized = false;
@@ -1201,6 +1846,10 @@ int TDBStore::reset()
 
     _mutex.lock();
 
+#if TDBSTORE_BACKGROUND_GC
+    abort_background_gc();
+#endif
+
     // Reset both areas
     for (area = 0; area < _num_areas; area++) {
         ret = check_erase_before_write(area, 0, _master_record_offset + _master_record_size + _prog_size, true);
@@ -1214,6 +1863,7 @@ int TDBStore::reset()
     _free_space_offset = _master_record_offset;
     _active_area_version = 1;
     memset(_ram_table, 0, sizeof(ram_table_entry_t) * _max_keys);
+    index_rebuild();
     // Write an initial master record on active area
     ret = write_master_record(_active_area, _active_area_version, _free_space_offset);
 
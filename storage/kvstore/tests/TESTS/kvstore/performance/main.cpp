@@ -0,0 +1,155 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* TDBStore set/get latency distributions, measured on a fresh store and
+ * again after heavy overwriting has fragmented it. The p99 and max of the
+ * fragmented run expose garbage collection pauses that a mean would hide. */
+
+#include "mbed.h"
+#include "greentea-client/test_env.h"
+#include "unity/unity.h"
+#include "utest/utest.h"
+#include "tdbstore/TDBStore.h"
+#include "BlockDevice.h"
+#include <algorithm>
+#include <stdlib.h>
+
+#if !DEVICE_USTICKER
+#error [NOT_SUPPORTED] UsTicker need to be enabled for this test
+#else
+
+using namespace utest::v1;
+
+namespace {
+const int NUM_KEYS = 32;
+const int FRAGMENTATION_WRITES = 256;
+const int SAMPLES = 100;
+
+TDBStore *kv;
+Timer timer;
+uint8_t value_buffer[256];
+uint32_t set_latency_us[SAMPLES];
+uint32_t get_latency_us[SAMPLES];
+}
+
+static void perf_report(const char *name, const char *unit, int value)
+{
+    printf("MBED: perf %s = %d %s\n", name, value, unit);
+    greentea_send_kv("perf", name, value);
+}
+
+static void report_distribution(const char *name, uint32_t *samples, int count)
+{
+    std::sort(samples, samples + count);
+    char full_name[48];
+    snprintf(full_name, sizeof(full_name), "%s_p50", name);
+    perf_report(full_name, "us", samples[count / 2]);
+    snprintf(full_name, sizeof(full_name), "%s_p99", name);
+    perf_report(full_name, "us", samples[(count * 99) / 100]);
+    snprintf(full_name, sizeof(full_name), "%s_max", name);
+    perf_report(full_name, "us", samples[count - 1]);
+}
+
+static void key_name(char *buffer, size_t size, int index)
+{
+    snprintf(buffer, size, "perf_key_%d", index);
+}
+
+/* Time one set and one get of each sampled key */
+static void sample_latencies()
+{
+    char key[32];
+    size_t actual_size;
+
+    for (int i = 0; i < SAMPLES; i++) {
+        key_name(key, sizeof(key), i % NUM_KEYS);
+
+        auto start = timer.elapsed_time();
+        TEST_ASSERT_EQUAL(MBED_SUCCESS, kv->set(key, value_buffer, 64, 0));
+        set_latency_us[i] = (uint32_t)(timer.elapsed_time() - start).count();
+
+        start = timer.elapsed_time();
+        TEST_ASSERT_EQUAL(MBED_SUCCESS, kv->get(key, value_buffer, sizeof(value_buffer), &actual_size));
+        get_latency_us[i] = (uint32_t)(timer.elapsed_time() - start).count();
+    }
+}
+
+void test_latency_clean()
+{
+    sample_latencies();
+    report_distribution("tdb_set_clean", set_latency_us, SAMPLES);
+    report_distribution("tdb_get_clean", get_latency_us, SAMPLES);
+}
+
+void test_latency_fragmented()
+{
+    char key[32];
+
+    /* Overwrite the keys with varying sizes until well past the first
+     * garbage collection, so the store is measured in its steady state */
+    for (int i = 0; i < FRAGMENTATION_WRITES; i++) {
+        key_name(key, sizeof(key), rand() % NUM_KEYS);
+        size_t size = 16 + (rand() % 200);
+        TEST_ASSERT_EQUAL(MBED_SUCCESS, kv->set(key, value_buffer, size, 0));
+    }
+
+    sample_latencies();
+    report_distribution("tdb_set_fragmented", set_latency_us, SAMPLES);
+    report_distribution("tdb_get_fragmented", get_latency_us, SAMPLES);
+}
+
+utest::v1::status_t greentea_setup(const size_t number_of_cases)
+{
+    GREENTEA_SETUP(180, "default_auto");
+
+    BlockDevice *bd = BlockDevice::get_default_instance();
+    TEST_ASSERT_NOT_NULL(bd);
+    kv = new TDBStore(bd);
+    TEST_ASSERT_EQUAL(MBED_SUCCESS, kv->init());
+    TEST_ASSERT_EQUAL(MBED_SUCCESS, kv->reset());
+
+    for (size_t i = 0; i < sizeof(value_buffer); i++) {
+        value_buffer[i] = (uint8_t)i;
+    }
+    timer.start();
+
+    return greentea_test_setup_handler(number_of_cases);
+}
+
+void greentea_teardown(const size_t passed, const size_t failed, const failure_t failure)
+{
+    timer.stop();
+    if (kv) {
+        kv->deinit();
+        delete kv;
+    }
+    greentea_test_teardown_handler(passed, failed, failure);
+}
+
+Case cases[] = {
+    Case("TDBStore latency on a clean store", test_latency_clean),
+    Case("TDBStore latency under fragmentation", test_latency_fragmented),
+};
+
+Specification specification(greentea_setup, cases, greentea_teardown);
+
+int main()
+{
+    return !Harness::run(specification);
+}
+
+#endif // !DEVICE_USTICKER
@@ -0,0 +1,187 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_LOGRING_H
+#define MBED_LOGRING_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "blockdevice/BlockDevice.h"
+#include "platform/NonCopyable.h"
+#include "platform/PlatformMutex.h"
+
+namespace mbed {
+
+/** \addtogroup storage */
+/** @{*/
+
+/* Largest record the ring accepts. Bounds the staging buffer used to
+ * pad records to the program unit. */
+#ifndef MBED_CONF_LOGSHIP_MAX_RECORD
+#define MBED_CONF_LOGSHIP_MAX_RECORD 256
+#endif
+
+/** A persistent ring of records over a block device.
+ *
+ * Records are appended into erase blocks in sequence-number order, each
+ * guarded by a CRC. When the device fills, the oldest erase block is
+ * reclaimed, so the ring always holds the most recent history. Nothing
+ * is kept in RAM that cannot be rebuilt: init() rescans the device, so
+ * records written before a crash or power cut are still there
+ * afterwards - a torn final record is detected by its CRC and treated
+ * as the end of the ring.
+ *
+ * Records are addressed by their 32-bit sequence number. Readers
+ * iterate from any sequence number still in the ring, and a consumer
+ * that has durably processed records up to some sequence calls
+ * discard() to let their erase blocks be reclaimed early.
+ *
+ * The device needs at least two erase blocks. Records do not span
+ * erase blocks, so the erase size bounds the record size along with
+ * MBED_CONF_LOGSHIP_MAX_RECORD.
+ *
+ * @note Synchronization level: Thread safe
+ */
+class LogRing : private NonCopyable<LogRing> {
+public:
+    /** Iterator over stored records */
+    struct iterator_t {
+        uint32_t block;     /**< Erase block being read */
+        uint32_t offset;    /**< Offset of the next record in the block */
+        uint32_t next_seq;  /**< Sequence number expected next */
+    };
+
+    /** Create a ring on a block device
+     *
+     *  @param bd       Device holding the ring, used in whole
+     */
+    LogRing(BlockDevice *bd);
+
+    ~LogRing();
+
+    /** Initialize the device and rebuild the ring state from it
+     *
+     * A device with no valid ring on it is formatted.
+     *
+     *  @return         0 on success, negative error code on failure
+     */
+    int init();
+
+    /** Deinitialize the underlying device
+     *
+     *  @return         0 on success, negative error code on failure
+     */
+    int deinit();
+
+    /** Append one record
+     *
+     * The record is fully programmed before it becomes visible to a
+     * rescan; appends interrupted by power loss are dropped by the next
+     * init(). May reclaim the oldest erase block to make room.
+     *
+     *  @param data     Record payload
+     *  @param size     Payload size, up to MBED_CONF_LOGSHIP_MAX_RECORD
+     *  @return         0 on success, negative error code on failure
+     */
+    int append(const void *data, size_t size);
+
+    /** Get the sequence number of the oldest stored record
+     *
+     *  @return         Sequence number, 0 if the ring is empty
+     */
+    uint32_t first_seq();
+
+    /** Get the sequence number of the newest stored record
+     *
+     *  @return         Sequence number, 0 if the ring is empty
+     */
+    uint32_t last_seq();
+
+    /** Open an iterator at a sequence number
+     *
+     * Sequence numbers older than the ring start at the oldest stored
+     * record instead.
+     *
+     *  @param it       Iterator to open
+     *  @param from_seq Sequence number to start from
+     *  @return         0 on success, negative error code on failure
+     */
+    int iterate_open(iterator_t *it, uint32_t from_seq);
+
+    /** Read the next record and advance the iterator
+     *
+     *  @param it       Open iterator
+     *  @param buf      Destination for the record payload
+     *  @param buf_size Size of the destination
+     *  @param size     Set to the payload size
+     *  @param seq      Set to the record's sequence number, may be NULL
+     *  @return         0 on success, -ENODATA at the end of the ring,
+     *                  other negative error code on failure
+     */
+    int iterate_next(iterator_t *it, void *buf, size_t buf_size,
+                     size_t *size, uint32_t *seq = NULL);
+
+    /** Allow records up to a sequence number to be reclaimed
+     *
+     * Erase blocks whose records have all been consumed are erased now,
+     * so a rescan no longer returns them.
+     *
+     *  @param up_to_seq Last consumed sequence number
+     *  @return         0 on success, negative error code on failure
+     */
+    int discard(uint32_t up_to_seq);
+
+private:
+    struct block_header_t {
+        uint32_t magic;
+        uint32_t block_seq;     // Monotonic, orders blocks across wraps
+    };
+
+    struct record_header_t {
+        uint16_t magic;
+        uint16_t size;
+        uint32_t seq;
+        uint32_t crc;           // Over the payload
+    };
+
+    int format();
+    int scan();
+    int advance_block();
+    int read_record_header(uint32_t block, uint32_t offset, record_header_t *header);
+    uint32_t block_addr(uint32_t block) const;
+    uint32_t record_space(size_t size) const;
+
+    BlockDevice *_bd;
+    uint32_t _block_size;       // Erase block size
+    uint32_t _prog_size;
+    uint32_t _num_blocks;
+    uint32_t _head_block;       // Block being appended to
+    uint32_t _head_offset;      // Write position inside it
+    uint32_t _tail_block;       // Oldest live block
+    uint32_t _block_seq;        // Of the head block
+    uint32_t _first_seq;
+    uint32_t _last_seq;
+    uint8_t *_staging;          // One padded record
+    bool _is_initialized;
+    PlatformMutex _mutex;
+};
+
+/** @}*/
+
+} // namespace mbed
+
+#endif
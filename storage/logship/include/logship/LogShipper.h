@@ -0,0 +1,163 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_LOGSHIPPER_H
+#define MBED_LOGSHIPPER_H
+
+#include "logship/LogRing.h"
+#include "platform/Callback.h"
+
+namespace mbed {
+
+/** \addtogroup storage */
+/** @{*/
+
+/* Upload batch size: one batch of records is staged, optionally
+ * compressed and sent per ship() call. Costs twice this in heap. */
+#ifndef MBED_CONF_LOGSHIP_BATCH_SIZE
+#define MBED_CONF_LOGSHIP_BATCH_SIZE 1024
+#endif
+
+/** Ship persisted log records to a collector in batches.
+ *
+ * Log lines go into a LogRing as compact timestamped records the moment
+ * they are produced, so history survives crashes and power cuts instead
+ * of scrolling past an unwatched UART. Shipping is decoupled: ship()
+ * drains unshipped records into one framed batch, LZSS-compresses it
+ * when that helps (log text typically halves), and hands the bytes to a
+ * send callback - wrap the connected TLSSocket:
+ *
+ * @code
+ * shipper.ship([&](const void *data, size_t size) {
+ *     return socket.send(data, size);
+ * });
+ * @endcode
+ *
+ * so the radio and TLS session cost is paid once per batch rather than
+ * per line. Run ship() from an events::PeriodicTask for scheduled
+ * uploads, and set a watermark to be told when enough has accumulated
+ * to be worth an early one. Shipped records are released back to the
+ * ring with discard(), so a crash between batches re-sends at most one
+ * batch - delivery is at-least-once and the per-record sequence numbers
+ * let the collector deduplicate.
+ *
+ * To capture mbed-trace output, install the static hook:
+ *
+ * @code
+ * LogShipper::set_default(&shipper);
+ * mbed_trace_print_function_set(LogShipper::trace_print);
+ * @endcode
+ *
+ * Batch frame: a 16-byte header (magic "LOGB", version, flags, record
+ * count, first sequence number, raw and wire payload sizes as noted in
+ * LogShipper.cpp) followed by the payload, each record inside it a
+ * 16-bit length plus a 32-bit timestamp and the line text.
+ *
+ * @note Synchronization level: Thread safe
+ */
+class LogShipper : private NonCopyable<LogShipper> {
+public:
+    /** Create a shipper over a ring
+     *
+     *  @param ring     Ring holding the records, already initialized
+     */
+    LogShipper(LogRing *ring);
+
+    ~LogShipper();
+
+    /** Allocate the batch buffers and find the shipping position
+     *
+     *  @return         0 on success, negative error code on failure
+     */
+    int init();
+
+    /** Persist one log line
+     *
+     * The line is stored with the current time and counted towards the
+     * watermark. Lines longer than the ring's record limit are
+     * truncated.
+     *
+     *  @param line     Log line to persist
+     */
+    void log(const char *line);
+
+    /** Ship one batch of unshipped records
+     *
+     * Records are staged until the batch buffer is full, compressed
+     * when that makes them smaller, and passed to the send callback as
+     * one frame. The callback is invoked until the frame is fully sent
+     * and may send in pieces; a negative return aborts the batch, which
+     * stays queued for the next attempt.
+     *
+     *  @param send     Sends frame bytes, returning the number sent or
+     *                  a negative error code
+     *  @return         Number of records shipped, 0 when nothing is
+     *                  pending, negative error code on failure
+     */
+    ssize_t ship(mbed::Callback<ssize_t(const void *, size_t)> send);
+
+    /** Get the number of bytes waiting to be shipped
+     *
+     *  @return         Payload bytes accumulated since the last ship()
+     */
+    size_t pending_bytes();
+
+    /** Be notified when enough log data has accumulated
+     *
+     * The callback fires from log() when pending bytes cross the
+     * watermark, once per crossing - post the actual ship() to an event
+     * queue from it.
+     *
+     *  @param bytes    Watermark in payload bytes
+     *  @param ready    Callback invoked on crossing, or empty to clear
+     */
+    void set_watermark(size_t bytes, mbed::Callback<void()> ready);
+
+    /** Install a shipper as the target of trace_print()
+     *
+     *  @param shipper  Shipper that receives trace output
+     */
+    static void set_default(LogShipper *shipper);
+
+    /** Print hook for mbed_trace_print_function_set()
+     *
+     * Persists the line on the default shipper; does nothing while no
+     * default is set.
+     *
+     *  @param line     Trace line
+     */
+    static void trace_print(const char *line);
+
+private:
+    LogRing *_ring;
+    uint8_t *_raw;          // Staged batch payload
+    uint8_t *_packed;       // Its compressed form
+    uint32_t _shipped_seq;  // Last record confirmed sent
+    size_t _pending;
+    size_t _watermark;
+    bool _watermark_armed;
+    mbed::Callback<void()> _ready;
+    bool _is_initialized;
+    PlatformMutex _mutex;
+
+    static LogShipper *_default;
+};
+
+/** @}*/
+
+} // namespace mbed
+
+#endif
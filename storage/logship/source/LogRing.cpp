@@ -0,0 +1,450 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "logship/LogRing.h"
+#include "drivers/MbedCRC.h"
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace mbed {
+
+static const uint32_t block_magic = 0x474e524c;     // "LRNG"
+static const uint16_t record_magic = 0x4c52;        // "RL"
+
+static uint32_t calc_crc(const void *data, size_t size)
+{
+    uint32_t crc = 0;
+    MbedCRC<POLY_32BIT_ANSI, 32> ct(0xffffffff, 0x0, true, false);
+    ct.compute(data, size, &crc);
+    return crc;
+}
+
+static uint32_t align_up(uint32_t val, uint32_t size)
+{
+    return (val + size - 1) / size * size;
+}
+
+LogRing::LogRing(BlockDevice *bd)
+    : _bd(bd), _block_size(0), _prog_size(0), _num_blocks(0),
+      _head_block(0), _head_offset(0), _tail_block(0), _block_seq(0),
+      _first_seq(0), _last_seq(0), _staging(NULL), _is_initialized(false)
+{
+}
+
+LogRing::~LogRing()
+{
+    deinit();
+}
+
+uint32_t LogRing::block_addr(uint32_t block) const
+{
+    return block * _block_size;
+}
+
+uint32_t LogRing::record_space(size_t size) const
+{
+    return align_up(sizeof(record_header_t) + size, _prog_size);
+}
+
+int LogRing::init()
+{
+    _mutex.lock();
+    if (_is_initialized) {
+        _mutex.unlock();
+        return 0;
+    }
+
+    int err = _bd->init();
+    if (err) {
+        _mutex.unlock();
+        return err;
+    }
+
+    _block_size = _bd->get_erase_size();
+    _prog_size = _bd->get_program_size();
+    _num_blocks = _bd->size() / _block_size;
+    if (_num_blocks < 2) {
+        _bd->deinit();
+        _mutex.unlock();
+        return -EINVAL;
+    }
+
+    _staging = (uint8_t *) malloc(record_space(MBED_CONF_LOGSHIP_MAX_RECORD));
+    if (!_staging) {
+        _bd->deinit();
+        _mutex.unlock();
+        return -ENOMEM;
+    }
+
+    err = scan();
+    if (err) {
+        free(_staging);
+        _staging = NULL;
+        _bd->deinit();
+        _mutex.unlock();
+        return err;
+    }
+
+    _is_initialized = true;
+    _mutex.unlock();
+    return 0;
+}
+
+int LogRing::deinit()
+{
+    _mutex.lock();
+    if (!_is_initialized) {
+        _mutex.unlock();
+        return 0;
+    }
+    int err = _bd->deinit();
+    free(_staging);
+    _staging = NULL;
+    _is_initialized = false;
+    _mutex.unlock();
+    return err;
+}
+
+int LogRing::format()
+{
+    int err = _bd->erase(0, _block_size);
+    if (err) {
+        return err;
+    }
+
+    block_header_t header = {block_magic, 1};
+    memset(_staging, 0xff, _prog_size);
+    memcpy(_staging, &header, sizeof(header));
+    err = _bd->program(_staging, 0, _prog_size);
+    if (err) {
+        return err;
+    }
+
+    _head_block = 0;
+    _head_offset = align_up(sizeof(block_header_t), _prog_size);
+    _tail_block = 0;
+    _block_seq = 1;
+    _first_seq = 0;
+    _last_seq = 0;
+    return 0;
+}
+
+int LogRing::read_record_header(uint32_t block, uint32_t offset, record_header_t *header)
+{
+    if (offset + sizeof(record_header_t) > _block_size) {
+        return -ENODATA;
+    }
+    int err = _bd->read(header, block_addr(block) + offset, sizeof(*header));
+    if (err) {
+        return err;
+    }
+    if ((header->magic != record_magic) ||
+            (header->size > MBED_CONF_LOGSHIP_MAX_RECORD) ||
+            (offset + record_space(header->size) > _block_size)) {
+        return -ENODATA;
+    }
+    return 0;
+}
+
+int LogRing::scan()
+{
+    // Find the live span of blocks by their monotonic block sequence:
+    // the smallest is the tail, the largest is the head, and blocks
+    // are laid out consecutively between them
+    uint32_t min_seq = 0, max_seq = 0;
+    uint32_t min_block = 0, max_block = 0;
+    bool any = false;
+
+    for (uint32_t b = 0; b < _num_blocks; b++) {
+        block_header_t header;
+        int err = _bd->read(&header, block_addr(b), sizeof(header));
+        if (err) {
+            return err;
+        }
+        if (header.magic != block_magic) {
+            continue;
+        }
+        if (!any || (header.block_seq < min_seq)) {
+            min_seq = header.block_seq;
+            min_block = b;
+        }
+        if (!any || (header.block_seq > max_seq)) {
+            max_seq = header.block_seq;
+            max_block = b;
+        }
+        any = true;
+    }
+
+    if (!any) {
+        return format();
+    }
+
+    _tail_block = min_block;
+    _head_block = max_block;
+    _block_seq = max_seq;
+    _first_seq = 0;
+    _last_seq = 0;
+
+    // Walk every live record to find the first, the last and the write
+    // position. A torn tail record fails its CRC and ends the walk
+    uint32_t block = _tail_block;
+    while (true) {
+        uint32_t offset = align_up(sizeof(block_header_t), _prog_size);
+        record_header_t header;
+        while (read_record_header(block, offset, &header) == 0) {
+            int err = _bd->read(_staging, block_addr(block) + offset + sizeof(header),
+                                header.size);
+            if (err) {
+                return err;
+            }
+            if (calc_crc(_staging, header.size) != header.crc) {
+                break;
+            }
+            if (!_first_seq) {
+                _first_seq = header.seq;
+            }
+            _last_seq = header.seq;
+            offset += record_space(header.size);
+        }
+        if (block == _head_block) {
+            _head_offset = offset;
+            break;
+        }
+        block = (block + 1) % _num_blocks;
+    }
+
+    return 0;
+}
+
+int LogRing::advance_block()
+{
+    uint32_t next = (_head_block + 1) % _num_blocks;
+
+    if (next == _tail_block) {
+        // Ring is full - sacrifice the oldest block. Its first record
+        // of the following block becomes the new start of history
+        uint32_t new_tail = (_tail_block + 1) % _num_blocks;
+        record_header_t header;
+        uint32_t offset = align_up(sizeof(block_header_t), _prog_size);
+        if (read_record_header(new_tail, offset, &header) == 0) {
+            _first_seq = header.seq;
+        } else {
+            _first_seq = _last_seq + 1;
+        }
+        _tail_block = new_tail;
+    }
+
+    int err = _bd->erase(block_addr(next), _block_size);
+    if (err) {
+        return err;
+    }
+
+    block_header_t header = {block_magic, _block_seq + 1};
+    memset(_staging, 0xff, _prog_size);
+    memcpy(_staging, &header, sizeof(header));
+    err = _bd->program(_staging, block_addr(next), _prog_size);
+    if (err) {
+        return err;
+    }
+
+    _block_seq++;
+    _head_block = next;
+    _head_offset = align_up(sizeof(block_header_t), _prog_size);
+    return 0;
+}
+
+int LogRing::append(const void *data, size_t size)
+{
+    if (!size || (size > MBED_CONF_LOGSHIP_MAX_RECORD)) {
+        return -EINVAL;
+    }
+
+    _mutex.lock();
+    if (!_is_initialized) {
+        _mutex.unlock();
+        return -EINVAL;
+    }
+
+    uint32_t space = record_space(size);
+    if (_head_offset + space > _block_size) {
+        int err = advance_block();
+        if (err) {
+            _mutex.unlock();
+            return err;
+        }
+    }
+
+    record_header_t header;
+    header.magic = record_magic;
+    header.size = size;
+    header.seq = _last_seq + 1;
+    header.crc = calc_crc(data, size);
+
+    memset(_staging, 0xff, space);
+    memcpy(_staging, &header, sizeof(header));
+    memcpy(_staging + sizeof(header), data, size);
+
+    int err = _bd->program(_staging, block_addr(_head_block) + _head_offset, space);
+    if (err) {
+        _mutex.unlock();
+        return err;
+    }
+
+    _head_offset += space;
+    _last_seq = header.seq;
+    if (!_first_seq) {
+        _first_seq = header.seq;
+    }
+    _mutex.unlock();
+    return 0;
+}
+
+uint32_t LogRing::first_seq()
+{
+    _mutex.lock();
+    uint32_t seq = _first_seq;
+    _mutex.unlock();
+    return seq;
+}
+
+uint32_t LogRing::last_seq()
+{
+    _mutex.lock();
+    uint32_t seq = _last_seq;
+    _mutex.unlock();
+    return seq;
+}
+
+int LogRing::iterate_open(iterator_t *it, uint32_t from_seq)
+{
+    _mutex.lock();
+    if (!_is_initialized) {
+        _mutex.unlock();
+        return -EINVAL;
+    }
+
+    if (from_seq < _first_seq) {
+        from_seq = _first_seq;
+    }
+
+    it->block = _tail_block;
+    it->offset = align_up(sizeof(block_header_t), _prog_size);
+    it->next_seq = _first_seq;
+
+    // Skip whole records until the requested sequence number
+    record_header_t header;
+    while ((it->next_seq < from_seq) &&
+            (read_record_header(it->block, it->offset, &header) == 0)) {
+        it->offset += record_space(header.size);
+        it->next_seq = header.seq + 1;
+        if ((it->block != _head_block) &&
+                (read_record_header(it->block, it->offset, &header) != 0)) {
+            it->block = (it->block + 1) % _num_blocks;
+            it->offset = align_up(sizeof(block_header_t), _prog_size);
+        }
+    }
+    _mutex.unlock();
+    return 0;
+}
+
+int LogRing::iterate_next(iterator_t *it, void *buf, size_t buf_size,
+                          size_t *size, uint32_t *seq)
+{
+    _mutex.lock();
+    if (!_is_initialized) {
+        _mutex.unlock();
+        return -EINVAL;
+    }
+
+    record_header_t header;
+    while (true) {
+        if ((it->block == _head_block) && (it->offset >= _head_offset)) {
+            _mutex.unlock();
+            return -ENODATA;
+        }
+        if (read_record_header(it->block, it->offset, &header) == 0) {
+            break;
+        }
+        if (it->block == _head_block) {
+            _mutex.unlock();
+            return -ENODATA;
+        }
+        it->block = (it->block + 1) % _num_blocks;
+        it->offset = align_up(sizeof(block_header_t), _prog_size);
+    }
+
+    if (header.size > buf_size) {
+        _mutex.unlock();
+        return -EINVAL;
+    }
+
+    int err = _bd->read(buf, block_addr(it->block) + it->offset + sizeof(header),
+                        header.size);
+    if (err) {
+        _mutex.unlock();
+        return err;
+    }
+    if (calc_crc(buf, header.size) != header.crc) {
+        _mutex.unlock();
+        return -EILSEQ;
+    }
+
+    *size = header.size;
+    if (seq) {
+        *seq = header.seq;
+    }
+    it->offset += record_space(header.size);
+    it->next_seq = header.seq + 1;
+    _mutex.unlock();
+    return 0;
+}
+
+int LogRing::discard(uint32_t up_to_seq)
+{
+    _mutex.lock();
+    if (!_is_initialized) {
+        _mutex.unlock();
+        return -EINVAL;
+    }
+
+    while (_tail_block != _head_block) {
+        // The tail block is fully consumed when the block after it
+        // starts at or below the discard point
+        uint32_t next = (_tail_block + 1) % _num_blocks;
+        record_header_t header;
+        uint32_t offset = align_up(sizeof(block_header_t), _prog_size);
+        if (read_record_header(next, offset, &header) != 0) {
+            break;
+        }
+        if (header.seq > up_to_seq + 1) {
+            break;
+        }
+
+        int err = _bd->erase(block_addr(_tail_block), _block_size);
+        if (err) {
+            _mutex.unlock();
+            return err;
+        }
+        _tail_block = next;
+        _first_seq = header.seq;
+    }
+    _mutex.unlock();
+    return 0;
+}
+
+} // namespace mbed
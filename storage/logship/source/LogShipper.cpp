@@ -0,0 +1,325 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "logship/LogShipper.h"
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+namespace mbed {
+
+LogShipper *LogShipper::_default = NULL;
+
+// Batch frame header, all fields little-endian
+struct batch_header_t {
+    uint32_t magic;         // "LOGB"
+    uint8_t version;
+    uint8_t flags;          // bit 0: payload is LZSS compressed
+    uint16_t count;         // Records in the batch
+    uint32_t first_seq;     // Sequence number of the first record
+    uint16_t raw_size;      // Payload size before compression
+    uint16_t wire_size;     // Payload bytes following this header
+};
+
+static const uint32_t batch_magic = 0x42474f4c;     // "LOGB"
+static const uint8_t batch_version = 1;
+static const uint8_t batch_flag_compressed = 0x1;
+
+// Byte-oriented LZSS: a control byte of eight flags consumed LSB first,
+// 0 for a literal byte, 1 for a two-byte little-endian token of 12-bit
+// distance (minus 1) and 4-bit length (minus 3). Returns the compressed
+// size, or 0 when the output would not fit in cap
+static size_t lzss_compress(const uint8_t *src, size_t len, uint8_t *dst, size_t cap)
+{
+    size_t si = 0, di = 0;
+    while (si < len) {
+        if (di + 1 > cap) {
+            return 0;
+        }
+        size_t ctrl_pos = di++;
+        uint8_t ctrl = 0;
+        for (int bit = 0; (bit < 8) && (si < len); bit++) {
+            size_t best_len = 0, best_dist = 0;
+            size_t max_back = (si < 4096) ? si : 4096;
+            for (size_t d = 1; d <= max_back; d++) {
+                size_t l = 0;
+                while ((l < 18) && (si + l < len) && (src[si - d + l] == src[si + l])) {
+                    l++;
+                }
+                if (l > best_len) {
+                    best_len = l;
+                    best_dist = d;
+                    if (l == 18) {
+                        break;
+                    }
+                }
+            }
+            if (best_len >= 3) {
+                if (di + 2 > cap) {
+                    return 0;
+                }
+                uint16_t token = (best_dist - 1) | ((best_len - 3) << 12);
+                dst[di++] = token & 0xff;
+                dst[di++] = token >> 8;
+                ctrl |= 1 << bit;
+                si += best_len;
+            } else {
+                if (di + 1 > cap) {
+                    return 0;
+                }
+                dst[di++] = src[si++];
+            }
+        }
+        dst[ctrl_pos] = ctrl;
+    }
+    return di;
+}
+
+LogShipper::LogShipper(LogRing *ring)
+    : _ring(ring), _raw(NULL), _packed(NULL), _shipped_seq(0),
+      _pending(0), _watermark(0), _watermark_armed(false),
+      _is_initialized(false)
+{
+}
+
+LogShipper::~LogShipper()
+{
+    if (_default == this) {
+        _default = NULL;
+    }
+    free(_raw);
+    free(_packed);
+}
+
+int LogShipper::init()
+{
+    _mutex.lock();
+    if (_is_initialized) {
+        _mutex.unlock();
+        return 0;
+    }
+
+    _raw = (uint8_t *) malloc(MBED_CONF_LOGSHIP_BATCH_SIZE);
+    _packed = (uint8_t *) malloc(MBED_CONF_LOGSHIP_BATCH_SIZE);
+    if (!_raw || !_packed) {
+        free(_raw);
+        free(_packed);
+        _raw = _packed = NULL;
+        _mutex.unlock();
+        return -ENOMEM;
+    }
+
+    // Everything still in the ring is unshipped - a crash between
+    // batches re-sends at most the batch that was in flight
+    uint32_t first = _ring->first_seq();
+    _shipped_seq = first ? first - 1 : _ring->last_seq();
+
+    _pending = 0;
+    LogRing::iterator_t it;
+    int err = _ring->iterate_open(&it, _shipped_seq + 1);
+    if (err) {
+        _mutex.unlock();
+        return err;
+    }
+    size_t size;
+    uint8_t buf[MBED_CONF_LOGSHIP_MAX_RECORD];
+    while (_ring->iterate_next(&it, buf, sizeof(buf), &size) == 0) {
+        _pending += size;
+    }
+
+    _watermark_armed = (_watermark != 0);
+    _is_initialized = true;
+    _mutex.unlock();
+    return 0;
+}
+
+void LogShipper::log(const char *line)
+{
+    if (!_is_initialized) {
+        return;
+    }
+
+    uint8_t record[4 + MBED_CONF_LOGSHIP_MAX_RECORD];
+    uint32_t now = (uint32_t) time(NULL);
+    size_t len = strlen(line);
+    if (len > MBED_CONF_LOGSHIP_MAX_RECORD - 4) {
+        len = MBED_CONF_LOGSHIP_MAX_RECORD - 4;
+    }
+    memcpy(record, &now, 4);
+    memcpy(record + 4, line, len);
+
+    if (_ring->append(record, 4 + len)) {
+        // A line the ring cannot take is dropped - logging must never
+        // block or fail the caller
+        return;
+    }
+
+    _mutex.lock();
+    _pending += 4 + len;
+    bool fire = _watermark_armed && _watermark && (_pending >= _watermark);
+    if (fire) {
+        _watermark_armed = false;
+    }
+    _mutex.unlock();
+
+    if (fire && _ready) {
+        _ready();
+    }
+}
+
+static int send_all(mbed::Callback<ssize_t(const void *, size_t)> &send,
+                    const uint8_t *data, size_t size)
+{
+    while (size) {
+        ssize_t sent = send(data, size);
+        if (sent < 0) {
+            return sent;
+        }
+        if (sent == 0) {
+            return -EIO;
+        }
+        data += sent;
+        size -= sent;
+    }
+    return 0;
+}
+
+ssize_t LogShipper::ship(mbed::Callback<ssize_t(const void *, size_t)> send)
+{
+    _mutex.lock();
+    if (!_is_initialized) {
+        _mutex.unlock();
+        return -EINVAL;
+    }
+
+    LogRing::iterator_t it;
+    int err = _ring->iterate_open(&it, _shipped_seq + 1);
+    if (err) {
+        _mutex.unlock();
+        return err;
+    }
+
+    // Stage records as 16-bit length plus payload until the batch fills
+    size_t raw_size = 0;
+    uint16_t count = 0;
+    uint32_t first_seq = 0;
+    uint32_t last_seq = _shipped_seq;
+    while (raw_size + 2 < MBED_CONF_LOGSHIP_BATCH_SIZE) {
+        size_t size;
+        uint32_t seq;
+        err = _ring->iterate_next(&it, _raw + raw_size + 2,
+                                  MBED_CONF_LOGSHIP_BATCH_SIZE - raw_size - 2,
+                                  &size, &seq);
+        if (err == -ENODATA) {
+            break;
+        }
+        if (err == -EINVAL) {
+            // Next record does not fit in what is left of the batch
+            break;
+        }
+        if (err) {
+            _mutex.unlock();
+            return err;
+        }
+        _raw[raw_size] = size & 0xff;
+        _raw[raw_size + 1] = size >> 8;
+        raw_size += 2 + size;
+        count++;
+        if (!first_seq) {
+            first_seq = seq;
+        }
+        last_seq = seq;
+    }
+
+    if (!count) {
+        _mutex.unlock();
+        return 0;
+    }
+
+    // Compress when it wins; logs usually halve, binary-ish lines ship raw
+    const uint8_t *payload = _raw;
+    size_t wire_size = raw_size;
+    uint8_t flags = 0;
+    size_t packed = lzss_compress(_raw, raw_size, _packed, raw_size - 1);
+    if (packed) {
+        payload = _packed;
+        wire_size = packed;
+        flags = batch_flag_compressed;
+    }
+
+    batch_header_t header;
+    header.magic = batch_magic;
+    header.version = batch_version;
+    header.flags = flags;
+    header.count = count;
+    header.first_seq = first_seq;
+    header.raw_size = raw_size;
+    header.wire_size = wire_size;
+
+    err = send_all(send, (const uint8_t *) &header, sizeof(header));
+    if (!err) {
+        err = send_all(send, payload, wire_size);
+    }
+    if (err) {
+        // The batch stays queued and is retried whole - the collector
+        // deduplicates by sequence number
+        _mutex.unlock();
+        return err;
+    }
+
+    _shipped_seq = last_seq;
+    size_t shipped_payload = raw_size - 2 * count;
+    _pending = (_pending > shipped_payload) ? _pending - shipped_payload : 0;
+    if (_watermark && (_pending < _watermark)) {
+        _watermark_armed = true;
+    }
+    _ring->discard(_shipped_seq);
+    _mutex.unlock();
+    return count;
+}
+
+size_t LogShipper::pending_bytes()
+{
+    _mutex.lock();
+    size_t pending = _pending;
+    _mutex.unlock();
+    return pending;
+}
+
+void LogShipper::set_watermark(size_t bytes, mbed::Callback<void()> ready)
+{
+    _mutex.lock();
+    _watermark = bytes;
+    _ready = ready;
+    _watermark_armed = (bytes != 0);
+    _mutex.unlock();
+}
+
+void LogShipper::set_default(LogShipper *shipper)
+{
+    _default = shipper;
+}
+
+void LogShipper::trace_print(const char *line)
+{
+    if (_default) {
+        _default->log(line);
+    }
+}
+
+} // namespace mbed
@@ -0,0 +1,208 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_DELTA_UPDATER_H
+#define MBED_DELTA_UPDATER_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "drivers/FlashIAP.h"
+#include "drivers/MbedCRC.h"
+#include "platform/NonCopyable.h"
+
+namespace mbed {
+
+/** \addtogroup storage */
+/** @{*/
+
+/* Bytes moved per internal copy step; the dominant RAM cost besides one
+ * flash program page. */
+#ifndef MBED_CONF_UPDATE_DELTA_WINDOW
+#define MBED_CONF_UPDATE_DELTA_WINDOW 512
+#endif
+
+/* Output bytes between resume checkpoints when a progress key is set.
+ * Smaller means less re-download after a power cut, at more KVStore
+ * wear. */
+#ifndef MBED_CONF_UPDATE_DELTA_CHECKPOINT_INTERVAL
+#define MBED_CONF_UPDATE_DELTA_CHECKPOINT_INTERVAL 16384
+#endif
+
+/** Apply a streamed binary delta to build a firmware candidate in flash.
+ *
+ * Full-image OTA over a constrained link costs tens of minutes; a delta
+ * against the running image is typically 10x smaller. DeltaUpdater
+ * consumes a delta produced by tools/update/mbed_delta.py chunk by
+ * chunk, as the chunks arrive from the network - application overlaps
+ * with download - reading the base image through FlashIAP and writing
+ * the candidate slot, with RAM bounded by one copy window plus one
+ * program page (a few KB).
+ *
+ * @code
+ * FlashIAP flash;
+ * flash.init();
+ * DeltaUpdater updater(&flash, BASE_ADDR, CANDIDATE_ADDR,
+ *                      CANDIDATE_SIZE, "/kv/fw_delta");
+ * uint32_t offset = 0;
+ * updater.resume(&offset);                 // 0 on a fresh start
+ * download_from(offset);
+ * while (int n = next_chunk(buf)) {
+ *     if (updater.write(buf, n) != DELTA_OK) { abort_update(); }
+ * }
+ * if (updater.finish() == DELTA_OK) { mark_candidate_ready(); }
+ * @endcode
+ *
+ * The delta is a stream of copy commands (ranges of the base image) and
+ * literal runs, headed by the sizes and CRCs of both images. The base
+ * CRC is verified before the first flash write, so a delta built
+ * against the wrong firmware version fails fast and harmlessly; the
+ * candidate CRC is verified in finish(). The format is deliberately
+ * simple enough to apply with bounded memory - no decompression
+ * window - which is the constraint that rules out raw bsdiff patches
+ * on this class of device.
+ *
+ * With a progress key, state checkpoints to KVStore every
+ * MBED_CONF_UPDATE_DELTA_CHECKPOINT_INTERVAL output bytes; after a
+ * reset, resume() restores it and reports the delta offset to continue
+ * downloading from. finish() clears the checkpoint.
+ *
+ * @note Synchronization level: Not protected - one updater, one
+ *       feeding context.
+ */
+
+/** Result codes for DeltaUpdater operations. */
+enum delta_status_t {
+    DELTA_OK               = 0,
+    DELTA_ERROR_FORMAT     = -1,   /**< malformed or truncated delta */
+    DELTA_ERROR_BASE       = -2,   /**< base image does not match the delta's base CRC */
+    DELTA_ERROR_FLASH      = -3,   /**< FlashIAP read/erase/program failure */
+    DELTA_ERROR_SIZE       = -4,   /**< candidate image does not fit the slot */
+    DELTA_ERROR_VERIFY     = -5,   /**< rebuilt image fails the delta's CRC */
+    DELTA_ERROR_STATE      = -6,   /**< call out of sequence, or no checkpoint */
+};
+
+class DeltaUpdater : private NonCopyable<DeltaUpdater> {
+public:
+    /** Create an updater between two flash slots.
+     *
+     *  @param flash          Initialized FlashIAP covering both slots.
+     *  @param base_addr      Start of the running (base) image.
+     *  @param candidate_addr Start of the slot to build the new image in.
+     *  @param candidate_size Size of that slot in bytes.
+     *  @param progress_key   KVStore key for resume checkpoints, or NULL
+     *                        to disable persistence.
+     */
+    DeltaUpdater(FlashIAP *flash, uint32_t base_addr,
+                 uint32_t candidate_addr, uint32_t candidate_size,
+                 const char *progress_key = nullptr);
+
+    ~DeltaUpdater();
+
+    /** Restore a checkpoint left by an interrupted update.
+     *
+     * Call before the first write(). With no usable checkpoint the
+     * updater starts fresh and *stream_offset is 0; otherwise feed the
+     * delta from *stream_offset onwards.
+     *
+     *  @param stream_offset Receives the delta offset to resume from.
+     *  @return DELTA_OK either way; DELTA_ERROR_STATE after writes began.
+     */
+    int resume(uint32_t *stream_offset);
+
+    /** Consume the next chunk of the delta stream.
+     *
+     *  @param data Delta bytes, starting where the last call ended.
+     *  @param size Chunk size.
+     *  @return DELTA_OK, or a delta_status_t error; the update is dead
+     *          after an error.
+     */
+    int write(const void *data, size_t size);
+
+    /** Check whether the whole delta has been consumed. */
+    bool done() const;
+
+    /** Flush, verify the rebuilt image and clear the checkpoint.
+     *
+     *  @return DELTA_OK when the candidate slot holds the image the
+     *          delta promised, or a delta_status_t error.
+     */
+    int finish();
+
+    /** Get the number of candidate bytes produced so far. */
+    uint32_t output_size() const;
+
+private:
+    enum state_t {
+        STATE_HEADER,
+        STATE_OP,
+        STATE_VARINT,
+        STATE_ADD,
+        STATE_DONE,
+        STATE_ERROR,
+    };
+
+    int parse_header();
+    int verify_base();
+    int do_copy(uint32_t offset, uint32_t length);
+    int output(const uint8_t *data, size_t size);
+    int flush_page(bool pad);
+    int ensure_erased(uint32_t end_addr);
+    void checkpoint();
+    int fail(int error);
+
+    FlashIAP *_flash;
+    uint32_t _base_addr;
+    uint32_t _candidate_addr;
+    uint32_t _candidate_size;
+    const char *_progress_key;
+
+    MbedCRC<POLY_32BIT_ANSI, 32> _crc;
+
+    uint8_t *_page;             /* one program page accumulating output */
+    uint8_t *_ckpt;             /* checkpoint blob, with a progress key */
+    uint32_t _page_size;
+    uint32_t _page_fill;
+    uint8_t _window[MBED_CONF_UPDATE_DELTA_WINDOW];
+
+    state_t _state;
+    uint8_t _header[20];
+    uint32_t _header_fill;
+    uint8_t _op;
+    uint32_t _varint;
+    uint32_t _varint_shift;
+    int _varints_needed;
+    uint32_t _args[2];
+
+    uint32_t _new_size;
+    uint32_t _base_size;
+    uint32_t _base_crc;
+    uint32_t _new_crc;
+
+    uint32_t _stream_off;
+    uint32_t _out_off;
+    uint32_t _out_addr;
+    uint32_t _erased_until;
+    uint32_t _crc_state;
+    uint32_t _last_checkpoint;
+    bool _started;
+};
+
+/** @}*/
+
+} // namespace mbed
+
+#endif
@@ -0,0 +1,422 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2021 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "update/DeltaUpdater.h"
+
+#include <string.h>
+
+#include "kvstore_global_api.h"
+#include "platform/mbed_assert.h"
+
+namespace mbed {
+
+/* Delta stream layout, shared with tools/update/mbed_delta.py:
+ *
+ *   header: "MDT1", new_size, base_size, base_crc32, new_crc32 (LE u32s)
+ *   commands: 0x01 copy  <varint base_offset> <varint length>
+ *             0x02 add   <varint length> <length literal bytes>
+ *             0x00 end
+ *
+ * Varints are LEB128. CRCs are standard (zlib) CRC-32.
+ */
+#define DELTA_MAGIC_0 'M'
+#define DELTA_MAGIC_1 'D'
+#define DELTA_MAGIC_2 'T'
+#define DELTA_MAGIC_3 '1'
+
+#define DELTA_OP_END  0x00
+#define DELTA_OP_COPY 0x01
+#define DELTA_OP_ADD  0x02
+
+/* Resume checkpoint: fixed fields then the partial program page. */
+#define CKPT_MAGIC 0x5250444du  /* "MDPR" */
+#define CKPT_WORDS 11
+
+static uint32_t read_le32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+           ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+DeltaUpdater::DeltaUpdater(FlashIAP *flash, uint32_t base_addr,
+                           uint32_t candidate_addr, uint32_t candidate_size,
+                           const char *progress_key)
+    : _flash(flash), _base_addr(base_addr),
+      _candidate_addr(candidate_addr), _candidate_size(candidate_size),
+      _progress_key(progress_key),
+      _crc(),
+      _page(nullptr), _ckpt(nullptr), _page_size(0), _page_fill(0),
+      _state(STATE_HEADER), _header_fill(0),
+      _op(0), _varint(0), _varint_shift(0), _varints_needed(0),
+      _new_size(0), _base_size(0), _base_crc(0), _new_crc(0),
+      _stream_off(0), _out_off(0), _out_addr(candidate_addr),
+      _erased_until(candidate_addr), _crc_state(0),
+      _last_checkpoint(0), _started(false)
+{
+    MBED_ASSERT(flash && candidate_size);
+    _page_size = _flash->get_page_size();
+    if (_page_size < 4) {
+        _page_size = 4;     /* byte-programmable parts: batch a little */
+    }
+    _page = new uint8_t[_page_size];
+    if (_progress_key) {
+        _ckpt = new uint8_t[CKPT_WORDS * 4 + _page_size];
+    }
+    _args[0] = _args[1] = 0;
+}
+
+DeltaUpdater::~DeltaUpdater()
+{
+    delete[] _page;
+    delete[] _ckpt;
+}
+
+int DeltaUpdater::fail(int error)
+{
+    _state = STATE_ERROR;
+    return error;
+}
+
+int DeltaUpdater::resume(uint32_t *stream_offset)
+{
+    *stream_offset = 0;
+    if (_started) {
+        return DELTA_ERROR_STATE;
+    }
+    if (!_progress_key) {
+        return DELTA_OK;
+    }
+
+    size_t actual = 0;
+    if (kv_get(_progress_key, _ckpt, CKPT_WORDS * 4 + _page_size,
+               &actual) != 0 || actual < CKPT_WORDS * 4) {
+        return DELTA_OK;    /* no (usable) checkpoint: fresh start */
+    }
+    uint32_t fields[CKPT_WORDS];
+    for (int i = 0; i < CKPT_WORDS; i++) {
+        fields[i] = read_le32(_ckpt + 4 * i);
+    }
+    if (fields[0] != CKPT_MAGIC || fields[10] >= _page_size ||
+            actual != CKPT_WORDS * 4 + fields[10]) {
+        return DELTA_OK;
+    }
+
+    _new_size = fields[1];
+    _base_size = fields[2];
+    _base_crc = fields[3];
+    _new_crc = fields[4];
+    _stream_off = fields[5];
+    _out_off = fields[6];
+    _out_addr = fields[7];
+    _erased_until = fields[8];
+    _crc_state = fields[9];
+    _page_fill = fields[10];
+    memcpy(_page, _ckpt + CKPT_WORDS * 4, _page_fill);
+    _last_checkpoint = _out_off;
+    _state = STATE_OP;
+    *stream_offset = _stream_off;
+    return DELTA_OK;
+}
+
+void DeltaUpdater::checkpoint()
+{
+    if (!_progress_key) {
+        return;
+    }
+    /* Checkpoints land on command boundaries, so the parser state is a
+     * handful of words plus whatever output is still short of a page */
+    uint32_t fields[CKPT_WORDS] = {
+        CKPT_MAGIC, _new_size, _base_size, _base_crc, _new_crc,
+        _stream_off, _out_off, _out_addr, _erased_until, _crc_state,
+        _page_fill,
+    };
+    for (int i = 0; i < CKPT_WORDS; i++) {
+        _ckpt[4 * i + 0] = (uint8_t)(fields[i]);
+        _ckpt[4 * i + 1] = (uint8_t)(fields[i] >> 8);
+        _ckpt[4 * i + 2] = (uint8_t)(fields[i] >> 16);
+        _ckpt[4 * i + 3] = (uint8_t)(fields[i] >> 24);
+    }
+    memcpy(_ckpt + CKPT_WORDS * 4, _page, _page_fill);
+    /* Best effort: a failed checkpoint only costs re-download distance */
+    kv_set(_progress_key, _ckpt, CKPT_WORDS * 4 + _page_fill, 0);
+    _last_checkpoint = _out_off;
+}
+
+int DeltaUpdater::parse_header()
+{
+    if (_header[0] != DELTA_MAGIC_0 || _header[1] != DELTA_MAGIC_1 ||
+            _header[2] != DELTA_MAGIC_2 || _header[3] != DELTA_MAGIC_3) {
+        return DELTA_ERROR_FORMAT;
+    }
+    _new_size = read_le32(_header + 4);
+    _base_size = read_le32(_header + 8);
+    _base_crc = read_le32(_header + 12);
+    _new_crc = read_le32(_header + 16);
+    if (_new_size == 0 || _new_size > _candidate_size) {
+        return DELTA_ERROR_SIZE;
+    }
+    int err = verify_base();
+    if (err) {
+        return err;
+    }
+    _crc.compute_partial_start(&_crc_state);
+    return DELTA_OK;
+}
+
+int DeltaUpdater::verify_base()
+{
+    /* A delta against the wrong base would build garbage; fail before
+     * the first erase, while the update is still perfectly abortable */
+    uint32_t crc = 0;
+    _crc.compute_partial_start(&crc);
+    uint32_t off = 0;
+    while (off < _base_size) {
+        uint32_t chunk = _base_size - off;
+        if (chunk > sizeof(_window)) {
+            chunk = sizeof(_window);
+        }
+        if (_flash->read(_window, _base_addr + off, chunk) != 0) {
+            return DELTA_ERROR_FLASH;
+        }
+        _crc.compute_partial(_window, chunk, &crc);
+        off += chunk;
+    }
+    _crc.compute_partial_stop(&crc);
+    return (crc == _base_crc) ? DELTA_OK : DELTA_ERROR_BASE;
+}
+
+int DeltaUpdater::ensure_erased(uint32_t end_addr)
+{
+    if (end_addr > _candidate_addr + _candidate_size) {
+        return DELTA_ERROR_SIZE;
+    }
+    while (_erased_until < end_addr) {
+        uint32_t sector = _flash->get_sector_size(_erased_until);
+        if (_flash->erase(_erased_until, sector) != 0) {
+            return DELTA_ERROR_FLASH;
+        }
+        _erased_until += sector;
+    }
+    return DELTA_OK;
+}
+
+int DeltaUpdater::flush_page(bool pad)
+{
+    if (_page_fill == 0) {
+        return DELTA_OK;
+    }
+    if (pad) {
+        memset(_page + _page_fill, 0xFF, _page_size - _page_fill);
+    }
+    MBED_ASSERT(pad || _page_fill == _page_size);
+    int err = ensure_erased(_out_addr + _page_size);
+    if (err) {
+        return err;
+    }
+    if (_flash->program(_page, _out_addr, _page_size) != 0) {
+        return DELTA_ERROR_FLASH;
+    }
+    _out_addr += _page_size;
+    _page_fill = 0;
+    return DELTA_OK;
+}
+
+int DeltaUpdater::output(const uint8_t *data, size_t size)
+{
+    if (_out_off + size > _new_size) {
+        return DELTA_ERROR_FORMAT;
+    }
+    _crc.compute_partial(data, size, &_crc_state);
+    _out_off += size;
+    while (size) {
+        uint32_t space = _page_size - _page_fill;
+        uint32_t take = (size < space) ? size : space;
+        memcpy(_page + _page_fill, data, take);
+        _page_fill += take;
+        data += take;
+        size -= take;
+        if (_page_fill == _page_size) {
+            int err = flush_page(false);
+            if (err) {
+                return err;
+            }
+        }
+    }
+    return DELTA_OK;
+}
+
+int DeltaUpdater::do_copy(uint32_t offset, uint32_t length)
+{
+    if (offset + length > _base_size || offset + length < offset) {
+        return DELTA_ERROR_FORMAT;
+    }
+    while (length) {
+        uint32_t chunk = (length < sizeof(_window)) ? length : sizeof(_window);
+        if (_flash->read(_window, _base_addr + offset, chunk) != 0) {
+            return DELTA_ERROR_FLASH;
+        }
+        int err = output(_window, chunk);
+        if (err) {
+            return err;
+        }
+        offset += chunk;
+        length -= chunk;
+    }
+    return DELTA_OK;
+}
+
+int DeltaUpdater::write(const void *data, size_t size)
+{
+    const uint8_t *p = static_cast<const uint8_t *>(data);
+    _started = true;
+
+    while (size) {
+        switch (_state) {
+            case STATE_HEADER: {
+                uint32_t need = sizeof(_header) - _header_fill;
+                uint32_t take = (size < need) ? size : need;
+                memcpy(_header + _header_fill, p, take);
+                _header_fill += take;
+                p += take;
+                size -= take;
+                _stream_off += take;
+                if (_header_fill == sizeof(_header)) {
+                    int err = parse_header();
+                    if (err) {
+                        return fail(err);
+                    }
+                    _state = STATE_OP;
+                }
+                break;
+            }
+
+            case STATE_OP:
+                _op = *p++;
+                size--;
+                _stream_off++;
+                if (_op == DELTA_OP_END) {
+                    _state = STATE_DONE;
+                } else if (_op == DELTA_OP_COPY || _op == DELTA_OP_ADD) {
+                    _varints_needed = (_op == DELTA_OP_COPY) ? 2 : 1;
+                    _varint = 0;
+                    _varint_shift = 0;
+                    _state = STATE_VARINT;
+                } else {
+                    return fail(DELTA_ERROR_FORMAT);
+                }
+                break;
+
+            case STATE_VARINT: {
+                uint8_t byte = *p++;
+                size--;
+                _stream_off++;
+                if (_varint_shift >= 32) {
+                    return fail(DELTA_ERROR_FORMAT);
+                }
+                _varint |= (uint32_t)(byte & 0x7F) << _varint_shift;
+                _varint_shift += 7;
+                if (byte & 0x80) {
+                    break;
+                }
+                _args[2 - _varints_needed] = _varint;
+                _varints_needed--;
+                _varint = 0;
+                _varint_shift = 0;
+                if (_varints_needed) {
+                    break;
+                }
+                if (_op == DELTA_OP_COPY) {
+                    int err = do_copy(_args[0], _args[1]);
+                    if (err) {
+                        return fail(err);
+                    }
+                    _state = STATE_OP;
+                    if (_out_off - _last_checkpoint >=
+                            MBED_CONF_UPDATE_DELTA_CHECKPOINT_INTERVAL) {
+                        checkpoint();
+                    }
+                } else {
+                    /* _args[1] holds the literal run length */
+                    _state = _args[1] ? STATE_ADD : STATE_OP;
+                }
+                break;
+            }
+
+            case STATE_ADD: {
+                uint32_t take = (size < _args[1]) ? size : _args[1];
+                int err = output(p, take);
+                if (err) {
+                    return fail(err);
+                }
+                p += take;
+                size -= take;
+                _stream_off += take;
+                _args[1] -= take;
+                if (_args[1] == 0) {
+                    _state = STATE_OP;
+                    if (_out_off - _last_checkpoint >=
+                            MBED_CONF_UPDATE_DELTA_CHECKPOINT_INTERVAL) {
+                        checkpoint();
+                    }
+                }
+                break;
+            }
+
+            case STATE_DONE:
+                return fail(DELTA_ERROR_FORMAT);    /* bytes after end */
+
+            case STATE_ERROR:
+            default:
+                return DELTA_ERROR_STATE;
+        }
+    }
+    return DELTA_OK;
+}
+
+bool DeltaUpdater::done() const
+{
+    return _state == STATE_DONE;
+}
+
+int DeltaUpdater::finish()
+{
+    if (_state != STATE_DONE) {
+        return DELTA_ERROR_STATE;
+    }
+    if (_out_off != _new_size) {
+        return fail(DELTA_ERROR_FORMAT);
+    }
+    int err = flush_page(true);
+    if (err) {
+        return fail(err);
+    }
+    _crc.compute_partial_stop(&_crc_state);
+    if (_crc_state != _new_crc) {
+        return fail(DELTA_ERROR_VERIFY);
+    }
+    if (_progress_key) {
+        kv_remove(_progress_key);
+    }
+    return DELTA_OK;
+}
+
+uint32_t DeltaUpdater::output_size() const
+{
+    return _out_off;
+}
+
+} // namespace mbed
@@ -0,0 +1,106 @@
+# Copyright (c) 2021 ARM Limited. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+# Link-time function-level code placement from a hot-function list.
+#
+# Parts with banked flash run code at very different speeds depending on
+# where the linker happens to put it: internal flash or ITCM is several
+# times faster than external QSPI, but the default placement follows link
+# order, not heat. This module consumes a plain-text list of hot function
+# names - gathered from the performance counters (mbed_perf_counters.h),
+# GNU profile data, or by inspection - and steers their placement at link
+# time, with no source changes.
+#
+# The list file contains one symbol per line; blank lines and lines
+# starting with '#' are ignored:
+#
+#     # hottest symbols from perf counter slots
+#     memcpy
+#     lwip_standard_chksum
+#     osRtxThreadSwitch
+#
+# Usage, from the application's CMakeLists.txt:
+#
+#     include(${MBED_PATH}/tools/cmake/mbed_code_placement.cmake)
+#     mbed_set_placement_profile(TARGET my-app HOT_LIST hot_functions.txt
+#                                REGION ITCM)
+#
+# With the GCC_ARM toolchain a linker script fragment is generated that
+# collects each listed function's -ffunction-sections input section (and
+# anything placed in .text.mbed_hot by hand) into a .text.hot output
+# section, inserted before .text. When REGION names a memory region from
+# the target's linker script, .text.hot is placed there; without REGION
+# the hot functions are still grouped at the front of flash, which keeps
+# them on a minimum of fast pages and cache lines.
+#
+# With the ARM toolchain armlink has no script-fragment mechanism, so the
+# list becomes a --symbol_ordering_file: hot symbols are emitted first and
+# fill the scatter file's first (fast) execution region before cold code.
+# REGION is ignored there.
+
+function(mbed_set_placement_profile)
+    set(options)
+    set(single_args TARGET HOT_LIST REGION)
+    set(multi_args)
+    cmake_parse_arguments(PLACEMENT "${options}" "${single_args}" "${multi_args}" ${ARGN})
+
+    if(NOT PLACEMENT_TARGET OR NOT PLACEMENT_HOT_LIST)
+        message(FATAL_ERROR "mbed_set_placement_profile: TARGET and HOT_LIST are required")
+    endif()
+
+    get_filename_component(hot_list "${PLACEMENT_HOT_LIST}" ABSOLUTE BASE_DIR "${CMAKE_CURRENT_SOURCE_DIR}")
+    if(NOT EXISTS "${hot_list}")
+        message(FATAL_ERROR "mbed_set_placement_profile: hot-function list '${hot_list}' not found")
+    endif()
+
+    # re-run configuration when the profile changes
+    set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS "${hot_list}")
+
+    file(STRINGS "${hot_list}" hot_lines)
+    set(hot_symbols)
+    foreach(line IN LISTS hot_lines)
+        string(STRIP "${line}" line)
+        if(line AND NOT line MATCHES "^#")
+            list(APPEND hot_symbols "${line}")
+        endif()
+    endforeach()
+
+    if(NOT hot_symbols)
+        message(WARNING "mbed_set_placement_profile: '${hot_list}' lists no symbols; placement unchanged")
+        return()
+    endif()
+
+    if(MBED_TOOLCHAIN STREQUAL "GCC_ARM")
+        # Collect the hot input sections into one output section. The
+        # fragment relies on -ffunction-sections, which the Mbed profiles
+        # always set.
+        set(fragment "${CMAKE_CURRENT_BINARY_DIR}/${PLACEMENT_TARGET}_hot_placement.ld")
+        set(content "/* Generated by mbed_set_placement_profile() from ${hot_list} */\n")
+        string(APPEND content "SECTIONS\n{\n")
+        string(APPEND content "    .text.hot :\n    {\n")
+        string(APPEND content "        . = ALIGN(4);\n")
+        string(APPEND content "        *(.text.mbed_hot)\n")
+        foreach(symbol IN LISTS hot_symbols)
+            string(APPEND content "        *(.text.${symbol})\n")
+        endforeach()
+        string(APPEND content "        . = ALIGN(4);\n")
+        if(PLACEMENT_REGION)
+            string(APPEND content "    } > ${PLACEMENT_REGION}\n")
+        else()
+            string(APPEND content "    }\n")
+        endif()
+        string(APPEND content "} INSERT BEFORE .text;\n")
+        file(GENERATE OUTPUT "${fragment}" CONTENT "${content}")
+        target_link_options(${PLACEMENT_TARGET} PRIVATE "-T${fragment}")
+    elseif(MBED_TOOLCHAIN STREQUAL "ARM")
+        if(PLACEMENT_REGION)
+            message(WARNING "mbed_set_placement_profile: REGION is not supported with armlink; hot symbols are ordered first instead")
+        endif()
+        set(ordering "${CMAKE_CURRENT_BINARY_DIR}/${PLACEMENT_TARGET}_symbol_ordering.txt")
+        list(JOIN hot_symbols "\n" content)
+        file(GENERATE OUTPUT "${ordering}" CONTENT "${content}\n")
+        target_link_options(${PLACEMENT_TARGET} PRIVATE "LINKER:--symbol_ordering_file=${ordering}")
+    else()
+        message(WARNING "mbed_set_placement_profile: no placement support for toolchain '${MBED_TOOLCHAIN}'")
+    endif()
+endfunction()
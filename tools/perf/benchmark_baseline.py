@@ -0,0 +1,159 @@
+#!/usr/bin/env python3
+# Copyright (c) 2021 ARM Limited. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+"""Per-target performance baselines for mbed-benchmark greentea runs.
+
+Benchmark tests built on features/frameworks/mbed-benchmark emit one
+key-value pair per benchmark through the greentea protocol:
+
+    {{benchmark;<name>;<median>;<p99>}}
+
+This tool gives those numbers a memory. It scrapes them out of a
+greentea/htrun console log, keeps a JSON baseline per target under
+tools/perf/baselines/, and fails a run whose median regresses past a
+threshold - so a 10% Mutex slowdown blocks the PR that caused it
+instead of shipping.
+
+Typical CI wiring:
+
+    mbedhtrun ... | tee run.log
+    python3 tools/perf/benchmark_baseline.py check --target K64F --log run.log
+
+    # after a reviewed, intentional change in performance:
+    python3 tools/perf/benchmark_baseline.py update --target K64F --log run.log
+
+The default threshold is 10%; override it globally with --threshold or
+per benchmark with a "threshold" key on the baseline entry. Benchmarks
+absent from the baseline pass with a notice - run "update" to adopt
+them. Units (cycles with a DWT, microseconds without) are stable for a
+given target, which is why baselines are per-target.
+"""
+
+import argparse
+import json
+import re
+import sys
+from datetime import datetime, timezone
+from pathlib import Path
+
+DEFAULT_BASELINE_DIR = Path(__file__).parent / "baselines"
+DEFAULT_THRESHOLD = 10.0
+
+KV_RE = re.compile(r"\{\{benchmark;([^;{}]+);(-?\d+);(-?\d+)\}\}")
+
+
+def parse_log(stream):
+    """Return {name: {"median": int, "p99": int}} from a console log."""
+    results = {}
+    for line in stream:
+        for match in KV_RE.finditer(line):
+            name, median, p99 = match.groups()
+            results[name] = {"median": int(median), "p99": int(p99)}
+    return results
+
+
+def baseline_path(directory, target):
+    return Path(directory) / ("%s.json" % target.upper())
+
+
+def load_baseline(path):
+    if not path.exists():
+        return {"benchmarks": {}}
+    with open(path) as fh:
+        return json.load(fh)
+
+
+def cmd_update(args, results):
+    path = baseline_path(args.baselines, args.target)
+    baseline = load_baseline(path)
+    for name, numbers in results.items():
+        entry = baseline["benchmarks"].setdefault(name, {})
+        entry["median"] = numbers["median"]
+        entry["p99"] = numbers["p99"]
+    baseline["updated"] = datetime.now(timezone.utc).strftime("%Y-%m-%d %H:%M:%SZ")
+    path.parent.mkdir(parents=True, exist_ok=True)
+    with open(path, "w") as fh:
+        json.dump(baseline, fh, indent=2, sort_keys=True)
+        fh.write("\n")
+    print("updated %s with %d benchmark(s)" % (path, len(results)))
+    return 0
+
+
+def cmd_check(args, results):
+    path = baseline_path(args.baselines, args.target)
+    baseline = load_baseline(path)["benchmarks"]
+
+    regressions = []
+    new = []
+    print("%-32s %10s %10s %8s" % ("benchmark", "baseline", "measured", "delta"))
+    for name in sorted(results):
+        measured = results[name]["median"]
+        entry = baseline.get(name)
+        if entry is None:
+            new.append(name)
+            print("%-32s %10s %10d %8s" % (name, "-", measured, "new"))
+            continue
+        base = entry["median"]
+        delta = 100.0 * (measured - base) / base if base else 0.0
+        threshold = float(entry.get("threshold", args.threshold))
+        flag = ""
+        if delta > threshold:
+            regressions.append((name, base, measured, delta, threshold))
+            flag = "  REGRESSION (>%g%%)" % threshold
+        elif delta < -threshold:
+            flag = "  improved - consider update"
+        print("%-32s %10d %10d %+7.1f%%%s" % (name, base, measured, delta, flag))
+
+    if new:
+        print("%d new benchmark(s) without a baseline; run 'update' to adopt them"
+              % len(new))
+    if regressions:
+        print("FAILED: %d benchmark(s) regressed past their threshold on %s"
+              % (len(regressions), args.target.upper()))
+        return 1
+    print("OK: no regressions on %s" % args.target.upper())
+    return 0
+
+
+def cmd_show(args, _results):
+    path = baseline_path(args.baselines, args.target)
+    baseline = load_baseline(path)
+    if not baseline["benchmarks"]:
+        print("no baseline recorded for %s" % args.target.upper())
+        return 1
+    print(json.dumps(baseline, indent=2, sort_keys=True))
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("command", choices=["check", "update", "show"],
+                        help="compare against, rewrite, or print the baseline")
+    parser.add_argument("--target", required=True,
+                        help="target name the baseline belongs to (e.g. K64F)")
+    parser.add_argument("--log", default=None,
+                        help="console log to scrape; '-' or omitted reads stdin "
+                             "(not needed for 'show')")
+    parser.add_argument("--baselines", default=str(DEFAULT_BASELINE_DIR),
+                        help="baseline directory (default: %(default)s)")
+    parser.add_argument("--threshold", type=float, default=DEFAULT_THRESHOLD,
+                        help="regression threshold in percent (default: %(default)s)")
+    args = parser.parse_args()
+
+    results = {}
+    if args.command != "show":
+        if args.log and args.log != "-":
+            with open(args.log) as fh:
+                results = parse_log(fh)
+        else:
+            results = parse_log(sys.stdin)
+        if not results:
+            print("no {{benchmark;...}} records found in the log")
+            return 1
+
+    return {"check": cmd_check, "update": cmd_update, "show": cmd_show}[args.command](args, results)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+# Copyright (c) 2021 ARM Limited. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+"""Fold SamplingProfiler output into flame-graph input using the ELF.
+
+drivers/SamplingProfiler captures the program counter (optionally with
+the link register) of interrupted thread code into a ring the device
+drains over its remote channel. This tool symbolizes those addresses
+against the matching ELF and emits collapsed-stack lines -
+"caller;leaf count" - the format flamegraph.pl and speedscope consume:
+
+    python3 tools/perf/flamegraph_fold.py samples.bin --elf app.elf --lr \\
+        | flamegraph.pl > profile.svg
+
+Input is either raw little-endian 32-bit words (--format bin, the
+profiler's native read() output) or one hex word per line (--format
+hex, convenient over a console). With --lr each sample is a [pc, lr]
+pair and the fold gains one caller frame; without it samples are bare
+leaves.
+
+Symbolization shells out to nm (--nm to point at arm-none-eabi-nm) so
+there is no python dependency beyond the standard library. Addresses
+that fall outside any symbol - stale ELF, samples from RAM-copied
+code - fold into "[unknown]"; more than a few percent of those usually
+means the ELF does not match the firmware.
+"""
+
+import argparse
+import bisect
+import struct
+import subprocess
+import sys
+from collections import Counter
+
+SYMBOL_TYPES = set("tTwW")  # text symbols, weak included
+
+
+def load_symbols(elf, nm):
+    out = subprocess.check_output([nm, "--print-size", elf], text=True)
+    symbols = []
+    for line in out.splitlines():
+        parts = line.split()
+        if len(parts) == 4 and parts[2] in SYMBOL_TYPES:
+            addr, size, _, name = parts
+            symbols.append((int(addr, 16), int(size, 16), name))
+        elif len(parts) == 3 and parts[1] in SYMBOL_TYPES:
+            symbols.append((int(parts[0], 16), 0, parts[2]))
+    symbols.sort()
+    return symbols
+
+
+def symbolize(symbols, starts, address):
+    # Thumb code: bit 0 of a captured LR/PC copy is the state bit
+    address &= ~1
+    i = bisect.bisect_right(starts, address) - 1
+    if i < 0:
+        return "[unknown]"
+    start, size, name = symbols[i]
+    if not size:
+        # sizeless symbol (assembly, crt): bound it by its neighbour
+        size = starts[i + 1] - start if i + 1 < len(starts) else 0
+    if not size or address >= start + size:
+        return "[unknown]"
+    return name
+
+
+def read_words(stream, fmt):
+    if fmt == "bin":
+        raw = stream.buffer.read() if hasattr(stream, "buffer") else stream.read()
+        count = len(raw) // 4
+        return list(struct.unpack("<%dI" % count, raw[:count * 4]))
+    words = []
+    for line in stream:
+        line = line.strip().rstrip(",")
+        if line:
+            words.append(int(line, 16))
+    return words
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("samples", help="sample file from the device, '-' for stdin")
+    parser.add_argument("--elf", required=True, help="ELF matching the firmware")
+    parser.add_argument("--lr", action="store_true",
+                        help="samples are [pc, lr] pairs (profiler capture_lr)")
+    parser.add_argument("--format", choices=["bin", "hex"], default="bin",
+                        help="raw little-endian words or one hex word per line")
+    parser.add_argument("--nm", default="arm-none-eabi-nm",
+                        help="nm binary to symbolize with (default: %(default)s)")
+    args = parser.parse_args()
+
+    symbols = load_symbols(args.elf, args.nm)
+    if not symbols:
+        print("no text symbols in %s" % args.elf, file=sys.stderr)
+        return 1
+    starts = [s[0] for s in symbols]
+
+    if args.samples == "-":
+        words = read_words(sys.stdin, args.format)
+    else:
+        mode = "rb" if args.format == "bin" else "r"
+        with open(args.samples, mode) as fh:
+            words = read_words(fh, args.format)
+
+    stride = 2 if args.lr else 1
+    if len(words) % stride:
+        words = words[:-(len(words) % stride)]  # trailing half pair from a split read
+    if not words:
+        print("no samples", file=sys.stderr)
+        return 1
+
+    stacks = Counter()
+    unknown = 0
+    for i in range(0, len(words), stride):
+        leaf = symbolize(symbols, starts, words[i])
+        if leaf == "[unknown]":
+            unknown += 1
+        if args.lr:
+            caller = symbolize(symbols, starts, words[i + 1])
+            stacks["%s;%s" % (caller, leaf)] += 1
+        else:
+            stacks[leaf] += 1
+
+    for stack, count in stacks.most_common():
+        print("%s %d" % (stack, count))
+
+    total = len(words) // stride
+    print("%d samples, %d unsymbolized" % (total, unknown), file=sys.stderr)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,229 @@
+#!/usr/bin/env python3
+# Copyright (c) 2021 ARM Limited. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+"""Build and inspect firmware deltas for storage/update/DeltaUpdater.
+
+A delta rebuilds new.bin on the device by copying ranges of the base
+image already in flash and splicing in literal bytes for whatever
+changed, so only the differences travel over the link:
+
+    python3 tools/update/mbed_delta.py create base.bin new.bin fw.delta
+    python3 tools/update/mbed_delta.py info fw.delta
+    python3 tools/update/mbed_delta.py apply base.bin fw.delta out.bin
+
+"apply" is a reference applier for checking a delta on the host; the
+device-side equivalent is mbed::DeltaUpdater.
+
+Stream format (little-endian, shared with DeltaUpdater.cpp):
+
+    header: "MDT1", new_size, base_size, base_crc32, new_crc32
+    commands: 0x01 copy <varint base_offset> <varint length>
+              0x02 add  <varint length> <literal bytes>
+              0x00 end
+
+Varints are LEB128, CRCs standard (zlib) CRC-32. The format is plain
+copy/add - no compression window - so the device applies it with a few
+KB of RAM; deltas for typical incremental releases still come out
+around a tenth of the image.
+"""
+
+import argparse
+import struct
+import sys
+import zlib
+
+MAGIC = b"MDT1"
+OP_END = 0x00
+OP_COPY = 0x01
+OP_ADD = 0x02
+
+# Granularity of the base-image index. Matches shorter than roughly
+# twice this are not worth a copy command's overhead anyway.
+BLOCK = 16
+
+
+def write_varint(out, value):
+    while True:
+        byte = value & 0x7F
+        value >>= 7
+        if value:
+            out.append(byte | 0x80)
+        else:
+            out.append(byte)
+            return
+
+
+def read_varint(data, pos):
+    value = shift = 0
+    while True:
+        byte = data[pos]
+        pos += 1
+        value |= (byte & 0x7F) << shift
+        shift += 7
+        if not byte & 0x80:
+            return value, pos
+
+
+def index_base(base):
+    index = {}
+    for off in range(0, len(base) - BLOCK + 1, BLOCK):
+        # keep the first occurrence: lowest offsets give shortest varints
+        index.setdefault(base[off:off + BLOCK], off)
+    return index
+
+
+def extend_match(base, new, base_off, new_off, length):
+    """Grow a seed match in both directions as far as the bytes agree."""
+    while (base_off > 0 and new_off > 0 and
+           base[base_off - 1] == new[new_off - 1]):
+        base_off -= 1
+        new_off -= 1
+        length += 1
+    end = min(len(base) - base_off, len(new) - new_off)
+    while (length < end and
+           base[base_off + length] == new[new_off + length]):
+        length += 1
+    return base_off, new_off, length
+
+
+def emit_add(out, literal):
+    if literal:
+        out.append(OP_ADD)
+        write_varint(out, len(literal))
+        out += literal
+        del literal[:]
+
+
+def create(base, new):
+    index = index_base(base)
+    out = bytearray(MAGIC)
+    out += struct.pack("<IIII", len(new), len(base),
+                       zlib.crc32(base) & 0xFFFFFFFF,
+                       zlib.crc32(new) & 0xFFFFFFFF)
+
+    literal = bytearray()
+    pos = 0
+    while pos + BLOCK <= len(new):
+        base_off = index.get(bytes(new[pos:pos + BLOCK]))
+        if base_off is None:
+            literal.append(new[pos])
+            pos += 1
+            continue
+        base_off, new_off, length = extend_match(base, new, base_off, pos, BLOCK)
+        # backward extension may eat bytes already queued as literals
+        del literal[len(literal) - (pos - new_off):]
+        emit_add(out, literal)
+        out.append(OP_COPY)
+        write_varint(out, base_off)
+        write_varint(out, length)
+        pos = new_off + length
+    literal += new[pos:]
+    emit_add(out, literal)
+    out.append(OP_END)
+    return bytes(out)
+
+
+def parse_header(delta):
+    if len(delta) < 20 or delta[:4] != MAGIC:
+        sys.exit("not an MDT1 delta")
+    return struct.unpack("<IIII", delta[4:20])
+
+
+def apply_delta(base, delta):
+    new_size, base_size, base_crc, new_crc = parse_header(delta)
+    if len(base) != base_size or zlib.crc32(base) & 0xFFFFFFFF != base_crc:
+        sys.exit("base image does not match the delta")
+    out = bytearray()
+    pos = 20
+    while True:
+        op = delta[pos]
+        pos += 1
+        if op == OP_END:
+            break
+        elif op == OP_COPY:
+            offset, pos = read_varint(delta, pos)
+            length, pos = read_varint(delta, pos)
+            out += base[offset:offset + length]
+        elif op == OP_ADD:
+            length, pos = read_varint(delta, pos)
+            out += delta[pos:pos + length]
+            pos += length
+        else:
+            sys.exit("bad opcode 0x%02x at %d" % (op, pos - 1))
+    if len(out) != new_size or zlib.crc32(bytes(out)) & 0xFFFFFFFF != new_crc:
+        sys.exit("rebuilt image fails verification")
+    return bytes(out)
+
+
+def info(delta):
+    new_size, base_size, base_crc, new_crc = parse_header(delta)
+    copies = adds = literal_bytes = 0
+    pos = 20
+    while delta[pos] != OP_END:
+        op = delta[pos]
+        pos += 1
+        if op == OP_COPY:
+            _, pos = read_varint(delta, pos)
+            _, pos = read_varint(delta, pos)
+            copies += 1
+        elif op == OP_ADD:
+            length, pos = read_varint(delta, pos)
+            pos += length
+            adds += 1
+            literal_bytes += length
+        else:
+            sys.exit("bad opcode 0x%02x at %d" % (op, pos - 1))
+    print("base: %d bytes, crc32 %08x" % (base_size, base_crc))
+    print("new:  %d bytes, crc32 %08x" % (new_size, new_crc))
+    print("delta: %d bytes (%.1f%% of new image)" %
+          (len(delta), 100.0 * len(delta) / new_size if new_size else 0))
+    print("%d copy commands, %d literal runs (%d literal bytes)" %
+          (copies, adds, literal_bytes))
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    sub = parser.add_subparsers(dest="command", required=True)
+
+    p = sub.add_parser("create", help="build a delta from base to new image")
+    p.add_argument("base")
+    p.add_argument("new")
+    p.add_argument("delta")
+
+    p = sub.add_parser("apply", help="rebuild the new image on the host")
+    p.add_argument("base")
+    p.add_argument("delta")
+    p.add_argument("out")
+
+    p = sub.add_parser("info", help="summarize a delta")
+    p.add_argument("delta")
+
+    args = parser.parse_args()
+
+    if args.command == "create":
+        with open(args.base, "rb") as fh:
+            base = fh.read()
+        with open(args.new, "rb") as fh:
+            new = fh.read()
+        delta = create(base, new)
+        with open(args.delta, "wb") as fh:
+            fh.write(delta)
+        print("%d -> %d delta bytes (%.1f%%)" %
+              (len(new), len(delta),
+               100.0 * len(delta) / len(new) if new else 0))
+    elif args.command == "apply":
+        with open(args.base, "rb") as fh:
+            base = fh.read()
+        with open(args.delta, "rb") as fh:
+            delta = fh.read()
+        with open(args.out, "wb") as fh:
+            fh.write(apply_delta(base, delta))
+    else:
+        with open(args.delta, "rb") as fh:
+            info(fh.read())
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())